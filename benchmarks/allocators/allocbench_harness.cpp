@@ -0,0 +1,399 @@
+// allocbench_harness.cpp                                             -*-C++-*-
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace allocbench {
+namespace {
+
+const char *const k_NAMES[AllocatorKind::k_NUM_KINDS] = {
+    "newdelete",
+    "multipool",
+    "sequential",
+    "localsequential",
+    "concurrentmultipool"
+};
+
+enum {
+    k_LOCAL_BUFFER_SIZE = 16 * 1024  // size of the 'LocalSequentialAllocator'
+                                     // buffer
+};
+
+void usage(const char *program)
+    // Print a usage message for the specified 'program' to 'stderr'.
+{
+    bsl::fprintf(stderr,
+                 "usage: %s [-a allocator]... [-i iterations] [-s scale]"
+                 " [-c]\n"
+                 "allocators:",
+                 program);
+    for (int i = 0; i < AllocatorKind::k_NUM_KINDS; ++i) {
+        bsl::fprintf(stderr, " %s", k_NAMES[i]);
+    }
+    bsl::fprintf(stderr, "\n");
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // struct AllocatorKind
+                            // --------------------
+
+// CLASS METHODS
+bool AllocatorKind::isThreadSafe(Enum value)
+{
+    return e_NEW_DELETE == value || e_CONCURRENT_MULTIPOOL == value;
+}
+
+int AllocatorKind::fromAscii(Enum *result, const bsl::string_view& name)
+{
+    BSLS_ASSERT(result);
+
+    for (int i = 0; i < k_NUM_KINDS; ++i) {
+        if (name == k_NAMES[i]) {
+            *result = static_cast<Enum>(i);
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+const char *AllocatorKind::toAscii(Enum value)
+{
+    BSLS_ASSERT(0 <= value && static_cast<int>(value) < k_NUM_KINDS);
+
+    return k_NAMES[value];
+}
+
+                                // -----------
+                                // class Probe
+                                // -----------
+
+// CLASS METHODS
+bsls::Types::Int64 Probe::residentSetKb()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // The second field of '/proc/self/statm' is the number of resident pages.
+
+    bsl::FILE *file = bsl::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;                                                     // RETURN
+    }
+    long size     = 0;
+    long resident = 0;
+    int  rc       = bsl::fscanf(file, "%ld %ld", &size, &resident);
+    bsl::fclose(file);
+    if (2 != rc) {
+        return 0;                                                     // RETURN
+    }
+    return static_cast<bsls::Types::Int64>(resident) *
+                                              (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return 0;
+#endif
+}
+
+// CREATORS
+Probe::Probe()
+: d_baselineKb(residentSetKb())
+, d_peakKb(d_baselineKb)
+{
+}
+
+// MANIPULATORS
+void Probe::sample()
+{
+    bsls::Types::Int64 current = residentSetKb();
+    if (current > d_peakKb) {
+        d_peakKb = current;
+    }
+}
+
+// ACCESSORS
+bsls::Types::Int64 Probe::growthKb() const
+{
+    return d_peakKb - d_baselineKb;
+}
+
+                           // ----------------------
+                           // class CacheMissCounter
+                           // ----------------------
+
+// CREATORS
+CacheMissCounter::CacheMissCounter()
+: d_fd(-1)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    perf_event_attr attr;
+    bsl::memset(&attr, 0, sizeof attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof attr;
+    attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled       = 1;
+    attr.inherit        = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    d_fd = static_cast<int>(syscall(__NR_perf_event_open,
+                                    &attr,
+                                    0,     // this process
+                                    -1,    // any CPU
+                                    -1,    // no group
+                                    0));
+#endif
+}
+
+CacheMissCounter::~CacheMissCounter()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (0 <= d_fd) {
+        close(d_fd);
+    }
+#endif
+}
+
+// MANIPULATORS
+void CacheMissCounter::start()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (0 <= d_fd) {
+        ioctl(d_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(d_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+bsls::Types::Int64 CacheMissCounter::stop()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (0 <= d_fd) {
+        ioctl(d_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        bsls::Types::Int64 count = 0;
+        if (sizeof count == read(d_fd, &count, sizeof count)) {
+            return count;                                             // RETURN
+        }
+    }
+#endif
+    return -1;
+}
+
+// ACCESSORS
+bool CacheMissCounter::isValid() const
+{
+    return 0 <= d_fd;
+}
+
+                               // -------------
+                               // class Harness
+                               // -------------
+
+// CLASS METHODS
+bsls::Types::Int64 Harness::runWithAllocator(AllocatorKind::Enum  kind,
+                                             const Workload&      workload,
+                                             Probe               *probe)
+{
+    BSLS_ASSERT(probe);
+
+    switch (kind) {
+      case AllocatorKind::e_NEW_DELETE: {
+        return workload(&bslma::NewDeleteAllocator::singleton(),
+                        probe);                                       // RETURN
+      }
+      case AllocatorKind::e_MULTIPOOL: {
+        bdlma::MultipoolAllocator allocator;
+        return workload(&allocator, probe);                           // RETURN
+      }
+      case AllocatorKind::e_SEQUENTIAL: {
+        bdlma::SequentialAllocator allocator;
+        return workload(&allocator, probe);                           // RETURN
+      }
+      case AllocatorKind::e_LOCAL_SEQUENTIAL: {
+        bdlma::LocalSequentialAllocator<k_LOCAL_BUFFER_SIZE> allocator;
+        return workload(&allocator, probe);                           // RETURN
+      }
+      case AllocatorKind::e_CONCURRENT_MULTIPOOL: {
+        bdlma::ConcurrentMultipoolAllocator allocator;
+        return workload(&allocator, probe);                           // RETURN
+      }
+    }
+    BSLS_ASSERT_INVOKE_NORETURN("unreachable");
+    return 0;
+}
+
+// CREATORS
+Harness::Harness(int argc, char *argv[])
+: d_iterations(5)
+, d_scale(1)
+, d_csv(false)
+{
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string_view arg(argv[i]);
+        if ("-c" == arg) {
+            d_csv = true;
+            continue;                                               // CONTINUE
+        }
+        if (i + 1 < argc) {
+            if ("-a" == arg) {
+                AllocatorKind::Enum kind;
+                if (0 == AllocatorKind::fromAscii(&kind, argv[++i])) {
+                    d_kinds.push_back(kind);
+                    continue;                                       // CONTINUE
+                }
+            }
+            else if ("-i" == arg) {
+                d_iterations = bsl::atoi(argv[++i]);
+                if (0 < d_iterations) {
+                    continue;                                       // CONTINUE
+                }
+            }
+            else if ("-s" == arg) {
+                d_scale = bsl::atoi(argv[++i]);
+                if (0 < d_scale) {
+                    continue;                                       // CONTINUE
+                }
+            }
+        }
+        usage(argv[0]);
+        bsl::exit(1);
+    }
+
+    if (d_kinds.empty()) {
+        for (int i = 0; i < AllocatorKind::k_NUM_KINDS; ++i) {
+            d_kinds.push_back(static_cast<AllocatorKind::Enum>(i));
+        }
+    }
+
+    if (d_csv) {
+        bsl::printf("workload,allocator,ops_per_sec,rss_growth_kb,"
+                    "cache_misses\n");
+    }
+    else {
+        bsl::printf("%-24s %-20s %14s %14s %16s\n",
+                    "workload",
+                    "allocator",
+                    "ops/sec",
+                    "rss-growth-kb",
+                    "cache-misses");
+    }
+}
+
+// MANIPULATORS
+void Harness::run(const char *workloadName, const Workload& workload)
+{
+    using namespace bdlf::PlaceHolders;
+
+    runPerKind(workloadName,
+               bdlf::BindUtil::bind(&Harness::runWithAllocator,
+                                    _1,
+                                    workload,
+                                    _2));
+}
+
+void Harness::runPerKind(const char          *workloadName,
+                         const KindWorkload&  workload)
+{
+    BSLS_ASSERT(workloadName);
+
+    for (bsl::size_t k = 0; k < d_kinds.size(); ++k) {
+        Measurement      result;
+        CacheMissCounter counter;
+        Probe            probe;
+
+        result.d_allocator = d_kinds[k];
+
+        // Warm up once so that lazily initialized state (e.g., the global
+        // heap's arenas) is not charged to the first allocator.
+
+        workload(result.d_allocator, &probe);
+
+        bsls::Types::Int64 ops = 0;
+
+        counter.start();
+        const bsls::Types::Int64 startNs = bsls::TimeUtil::getTimer();
+
+        for (int i = 0; i < d_iterations; ++i) {
+            ops += workload(result.d_allocator, &probe);
+        }
+
+        const bsls::Types::Int64 elapsedNs =
+                                      bsls::TimeUtil::getTimer() - startNs;
+        result.d_cacheMisses = counter.stop();
+
+        result.d_opsPerSecond = elapsedNs
+                              ? static_cast<double>(ops) * 1e9 /
+                                                static_cast<double>(elapsedNs)
+                              : 0.0;
+        result.d_rssGrowthKb  = probe.growthKb();
+
+        char misses[32];
+        if (0 <= result.d_cacheMisses) {
+            bsl::snprintf(misses,
+                          sizeof misses,
+                          "%lld",
+                          static_cast<long long>(result.d_cacheMisses));
+        }
+        else {
+            bsl::snprintf(misses, sizeof misses, "n/a");
+        }
+
+        bsl::printf(d_csv ? "%s,%s,%.0f,%lld,%s\n"
+                          : "%-24s %-20s %14.0f %14lld %16s\n",
+                    workloadName,
+                    AllocatorKind::toAscii(result.d_allocator),
+                    result.d_opsPerSecond,
+                    static_cast<long long>(result.d_rssGrowthKb),
+                    misses);
+        bsl::fflush(stdout);
+    }
+}
+
+// ACCESSORS
+int Harness::scale() const
+{
+    return d_scale;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,279 @@
+// allocbench_harness.h                                               -*-C++-*-
+#ifndef INCLUDED_ALLOCBENCH_HARNESS
+#define INCLUDED_ALLOCBENCH_HARNESS
+
+//@PURPOSE: Provide a harness for measuring allocator-sensitive workloads.
+//
+//@CLASSES:
+//  allocbench::AllocatorKind: enumeration of the benchmarked allocators
+//  allocbench::Probe: sampler of resident memory during a workload
+//  allocbench::CacheMissCounter: hardware cache-miss counter (Linux only)
+//  allocbench::Measurement: result of running a workload once
+//  allocbench::Harness: driver that runs a workload against each allocator
+//
+//@DESCRIPTION: This component provides the measurement machinery shared by
+// the allocator benchmark drivers in this directory.  A *workload* is a
+// function that exercises one or more 'bsl' containers using a supplied
+// 'bslma::Allocator' and returns the number of logical operations performed.
+// 'allocbench::Harness::run' constructs each allocator under test (see
+// 'allocbench::AllocatorKind'), invokes the workload with it for a fixed
+// number of iterations, and reports, for each allocator:
+//
+//: o the throughput of the workload in operations per second
+//:
+//: o the growth of the resident set size (RSS) of the process, in kilobytes,
+//:   observed at the points where the workload calls 'Probe::sample'
+//:
+//: o the number of last-level cache misses, where the platform exposes
+//:   hardware performance counters to unprivileged processes ('perf' events
+//:   on Linux); otherwise 'n/a' is reported
+//
+// Note that the resident set size of a process rarely shrinks once memory has
+// been touched, so RSS figures for allocators run late in a sequence are
+// relative to a higher baseline.  Use the '-a' option of the drivers to run
+// a single allocator per process when comparing memory footprints.
+//
+///Allocators
+///----------
+// The following allocators are benchmarked:
+//..
+//  Name                Allocator                             Thread-Safe
+//  ------------------  ------------------------------------  -----------
+//  newdelete           bslma::NewDeleteAllocator::singleton  yes
+//  multipool           bdlma::MultipoolAllocator             no
+//  sequential          bdlma::SequentialAllocator            no
+//  localsequential     bdlma::LocalSequentialAllocator<16K>  no
+//  concurrentmultipool bdlma::ConcurrentMultipoolAllocator   yes
+//..
+// 'bdlma::Multipool' is not itself a 'bslma::Allocator'; it is benchmarked
+// through 'bdlma::MultipoolAllocator', which adapts it to the protocol with a
+// single forwarding call.  A fresh allocator object is created for every
+// iteration of a workload, so the cost of constructing and releasing the
+// managed allocators is part of the measurement, as it would be for an
+// allocator whose lifetime is bound to a unit of work.
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace allocbench {
+
+                            // ====================
+                            // struct AllocatorKind
+                            // ====================
+
+struct AllocatorKind {
+    // This 'struct' provides a namespace for enumerating the allocators under
+    // test.
+
+    // TYPES
+    enum Enum {
+        e_NEW_DELETE,
+        e_MULTIPOOL,
+        e_SEQUENTIAL,
+        e_LOCAL_SEQUENTIAL,
+        e_CONCURRENT_MULTIPOOL
+    };
+
+    enum { k_NUM_KINDS = e_CONCURRENT_MULTIPOOL + 1 };
+
+    // CLASS METHODS
+    static bool isThreadSafe(Enum value);
+        // Return 'true' if an allocator of the specified 'value' kind may be
+        // shared by several threads, and 'false' otherwise.
+
+    static int fromAscii(Enum *result, const bsl::string_view& name);
+        // Load into the specified 'result' the enumerator whose short name
+        // (as returned by 'toAscii') matches the specified 'name'.  Return 0
+        // on success, and a non-zero value (with no effect on 'result') if
+        // 'name' does not name an allocator kind.
+
+    static const char *toAscii(Enum value);
+        // Return the short name of the specified enumerator 'value'.
+};
+
+                                // ===========
+                                // class Probe
+                                // ===========
+
+class Probe {
+    // This class records the largest resident set size of the process
+    // observed by 'sample' relative to the resident set size at construction.
+
+    // DATA
+    bsls::Types::Int64 d_baselineKb;  // RSS when constructed
+    bsls::Types::Int64 d_peakKb;      // largest RSS observed by 'sample'
+
+  private:
+    // NOT IMPLEMENTED
+    Probe(const Probe&);
+    Probe& operator=(const Probe&);
+
+  public:
+    // CLASS METHODS
+    static bsls::Types::Int64 residentSetKb();
+        // Return the current resident set size of this process in kilobytes,
+        // or 0 if it cannot be determined on this platform.
+
+    // CREATORS
+    Probe();
+        // Create a probe whose baseline is the current resident set size.
+
+    // MANIPULATORS
+    void sample();
+        // Record the current resident set size if it exceeds all previously
+        // sampled values.  Workloads should call this at the point where
+        // their data structures are fully populated.
+
+    // ACCESSORS
+    bsls::Types::Int64 growthKb() const;
+        // Return the difference between the largest sampled resident set size
+        // and the baseline, or 0 if no sample exceeded the baseline.
+};
+
+                           // ======================
+                           // class CacheMissCounter
+                           // ======================
+
+class CacheMissCounter {
+    // This class provides a scoped hardware counter of cache misses incurred
+    // by the calling thread (and threads it subsequently creates).  Where the
+    // counter cannot be opened (unsupported platform, or restricted by
+    // 'perf_event_paranoid'), 'isValid' returns 'false'.
+
+    // DATA
+    int d_fd;  // perf event file descriptor, or -1
+
+  private:
+    // NOT IMPLEMENTED
+    CacheMissCounter(const CacheMissCounter&);
+    CacheMissCounter& operator=(const CacheMissCounter&);
+
+  public:
+    // CREATORS
+    CacheMissCounter();
+        // Create a counter, and attempt to open the underlying hardware
+        // event.  The counter is initially stopped.
+
+    ~CacheMissCounter();
+        // Close the underlying hardware event, if any.
+
+    // MANIPULATORS
+    void start();
+        // Reset the counter to 0 and begin counting.
+
+    bsls::Types::Int64 stop();
+        // Stop counting and return the number of cache misses counted since
+        // the last call to 'start', or -1 if '!isValid()'.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if the hardware counter is available.
+};
+
+                             // ==================
+                             // struct Measurement
+                             // ==================
+
+struct Measurement {
+    // This 'struct' holds the result of running a workload against one
+    // allocator.
+
+    // PUBLIC DATA
+    AllocatorKind::Enum d_allocator;      // allocator under test
+    double              d_opsPerSecond;   // workload throughput
+    bsls::Types::Int64  d_rssGrowthKb;    // see 'Probe::growthKb'
+    bsls::Types::Int64  d_cacheMisses;    // -1 if unavailable
+};
+
+                               // =============
+                               // class Harness
+                               // =============
+
+class Harness {
+    // This class runs a workload once per selected allocator and prints a
+    // report of the resulting measurements.
+
+  public:
+    // TYPES
+    typedef bsl::function<bsls::Types::Int64(bslma::Allocator *, Probe *)>
+                                                                 Workload;
+        // A 'Workload' exercises the supplied allocator for one iteration,
+        // calls 'Probe::sample' when its working set is at its largest, and
+        // returns the number of logical operations performed.
+
+    typedef bsl::function<bsls::Types::Int64(AllocatorKind::Enum, Probe *)>
+                                                                 KindWorkload;
+        // A 'KindWorkload' is a 'Workload' that is responsible for creating
+        // the allocators it uses (e.g., one per thread), given their kind.
+
+  private:
+    // DATA
+    bsl::vector<AllocatorKind::Enum> d_kinds;       // allocators to run
+    int                              d_iterations;  // per allocator
+    int                              d_scale;       // workload size factor
+    bool                             d_csv;         // CSV output format
+
+  public:
+    // CLASS METHODS
+    static bsls::Types::Int64 runWithAllocator(AllocatorKind::Enum  kind,
+                                               const Workload&      workload,
+                                               Probe               *probe);
+        // Create an allocator of the specified 'kind', invoke the specified
+        // 'workload' once with it and the specified 'probe', destroy the
+        // allocator, and return the value returned by 'workload'.
+
+    // CREATORS
+    Harness(int argc, char *argv[]);
+        // Create a harness configured from the specified command line
+        // 'argc' and 'argv'.  The recognized options are:
+        //..
+        //  -a <name>  run only the named allocator (may be repeated)
+        //  -i <n>     iterations per allocator (default 5)
+        //  -s <n>     workload scale factor (default 1)
+        //  -c         print comma-separated values
+        //..
+        // Unrecognized options print a usage message and exit the process.
+
+    // MANIPULATORS
+    void run(const char *workloadName, const Workload& workload);
+        // Run the specified 'workload' against each selected allocator and
+        // print one report line per allocator, labeled with the specified
+        // 'workloadName'.
+
+    void runPerKind(const char *workloadName, const KindWorkload& workload);
+        // Run the specified 'workload' once for each selected allocator kind
+        // and print one report line per allocator, labeled with the specified
+        // 'workloadName'.
+
+    // ACCESSORS
+    int scale() const;
+        // Return the workload scale factor.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
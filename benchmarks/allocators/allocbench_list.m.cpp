@@ -0,0 +1,79 @@
+// allocbench_list.m.cpp                                              -*-C++-*-
+
+// Benchmark a queue-like usage of 'bsl::list', in which nodes are repeatedly
+// appended at the back and removed from the front so that the live set stays
+// constant while the allocator recycles (or, for the sequential allocators,
+// abandons) node memory, with each allocator under test.
+
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_list.h>
+
+using namespace BloombergLP;
+using namespace bdlf::PlaceHolders;
+
+namespace {
+
+bsls::Types::Int64 cycleList(int                scale,
+                             bslma::Allocator  *allocator,
+                             allocbench::Probe *probe)
+    // Fill a list to 16384 nodes using the specified 'allocator', then
+    // perform '262144 * scale' push-back/pop-front pairs, sampling the
+    // specified 'probe' at the end.  Return the number of list operations
+    // performed.
+{
+    const int k_LIVE_NODES = 16384;
+    const int k_NUM_CYCLES = 262144 * scale;
+
+    bsl::list<bsls::Types::Int64> list(allocator);
+
+    for (int i = 0; i < k_LIVE_NODES; ++i) {
+        list.push_back(i);
+    }
+
+    bsls::Types::Int64 sum = 0;
+    for (int i = 0; i < k_NUM_CYCLES; ++i) {
+        sum += list.front();
+        list.pop_front();
+        list.push_back(i);
+    }
+    probe->sample();
+
+    return sum >= 0 ? k_LIVE_NODES + 2 * static_cast<bsls::Types::Int64>(
+                                                                 k_NUM_CYCLES)
+                    : 0;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    allocbench::Harness harness(argc, argv);
+
+    harness.run("list<Int64>",
+                bdlf::BindUtil::bind(&cycleList, harness.scale(), _1, _2));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
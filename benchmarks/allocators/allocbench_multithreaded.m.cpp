@@ -0,0 +1,200 @@
+// allocbench_multithreaded.m.cpp                                     -*-C++-*-
+
+// Benchmark concurrent allocation: several threads each churn a private table
+// of strings and a private 'bsl::unordered_map'.  Thread-safe allocators
+// ('newdelete', 'concurrentmultipool') are shared by all threads, so the
+// measurement includes their synchronization cost; the other allocators are
+// instantiated once per thread, which is how they are meant to be used in a
+// multithreaded program.
+
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bdlf::PlaceHolders;
+
+namespace {
+
+enum { k_DEFAULT_NUM_THREADS = 4 };
+
+struct ThreadContext {
+    // This 'struct' holds the state shared by the threads of one iteration.
+
+    // PUBLIC DATA
+    int                  d_scale;         // workload size factor
+    bslmt::Barrier      *d_barrier_p;     // rendezvous with the main thread
+    bsls::AtomicInt64    d_ops;           // operations performed
+};
+
+bsls::Types::Int64 churn(ThreadContext     *context,
+                         bslma::Allocator  *allocator,
+                         allocbench::Probe *)
+    // Churn a string table and a hash map using the specified 'allocator',
+    // waiting on the barrier of the specified 'context' once populated (so
+    // the main thread can sample memory) and again before releasing memory.
+    // Return the number of operations performed.
+{
+    const int k_TABLE_SIZE  = 1024;
+    const int k_NUM_UPDATES = 65536 * context->d_scale;
+
+    bsl::vector<bsl::string>              table(k_TABLE_SIZE, allocator);
+    bsl::unordered_map<int, bsl::string>  map(allocator);
+
+    unsigned int seed = 54321;
+
+    for (int i = 0; i < k_NUM_UPDATES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const bsl::size_t index  = (seed >> 8) % k_TABLE_SIZE;
+        seed = seed * 1103515245u + 12345u;
+        const bsl::size_t length = (seed >> 16) % 256;
+
+        bsl::string replacement(length, 't', allocator);
+        table[index].swap(replacement);
+
+        const int key = static_cast<int>(index);
+        if (i & 1) {
+            map.erase(key);
+        }
+        else {
+            map[key].assign(length / 2, 'm');
+        }
+    }
+
+    context->d_barrier_p->wait();  // populated
+    context->d_barrier_p->wait();  // sampled
+
+    return 2 * static_cast<bsls::Types::Int64>(k_NUM_UPDATES);
+}
+
+void threadMain(ThreadContext *context, allocbench::AllocatorKind::Enum kind)
+    // Run 'churn' with a newly created allocator of the specified 'kind',
+    // accumulating the operation count into the specified 'context'.
+{
+    allocbench::Probe unused;
+    context->d_ops += allocbench::Harness::runWithAllocator(
+                                   kind,
+                                   bdlf::BindUtil::bind(&churn, context, _1, _2),
+                                   &unused);
+}
+
+void sharedThreadMain(ThreadContext *context, bslma::Allocator *allocator)
+    // Run 'churn' with the specified shared 'allocator', accumulating the
+    // operation count into the specified 'context'.
+{
+    context->d_ops += churn(context, allocator, 0);
+}
+
+bsls::Types::Int64 startThreads(int                numThreads,
+                                ThreadContext     *context,
+                                bslma::Allocator  *sharedAllocator,
+                                allocbench::AllocatorKind::Enum kind,
+                                allocbench::Probe *probe)
+    // Run 'churn' on the specified 'numThreads' threads with the specified
+    // 'context', using the specified 'sharedAllocator' if it is not 0, and an
+    // allocator of the specified 'kind' per thread otherwise.  Sample the
+    // specified 'probe' once every thread has populated its containers.
+    // Return the total number of operations performed.
+{
+    bslmt::ThreadGroup threads;
+    if (sharedAllocator) {
+        threads.addThreads(bdlf::BindUtil::bind(&sharedThreadMain,
+                                                context,
+                                                sharedAllocator),
+                           numThreads);
+    }
+    else {
+        threads.addThreads(bdlf::BindUtil::bind(&threadMain, context, kind),
+                           numThreads);
+    }
+
+    context->d_barrier_p->wait();
+    probe->sample();
+    context->d_barrier_p->wait();
+
+    threads.joinAll();
+    return context->d_ops;
+}
+
+bsls::Types::Int64 runThreads(int                              scale,
+                              int                              numThreads,
+                              allocbench::AllocatorKind::Enum  kind,
+                              allocbench::Probe               *probe)
+    // Run one iteration of the multithreaded workload on the specified
+    // 'numThreads' threads with allocators of the specified 'kind', scaled by
+    // the specified 'scale', sampling the specified 'probe'.  Return the
+    // total number of operations performed.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+    ThreadContext  context;
+    context.d_scale     = scale;
+    context.d_barrier_p = &barrier;
+
+    if (allocbench::AllocatorKind::isThreadSafe(kind)) {
+        return allocbench::Harness::runWithAllocator(
+                                       kind,
+                                       bdlf::BindUtil::bind(&startThreads,
+                                                            numThreads,
+                                                            &context,
+                                                            _1,
+                                                            kind,
+                                                            _2),
+                                       probe);                        // RETURN
+    }
+    return startThreads(numThreads, &context, 0, kind, probe);
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    // The number of threads is taken from the 'ALLOCBENCH_THREADS' environment
+    // variable so that the common harness options are unchanged.
+
+    int         numThreads = k_DEFAULT_NUM_THREADS;
+    const char *env        = bsl::getenv("ALLOCBENCH_THREADS");
+    if (env && 0 < bsl::atoi(env)) {
+        numThreads = bsl::atoi(env);
+    }
+
+    allocbench::Harness harness(argc, argv);
+
+    harness.runPerKind("multithreaded-churn",
+                       bdlf::BindUtil::bind(&runThreads,
+                                            harness.scale(),
+                                            numThreads,
+                                            _1,
+                                            _2));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
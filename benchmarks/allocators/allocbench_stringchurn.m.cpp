@@ -0,0 +1,86 @@
+// allocbench_stringchurn.m.cpp                                       -*-C++-*-
+
+// Benchmark "churn" of variable-length strings: a fixed-size table of
+// 'bsl::string' objects whose elements are repeatedly replaced by strings of
+// pseudo-random length, so that blocks of many different sizes are allocated
+// and freed in an unpredictable order, with each allocator under test.
+
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bdlf::PlaceHolders;
+
+namespace {
+
+bsls::Types::Int64 churnStrings(int                scale,
+                                bslma::Allocator  *allocator,
+                                allocbench::Probe *probe)
+    // Populate a table of 4096 strings using the specified 'allocator' and
+    // replace '131072 * scale' pseudo-randomly chosen elements with strings
+    // of pseudo-random length between 0 and 511 characters, sampling the
+    // specified 'probe' at the end.  Return the number of replacements.
+{
+    const int k_TABLE_SIZE  = 4096;
+    const int k_NUM_UPDATES = 131072 * scale;
+
+    bsl::vector<bsl::string> table(k_TABLE_SIZE, allocator);
+
+    // A linear congruential generator keeps the sequence identical for every
+    // allocator without the cost of a library random number generator.
+
+    unsigned int seed = 12345;
+
+    for (int i = 0; i < k_NUM_UPDATES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const bsl::size_t index  = (seed >> 8) % k_TABLE_SIZE;
+        seed = seed * 1103515245u + 12345u;
+        const bsl::size_t length = (seed >> 16) % 512;
+
+        bsl::string replacement(length, 'c', allocator);
+        table[index].swap(replacement);
+    }
+    probe->sample();
+
+    return k_NUM_UPDATES;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    allocbench::Harness harness(argc, argv);
+
+    harness.run("string-churn",
+                bdlf::BindUtil::bind(&churnStrings,
+                                     harness.scale(),
+                                     _1,
+                                     _2));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,94 @@
+// allocbench_unorderedmap.m.cpp                                      -*-C++-*-
+
+// Benchmark node-based hash containers: populate a 'bsl::unordered_map' from
+// integer keys to string values, look every key up, then erase half of the
+// entries and re-insert them, with each allocator under test.
+
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+
+using namespace BloombergLP;
+using namespace bdlf::PlaceHolders;
+
+namespace {
+
+bsls::Types::Int64 churnUnorderedMap(int                scale,
+                                     bslma::Allocator  *allocator,
+                                     allocbench::Probe *probe)
+    // Insert '65536 * scale' entries into an unordered map using the
+    // specified 'allocator', look each up, and erase and re-insert every
+    // other entry, sampling the specified 'probe' when the map is fully
+    // populated.  Return the number of insert, find, and erase operations
+    // performed.
+{
+    typedef bsl::unordered_map<int, bsl::string> Map;
+
+    const int k_NUM_KEYS = 65536 * scale;
+
+    Map map(allocator);
+
+    bsls::Types::Int64 ops = 0;
+
+    for (int i = 0; i < k_NUM_KEYS; ++i) {
+        map.emplace(i * 7919, bsl::string(24 + i % 16, 'v'));
+        ++ops;
+    }
+    probe->sample();
+
+    bsls::Types::Int64 found = 0;
+    for (int i = 0; i < k_NUM_KEYS; ++i) {
+        found += map.count(i * 7919);
+        ++ops;
+    }
+
+    for (int i = 0; i < k_NUM_KEYS; i += 2) {
+        map.erase(i * 7919);
+        ++ops;
+    }
+    for (int i = 0; i < k_NUM_KEYS; i += 2) {
+        map.emplace(i * 7919, bsl::string(40, 'w'));
+        ++ops;
+    }
+    probe->sample();
+
+    return found == k_NUM_KEYS ? ops : 0;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    allocbench::Harness harness(argc, argv);
+
+    harness.run("unordered_map<int,string>",
+                bdlf::BindUtil::bind(&churnUnorderedMap,
+                                     harness.scale(),
+                                     _1,
+                                     _2));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,109 @@
+// allocbench_vector.m.cpp                                            -*-C++-*-
+
+// Benchmark growth and destruction of 'bsl::vector' objects, both of
+// fundamental elements (one allocation per reallocation) and of allocating
+// elements (one allocation per element), with each allocator under test.
+
+#include <allocbench_harness.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bdlf::PlaceHolders;
+
+namespace {
+
+bsls::Types::Int64 growIntVectors(int                scale,
+                                  bslma::Allocator  *allocator,
+                                  allocbench::Probe *probe)
+    // Grow, one 'push_back' at a time, '256 * scale' vectors of 'int' to 1024
+    // elements each using the specified 'allocator', sampling the specified
+    // 'probe' once all vectors are populated.  Return the number of elements
+    // inserted.
+{
+    const int k_NUM_VECTORS  = 256 * scale;
+    const int k_NUM_ELEMENTS = 1024;
+
+    bsl::vector<bsl::vector<int> > vectors(allocator);
+    vectors.reserve(k_NUM_VECTORS);
+
+    for (int i = 0; i < k_NUM_VECTORS; ++i) {
+        vectors.emplace_back();
+        bsl::vector<int>& v = vectors.back();
+        for (int j = 0; j < k_NUM_ELEMENTS; ++j) {
+            v.push_back(j);
+        }
+    }
+    probe->sample();
+
+    return static_cast<bsls::Types::Int64>(k_NUM_VECTORS) * k_NUM_ELEMENTS;
+}
+
+bsls::Types::Int64 growStringVectors(int                scale,
+                                     bslma::Allocator  *allocator,
+                                     allocbench::Probe *probe)
+    // Grow '64 * scale' vectors of 'bsl::string' to 256 elements each, where
+    // each string is too long for the short-string buffer, using the
+    // specified 'allocator', and sampling the specified 'probe' once all
+    // vectors are populated.  Return the number of elements inserted.
+{
+    const int k_NUM_VECTORS  = 64 * scale;
+    const int k_NUM_ELEMENTS = 256;
+
+    bsl::vector<bsl::vector<bsl::string> > vectors(allocator);
+    vectors.reserve(k_NUM_VECTORS);
+
+    for (int i = 0; i < k_NUM_VECTORS; ++i) {
+        vectors.emplace_back();
+        bsl::vector<bsl::string>& v = vectors.back();
+        for (int j = 0; j < k_NUM_ELEMENTS; ++j) {
+            v.emplace_back(32 + j % 64, 'x');
+        }
+    }
+    probe->sample();
+
+    return static_cast<bsls::Types::Int64>(k_NUM_VECTORS) * k_NUM_ELEMENTS;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    allocbench::Harness harness(argc, argv);
+
+    harness.run("vector<int>",
+                bdlf::BindUtil::bind(&growIntVectors,
+                                     harness.scale(),
+                                     _1,
+                                     _2));
+    harness.run("vector<string>",
+                bdlf::BindUtil::bind(&growStringVectors,
+                                     harness.scale(),
+                                     _1,
+                                     _2));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
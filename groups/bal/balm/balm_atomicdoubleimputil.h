@@ -0,0 +1,179 @@
+// balm_atomicdoubleimputil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALM_ATOMICDOUBLEIMPUTIL
+#define INCLUDED_BALM_ATOMICDOUBLEIMPUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lock-free operations on 'double' values held as bits.
+//
+//@CLASSES:
+//  balm::AtomicDoubleImpUtil: namespace for atomic operations on 'double's
+//
+//@SEE_ALSO: balm_histogramcollector, balm_shardedcollector
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'balm::AtomicDoubleImpUtil', whose functions operate on a 'double' value
+// stored as its bit pattern in a 'bsls::AtomicInt64', so that the value can
+// be updated without a lock.  'add' adds to the value, and 'updateMin' and
+// 'updateMax' lower or raise the value, each using a compare-and-swap loop.
+//
+// This component is intended for use only by 'balm_histogramcollector' and
+// 'balm_shardedcollector'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Total and a Maximum
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads record values, and that we want the total and
+// the maximum of the recorded values.  First, we create the two atomic
+// variables, holding the bit patterns of their initial values:
+//..
+//  typedef balm::AtomicDoubleImpUtil Util;
+//
+//  bsls::AtomicInt64 total(Util::toBits(0.0));
+//  bsls::AtomicInt64 maximum(Util::toBits(0.0));
+//..
+// Then, each thread records its values (here we record just two):
+//..
+//  Util::add(&total, 2.5);
+//  Util::updateMax(&maximum, 2.5);
+//
+//  Util::add(&total, 1.0);
+//  Util::updateMax(&maximum, 1.0);
+//..
+// Finally, we read the results:
+//..
+//  assert(3.5 == Util::fromBits(total.load()));
+//  assert(2.5 == Util::fromBits(maximum.load()));
+//..
+
+#include <balscm_version.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                         // ==========================
+                         // struct AtomicDoubleImpUtil
+                         // ==========================
+
+struct AtomicDoubleImpUtil {
+    // This 'struct' provides a namespace for lock-free operations on 'double'
+    // values stored as their bit patterns in 64-bit atomic integers.
+
+    // CLASS METHODS
+    static void add(bsls::AtomicInt64 *bits, double value);
+        // Atomically add the specified 'value' to the 'double' whose bit
+        // pattern is held by the specified 'bits'.
+
+    static double fromBits(bsls::Types::Int64 bits);
+        // Return the 'double' value having the specified 'bits' pattern.
+
+    static bsls::Types::Int64 toBits(double value);
+        // Return the bit pattern of the specified 'value'.
+
+    static void updateMax(bsls::AtomicInt64 *bits, double value);
+        // Atomically replace the 'double' whose bit pattern is held by the
+        // specified 'bits' with the specified 'value' if 'value' is greater.
+
+    static void updateMin(bsls::AtomicInt64 *bits, double value);
+        // Atomically replace the 'double' whose bit pattern is held by the
+        // specified 'bits' with the specified 'value' if 'value' is less.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct AtomicDoubleImpUtil
+                         // --------------------------
+
+// CLASS METHODS
+inline
+void AtomicDoubleImpUtil::add(bsls::AtomicInt64 *bits, double value)
+{
+    bsls::Types::Int64 old = bits->loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 prev = bits->testAndSwap(
+                                            old,
+                                            toBits(fromBits(old) + value));
+        if (prev == old) {
+            break;
+        }
+        old = prev;
+    }
+}
+
+inline
+double AtomicDoubleImpUtil::fromBits(bsls::Types::Int64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+inline
+bsls::Types::Int64 AtomicDoubleImpUtil::toBits(double value)
+{
+    bsls::Types::Int64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+void AtomicDoubleImpUtil::updateMax(bsls::AtomicInt64 *bits, double value)
+{
+    // The extrema rarely change once a few values have been recorded, so test
+    // before attempting to write them.
+
+    bsls::Types::Int64 old = bits->loadRelaxed();
+    while (value > fromBits(old)) {
+        const bsls::Types::Int64 prev = bits->testAndSwap(old, toBits(value));
+        if (prev == old) {
+            break;
+        }
+        old = prev;
+    }
+}
+
+inline
+void AtomicDoubleImpUtil::updateMin(bsls::AtomicInt64 *bits, double value)
+{
+    bsls::Types::Int64 old = bits->loadRelaxed();
+    while (value < fromBits(old)) {
+        const bsls::Types::Int64 prev = bits->testAndSwap(old, toBits(value));
+        if (prev == old) {
+            break;
+        }
+        old = prev;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
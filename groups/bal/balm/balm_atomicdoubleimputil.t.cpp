@@ -0,0 +1,398 @@
+// balm_atomicdoubleimputil.t.cpp                                     -*-C++-*-
+#include <balm_atomicdoubleimputil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::AtomicDoubleImpUtil' provides functions that operate on a 'double'
+// held as its bit pattern in a 'bsls::AtomicInt64'.  Ensure that the bit
+// conversions round-trip, that each operation has the documented effect for
+// ordinary values and infinities, and that no update is lost when several
+// threads operate on the same value.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static void add(bsls::AtomicInt64 *bits, double value);
+// [ 1] static double fromBits(bsls::Types::Int64 bits);
+// [ 1] static bsls::Types::Int64 toBits(double value);
+// [ 2] static void updateMax(bsls::AtomicInt64 *bits, double value);
+// [ 2] static void updateMin(bsls::AtomicInt64 *bits, double value);
+// ----------------------------------------------------------------------------
+// [ 3] CONCURRENCY TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::AtomicDoubleImpUtil Util;
+
+const double k_INF = bsl::numeric_limits<double>::infinity();
+
+// ============================================================================
+//                      GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct UpdateThread {
+    // Add 'k_NUM_UPDATES' values to a total, and record them in a minimum and
+    // a maximum.  The values are the integers from 'd_first' up, which are
+    // represented exactly, so the total does not depend on the order of the
+    // additions.
+
+    enum { k_NUM_UPDATES = 100000 };
+
+    bsls::AtomicInt64 *d_total_p;
+    bsls::AtomicInt64 *d_min_p;
+    bsls::AtomicInt64 *d_max_p;
+    int                d_first;
+    bslmt::Barrier    *d_barrier_p;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < k_NUM_UPDATES; ++i) {
+            const double value = d_first + i;
+
+            Util::add(d_total_p, value);
+            Util::updateMin(d_min_p, value);
+            Util::updateMax(d_max_p, value);
+        }
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //:  1 The usage example provided in the component header file
+        //:    compiles, links, and runs as shown.
+        //
+        // Plan:
+        //:  1 Incorporate usage example from header into test driver, remove
+        //:    leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING USAGE EXAMPLE"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Total and a Maximum
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads record values, and that we want the total and
+// the maximum of the recorded values.  First, we create the two atomic
+// variables, holding the bit patterns of their initial values:
+//..
+    typedef balm::AtomicDoubleImpUtil Util;
+
+    bsls::AtomicInt64 total(Util::toBits(0.0));
+    bsls::AtomicInt64 maximum(Util::toBits(0.0));
+//..
+// Then, each thread records its values (here we record just two):
+//..
+    Util::add(&total, 2.5);
+    Util::updateMax(&maximum, 2.5);
+
+    Util::add(&total, 1.0);
+    Util::updateMax(&maximum, 1.0);
+//..
+// Finally, we read the results:
+//..
+    ASSERT(3.5 == Util::fromBits(total.load()));
+    ASSERT(2.5 == Util::fromBits(maximum.load()));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //:  1 Additions made concurrently by several threads to the same
+        //:    value are all recorded.
+        //:
+        //:  2 The minimum and maximum of values recorded concurrently by
+        //:    several threads are the least and greatest of those values.
+        //
+        // Plan:
+        //:  1 Start several threads that each add a distinct range of
+        //:    integers to a total, and record them in a minimum and maximum.
+        //:    Verify the total, minimum, and maximum once the threads have
+        //:    finished.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_N = UpdateThread::k_NUM_UPDATES };
+
+        bsls::AtomicInt64 total(Util::toBits(0.0));
+        bsls::AtomicInt64 min(Util::toBits(k_INF));
+        bsls::AtomicInt64 max(Util::toBits(-k_INF));
+        bslmt::Barrier    barrier(k_NUM_THREADS);
+
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_THREADS);
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            UpdateThread functor = { &total, &min, &max, i * k_N, &barrier };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        // The values are the integers from 0 to 'n - 1'.
+
+        const double n = static_cast<double>(k_NUM_THREADS) * k_N;
+
+        ASSERTV(Util::fromBits(total.load()),
+                n * (n - 1) / 2 == Util::fromBits(total.load()));
+        ASSERTV(Util::fromBits(min.load()),
+                0.0 == Util::fromBits(min.load()));
+        ASSERTV(Util::fromBits(max.load()),
+                n - 1 == Util::fromBits(max.load()));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'add', 'updateMin', AND 'updateMax'
+        //
+        // Concerns:
+        //:  1 'add' adds its argument to the held value.
+        //:
+        //:  2 'updateMin' replaces the held value only with a lesser value,
+        //:    and 'updateMax' only with a greater value.
+        //:
+        //:  3 Infinite initial values are replaced by any finite value, and
+        //:    a NaN argument leaves the extrema unchanged.
+        //
+        // Plan:
+        //:  1 Using the table-driven technique, apply each operation to a
+        //:    set of initial values and arguments, and verify the result.
+        //:    (C-1..3)
+        //
+        // Testing:
+        //   static void add(bsls::AtomicInt64 *bits, double value);
+        //   static void updateMax(bsls::AtomicInt64 *bits, double value);
+        //   static void updateMin(bsls::AtomicInt64 *bits, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'add', 'updateMin', AND 'updateMax'"
+                          << "\n==========================================="
+                          << endl;
+
+        const double NAN_VALUE = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int    d_line;
+            double d_initial;
+            double d_value;
+            double d_sum;
+            double d_min;
+            double d_max;
+        } DATA[] = {
+            //LINE  INITIAL  VALUE    SUM      MIN      MAX
+            //----  -------  -------  -------  -------  -------
+            { L_,       0.0,     0.0,     0.0,     0.0,     0.0 },
+            { L_,       0.0,     1.5,     1.5,     0.0,     1.5 },
+            { L_,       0.0,    -1.5,    -1.5,    -1.5,     0.0 },
+            { L_,       2.0,     2.0,     4.0,     2.0,     2.0 },
+            { L_,      -3.0,    0.25,   -2.75,    -3.0,    0.25 },
+            { L_,     1e300,   1e300,   2e300,   1e300,   1e300 },
+            { L_,     k_INF,    -7.0,   k_INF,    -7.0,   k_INF },
+            { L_,    -k_INF,     7.0,  -k_INF,  -k_INF,     7.0 },
+            { L_,       1.0,   k_INF,   k_INF,     1.0,   k_INF },
+            { L_,       1.0,  -k_INF,  -k_INF,  -k_INF,     1.0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE    = DATA[ti].d_line;
+            const double INITIAL = DATA[ti].d_initial;
+            const double VALUE   = DATA[ti].d_value;
+            const double SUM     = DATA[ti].d_sum;
+            const double MIN     = DATA[ti].d_min;
+            const double MAX     = DATA[ti].d_max;
+
+            bsls::AtomicInt64 x(Util::toBits(INITIAL));
+            Util::add(&x, VALUE);
+            ASSERTV(LINE, Util::fromBits(x.load()),
+                    SUM == Util::fromBits(x.load()));
+
+            x = Util::toBits(INITIAL);
+            Util::updateMin(&x, VALUE);
+            ASSERTV(LINE, Util::fromBits(x.load()),
+                    MIN == Util::fromBits(x.load()));
+
+            Util::updateMin(&x, NAN_VALUE);
+            ASSERTV(LINE, MIN == Util::fromBits(x.load()));
+
+            x = Util::toBits(INITIAL);
+            Util::updateMax(&x, VALUE);
+            ASSERTV(LINE, Util::fromBits(x.load()),
+                    MAX == Util::fromBits(x.load()));
+
+            Util::updateMax(&x, NAN_VALUE);
+            ASSERTV(LINE, MAX == Util::fromBits(x.load()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING 'toBits' AND 'fromBits'
+        //
+        // Concerns:
+        //:  1 'toBits' returns the IEEE-754 bit pattern of its argument.
+        //:
+        //:  2 'fromBits' is the inverse of 'toBits', including for signed
+        //:    zeros and infinities.
+        //
+        // Plan:
+        //:  1 Using the table-driven technique, convert a set of values with
+        //:    known bit patterns in both directions.  (C-1..2)
+        //
+        // Testing:
+        //   static double fromBits(bsls::Types::Int64 bits);
+        //   static bsls::Types::Int64 toBits(double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'toBits' AND 'fromBits'"
+                          << "\n===============================" << endl;
+
+        static const struct {
+            int                 d_line;
+            double              d_value;
+            bsls::Types::Uint64 d_bits;
+        } DATA[] = {
+            //LINE  VALUE    BITS
+            //----  -------  ---------------------
+            { L_,       0.0, 0x0000000000000000ULL },
+            { L_,      -0.0, 0x8000000000000000ULL },
+            { L_,       1.0, 0x3FF0000000000000ULL },
+            { L_,      -2.0, 0xC000000000000000ULL },
+            { L_,       0.5, 0x3FE0000000000000ULL },
+            { L_,     k_INF, 0x7FF0000000000000ULL },
+            { L_,    -k_INF, 0xFFF0000000000000ULL },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                LINE  = DATA[ti].d_line;
+            const double             VALUE = DATA[ti].d_value;
+            const bsls::Types::Int64 BITS  =
+                             static_cast<bsls::Types::Int64>(DATA[ti].d_bits);
+
+            ASSERTV(LINE, BITS == Util::toBits(VALUE));
+            ASSERTV(LINE, BITS == Util::toBits(Util::fromBits(BITS)));
+            ASSERTV(LINE, VALUE == Util::fromBits(BITS));
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -20,6 +20,7 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
 #include <bsl_ostream.h>
@@ -43,6 +44,51 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+struct Percentile {
+    // This 'struct' describes a percentile published for each histogram
+    // collector in the repository.
+
+    double      d_fraction;  // fraction of values below the percentile
+    const char *d_suffix;    // suffix of the metric name under which the
+                             // percentile is published
+};
+
+const Percentile k_PERCENTILES[] = {
+    { 0.5,   ".p50"  },
+    { 0.9,   ".p90"  },
+    { 0.99,  ".p99"  },
+    { 0.999, ".p999" }
+};
+
+const int k_NUM_PERCENTILES = sizeof k_PERCENTILES / sizeof *k_PERCENTILES;
+
+void appendPercentiles(bsl::vector<balm::MetricRecord>    *records,
+                       const balm::HistogramCollector&     histogram,
+                       const bsl::vector<balm::MetricId>&  percentileIds)
+    // Append to the specified 'records' a record for each percentile in
+    // 'k_PERCENTILES' of the specified 'histogram', identified by the
+    // corresponding element of the specified 'percentileIds'.  Each record
+    // has a count of 1 and a total, minimum, and maximum equal to the
+    // percentile, unless 'histogram' is empty, in which case it has the
+    // default values.
+{
+    balm::MetricRecord aggregate;
+    histogram.load(&aggregate);
+
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        balm::MetricRecord record(percentileIds[i]);
+        if (0 < aggregate.count()) {
+            const double value = histogram.percentile(
+                                                k_PERCENTILES[i].d_fraction);
+            record.count() = 1;
+            record.total() = value;
+            record.min()   = value;
+            record.max()   = value;
+        }
+        records->push_back(record);
+    }
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -258,11 +304,13 @@ class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
     // the 'Collector' and 'IntegerCollector' objects associated with a single
     // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // access the individual containers for 'Collector' and 'IntegerCollector'
+    // objects, respectively.  A 'ShardedCollector' and a 'HistogramCollector'
+    // are created for the metric only on request (by 'createShardedCollector'
+    // and 'createHistogramCollector'), since each occupies several cache
+    // lines.  The 'collectAndReset' method obtains the aggregate value of all
+    // the owned collectors, and then resets those collectors to their default
+    // state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
@@ -271,8 +319,22 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                         d_collectors;     // collector objects
+    IntCollectors                      d_intCollectors;  // integer collectors
+    bsls::AtomicPointer<ShardedCollector>
+                                       d_shardedCollector_p;
+                                                         // sharded collector
+                                                         // (owned, may be
+                                                         // null)
+    bsls::AtomicPointer<HistogramCollector>
+                                       d_histogramCollector_p;
+                                                         // histogram (owned,
+                                                         // may be null)
+    bsl::vector<MetricId>              d_percentileIds;  // ids of published
+                                                         // histogram
+                                                         // percentiles
+    bslma::Allocator                  *d_allocator_p;    // allocator (held,
+                                                         // not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,21 +368,48 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
-    void collectAndReset(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object; then
+    HistogramCollector *createHistogramCollector(
+                                   const bsl::vector<MetricId>& percentileIds);
+        // Return the address of the modifiable histogram collector for this
+        // metric, creating it if it does not already exist, in which case
+        // its percentiles will be published under the specified
+        // 'percentileIds' (corresponding to the elements of
+        // 'k_PERCENTILES').  The behavior is undefined unless
+        // 'percentileIds.size() == k_NUM_PERCENTILES'.
+
+    HistogramCollector *histogramCollector();
+        // Return the address of the modifiable histogram collector for this
+        // metric, or 0 if 'createHistogramCollector' has not been called.
+        // Note that this method may be called concurrently with
+        // 'createHistogramCollector'.
+
+    ShardedCollector *createShardedCollector();
+        // Return the address of the modifiable sharded collector for this
+        // metric, creating it if it does not already exist.
+
+    ShardedCollector *shardedCollector();
+        // Return the address of the modifiable sharded collector for this
+        // metric, or 0 if 'createShardedCollector' has not been called.  Note
+        // that this method may be called concurrently with
+        // 'createShardedCollector'.
+
+    void collectAndReset(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the percentile records of the histogram collector (if any); then
         // reset those collectors to their default values.  Note that all
         // collectors within this object record values for the same metric id,
         // so they can be aggregated into a single record.
 
-    void collect(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object.  Note
-        // that all collectors within this object record values for the same
-        // metric id, so they can be aggregated into a single record.  Also
-        // note that because this operation does not reset the collectors,
-        // subsequent 'collect' invocations will effectively re-collect the
-        // current values.
+    void collect(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the percentile records of the histogram collector (if any).
+        // Note that all collectors within this object record values for the
+        // same metric id, so they can be aggregated into a single record.
+        // Also note that because this operation does not reset the
+        // collectors, subsequent 'collect' invocations will effectively
+        // re-collect the current values.
 
     // ACCESSORS
     const CollectorRepository_Collectors<Collector>& collectors() const;
@@ -349,6 +438,10 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_shardedCollector_p(0)
+, d_histogramCollector_p(0)
+, d_percentileIds(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -356,6 +449,8 @@ inline
 CollectorRepository_MetricCollectors::
 ~CollectorRepository_MetricCollectors()
 {
+    d_allocator_p->deleteObject(d_shardedCollector_p.loadRelaxed());
+    d_allocator_p->deleteObject(d_histogramCollector_p.loadRelaxed());
 }
 
 // MANIPULATORS
@@ -373,21 +468,106 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+HistogramCollector *
+CollectorRepository_MetricCollectors::createHistogramCollector(
+                                    const bsl::vector<MetricId>& percentileIds)
+{
+    BSLS_ASSERT(k_NUM_PERCENTILES ==
+                                  static_cast<int>(percentileIds.size()));
+
+    // Publish the histogram only once it is fully constructed (and its
+    // percentile ids are set), since it may be read concurrently by
+    // 'histogramCollector'.
+
+    HistogramCollector *result = d_histogramCollector_p.loadRelaxed();
+    if (!result) {
+        d_percentileIds = percentileIds;
+        result = new (*d_allocator_p) HistogramCollector(metricId(),
+                                                         d_allocator_p);
+        d_histogramCollector_p.storeRelease(result);
+    }
+    return result;
+}
+
+inline
+HistogramCollector *CollectorRepository_MetricCollectors::histogramCollector()
+{
+    return d_histogramCollector_p.loadAcquire();
+}
+
+ShardedCollector *
+CollectorRepository_MetricCollectors::createShardedCollector()
+{
+    ShardedCollector *result = d_shardedCollector_p.loadRelaxed();
+    if (!result) {
+        result = new (*d_allocator_p) ShardedCollector(metricId(),
+                                                       d_allocator_p);
+        d_shardedCollector_p.storeRelease(result);
+    }
+    return result;
+}
+
+inline
+ShardedCollector *CollectorRepository_MetricCollectors::shardedCollector()
+{
+    return d_shardedCollector_p.loadAcquire();
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
-                                                          MetricRecord *record)
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collectAndReset(record);
+    MetricRecord record;
+    d_collectors.collectAndReset(&record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+    ShardedCollector *sharded = shardedCollector();
+    if (sharded) {
+        sharded->loadAndReset(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    HistogramCollector *histogram = histogramCollector();
+    if (!histogram) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    // Move the histogram's values to a snapshot, so that the aggregate and
+    // the percentiles are reported for the same set of values.
+
+    HistogramCollector snapshot(metricId(), d_allocator_p);
+    snapshot.drain(histogram);
+    snapshot.load(&tempRecord);
+    combine(&record, tempRecord);
+    records->push_back(record);
+    appendPercentiles(records, snapshot, d_percentileIds);
 }
 
-void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+void CollectorRepository_MetricCollectors::collect(
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collect(record);
+    MetricRecord record;
+    d_collectors.collect(&record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+    ShardedCollector *sharded = shardedCollector();
+    if (sharded) {
+        sharded->load(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    HistogramCollector *histogram = histogramCollector();
+    if (!histogram) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    HistogramCollector snapshot(metricId(), d_allocator_p);
+    snapshot.merge(*histogram);
+    snapshot.load(&tempRecord);
+    combine(&record, tempRecord);
+    records->push_back(record);
+    appendPercentiles(records, snapshot, d_percentileIds);
 }
 
 // ACCESSORS
@@ -443,9 +623,26 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
                                 bsl::make_pair(metricId, collectorsPtr)).first;
         colCategory.push_back(collectorsPtr.get());
     }
+
+    // Add the collectors to the concurrent index, unless they are already
+    // there.  This is done on each call (rather than only when the collectors
+    // are created), so that a previous failure to insert into the index is
+    // corrected.
+
+    d_collectorIndex.insert(metricId.description(), cIt->second.get());
     return *cIt->second.get();
 }
 
+// PRIVATE ACCESSORS
+inline
+CollectorRepository::MetricCollectors *
+CollectorRepository::findMetricCollectors(const MetricId& metricId) const
+{
+    MetricCollectors *result = 0;
+    d_collectorIndex.getValue(&result, metricId.description());
+    return result;
+}
+
 // MANIPULATORS
 void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
                                           const Category            *category)
@@ -463,9 +660,7 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
-            records->push_back(record);
+            (*metricIt)->collectAndReset(records);
         }
     }
 }
@@ -487,27 +682,23 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
-            records->push_back(record);
+            (*metricIt)->collect(records);
         }
     }
 }
 
 Collector *CollectorRepository::getDefaultCollector(const MetricId& metricId)
 {
-    // First, obtain a read-lock, and test if the 'MetricCollectors' object
-    // for 'metricId' already exists.
-    {
-        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
-        Collectors::iterator it = d_collectors.find(metricId);
-        if (it != d_collectors.end()) {
-            return it->second->collectors().defaultCollector();       // RETURN
-        }
+    // First, test (without locking 'd_rwMutex') if the 'MetricCollectors'
+    // object for 'metricId' already exists.
+
+    MetricCollectors *metricCollectors = findMetricCollectors(metricId);
+    if (metricCollectors) {
+        return metricCollectors->collectors().defaultCollector();     // RETURN
     }
 
     // Use 'getMetricCollectors' to create the metrics collectors object (if
-    // one has not been created since the read-lock was released).
+    // one has not been created since it was searched for).
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
     return getMetricCollectors(metricId).collectors().defaultCollector();
 }
@@ -515,22 +706,69 @@ Collector *CollectorRepository::getDefaultCollector(const MetricId& metricId)
 IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                       const MetricId& metricId)
 {
-    // First, obtain a read-lock, and test if the 'MetricCollectors' object
-    // for 'metricId' already exists.
-    {
-        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
-        Collectors::iterator it = d_collectors.find(metricId);
-        if (it != d_collectors.end()) {
-            return it->second->intCollectors().defaultCollector();    // RETURN
-        }
+    // First, test (without locking 'd_rwMutex') if the 'MetricCollectors'
+    // object for 'metricId' already exists.
+
+    MetricCollectors *metricCollectors = findMetricCollectors(metricId);
+    if (metricCollectors) {
+        return metricCollectors->intCollectors().defaultCollector();  // RETURN
     }
 
     // Use 'getMetricCollectors' to create the metrics collectors object (if
-    // one has not been created since the read-lock was released).
+    // one has not been created since it was searched for).
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+ShardedCollector *CollectorRepository::getDefaultShardedCollector(
+                                                      const MetricId& metricId)
+{
+    // First, test (without locking 'd_rwMutex') if the sharded collector for
+    // 'metricId' already exists.
+
+    MetricCollectors *metricCollectors = findMetricCollectors(metricId);
+    if (metricCollectors && metricCollectors->shardedCollector()) {
+        return metricCollectors->shardedCollector();                  // RETURN
+    }
+
+    // Create the metrics collectors object and its sharded collector (if they
+    // have not been created since they were searched for).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createShardedCollector();
+}
+
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    // First, test (without locking 'd_rwMutex') if the histogram collector
+    // for 'metricId' already exists.
+
+    MetricCollectors *metricCollectors = findMetricCollectors(metricId);
+    if (metricCollectors && metricCollectors->histogramCollector()) {
+        return metricCollectors->histogramCollector();                // RETURN
+    }
+
+    // Register the metrics under which the percentiles are published before
+    // obtaining the write-lock, since the registry is separately locked.
+    BSLS_ASSERT(metricId.isValid());
+
+    bsl::vector<MetricId> percentileIds(d_allocator_p);
+    percentileIds.reserve(k_NUM_PERCENTILES);
+    bsl::string name(d_allocator_p);
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        name  = metricId.metricName();
+        name += k_PERCENTILES[i].d_suffix;
+        percentileIds.push_back(d_registry_p->getId(metricId.categoryName(),
+                                                    name.c_str()));
+    }
+
+    // Create the metrics collectors object and its histogram collector (if
+    // they have not been created since they were searched for).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createHistogramCollector(
+                                                                percentileIds);
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
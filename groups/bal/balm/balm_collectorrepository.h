@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_shardedcollector,
+//           balm_histogramcollector, balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -34,10 +35,31 @@ BSLS_IDENT("$Id: $")
 // can safely collect values from multiple threads, however, the collector does
 // use a mutex: Applications anticipating high contention for that lock can use
 // 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
+// thereby reduce contention, or use 'getDefaultShardedCollector' to obtain a
+// lock-free 'balm::ShardedCollector' (see 'balm_shardedcollector') whose
+// per-thread shards are merged only when the repository is collected.  Values
+// recorded through any of the collectors for a metric are combined into a
+// single record for that metric.  Finally, the 'collectAndReset' operation
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+///Histogram Collectors and Percentiles
+///------------------------------------
+// The 'getDefaultHistogramCollector' operation returns a lock-free
+// 'balm::HistogramCollector' (see 'balm_histogramcollector') for the supplied
+// metric, which records the distribution of the metric's values.  The count,
+// total, minimum, and maximum of a histogram collector are combined with the
+// record for its metric like those of any other collector.  In addition, when
+// the repository is collected, four records are appended for each metric
+// having a histogram collector, holding the 50th, 90th, 99th, and 99.9th
+// percentiles of the histogram.  These records are identified by metrics,
+// registered when the histogram collector is created, whose names are the
+// metric's name suffixed with '.p50', '.p90', '.p99', and '.p999'.  Each
+// percentile record has a count of 1, and a total, minimum, and maximum equal
+// to the percentile value (or the default values, if no values were recorded
+// in the histogram), so that publishers report percentiles as they report any
+// other metric.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -49,6 +71,16 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+// The collectors for each metric are indexed in a
+// 'bdlcc::StripedUnorderedMap', so that the 'getDefault*Collector' methods
+// return an existing collector while holding only the (reader) lock of one
+// stripe of that index.  The repository-wide lock is acquired (for writing)
+// only to create the collectors for a metric, and (for reading) to collect
+// values or to retrieve added collectors.  Together with the concurrent
+// lookup provided by 'balm::MetricRegistry', this allows threads using the
+// '*_DYNAMIC_*' macros of 'balm_metrics' with many distinct metric names to
+// proceed without serializing on a single lock.
+//
 ///Usage
 ///-----
 // The following example illustrates creating a 'balm::CollectorRepository',
@@ -109,13 +141,17 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 #include <balm_metricregistry.h>
+#include <balm_shardedcollector.h>
 
 #include <bslmt_rwmutex.h>
 
+#include <bdlcc_stripedunorderedmap.h>
+
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 
@@ -137,11 +173,12 @@ class CollectorRepository_MetricCollectors;  // defined in implementation
 
 class CollectorRepository {
     // This class defines a fully thread-safe repository mechanism for
-    // 'Collector' and 'IntegerCollector' objects.  Collectors are identified
-    // in the repository by a 'MetricId' object and also grouped together
-    // according to the category of the metric.  This repository supports
-    // operations to create, find, and collect metric records from the
-    // collectors in the repository.
+    // 'Collector', 'IntegerCollector', 'ShardedCollector', and
+    // 'HistogramCollector' objects.
+    // Collectors are identified in the repository by a 'MetricId' object and
+    // also grouped together according to the category of the metric.  This
+    // repository supports operations to create, find, and collect metric
+    // records from the collectors in the repository.
 
     // PRIVATE TYPES
     typedef CollectorRepository_MetricCollectors     MetricCollectors;
@@ -164,10 +201,24 @@ class CollectorRepository {
         // that each 'MetricCollectors' instance contains all the collectors
         // for a single metric.
 
+    typedef bdlcc::StripedUnorderedMap<const MetricDescription *,
+                                       MetricCollectors *>  CollectorIndex;
+        // 'CollectorIndex' is an alias for a map from the description of a
+        // metric to the collectors for that metric, that can be searched
+        // without acquiring 'd_rwMutex'.
+
+    enum {
+        k_INDEX_NUM_BUCKETS = 256,  // initial buckets of 'd_collectorIndex'
+        k_INDEX_NUM_STRIPES = 32    // stripes of 'd_collectorIndex'
+    };
+
     // DATA
     MetricRegistry         *d_registry_p;  // registry of ids (held, not owned)
     Collectors              d_collectors;  // collectors (owned)
     CategorizedCollectors   d_categories;  // map of category => collectors
+    CollectorIndex          d_collectorIndex;
+                                           // concurrent index of
+                                           // 'd_collectors'
     mutable bslmt::RWMutex  d_rwMutex;     // data lock
     bslma::Allocator       *d_allocator_p; // allocator (held, not owned)
 
@@ -182,9 +233,16 @@ class CollectorRepository {
         // specified 'metricId'.  If a collection of collectors for the
         // 'metricId' does not already exist, create one and add it to the map
         // of 'Collectors' ('d_collectors') and also the map of
-        // 'CategorizedCollectors' ('d_categories').  The behavior is undefined
-        // unless the calling thread has a *write* *lock* to 'd_rwMutex' and
-        // 'metricId' is valid.
+        // 'CategorizedCollectors' ('d_categories').  In either case, ensure
+        // the collectors are in 'd_collectorIndex'.  The behavior is
+        // undefined unless the calling thread has a *write* *lock* to
+        // 'd_rwMutex' and 'metricId' is valid.
+
+    // PRIVATE ACCESSORS
+    MetricCollectors *findMetricCollectors(const MetricId& metricId) const;
+        // Return the address of the modifiable collectors associated with the
+        // specified 'metricId', or 0 if they are not in 'd_collectorIndex'.
+        // Note that this method does not lock 'd_rwMutex'.
 
   public:
     // PUBLIC TRAITS
@@ -261,6 +319,54 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    ShardedCollector *getDefaultShardedCollector(const char *category,
+                                                 const char *metricName);
+        // Return the address of the modifiable default sharded collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a default sharded collector for the identified
+        // metric does not already exist in the repository, create one, add it
+        // to the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultShardedCollector(registry().getId(category, metricName))
+        //..
+
+    ShardedCollector *getDefaultShardedCollector(const MetricId& metricId);
+        // Return the address of the modifiable default sharded collector
+        // identified by the specified 'metricId'.  If a default sharded
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.  Note that the values recorded by the sharded collector
+        // are combined with those of the other collectors for 'metricId' when
+        // the repository is collected.
+
+    HistogramCollector *getDefaultHistogramCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a default histogram collector for the identified
+        // metric does not already exist in the repository, create one, add it
+        // to the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified 'metricId'.  If a default histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, register the
+        // metrics under which its percentiles are published (see {Histogram
+        // Collectors and Percentiles}), and return its address.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -339,6 +445,7 @@ CollectorRepository::CollectorRepository(MetricRegistry   *registry,
 : d_registry_p(registry)
 , d_collectors(basicAllocator)
 , d_categories(basicAllocator)
+, d_collectorIndex(k_INDEX_NUM_BUCKETS, k_INDEX_NUM_STRIPES, basicAllocator)
 , d_rwMutex()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -366,6 +473,24 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+ShardedCollector *CollectorRepository::getDefaultShardedCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultShardedCollector(d_registry_p->getId(category,
+                                                          metricName));
+}
+
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -16,6 +16,7 @@
 
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
 
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -61,6 +62,10 @@ using bsl::flush;
 // [ 3] getDefaultCollector(const MetricId&);
 // [ 6] getDefaultIntegerCollector(const StringRef&, const StringRef&);
 // [ 3] IntegerCollector *getDefaultIntegerCollector(const MetricId&);
+// [10] getDefaultShardedCollector(const char *, const char *);
+// [10] ShardedCollector *getDefaultShardedCollector(const MetricId&);
+// [11] getDefaultHistogramCollector(const char *, const char *);
+// [11] HistogramCollector *getDefaultHistogramCollector(const MetricId&);
 // [ 5] addCollector(const StringRef&, const StringRef&);
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
@@ -75,6 +80,8 @@ using bsl::flush;
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
 // [ 9] USAGE EXAMPLE
+// [10] SHARDED COLLECTORS
+// [11] HISTOGRAM COLLECTORS
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -351,6 +358,53 @@ void ThreadTester::runTest()
     d_pool.drain();
 }
 
+struct DefaultCollectors {
+    // This 'struct' holds the addresses of the default collectors of a
+    // metric.
+
+    Col                      *d_collector_p;
+    ICol                     *d_integerCollector_p;
+    balm::ShardedCollector   *d_shardedCollector_p;
+    balm::HistogramCollector *d_histogramCollector_p;
+};
+
+void getDefaultCollectors(bsl::vector<DefaultCollectors> *result,
+                          Obj                            *repository,
+                          bslmt::Barrier                 *barrier,
+                          int                             threadIndex,
+                          const bsl::vector<Id>          *ids)
+    // Wait on the specified 'barrier', then load into the specified 'result'
+    // the default collectors obtained from the specified 'repository' for
+    // each of the specified 'ids', and record the value 1 in each of them.
+    // The ids are processed in an order starting at the specified
+    // 'threadIndex', so that threads concurrently create the collectors of
+    // both the same and different metrics.
+{
+    const int numIds = static_cast<int>(ids->size());
+    result->resize(numIds);
+
+    barrier->wait();
+
+    for (int j = 0; j < numIds; ++j) {
+        const int          k  = (j + threadIndex) % numIds;
+        const Id&          id = (*ids)[k];
+        DefaultCollectors& collectors = (*result)[k];
+
+        collectors.d_collector_p = repository->getDefaultCollector(id);
+        collectors.d_integerCollector_p =
+                                   repository->getDefaultIntegerCollector(id);
+        collectors.d_shardedCollector_p =
+                                   repository->getDefaultShardedCollector(id);
+        collectors.d_histogramCollector_p =
+                                 repository->getDefaultHistogramCollector(id);
+
+        collectors.d_collector_p->update(1.0);
+        collectors.d_integerCollector_p->update(1);
+        collectors.d_shardedCollector_p->update(1.0);
+        collectors.d_histogramCollector_p->update(1.0);
+    }
+}
+
 template <class T>
 bool vectorEquals(const bsl::vector<T *>&                 lhs,
                   const bsl::vector<bsl::shared_ptr<T> >& rhs)
@@ -399,6 +453,218 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //:  1 'getDefaultHistogramCollector' returns the same collector for
+        //:    the same metric, and distinct collectors for distinct metrics.
+        //:
+        //:  2 Creating a histogram collector registers the '.p50', '.p90',
+        //:    '.p99', and '.p999' metrics in the metric's category.
+        //:
+        //:  3 The aggregate of a histogram collector is combined with those
+        //:    of the other collectors for the metric, and a record is
+        //:    appended for each percentile.
+        //:
+        //:  4 'collectAndReset' resets the histogram, after which the
+        //:    percentile records have default values.
+        //:
+        //:  5 The histogram collector obtains memory from the repository's
+        //:    allocator.
+        //
+        // Plan:
+        //:  1 Obtain histogram collectors for two metrics and compare the
+        //:    returned addresses.  (C-1)
+        //:
+        //:  2 Verify the percentile metrics are registered.  (C-2)
+        //:
+        //:  3 Record 100 values, 1 through 100, in a histogram, and verify
+        //:    the records returned by 'collect' and 'collectAndReset'.  Then
+        //:    collect again and verify the default values.  (C-3..4)
+        //:
+        //:  4 Verify the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Histogram Collectors"
+                          << "\n============================" << endl;
+
+        Registry reg(Z);
+        Obj      mX(&reg, Z);
+
+        const Id A_A = reg.getId("A", "A");
+        const Id A_B = reg.getId("A", "B");
+
+        ASSERT(0 == reg.findId("A", "A.p99").isValid());
+
+        balm::HistogramCollector *hAA = mX.getDefaultHistogramCollector(A_A);
+        balm::HistogramCollector *hAB = mX.getDefaultHistogramCollector("A",
+                                                                        "B");
+        ASSERT(0   != hAA);
+        ASSERT(0   != hAB);
+        ASSERT(hAA != hAB);
+        ASSERT(hAA == mX.getDefaultHistogramCollector("A", "A"));
+        ASSERT(hAB == mX.getDefaultHistogramCollector(A_B));
+        ASSERT(A_A == hAA->metricId());
+
+        const char *SUFFIXES[] = { ".p50", ".p90", ".p99", ".p999" };
+        const int   NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+        Id          percentileIds[NUM_SUFFIXES];
+        for (int i = 0; i < NUM_SUFFIXES; ++i) {
+            const bsl::string name = bsl::string("A") + SUFFIXES[i];
+            percentileIds[i] = reg.findId("A", name.c_str());
+            ASSERTV(name, percentileIds[i].isValid());
+        }
+
+        mX.getDefaultCollector(A_A)->update(1000.0);
+        for (int i = 1; i <= 100; ++i) {
+            hAA->update(i);
+        }
+
+        const double EXPECTED[] = { 50.0, 90.0, 99.0, 100.0 };
+
+        bsl::vector<balm::MetricRecord> records(Z);
+        for (int pass = 0; pass < 2; ++pass) {
+            records.clear();
+            if (0 == pass) {
+                mX.collect(&records, reg.getCategory("A"));
+            }
+            else {
+                mX.collectAndReset(&records, reg.getCategory("A"));
+            }
+
+            // One record each for 'A' and 'B', and 4 percentiles for each.
+
+            ASSERTV(pass, records.size(), 10 == records.size());
+
+            int numFound = 0;
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                const balm::MetricRecord& R = records[i];
+                if (A_A == R.metricId()) {
+                    ++numFound;
+                    ASSERTV(pass, R, 101    == R.count());
+                    ASSERTV(pass, R, 6050.0 == R.total());
+                    ASSERTV(pass, R, 1.0    == R.min());
+                    ASSERTV(pass, R, 1000.0 == R.max());
+                }
+                for (int j = 0; j < NUM_SUFFIXES; ++j) {
+                    if (percentileIds[j] == R.metricId()) {
+                        ++numFound;
+                        ASSERTV(pass, j, R, 1 == R.count());
+                        ASSERTV(pass, j, R, R.min() == R.max());
+                        ASSERTV(pass, j, R, R.min() == R.total());
+                        ASSERTV(pass, j, R,
+                                R.min() >= EXPECTED[j] * (1 - 1.0 / 16));
+                        ASSERTV(pass, j, R,
+                                R.min() <= EXPECTED[j] * (1 + 1.0 / 16));
+                    }
+                }
+            }
+            ASSERTV(pass, numFound, 1 + NUM_SUFFIXES == numFound);
+        }
+
+        records.clear();
+        mX.collect(&records, reg.getCategory("A"));
+        ASSERT(10 == records.size());
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(records[i], 0 == records[i].count());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED COLLECTORS
+        //
+        // Concerns:
+        //:  1 'getDefaultShardedCollector' returns the same collector for the
+        //:    same metric, and distinct collectors for distinct metrics.
+        //:
+        //:  2 Values recorded through a sharded collector are combined with
+        //:    those of the other collectors for the metric by 'collect' and
+        //:    'collectAndReset', and are reset by 'collectAndReset'.
+        //:
+        //:  3 The sharded collector obtains memory from the repository's
+        //:    allocator.
+        //
+        // Plan:
+        //:  1 Obtain sharded collectors for several metrics, and compare the
+        //:    returned addresses.  (C-1)
+        //:
+        //:  2 Update the default, integer, and sharded collectors for a
+        //:    metric, and verify the records returned by 'collect' and
+        //:    'collectAndReset'.  (C-2)
+        //:
+        //:  3 Verify the default allocator is not used.  (C-3)
+        //
+        // Testing:
+        //   getDefaultShardedCollector(const char *, const char *);
+        //   ShardedCollector *getDefaultShardedCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Sharded Collectors"
+                          << "\n==========================" << endl;
+
+        Registry reg(Z);
+        Obj      mX(&reg, Z);
+
+        const Id A_A = reg.getId("A", "A");
+        const Id A_B = reg.getId("A", "B");
+
+        balm::ShardedCollector *sAA = mX.getDefaultShardedCollector(A_A);
+        balm::ShardedCollector *sAB = mX.getDefaultShardedCollector("A", "B");
+
+        ASSERT(0   != sAA);
+        ASSERT(0   != sAB);
+        ASSERT(sAA != sAB);
+        ASSERT(sAA == mX.getDefaultShardedCollector("A", "A"));
+        ASSERT(sAB == mX.getDefaultShardedCollector(A_B));
+        ASSERT(A_A == sAA->metricId());
+        ASSERT(A_B == sAB->metricId());
+
+        mX.getDefaultCollector(A_A)->update(1.0);
+        mX.getDefaultIntegerCollector(A_A)->update(2);
+        sAA->update(10.0);
+        sAA->update(-3.0);
+        sAB->update(5.0);
+
+        bsl::vector<balm::MetricRecord> records(Z);
+        mX.collect(&records, reg.getCategory("A"));
+        ASSERT(2 == records.size());
+
+        for (int pass = 0; pass < 2; ++pass) {
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                const balm::MetricRecord& R = records[i];
+                if (A_A == R.metricId()) {
+                    ASSERTV(pass, R, 4    == R.count());
+                    ASSERTV(pass, R, 10.0 == R.total());
+                    ASSERTV(pass, R, -3.0 == R.min());
+                    ASSERTV(pass, R, 10.0 == R.max());
+                }
+                else {
+                    ASSERTV(pass, R, A_B  == R.metricId());
+                    ASSERTV(pass, R, 1    == R.count());
+                    ASSERTV(pass, R, 5.0  == R.total());
+                }
+            }
+            records.clear();
+            mX.collectAndReset(&records, reg.getCategory("A"));
+            ASSERT(2 == records.size());
+        }
+
+        records.clear();
+        mX.collect(&records, reg.getCategory("A"));
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(records[i], 0 == records[i].count());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -480,6 +746,26 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
         //
+        // Concerns:
+        //   That the manipulators and accessors are thread-safe.
+        //
+        //   That concurrent calls to the 'getDefault*Collector' methods for
+        //   the same metric, whether they find the collectors without
+        //   locking the repository or create them while holding the lock,
+        //   return the same collectors, and that those are the collectors
+        //   whose values are collected.
+        //
+        // Plan:
+        //   Invoke the manipulators and accessors concurrently from several
+        //   threads, verifying the returned values.
+        //
+        //   Then, repeatedly, have several threads simultaneously obtain the
+        //   default, integer, sharded, and histogram collectors of a set of
+        //   metrics (each thread starting at a different metric), and record
+        //   a value in each.  Verify that all threads obtained the same
+        //   collectors, that subsequent calls return them, and that
+        //   'collectAndReset' reports every recorded value.
+        //
         // Testing:
         //     Thread-safety of manipulators and accessors
         // --------------------------------------------------------------------
@@ -497,6 +783,102 @@ int main(int argc, char *argv[])
             ThreadTester tester(10, &mX, &defaultAllocator);
             tester.runTest();
         }
+
+        if (verbose) cout << "\tTesting concurrent get-or-create." << endl;
+
+        const int   NUM_THREADS    = 8;
+        const int   NUM_IDS        = 32;
+        const int   NUM_ROUNDS     = 10;
+        const char *CATEGORIES[]   = { "A", "B" };
+        const int   NUM_CATEGORIES = sizeof CATEGORIES / sizeof *CATEGORIES;
+
+        for (int round = 0; round < NUM_ROUNDS; ++round) {
+            bslma::TestAllocator ta;
+            Registry             reg(&ta);
+            Obj                  mY(&reg, &ta);
+
+            bsl::vector<Id> ids;
+            bsl::string     name;
+            for (int k = 0; k < NUM_IDS; ++k) {
+                stringId(&name, "M", k);
+                ids.push_back(reg.getId(CATEGORIES[k % NUM_CATEGORIES],
+                                        name.c_str()));
+            }
+
+            bslmt::Barrier                               barrier(NUM_THREADS);
+            bsl::vector<bsl::vector<DefaultCollectors> > results(NUM_THREADS);
+            {
+                bdlmt::FixedThreadPool pool(NUM_THREADS, NUM_THREADS);
+                pool.start();
+                for (int t = 0; t < NUM_THREADS; ++t) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&getDefaultCollectors,
+                                                         &results[t],
+                                                         &mY,
+                                                         &barrier,
+                                                         t,
+                                                         &ids));
+                }
+                pool.drain();
+            }
+
+            for (int k = 0; k < NUM_IDS; ++k) {
+                const DefaultCollectors& C = results[0][k];
+
+                ASSERTV(round, k, 0 != C.d_collector_p);
+                ASSERTV(round, k, 0 != C.d_integerCollector_p);
+                ASSERTV(round, k, 0 != C.d_shardedCollector_p);
+                ASSERTV(round, k, 0 != C.d_histogramCollector_p);
+
+                for (int t = 1; t < NUM_THREADS; ++t) {
+                    const DefaultCollectors& D = results[t][k];
+
+                    ASSERTV(round, k, t,
+                            C.d_collector_p == D.d_collector_p);
+                    ASSERTV(round, k, t,
+                            C.d_integerCollector_p == D.d_integerCollector_p);
+                    ASSERTV(round, k, t,
+                            C.d_shardedCollector_p == D.d_shardedCollector_p);
+                    ASSERTV(round, k, t,
+                            C.d_histogramCollector_p ==
+                                                   D.d_histogramCollector_p);
+                }
+
+                ASSERTV(round, k,
+                        C.d_collector_p == mY.getDefaultCollector(ids[k]));
+                ASSERTV(round, k,
+                        C.d_integerCollector_p ==
+                                       mY.getDefaultIntegerCollector(ids[k]));
+                ASSERTV(round, k,
+                        C.d_shardedCollector_p ==
+                                       mY.getDefaultShardedCollector(ids[k]));
+                ASSERTV(round, k,
+                        C.d_histogramCollector_p ==
+                                     mY.getDefaultHistogramCollector(ids[k]));
+            }
+
+            // Each thread recorded one value in each of the 4 collectors of
+            // each metric.  Note that the percentile records of the
+            // histograms are ignored.
+
+            int numFound = 0;
+            for (int c = 0; c < NUM_CATEGORIES; ++c) {
+                bsl::vector<Rec> records;
+                mY.collectAndReset(&records, reg.getCategory(CATEGORIES[c]));
+
+                for (bsl::size_t i = 0; i < records.size(); ++i) {
+                    const Rec& R = records[i];
+                    if (ids.end() == bsl::find(ids.begin(),
+                                               ids.end(),
+                                               R.metricId())) {
+                        continue;
+                    }
+                    ++numFound;
+                    ASSERTV(round, R, 4 * NUM_THREADS == R.count());
+                    ASSERTV(round, R, 4 * NUM_THREADS == R.total());
+                }
+            }
+            ASSERTV(round, numFound, NUM_IDS == numFound);
+        }
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -1064,6 +1446,10 @@ int main(int argc, char *argv[])
         //   called prior to 'addCollector' (or 'addIntegerCollector')
         //   properly creates a new collector and returns its address.
         //
+        //   That 'getDefaultCollector' is exception neutral, and that the
+        //   collector it returns after a failed attempt is the one whose
+        //   value is collected.
+        //
         // Plan:
         //
         //   Next, for a sequence of metric ids, create a new
@@ -1073,6 +1459,11 @@ int main(int argc, char *argv[])
         //   collector whereas 'getDefaultCollector' returns the original
         //   collector.
         //
+        //   Finally, use 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' to obtain the
+        //   default collector of each metric, verifying that each call
+        //   returns the same collector, then record a value in each and
+        //   verify the values reported by 'collectAndReset'.
+        //
         // Testing:
         //   getDefaultCollector(const MetricId&);
         //   IntegerCollector *getDefaultIntegerCollector(const MetricId&);
@@ -1193,6 +1584,55 @@ int main(int argc, char *argv[])
                 ASSERT(NUM_ADDITIONAL == iColV.size());
             }
         }
+        {
+            if (veryVerbose) {
+                cout << "\tTest exception safety of 'getDefaultCollector'"
+                     << endl;
+            }
+
+            // A failure to create the collectors of a metric, including a
+            // failure to add them to the lookup index, must not cause a later
+            // call to return a collector other than the one collected.
+
+            bslma::TestAllocator testAllocator;
+            Obj                  mX(&reg, &testAllocator);
+
+            bsl::map<Id, Col *> defCols(Z);
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                for (int i = 0; i < NUM_METRICS; ++i) {
+                    Id id = reg.getId(METRICS[i].d_category,
+                                      METRICS[i].d_name);
+
+                    Col *col = mX.getDefaultCollector(id);
+
+                    ASSERT(id  == col->metricId());
+                    ASSERT(col == mX.getDefaultCollector(id));
+                    ASSERT(0   == defCols[id] || col == defCols[id]);
+
+                    defCols[id] = col;
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            bsl::map<Id, Col *>::const_iterator it = defCols.begin();
+            for (; it != defCols.end(); ++it) {
+                it->second->update(1.0);
+            }
+
+            const char *CATEGORIES[]   = { "A", "B", "C" };
+            const int   NUM_CATEGORIES = sizeof CATEGORIES /
+                                                          sizeof *CATEGORIES;
+
+            bsl::size_t numRecords = 0;
+            for (int i = 0; i < NUM_CATEGORIES; ++i) {
+                bsl::vector<Rec> records(Z);
+                mX.collectAndReset(&records, reg.getCategory(CATEGORIES[i]));
+                for (bsl::size_t j = 0; j < records.size(); ++j) {
+                    ASSERTV(records[j], 1 == records[j].count());
+                }
+                numRecords += records.size();
+            }
+            ASSERTV(numRecords, defCols.size() == numRecords);
+        }
       } break;
       case 2: {
         // --------------------------------------------------------------------
@@ -0,0 +1,272 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+typedef AtomicDoubleImpUtil Util;
+
+inline
+bsls::Types::Int64 defaultMaxBits()
+    // Return the bit pattern of 'MetricRecord::k_DEFAULT_MAX'.
+{
+    return Util::toBits(MetricRecord::k_DEFAULT_MAX);
+}
+
+inline
+bsls::Types::Int64 defaultMinBits()
+    // Return the bit pattern of 'MetricRecord::k_DEFAULT_MIN'.
+{
+    return Util::toBits(MetricRecord::k_DEFAULT_MIN);
+}
+
+inline
+bsls::Types::Int64 zeroBits()
+    // Return the bit pattern of 0.0.
+{
+    return Util::toBits(0.0);
+}
+
+const int k_MANTISSA_BITS = 52;
+const int k_EXPONENT_BIAS = 1023;
+
+inline
+bsls::Types::Int64 minBits()
+    // Return the bit pattern of the least value counted in a bucket other
+    // than the underflow bucket, '2^HistogramCollector::k_MIN_EXPONENT'.
+{
+    return static_cast<bsls::Types::Int64>(
+                         k_EXPONENT_BIAS + HistogramCollector::k_MIN_EXPONENT)
+                                                           << k_MANTISSA_BITS;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CLASS METHODS
+double HistogramCollector::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (0 == index) {
+        return 0.0;                                                   // RETURN
+    }
+
+    // Bucket 'index' begins at the value whose leading bits, read as an
+    // integer, are 'index - 1' more than those of the least bucketed value.
+    // The overflow bucket begins at '2^k_MAX_EXPONENT', which is the bound
+    // that would follow the last bucketed range.
+
+    const int shift = k_MANTISSA_BITS - k_SUB_BUCKET_BITS;
+    return Util::fromBits(minBits()
+                  + (static_cast<bsls::Types::Int64>(index - 1) << shift));
+}
+
+double HistogramCollector::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (k_NUM_BUCKETS - 1 == index) {
+        return MetricRecord::k_DEFAULT_MIN;                           // RETURN
+    }
+    return bucketLowerBound(index + 1);
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_count(0)
+, d_total(Util::toBits(0.0))
+, d_min(Util::toBits(MetricRecord::k_DEFAULT_MIN))
+, d_max(Util::toBits(MetricRecord::k_DEFAULT_MAX))
+, d_buckets_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_buckets_p = static_cast<bsls::AtomicInt64 *>(
+                d_allocator_p->allocate(k_NUM_BUCKETS *
+                                        sizeof(bsls::AtomicInt64)));
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        new (d_buckets_p + i) bsls::AtomicInt64(0);
+    }
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    // 'bsls::AtomicInt64' is trivially destructible.
+
+    d_allocator_p->deallocate(d_buckets_p);
+}
+
+// MANIPULATORS
+void HistogramCollector::drain(HistogramCollector *source)
+{
+    BSLS_ASSERT(source);
+    BSLS_ASSERT(this != source);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 count = source->d_buckets_p[i].swap(0);
+        if (count) {
+            d_buckets_p[i].addRelaxed(count);
+        }
+    }
+
+    const bsls::Types::Int64 count = source->d_count.swap(0);
+    const double             total = Util::fromBits(
+                                         source->d_total.swap(zeroBits()));
+    const double             min   = Util::fromBits(
+                                         source->d_min.swap(defaultMinBits()));
+    const double             max   = Util::fromBits(
+                                         source->d_max.swap(defaultMaxBits()));
+    add(count, total, min, max);
+}
+
+void HistogramCollector::loadAndReset(MetricRecord *record)
+{
+    BSLS_ASSERT(record);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets_p[i].storeRelaxed(0);
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = static_cast<int>(d_count.swap(0));
+    record->total()    = Util::fromBits(d_total.swap(zeroBits()));
+    record->min()      = Util::fromBits(d_min.swap(defaultMinBits()));
+    record->max()      = Util::fromBits(d_max.swap(defaultMaxBits()));
+}
+
+void HistogramCollector::merge(const HistogramCollector& other)
+{
+    BSLS_ASSERT(this != &other);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 count = other.d_buckets_p[i].loadRelaxed();
+        if (count) {
+            d_buckets_p[i].addRelaxed(count);
+        }
+    }
+
+    add(other.d_count.load(),
+        Util::fromBits(other.d_total.load()),
+        Util::fromBits(other.d_min.load()),
+        Util::fromBits(other.d_max.load()));
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets_p[i].storeRelaxed(0);
+    }
+    d_count = 0;
+    d_total = Util::toBits(0.0);
+    d_min   = Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    d_max   = Util::toBits(MetricRecord::k_DEFAULT_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    record->metricId() = d_metricId;
+    record->count()    = static_cast<int>(d_count.load());
+    record->total()    = Util::fromBits(d_total.load());
+    record->min()      = Util::fromBits(d_min.load());
+    record->max()      = Util::fromBits(d_max.load());
+}
+
+double HistogramCollector::percentile(double fraction) const
+{
+    BSLS_ASSERT(0.0 <= fraction);
+    BSLS_ASSERT(fraction <= 1.0);
+
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        total += d_buckets_p[i].loadRelaxed();
+    }
+    if (0 == total) {
+        return 0.0;                                                   // RETURN
+    }
+
+    // Round the rank to the nearest integer, so that, e.g., the 99th
+    // percentile of 1000 values is the 990th value even though '0.99 * 1000'
+    // is not exactly 990.
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+                                     fraction * static_cast<double>(total)
+                                                                      + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    // Buckets may be updated concurrently with this scan; if the rank is not
+    // reached, report the last bucket.
+
+    int                index      = k_NUM_BUCKETS - 1;
+    bsls::Types::Int64 cumulative = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        cumulative += d_buckets_p[i].loadRelaxed();
+        if (cumulative >= rank) {
+            index = i;
+            break;
+        }
+    }
+
+    double estimate;
+    if (0 == index) {
+        estimate = 0.0;
+    }
+    else if (k_NUM_BUCKETS - 1 == index) {
+        estimate = bucketLowerBound(index);
+    }
+    else {
+        estimate = (bucketLowerBound(index) + bucketUpperBound(index)) / 2;
+    }
+
+    const double min = Util::fromBits(d_min.load());
+    const double max = Util::fromBits(d_max.load());
+    if (min <= max) {
+        if (estimate < min) {
+            estimate = min;
+        }
+        else if (estimate > max) {
+            estimate = max;
+        }
+    }
+    return estimate;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
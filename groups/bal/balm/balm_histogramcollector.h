@@ -0,0 +1,360 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free, log-bucketed histogram of metric values.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free histogram of a metric's values
+//
+//@SEE_ALSO: balm_collector, balm_collectorrepository, balm_metrics,
+//           balm_stopwatchscopedguard
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that records the *distribution* of the values of a metric, so that
+// percentiles (e.g., the median, or the 99th percentile of a latency) can be
+// reported in addition to the count, total, minimum, and maximum recorded by
+// a 'balm::Collector'.
+//
+// Values are counted in logarithmically spaced buckets, in the manner of an
+// HDR histogram: each power-of-two interval '[2^e, 2^(e+1))', for
+// 'k_MIN_EXPONENT <= e < k_MAX_EXPONENT', is divided into
+// '2^k_SUB_BUCKET_BITS' buckets of equal width.  A percentile is reported as
+// the midpoint of the bucket containing it (clamped to the recorded minimum
+// and maximum), which is within 1/32 (about 3%) of the true value for any
+// value in the bucketed range.  Values less than '2^k_MIN_EXPONENT' (including
+// zero and negative values) are counted in a single underflow bucket, and
+// values not less than '2^k_MAX_EXPONENT' in a single overflow bucket.  The
+// bucketed range spans '[2.3e-10, 1.1e12)', which covers latencies from
+// fractions of a nanosecond measured in seconds to 18 minutes measured in
+// nanoseconds.
+//
+// Each bucket is an atomic counter, so 'update' is lock-free (and wait-free
+// apart from maintaining the total, minimum, and maximum).  Histograms for the
+// same metric are *mergeable*: 'merge' adds the counts of another histogram,
+// and 'drain' moves the counts of another histogram into this one, resetting
+// each of the source's counters in a single atomic operation so that no value
+// concurrently recorded to the source is lost.
+//
+///Publication of Percentiles
+///- - - - - - - - - - - - - -
+// 'balm::CollectorRepository' maintains a default histogram collector per
+// metric (see 'getDefaultHistogramCollector').  When the repository is
+// collected, the count, total, minimum, and maximum of that histogram are
+// combined with the record for the metric, and one additional
+// 'balm::MetricRecord' is reported for each of the 50th, 90th, 99th, and
+// 99.9th percentiles, having the metric name suffixed with '.p50', '.p90',
+// '.p99', and '.p999' respectively.  A percentile record has a count of 1, and
+// a total, minimum, and maximum equal to the percentile value, so that every
+// 'balm::Publisher' formats and emits percentiles without modification.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  'update' is lock-free.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example records a set of request latencies in a
+// 'balm::HistogramCollector' and reports their percentiles.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' and record 1000 latencies, 990
+// of which take 1 millisecond and 10 of which take 250 milliseconds:
+//..
+//  balm::HistogramCollector histogram(myMetric);
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      histogram.update(i % 100 ? 1.0 : 250.0);
+//  }
+//..
+// The average latency (3.49 milliseconds) hides the slow requests, but the
+// percentiles expose them:
+//..
+//  balm::MetricRecord record;
+//  histogram.load(&record);
+//
+//  assert(1000   == record.count());
+//  assert(3490.0 == record.total());
+//
+//  assert(1.0    <= histogram.percentile(0.50));
+//  assert(1.07   >  histogram.percentile(0.50));
+//  assert(1.07   >  histogram.percentile(0.99));
+//  assert(250.0  == histogram.percentile(0.999));
+//..
+// Note that the 99.9th percentile is exactly 250.0 because the midpoint of its
+// bucket, '[248, 256)', is clamped to the recorded maximum.
+
+#include <balscm_version.h>
+
+#include <balm_atomicdoubleimputil.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the distribution of the
+    // values of a metric over a period of time.  In addition to a count of
+    // values in each of 'k_NUM_BUCKETS' logarithmically spaced buckets, a
+    // histogram collector maintains the values of a 'Collector' (see
+    // 'balm_collector'): the number of values recorded, and their total,
+    // minimum, and maximum.  The default value for the count is 0, the default
+    // value for the total is 0.0, the default minimum value is
+    // 'MetricRecord::k_DEFAULT_MIN', and the default maximum value is
+    // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // DATA
+    MetricId           d_metricId;     // identifies collected metric
+    bsls::AtomicInt64  d_count;        // number of values
+    bsls::AtomicInt64  d_total;        // bits of 'double' total
+    bsls::AtomicInt64  d_min;          // bits of 'double' minimum
+    bsls::AtomicInt64  d_max;          // bits of 'double' maximum
+    bsls::AtomicInt64 *d_buckets_p;    // 'k_NUM_BUCKETS' counters (owned)
+    bslma::Allocator  *d_allocator_p;  // allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE MANIPULATORS
+    void add(bsls::Types::Int64 count, double total, double min, double max);
+        // Atomically add the specified 'count' and 'total' to the aggregate
+        // values of this histogram, and lower its minimum to 'min' and raise
+        // its maximum to 'max' where they improve on the current values.
+        // Note that the bucket counts are not modified.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 4,    // log2 of the buckets per power of two
+        k_MIN_EXPONENT    = -32,  // log2 of the least bucketed value
+        k_MAX_EXPONENT    = 40,   // log2 of the least overflowing value
+
+        k_NUM_BUCKETS     = ((k_MAX_EXPONENT - k_MIN_EXPONENT)
+                                                        << k_SUB_BUCKET_BITS)
+                          + 2     // bucketed range plus underflow and
+                                  // overflow buckets
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramCollector,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int bucketIndex(double value);
+        // Return the index of the bucket in which the specified 'value' is
+        // counted: 0 if 'value' is less than '2^k_MIN_EXPONENT' (or is NaN),
+        // 'k_NUM_BUCKETS - 1' if 'value' is not less than '2^k_MAX_EXPONENT',
+        // and otherwise the index of the bucket whose range contains 'value'.
+
+    static double bucketLowerBound(int index);
+        // Return the least value counted in the bucket having the specified
+        // 'index', where the least value of the underflow bucket is reported
+        // as 0.0.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static double bucketUpperBound(int index);
+        // Return the least value greater than the values counted in the
+        // bucket having the specified 'index', where the upper bound of the
+        // overflow bucket is reported as 'MetricRecord::k_DEFAULT_MIN'
+        // (positive infinity).  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', having no recorded values, a total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void drain(HistogramCollector *source);
+        // Add to this histogram the values recorded by the specified
+        // 'source' histogram, and reset 'source' to its default state.  Each
+        // counter of 'source' is read and reset in a single atomic operation,
+        // so a value concurrently recorded to 'source' is either moved to
+        // this histogram or remains in 'source'.  The behavior is undefined
+        // if 'source' is this object.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric; then reset this histogram to its
+        // default state.
+
+    void merge(const HistogramCollector& other);
+        // Add to this histogram the values recorded by the specified 'other'
+        // histogram.  The behavior is undefined if 'other' is this object.
+
+    void reset();
+        // Reset this histogram to its default state, having no recorded
+        // values.
+
+    void update(double value);
+        // Record the specified 'value': increment the count of the bucket
+        // containing 'value' and the event count by 1, add 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.  This operation is
+        // lock-free.
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of recorded values counted in the bucket having
+        // the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    double percentile(double fraction) const;
+        // Return an estimate of the value below which the specified
+        // 'fraction' of the recorded values fall (e.g., the 99th percentile
+        // for a 'fraction' of 0.99), or 0.0 if no values have been recorded.
+        // The estimate is the midpoint of the bucket containing the value of
+        // that rank, clamped to the recorded minimum and maximum.  The
+        // behavior is undefined unless '0.0 <= fraction <= 1.0'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+inline
+void HistogramCollector::add(bsls::Types::Int64 count,
+                             double             total,
+                             double             min,
+                             double             max)
+{
+    d_count.addRelaxed(count);
+
+    AtomicDoubleImpUtil::add(&d_total, total);
+    AtomicDoubleImpUtil::updateMin(&d_min, min);
+    AtomicDoubleImpUtil::updateMax(&d_max, max);
+}
+
+// CLASS METHODS
+inline
+int HistogramCollector::bucketIndex(double value)
+{
+    // For a positive normal 'double', the biased exponent followed by the
+    // leading bits of the mantissa form a monotonically increasing integer,
+    // whose low 'k_SUB_BUCKET_BITS' bits select the sub-bucket within the
+    // power of two.
+
+    enum {
+        k_MANTISSA_BITS = 52,
+        k_EXPONENT_BIAS = 1023
+    };
+
+    const bsls::Types::Int64 k_MIN_BITS =
+          static_cast<bsls::Types::Int64>(k_EXPONENT_BIAS + k_MIN_EXPONENT)
+                                                          << k_MANTISSA_BITS;
+    const bsls::Types::Int64 k_MAX_BITS =
+          static_cast<bsls::Types::Int64>(k_EXPONENT_BIAS + k_MAX_EXPONENT)
+                                                          << k_MANTISSA_BITS;
+
+    if (!(value >= AtomicDoubleImpUtil::fromBits(k_MIN_BITS))) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 bits = AtomicDoubleImpUtil::toBits(value);
+    if (bits >= k_MAX_BITS) {
+        return k_NUM_BUCKETS - 1;                                     // RETURN
+    }
+
+    const int shift = k_MANTISSA_BITS - k_SUB_BUCKET_BITS;
+    return 1 + static_cast<int>((bits - k_MIN_BITS) >> shift);
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(double value)
+{
+    d_buckets_p[bucketIndex(value)].addRelaxed(1);
+    add(1, value, value, value);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HistogramCollector::bucketCount(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    return d_buckets_p[index].loadRelaxed();
+}
+
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,742 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism for collecting the distribution of
+// a metric's values.  Ensure that each value is counted in the bucket whose
+// bounds contain it, that the aggregate values match those of a
+// 'balm::Collector', that percentiles are estimated within the documented
+// relative error, and that no update is lost when updates and collection run
+// concurrently.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int bucketIndex(double value);
+// [ 2] static double bucketLowerBound(int index);
+// [ 2] static double bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] HistogramCollector(const MetricId&, bslma::Allocator *);
+// [ 3] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 5] void drain(HistogramCollector *source);
+// [ 6] void loadAndReset(MetricRecord *record);
+// [ 5] void merge(const HistogramCollector& other);
+// [ 6] void reset();
+// [ 4] void update(double value);
+//
+// ACCESSORS
+// [ 4] bsls::Types::Int64 bucketCount(int index) const;
+// [ 4] void load(MetricRecord *record) const;
+// [ 3] const MetricId& metricId() const;
+// [ 4] double percentile(double fraction) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::MetricRecord       Rec;
+typedef balm::MetricId           Id;
+typedef balm::MetricDescription  Desc;
+
+// ============================================================================
+//                      GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct UpdateThread {
+    // Update a histogram 'k_NUM_UPDATES' times with the value 1, then with
+    // the value 1000.
+
+    enum { k_NUM_UPDATES = 100000 };
+
+    Obj            *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < k_NUM_UPDATES; ++i) {
+            d_obj_p->update(1.0);
+            d_obj_p->update(1000.0);
+        }
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default");
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test");
+
+    balm::Category myCategory("MyCategory");
+    Desc           descA(&myCategory, "A");
+    const Id       METRIC_A(&descA);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //:  1 The usage example provided in the component header file
+        //:    compiles, links, and runs as shown.
+        //
+        // Plan:
+        //:  1 Incorporate usage example from header into test driver, remove
+        //:    leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING USAGE EXAMPLE"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example records a set of request latencies in a
+// 'balm::HistogramCollector' and reports their percentiles.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' and record 1000 latencies, 990
+// of which take 1 millisecond and 10 of which take 250 milliseconds:
+//..
+    balm::HistogramCollector histogram(myMetric);
+
+    for (int i = 0; i < 1000; ++i) {
+        histogram.update(i % 100 ? 1.0 : 250.0);
+    }
+//..
+// The average latency (3.49 milliseconds) hides the slow requests, but the
+// percentiles expose them:
+//..
+    balm::MetricRecord record;
+    histogram.load(&record);
+
+    ASSERT(1000   == record.count());
+    ASSERT(3490.0 == record.total());
+
+    ASSERT(1.0    <= histogram.percentile(0.50));
+    ASSERT(1.07   >  histogram.percentile(0.50));
+    ASSERT(1.07   >  histogram.percentile(0.99));
+    ASSERT(250.0  == histogram.percentile(0.999));
+//..
+// Note that the 99.9th percentile is exactly 250.0 because the midpoint of its
+// bucket, '[248, 256)', is clamped to the recorded maximum.
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //:  1 Updates from several threads are all recorded.
+        //:
+        //:  2 'drain' running concurrently with updates loses no value.
+        //
+        // Plan:
+        //:  1 Start several threads that update a histogram while the main
+        //:    thread repeatedly drains it into a second histogram.  Verify the
+        //:    aggregate values and bucket counts of the second histogram.
+        //:    (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        Obj            mX(METRIC_A, &ta);
+        Obj            mY(METRIC_A, &ta); const Obj& Y = mY;
+        bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_THREADS);
+        UpdateThread functor = { &mX, &barrier };
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+        }
+
+        barrier.wait();
+
+        for (int i = 0; i < 100; ++i) {
+            mY.drain(&mX);
+            bslmt::ThreadUtil::yield();
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        mY.drain(&mX);
+
+        const bsls::Types::Int64 EXP_EACH = k_NUM_THREADS *
+                                                   UpdateThread::k_NUM_UPDATES;
+
+        Rec r;
+        Y.load(&r);
+        ASSERTV(r, 2 * EXP_EACH == r.count());
+        ASSERTV(r, 1001.0 * EXP_EACH == r.total());
+        ASSERTV(r, 1.0    == r.min());
+        ASSERTV(r, 1000.0 == r.max());
+
+        ASSERT(EXP_EACH == Y.bucketCount(Obj::bucketIndex(1.0)));
+        ASSERT(EXP_EACH == Y.bucketCount(Obj::bucketIndex(1000.0)));
+
+        mX.load(&r);
+        ASSERT(Rec(METRIC_A) == r);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset' AND 'loadAndReset'
+        //
+        // Concerns:
+        //:  1 'loadAndReset' loads the aggregate values before resetting them.
+        //:
+        //:  2 'reset' and 'loadAndReset' restore the default values and clear
+        //:    every bucket.
+        //
+        // Plan:
+        //:  1 Update a histogram, call 'loadAndReset', and verify the loaded
+        //:    record, the values of the histogram, and its bucket counts.
+        //:    (C-1..2)
+        //:
+        //:  2 Repeat with 'reset'.  (C-2)
+        //
+        // Testing:
+        //   void loadAndReset(MetricRecord *record);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'reset' AND 'loadAndReset'"
+                          << "\n==================================" << endl;
+
+        Obj mX(METRIC_A, &ta); const Obj& X = mX;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            mX.update(2.0);
+            mX.update(-3.0);
+            mX.update(1.0e20);
+
+            Rec r;
+            if (0 == ti) {
+                mX.loadAndReset(&r);
+                ASSERT(Rec(METRIC_A, 3, 1.0e20 - 1.0, -3.0, 1.0e20) == r);
+            }
+            else {
+                mX.reset();
+            }
+
+            X.load(&r);
+            ASSERTV(ti, r, Rec(METRIC_A) == r);
+            ASSERTV(ti, 0.0 == X.percentile(0.5));
+
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(ti, i, 0 == X.bucketCount(i));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'merge' AND 'drain'
+        //
+        // Concerns:
+        //:  1 'merge' adds the bucket counts and aggregate values of the
+        //:    specified histogram, which is unchanged.
+        //:
+        //:  2 'drain' adds the bucket counts and aggregate values of the
+        //:    specified histogram, which is reset.
+        //:
+        //:  3 Merging or draining an empty histogram has no effect.
+        //
+        // Plan:
+        //:  1 Create two histograms from disjoint sets of values, and verify
+        //:    the result of merging and draining one into the other against a
+        //:    histogram updated with both sets.  (C-1..3)
+        //
+        // Testing:
+        //   void drain(HistogramCollector *source);
+        //   void merge(const HistogramCollector& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'merge' AND 'drain'"
+                          << "\n===========================" << endl;
+
+        Obj mA(METRIC_A, &ta); const Obj& A = mA;
+        Obj mB(METRIC_A, &ta); const Obj& B = mB;
+        Obj mE(METRIC_A, &ta); const Obj& E = mE;
+
+        for (int i = 1; i <= 10; ++i) {
+            mA.update(i);
+            mB.update(i * 100.0);
+            mE.update(i);
+            mE.update(i * 100.0);
+        }
+
+        Rec expected;
+        E.load(&expected);
+
+        for (int ti = 0; ti < 2; ++ti) {
+            Obj mX(METRIC_A, &ta); const Obj& X = mX;
+            Obj mEmpty(METRIC_A, &ta);
+
+            mX.merge(A);
+            if (0 == ti) {
+                mX.merge(B);
+                mX.merge(mEmpty);
+            }
+            else {
+                mX.drain(&mB);
+                mX.drain(&mEmpty);
+            }
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(ti, r, expected == r);
+
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(ti, i, E.bucketCount(i) == X.bucketCount(i));
+            }
+            ASSERTV(ti, E.percentile(0.5) == X.percentile(0.5));
+
+            A.load(&r);
+            ASSERTV(ti, r, 10 == r.count());
+
+            B.load(&r);
+            if (0 == ti) {
+                ASSERTV(ti, r, 10 == r.count());
+            }
+            else {
+                ASSERTV(ti, r, Rec(METRIC_A) == r);
+                for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                    ASSERTV(i, 0 == B.bucketCount(i));
+                }
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'update', 'load', AND 'percentile'
+        //
+        // Concerns:
+        //:  1 'update' aggregates values as 'balm::Collector' does, and
+        //:    counts each value in the bucket given by 'bucketIndex'.
+        //:
+        //:  2 'load' does not reset the histogram.
+        //:
+        //:  3 'percentile' returns 0.0 for an empty histogram.
+        //:
+        //:  4 'percentile' is within the documented relative error of the
+        //:    exact percentile, and within the range of recorded values.
+        //
+        // Plan:
+        //:  1 Using a table of values, update a histogram and verify the
+        //:    result of 'load' and 'bucketCount' against expected values.
+        //:    (C-1..2)
+        //:
+        //:  2 Verify 'percentile' of an empty histogram.  (C-3)
+        //:
+        //:  3 For several ranges of uniformly and geometrically spaced
+        //:    values, verify a set of percentiles against the exact value.
+        //:    (C-4)
+        //
+        // Testing:
+        //   void update(double value);
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   void load(MetricRecord *record) const;
+        //   double percentile(double fraction) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'update', 'load', AND 'percentile'"
+                          << "\n=========================================="
+                          << endl;
+
+        {
+            const double VALUES[]   = { 0.0, 3.5, -2.0, 10.0, 1.0, 3.55 };
+            const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            Obj mX(METRIC_A, &ta); const Obj& X = mX;
+
+            ASSERT(0.0 == X.percentile(0.0));
+            ASSERT(0.0 == X.percentile(0.5));
+            ASSERT(0.0 == X.percentile(1.0));
+
+            bsl::vector<bsls::Types::Int64> counts(Obj::k_NUM_BUCKETS, 0);
+
+            Rec expected(METRIC_A);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.update(VALUES[i]);
+                ++counts[Obj::bucketIndex(VALUES[i])];
+                ++expected.count();
+                expected.total() += VALUES[i];
+                expected.min()    = bsl::min(expected.min(), VALUES[i]);
+                expected.max()    = bsl::max(expected.max(), VALUES[i]);
+
+                Rec r;
+                X.load(&r);
+                ASSERTV(i, r, expected == r);
+                X.load(&r);
+                ASSERTV(i, r, expected == r);
+
+                for (int j = 0; j < Obj::k_NUM_BUCKETS; ++j) {
+                    ASSERTV(i, j, counts[j] == X.bucketCount(j));
+                }
+            }
+
+            // '3.5' and '3.55' share a bucket.
+
+            ASSERT(2 == X.bucketCount(Obj::bucketIndex(3.5)));
+            ASSERT(2 == X.bucketCount(0));
+
+            ASSERT( 0.0 == X.percentile(0.0));
+            ASSERT(10.0 == X.percentile(1.0));
+        }
+
+        const double FRACTIONS[]   = { 0.01, 0.25, 0.5, 0.9, 0.99, 0.999 };
+        const int    NUM_FRACTIONS = sizeof FRACTIONS / sizeof *FRACTIONS;
+
+        const struct {
+            int    d_line;
+            double d_first;    // first value
+            double d_step;     // added to each value to obtain the next
+            double d_factor;   // multiplies each value to obtain the next
+        } DATA[] = {
+            //LINE  FIRST      STEP   FACTOR
+            //----  ---------  -----  ------
+            { L_,        1.0,   1.0,     1.0 },
+            { L_,     1000.0,   7.0,     1.0 },
+            { L_,     1.0e-6, 1.0e-6,    1.0 },
+            { L_,     1.0e-3,   0.0,   1.005 },
+            { L_,       0.25,   0.0,   1.001 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        enum { k_NUM_VALUES = 2000 };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            Obj mX(METRIC_A, &ta); const Obj& X = mX;
+
+            bsl::vector<double> values;
+            double              value = DATA[ti].d_first;
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                values.push_back(value);
+                mX.update(value);
+                value = value * DATA[ti].d_factor + DATA[ti].d_step;
+            }
+
+            for (int j = 0; j < NUM_FRACTIONS; ++j) {
+                const double FRACTION = FRACTIONS[j];
+                const int    RANK     = static_cast<int>(
+                                                FRACTION * k_NUM_VALUES + 0.5);
+                const double EXACT    = values[RANK - 1];
+                const double ESTIMATE = X.percentile(FRACTION);
+
+                if (veryVerbose) {
+                    P_(LINE) P_(FRACTION) P_(EXACT) P(ESTIMATE)
+                }
+
+                ASSERTV(LINE, FRACTION, EXACT, ESTIMATE,
+                        bsl::fabs(ESTIMATE - EXACT) <= EXACT / 16);
+                ASSERTV(LINE, FRACTION, ESTIMATE, values.front() <= ESTIMATE);
+                ASSERTV(LINE, FRACTION, ESTIMATE, values.back()  >= ESTIMATE);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //:  1 A histogram is created with default values and empty buckets.
+        //:
+        //:  2 Memory is supplied by the specified allocator, or the default
+        //:    allocator if none is specified, and released on destruction.
+        //
+        // Plan:
+        //:  1 Create histograms with and without an allocator, and verify
+        //:    their attributes and allocator usage.  (C-1..2)
+        //
+        // Testing:
+        //   HistogramCollector(const MetricId&, bslma::Allocator *);
+        //   ~HistogramCollector();
+        //   const MetricId& metricId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CREATORS AND BASIC ACCESSORS"
+                          << "\n====================================" << endl;
+
+        {
+            Obj mX(METRIC_A, &ta); const Obj& X = mX;
+            ASSERT(METRIC_A == X.metricId());
+            ASSERT(0        <  ta.numBlocksInUse());
+
+            Rec r;
+            X.load(&r);
+            ASSERT(Rec(METRIC_A) == r);
+
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(i, 0 == X.bucketCount(i));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        {
+            Obj mX(METRIC_A);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET BOUNDS
+        //
+        // Concerns:
+        //:  1 Bucket 0 counts negative values, values less than
+        //:    '2^k_MIN_EXPONENT', and NaN.
+        //:
+        //:  2 The last bucket counts values of at least '2^k_MAX_EXPONENT',
+        //:    including infinity.
+        //:
+        //:  3 The buckets are contiguous: each bucket's upper bound is the
+        //:    lower bound of the next.
+        //:
+        //:  4 'bucketIndex' of each lower bound is the index of that bucket,
+        //:    and 'bucketIndex' of the greatest value less than a bucket's
+        //:    upper bound is the index of that bucket.
+        //:
+        //:  5 Each bucket other than the first and last spans at most 1/16 of
+        //:    its lower bound.
+        //
+        // Plan:
+        //:  1 Verify 'bucketIndex' for a set of values outside the bucketed
+        //:    range.  (C-1..2)
+        //:
+        //:  2 For every bucket, verify the bounds against each other and
+        //:    against 'bucketIndex'.  (C-3..5)
+        //
+        // Testing:
+        //   static int bucketIndex(double value);
+        //   static double bucketLowerBound(int index);
+        //   static double bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BUCKET BOUNDS"
+                          << "\n=====================" << endl;
+
+        const int    LAST = Obj::k_NUM_BUCKETS - 1;
+        const double LOW  = bsl::ldexp(1.0, Obj::k_MIN_EXPONENT);
+        const double HIGH = bsl::ldexp(1.0, Obj::k_MAX_EXPONENT);
+        const double INF  = bsl::numeric_limits<double>::infinity();
+        const double NaN  = bsl::numeric_limits<double>::quiet_NaN();
+
+        ASSERT(0    == Obj::bucketIndex(0.0));
+        ASSERT(0    == Obj::bucketIndex(-0.0));
+        ASSERT(0    == Obj::bucketIndex(-1.0));
+        ASSERT(0    == Obj::bucketIndex(-HIGH));
+        ASSERT(0    == Obj::bucketIndex(-INF));
+        ASSERT(0    == Obj::bucketIndex(NaN));
+        ASSERT(0    == Obj::bucketIndex(LOW / 2));
+        ASSERT(1    == Obj::bucketIndex(LOW));
+        ASSERT(LAST == Obj::bucketIndex(HIGH));
+        ASSERT(LAST == Obj::bucketIndex(HIGH * 2));
+        ASSERT(LAST == Obj::bucketIndex(INF));
+        ASSERT(LAST == Obj::bucketIndex(bsl::numeric_limits<double>::max()));
+
+        ASSERT(0.0  == Obj::bucketLowerBound(0));
+        ASSERT(LOW  == Obj::bucketUpperBound(0));
+        ASSERT(LOW  == Obj::bucketLowerBound(1));
+        ASSERT(HIGH == Obj::bucketLowerBound(LAST));
+        ASSERT(HIGH == Obj::bucketUpperBound(LAST - 1));
+        ASSERT(Rec::k_DEFAULT_MIN == Obj::bucketUpperBound(LAST));
+
+        for (int i = 1; i < LAST; ++i) {
+            const double LOWER = Obj::bucketLowerBound(i);
+            const double UPPER = Obj::bucketUpperBound(i);
+
+            ASSERTV(i, LOWER < UPPER);
+            ASSERTV(i, UPPER == Obj::bucketLowerBound(i + 1));
+            ASSERTV(i, UPPER - LOWER <= LOWER / 16);
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(bsl::nextafter(UPPER, 0.0)));
+        }
+
+        ASSERT(  1 + 16 * (0 - Obj::k_MIN_EXPONENT)     ==
+                                                       Obj::bucketIndex(1.0));
+        ASSERT(  1 + 16 * (0 - Obj::k_MIN_EXPONENT) + 8 ==
+                                                       Obj::bucketIndex(1.5));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //:  1 The class is sufficiently functional to enable comprehensive
+        //:    testing in subsequent test cases.
+        //
+        // Plan:
+        //:  1 Create a histogram, update it, and load its values and
+        //:    percentiles.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX(METRIC_A, &ta); const Obj& X = mX;
+
+        mX.update(2.0);
+        mX.update(4.0);
+
+        Rec r;
+        X.load(&r);
+        ASSERT(Rec(METRIC_A, 2, 6.0, 2.0, 4.0) == r);
+
+        ASSERT(1 == X.bucketCount(Obj::bucketIndex(2.0)));
+        ASSERT(1 == X.bucketCount(Obj::bucketIndex(4.0)));
+        ASSERT(2.0 <= X.percentile(0.5));
+        ASSERT(4.0 >= X.percentile(0.5));
+        ASSERT(4.0 == X.percentile(1.0));
+
+        mX.loadAndReset(&r);
+        ASSERT(Rec(METRIC_A, 2, 6.0, 2.0, 4.0) == r);
+
+        X.load(&r);
+        ASSERT(Rec(METRIC_A) == r);
+        ASSERT(0.0 == X.percentile(0.5));
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
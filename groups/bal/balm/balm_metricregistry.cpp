@@ -32,6 +32,11 @@ namespace BloombergLP {
 
 namespace {
 
+enum {
+    k_INDEX_NUM_BUCKETS = 256,  // initial buckets of a name index
+    k_INDEX_NUM_STRIPES = 32    // stripes (independent locks) of a name index
+};
+
 void combineUserData(bsl::vector<const void *>        *result,
                      const bsl::vector<const void *>&  userData)
     // For each index position in the specified 'userData' containing a
@@ -63,6 +68,56 @@ bool isPrefix(const char *candidatePrefix, const char *string)
     return 0 == *candidatePrefix;
 }
 
+                              // ================
+                              // class MapProctor
+                              // ================
+
+template <class CONTAINER>
+class MapProctor {
+    // This class implements a proctor that, unless 'release' is called,
+    // erases an element from a templatized container object (such as a
+    // 'bsl::map').  On destruction, if 'release()' has not been called, a
+    // 'MapProctor' object will call 'erase' on the supplied 'CONTAINER',
+    // passing the supplied 'CONTAINER::iterator'.
+
+    // DATA
+    CONTAINER                    *d_map_p;     // managed map
+    typename CONTAINER::iterator  d_iterator;  // map element to remove
+
+    // NOT IMPLEMENTED
+    MapProctor(const MapProctor& );
+    MapProctor& operator=(const MapProctor& );
+
+  public:
+    // CREATORS
+    MapProctor(CONTAINER *map, const typename CONTAINER::iterator& iterator)
+        // Create a proctor object that will manage the element in the
+        // specified 'map' indicated by the specified 'iterator'.  The
+        // behavior is undefined unless 'iterator' is a valid iterator into
+        // 'map', and remains valid for the lifetime of this object.
+    : d_map_p(map)
+    , d_iterator(iterator)
+    {
+    }
+
+    ~MapProctor()
+        // Unless 'release' has been called, erase the managed element from
+        // the managed map, and destroy this object.
+    {
+        if (d_map_p) {
+            d_map_p->erase(d_iterator);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release from management the element currently managed by this
+        // proctor.
+    {
+        d_map_p = 0;
+    }
+};
+
 }  // close unnamed namespace
 
                             // --------------------
@@ -72,6 +127,40 @@ bool isPrefix(const char *candidatePrefix, const char *string)
 namespace balm {
 
 // PRIVATE MANIPULATORS
+bsl::pair<const Category *, bool>
+MetricRegistry::insertCategory(const char *category)
+{
+    // Insert the string for 'category' into the unique strings table
+    // 'd_uniqueStrings' (if it is already in the table, this simply looks it
+    // up).
+
+    const char *categoryStr = d_uniqueStrings.insert(category).first->c_str();
+
+    CategoryRegistry::const_iterator catIt = d_categories.find(categoryStr);
+    if (catIt != d_categories.end()) {
+        return bsl::make_pair(catIt->second.get(), false);            // RETURN
+    }
+
+    bsl::shared_ptr<Category> categoryPtr(
+                       new (*d_allocator_p) Category(categoryStr,
+                                                          d_defaultEnabled),
+                       d_allocator_p);
+
+    // Add the category to the index only after adding it to 'd_categories',
+    // so that no lookup can observe a category that is then removed because
+    // an insertion fails.  Note that the index refers to the string held by
+    // 'd_uniqueStrings', which outlives the index.
+
+    MapProctor<CategoryRegistry> proctor(
+              &d_categories,
+              d_categories.insert(bsl::make_pair(categoryStr,
+                                                 categoryPtr)).first);
+
+    d_categoryIndex.insert(bsl::string_view(categoryStr), categoryPtr.get());
+    proctor.release();
+    return bsl::make_pair(categoryPtr.get(), true);
+}
+
 bsl::pair<MetricId, bool>
 MetricRegistry::insertId(const char *category, const char *name)
 {
@@ -92,20 +181,11 @@ MetricRegistry::insertId(const char *category, const char *name)
     bsl::vector<const void *> userData;
     defaultUserData(&userData, category);
 
-    CategoryRegistry::const_iterator catIt = d_categories.find(categoryStr);
-    if (catIt == d_categories.end()) {
-        bsl::shared_ptr<Category> categoryPtr(
-                       new (*d_allocator_p) Category(categoryStr,
-                                                          d_defaultEnabled),
-                       d_allocator_p);
-
-        catIt = d_categories.insert(
-                               bsl::make_pair(categoryStr, categoryPtr)).first;
-    }
+    const Category *categoryPtr = insertCategory(categoryStr).first;
 
     bsl::shared_ptr<MetricDescription> metricPtr(
                      new (*d_allocator_p) MetricDescription(
-                             catIt->second.get(),
+                             categoryPtr,
                              nameStr,
                              d_allocator_p),
                      d_allocator_p);
@@ -114,7 +194,13 @@ MetricRegistry::insertId(const char *category, const char *name)
         metricPtr->setUserData(u, userData[u]);
     }
 
-    d_metrics.insert(bsl::make_pair(id, metricPtr));
+    MapProctor<MetricMap> proctor(&d_metrics,
+                                  d_metrics.insert(
+                                        bsl::make_pair(id, metricPtr)).first);
+
+    d_metricIndex.insert(CategoryAndNameView(categoryStr, nameStr),
+                         metricPtr.get());
+    proctor.release();
     return bsl::make_pair(MetricId(metricPtr.get()), true);
 }
 
@@ -166,6 +252,8 @@ MetricRegistry::MetricRegistry(bslma::Allocator *basicAllocator)
 : d_uniqueStrings(basicAllocator)
 , d_categories(basicAllocator)
 , d_metrics(basicAllocator)
+, d_categoryIndex(k_INDEX_NUM_BUCKETS, k_INDEX_NUM_STRIPES, basicAllocator)
+, d_metricIndex(k_INDEX_NUM_BUCKETS, k_INDEX_NUM_STRIPES, basicAllocator)
 , d_defaultEnabled(true)
 , d_categoryUserData(basicAllocator)
 , d_categoryPrefixUserData(basicAllocator)
@@ -192,8 +280,8 @@ MetricId MetricRegistry::addId(const char *category,
 MetricId MetricRegistry::getId(const char *category,
                                const char *name)
 {
-    // Lookup the 'category' and 'name' using 'findId', as that uses only a
-    // read-lock on 'd_lock'.
+    // Lookup the 'category' and 'name' using 'findId', as that does not
+    // acquire a lock on 'd_lock'.
 
     MetricId result = findId(category, name);
     if (result.isValid()) {
@@ -213,30 +301,14 @@ const Category *MetricRegistry::addCategory(const char *category)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
 
-    // Insert the string for 'category' into the unique strings table
-    // 'd_uniqueStrings' (if it is already in the table, this simply looks it
-    // up).
-
-    const char *categoryStr = d_uniqueStrings.insert(category).first->c_str();
-
-    CategoryRegistry::const_iterator catIt = d_categories.find(categoryStr);
-    if (catIt == d_categories.end()) {
-        bsl::shared_ptr<Category> categoryPtr(
-                       new (*d_allocator_p) Category(categoryStr,
-                                                          d_defaultEnabled),
-                       d_allocator_p);
-
-        catIt = d_categories.insert(
-                               bsl::make_pair(categoryStr, categoryPtr)).first;
-        return catIt->second.get();                                   // RETURN
-    }
-    return 0;
+    bsl::pair<const Category *, bool> ret = insertCategory(category);
+    return ret.second ? ret.first : 0;
 }
 
 const Category *MetricRegistry::getCategory(const char *category)
 {
-    // Lookup the 'category' using 'findCategory', as that uses only a
-    // read-lock on 'd_lock'
+    // Lookup the 'category' using 'findCategory', as that does not acquire a
+    // lock on 'd_lock'.
 
     const Category *result = findCategory(category);
     if (0 != result) {
@@ -249,23 +321,7 @@ const Category *MetricRegistry::getCategory(const char *category)
 
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
 
-    // Insert the string for 'category' into the unique strings table
-    // 'd_uniqueStrings' (if it is already in the table, this simply looks it
-    // up).
-
-    const char *categoryStr = d_uniqueStrings.insert(category).first->c_str();
-
-    CategoryRegistry::const_iterator catIt = d_categories.find(categoryStr);
-    if (catIt == d_categories.end()) {
-        bsl::shared_ptr<Category> categoryPtr(
-                       new (*d_allocator_p) Category(categoryStr,
-                                                          d_defaultEnabled),
-                       d_allocator_p);
-
-        catIt = d_categories.insert(
-                               bsl::make_pair(categoryStr, categoryPtr)).first;
-    }
-    return catIt->second.get();
+    return insertCategory(category).first;
 }
 
 // MANIPULATORS
@@ -415,18 +471,23 @@ bsl::size_t MetricRegistry::numCategories() const
 
 const Category *MetricRegistry::findCategory(const char *category) const
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
-    CategoryRegistry::const_iterator it = d_categories.find(category);
-    return it == d_categories.end() ? 0 : it->second.get();
+    // Every element of 'd_categories' is also in 'd_categoryIndex', which can
+    // be searched without a lock on 'd_lock'.
+
+    const Category *result = 0;
+    d_categoryIndex.getValue(&result, bsl::string_view(category));
+    return result;
 }
 
 MetricId MetricRegistry::findId(const char *category,
                                 const char *name) const
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
-    MetricMap::const_iterator it =
-                                d_metrics.find(bsl::make_pair(category, name));
-    return it == d_metrics.end() ? MetricId() : MetricId(it->second.get());
+    // Every element of 'd_metrics' is also in 'd_metricIndex', which can be
+    // searched without a lock on 'd_lock'.
+
+    const MetricDescription *result = 0;
+    d_metricIndex.getValue(&result, CategoryAndNameView(category, name));
+    return MetricId(result);
 }
 
 void MetricRegistry::getAllCategories(
@@ -39,6 +39,18 @@ BSLS_IDENT("$Id: $")
 // operations on a given object can be safely invoked simultaneously from
 // multiple threads.
 //
+///Concurrent Lookup
+///- - - - - - - - -
+// Registered metrics and categories are indexed by name in a
+// 'bdlcc::StripedUnorderedMap', in addition to the ordered maps that define
+// the registry's contents.  'findId', 'getId', 'findCategory', and
+// 'getCategory' consult the index first, and so resolve an already
+// registered name while holding only the (reader) lock of one stripe of the
+// index, rather than a registry-wide lock.  Threads that resolve many
+// different dynamic metric names (e.g., one per security or per client)
+// therefore do not serialize on the registry.  Registering a *new* metric or
+// category still requires exclusive access to the registry.
+//
 ///Usage
 ///-----
 // The following example illustrates how to create and use a
@@ -102,6 +114,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_cstringless.h>
 
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bslh_hash.h>
+
 #include <bslma_allocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
@@ -111,6 +127,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_memory.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsl_cstddef.h>
@@ -174,6 +191,26 @@ class MetricRegistry {
         // A 'MetricMap' is a type that maps a category and name to a
         // 'balm::MetricDescription' object address.
 
+    typedef bsl::pair<bsl::string_view, bsl::string_view>
+                                                         CategoryAndNameView;
+        // 'CategoryAndNameView' is an alias for a pair of string views of the
+        // category and name of a metric.  The first element is the category
+        // and the second is the name.
+
+    typedef bdlcc::StripedUnorderedMap<CategoryAndNameView,
+                                       const MetricDescription *,
+                                       bslh::Hash<> >    MetricIndex;
+        // A 'MetricIndex' is a type that maps a category and name to a
+        // 'balm::MetricDescription' object address, and that can be searched
+        // without acquiring 'd_lock'.
+
+    typedef bdlcc::StripedUnorderedMap<bsl::string_view,
+                                       const Category *,
+                                       bslh::Hash<> >    CategoryIndex;
+        // A 'CategoryIndex' is a type that maps a name to a 'balm::Category'
+        // object address, and that can be searched without acquiring
+        // 'd_lock'.
+
     typedef bsl::map<const char *,
                      bsl::shared_ptr<Category>,
                      bdlb::CStringLess>                    CategoryRegistry;
@@ -194,6 +231,12 @@ class MetricRegistry {
 
     MetricMap              d_metrics;        // map (category,name) -> MetricId
 
+    CategoryIndex          d_categoryIndex;  // concurrent index of
+                                             // 'd_categories'
+
+    MetricIndex            d_metricIndex;    // concurrent index of
+                                             // 'd_metrics'
+
     bool                   d_defaultEnabled; // default enabled status
 
     UserDataRegistry       d_categoryUserData;
@@ -215,6 +258,13 @@ class MetricRegistry {
 
   private:
     // PRIVATE MANIPULATORS
+    bsl::pair<const Category *, bool> insertCategory(const char *category);
+        // Insert a category having the specified 'category' name into this
+        // metric registry.  Return a pair whose first member is the address
+        // of the category, and whose second member is 'true' if the returned
+        // category is newly-created and 'false' otherwise.  The behavior is
+        // undefined unless the calling thread has a *write* lock on 'd_lock'.
+
     bsl::pair<MetricId, bool> insertId(const char *category,
                                        const char *name);
         // Insert a metric id having the specified 'category' and 'name' into
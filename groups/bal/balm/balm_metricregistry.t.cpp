@@ -451,6 +451,43 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+void getIds(bsl::vector<Id>  *result,
+            Obj              *registry,
+            bslmt::Barrier   *barrier,
+            int               threadIndex,
+            int               numIds)
+    // Wait on the specified 'barrier', then load into the specified 'result'
+    // the ids returned by 'getId' on the specified 'registry' for the
+    // specified 'numIds' metrics shared by all threads, followed by the ids
+    // of 'numIds' metrics unique to the specified 'threadIndex'.  Shared
+    // metric 'k' has the category "S-<k % 4>" and the name "M-<k>", and the
+    // unique metric 'k' has the category "U-<threadIndex>" and the same name.
+    // The metrics are obtained in an order starting at 'threadIndex', so that
+    // threads concurrently create both the same and different metrics.
+{
+    bsl::vector<bsl::string> categories(numIds);
+    bsl::vector<bsl::string> names(numIds);
+    bsl::string              uniqueCategory;
+    for (int k = 0; k < numIds; ++k) {
+        stringId(&categories[k], "S", k % 4);
+        stringId(&names[k], "M", k);
+    }
+    stringId(&uniqueCategory, "U", threadIndex);
+
+    result->resize(2 * numIds);
+
+    barrier->wait();
+
+    for (int j = 0; j < numIds; ++j) {
+        const int k = (j + threadIndex) % numIds;
+
+        (*result)[k]          = registry->getId(categories[k].c_str(),
+                                                names[k].c_str());
+        (*result)[numIds + k] = registry->getId(uniqueCategory.c_str(),
+                                                names[k].c_str());
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -552,6 +589,29 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
         //
+        // Concerns:
+        //   That 'getId', 'addId', 'getCategory', 'addCategory',
+        //   'findCategory', 'findId', and 'getAllCategories' are thread-safe.
+        //
+        //   That concurrent calls to 'getId' for the same metric, whether
+        //   they find the metric without locking the registry or create it
+        //   while holding the lock, return the same id, that calls for
+        //   different metrics return distinct ids, and that each id remains
+        //   the one subsequently found by 'findId' and 'getId'.
+        //
+        // Plan:
+        //   Invoke the manipulators and accessors concurrently from several
+        //   threads, verifying the returned values.
+        //
+        //   Then, repeatedly, have several threads simultaneously call
+        //   'getId' for a set of metrics shared by all threads (each thread
+        //   starting at a different metric) and for a set of metrics unique
+        //   to each thread.  Verify that all threads obtained the same id for
+        //   each shared metric, that the number of metrics and categories is
+        //   the number of distinct metrics and categories requested, and that
+        //   'findId', 'getId', 'findCategory', and 'addId' agree with the
+        //   obtained ids.
+        //
         // Testing:
         //     Thread-safety of 'getId', 'addId', 'getCategory',
         //     'addCategory', 'findCategory', 'findId', and
@@ -571,6 +631,81 @@ int main(int argc, char *argv[])
             ConcurrencyTest tester(10, &registry, &defaultAllocator);
             tester.runTest();
         }
+
+        if (verbose) cout << "\tTesting concurrent find-or-create." << endl;
+
+        const int NUM_THREADS = 8;
+        const int NUM_IDS     = 64;
+        const int NUM_ROUNDS  = 20;
+
+        for (int round = 0; round < NUM_ROUNDS; ++round) {
+            bslma::TestAllocator ta;
+            Obj mX(&ta); const Obj& MX = mX;
+
+            bslmt::Barrier                barrier(NUM_THREADS);
+            bsl::vector<bsl::vector<Id> > ids(NUM_THREADS);
+            {
+                bdlmt::FixedThreadPool pool(NUM_THREADS, NUM_THREADS);
+                pool.start();
+                for (int t = 0; t < NUM_THREADS; ++t) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&getIds,
+                                                         &ids[t],
+                                                         &mX,
+                                                         &barrier,
+                                                         t,
+                                                         NUM_IDS));
+                }
+                pool.drain();
+            }
+
+            ASSERTV(round, MX.numMetrics(),
+                    static_cast<bsl::size_t>(NUM_IDS * (NUM_THREADS + 1)) ==
+                                                             MX.numMetrics());
+            ASSERTV(round, MX.numCategories(),
+                    static_cast<bsl::size_t>(4 + NUM_THREADS) ==
+                                                          MX.numCategories());
+
+            bsl::string category, name;
+            for (int k = 0; k < NUM_IDS; ++k) {
+                stringId(&category, "S", k % 4);
+                stringId(&name, "M", k);
+
+                const Id ID = ids[0][k];
+                ASSERTV(round, k, ID.isValid());
+                for (int t = 1; t < NUM_THREADS; ++t) {
+                    ASSERTV(round, k, t, ID == ids[t][k]);
+                }
+
+                ASSERTV(round, k, 0 == bsl::strcmp(category.c_str(),
+                                                   ID.categoryName()));
+                ASSERTV(round, k, 0 == bsl::strcmp(name.c_str(),
+                                                   ID.metricName()));
+                ASSERTV(round, k,
+                        ID == MX.findId(category.c_str(), name.c_str()));
+                ASSERTV(round, k,
+                        ID == mX.getId(category.c_str(), name.c_str()));
+                ASSERTV(round, k,
+                        !mX.addId(category.c_str(), name.c_str()).isValid());
+                ASSERTV(round, k,
+                        ID.category() == MX.findCategory(category.c_str()));
+            }
+
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                stringId(&category, "U", t);
+                for (int k = 0; k < NUM_IDS; ++k) {
+                    stringId(&name, "M", k);
+
+                    const Id ID = ids[t][NUM_IDS + k];
+                    ASSERTV(round, t, k, ID.isValid());
+                    ASSERTV(round, t, k, ID != ids[0][k]);
+                    ASSERTV(round, t, k,
+                            ID == MX.findId(category.c_str(), name.c_str()));
+                    ASSERTV(round, t, k,
+                            ID.category() ==
+                                          MX.findCategory(category.c_str()));
+                }
+            }
+        }
     } break;
       case 14:{
         // --------------------------------------------------------------------
@@ -1030,9 +1165,17 @@ int main(int argc, char *argv[])
         //   That 'addId', 'getId', 'addCategory', and 'getCategory' are
         //   exception safe with respect to allocation.
         //
+        //   That a metric whose insertion fails is removed from both the
+        //   ordered map of metrics and the lookup index.
+        //
         // Plan:
         //   Use the 'BSLMA_EXCEPTION_TEST' to verify the manipulator methods
         //   of this object are exception neutral.
+        //
+        //   Verify, on each attempt, that exactly the metrics for which
+        //   'getId' has returned are found by 'findId' and counted by
+        //   'numMetrics', and that the categories found by 'findCategory'
+        //   are those counted by 'numCategories'.
         // --------------------------------------------------------------------
         if (verbose) cout << "\nTesting exception neutrality" << endl;
 
@@ -1118,6 +1261,55 @@ int main(int argc, char *argv[])
             } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
         }
 
+        {
+            if (veryVerbose) {
+                cout << "\tVerify a failed insertion leaves no entry"
+                     << endl;
+            }
+
+            // A metric or category whose insertion fails (at any allocation,
+            // including the insertion into the lookup index) must be found
+            // neither by the lock-free lookup ('findId' and 'findCategory')
+            // nor in the ordered maps ('numMetrics' and 'numCategories'), and
+            // a later attempt must create it.
+
+            bsl::set<int>        registered;
+            bslma::TestAllocator testAllocator;
+
+            Obj mX(&testAllocator); const Obj& MX = mX;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                for (int i = 0; i < NUM_METRICS; ++i) {
+                    bsl::set<bsl::string> categories;
+                    for (int j = 0; j < NUM_METRICS; ++j) {
+                        const char *CAT  = METRICS[j].d_category;
+                        const char *NAME = METRICS[j].d_name;
+
+                        const bool isRegistered = registered.count(j);
+                        ASSERTV(i, j, isRegistered ==
+                                            MX.findId(CAT, NAME).isValid());
+                        if (MX.findCategory(CAT)) {
+                            categories.insert(CAT);
+                        }
+                        else {
+                            ASSERTV(i, j, !isRegistered);
+                        }
+                    }
+                    ASSERTV(i, registered.size() == MX.numMetrics());
+                    ASSERTV(i, categories.size() == MX.numCategories());
+
+                    const char *CAT  = METRICS[i].d_category;
+                    const char *NAME = METRICS[i].d_name;
+
+                    Id metric = mX.getId(CAT, NAME);
+                    registered.insert(i);
+
+                    ASSERT(metric.isValid());
+                    ASSERT(metric == MX.findId(CAT, NAME));
+                    ASSERT(metric.category() == MX.findCategory(CAT));
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
         const char *CATEGORIES[] = { "", "A", "B", "CAT_A", "CAT_B", "name" };
         const int NUM_CATEGORIES = sizeof CATEGORIES / sizeof *CATEGORIES;
         {
@@ -76,6 +76,17 @@ BSLS_IDENT("$Id: $")
 //       Increment (by 1) the identified metric.  'CATEGORY' and 'METRIC' must
 //       be *runtime* *constants*.
 //
+//   BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       Update the identified metric by 'VALUE' (or 1) through a lock-free,
+//       per-thread sharded collector.  'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.
+//
+//   BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+//       Record 'VALUE' in the lock-free histogram of the identified metric,
+//       whose percentiles are published in addition to its aggregates.
+//       'CATEGORY' and 'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_TYPED_INCREMENT(CATEGORY, METRIC, PREFERRED_TYPE)
 //       Increment (by 1) the identified metric and set the metric's preferred
 //       publication type.  'CATEGORY' and 'METRIC' must be *runtime*
@@ -102,6 +113,17 @@ BSLS_IDENT("$Id: $")
 //       of the enclosing lexical scope.  'CATEGORY' and 'METRIC' must
 //       be *runtime* *constants*.
 //
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+//       Record the elapsed (wall) time, in the indicated units, from the
+//       instantiation point of the macro to the end of the enclosing lexical
+//       scope in the histogram of the identified metric, so that percentiles
+//       of the elapsed time are published.  'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.
+//
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
@@ -243,6 +265,36 @@ BSLS_IDENT("$Id: $")
 //   BALM_METRICS_TYPED_INCREMENT(CATEGORY, METRIC, PREFERRED_TYPE)
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_TYPED_UPDATE(CATEGORY, METRIC, 1, PREFERRED_TYPE)'.
+//
+//   BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_UPDATE(CATEGORY, METRIC, VALUE)', except that the value
+//       is recorded in the default 'balm::ShardedCollector' for the metric
+//       (see 'balm_shardedcollector') rather than its default
+//       'balm::Collector'.  A sharded collector is updated without taking a
+//       lock, and threads updating the same metric usually write to distinct
+//       cache lines, so this macro is preferable for metrics updated at high
+//       frequency from many threads.  The shards are combined with the
+//       metric's other collectors when the metrics manager collects records
+//       for publication.
+//
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, 1)'.
+//
+//   BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+//       Record the specified 'VALUE' in the default 'balm::HistogramCollector'
+//       for the metric identified by the specified 'CATEGORY' and 'METRIC'
+//       (see 'balm_histogramcollector').  The count, total, minimum, and
+//       maximum of the recorded values are published with the metric's
+//       record, and the 50th, 90th, 99th, and 99.9th percentiles of the
+//       values are published as the metrics 'METRIC' suffixed by '.p50',
+//       '.p90', '.p99', and '.p999' (see 'balm_collectorrepository').  The
+//       histogram is updated without taking a lock.  This macro maintains a
+//       (function-scope static) cache of the histogram, so 'CATEGORY' and
+//       'METRIC' must be *runtime* *constants*.  If the default metrics
+//       manager has not been initialized, or the identified 'CATEGORY' is
+//       disabled, this macro has no effect.
 //..
 //  The following are the dynamic macros provided by this component for
 //  updating a metric's value; these macros do not statically cache the
@@ -342,6 +394,23 @@ BSLS_IDENT("$Id: $")
 //       'BALM_METRICS_TIME_BLOCK' called with
 //       'balm::StopwatchScopedGuard::k_NANOSECONDS'.
 //
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)', except that
+//       the elapsed time is recorded (as if by 'BALM_METRICS_HISTOGRAM') in
+//       the default 'balm::HistogramCollector' for the metric, so that
+//       percentiles of the elapsed time are published in addition to its
+//       count, total, minimum, and maximum.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+//       The behavior of these macros is logically equivalent to
+//       'BALM_METRICS_HISTOGRAM_TIME_BLOCK' called with
+//       'balm::StopwatchScopedGuard::k_SECONDS', 'k_MILLISECONDS',
+//       'k_MICROSECONDS', and 'k_NANOSECONDS' respectively.
+//
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //       Update the indicated metric, identified by the specified 'CATEGORY'
 //       and 'METRIC' names, by the elapsed (wall) time, in the specified
@@ -505,11 +574,13 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricregistry.h>
 #include <balm_metricsmanager.h>
 #include <balm_publicationtype.h>
+#include <balm_shardedcollector.h>
 #include <balm_stopwatchscopedguard.h>
 
 #include <bsls_performancehint.h>
@@ -996,6 +1067,84 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // ===========================
+                        // BALM_METRICS_SHARDED_UPDATE
+                        // ===========================
+
+#define BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE) do {             \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::ShardedCollector *collector1 = 0;                             \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getShardedCollector(CATEGORY, METRIC);            \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)                      \
+    BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, 1)
+
+                        // ======================
+                        // BALM_METRICS_HISTOGRAM
+                        // ======================
+
+#define BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE) do {                  \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::HistogramCollector *collector1 = 0;                           \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getHistogramCollector(CATEGORY, METRIC);          \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+                    // =================================
+                    // BALM_METRICS_HISTOGRAM_TIME_BLOCK
+                    // =================================
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)       \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(                                      \
+                                  (CATEGORY),                                 \
+                                  (METRIC),                                   \
+                                  TIME_UNITS,                                 \
+                                  BALM_METRICS_UNIQUE_NAME(_bAlM_HiStOgRaM))
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS(CATEGORY, METRIC)           \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                           (CATEGORY),                                        \
+                           (METRIC),                                          \
+                           BloombergLP::balm::StopwatchScopedGuard::k_SECONDS);
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)      \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                      (CATEGORY),                                             \
+                      (METRIC),                                               \
+                      BloombergLP::balm::StopwatchScopedGuard::k_MILLISECONDS);
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)      \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                      (CATEGORY),                                             \
+                      (METRIC),                                               \
+                      BloombergLP::balm::StopwatchScopedGuard::k_MICROSECONDS);
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)       \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                       (CATEGORY),                                            \
+                       (METRIC),                                              \
+                       BloombergLP::balm::StopwatchScopedGuard::k_NANOSECONDS);
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1101,6 +1250,33 @@ do {                                                                          \
     BloombergLP::balm::StopwatchScopedGuard                                   \
          BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
 
+// Declare a static pointer to a 'balm::HistogramCollector' with the specified
+// 'VARIABLE_NAME' and an initial value of 0.  If the default metrics manager
+// is available and the declared pointer variable (named 'VARIABLE_NAME') is 0,
+// assign to 'VARIABLE_NAME' the address of the histogram collector for the
+// specified 'CATEGORY' and 'METRIC'.  Finally, declare a
+// 'balm::StopwatchScopedGuard' object with a unique variable name and supply
+// its constructor the histogram address held in 'VARIABLE_NAME' and the
+// specified 'TIME_UNITS'.
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(CATEGORY,                       \
+                                              METRIC,                         \
+                                              TIME_UNITS,                     \
+                                              VARIABLE_NAME)                  \
+    static BloombergLP::balm::HistogramCollector *VARIABLE_NAME = 0;          \
+    if (BloombergLP::balm::DefaultMetricsManager::instance()) {               \
+       using namespace BloombergLP;                                           \
+       if (0 == VARIABLE_NAME) {                                              \
+           VARIABLE_NAME = balm::Metrics_Helper::getHistogramCollector(       \
+                                                                (CATEGORY),   \
+                                                                (METRIC));    \
+       }                                                                      \
+    }                                                                         \
+    else {                                                                    \
+       VARIABLE_NAME = 0;                                                     \
+    }                                                                         \
+    BloombergLP::balm::StopwatchScopedGuard                                   \
+         BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
+
 // Declare a pointer to a 'balm::Collector' with the specified 'VARIABLE_NAME'.
 // If the default metrics manager is available, assign to the declared pointer
 // variable (named 'VARIABLE_NAME') the address of a collector for the
@@ -1202,6 +1378,20 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static ShardedCollector *getShardedCollector(const char *category,
+                                                 const char *metric);
+        // Return the address of the default sharded metrics collector for the
+        // metric identified by the specified 'category' and 'metric' names.
+        // The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
+    static HistogramCollector *getHistogramCollector(const char *category,
+                                                     const char *metric);
+        // Return the address of the default histogram collector for the
+        // metric identified by the specified 'category' and 'metric' names.
+        // The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1446,25 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+ShardedCollector *Metrics_Helper::getShardedCollector(const char *category,
+                                                      const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultShardedCollector(category,
+                                                                     metric);
+}
+
+inline
+HistogramCollector *Metrics_Helper::getHistogramCollector(const char *category,
+                                                          const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultHistogramCollector(
+                                                                    category,
+                                                                    metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
@@ -88,6 +88,14 @@ using bsl::flush;
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+// [19] BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+// [19] BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+// [20] BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+// [20] BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+// [20] BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
+// [20] BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+// [20] BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+// [20] BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] CONCURRENCY TEST: STANDARD MACROS
@@ -101,7 +109,8 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [19] CONCURRENCY TEST: SHARDED MACROS
+// [21] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -179,6 +188,26 @@ BALM::MetricRecord recordVal(const BALM::IntegerCollector *collector)
     return record;
 }
 
+inline
+BALM::MetricRecord recordVal(const BALM::HistogramCollector *collector)
+    // Return the current record value of the specified 'collector'.
+{
+    BALM::MetricRecord record;
+    collector->load(&record);
+    return record;
+}
+
+Corp::bsls::Types::Int64 numBucketed(
+                                  const BALM::HistogramCollector *histogram)
+    // Return the sum of the bucket counts of the specified 'histogram'.
+{
+    Corp::bsls::Types::Int64 result = 0;
+    for (int i = 0; i < BALM::HistogramCollector::k_NUM_BUCKETS; ++i) {
+        result += histogram->bucketCount(i);
+    }
+    return result;
+}
+
 bool within(double         value,
             SWGuard::Units scale,
             double         expectedS,
@@ -1280,6 +1309,123 @@ void TlsIntMacroConcurrencyTest::runTest()
 
 #endif
 
+                         // ========================
+                         // class RecordingPublisher
+                         // ========================
+
+class RecordingPublisher : public BALM::Publisher {
+    // This class provides an implementation of the 'balm::Publisher' protocol
+    // that records the metric records of the last sample published to it.
+    // Note that the 'publish' method is *not* thread-safe.
+
+    // DATA
+    bsl::vector<BALM::MetricRecord> d_records;  // last sample's records
+
+    // NOT IMPLEMENTED
+    RecordingPublisher(const RecordingPublisher&);
+    RecordingPublisher& operator=(const RecordingPublisher&);
+
+  public:
+    // CREATORS
+    explicit RecordingPublisher(Corp::bslma::Allocator *basicAllocator = 0)
+        // Create a publisher that has recorded no metric records.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+    : d_records(basicAllocator)
+    {
+    }
+
+    virtual ~RecordingPublisher()
+        // Destroy this publisher.
+    {
+    }
+
+    // MANIPULATORS
+    virtual void publish(const BALM::MetricSample& sample)
+        // Replace the records held by this publisher with the records in the
+        // specified 'sample'.
+    {
+        d_records.clear();
+        for (BALM::MetricSample::const_iterator sIt = sample.begin();
+             sIt != sample.end();
+             ++sIt) {
+            d_records.insert(d_records.end(), sIt->begin(), sIt->end());
+        }
+    }
+
+    // ACCESSORS
+    BALM::MetricRecord lastRecord(const Id& id) const
+        // Return the record for the specified 'id' in the last sample
+        // published to this object, or a record having 'id' and the default
+        // (empty) value if that sample held no record for 'id'.
+    {
+        for (bsl::size_t i = 0; i < d_records.size(); ++i) {
+            if (d_records[i].metricId() == id) {
+                return d_records[i];                                  // RETURN
+            }
+        }
+        return BALM::MetricRecord(id);
+    }
+};
+
+// ------------------- case 19: ShardedMacroConcurrencyTest -------------------
+
+class ShardedMacroConcurrencyTest {
+    // Invoke the sharded macros from several threads synchronously.
+
+    // DATA
+    Corp::bdlmt::FixedThreadPool  d_pool;
+    Corp::bslmt::Barrier          d_barrier;
+    int                           d_count;
+
+    // PRIVATE MANIPULATORS
+    void execute();
+        // Execute a single test.
+
+  public:
+    // CREATORS
+    ShardedMacroConcurrencyTest(int                     numThreads,
+                                int                     count,
+                                Corp::bslma::Allocator *basicAllocator)
+    : d_pool(numThreads, 1000, basicAllocator)
+    , d_barrier(numThreads)
+    , d_count(count)
+    {
+        d_pool.start();
+    }
+
+    ~ShardedMacroConcurrencyTest() {}
+
+    // MANIPULATORS
+    void runTest();
+        // Run the test.
+};
+
+void ShardedMacroConcurrencyTest::execute()
+{
+    // Once every thread has reached the barrier, update the metric "A.update"
+    // with the values '[0 .. d_count)' and increment the metric "A.increment"
+    // 'd_count' times.
+
+    d_barrier.wait();
+    for (int i = 0; i < d_count; ++i) {
+        BALM_METRICS_SHARDED_UPDATE("A", "update", i);
+        BALM_METRICS_SHARDED_INCREMENT("A", "increment");
+    }
+}
+
+void ShardedMacroConcurrencyTest::runTest()
+{
+    bsl::function<void()> job = Corp::bdlf::BindUtil::bind(
+                                         &ShardedMacroConcurrencyTest::execute,
+                                         this);
+    for (int i = 0; i < d_pool.numThreads(); ++i) {
+        d_pool.enqueueJob(job);
+    }
+    d_pool.drain();
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -1386,6 +1532,402 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 19: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_SHARDED_UPDATE',
+        //          'BALM_METRICS_SHARDED_INCREMENT'
+        //
+        // Concerns:
+        //    That the sharded macros correctly update the identified metric,
+        //    are a no-op without a default metrics manager, respect the
+        //    supplied category's 'enabled' property, and that updates made
+        //    concurrently from several threads are all published.
+        //
+        // Plan:
+        //   Verify that invoking the macros without a default metrics manager
+        //   has no effect.
+        //
+        //   Invoke the macros for a set of values, perform the same
+        //   operations on "oracle" collectors, and verify the sharded
+        //   collectors underlying the metrics have the same values as the
+        //   "oracle" collectors.  Perform the same test again, but enable or
+        //   disable the metrics' category on each iteration, updating the
+        //   "oracle" collectors only while the category is enabled.
+        //
+        //   Invoke the macros from several threads, publish the metrics to a
+        //   'RecordingPublisher', and verify the published count and total
+        //   account for every update.
+        //
+        // Testing:
+        //    BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+        //    BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+        //    CONCURRENCY TEST: SHARDED MACROS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: SHARDED MACROS\n"
+                          << "=======================\n";
+
+        const double UPDATES[] = { 0.0, 12.0, -1321123, 2131241, 1321.5,
+                                   43145.1, .0001, -1.00001, -.002342};
+        const int NUM_UPDATES = sizeof(UPDATES)/sizeof(*UPDATES);
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                BALM_METRICS_SHARDED_UPDATE("A", "update", UPDATES[i]);
+                BALM_METRICS_SHARDED_INCREMENT("A", "increment");
+            }
+            ASSERT(0 == DefaultManager::instance());
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros are applied correctly.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const Id UPDATE_ID(registry.getId("A", "update"));
+            const Id INCREMENT_ID(registry.getId("A", "increment"));
+
+            Collector expUpdate(UPDATE_ID);
+            Collector expIncrement(INCREMENT_ID);
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                BALM_METRICS_SHARDED_UPDATE("A", "update", UPDATES[i]);
+                BALM_METRICS_SHARDED_INCREMENT("A", "increment");
+                expUpdate.update(UPDATES[i]);
+                expIncrement.update(1);
+            }
+
+            BALM::MetricRecord update, increment;
+            repository.getDefaultShardedCollector(UPDATE_ID)->load(&update);
+            repository.getDefaultShardedCollector(INCREMENT_ID)->load(
+                                                                   &increment);
+
+            ASSERT(recordVal(&expUpdate)    == update);
+            ASSERT(recordVal(&expIncrement) == increment);
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros respect the category's enabled flag.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const Id UPDATE_ID(registry.getId("A", "update"));
+            const Id INCREMENT_ID(registry.getId("A", "increment"));
+
+            Collector expUpdate(UPDATE_ID);
+            Collector expIncrement(INCREMENT_ID);
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                bool enabled = 0 == i % 2;
+                registry.setCategoryEnabled(UPDATE_ID.category(), enabled);
+
+                BALM_METRICS_SHARDED_UPDATE("A", "update", UPDATES[i]);
+                BALM_METRICS_SHARDED_INCREMENT("A", "increment");
+                if (enabled) {
+                    expUpdate.update(UPDATES[i]);
+                    expIncrement.update(1);
+                }
+            }
+
+            BALM::MetricRecord update, increment;
+            repository.getDefaultShardedCollector(UPDATE_ID)->load(&update);
+            repository.getDefaultShardedCollector(INCREMENT_ID)->load(
+                                                                   &increment);
+
+            ASSERT(recordVal(&expUpdate)    == update);
+            ASSERT(recordVal(&expIncrement) == increment);
+        }
+
+        if (veryVerbose)
+            cout << "\tverify concurrent updates are all published.\n";
+        {
+            const int NUM_THREADS = 10;
+            const int COUNT       = 1000;
+            const int TOTAL       = (COUNT * (COUNT - 1)) / 2;
+
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry& registry = mgr.metricRegistry();
+
+            bsl::shared_ptr<RecordingPublisher> publisher(
+                                            new (*Z) RecordingPublisher(Z), Z);
+            mgr.addGeneralPublisher(publisher);
+
+            {
+                ShardedMacroConcurrencyTest tester(NUM_THREADS, COUNT, Z);
+                tester.runTest();
+            }
+            mgr.publishAll();
+
+            const BALM::MetricRecord update =
+                     publisher->lastRecord(registry.getId("A", "update"));
+            const BALM::MetricRecord increment =
+                     publisher->lastRecord(registry.getId("A", "increment"));
+
+            ASSERTV(update.count(), COUNT * NUM_THREADS == update.count());
+            ASSERTV(update.total(), TOTAL * NUM_THREADS == update.total());
+            ASSERTV(update.min(),   0                   == update.min());
+            ASSERTV(update.max(),   COUNT - 1           == update.max());
+
+            ASSERTV(increment.count(),
+                    COUNT * NUM_THREADS == increment.count());
+            ASSERTV(increment.total(),
+                    COUNT * NUM_THREADS == increment.total());
+            ASSERTV(increment.min(), 1 == increment.min());
+            ASSERTV(increment.max(), 1 == increment.max());
+        }
+      } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_HISTOGRAM',
+        //          'BALM_METRICS_HISTOGRAM_TIME_BLOCK'
+        //
+        // Concerns:
+        //    That the histogram macros record each value (or elapsed time) in
+        //    the bucket containing it, are a no-op without a default metrics
+        //    manager, and respect the supplied category's 'enabled'
+        //    property.
+        //
+        // Plan:
+        //   Verify that invoking the macros without a default metrics manager
+        //   has no effect.
+        //
+        //   Invoke 'BALM_METRICS_HISTOGRAM' for a set of values, perform the
+        //   same operations on an "oracle" collector and on an array of
+        //   expected bucket counts, and verify the histogram underlying the
+        //   metric, and the record published for it, match.  Perform the same
+        //   test again, but enable or disable the metric's category on each
+        //   iteration.
+        //
+        //   Time a number of blocks with each time-block macro, and verify
+        //   each histogram records one value per block.  Time a block that
+        //   sleeps for a known interval and verify each histogram reports it
+        //   in the requested units, in the bucket containing that value.
+        //   Finally, verify blocks timed in a disabled category are not
+        //   recorded.
+        //
+        // Testing:
+        //    BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: HISTOGRAM MACROS\n"
+                          << "=========================\n";
+
+        typedef BALM::HistogramCollector   Histogram;
+        typedef BALM::StopwatchScopedGuard TU;  // Time unit enumeration
+
+        const double VALUES[] = { 0.0, .0001, 1.0, 1.0, 3.0, 100.0, 100.0,
+                                  1321.5, 43145.1, 2131241 };
+        const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                BALM_METRICS_HISTOGRAM("A", "histogram", VALUES[i]);
+
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK("A", "t", TU::k_SECONDS);
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS("A", "s");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS("A", "ms");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS("A", "us");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("A", "ns");
+            }
+            ASSERT(0 == DefaultManager::instance());
+        }
+
+        if (veryVerbose)
+            cout << "\tverify values are recorded in their buckets.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            bsl::shared_ptr<RecordingPublisher> publisher(
+                                            new (*Z) RecordingPublisher(Z), Z);
+            mgr.addGeneralPublisher(publisher);
+
+            const Id ID(registry.getId("A", "histogram"));
+
+            Collector expValue(ID);
+            bsl::vector<Corp::bsls::Types::Int64> expBuckets(
+                                                    Histogram::k_NUM_BUCKETS,
+                                                    0,
+                                                    Z);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                BALM_METRICS_HISTOGRAM("A", "histogram", VALUES[i]);
+                expValue.update(VALUES[i]);
+                ++expBuckets[Histogram::bucketIndex(VALUES[i])];
+            }
+
+            const Histogram *histogram =
+                                   repository.getDefaultHistogramCollector(ID);
+
+            ASSERT(recordVal(&expValue) == recordVal(histogram));
+            for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+                ASSERTV(i, expBuckets[i], histogram->bucketCount(i),
+                        expBuckets[i] == histogram->bucketCount(i));
+            }
+
+            mgr.publishAll();
+            ASSERT(recordVal(&expValue) == publisher->lastRecord(ID));
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros respect the category's enabled flag.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const Id ID(registry.getId("A", "histogram"));
+
+            Collector expValue(ID);
+            bsl::vector<Corp::bsls::Types::Int64> expBuckets(
+                                                    Histogram::k_NUM_BUCKETS,
+                                                    0,
+                                                    Z);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                bool enabled = 0 == i % 2;
+                registry.setCategoryEnabled(ID.category(), enabled);
+
+                BALM_METRICS_HISTOGRAM("A", "histogram", VALUES[i]);
+                if (enabled) {
+                    expValue.update(VALUES[i]);
+                    ++expBuckets[Histogram::bucketIndex(VALUES[i])];
+                }
+            }
+
+            const Histogram *histogram =
+                                   repository.getDefaultHistogramCollector(ID);
+
+            ASSERT(recordVal(&expValue) == recordVal(histogram));
+            for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+                ASSERTV(i, expBuckets[i], histogram->bucketCount(i),
+                        expBuckets[i] == histogram->bucketCount(i));
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify each timed block is recorded once.\n";
+        {
+            const int NUM_BLOCKS = 5;
+
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Repository& repository = mgr.collectorRepository();
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK("A", "t", TU::k_SECONDS);
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS("A", "s");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS("A", "ms");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS("A", "us");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("A", "ns");
+            }
+
+            const char *METRICS[]   = { "t", "s", "ms", "us", "ns" };
+            const int   NUM_METRICS = sizeof METRICS / sizeof *METRICS;
+            for (int i = 0; i < NUM_METRICS; ++i) {
+                const Histogram *histogram =
+                          repository.getDefaultHistogramCollector("A",
+                                                                  METRICS[i]);
+                const BALM::MetricRecord record = recordVal(histogram);
+
+                ASSERTV(METRICS[i], record.count(),
+                        NUM_BLOCKS == record.count());
+                ASSERTV(METRICS[i], numBucketed(histogram),
+                        NUM_BLOCKS == numBucketed(histogram));
+                ASSERTV(METRICS[i], record.min(), 0 <= record.min());
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify elapsed times are reported in their units.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Repository& repository = mgr.collectorRepository();
+
+            Corp::bsls::Stopwatch sw;
+            sw.start();
+            {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK("B", "t", TU::k_SECONDS);
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS("B", "s");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS("B", "ms");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS("B", "us");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("B", "ns");
+
+                Corp::bslmt::ThreadUtil::sleep(
+                                          Corp::bsls::TimeInterval(50 * .001));
+
+                sw.stop();
+            }
+            double expected = sw.elapsedTime();
+
+            const char     *METRICS[]   = { "t", "s", "ms", "us", "ns" };
+            const TU::Units UNITS[]     = { TU::k_SECONDS,
+                                            TU::k_SECONDS,
+                                            TU::k_MILLISECONDS,
+                                            TU::k_MICROSECONDS,
+                                            TU::k_NANOSECONDS };
+            const int       NUM_METRICS = sizeof METRICS / sizeof *METRICS;
+            for (int i = 0; i < NUM_METRICS; ++i) {
+                const Histogram *histogram =
+                          repository.getDefaultHistogramCollector("B",
+                                                                  METRICS[i]);
+                const BALM::MetricRecord record = recordVal(histogram);
+
+                ASSERTV(METRICS[i], record.count(), 1 == record.count());
+                ASSERTV(METRICS[i], record.total(), expected,
+                        within(record.total(), UNITS[i], expected, 1.0));
+                ASSERTV(METRICS[i],
+                        1 == histogram->bucketCount(
+                                     Histogram::bucketIndex(record.total())));
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify blocks in a disabled category are ignored.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Repository& repository = mgr.collectorRepository();
+
+            mgr.setCategoryEnabled("C", false);
+            {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK("C", "t", TU::k_SECONDS);
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_SECONDS("C", "s");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS("C", "ms");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS("C", "us");
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("C", "ns");
+            }
+
+            const char *METRICS[]   = { "t", "s", "ms", "us", "ns" };
+            const int   NUM_METRICS = sizeof METRICS / sizeof *METRICS;
+            for (int i = 0; i < NUM_METRICS; ++i) {
+                const Histogram *histogram =
+                          repository.getDefaultHistogramCollector("C",
+                                                                  METRICS[i]);
+
+                ASSERTV(METRICS[i], 0 == recordVal(histogram).count());
+                ASSERTV(METRICS[i], 0 == numBucketed(histogram));
+            }
+        }
+      } break;
+      case 21: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -0,0 +1,778 @@
+// balm_openmetricspublisher.cpp                                      -*-C++-*-
+#include <balm_openmetricspublisher.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_openmetricspublisher_cpp,"$Id$ $CSID$")
+
+#include <balm_metricdescription.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsample.h>
+
+#include <bdlf_memfn.h>
+#include <bdls_filesystemutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_POLL_TIMEOUT_MS     = 200,    // interval at which the serving thread
+                                    // checks whether to stop
+
+    k_CLIENT_DEADLINE_MS  = 500,    // total time allowed to read a
+                                    // client's request and send the response
+
+    k_MAX_REQUEST_SIZE    = 4096,   // maximum size of a request that is read
+
+    k_NUMBER_BUFFER_SIZE  = 32      // size of a buffer sufficient to format a
+                                    // 'double' or 64-bit integer
+};
+
+const char k_CONTENT_TYPE[] =
+                "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+const char *const k_GENERATED_SUFFIXES[] = {
+    "_count", "_sum", "_min", "_max"
+};
+    // suffixes appended to the name of a family to form the names of the
+    // samples and gauge families rendered for it
+
+const bsl::size_t k_NUM_GENERATED_SUFFIXES =
+                 sizeof k_GENERATED_SUFFIXES / sizeof *k_GENERATED_SUFFIXES;
+
+inline
+bool isNameCharacter(char c)
+    // Return 'true' if the specified 'c' may appear in an OpenMetrics metric
+    // name, and 'false' otherwise.
+{
+    return ('a' <= c && c <= 'z')
+        || ('A' <= c && c <= 'Z')
+        || ('0' <= c && c <= '9')
+        || '_' == c
+        || ':' == c;
+}
+
+void appendSanitized(bsl::string *result, const bsl::string_view& text)
+    // Append to the specified 'result' the specified 'text', with each
+    // character that is not permitted in an OpenMetrics metric name replaced
+    // by '_'.
+{
+    for (bsl::size_t i = 0; i < text.size(); ++i) {
+        result->push_back(isNameCharacter(text[i]) ? text[i] : '_');
+    }
+}
+
+void appendInteger(bsl::string *result, bsls::Types::Int64 value)
+    // Append to the specified 'result' the decimal representation of the
+    // specified 'value'.
+{
+    char buffer[k_NUMBER_BUFFER_SIZE];
+    const int length = bsl::snprintf(buffer,
+                                     sizeof buffer,
+                                     "%lld",
+                                     static_cast<long long>(value));
+    result->append(buffer, length);
+}
+
+void appendDouble(bsl::string *result, double value)
+    // Append to the specified 'result' the shortest of the representations of
+    // the specified 'value' having 15 or 17 significant digits from which
+    // 'value' can be recovered exactly, or "+Inf", "-Inf", or "NaN" if
+    // 'value' is not finite.
+{
+    if (bsl::isnan(value)) {
+        result->append("NaN");
+        return;                                                       // RETURN
+    }
+    if (bsl::isinf(value)) {
+        result->append(0 < value ? "+Inf" : "-Inf");
+        return;                                                       // RETURN
+    }
+
+    char buffer[k_NUMBER_BUFFER_SIZE];
+    int  length = bsl::snprintf(buffer, sizeof buffer, "%.15g", value);
+    if (bsl::strtod(buffer, 0) != value) {
+        length = bsl::snprintf(buffer, sizeof buffer, "%.17g", value);
+    }
+    result->append(buffer, length);
+}
+
+void appendSample(bsl::string             *result,
+                  const bsl::string&       family,
+                  const char              *suffix,
+                  double                   value)
+    // Append to the specified 'result' a line exposing the specified 'value'
+    // for the sample named by the specified 'family' followed by the
+    // specified 'suffix'.
+{
+    result->append(family);
+    result->append(suffix);
+    result->push_back(' ');
+    appendDouble(result, value);
+    result->push_back('\n');
+}
+
+void appendType(bsl::string        *result,
+                const bsl::string&  family,
+                const char         *suffix,
+                const char         *type)
+    // Append to the specified 'result' the '# TYPE' line of the family named
+    // by the specified 'family' followed by the specified 'suffix', declaring
+    // the specified 'type'.
+{
+    result->append("# TYPE ");
+    result->append(family);
+    result->append(suffix);
+    result->push_back(' ');
+    result->append(type);
+    result->push_back('\n');
+}
+
+bool parsePercentileSuffix(bsl::string_view        *baseName,
+                           bsl::string             *quantile,
+                           const bsl::string_view&  metricName)
+    // If the specified 'metricName' ends in a percentile suffix, ".p"
+    // followed by one or more decimal digits, load into the specified
+    // 'baseName' the part of 'metricName' preceding the suffix, load into the
+    // specified 'quantile' the fraction named by the digits (e.g., "0.99" for
+    // ".p99", and "0.5" for ".p50"), and return 'true'.  Otherwise, return
+    // 'false' with no effect.
+{
+    const bsl::size_t dot = metricName.rfind(".p");
+    if (bsl::string_view::npos == dot || 0 == dot) {
+        return false;                                                 // RETURN
+    }
+    const bsl::string_view digits = metricName.substr(dot + 2);
+    if (digits.empty()) {
+        return false;                                                 // RETURN
+    }
+    bsl::size_t significant = 0;
+    for (bsl::size_t i = 0; i < digits.size(); ++i) {
+        if (digits[i] < '0' || '9' < digits[i]) {
+            return false;                                             // RETURN
+        }
+        if ('0' != digits[i]) {
+            significant = i + 1;
+        }
+    }
+
+    *baseName = metricName.substr(0, dot);
+    quantile->assign("0");
+    if (significant) {
+        quantile->push_back('.');
+        quantile->append(digits.data(), significant);
+    }
+    return true;
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+int remainingMilliseconds(bsls::Types::Int64 deadline)
+    // Return the number of milliseconds (rounded up) from now until the
+    // specified 'deadline', a value of 'bsls::TimeUtil::getTimer', or 0 if
+    // 'deadline' has passed.
+{
+    const bsls::Types::Int64 remaining = deadline - bsls::TimeUtil::getTimer();
+    return 0 < remaining ? static_cast<int>((remaining + 999999) / 1000000)
+                         : 0;
+}
+
+int waitForSocket(int socket, short events, bsls::Types::Int64 deadline)
+    // Wait until one of the specified 'events' is signaled for the specified
+    // 'socket', or until the specified 'deadline' (a value of
+    // 'bsls::TimeUtil::getTimer') has passed.  Return 0 if an event was
+    // signaled, and a non-zero value otherwise.
+{
+    while (true) {
+        const int timeout = remainingMilliseconds(deadline);
+        if (0 == timeout) {
+            return -1;                                                // RETURN
+        }
+
+        struct pollfd pfd;
+        pfd.fd      = socket;
+        pfd.events  = events;
+        pfd.revents = 0;
+
+        const int rc = ::poll(&pfd, 1, timeout);
+        if (0 < rc) {
+            return 0;                                                 // RETURN
+        }
+        if (rc < 0 && EINTR != errno) {
+            return -2;                                                // RETURN
+        }
+    }
+}
+
+int sendAll(int                 socket,
+            const char         *data,
+            bsl::size_t         length,
+            bsls::Types::Int64  deadline)
+    // Write the specified 'length' bytes at the specified 'data' to the
+    // specified connected 'socket', giving up once the specified 'deadline'
+    // (a value of 'bsls::TimeUtil::getTimer') has passed.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+#else
+    const int flags = MSG_DONTWAIT;
+#endif
+
+    while (0 < length) {
+        const ssize_t rc = ::send(socket, data, length, flags);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            if ((EAGAIN == errno || EWOULDBLOCK == errno)
+             && 0 == waitForSocket(socket, POLLOUT, deadline)) {
+                continue;
+            }
+            return -1;                                                // RETURN
+        }
+        data   += rc;
+        length -= static_cast<bsl::size_t>(rc);
+    }
+    return 0;
+}
+
+#endif
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                   // ----------------------------------
+                   // struct OpenMetricsPublisher::Family
+                   // ----------------------------------
+
+// CREATORS
+OpenMetricsPublisher::Family::Family(bslma::Allocator *basicAllocator)
+: d_category(basicAllocator)
+, d_metric(basicAllocator)
+, d_count(0)
+, d_sum(0.0)
+, d_lastCount(0)
+, d_min(0.0)
+, d_max(0.0)
+, d_quantiles(basicAllocator)
+{
+}
+
+OpenMetricsPublisher::Family::Family(const Family&     original,
+                                     bslma::Allocator *basicAllocator)
+: d_category(original.d_category, basicAllocator)
+, d_metric(original.d_metric, basicAllocator)
+, d_count(original.d_count)
+, d_sum(original.d_sum)
+, d_lastCount(original.d_lastCount)
+, d_min(original.d_min)
+, d_max(original.d_max)
+, d_quantiles(original.d_quantiles, basicAllocator)
+{
+}
+
+                         // --------------------------
+                         // class OpenMetricsPublisher
+                         // --------------------------
+
+// PRIVATE MANIPULATORS
+OpenMetricsPublisher::Binding&
+OpenMetricsPublisher::bind(const MetricRecord& record)
+{
+    const MetricDescription *description = record.metricId().description();
+
+    Bindings::iterator it = d_bindings.find(description);
+    if (d_bindings.end() != it) {
+        return it->second;                                            // RETURN
+    }
+
+    const bsl::string_view category(record.metricId().categoryName());
+    const bsl::string_view metric(record.metricId().metricName());
+
+    Binding binding;
+    binding.d_family_p      = 0;
+    binding.d_quantileIndex = -1;
+
+    // A percentile of a metric that has been published is exposed as a
+    // quantile of that metric's family.
+
+    bsl::string_view baseName;
+    bsl::string      quantile(d_allocator_p);
+    if (parsePercentileSuffix(&baseName, &quantile, metric)) {
+        d_nameBuffer.clear();
+        appendFamilyName(&d_nameBuffer, category, baseName);
+
+        FamilyMap::iterator familyIt = d_families.find(d_nameBuffer);
+        if (d_families.end() != familyIt
+         && category == bsl::string_view(familyIt->second.d_category)
+         && baseName == bsl::string_view(familyIt->second.d_metric)) {
+            Family& family = familyIt->second;
+
+            binding.d_family_p      = &family;
+            binding.d_quantileIndex = static_cast<int>(
+                                                    family.d_quantiles.size());
+            family.d_quantiles.resize(family.d_quantiles.size() + 1);
+            family.d_quantiles.back().first  = quantile;
+            family.d_quantiles.back().second = bsl::nan("");
+        }
+    }
+
+    if (!binding.d_family_p) {
+        // A metric whose family name is that of a family created for a
+        // different metric, or that collides with a name generated for an
+        // existing family (or whose generated names collide with an existing
+        // family), is not exposed, rather than merged into that family; its
+        // binding is nevertheless created, so that the comparison is made
+        // only once.
+
+        d_nameBuffer.clear();
+        appendFamilyName(&d_nameBuffer, category, metric);
+
+        FamilyMap::iterator familyIt = d_families.find(d_nameBuffer);
+        if (d_families.end() == familyIt) {
+            if (isFamilyNameAvailable(d_nameBuffer)) {
+                Family& family = d_families[d_nameBuffer];
+                family.d_category.assign(category.data(), category.size());
+                family.d_metric.assign(metric.data(), metric.size());
+
+                binding.d_family_p = &family;
+            }
+        }
+        else if (category == bsl::string_view(familyIt->second.d_category)
+              && metric   == bsl::string_view(familyIt->second.d_metric)) {
+            binding.d_family_p = &familyIt->second;
+        }
+    }
+
+    return d_bindings.insert(bsl::make_pair(description,
+                                            binding)).first->second;
+}
+
+void OpenMetricsPublisher::render()
+{
+    d_renderBuffer.clear();
+
+    for (FamilyMap::const_iterator it  = d_families.begin();
+                                   it != d_families.end();
+                                 ++it) {
+        const bsl::string& name   = it->first;
+        const Family&      family = it->second;
+
+        appendType(&d_renderBuffer, name, "", "summary");
+
+        d_renderBuffer.append(name);
+        d_renderBuffer.append("_count ");
+        appendInteger(&d_renderBuffer, family.d_count);
+        d_renderBuffer.push_back('\n');
+
+        appendSample(&d_renderBuffer, name, "_sum", family.d_sum);
+
+        for (bsl::size_t i = 0; i < family.d_quantiles.size(); ++i) {
+            d_renderBuffer.append(name);
+            d_renderBuffer.append("{quantile=\"");
+            d_renderBuffer.append(family.d_quantiles[i].first);
+            d_renderBuffer.append("\"} ");
+            appendDouble(&d_renderBuffer, family.d_quantiles[i].second);
+            d_renderBuffer.push_back('\n');
+        }
+
+        if (0 < family.d_lastCount) {
+            appendType(&d_renderBuffer, name, "_min", "gauge");
+            appendSample(&d_renderBuffer, name, "_min", family.d_min);
+            appendType(&d_renderBuffer, name, "_max", "gauge");
+            appendSample(&d_renderBuffer, name, "_max", family.d_max);
+        }
+    }
+
+    d_renderBuffer.append("# EOF\n");
+}
+
+void OpenMetricsPublisher::serve()
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    while (!d_stopFlag.loadAcquire()) {
+        struct pollfd pfd;
+        pfd.fd      = d_listenSocket;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        const int rc = ::poll(&pfd, 1, k_POLL_TIMEOUT_MS);
+        if (rc <= 0 || !(pfd.revents & POLLIN)) {
+            continue;
+        }
+
+        const int client = ::accept(d_listenSocket, 0, 0);
+        if (client < 0) {
+            continue;
+        }
+        serveClient(client);
+        ::close(client);
+    }
+#endif
+}
+
+void OpenMetricsPublisher::serveClient(int socket)
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    // Connections are served one at a time, so each is given a short total
+    // deadline for both reading the request and sending the response, after
+    // which it is closed: a slow or idle client cannot hold up other scrapes
+    // for longer than that.
+
+    const bsls::Types::Int64 deadline =
+                                 bsls::TimeUtil::getTimer()
+                               + static_cast<bsls::Types::Int64>(
+                                            k_CLIENT_DEADLINE_MS) * 1000000;
+
+    // Read (and discard) the request: the same exposition is served for any
+    // request, so the request is read only so that the client does not
+    // observe a reset connection.  A client that sends no request is served
+    // once the deadline for reading has passed.
+
+    char        request[k_MAX_REQUEST_SIZE];
+    bsl::size_t length = 0;
+    while (length < sizeof request - 1) {
+        if (0 != waitForSocket(socket, POLLIN, deadline)) {
+            break;
+        }
+        const ssize_t rc = ::recv(socket,
+                                  request + length,
+                                  sizeof request - 1 - length,
+                                  0);
+        if (rc <= 0) {
+            break;
+        }
+        length += static_cast<bsl::size_t>(rc);
+        request[length] = '\0';
+        if (bsl::strstr(request, "\r\n\r\n")) {
+            break;
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_expositionMutex);
+        d_scrapeBuffer.assign(d_exposition);
+    }
+
+    char header[256];
+    const int headerLength = bsl::snprintf(
+                                      header,
+                                      sizeof header,
+                                      "HTTP/1.0 200 OK\r\n"
+                                      "Content-Type: %s\r\n"
+                                      "Content-Length: %llu\r\n"
+                                      "Connection: close\r\n"
+                                      "\r\n",
+                                      k_CONTENT_TYPE,
+                                      static_cast<unsigned long long>(
+                                                     d_scrapeBuffer.size()));
+
+    // Once the deadline has passed, the response is still written as far as
+    // the socket's send buffer allows, but is not waited on.
+
+    if (0 == sendAll(socket, header, headerLength, deadline)) {
+        sendAll(socket,
+                d_scrapeBuffer.data(),
+                d_scrapeBuffer.size(),
+                deadline);
+    }
+#else
+    (void)socket;
+#endif
+}
+
+int OpenMetricsPublisher::writeOutputFile()
+{
+    typedef bdls::FilesystemUtil Util;
+
+    Util::FileDescriptor fd = Util::open(d_tempPath,
+                                         Util::e_OPEN_OR_CREATE,
+                                         Util::e_WRITE_ONLY,
+                                         Util::e_TRUNCATE);
+    if (Util::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const int length = static_cast<int>(d_renderBuffer.size());
+    const int rc     = Util::write(fd, d_renderBuffer.data(), length);
+    Util::close(fd);
+
+    if (rc != length) {
+        Util::remove(d_tempPath);
+        return -2;                                                    // RETURN
+    }
+    if (0 != Util::move(d_tempPath, d_outputPath)) {
+        Util::remove(d_tempPath);
+        return -3;                                                    // RETURN
+    }
+    return 0;
+}
+
+// PRIVATE ACCESSORS
+bool OpenMetricsPublisher::isFamilyNameAvailable(const bsl::string& name) const
+{
+    // The generated suffixes are such that none is a suffix of another, so
+    // 'name' collides only if it is the name of a family followed by a
+    // generated suffix, or if 'name' followed by a generated suffix is the
+    // name of a family.
+
+    bsl::string candidate(d_allocator_p);
+    for (bsl::size_t i = 0; i < k_NUM_GENERATED_SUFFIXES; ++i) {
+        const bsl::string_view suffix(k_GENERATED_SUFFIXES[i]);
+
+        if (suffix.size() < name.size()
+         && 0 == name.compare(name.size() - suffix.size(),
+                              suffix.size(),
+                              suffix.data(),
+                              suffix.size())) {
+            candidate.assign(name, 0, name.size() - suffix.size());
+            if (d_families.end() != d_families.find(candidate)) {
+                return false;                                         // RETURN
+            }
+        }
+
+        candidate.assign(name);
+        candidate.append(suffix.data(), suffix.size());
+        if (d_families.end() != d_families.find(candidate)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// CLASS METHODS
+void OpenMetricsPublisher::appendFamilyName(
+                                         bsl::string             *result,
+                                         const bsl::string_view&  category,
+                                         const bsl::string_view&  name)
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view& first = category.empty() ? name : category;
+    if (!first.empty() && '0' <= first[0] && first[0] <= '9') {
+        result->push_back('_');
+    }
+    appendSanitized(result, category);
+    if (!category.empty()) {
+        result->push_back('_');
+    }
+    appendSanitized(result, name);
+}
+
+// CREATORS
+OpenMetricsPublisher::OpenMetricsPublisher(bslma::Allocator *basicAllocator)
+: d_families(basicAllocator)
+, d_bindings(basicAllocator)
+, d_nameBuffer(basicAllocator)
+, d_renderBuffer(basicAllocator)
+, d_exposition("# EOF\n", basicAllocator)
+, d_outputPath(basicAllocator)
+, d_tempPath(basicAllocator)
+, d_socketPath(basicAllocator)
+, d_scrapeBuffer(basicAllocator)
+, d_listenSocket(-1)
+, d_serverThread()
+, d_stopFlag(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+OpenMetricsPublisher::~OpenMetricsPublisher()
+{
+    stopServing();
+}
+
+// MANIPULATORS
+void OpenMetricsPublisher::publish(const MetricSample& metricValues)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+    for (MetricSample::const_iterator gIt  = metricValues.begin();
+                                      gIt != metricValues.end();
+                                    ++gIt) {
+        for (MetricSampleGroup::const_iterator rIt  = gIt->begin();
+                                               rIt != gIt->end();
+                                             ++rIt) {
+            if (!rIt->metricId().isValid()) {
+                continue;
+            }
+
+            const Binding& binding = bind(*rIt);
+            if (!binding.d_family_p) {
+                continue;
+            }
+            Family& family = *binding.d_family_p;
+
+            if (0 <= binding.d_quantileIndex) {
+                family.d_quantiles[binding.d_quantileIndex].second =
+                                  0 < rIt->count() ? rIt->max() : bsl::nan("");
+                continue;
+            }
+
+            family.d_count     += rIt->count();
+            family.d_sum       += rIt->total();
+            family.d_lastCount  = rIt->count();
+            family.d_min        = rIt->min();
+            family.d_max        = rIt->max();
+        }
+    }
+
+    render();
+
+    if (!d_outputPath.empty()) {
+        writeOutputFile();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> expositionGuard(&d_expositionMutex);
+    d_exposition.swap(d_renderBuffer);
+}
+
+void OpenMetricsPublisher::setOutputFile(const bsl::string_view& path)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+    d_outputPath.assign(path.data(), path.size());
+    d_tempPath.assign(d_outputPath);
+    if (!d_tempPath.empty()) {
+        d_tempPath.append(".tmp");
+    }
+}
+
+int OpenMetricsPublisher::startServing(const bsl::string_view& socketPath)
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+    struct sockaddr_un address;
+    if (0 <= d_listenSocket || socketPath.empty()
+     || sizeof address.sun_path <= socketPath.size()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::memset(&address, 0, sizeof address);
+    address.sun_family = AF_UNIX;
+    bsl::memcpy(address.sun_path, socketPath.data(), socketPath.size());
+
+    // Replace a socket left by a previous process, but nothing else.
+
+    struct stat status;
+    if (0 == ::lstat(address.sun_path, &status)) {
+        if (!S_ISSOCK(status.st_mode)) {
+            return -2;                                                // RETURN
+        }
+        ::unlink(address.sun_path);
+    }
+
+    const int listenSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        return -3;                                                    // RETURN
+    }
+    if (0 != ::bind(listenSocket,
+                    reinterpret_cast<struct sockaddr *>(&address),
+                    sizeof address)) {
+        ::close(listenSocket);
+        return -4;                                                    // RETURN
+    }
+    if (0 != ::listen(listenSocket, SOMAXCONN)) {
+        ::close(listenSocket);
+        ::unlink(address.sun_path);
+        return -5;                                                    // RETURN
+    }
+
+    d_listenSocket = listenSocket;
+    d_stopFlag.storeRelease(false);
+    if (0 != bslmt::ThreadUtil::create(
+                  &d_serverThread,
+                  bdlf::MemFnUtil::memFn(&OpenMetricsPublisher::serve,
+                                         this))) {
+        d_listenSocket = -1;
+        ::close(listenSocket);
+        ::unlink(address.sun_path);
+        return -6;                                                    // RETURN
+    }
+    d_socketPath.assign(address.sun_path);
+    return 0;
+#else
+    (void)socketPath;
+    return -1;
+#endif
+}
+
+void OpenMetricsPublisher::stopServing()
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+    if (d_listenSocket < 0) {
+        return;                                                       // RETURN
+    }
+
+    d_stopFlag.storeRelease(true);
+    bslmt::ThreadUtil::join(d_serverThread);
+
+    ::close(d_listenSocket);
+    ::unlink(d_socketPath.c_str());
+    d_listenSocket = -1;
+    d_socketPath.clear();
+#endif
+}
+
+// ACCESSORS
+bool OpenMetricsPublisher::isServing() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+    return 0 <= d_listenSocket;
+}
+
+void OpenMetricsPublisher::loadExposition(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_expositionMutex);
+    result->assign(d_exposition);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
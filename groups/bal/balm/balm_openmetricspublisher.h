@@ -0,0 +1,446 @@
+// balm_openmetricspublisher.h                                        -*-C++-*-
+#ifndef INCLUDED_BALM_OPENMETRICSPUBLISHER
+#define INCLUDED_BALM_OPENMETRICSPUBLISHER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a publisher of metrics in the OpenMetrics text format.
+//
+//@CLASSES:
+//  balm::OpenMetricsPublisher: publishes metrics for OpenMetrics scrapers
+//
+//@SEE_ALSO: balm_publisher, balm_streampublisher, balm_histogramcollector
+//
+//@DESCRIPTION: This component defines a concrete class,
+// 'balm::OpenMetricsPublisher', that implements the 'balm::Publisher'
+// protocol by rendering the published metrics in the OpenMetrics text
+// exposition format (also accepted by Prometheus):
+//..
+//            ( balm::OpenMetricsPublisher )
+//                           |              ctor
+//                           |              setOutputFile
+//                           |              startServing
+//                           |              stopServing
+//                           |              loadExposition
+//                           V
+//                   ( balm::Publisher )
+//                                          dtor
+//                                          publish
+//..
+// Each call to 'publish' renders the exposition of every metric published so
+// far, and makes it available in one or both of the following ways:
+//
+//: o If an output file has been supplied (see 'setOutputFile'), the
+//:   exposition is written to a temporary file that is then renamed to the
+//:   output file, so that a reader of the output file (e.g., the "textfile"
+//:   collector of a node exporter) never observes a partially written
+//:   exposition.
+//:
+//: o If the publisher is serving (see 'startServing'), a thread owned by the
+//:   publisher accepts connections on a Unix domain socket, and responds to
+//:   each (HTTP) request with the most recently rendered exposition.
+//
+// The serving thread serves connections one at a time, closing each as soon
+// as its response is sent.  A connection is given a short total deadline
+// (half a second) to send its request and receive the response, after which
+// it is closed, so a slow or idle client delays other scrapes by at most that
+// deadline; a scraper that does not send its request promptly, or that reads
+// a large exposition slowly, may therefore receive a truncated response.
+//
+// Scraping does not affect collection: a scrape copies the most recently
+// rendered exposition into a buffer owned by the serving thread, and never
+// accesses a collector, the metrics manager, or a lock held while publishing
+// (other than for the duration of that copy).  Once the buffers have grown to
+// the size of the exposition, neither rendering nor scraping allocates
+// memory.
+//
+///Exposition of Metric Records
+///----------------------------
+// A metric having the category 'C' and name 'N' is exposed as a metric family
+// named 'C_N', in which each character that is not permitted in an OpenMetrics
+// metric name (i.e., other than an ASCII letter, digit, '_', or ':') is
+// replaced by '_'.  Each family is rendered as a 'summary', followed by two
+// 'gauge' families for the minimum and maximum values:
+//..
+//  # TYPE C_N summary
+//  C_N_count <total number of values recorded>
+//  C_N_sum <total of values recorded>
+//  # TYPE C_N_min gauge
+//  C_N_min <minimum value recorded in the last published interval>
+//  # TYPE C_N_max gauge
+//  C_N_max <maximum value recorded in the last published interval>
+//..
+// A 'balm::MetricRecord' describes the values recorded over a single
+// publication interval, whereas OpenMetrics requires the count and sum of a
+// summary to be cumulative.  The publisher therefore accumulates the count and
+// total of each published record, and assumes that the collectors are reset
+// after each publication (as they are by 'balm::MetricsManager::publishAll'
+// by default).  The minimum and maximum are omitted for a metric that had no
+// values in the last published interval.
+//
+// Distinct metrics may have the same family name (e.g., "A-B" and "A.B" in
+// the same category are both exposed as 'C_A_B').  Such metrics are never
+// merged: the family belongs to the first of them to be published, and the
+// others are not exposed.  Similarly, the names generated for a family (its
+// name followed by "_count", "_sum", "_min", or "_max") are reserved: a metric
+// whose family name is a generated name of an existing family (e.g.,
+// "Latency.min" once "Latency" is published), or one of whose generated names
+// is the name of an existing family (e.g., "Latency" once "Latency.min" is
+// published), is not exposed.
+//
+///Percentiles
+///- - - - - -
+// The percentiles of a 'balm::HistogramCollector' are published by a
+// 'balm::CollectorRepository' as separate records whose metric names have a
+// suffix '.pNN' (e.g., "Latency.p99" for the 99th percentile of "Latency";
+// see 'balm_collectorrepository').  A record for a metric whose name has such
+// a suffix, and whose base metric has already been published, is exposed as a
+// quantile of the base metric's summary, rather than as a separate family:
+//..
+//  # TYPE C_Latency summary
+//  C_Latency_count 1000
+//  C_Latency_sum 3490
+//  C_Latency{quantile="0.5"} 1.03125
+//  C_Latency{quantile="0.99"} 1.03125
+//  ...
+//..
+// Note that the histogram buckets themselves are not published (a
+// 'balm::MetricSample' carries only the aggregate records), so the
+// percentiles are exposed as the quantiles of a summary rather than as the
+// buckets of an OpenMetrics histogram.
+//
+///Thread Safety
+///-------------
+// 'balm::OpenMetricsPublisher' is fully *thread-safe*, meaning that all
+// non-creator operations on a given object can be safely invoked
+// simultaneously from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing to a File
+///- - - - - - - - - - - - - - - -
+// In this example we render two metrics and write the exposition to a file.
+// First we define the metric ids.  Note that we create the 'balm::MetricId'
+// objects by hand, but in practice an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager').
+//..
+//  balm::Category          myCategory("MyCategory");
+//  balm::MetricDescription descA(&myCategory, "RequestCount");
+//  balm::MetricDescription descB(&myCategory, "Latency");
+//
+//  balm::MetricId metricA(&descA);
+//  balm::MetricId metricB(&descB);
+//..
+// Next we create a 'balm::OpenMetricsPublisher' and supply the file to which
+// it should write the exposition.  In practice the publisher would be added
+// to a 'balm::MetricsManager' (see 'balm_metricsmanager'):
+//..
+//  bsl::string path = "myapp.prom";
+//
+//  balm::OpenMetricsPublisher publisher;
+//  publisher.setOutputFile(path);
+//..
+// Then, we publish a sample containing some records:
+//..
+//  bsl::vector<balm::MetricRecord> records;
+//  records.push_back(balm::MetricRecord(metricA, 5, 5.0, 1.0, 1.0));
+//  records.push_back(balm::MetricRecord(metricB, 2, 7.0, 3.0, 4.0));
+//
+//  balm::MetricSample sample;
+//  sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(), 0));
+//  sample.appendGroup(records.data(),
+//                     static_cast<int>(records.size()),
+//                     bsls::TimeInterval(5, 0));
+//
+//  publisher.publish(sample);
+//..
+// Finally, we verify the exposition, which is identical to the contents of
+// the file:
+//..
+//  bsl::string exposition;
+//  publisher.loadExposition(&exposition);
+//
+//  assert(exposition ==
+//         "# TYPE MyCategory_Latency summary\n"
+//         "MyCategory_Latency_count 2\n"
+//         "MyCategory_Latency_sum 7\n"
+//         "# TYPE MyCategory_Latency_min gauge\n"
+//         "MyCategory_Latency_min 3\n"
+//         "# TYPE MyCategory_Latency_max gauge\n"
+//         "MyCategory_Latency_max 4\n"
+//         "# TYPE MyCategory_RequestCount summary\n"
+//         "MyCategory_RequestCount_count 5\n"
+//         "MyCategory_RequestCount_sum 5\n"
+//         "# TYPE MyCategory_RequestCount_min gauge\n"
+//         "MyCategory_RequestCount_min 1\n"
+//         "# TYPE MyCategory_RequestCount_max gauge\n"
+//         "MyCategory_RequestCount_max 1\n"
+//         "# EOF\n");
+//..
+// Note that families are rendered in order of their names.
+//
+///Example 2: Serving on a Unix Domain Socket
+/// - - - - - - - - - - - - - - - - - - - - -
+// On Unix platforms the publisher can instead serve the exposition to
+// scrapers that connect to a Unix domain socket, such as a local metrics
+// agent or 'curl --unix-socket':
+//..
+//  if (0 == publisher.startServing("/tmp/myapp.metrics.sock")) {
+//      // ... publish, and serve, metrics until shutting down ...
+//
+//      publisher.stopServing();
+//  }
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_publisher.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+class MetricDescription;
+class MetricRecord;
+class MetricSample;
+
+                         // ==========================
+                         // class OpenMetricsPublisher
+                         // ==========================
+
+class OpenMetricsPublisher : public Publisher {
+    // This class provides an implementation of the 'Publisher' protocol that
+    // renders the published metrics in the OpenMetrics text exposition
+    // format, and makes that exposition available in a file and/or on a Unix
+    // domain socket.
+
+    // PRIVATE TYPES
+    struct Family {
+        // This 'struct' holds the published state of a metric family.
+
+        // PUBLIC DATA
+        bsl::string                            d_category;   // category and
+        bsl::string                            d_metric;     // name of the
+                                                             // metric, as
+                                                             // published
+
+        bsls::Types::Int64                     d_count;      // cumulative
+        double                                 d_sum;        // cumulative
+        int                                    d_lastCount;  // last interval
+        double                                 d_min;        // last interval
+        double                                 d_max;        // last interval
+        bsl::vector<bsl::pair<bsl::string, double> >
+                                               d_quantiles;  // label, value
+                                                             // (last
+                                                             // interval)
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Family, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        explicit Family(bslma::Allocator *basicAllocator = 0);
+            // Create a family having an empty category and metric name, no
+            // values, and no quantiles.  Optionally specify a
+            // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+            // 0, the currently installed default allocator is used.
+
+        Family(const Family& original, bslma::Allocator *basicAllocator = 0);
+            // Create a family having the value of the specified 'original'
+            // family.  Optionally specify a 'basicAllocator' used to supply
+            // memory.  If 'basicAllocator' is 0, the currently installed
+            // default allocator is used.
+    };
+
+    typedef bsl::map<bsl::string, Family> FamilyMap;
+        // 'FamilyMap' is an alias for a map from the name of a metric family
+        // to its state.  Note that the ordering of this map is the order in
+        // which families are rendered.
+
+    struct Binding {
+        // This 'struct' binds a metric to the family (and, for a percentile,
+        // the quantile of that family) under which it is exposed.
+
+        Family *d_family_p;       // family of the metric (held, not
+                                  // owned), or 0 if the metric is not
+                                  // exposed
+        int     d_quantileIndex;  // index in 'd_family_p->d_quantiles', or -1
+                                  // if the metric is not a percentile
+    };
+
+    typedef bsl::unordered_map<const MetricDescription *, Binding> Bindings;
+        // 'Bindings' is an alias for a map from the description of a metric
+        // to the family under which it is exposed.
+
+    // DATA
+    FamilyMap                  d_families;        // families, by name
+    Bindings                   d_bindings;        // metric -> family
+    bsl::string                d_nameBuffer;      // scratch family name
+    bsl::string                d_renderBuffer;    // exposition being rendered
+    bsl::string                d_exposition;      // last rendered exposition
+    bsl::string                d_outputPath;      // output file, or empty
+    bsl::string                d_tempPath;        // temporary output file
+    bsl::string                d_socketPath;      // socket path, if serving
+    bsl::string                d_scrapeBuffer;    // copy of 'd_exposition'
+                                                  // being served
+    int                        d_listenSocket;    // listening socket, or -1
+    bslmt::ThreadUtil::Handle  d_serverThread;    // serving thread
+    bsls::AtomicBool           d_stopFlag;        // 'true' to stop serving
+    mutable bslmt::Mutex       d_publishMutex;    // serializes 'publish', and
+                                                  // guards all but the
+                                                  // exposition
+    mutable bslmt::Mutex       d_expositionMutex; // guards 'd_exposition'
+    bslma::Allocator          *d_allocator_p;     // allocator (held, not
+                                                  // owned)
+
+    // NOT IMPLEMENTED
+    OpenMetricsPublisher(const OpenMetricsPublisher&);
+    OpenMetricsPublisher& operator=(const OpenMetricsPublisher&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    Binding& bind(const MetricRecord& record);
+        // Return a reference to the binding of the metric of the specified
+        // 'record', creating the binding (and the family of the metric, if
+        // it does not exist) if the metric has not been published before.
+        // The family of the binding is 0 if the family name of the metric is
+        // that of a family created for a different metric, or if that name
+        // is not available (see 'isFamilyNameAvailable').  The behavior is
+        // undefined unless the calling thread has locked 'd_publishMutex'.
+
+    void render();
+        // Render the exposition of the families of this publisher into
+        // 'd_renderBuffer'.  The behavior is undefined unless the calling
+        // thread has locked 'd_publishMutex'.
+
+    void serve();
+        // Accept connections on 'd_listenSocket', and respond to each with
+        // the exposition, until 'd_stopFlag' is 'true'.  Note that this
+        // method is the entry point of the serving thread.
+
+    void serveClient(int socket);
+        // Read a request from the specified connected 'socket', and write the
+        // exposition to 'socket' as an HTTP response, abandoning either once
+        // the deadline for serving the connection has passed.
+
+    int writeOutputFile();
+        // Atomically replace the output file with the contents of
+        // 'd_renderBuffer'.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless the calling thread
+        // has locked 'd_publishMutex' and 'd_outputPath' is not empty.
+
+    // PRIVATE ACCESSORS
+    bool isFamilyNameAvailable(const bsl::string& name) const;
+        // Return 'true' if a family having the specified 'name' may be
+        // created, and 'false' if 'name' is, or is a name generated for (by
+        // appending "_count", "_sum", "_min", or "_max"), an existing family,
+        // or if a name generated for 'name' is that of an existing family.
+        // The behavior is undefined unless the calling thread has locked
+        // 'd_publishMutex'.
+
+  public:
+    // PUBLIC TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(OpenMetricsPublisher,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static void appendFamilyName(bsl::string             *result,
+                                 const bsl::string_view&  category,
+                                 const bsl::string_view&  name);
+        // Append to the specified 'result' the name of the metric family for
+        // a metric having the specified 'category' and 'name': 'category'
+        // and 'name' joined by '_', with each character that is not
+        // permitted in an OpenMetrics metric name replaced by '_'.  If the
+        // name would begin with a digit, it is prefixed with '_'.
+
+    // CREATORS
+    explicit OpenMetricsPublisher(bslma::Allocator *basicAllocator = 0);
+        // Create a publisher that renders the exposition of the metrics
+        // published to it, but neither writes it to a file nor serves it.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    virtual ~OpenMetricsPublisher();
+        // Stop serving (if serving), and destroy this publisher.
+
+    // MANIPULATORS
+    virtual void publish(const MetricSample& metricValues);
+        // Update the state of the metric families of this publisher with the
+        // records in the specified 'metricValues', render the exposition of
+        // all families, and make it available to scrapers and (if an output
+        // file has been supplied) write it to the output file.
+
+    void setOutputFile(const bsl::string_view& path);
+        // Write the exposition to the file at the specified 'path' on each
+        // subsequent call to 'publish', or stop writing the exposition to a
+        // file if 'path' is empty.  Note that the exposition is written to
+        // 'path' followed by ".tmp", which is then renamed to 'path', so the
+        // directory of 'path' must be writable.
+
+    int startServing(const bsl::string_view& socketPath);
+        // Create a Unix domain socket at the specified 'socketPath', and
+        // start a thread that serves the exposition to each connection on
+        // that socket.  If a socket already exists at 'socketPath' it is
+        // replaced.  Return 0 on success, and a non-zero value (without
+        // effect) if this publisher is already serving, if the socket cannot
+        // be created, or if Unix domain sockets are not supported on this
+        // platform.
+
+    void stopServing();
+        // Stop the thread serving the exposition (if any), and remove the
+        // socket at which it was served.  This method has no effect if this
+        // publisher is not serving.
+
+    // ACCESSORS
+    bool isServing() const;
+        // Return 'true' if this publisher is serving the exposition on a Unix
+        // domain socket, and 'false' otherwise.
+
+    void loadExposition(bsl::string *result) const;
+        // Load into the specified 'result' the most recently rendered
+        // exposition, or an exposition without metrics if 'publish' has not
+        // been called.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1103 @@
+// balm_openmetricspublisher.t.cpp                                    -*-C++-*-
+#include <balm_openmetricspublisher.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsample.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::OpenMetricsPublisher' is a mechanism that renders the published
+// metric records in the OpenMetrics text format.  Ensure that family names
+// are sanitized, that counts and sums accumulate across publications, that
+// percentile records are rendered as quantiles of their base metric, and that
+// the exposition is written atomically to a file and served on a Unix domain
+// socket.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static void appendFamilyName(string *, string_view, string_view);
+//
+// CREATORS
+// [ 1] OpenMetricsPublisher(bslma::Allocator *basicAllocator = 0);
+// [ 1] ~OpenMetricsPublisher();
+//
+// MANIPULATORS
+// [ 3] virtual void publish(const MetricSample& metricValues);
+// [ 5] void setOutputFile(const bsl::string_view& path);
+// [ 6] int startServing(const bsl::string_view& socketPath);
+// [ 6] void stopServing();
+//
+// ACCESSORS
+// [ 6] bool isServing() const;
+// [ 3] void loadExposition(bsl::string *result) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] PERCENTILE RECORDS
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::OpenMetricsPublisher Obj;
+typedef balm::MetricRecord         Rec;
+typedef balm::MetricId             Id;
+typedef balm::MetricDescription    Desc;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        // Unix domain socket paths are short, so prefer '/tmp' to 'TMPDIR'.
+
+        tmpPath.assign("/tmp");
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "balm_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+void publishRecords(Obj *publisher, const bsl::vector<Rec>& records)
+    // Publish to the specified 'publisher' a sample having a single group
+    // holding the specified 'records'.
+{
+    balm::MetricSample sample;
+    sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(), 0));
+    sample.appendGroup(records.data(),
+                       static_cast<int>(records.size()),
+                       bsls::TimeInterval(1, 0));
+    publisher->publish(sample);
+}
+
+bsl::string readFile(const bsl::string& path)
+    // Return the contents of the file at the specified 'path'.
+{
+    bsl::ifstream stream(path.c_str(), bsl::ios::binary);
+    return bsl::string(bsl::istreambuf_iterator<char>(stream),
+                       bsl::istreambuf_iterator<char>());
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+int scrape(bsl::string *response, const bsl::string& socketPath)
+    // Connect to the Unix domain socket at the specified 'socketPath', send
+    // an HTTP request, and load the complete response into the specified
+    // 'response'.  Return 0 on success, and a non-zero value otherwise.
+{
+    struct sockaddr_un address;
+    bsl::memset(&address, 0, sizeof address);
+    address.sun_family = AF_UNIX;
+    bsl::strncpy(address.sun_path,
+                 socketPath.c_str(),
+                 sizeof address.sun_path - 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != ::connect(fd,
+                       reinterpret_cast<struct sockaddr *>(&address),
+                       sizeof address)) {
+        ::close(fd);
+        return -2;                                                    // RETURN
+    }
+
+    const char request[] = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    if (::send(fd, request, sizeof request - 1, 0) !=
+                                    static_cast<ssize_t>(sizeof request - 1)) {
+        ::close(fd);
+        return -3;                                                    // RETURN
+    }
+
+    response->clear();
+    char    buffer[1024];
+    ssize_t rc;
+    while (0 < (rc = ::recv(fd, buffer, sizeof buffer, 0))) {
+        response->append(buffer, rc);
+    }
+    ::close(fd);
+    return rc < 0 ? -4 : 0;
+}
+#endif
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test");
+
+    balm::Category myCategory("MyCategory");
+    Desc           descA(&myCategory, "A");
+    Desc           descB(&myCategory, "B");
+    const Id       METRIC_A(&descA);
+    const Id       METRIC_B(&descB);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //:  1 The usage example provided in the component header file
+        //:    compiles, links, and runs as shown.
+        //
+        // Plan:
+        //:  1 Incorporate usage example from header into test driver, remove
+        //:    leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:    Write the output file in a temporary directory.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING USAGE EXAMPLE"
+                          << "\n=====================" << endl;
+
+        TempDirectoryGuard tempDir;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing to a File
+///- - - - - - - - - - - - - - - -
+// In this example we render two metrics and write the exposition to a file.
+// First we define the metric ids.  Note that we create the 'balm::MetricId'
+// objects by hand, but in practice an id should be obtained from a
+// 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager').
+//..
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription descA(&myCategory, "RequestCount");
+    balm::MetricDescription descB(&myCategory, "Latency");
+
+    balm::MetricId metricA(&descA);
+    balm::MetricId metricB(&descB);
+//..
+// Next we create a 'balm::OpenMetricsPublisher' and supply the file to which
+// it should write the exposition.  In practice the publisher would be added
+// to a 'balm::MetricsManager' (see 'balm_metricsmanager'):
+//..
+    bsl::string path = "myapp.prom";
+//..
+        path = tempDir.getTempDirName() + "/" + path;
+//..
+    balm::OpenMetricsPublisher publisher;
+    publisher.setOutputFile(path);
+//..
+// Then, we publish a sample containing some records:
+//..
+    bsl::vector<balm::MetricRecord> records;
+    records.push_back(balm::MetricRecord(metricA, 5, 5.0, 1.0, 1.0));
+    records.push_back(balm::MetricRecord(metricB, 2, 7.0, 3.0, 4.0));
+
+    balm::MetricSample sample;
+    sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(), 0));
+    sample.appendGroup(records.data(),
+                       static_cast<int>(records.size()),
+                       bsls::TimeInterval(5, 0));
+
+    publisher.publish(sample);
+//..
+// Finally, we verify the exposition, which is identical to the contents of
+// the file:
+//..
+    bsl::string exposition;
+    publisher.loadExposition(&exposition);
+
+    ASSERT(exposition ==
+           "# TYPE MyCategory_Latency summary\n"
+           "MyCategory_Latency_count 2\n"
+           "MyCategory_Latency_sum 7\n"
+           "# TYPE MyCategory_Latency_min gauge\n"
+           "MyCategory_Latency_min 3\n"
+           "# TYPE MyCategory_Latency_max gauge\n"
+           "MyCategory_Latency_max 4\n"
+           "# TYPE MyCategory_RequestCount summary\n"
+           "MyCategory_RequestCount_count 5\n"
+           "MyCategory_RequestCount_sum 5\n"
+           "# TYPE MyCategory_RequestCount_min gauge\n"
+           "MyCategory_RequestCount_min 1\n"
+           "# TYPE MyCategory_RequestCount_max gauge\n"
+           "MyCategory_RequestCount_max 1\n"
+           "# EOF\n");
+//..
+// Note that families are rendered in order of their names.
+
+        ASSERT(exposition == readFile(path));
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'startServing' AND 'stopServing'
+        //
+        // Concerns:
+        //:  1 'startServing' creates a socket at the supplied path, and each
+        //:    connection to it receives an HTTP response whose body is the
+        //:    most recently rendered exposition.
+        //:
+        //:  2 'startServing' fails if the publisher is already serving, or if
+        //:    a file that is not a socket exists at the path, and replaces a
+        //:    stale socket.
+        //:
+        //:  3 'stopServing' removes the socket, and has no effect if the
+        //:    publisher is not serving; the publisher may serve again.
+        //:
+        //:  4 The destructor stops serving.
+        //:
+        //:  5 A client that does not complete its request is answered and
+        //:    closed once the deadline for serving it has passed, so that it
+        //:    does not stall the scrapes of other clients.
+        //
+        // Plan:
+        //:  1 Start serving in a temporary directory, publish, and scrape the
+        //:    socket; verify the response.  Publish again and verify that a
+        //:    new scrape reflects the new exposition.  (C-1)
+        //:
+        //:  2 Call 'startServing' while serving, and on a path to a regular
+        //:    file, and verify the result.  Serve on a path at which a socket
+        //:    was left, and verify that it succeeds.  (C-2)
+        //:
+        //:  3 Stop serving, and verify that the socket is removed.  (C-3..4)
+        //:
+        //:  4 Connect, and send an incomplete request without closing the
+        //:    connection.  Scrape the socket from a second connection, and
+        //:    verify that the scrape succeeds within a few times the deadline,
+        //:    and that the first connection is answered and closed.  (C-5)
+        //
+        // Testing:
+        //   int startServing(const bsl::string_view& socketPath);
+        //   void stopServing();
+        //   bool isServing() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'startServing' AND 'stopServing'"
+                          << "\n========================================"
+                          << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        TempDirectoryGuard tempDir;
+        const bsl::string  socketPath = tempDir.getTempDirName() + "/sock";
+        const bsl::string  filePath   = tempDir.getTempDirName() + "/file";
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isServing());
+            mX.stopServing();
+
+            ASSERT(0     == mX.startServing(socketPath));
+            ASSERT(true  == X.isServing());
+            ASSERT(bdls::FilesystemUtil::exists(socketPath));
+            ASSERT(0     != mX.startServing(socketPath));
+
+            bsl::string response;
+            ASSERT(0 == scrape(&response, socketPath));
+            ASSERTV(response,
+                    0 == response.find("HTTP/1.0 200 OK\r\n"));
+            ASSERTV(response,
+                    bsl::string::npos != response.find(
+                        "Content-Type: application/openmetrics-text; "
+                        "version=1.0.0; charset=utf-8\r\n"));
+            ASSERTV(response,
+                    bsl::string::npos != response.find(
+                                                  "Content-Length: 6\r\n"));
+            ASSERTV(response,
+                    response.size() - 10 == response.find("\r\n\r\n# EOF\n"));
+
+            bsl::vector<Rec> records;
+            records.push_back(Rec(METRIC_A, 1, 2.0, 2.0, 2.0));
+            publishRecords(&mX, records);
+
+            bsl::string exposition;
+            X.loadExposition(&exposition);
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(0 == scrape(&response, socketPath));
+                const bsl::size_t body = response.find("\r\n\r\n");
+                ASSERT(bsl::string::npos != body);
+                ASSERTV(response, exposition == response.substr(body + 4));
+            }
+
+            // A client that does not complete its request does not stall
+            // other scrapes.
+
+            {
+                int idle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+                struct sockaddr_un address;
+                bsl::memset(&address, 0, sizeof address);
+                address.sun_family = AF_UNIX;
+                bsl::strcpy(address.sun_path, socketPath.c_str());
+                ASSERT(0 == ::connect(
+                                idle,
+                                reinterpret_cast<struct sockaddr *>(&address),
+                                sizeof address));
+                ASSERT(3 == ::send(idle, "GET", 3, 0));
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                ASSERT(0 == scrape(&response, socketPath));
+                const bsls::Types::Int64 elapsed =
+                                          bsls::TimeUtil::getTimer() - start;
+                ASSERTV(response, 0 == response.find("HTTP/1.0 200 OK\r\n"));
+                ASSERTV(elapsed, elapsed < 3000000000LL);
+
+                bsl::string idleResponse;
+                char        buffer[1024];
+                ssize_t     rc;
+                while (0 < (rc = ::recv(idle, buffer, sizeof buffer, 0))) {
+                    idleResponse.append(buffer, rc);
+                }
+                ASSERTV(rc, 0 == rc);
+                ASSERTV(idleResponse,
+                        0 == idleResponse.find("HTTP/1.0 200 OK\r\n"));
+                ::close(idle);
+            }
+
+            mX.stopServing();
+            ASSERT(false == X.isServing());
+            ASSERT(false == bdls::FilesystemUtil::exists(socketPath));
+            mX.stopServing();
+
+            // A regular file is not replaced.
+
+            {
+                bsl::ofstream file(filePath.c_str());
+                file << "data";
+            }
+            ASSERT(0     != mX.startServing(filePath));
+            ASSERT(false == X.isServing());
+            ASSERT("data" == readFile(filePath));
+
+            // A stale socket is replaced.
+
+            int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            struct sockaddr_un address;
+            bsl::memset(&address, 0, sizeof address);
+            address.sun_family = AF_UNIX;
+            bsl::strcpy(address.sun_path, socketPath.c_str());
+            ASSERT(0 == ::bind(fd,
+                               reinterpret_cast<struct sockaddr *>(&address),
+                               sizeof address));
+            ::close(fd);
+            ASSERT(bdls::FilesystemUtil::exists(socketPath));
+
+            ASSERT(0    == mX.startServing(socketPath));
+            ASSERT(true == X.isServing());
+            ASSERT(0    == scrape(&response, socketPath));
+            ASSERTV(response, 0 == response.find("HTTP/1.0 200 OK\r\n"));
+        }
+        ASSERT(false == bdls::FilesystemUtil::exists(socketPath));
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'setOutputFile'
+        //
+        // Concerns:
+        //:  1 After an output file is supplied, each publication replaces the
+        //:    contents of the file with the exposition.
+        //:
+        //:  2 No temporary file is left after a publication.
+        //:
+        //:  3 Supplying an empty path stops writing the file.
+        //:
+        //:  4 A failure to write the file does not prevent the exposition from
+        //:    being rendered.
+        //
+        // Plan:
+        //:  1 Publish twice to a file in a temporary directory, and verify the
+        //:    contents of the file and the absence of the temporary file.
+        //:    (C-1..2)
+        //:
+        //:  2 Supply an empty path, publish, and verify that the file is
+        //:    unchanged.  (C-3)
+        //:
+        //:  3 Supply a path in a directory that does not exist, publish, and
+        //:    verify the exposition.  (C-4)
+        //
+        // Testing:
+        //   void setOutputFile(const bsl::string_view& path);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'setOutputFile'"
+                          << "\n=======================" << endl;
+
+        TempDirectoryGuard tempDir;
+        const bsl::string  path = tempDir.getTempDirName() + "/metrics.prom";
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        mX.setOutputFile(path);
+        ASSERT(false == bdls::FilesystemUtil::exists(path));
+
+        bsl::vector<Rec> records;
+        records.push_back(Rec(METRIC_A, 1, 2.0, 2.0, 2.0));
+        publishRecords(&mX, records);
+
+        bsl::string exposition;
+        X.loadExposition(&exposition);
+        ASSERTV(readFile(path), exposition == readFile(path));
+        ASSERT(false == bdls::FilesystemUtil::exists(path + ".tmp"));
+
+        publishRecords(&mX, records);
+
+        const bsl::string previous(exposition);
+        X.loadExposition(&exposition);
+        ASSERT(previous != exposition);
+        ASSERTV(readFile(path), exposition == readFile(path));
+        ASSERT(false == bdls::FilesystemUtil::exists(path + ".tmp"));
+
+        mX.setOutputFile("");
+        publishRecords(&mX, records);
+        ASSERT(exposition == readFile(path));
+
+        mX.setOutputFile(tempDir.getTempDirName() + "/missing/metrics.prom");
+        publishRecords(&mX, records);
+
+        X.loadExposition(&exposition);
+        ASSERTV(exposition,
+                bsl::string::npos != exposition.find(
+                                                   "MyCategory_A_count 4\n"));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING PERCENTILE RECORDS
+        //
+        // Concerns:
+        //:  1 A record whose metric name ends in ".p" followed by digits, and
+        //:    whose base metric has been published, is rendered as a quantile
+        //:    of the base metric's summary, labeled with the corresponding
+        //:    fraction.
+        //:
+        //:  2 A quantile whose record has no values is rendered as 'NaN'.
+        //:
+        //:  3 A record whose name resembles a percentile, but whose base
+        //:    metric has not been published, is rendered as a family.
+        //:
+        //:  4 A record whose name resembles a percentile of a metric whose
+        //:    family belongs to a different metric is not rendered as a
+        //:    quantile of that family.
+        //:
+        //:  5 Memory for families and their quantiles is supplied by the
+        //:    object allocator, and the default allocator is not used.
+        //
+        // Plan:
+        //:  1 Publish records for a base metric and its percentiles (in the
+        //:    order in which a 'balm::CollectorRepository' publishes them),
+        //:    and verify the exposition.  (C-1)
+        //:
+        //:  2 Publish empty percentile records and verify the exposition.
+        //:    (C-2)
+        //:
+        //:  3 Publish a record named "X.p5" with no "X" and verify the
+        //:    exposition.  (C-3)
+        //:
+        //:  4 Publish records for "C-D" and "C_D.p50", and verify that the
+        //:    latter is rendered as a family.  (C-4)
+        //:
+        //:  5 Install a test allocator as the default allocator, publish a
+        //:    base metric and its percentiles, and verify that the default
+        //:    allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   PERCENTILE RECORDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PERCENTILE RECORDS"
+                          << "\n==========================" << endl;
+
+        Desc p50(&myCategory, "A.p50");
+        Desc p99(&myCategory, "A.p99");
+        Desc p999(&myCategory, "A.p999");
+        Desc p100(&myCategory, "A.p100");
+        Desc orphan(&myCategory, "X.p5");
+        Desc notPercentile(&myCategory, "A.pX");
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        bsl::vector<Rec> records;
+        records.push_back(Rec(METRIC_A, 4, 10.0, 1.0, 4.0));
+        records.push_back(Rec(Id(&p50),  1, 2.0, 2.0, 2.0));
+        records.push_back(Rec(Id(&p99),  1, 4.0, 4.0, 4.0));
+        records.push_back(Rec(Id(&p999), 1, 4.0, 4.0, 4.0));
+        records.push_back(Rec(Id(&p100), 1, 4.0, 4.0, 4.0));
+        records.push_back(Rec(Id(&orphan), 1, 1.0, 1.0, 1.0));
+        records.push_back(Rec(Id(&notPercentile), 1, 1.0, 1.0, 1.0));
+        publishRecords(&mX, records);
+
+        bsl::string exposition;
+        X.loadExposition(&exposition);
+        ASSERTV(exposition, exposition ==
+                "# TYPE MyCategory_A summary\n"
+                "MyCategory_A_count 4\n"
+                "MyCategory_A_sum 10\n"
+                "MyCategory_A{quantile=\"0.5\"} 2\n"
+                "MyCategory_A{quantile=\"0.99\"} 4\n"
+                "MyCategory_A{quantile=\"0.999\"} 4\n"
+                "MyCategory_A{quantile=\"0.1\"} 4\n"
+                "# TYPE MyCategory_A_min gauge\n"
+                "MyCategory_A_min 1\n"
+                "# TYPE MyCategory_A_max gauge\n"
+                "MyCategory_A_max 4\n"
+                "# TYPE MyCategory_A_pX summary\n"
+                "MyCategory_A_pX_count 1\n"
+                "MyCategory_A_pX_sum 1\n"
+                "# TYPE MyCategory_A_pX_min gauge\n"
+                "MyCategory_A_pX_min 1\n"
+                "# TYPE MyCategory_A_pX_max gauge\n"
+                "MyCategory_A_pX_max 1\n"
+                "# TYPE MyCategory_X_p5 summary\n"
+                "MyCategory_X_p5_count 1\n"
+                "MyCategory_X_p5_sum 1\n"
+                "# TYPE MyCategory_X_p5_min gauge\n"
+                "MyCategory_X_p5_min 1\n"
+                "# TYPE MyCategory_X_p5_max gauge\n"
+                "MyCategory_X_p5_max 1\n"
+                "# EOF\n");
+
+        records.clear();
+        records.push_back(Rec(METRIC_A));
+        records.push_back(Rec(Id(&p50)));
+        records.push_back(Rec(Id(&p99)));
+        publishRecords(&mX, records);
+
+        X.loadExposition(&exposition);
+        ASSERTV(exposition, 0 == exposition.find(
+                "# TYPE MyCategory_A summary\n"
+                "MyCategory_A_count 4\n"
+                "MyCategory_A_sum 10\n"
+                "MyCategory_A{quantile=\"0.5\"} NaN\n"
+                "MyCategory_A{quantile=\"0.99\"} NaN\n"
+                "MyCategory_A{quantile=\"0.999\"} 4\n"
+                "MyCategory_A{quantile=\"0.1\"} 4\n"
+                "# TYPE MyCategory_A_pX summary\n"));
+
+        if (verbose) cout << "\tTesting a percentile of another metric."
+                          << endl;
+        {
+            Desc descCD(&myCategory, "C-D");
+            Desc descCDp50(&myCategory, "C_D.p50");
+
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            records.clear();
+            records.push_back(Rec(Id(&descCD),    1, 1.0, 1.0, 1.0));
+            records.push_back(Rec(Id(&descCDp50), 1, 2.0, 2.0, 2.0));
+            publishRecords(&mY, records);
+
+            Y.loadExposition(&exposition);
+            ASSERTV(exposition, exposition ==
+                    "# TYPE MyCategory_C_D summary\n"
+                    "MyCategory_C_D_count 1\n"
+                    "MyCategory_C_D_sum 1\n"
+                    "# TYPE MyCategory_C_D_min gauge\n"
+                    "MyCategory_C_D_min 1\n"
+                    "# TYPE MyCategory_C_D_max gauge\n"
+                    "MyCategory_C_D_max 1\n"
+                    "# TYPE MyCategory_C_D_p50 summary\n"
+                    "MyCategory_C_D_p50_count 1\n"
+                    "MyCategory_C_D_p50_sum 2\n"
+                    "# TYPE MyCategory_C_D_p50_min gauge\n"
+                    "MyCategory_C_D_p50_min 2\n"
+                    "# TYPE MyCategory_C_D_p50_max gauge\n"
+                    "MyCategory_C_D_p50_max 2\n"
+                    "# EOF\n");
+        }
+
+        if (verbose) cout << "\tTesting the default allocator is not used."
+                          << endl;
+        {
+            bslma::TestAllocator         da("default");
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            {
+                Obj mY(&ta);  const Obj& Y = mY;
+
+                bsl::vector<Rec> records(&ta);
+                records.push_back(Rec(METRIC_A, 4, 10.0, 1.0, 4.0));
+                records.push_back(Rec(Id(&p50),  1, 2.0, 2.0, 2.0));
+                records.push_back(Rec(Id(&p99),  1, 4.0, 4.0, 4.0));
+                records.push_back(Rec(Id(&p999), 1, 4.0, 4.0, 4.0));
+                records.push_back(Rec(Id(&p100), 1, 4.0, 4.0, 4.0));
+
+                for (int i = 0; i < 2; ++i) {
+                    balm::MetricSample sample(&ta);
+                    sample.appendGroup(records.data(),
+                                       static_cast<int>(records.size()),
+                                       bsls::TimeInterval(1, 0));
+                    mY.publish(sample);
+                }
+
+                bsl::string exposition(&ta);
+                Y.loadExposition(&exposition);
+                ASSERTV(exposition, bsl::string::npos != exposition.find(
+                                 "MyCategory_A{quantile=\"0.999\"} 4\n"));
+            }
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'publish'
+        //
+        // Concerns:
+        //:  1 Before any publication, the exposition has no metrics.
+        //:
+        //:  2 Each published metric is rendered as a summary having its
+        //:    count and sum, and gauges for its minimum and maximum.
+        //:
+        //:  3 Counts and sums accumulate over publications, whereas the
+        //:    minimum and maximum are those of the last publication, and are
+        //:    omitted if the metric had no values in that publication.
+        //:
+        //:  4 Records in multiple groups are published, and records having
+        //:    an invalid id are ignored.
+        //:
+        //:  5 Values are rendered so that they can be recovered exactly, and
+        //:    non-finite values are rendered as OpenMetrics requires.
+        //:
+        //:  6 Distinct metrics having the same family name are not merged:
+        //:    only the first of them to be published is rendered.
+        //:
+        //:  7 The names generated for a family are reserved: a metric whose
+        //:    family name is a generated name of a published family, or one
+        //:    of whose generated names is a published family, is not
+        //:    rendered, so that no family is declared twice.
+        //
+        // Plan:
+        //:  1 Verify the exposition of a default-constructed object.  (C-1)
+        //:
+        //:  2 Publish samples and verify the rendered exposition.  (C-2..5)
+        //:
+        //:  3 Publish, twice, records for metrics named "C-D" and "C.D", and
+        //:    for "C-D" in a second category, and verify the exposition.
+        //:    (C-6)
+        //:
+        //:  4 Publish, twice, records for "Latency" followed by metrics whose
+        //:    family names are each of its generated names, and, using a
+        //:    second object, for "X.min" followed by "X" and "X.min_count".
+        //:    Verify that only the first metric of each object is rendered.
+        //:    (C-7)
+        //
+        // Testing:
+        //   virtual void publish(const MetricSample& metricValues);
+        //   void loadExposition(bsl::string *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publish'"
+                          << "\n=================" << endl;
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        bsl::string exposition(&ta);
+        X.loadExposition(&exposition);
+        ASSERT("# EOF\n" == exposition);
+
+        bsl::vector<Rec> records;
+        records.push_back(Rec(METRIC_A, 2, 3.5, 1.0, 2.5));
+        records.push_back(Rec());
+        publishRecords(&mX, records);
+
+        X.loadExposition(&exposition);
+        ASSERTV(exposition, exposition ==
+                "# TYPE MyCategory_A summary\n"
+                "MyCategory_A_count 2\n"
+                "MyCategory_A_sum 3.5\n"
+                "# TYPE MyCategory_A_min gauge\n"
+                "MyCategory_A_min 1\n"
+                "# TYPE MyCategory_A_max gauge\n"
+                "MyCategory_A_max 2.5\n"
+                "# EOF\n");
+
+        // Two groups, with the values of 'METRIC_A' reset.
+
+        bsl::vector<Rec> recordsB;
+        recordsB.push_back(Rec(METRIC_B, 1, 0.1, 0.1, 0.1));
+
+        records.clear();
+        records.push_back(Rec(METRIC_A));
+
+        balm::MetricSample sample;
+        sample.appendGroup(records.data(), 1, bsls::TimeInterval(1, 0));
+        sample.appendGroup(recordsB.data(), 1, bsls::TimeInterval(1, 0));
+        mX.publish(sample);
+
+        X.loadExposition(&exposition);
+        ASSERTV(exposition, exposition ==
+                "# TYPE MyCategory_A summary\n"
+                "MyCategory_A_count 2\n"
+                "MyCategory_A_sum 3.5\n"
+                "# TYPE MyCategory_B summary\n"
+                "MyCategory_B_count 1\n"
+                "MyCategory_B_sum 0.1\n"
+                "# TYPE MyCategory_B_min gauge\n"
+                "MyCategory_B_min 0.1\n"
+                "# TYPE MyCategory_B_max gauge\n"
+                "MyCategory_B_max 0.1\n"
+                "# EOF\n");
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+
+        records.clear();
+        records.push_back(Rec(METRIC_A, 3, 1.0 / 3.0, -INF, INF));
+        publishRecords(&mX, records);
+
+        X.loadExposition(&exposition);
+        ASSERTV(exposition, 0 == exposition.find(
+                "# TYPE MyCategory_A summary\n"
+                "MyCategory_A_count 5\n"
+                "MyCategory_A_sum 3.8333333333333335\n"
+                "# TYPE MyCategory_A_min gauge\n"
+                "MyCategory_A_min -Inf\n"
+                "# TYPE MyCategory_A_max gauge\n"
+                "MyCategory_A_max +Inf\n"
+                "# TYPE MyCategory_B summary\n"));
+
+        if (verbose) cout << "\tTesting metrics having the same family name."
+                          << endl;
+        {
+            balm::Category otherCategory("MyCategory_C");
+
+            Desc descDash(&myCategory, "C-D");
+            Desc descDot(&myCategory, "C.D");
+            Desc descOther(&otherCategory, "D");
+
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            records.clear();
+            records.push_back(Rec(Id(&descDash),  1, 1.0, 1.0, 1.0));
+            records.push_back(Rec(Id(&descDot),   1, 2.0, 2.0, 2.0));
+            records.push_back(Rec(Id(&descOther), 1, 4.0, 4.0, 4.0));
+            publishRecords(&mY, records);
+            publishRecords(&mY, records);
+
+            Y.loadExposition(&exposition);
+            ASSERTV(exposition, exposition ==
+                    "# TYPE MyCategory_C_D summary\n"
+                    "MyCategory_C_D_count 2\n"
+                    "MyCategory_C_D_sum 2\n"
+                    "# TYPE MyCategory_C_D_min gauge\n"
+                    "MyCategory_C_D_min 1\n"
+                    "# TYPE MyCategory_C_D_max gauge\n"
+                    "MyCategory_C_D_max 1\n"
+                    "# EOF\n");
+        }
+
+        if (verbose) cout << "\tTesting metrics colliding with generated "
+                             "names." << endl;
+        {
+            Desc descLatency(&myCategory, "Latency");
+            Desc descCount(  &myCategory, "Latency.count");
+            Desc descSum(    &myCategory, "Latency_sum");
+            Desc descMin(    &myCategory, "Latency.min");
+            Desc descMax(    &myCategory, "Latency-max");
+
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            records.clear();
+            records.push_back(Rec(Id(&descLatency), 1, 1.0, 1.0, 1.0));
+            records.push_back(Rec(Id(&descCount),   1, 2.0, 2.0, 2.0));
+            records.push_back(Rec(Id(&descSum),     1, 3.0, 3.0, 3.0));
+            records.push_back(Rec(Id(&descMin),     1, 4.0, 4.0, 4.0));
+            records.push_back(Rec(Id(&descMax),     1, 5.0, 5.0, 5.0));
+            publishRecords(&mY, records);
+            publishRecords(&mY, records);
+
+            Y.loadExposition(&exposition);
+            ASSERTV(exposition, exposition ==
+                    "# TYPE MyCategory_Latency summary\n"
+                    "MyCategory_Latency_count 2\n"
+                    "MyCategory_Latency_sum 2\n"
+                    "# TYPE MyCategory_Latency_min gauge\n"
+                    "MyCategory_Latency_min 1\n"
+                    "# TYPE MyCategory_Latency_max gauge\n"
+                    "MyCategory_Latency_max 1\n"
+                    "# EOF\n");
+
+            Desc descXMin(     &myCategory, "X.min");
+            Desc descX(        &myCategory, "X");
+            Desc descXMinCount(&myCategory, "X.min_count");
+
+            Obj mZ(&ta);  const Obj& Z = mZ;
+
+            records.clear();
+            records.push_back(Rec(Id(&descXMin),      1, 1.0, 1.0, 1.0));
+            records.push_back(Rec(Id(&descX),         1, 2.0, 2.0, 2.0));
+            records.push_back(Rec(Id(&descXMinCount), 1, 3.0, 3.0, 3.0));
+            publishRecords(&mZ, records);
+            publishRecords(&mZ, records);
+
+            Z.loadExposition(&exposition);
+            ASSERTV(exposition, exposition ==
+                    "# TYPE MyCategory_X_min summary\n"
+                    "MyCategory_X_min_count 2\n"
+                    "MyCategory_X_min_sum 2\n"
+                    "# TYPE MyCategory_X_min_min gauge\n"
+                    "MyCategory_X_min_min 1\n"
+                    "# TYPE MyCategory_X_min_max gauge\n"
+                    "MyCategory_X_min_max 1\n"
+                    "# EOF\n");
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'appendFamilyName'
+        //
+        // Concerns:
+        //:  1 The category and name are joined by '_'.
+        //:
+        //:  2 Characters not permitted in a metric name are replaced by '_'.
+        //:
+        //:  3 A name that would begin with a digit is prefixed with '_'.
+        //:
+        //:  4 The name is appended to the existing contents of the string.
+        //
+        // Plan:
+        //:  1 Using the table-driven technique, verify the family name for a
+        //:    set of categories and names.  (C-1..4)
+        //
+        // Testing:
+        //   static void appendFamilyName(string *, string_view, string_view);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'appendFamilyName'"
+                          << "\n==========================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_category;
+            const char *d_name;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  CATEGORY          NAME            EXPECTED
+            //----  --------          ----            --------
+            { L_,   "",               "",             ""                   },
+            { L_,   "",               "a",            "a"                  },
+            { L_,   "c",              "",             "c_"                 },
+            { L_,   "c",              "n",            "c_n"                },
+            { L_,   "my.cat",         "req-latency",  "my_cat_req_latency" },
+            { L_,   "ns:cat",         "a_B9",         "ns:cat_a_B9"        },
+            { L_,   "9lives",         "x",            "_9lives_x"          },
+            { L_,   "",               "1x",           "_1x"                },
+            { L_,   "c",              "1x",           "c_1x"               },
+            { L_,   "caf\xc3\xa9",    "a b",          "caf___a_b"          },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE     = DATA[i].d_line;
+            const char *CATEGORY = DATA[i].d_category;
+            const char *NAME     = DATA[i].d_name;
+            const char *EXPECTED = DATA[i].d_expected;
+
+            bsl::string result("prefix ");
+            Obj::appendFamilyName(&result, CATEGORY, NAME);
+            ASSERTV(LINE, result, bsl::string("prefix ") + EXPECTED == result);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //:  1 The class is sufficiently functional to enable comprehensive
+        //:    testing in subsequent test cases.
+        //
+        // Plan:
+        //:  1 Create an object, publish a record, and verify the exposition.
+        //:    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator         da("default");
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::vector<Rec> records(&ta);
+            records.push_back(Rec(METRIC_A, 1, 1.0, 1.0, 1.0));
+
+            balm::MetricSample sample(&ta);
+            sample.appendGroup(records.data(), 1, bsls::TimeInterval(1, 0));
+            mX.publish(sample);
+
+            bsl::string exposition(&ta);
+            X.loadExposition(&exposition);
+            ASSERTV(exposition,
+                    0 == exposition.find("# TYPE MyCategory_A summary\n"));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,194 @@
+// balm_shardedcollector.cpp                                          -*-C++-*-
+#include <balm_shardedcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_shardedcollector_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
+#include <bsl_cstddef.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+typedef AtomicDoubleImpUtil Util;
+
+}  // close unnamed namespace
+
+                        // ----------------------------
+                        // class ShardedCollector_Shard
+                        // ----------------------------
+
+// CREATORS
+ShardedCollector_Shard::ShardedCollector_Shard()
+: d_count(0)
+, d_total(Util::toBits(0.0))
+, d_min(Util::toBits(MetricRecord::k_DEFAULT_MIN))
+, d_max(Util::toBits(MetricRecord::k_DEFAULT_MAX))
+{
+}
+
+// MANIPULATORS
+void ShardedCollector_Shard::loadAndReset(MetricRecord *record)
+{
+    record->count() += static_cast<int>(d_count.swap(0));
+    record->total() += Util::fromBits(d_total.swap(Util::toBits(0.0)));
+    const bsls::Types::Int64 minBits =
+                                 Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    const bsls::Types::Int64 maxBits =
+                                 Util::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    record->min()    = bsl::min(record->min(),
+                                Util::fromBits(d_min.swap(minBits)));
+    record->max()    = bsl::max(record->max(),
+                                Util::fromBits(d_max.swap(maxBits)));
+}
+
+void ShardedCollector_Shard::reset()
+{
+    set(0, 0.0, MetricRecord::k_DEFAULT_MIN, MetricRecord::k_DEFAULT_MAX);
+}
+
+void ShardedCollector_Shard::set(bsls::Types::Int64 count,
+                                 double             total,
+                                 double             min,
+                                 double             max)
+{
+    d_count = count;
+    d_total = Util::toBits(total);
+    d_min   = Util::toBits(min);
+    d_max   = Util::toBits(max);
+}
+
+// ACCESSORS
+void ShardedCollector_Shard::load(MetricRecord *record) const
+{
+    record->count() += static_cast<int>(d_count.load());
+    record->total() += Util::fromBits(d_total.load());
+    record->min()    = bsl::min(record->min(), Util::fromBits(d_min.load()));
+    record->max()    = bsl::max(record->max(), Util::fromBits(d_max.load()));
+}
+
+                           // ----------------------
+                           // class ShardedCollector
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+void ShardedCollector::init(int numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+    BSLS_ASSERT(0 == (numShards & (numShards - 1)));
+
+    const bsl::size_t size = numShards * sizeof(ShardedCollector_Shard);
+
+    d_shards_p = static_cast<ShardedCollector_Shard *>(
+                                               d_allocator_p->allocate(size));
+    for (int i = 0; i < numShards; ++i) {
+        new (d_shards_p + i) ShardedCollector_Shard();
+    }
+    d_numShards = numShards;
+    d_mask      = numShards - 1;
+}
+
+// CLASS METHODS
+int ShardedCollector::defaultNumShards()
+{
+    const unsigned int concurrency = bslmt::ThreadUtil::hardwareConcurrency();
+
+    int numShards = 1;
+    while (static_cast<unsigned int>(numShards) < concurrency
+        && numShards < k_MAX_DEFAULT_SHARDS) {
+        numShards *= 2;
+    }
+    return numShards;
+}
+
+// CREATORS
+ShardedCollector::ShardedCollector(const MetricId&   metricId,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_numShards(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(defaultNumShards());
+}
+
+ShardedCollector::ShardedCollector(const MetricId&   metricId,
+                                   int               numShards,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_numShards(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(numShards);
+}
+
+ShardedCollector::~ShardedCollector()
+{
+    // 'ShardedCollector_Shard' is trivially destructible.
+
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+void ShardedCollector::reset()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].reset();
+    }
+}
+
+void ShardedCollector::loadAndReset(MetricRecord *record)
+{
+    *record = MetricRecord(d_metricId);
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].loadAndReset(record);
+    }
+}
+
+void ShardedCollector::setCountTotalMinMax(int    count,
+                                           double total,
+                                           double min,
+                                           double max)
+{
+    d_shards_p[0].set(count, total, min, max);
+    for (int i = 1; i < d_numShards; ++i) {
+        d_shards_p[i].reset();
+    }
+}
+
+// ACCESSORS
+void ShardedCollector::load(MetricRecord *record) const
+{
+    *record = MetricRecord(d_metricId);
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].load(record);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,371 @@
+// balm_shardedcollector.h                                            -*-C++-*-
+#ifndef INCLUDED_BALM_SHARDEDCOLLECTOR
+#define INCLUDED_BALM_SHARDEDCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a low-contention collector using per-thread shards.
+//
+//@CLASSES:
+//   balm::ShardedCollector: lock-free collector of sharded metric values
+//
+//@SEE_ALSO: balm_collector, balm_collectorrepository, balm_metrics
+//
+//@DESCRIPTION: This component provides a class, 'balm::ShardedCollector',
+// for collecting and aggregating the values of a metric that is updated very
+// frequently from many threads.  A 'balm::ShardedCollector' provides the same
+// operations as a 'balm::Collector' (see 'balm_collector'), but rather than
+// guarding a single 'balm::MetricRecord' with a mutex, it distributes the
+// count, total, minimum, and maximum over a number of *shards*, each occupying
+// its own cache line(s).  The 'update' operation selects a shard based on the
+// identity of the calling thread and modifies it using atomic operations only,
+// so threads updating the same metric neither take a lock nor (unless they
+// happen to map to the same shard) write to the same cache line.  The shards
+// are merged into a single record only when the collector is loaded, which
+// for collectors owned by a 'balm::CollectorRepository' happens when the
+// 'balm::MetricsManager' collects records for publication.
+//
+// By default, the number of shards is the smallest power of two that is not
+// less than the number of hardware threads on the host (up to a maximum of
+// 'k_MAX_DEFAULT_SHARDS'); a different (power of two) number of shards can be
+// supplied at construction.
+//
+///Consistency of Collected Values
+///- - - - - - - - - - - - - - - -
+// The fields of a shard are updated independently, so a 'load' or
+// 'loadAndReset' that runs concurrently with an 'update' may observe, e.g.,
+// the incremented count of that update without its contribution to the total.
+// The contribution is not lost: it is reported by the next 'loadAndReset'.
+// Aggregated over consecutive collection intervals, the counts and totals are
+// exact.  Similarly, 'setCountTotalMinMax' is not atomic with respect to
+// concurrent updates.  Clients that require 'balm::Collector's stronger
+// per-operation atomicity should continue to use 'balm::Collector'.
+//
+///Thread Safety
+///-------------
+// 'balm::ShardedCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  'update' and
+// 'accumulateCountTotalMinMax' are lock-free.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example creates a 'balm::ShardedCollector', modifies its
+// values, then collects a 'balm::MetricRecord'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "MyMetric");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::ShardedCollector' object for 'myMetric' and use the
+// 'update' method to update its collected value.  In practice 'update' would
+// be called from many threads:
+//..
+//  balm::ShardedCollector collector(myMetric);
+//
+//  collector.update(1.0);
+//  collector.update(3.0);
+//..
+// Finally, we collect the aggregated values, which are the same as a
+// 'balm::Collector' would have produced:
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(myMetric == record.metricId());
+//  assert(2        == record.count());
+//  assert(4        == record.total());
+//  assert(1.0      == record.min());
+//  assert(3.0      == record.max());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_atomicdoubleimputil.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                        // ============================
+                        // class ShardedCollector_Shard
+                        // ============================
+
+class ShardedCollector_Shard {
+    // This component-private class holds one shard of the aggregated values
+    // of a 'ShardedCollector', padded so that adjacent shards do not share a
+    // cache line.  Floating-point fields are stored as their bit patterns so
+    // that they can be manipulated with 64-bit atomic operations.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_DATA_SIZE = 4 * sizeof(bsls::AtomicInt64),
+        k_PADDING   = 2 * bslmt::Platform::e_CACHE_LINE_SIZE - k_DATA_SIZE
+            // Two cache lines are used since adjacent-line prefetching makes
+            // neighboring lines behave as one on common hardware.
+    };
+
+  public:
+    // PUBLIC DATA
+    bsls::AtomicInt64 d_count;               // number of updates
+    bsls::AtomicInt64 d_total;               // bits of 'double' total
+    bsls::AtomicInt64 d_min;                 // bits of 'double' minimum
+    bsls::AtomicInt64 d_max;                 // bits of 'double' maximum
+    char              d_padding[k_PADDING];  // unused
+
+    // CREATORS
+    ShardedCollector_Shard();
+        // Create a shard having a count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // MANIPULATORS
+    void add(bsls::Types::Int64 count, double total, double min, double max);
+        // Atomically add the specified 'count' and 'total' to this shard, and
+        // lower its minimum to 'min' and raise its maximum to 'max' where
+        // they improve on the current values.
+
+    void loadAndReset(MetricRecord *record);
+        // Combine into the specified 'record' the values of this shard, and
+        // reset the shard to its default state.
+
+    void reset();
+        // Reset this shard to its default state.
+
+    void set(bsls::Types::Int64 count, double total, double min, double max);
+        // Set the count, total, minimum, and maximum of this shard to the
+        // specified 'count', 'total', 'min', and 'max' respectively.
+
+    // ACCESSORS
+    void load(MetricRecord *record) const;
+        // Combine into the specified 'record' the values of this shard.
+};
+
+                           // ======================
+                           // class ShardedCollector
+                           // ======================
+
+class ShardedCollector {
+    // This class provides a mechanism for collecting and aggregating the value
+    // of a metric over a period of time, with lock-free updates distributed
+    // over per-thread shards.  The collected values are those of a 'Collector'
+    // (see 'balm_collector'): the number of times an event occurred, and the
+    // total, minimum, and maximum of the associated measurement value.  The
+    // default value for the count is 0, the default value for the total is
+    // 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and the
+    // default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
+
+    // DATA
+    MetricId                d_metricId;      // identifies collected metric
+    ShardedCollector_Shard *d_shards_p;      // array of shards (owned)
+    int                     d_numShards;     // length of 'd_shards_p'
+    bsls::Types::Uint64     d_mask;          // 'd_numShards - 1'
+    bslma::Allocator       *d_allocator_p;   // allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    ShardedCollector(const ShardedCollector&);
+    ShardedCollector& operator=(const ShardedCollector&);
+
+    // PRIVATE MANIPULATORS
+    void init(int numShards);
+        // Allocate and construct the specified 'numShards' shards.
+
+    ShardedCollector_Shard& shard();
+        // Return a reference to the shard assigned to the calling thread.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_DEFAULT_SHARDS = 64  // upper bound for default shard count
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShardedCollector,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int defaultNumShards();
+        // Return the number of shards used by a collector constructed without
+        // an explicit number of shards: the smallest power of two not less
+        // than the number of hardware threads, but no more than
+        // 'k_MAX_DEFAULT_SHARDS'.
+
+    // CREATORS
+    explicit ShardedCollector(const MetricId&   metricId,
+                              bslma::Allocator *basicAllocator = 0);
+    ShardedCollector(const MetricId&   metricId,
+                     int               numShards,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create a collector for a metric having the specified 'metricId',
+        // and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.  Optionally specify 'numShards', the
+        // number of shards over which updates are distributed; if
+        // 'numShards' is not supplied, 'defaultNumShards()' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'numShards' is a positive
+        // power of two.
+
+    ~ShardedCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric; then reset the count, total,
+        // minimum, and maximum values to their default states.  Each value is
+        // read and reset in a single atomic operation, so no update is lost
+        // (see {Consistency of Collected Values}).
+
+    void update(double value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.  This operation is
+        // lock-free.
+
+    void accumulateCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, if specified 'min' is
+        // less than the minimum value, set 'min' to be the minimum value, and
+        // if specified 'max' is greater than the maximum value, set 'max' to
+        // be the maximum value.  This operation is lock-free.
+
+    void setCountTotalMinMax(int count, double total, double min, double max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.  Note that this
+        // operation is not atomic with respect to concurrent updates.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    int numShards() const;
+        // Return the number of shards over which updates are distributed.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class ShardedCollector_Shard
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void ShardedCollector_Shard::add(bsls::Types::Int64 count,
+                                 double             total,
+                                 double             min,
+                                 double             max)
+{
+    d_count.addRelaxed(count);
+
+    AtomicDoubleImpUtil::add(&d_total, total);
+    AtomicDoubleImpUtil::updateMin(&d_min, min);
+    AtomicDoubleImpUtil::updateMax(&d_max, max);
+}
+
+                           // ----------------------
+                           // class ShardedCollector
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+inline
+ShardedCollector_Shard& ShardedCollector::shard()
+{
+    // Fibonacci hashing of the thread id spreads the (typically aligned)
+    // thread identifiers over the shards; the high-order bits of the product
+    // are the well-mixed ones.
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    return d_shards_p[((id * 0x9E3779B97F4A7C15ULL) >> 32) & d_mask];
+}
+
+// MANIPULATORS
+inline
+void ShardedCollector::update(double value)
+{
+    shard().add(1, value, value, value);
+}
+
+inline
+void ShardedCollector::accumulateCountTotalMinMax(int    count,
+                                                  double total,
+                                                  double min,
+                                                  double max)
+{
+    shard().add(count, total, min, max);
+}
+
+// ACCESSORS
+inline
+const MetricId& ShardedCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+int ShardedCollector::numShards() const
+{
+    return d_numShards;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
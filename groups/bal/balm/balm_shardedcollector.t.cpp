@@ -0,0 +1,551 @@
+// balm_shardedcollector.t.cpp                                        -*-C++-*-
+#include <balm_shardedcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::ShardedCollector' is a mechanism for collecting and recording
+// aggregated metric values.  Ensure that values can be accumulated into and
+// read out of the collector regardless of the shard to which the updating
+// thread maps, and that no update is lost when updates and collection run
+// concurrently.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int defaultNumShards();
+//
+// CREATORS
+// [ 2] ShardedCollector(const MetricId&, bslma::Allocator *);
+// [ 2] ShardedCollector(const MetricId&, int, bslma::Allocator *);
+// [ 2] ~ShardedCollector();
+//
+// MANIPULATORS
+// [ 4] void reset();
+// [ 4] void loadAndReset(MetricRecord *record);
+// [ 3] void update(double value);
+// [ 3] void accumulateCountTotalMinMax(int, double, double, double);
+// [ 4] void setCountTotalMinMax(int, double, double, double);
+//
+// ACCESSORS
+// [ 2] const MetricId& metricId() const;
+// [ 2] int numShards() const;
+// [ 3] void load(MetricRecord *record) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::ShardedCollector  Obj;
+typedef balm::MetricRecord      Rec;
+typedef balm::MetricId          Id;
+typedef balm::MetricDescription Desc;
+
+// ============================================================================
+//                      GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct UpdateThread {
+    // Update a collector 'k_NUM_UPDATES' times with the value 1, then with
+    // the value 2.
+
+    enum { k_NUM_UPDATES = 100000 };
+
+    Obj            *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < k_NUM_UPDATES; ++i) {
+            d_obj_p->update(1.0);
+            d_obj_p->accumulateCountTotalMinMax(1, 2.0, 2.0, 2.0);
+        }
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default");
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test");
+
+    balm::Category myCategory("MyCategory");
+    Desc           descA(&myCategory, "A");
+    const Id       METRIC_A(&descA);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //:  1 The usage example provided in the component header file
+        //:    compiles, links, and runs as shown.
+        //
+        // Plan:
+        //:  1 Incorporate usage example from header into test driver, remove
+        //:    leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING USAGE EXAMPLE"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// The following example creates a 'balm::ShardedCollector', modifies its
+// values, then collects a 'balm::MetricRecord'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "MyMetric");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::ShardedCollector' object for 'myMetric' and use the
+// 'update' method to update its collected value.  In practice 'update' would
+// be called from many threads:
+//..
+    balm::ShardedCollector collector(myMetric);
+
+    collector.update(1.0);
+    collector.update(3.0);
+//..
+// Finally, we collect the aggregated values, which are the same as a
+// 'balm::Collector' would have produced:
+//..
+    balm::MetricRecord record;
+    collector.loadAndReset(&record);
+
+    ASSERT(myMetric == record.metricId());
+    ASSERT(2        == record.count());
+    ASSERT(4        == record.total());
+    ASSERT(1.0      == record.min());
+    ASSERT(3.0      == record.max());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //:  1 Updates from several threads, whether or not they map to the
+        //:    same shard, are all recorded.
+        //:
+        //:  2 'loadAndReset' running concurrently with updates loses no
+        //:    count or total.
+        //
+        // Plan:
+        //:  1 For collectors having 1, 2, and the default number of shards,
+        //:    start several threads that update the collector while the main
+        //:    thread repeatedly calls 'loadAndReset' and accumulates the
+        //:    results.  Verify the accumulated count, total, min, and max.
+        //:    (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        const int SHARDS[] = { 1, 2, Obj::defaultNumShards() };
+        const int NUM_SHARDS = sizeof SHARDS / sizeof *SHARDS;
+
+        for (int ti = 0; ti < NUM_SHARDS; ++ti) {
+            Obj            mX(METRIC_A, SHARDS[ti], &ta);
+            bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_THREADS);
+            UpdateThread functor = { &mX, &barrier };
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], functor));
+            }
+
+            barrier.wait();
+
+            Rec total(METRIC_A);
+            for (int i = 0; i < 100; ++i) {
+                Rec r;
+                mX.loadAndReset(&r);
+                total.count() += r.count();
+                total.total() += r.total();
+                total.min()    = bsl::min(total.min(), r.min());
+                total.max()    = bsl::max(total.max(), r.max());
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            Rec r;
+            mX.loadAndReset(&r);
+            total.count() += r.count();
+            total.total() += r.total();
+            total.min()    = bsl::min(total.min(), r.min());
+            total.max()    = bsl::max(total.max(), r.max());
+
+            const int EXP_COUNT = 2 * k_NUM_THREADS *
+                                                   UpdateThread::k_NUM_UPDATES;
+            ASSERTV(SHARDS[ti], total.count(), EXP_COUNT == total.count());
+            ASSERTV(SHARDS[ti],
+                    total.total(),
+                    1.5 * EXP_COUNT == total.total());
+            ASSERTV(SHARDS[ti], total.min(), 1.0 == total.min());
+            ASSERTV(SHARDS[ti], total.max(), 2.0 == total.max());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'setCountTotalMinMax', 'reset', AND 'loadAndReset'
+        //
+        // Concerns:
+        //:  1 'setCountTotalMinMax' replaces the values of every shard.
+        //:
+        //:  2 'reset' and 'loadAndReset' restore the default values.
+        //:
+        //:  3 'loadAndReset' loads the values before resetting them.
+        //
+        // Plan:
+        //:  1 Update a collector having several shards from several threads,
+        //:    then set its values and verify them with 'load'.  (C-1)
+        //:
+        //:  2 Verify 'loadAndReset' and 'reset'.  (C-2..3)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadAndReset(MetricRecord *record);
+        //   void setCountTotalMinMax(int, double, double, double);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'setCountTotalMinMax', 'reset', AND"
+                             " 'loadAndReset'"
+                          << "\n==========================================="
+                             "==============" << endl;
+
+        Obj mX(METRIC_A, 8, &ta); const Obj& X = mX;
+
+        bslmt::Barrier barrier(1);
+        UpdateThread   functor = { &mX, &barrier };
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle, functor));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+        mX.update(7.0);
+
+        mX.setCountTotalMinMax(3, 6.0, 1.0, 4.0);
+
+        Rec r;
+        X.load(&r);
+        ASSERT(Rec(METRIC_A, 3, 6.0, 1.0, 4.0) == r);
+
+        mX.loadAndReset(&r);
+        ASSERT(Rec(METRIC_A, 3, 6.0, 1.0, 4.0) == r);
+
+        X.load(&r);
+        ASSERT(Rec(METRIC_A) == r);
+
+        mX.update(5.0);
+        mX.reset();
+        X.load(&r);
+        ASSERT(Rec(METRIC_A) == r);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'update', 'accumulateCountTotalMinMax', AND 'load'
+        //
+        // Concerns:
+        //:  1 'update' and 'accumulateCountTotalMinMax' aggregate values as
+        //:    'balm::Collector' does.
+        //:
+        //:  2 Values recorded from different threads (and so possibly
+        //:    different shards) are combined by 'load'.
+        //:
+        //:  3 'load' does not reset the collector.
+        //
+        // Plan:
+        //:  1 Using a table of values, update collectors having 1 and 16
+        //:    shards and verify the result of 'load' against expected
+        //:    values.  (C-1, 3)
+        //:
+        //:  2 Update a collector from a second thread and verify the combined
+        //:    result.  (C-2)
+        //
+        // Testing:
+        //   void update(double value);
+        //   void accumulateCountTotalMinMax(int, double, double, double);
+        //   void load(MetricRecord *record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'update' AND 'load'"
+                          << "\n===========================" << endl;
+
+        const double VALUES[]   = { 0.0, 3.5, -2.0, 10.0, 1.0, -7.25 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        const int SHARDS[] = { 1, 16 };
+        for (int ti = 0; ti < 2; ++ti) {
+            Obj mX(METRIC_A, SHARDS[ti], &ta); const Obj& X = mX;
+
+            Rec expected(METRIC_A);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.update(VALUES[i]);
+                ++expected.count();
+                expected.total() += VALUES[i];
+                expected.min()    = bsl::min(expected.min(), VALUES[i]);
+                expected.max()    = bsl::max(expected.max(), VALUES[i]);
+
+                Rec r;
+                X.load(&r);
+                ASSERTV(ti, i, r, expected == r);
+                X.load(&r);
+                ASSERTV(ti, i, r, expected == r);
+            }
+
+            mX.accumulateCountTotalMinMax(10, 100.0, -50.0, 60.0);
+            expected.count() += 10;
+            expected.total() += 100.0;
+            expected.min()    = -50.0;
+            expected.max()    = 60.0;
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(ti, r, expected == r);
+        }
+
+        {
+            Obj mX(METRIC_A, 16, &ta); const Obj& X = mX;
+
+            bslmt::Barrier barrier(1);
+            UpdateThread   functor = { &mX, &barrier };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, functor));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            mX.update(0.5);
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(r, 2 * UpdateThread::k_NUM_UPDATES + 1 == r.count());
+            ASSERTV(r, 3.0 * UpdateThread::k_NUM_UPDATES + 0.5 == r.total());
+            ASSERTV(r, 0.5 == r.min());
+            ASSERTV(r, 2.0 == r.max());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //:  1 A collector is created with default values and the requested
+        //:    number of shards.
+        //:
+        //:  2 'defaultNumShards' is a power of two no greater than
+        //:    'k_MAX_DEFAULT_SHARDS'.
+        //:
+        //:  3 Memory is supplied by the specified allocator and released on
+        //:    destruction.
+        //
+        // Plan:
+        //:  1 Create collectors with and without a number of shards, and
+        //:    verify their attributes and allocator usage.  (C-1..3)
+        //
+        // Testing:
+        //   static int defaultNumShards();
+        //   ShardedCollector(const MetricId&, bslma::Allocator *);
+        //   ShardedCollector(const MetricId&, int, bslma::Allocator *);
+        //   ~ShardedCollector();
+        //   const MetricId& metricId() const;
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CREATORS AND BASIC ACCESSORS"
+                          << "\n====================================" << endl;
+
+        const int DEFAULT = Obj::defaultNumShards();
+        ASSERTV(DEFAULT, 0 < DEFAULT);
+        ASSERTV(DEFAULT, Obj::k_MAX_DEFAULT_SHARDS >= DEFAULT);
+        ASSERTV(DEFAULT, 0 == (DEFAULT & (DEFAULT - 1)));
+
+        {
+            Obj mX(METRIC_A, &ta); const Obj& X = mX;
+            ASSERT(METRIC_A == X.metricId());
+            ASSERT(DEFAULT  == X.numShards());
+            ASSERT(0        <  ta.numBlocksInUse());
+
+            Rec r;
+            X.load(&r);
+            ASSERT(Rec(METRIC_A) == r);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        const int SHARDS[] = { 1, 2, 4, 32, 128 };
+        for (int ti = 0; ti < 5; ++ti) {
+            Obj mX(METRIC_A, SHARDS[ti], &ta); const Obj& X = mX;
+            ASSERTV(ti, SHARDS[ti] == X.numShards());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(METRIC_A);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //:  1 The class is sufficiently functional to enable comprehensive
+        //:    testing in subsequent test cases.
+        //
+        // Plan:
+        //:  1 Create a collector, update it, and load its values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX(METRIC_A, &ta); const Obj& X = mX;
+
+        mX.update(2.0);
+        mX.update(4.0);
+
+        Rec r;
+        X.load(&r);
+        ASSERT(Rec(METRIC_A, 2, 6.0, 2.0, 4.0) == r);
+
+        mX.loadAndReset(&r);
+        ASSERT(Rec(METRIC_A, 2, 6.0, 2.0, 4.0) == r);
+
+        X.load(&r);
+        ASSERT(Rec(METRIC_A) == r);
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
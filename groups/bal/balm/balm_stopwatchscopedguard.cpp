@@ -18,6 +18,10 @@ namespace BloombergLP {
                       // class balm::StopwatchScopedGuard
                       // --------------------------------
 
+// CLASS DATA
+bsls::AtomicInt balm::StopwatchScopedGuard::s_defaultWallTimer(
+                                             bsls::Stopwatch::e_SYSTEM_TIMER);
+
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
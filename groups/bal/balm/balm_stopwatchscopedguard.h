@@ -29,6 +29,25 @@ BSLS_IDENT("$Id: $")
 // and on destruction records that elapsed time, in the indicated time units,
 // to the supplied metric.
 //
+///Recording Latency Distributions
+///-------------------------------
+// A 'balm::StopwatchScopedGuard' may alternatively be supplied a
+// 'balm::HistogramCollector' (see 'balm_histogramcollector'), in which case
+// each elapsed time is recorded in that histogram.  The metric's count, total,
+// minimum, and maximum are then published as usual, together with the
+// percentiles of the elapsed times (see 'balm_collectorrepository'), which
+// expose tail latencies that an average conceals.
+//
+///Cycle-Counter Timing
+///---------------------
+// By default, a 'balm::StopwatchScopedGuard' reads the system timer (see
+// 'bsls_timeutil') on construction and destruction.  A process that records
+// elapsed times at high rates may instead call
+// 'balm::StopwatchScopedGuard::setDefaultWallTimer' with
+// 'bsls::Stopwatch::e_CYCLE_COUNTER', so that guards created thereafter read
+// the processor's calibrated cycle counter, which is considerably cheaper
+// where available (see 'bsls::TimeUtil::getCycleCounterTimer').
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -159,9 +178,11 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_metric.h>
 #include <balm_metricsmanager.h>
 
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 
@@ -212,6 +233,11 @@ class StopwatchScopedGuard {
     };
 
   private:
+    // CLASS DATA
+    static bsls::AtomicInt s_defaultWallTimer;
+                                    // 'bsls::Stopwatch::WallTimer' used by
+                                    // guards created subsequently
+
     // DATA
     bsls::Stopwatch d_stopwatch;    // stopwatch
 
@@ -220,11 +246,27 @@ class StopwatchScopedGuard {
     Collector *d_collector_p;  // metric collector (held, not owned); may
                                     // be 0, but cannot be invalid
 
+    HistogramCollector
+                   *d_histogram_p;  // histogram collector (held, not owned);
+                                    // may be 0, and is 0 if 'd_collector_p'
+                                    // is not 0
+
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
     StopwatchScopedGuard& operator=(const StopwatchScopedGuard&);
 
   public:
+    // CLASS METHODS
+    static bsls::Stopwatch::WallTimer defaultWallTimer();
+        // Return the timer from which scoped guards created subsequently read
+        // wall time.
+
+    static void setDefaultWallTimer(bsls::Stopwatch::WallTimer wallTimer);
+        // Set the timer from which scoped guards created subsequently read
+        // wall time to the specified 'wallTimer' (see {Cycle-Counter
+        // Timing}).  Note that the default is
+        // 'bsls::Stopwatch::e_SYSTEM_TIMER'.
+
     // CREATORS
     explicit StopwatchScopedGuard(Metric *metric,
                                   Units   timeUnits = k_SECONDS);
@@ -250,6 +292,19 @@ class StopwatchScopedGuard {
         // this guard, but does *not* affect the precision of the elapsed time
         // measurement.
 
+    explicit StopwatchScopedGuard(HistogramCollector *histogram,
+                                  Units               timeUnits = k_SECONDS);
+        // Initialize this scoped guard to record elapsed time in the
+        // specified 'histogram'.  Optionally specify the 'timeUnits' in which
+        // to report elapsed time.  If 'histogram' is 0 or
+        // 'histogram->metricId().category()->enabled() == false', this object
+        // will be inactive (i.e., will not record any values).  The behavior
+        // is undefined unless
+        // 'histogram == 0 || histogram->metricId().isValid()'.  Note that
+        // 'timeUnits' indicates the scale of the double value reported by
+        // this guard, but does *not* affect the precision of the elapsed time
+        // measurement.
+
     StopwatchScopedGuard(const MetricId&  metricId,
                          MetricsManager  *manager = 0);
     StopwatchScopedGuard(const MetricId&  metricId,
@@ -317,13 +372,29 @@ class StopwatchScopedGuard {
                          // class StopwatchScopedGuard
                          // --------------------------
 
+// CLASS METHODS
+inline
+bsls::Stopwatch::WallTimer StopwatchScopedGuard::defaultWallTimer()
+{
+    return static_cast<bsls::Stopwatch::WallTimer>(
+                                            s_defaultWallTimer.loadRelaxed());
+}
+
+inline
+void StopwatchScopedGuard::setDefaultWallTimer(
+                                          bsls::Stopwatch::WallTimer wallTimer)
+{
+    s_defaultWallTimer.storeRelaxed(wallTimer);
+}
+
 // CREATORS
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
                                            Units   timeUnits)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -333,23 +404,40 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
                                            Units      timeUnits)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(timeUnits)
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramCollector *histogram,
+                                           Units               timeUnits)
+: d_stopwatch(defaultWallTimer())
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogram_p((histogram && histogram->metricId().category()->enabled())
+                ? histogram
+                : 0)
+{
+    if (d_histogram_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            MetricsManager  *manager)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -364,9 +452,10 @@ inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            Units            timeUnits,
                                            MetricsManager  *manager)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -381,9 +470,10 @@ inline
 StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
                                            const char     *name,
                                            MetricsManager *manager)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -401,9 +491,10 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
                                            const char     *name,
                                            Units           timeUnits,
                                            MetricsManager *manager)
-: d_stopwatch()
+: d_stopwatch(defaultWallTimer())
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -417,7 +508,13 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * d_timeUnits);
+        const double elapsed = d_stopwatch.elapsedTime() * d_timeUnits;
+        if (d_collector_p) {
+            d_collector_p->update(elapsed);
+        }
+        else {
+            d_histogram_p->update(elapsed);
+        }
     }
 }
 
@@ -425,8 +522,10 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
-    return 0 != d_collector_p
-        && d_collector_p->metricId().category()->enabled();
+    return (0 != d_collector_p
+         && d_collector_p->metricId().category()->enabled())
+        || (0 != d_histogram_p
+         && d_histogram_p->metricId().category()->enabled());
 }
 
 }  // close package namespace
@@ -62,6 +62,9 @@ using bsl::flush;
 //                                 const char *  ,
 //                                 balm::MetricsManager    *);
 // [ 3]  ~balm::StopwatchScopedGuard();
+// CLASS METHODS
+// [ 6]  bsls::Stopwatch::WallTimer defaultWallTimer();
+// [ 6]  void setDefaultWallTimer(bsls::Stopwatch::WallTimer);
 // ACCESSORS
 // [ 3]  bool isActive() const;
 // ----------------------------------------------------------------------------
@@ -517,52 +520,77 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //    That the value recorded by the guard is (roughly) the elapsed
-        //    time between the objects construction and destruction.
+        //    time between the objects construction and destruction, whether
+        //    the guard reads the system timer or the cycle counter.
         //
         // Plan:
         //
         // Testing:
+        //   bsls::Stopwatch::WallTimer defaultWallTimer();
+        //   void setDefaultWallTimer(bsls::Stopwatch::WallTimer);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
                           << "ELAPSED TIME VALUE\n"
                           << "==================\n";
 
-        MetricsManager  manager(Z);
-        Repository&     repository = manager.collectorRepository();
-        balm::Collector *collector = repository.getDefaultCollector("A", "1");
-        bsls::Stopwatch stopwatch;
+        ASSERT(bsls::Stopwatch::e_SYSTEM_TIMER == Obj::defaultWallTimer());
 
-        enum { COUNT = 10 };
+        for (int ti = 0; ti < 2; ++ti) {
+            const bsls::Stopwatch::WallTimer WALL_TIMER =
+                                  0 == ti ? bsls::Stopwatch::e_SYSTEM_TIMER
+                                          : bsls::Stopwatch::e_CYCLE_COUNTER;
 
-        double ms = 1.0 * .001;
+            Obj::setDefaultWallTimer(WALL_TIMER);
+            ASSERTV(ti, WALL_TIMER == Obj::defaultWallTimer());
 
-        double expectedTotal = 0;
-        double expectedMin   = 500;
-        double expectedMax   = 0;
+            MetricsManager   manager(Z);
+            Repository&      repository = manager.collectorRepository();
+            balm::Collector *collector  = repository.getDefaultCollector("A",
+                                                                         "1");
+            bsls::Stopwatch  stopwatch;
 
-        for (int i = 0; i < COUNT; ++i) {
-            stopwatch.start();
+            enum { COUNT = 10 };
 
-            Obj mX(collector);
-            bslmt::ThreadUtil::sleep(bsls::TimeInterval(50 * ms));
+            double ms = 1.0 * .001;
 
-            stopwatch.stop();
-            expectedTotal += stopwatch.elapsedTime();
-            if (stopwatch.elapsedTime() < expectedMin) {
-                expectedMin = stopwatch.elapsedTime();
-            }
-            if (stopwatch.elapsedTime() > expectedMax) {
-                expectedMax = stopwatch.elapsedTime();
+            double expectedTotal = 0;
+            double expectedMin   = 500;
+            double expectedMax   = 0;
+
+            for (int i = 0; i < COUNT; ++i) {
+                stopwatch.start();
+
+                Obj mX(collector);
+                bslmt::ThreadUtil::sleep(bsls::TimeInterval(50 * ms));
+
+                stopwatch.stop();
+                expectedTotal += stopwatch.elapsedTime();
+                if (stopwatch.elapsedTime() < expectedMin) {
+                    expectedMin = stopwatch.elapsedTime();
+                }
+                if (stopwatch.elapsedTime() > expectedMax) {
+                    expectedMax = stopwatch.elapsedTime();
+                }
             }
-        }
 
-        balm::MetricRecord record = recordValue(collector);
-        ASSERT(COUNT == record.count());
-        ASSERT(within(record.total(), Obj::k_SECONDS, expectedTotal, 1.0))
-        ASSERT(within(record.max(), Obj::k_SECONDS, expectedMax, 1.0))
-        ASSERT(within(record.min(), Obj::k_SECONDS, expectedMin, 1.0))
+            balm::MetricRecord record = recordValue(collector);
+            ASSERTV(ti, COUNT == record.count());
+            ASSERTV(ti, within(record.total(),
+                               Obj::k_SECONDS,
+                               expectedTotal,
+                               1.0));
+            ASSERTV(ti, within(record.max(),
+                               Obj::k_SECONDS,
+                               expectedMax,
+                               1.0));
+            ASSERTV(ti, within(record.min(),
+                               Obj::k_SECONDS,
+                               expectedMin,
+                               1.0));
+        }
 
+        Obj::setDefaultWallTimer(bsls::Stopwatch::e_SYSTEM_TIMER);
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -0,0 +1,470 @@
+// baltzo_mmapdatafileloader.cpp                                      -*-C++-*-
+#include <baltzo_mmapdatafileloader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_mmapdatafileloader_cpp,"$Id$ $CSID$")
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfobinaryreader.h>
+
+#include <bdlb_bigendian.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_mappedrecordfile.h>
+
+#include <bdlt_epochutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_map.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+
+static const int UNSPECIFIED_ERROR = -1;
+static const int UNSUPPORTED_ID    = baltzo::ErrorCode::k_UNSUPPORTED_ID;
+
+BSLMF_ASSERT(UNSUPPORTED_ID != UNSPECIFIED_ERROR);
+
+namespace {
+
+typedef bdlb::BigEndianInt32       Int32;
+typedef bdls::MappedRecordFile     MappedFile;
+typedef MappedFile::FileHeader     FileHeader;
+typedef MappedFile::DirectoryEntry DirectoryEntry;
+
+const char k_MAGIC[4] = { 'B', 'T', 'Z', 'D' };
+const int  k_VERSION  = 1;
+
+struct RecordHeader {
+    // This 'struct' overlays the fixed-size prefix of a time-zone record.
+
+    Int32 d_numDescriptors;
+    Int32 d_numTransitions;
+    Int32 d_posixDescriptionOffset;
+};
+
+struct Descriptor {
+    // This 'struct' overlays one local-time descriptor in a time-zone record.
+
+    Int32 d_utcOffsetInSeconds;
+    Int32 d_dstInEffectFlag;
+    Int32 d_descriptionOffset;
+};
+
+struct Transition {
+    // This 'struct' overlays one transition in a time-zone record.
+
+    Int32 d_utcTimeHigh;
+    Int32 d_utcTimeLow;
+    Int32 d_descriptorIndex;
+};
+
+typedef bsl::vector<const baltzo::Zoneinfo *>            ZoneinfoPtrs;
+typedef bsl::vector<const baltzo::LocalTimeDescriptor *> DescriptorTable;
+typedef bsl::map<bsl::string, int>                       StringTable;
+
+bool identifierLess(const baltzo::Zoneinfo *lhs, const baltzo::Zoneinfo *rhs)
+    // Return 'true' if the identifier of the specified 'lhs' is less than
+    // that of the specified 'rhs', and 'false' otherwise.
+{
+    return lhs->identifier() < rhs->identifier();
+}
+
+int addString(StringTable        *strings,
+              bsl::string        *stringData,
+              const bsl::string&  value)
+    // Return the offset of the specified 'value' within the specified
+    // 'stringData', appending 'value' (with its null terminator) to
+    // 'stringData' and recording its offset in the specified 'strings' if it
+    // is not already present.
+{
+    StringTable::const_iterator it = strings->find(value);
+    if (strings->end() != it) {
+        return it->second;                                            // RETURN
+    }
+
+    const int offset = static_cast<int>(stringData->size());
+    stringData->append(value.c_str(), value.size() + 1);
+    (*strings)[value] = offset;
+    return offset;
+}
+
+int findDescriptor(DescriptorTable                    *table,
+                   const baltzo::LocalTimeDescriptor&  descriptor)
+    // Return the index of the specified 'descriptor' in the specified
+    // 'table', appending it to 'table' if it is not present.  Note that time
+    // zones have few distinct descriptors, so a linear search suffices.
+{
+    for (bsl::size_t i = 0; i < table->size(); ++i) {
+        if (*(*table)[i] == descriptor) {
+            return static_cast<int>(i);                               // RETURN
+        }
+    }
+    table->push_back(&descriptor);
+    return static_cast<int>(table->size() - 1);
+}
+
+void collectPath(bsl::vector<bsl::string> *paths, const char *path)
+    // Append the specified 'path' to the specified 'paths' if it names a
+    // regular file.
+{
+    if (bdls::FilesystemUtil::isRegularFile(path)) {
+        paths->push_back(path);
+    }
+}
+
+}  // close unnamed namespace
+
+namespace baltzo {
+
+                         // ------------------------
+                         // class MmapDataFileLoader
+                         // ------------------------
+
+// CLASS METHODS
+int MmapDataFileLoader::write(bsl::ostream&                stream,
+                              const bsl::vector<Zoneinfo>& timeZones)
+{
+    typedef bsl::vector<DescriptorTable> DescriptorTables;
+
+    // Order the time zones by identifier, and reject empty or duplicate
+    // identifiers.
+
+    ZoneinfoPtrs zones;
+    zones.reserve(timeZones.size());
+    for (bsl::size_t i = 0; i < timeZones.size(); ++i) {
+        zones.push_back(&timeZones[i]);
+    }
+    bsl::sort(zones.begin(), zones.end(), &identifierLess);
+
+    for (bsl::size_t i = 0; i < zones.size(); ++i) {
+        if (zones[i]->identifier().empty()
+         || (0 < i
+          && zones[i - 1]->identifier() == zones[i]->identifier())) {
+            return 1;                                                 // RETURN
+        }
+    }
+
+    const int numTimeZones = static_cast<int>(zones.size());
+
+    // Build the shared string table and the descriptor table of each time
+    // zone.
+
+    StringTable      strings;
+    DescriptorTables descriptors(zones.size());
+    bsl::string      stringData;
+
+    bsl::vector<int> identifierOffsets(zones.size());
+    bsl::vector<int> posixOffsets(zones.size());
+
+    for (bsl::size_t i = 0; i < zones.size(); ++i) {
+        const Zoneinfo& zone = *zones[i];
+
+        identifierOffsets[i] = addString(&strings,
+                                         &stringData,
+                                         zone.identifier());
+        posixOffsets[i]      = addString(&strings,
+                                         &stringData,
+                                         zone.posixExtendedRangeDescription());
+
+        for (Zoneinfo::TransitionConstIterator it = zone.beginTransitions();
+             it != zone.endTransitions();
+             ++it) {
+            const int index = findDescriptor(&descriptors[i],
+                                             it->descriptor());
+            if (static_cast<int>(descriptors[i].size()) == index + 1) {
+                addString(&strings,
+                          &stringData,
+                          it->descriptor().description());
+            }
+        }
+    }
+
+    // Lay out the file: the records follow the string table, aligned on a
+    // 4-byte boundary.
+
+    const bsls::Types::Int64 stringsOffset =
+                   sizeof(FileHeader) + numTimeZones * sizeof(DirectoryEntry);
+    const bsls::Types::Int64 stringsEnd    = stringsOffset + stringData.size();
+    const bsls::Types::Int64 recordsOffset =
+        (stringsEnd + sizeof(Int32) - 1) / sizeof(Int32) * sizeof(Int32);
+
+    bsl::vector<int>   recordOffsets(zones.size());
+    bsls::Types::Int64 offset = recordsOffset;
+    for (bsl::size_t i = 0; i < zones.size(); ++i) {
+        recordOffsets[i] = static_cast<int>(offset);
+        offset += sizeof(RecordHeader)
+                + descriptors[i].size() * sizeof(Descriptor)
+                + zones[i]->numTransitions() * sizeof(Transition);
+        if (offset > INT_MAX) {
+            return 2;                                                 // RETURN
+        }
+    }
+
+    const int base = static_cast<int>(stringsOffset);
+
+    MappedFile::writeHeader(stream,
+                            k_MAGIC,
+                            k_VERSION,
+                            numTimeZones,
+                            static_cast<int>(offset));
+
+    for (bsl::size_t i = 0; i < zones.size(); ++i) {
+        MappedFile::writeInt(stream, base + identifierOffsets[i]);
+        MappedFile::writeInt(stream, recordOffsets[i]);
+    }
+
+    stream.write(stringData.data(), stringData.size());
+    for (bsls::Types::Int64 i = stringsEnd; i < recordsOffset; ++i) {
+        stream.put('\0');
+    }
+
+    for (bsl::size_t i = 0; i < zones.size(); ++i) {
+        const Zoneinfo&        zone  = *zones[i];
+        const DescriptorTable& table = descriptors[i];
+
+        MappedFile::writeInt(stream, static_cast<int>(table.size()));
+        MappedFile::writeInt(stream, static_cast<int>(zone.numTransitions()));
+        MappedFile::writeInt(stream, base + posixOffsets[i]);
+
+        for (bsl::size_t j = 0; j < table.size(); ++j) {
+            MappedFile::writeInt(stream, table[j]->utcOffsetInSeconds());
+            MappedFile::writeInt(stream, table[j]->dstInEffectFlag());
+            MappedFile::writeInt(stream,
+                                 base + strings[table[j]->description()]);
+        }
+
+        for (Zoneinfo::TransitionConstIterator it = zone.beginTransitions();
+             it != zone.endTransitions();
+             ++it) {
+            const bsls::Types::Uint64 utcTime =
+                               static_cast<bsls::Types::Uint64>(it->utcTime());
+
+            MappedFile::writeInt(stream, static_cast<int>(utcTime >> 32));
+            MappedFile::writeInt(stream,
+                                 static_cast<int>(utcTime & 0xFFFFFFFF));
+            MappedFile::writeInt(stream,
+                                 findDescriptor(&descriptors[i],
+                                                it->descriptor()));
+        }
+    }
+
+    return stream.good() ? 0 : 3;
+}
+
+int MmapDataFileLoader::writeFromDirectory(bsl::ostream&  stream,
+                                           const char    *rootPath)
+{
+    BSLS_ASSERT(rootPath);
+
+    typedef bdls::FilesystemUtil Util;
+
+    bsl::vector<bsl::string> paths;
+    if (0 != Util::visitTree(rootPath,
+                             "*",
+                             bdlf::BindUtil::bind(&collectPath,
+                                                  &paths,
+                                                  bdlf::PlaceHolders::_1),
+                             true)) {
+        BSLS_LOG_ERROR("Failed to traverse time-zone directory '%s'",
+                       rootPath);
+        return 1;                                                     // RETURN
+    }
+
+    // 'visitTree' reports paths as 'rootPath', followed by a separator if
+    // 'rootPath' does not end with one, followed by the relative path.
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const char k_SEPARATOR = '\\';
+#else
+    const char k_SEPARATOR = '/';
+#endif
+
+    bsl::size_t prefixLength = bsl::strlen(rootPath);
+    if (0 == prefixLength || k_SEPARATOR != rootPath[prefixLength - 1]) {
+        ++prefixLength;
+    }
+
+    bsl::vector<Zoneinfo> timeZones;
+    timeZones.reserve(paths.size());
+
+    for (bsl::size_t i = 0; i < paths.size(); ++i) {
+        bsl::ifstream input(paths[i].c_str(),
+                            bsl::ifstream::binary | bsl::ifstream::in);
+        if (!input.is_open() || paths[i].size() <= prefixLength) {
+            continue;                                               // CONTINUE
+        }
+
+        Zoneinfo timeZone;
+        if (0 != ZoneinfoBinaryReader::read(&timeZone, input)) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::string identifier(paths[i], prefixLength);
+        bsl::replace(identifier.begin(),
+                     identifier.end(),
+                     k_SEPARATOR,
+                     '/');
+
+        timeZone.setIdentifier(identifier);
+        timeZones.push_back(timeZone);
+    }
+
+    return write(stream, timeZones);
+}
+
+// CREATORS
+MmapDataFileLoader::MmapDataFileLoader()
+{
+}
+
+MmapDataFileLoader::~MmapDataFileLoader()
+{
+}
+
+// MANIPULATORS
+int MmapDataFileLoader::initialize(const char *path)
+{
+    BSLS_ASSERT(path);
+
+    const int rc = d_file.map(path, k_MAGIC, k_VERSION, sizeof(RecordHeader));
+    if (1 == rc) {
+        BSLS_LOG_ERROR("Failed to open time-zone database '%s'", path);
+    }
+    else if (2 == rc) {
+        BSLS_LOG_ERROR("Invalid time-zone database size '%s'", path);
+    }
+    else if (3 == rc) {
+        BSLS_LOG_ERROR("Failed to map time-zone database '%s'", path);
+    }
+    else if (0 != rc) {
+        BSLS_LOG_ERROR("Corrupt time-zone database '%s'", path);
+    }
+    return rc;
+}
+
+int MmapDataFileLoader::loadTimeZone(Zoneinfo *result, const char *timeZoneId)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(timeZoneId);
+
+    const int recordOffset = d_file.findRecord(timeZoneId);
+    if (recordOffset < 0) {
+        return UNSUPPORTED_ID;                                        // RETURN
+    }
+
+    // Validate the record before decoding it.  Note that 'd_file' has
+    // verified that the record header is within the file.
+
+    const RecordHeader *header = reinterpret_cast<const RecordHeader *>(
+                                                 d_file.data() + recordOffset);
+
+    const int   numDescriptors = header->d_numDescriptors;
+    const int   numTransitions = header->d_numTransitions;
+    const char *posix          = d_file.findString(
+                                            header->d_posixDescriptionOffset);
+
+    if (numDescriptors < 0 || numTransitions < 0 || 0 == posix) {
+        BSLS_LOG_ERROR("Corrupt time-zone record for '%s'", timeZoneId);
+        return UNSPECIFIED_ERROR;                                     // RETURN
+    }
+
+    const bsls::Types::Int64 size =
+             sizeof(RecordHeader)
+           + static_cast<bsls::Types::Int64>(numDescriptors) *
+                                                            sizeof(Descriptor)
+           + static_cast<bsls::Types::Int64>(numTransitions) *
+                                                            sizeof(Transition);
+
+    if (size > static_cast<bsls::Types::Int64>(d_file.size()
+                                                          - recordOffset)) {
+        BSLS_LOG_ERROR("Corrupt time-zone record for '%s'", timeZoneId);
+        return UNSPECIFIED_ERROR;                                     // RETURN
+    }
+
+    const Descriptor *descriptors =
+                             reinterpret_cast<const Descriptor *>(header + 1);
+    const Transition *transitions =
+                      reinterpret_cast<const Transition *>(descriptors +
+                                                           numDescriptors);
+
+    bsl::vector<LocalTimeDescriptor> table(result->get_allocator());
+    table.reserve(numDescriptors);
+
+    for (int i = 0; i < numDescriptors; ++i) {
+        const int   utcOffset   = descriptors[i].d_utcOffsetInSeconds;
+        const int   dstFlag     = descriptors[i].d_dstInEffectFlag;
+        const char *description = d_file.findString(
+                                           descriptors[i].d_descriptionOffset);
+
+        if (!LocalTimeDescriptor::isValidUtcOffsetInSeconds(utcOffset)
+         || (0 != dstFlag && 1 != dstFlag)
+         || 0 == description) {
+            BSLS_LOG_ERROR("Corrupt time-zone record for '%s'", timeZoneId);
+            return UNSPECIFIED_ERROR;                                 // RETURN
+        }
+
+        table.push_back(LocalTimeDescriptor(utcOffset,
+                                            1 == dstFlag,
+                                            description));
+    }
+
+    Zoneinfo timeZone(result->get_allocator());
+    timeZone.setIdentifier(timeZoneId);
+    timeZone.setPosixExtendedRangeDescription(posix);
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const int index = transitions[i].d_descriptorIndex;
+        if (index < 0 || index >= numDescriptors) {
+            BSLS_LOG_ERROR("Corrupt time-zone record for '%s'", timeZoneId);
+            return UNSPECIFIED_ERROR;                                 // RETURN
+        }
+
+        const bsls::Types::Uint64 utcTime =
+             (static_cast<bsls::Types::Uint64>(
+                  static_cast<unsigned int>(transitions[i].d_utcTimeHigh))
+                                                                        << 32)
+           | static_cast<unsigned int>(transitions[i].d_utcTimeLow);
+
+        timeZone.addTransition(static_cast<bdlt::EpochUtil::TimeT64>(utcTime),
+                               table[index]);
+    }
+
+    result->swap(timeZone);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,276 @@
+// baltzo_mmapdatafileloader.h                                        -*-C++-*-
+#ifndef INCLUDED_BALTZO_MMAPDATAFILELOADER
+#define INCLUDED_BALTZO_MMAPDATAFILELOADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a 'baltzo::Loader' for a memory-mapped time-zone database.
+//
+//@CLASSES:
+//  baltzo::MmapDataFileLoader: loader for a single-file mapped zone database
+//
+//@SEE_ALSO: baltzo_datafileloader, baltzo_zoneinfobinaryreader,
+//           bdls_mappedrecordfile
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'baltzo::MmapDataFileLoader', that is a concrete implementation of the
+// 'baltzo::Loader' protocol for loading, into a 'baltzo::Zoneinfo' object,
+// the properties of a time zone described in a single, pre-compiled, indexed
+// time-zone database file.  The following inheritance hierarchy diagram shows
+// the classes involved and their methods:
+//..
+//   ,--------------------------.
+//  ( baltzo::MmapDataFileLoader )
+//   `--------------------------'
+//              |      write
+//              |      writeFromDirectory
+//              |      ctor
+//              |      initialize
+//              |      isInitialized
+//              |      numTimeZones
+//              V
+//       ,--------------.
+//      ( baltzo::Loader )
+//       `--------------'
+//                     dtor
+//                     loadTimeZone
+//..
+// Whereas 'baltzo::DataFileLoader' opens, reads, and parses a separate
+// Zoneinfo binary (TZif) file for each time zone, 'baltzo::MmapDataFileLoader'
+// maps one database file read-only into the address space of the process when
+// it is initialized, and 'loadTimeZone' decodes the requested time zone
+// directly from the mapped pages: no file is opened, and no TZif data is
+// parsed, after initialization.  The mapping is shared, so every process on a
+// host that maps the same database shares a single copy of its pages in the
+// operating system's page cache.  Note that 'baltzo::Zoneinfo' owns its
+// storage, so the transitions of a time zone are copied out of the mapping
+// when that time zone is loaded (typically once per process, by a
+// 'baltzo::ZoneinfoCache').
+//
+///Building a Database
+///-------------------
+// A database is built from a directory hierarchy of Zoneinfo binary files
+// (see 'baltzo_datafileloader') by 'writeFromDirectory', which reads every
+// Zoneinfo binary file in the hierarchy and identifies each time zone by the
+// path of its file relative to the root of the hierarchy (e.g.,
+// "America/New_York").  Files that are not Zoneinfo binary files (e.g.,
+// "zone.tab") are skipped.  Alternatively, 'write' stores an arbitrary set of
+// 'baltzo::Zoneinfo' objects.  The sample application
+// 'baltzo-mmapdatabase.m.cpp' wraps 'writeFromDirectory' in a command-line
+// tool suitable for a deployment step.
+//
+///File Format
+///- - - - - -
+// All integer fields of a database file are 32-bit signed values stored in
+// network (big-endian) byte order, so that a database is portable across
+// platforms; 64-bit transition times are stored as two such fields, most
+// significant first.  A file consists of a header, a directory of time-zone
+// identifiers sorted in increasing lexicographic order, a table of
+// null-terminated strings shared by all time zones, and one record per time
+// zone, laid out (and, except for the records, validated) as a
+// 'bdls::MappedRecordFile':
+//..
+//  header:      "BTZD" | version | numTimeZones | fileSize
+//  directory:   numTimeZones * { identifierOffset | recordOffset }
+//  strings:     null-terminated strings
+//  record:      numDescriptors | numTransitions | posixDescriptionOffset |
+//               numDescriptors * { utcOffsetInSeconds | dstInEffectFlag |
+//                                  descriptionOffset } |
+//               numTransitions * { utcTimeHigh | utcTimeLow |
+//                                  descriptorIndex }
+//..
+// All string offsets are relative to the start of the file.  The header and
+// directory are validated by 'initialize'; each record is validated when it is
+// loaded.
+//
+///Thread Safety
+///-------------
+// 'baltzo::MmapDataFileLoader' is *not* thread-safe while it is being
+// initialized.  Once 'initialize' has returned successfully, 'loadTimeZone'
+// only reads the mapped file and may be called concurrently from multiple
+// threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Loading Time Zones from a Database File
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a deployment step builds a time-zone database once per host,
+// and that the processes on the host load their time zones from it.
+//
+// First, the deployment step describes the time zones to be stored.  In
+// practice, 'writeFromDirectory' would be used to compile the system's
+// Zoneinfo directory:
+//..
+//  baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+//  baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+//
+//  bsl::vector<baltzo::Zoneinfo> timeZones(1);
+//  baltzo::Zoneinfo& newYork = timeZones[0];
+//  newYork.setIdentifier("America/New_York");
+//  typedef bdlt::EpochUtil EU;
+//  newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(1, 1, 1)), est);
+//  newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(2026, 3, 8, 7)),
+//                        edt);
+//  newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(2026, 11, 1, 6)),
+//                        est);
+//  newYork.setPosixExtendedRangeDescription("EST5EDT,M3.2.0,M11.1.0");
+//..
+// Then, the time zones are written to the database file:
+//..
+//  bsl::ofstream output(fileName, bsl::ios::binary);
+//  int rc = baltzo::MmapDataFileLoader::write(output, timeZones);
+//  assert(0 == rc);
+//  output.close();
+//..
+// Next, each process maps the database and uses it to supply a
+// 'baltzo::ZoneinfoCache':
+//..
+//  baltzo::MmapDataFileLoader loader;
+//  rc = loader.initialize(fileName);
+//  assert(0 == rc);
+//  assert(1 == loader.numTimeZones());
+//
+//  baltzo::ZoneinfoCache cache(&loader);
+//..
+// Finally, we look up a time zone and observe that it has the stored value,
+// and that an identifier that is not in the database is not supported:
+//..
+//  const baltzo::Zoneinfo *timeZone = cache.getZoneinfo("America/New_York");
+//  assert(timeZone);
+//  assert(newYork == *timeZone);
+//
+//  rc = 0;
+//  assert(0 == cache.getZoneinfo(&rc, "Europe/Nowhere"));
+//  assert(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+//..
+
+#include <balscm_version.h>
+
+#include <baltzo_loader.h>
+
+#include <bdls_mappedrecordfile.h>
+
+#include <bsls_keyword.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+class Zoneinfo;
+
+                         // ========================
+                         // class MmapDataFileLoader
+                         // ========================
+
+class MmapDataFileLoader : public Loader {
+    // This class provides a concrete implementation of the 'baltzo::Loader'
+    // protocol that loads time zones from a pre-compiled time-zone database
+    // file that is memory-mapped read-only.  See {File Format}.
+
+    // DATA
+    bdls::MappedRecordFile d_file;  // mapped database file, if initialized
+
+  private:
+    // NOT IMPLEMENTED
+    MmapDataFileLoader(const MmapDataFileLoader&);
+    MmapDataFileLoader& operator=(const MmapDataFileLoader&);
+
+  public:
+    // CLASS METHODS
+    static int write(bsl::ostream&                 stream,
+                     const bsl::vector<Zoneinfo>&  timeZones);
+        // Write, to the specified 'stream', a database file containing each
+        // of the specified 'timeZones' under its 'identifier'.  Return 0 on
+        // success, and a non-zero value if two time zones have the same
+        // identifier, an identifier is empty, or the stream fails.
+
+    static int writeFromDirectory(bsl::ostream&  stream,
+                                  const char    *rootPath);
+        // Write, to the specified 'stream', a database file containing every
+        // Zoneinfo binary file in the directory hierarchy at the specified
+        // 'rootPath', each identified by its path relative to 'rootPath'
+        // using '/' as the separator.  Files that are not Zoneinfo binary
+        // files are skipped.  Return 0 on success, and a non-zero value if
+        // 'rootPath' is not a directory or the stream fails.
+
+    // CREATORS
+    MmapDataFileLoader();
+        // Create an uninitialized loader.  Note that an uninitialized loader
+        // reports every time-zone identifier as unsupported.
+
+    ~MmapDataFileLoader() BSLS_KEYWORD_OVERRIDE;
+        // Unmap the database file, if any, and destroy this loader.
+
+    // MANIPULATORS
+    int initialize(const char *path);
+        // Map the database file at the specified 'path' and validate its
+        // header and directory.  Return 0 on success, and a non-zero value
+        // (with no effect on the state of this loader) otherwise.  On success,
+        // any file previously mapped by this loader is unmapped.
+
+    int loadTimeZone(Zoneinfo *result, const char *timeZoneId)
+                                                         BSLS_KEYWORD_OVERRIDE;
+        // Load into the specified 'result' the time-zone information for the
+        // time zone identified by the specified 'timeZoneId'.  Return 0 on
+        // success, and a non-zero value otherwise.  A return status of
+        // 'ErrorCode::k_UNSUPPORTED_ID' indicates that 'timeZoneId' is not in
+        // the mapped database (or that this loader is not initialized).  If
+        // an error occurs during this operation, 'result' will be left in a
+        // valid, but unspecified state.
+
+    // ACCESSORS
+    bool isInitialized() const;
+        // Return 'true' if this loader has mapped a database file, and
+        // 'false' otherwise.
+
+    int numTimeZones() const;
+        // Return the number of time zones in the mapped database file, or 0
+        // if this loader is not initialized.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class MmapDataFileLoader
+                         // ------------------------
+
+// ACCESSORS
+inline
+bool MmapDataFileLoader::isInitialized() const
+{
+    return d_file.isMapped();
+}
+
+inline
+int MmapDataFileLoader::numTimeZones() const
+{
+    return d_file.numRecords();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
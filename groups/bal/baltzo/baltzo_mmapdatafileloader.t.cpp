@@ -0,0 +1,887 @@
+// baltzo_mmapdatafileloader.t.cpp                                    -*-C++-*-
+#include <baltzo_mmapdatafileloader.h>
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfobinaryreader.h>
+#include <baltzo_zoneinfocache.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a time-zone loader that maps a database file
+// written by its own 'write' and 'writeFromDirectory' class methods.  We test
+// that time zones exercising every part of the file format survive a round
+// trip through 'write', 'initialize', and 'loadTimeZone'; that a database
+// compiled from a directory of Zoneinfo binary files loads the same values as
+// reading those files directly; that unknown identifiers are reported as
+// unsupported; and that corrupt headers, directories, and records are
+// rejected.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int write(bsl::ostream& stream, const bsl::vector<Zoneinfo>& zones);
+// [ 3] int writeFromDirectory(bsl::ostream& stream, const char *rootPath);
+//
+// CREATORS
+// [ 2] MmapDataFileLoader();
+// [ 2] ~MmapDataFileLoader();
+//
+// MANIPULATORS
+// [ 2] int initialize(const char *path);
+// [ 2] int loadTimeZone(Zoneinfo *result, const char *timeZoneId);
+//
+// ACCESSORS
+// [ 2] bool isInitialized() const;
+// [ 2] int numTimeZones() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CORRUPT FILES
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::MmapDataFileLoader  Obj;
+typedef baltzo::LocalTimeDescriptor Descriptor;
+typedef bdlt::EpochUtil::TimeT64    TimeT64;
+
+// ============================================================================
+//                          GLOBAL TEST DATA
+// ----------------------------------------------------------------------------
+
+static const unsigned char ASIA_BANGKOK_DATA[] = {
+    0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xa2, 0x6a, 0x67, 0xc4,
+    0x01, 0x00, 0x00, 0x5e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x62, 0x70, 0x00,
+    0x04, 0x42, 0x4d, 0x54, 0x00, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
+    0xff, 0x56, 0xb6, 0x85, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x6a, 0x67,
+    0xc4, 0x01, 0x02, 0x00, 0x00, 0x5e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x5e,
+    0x3c, 0x00, 0x04, 0x00, 0x00, 0x62, 0x70, 0x00, 0x08, 0x4c, 0x4d, 0x54,
+    0x00, 0x42, 0x4d, 0x54, 0x00, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x49, 0x43, 0x54, 0x2d, 0x37, 0x0a
+};
+
+// ============================================================================
+//                           TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "baltzo_mmapdatafileloader." << bdls::ProcessUtil::getProcessId()
+        << "." << test << ".tmp";
+    return oss.str();
+}
+
+static
+void writeFile(const bsl::string& fileName, const bsl::string& contents)
+    // Write the specified 'contents' to the file having the specified
+    // 'fileName', replacing any existing file.
+{
+    bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+    output.write(contents.data(), contents.size());
+}
+
+static
+int getInt(const bsl::string& contents, bsl::size_t position)
+    // Return the big-endian 32-bit integer at the specified 'position' in the
+    // specified 'contents'.
+{
+    unsigned int value = 0;
+    for (bsl::size_t i = 0; i < 4; ++i) {
+        value = (value << 8)
+              | static_cast<unsigned char>(contents[position + i]);
+    }
+    return static_cast<int>(value);
+}
+
+static
+void setInt(bsl::string *contents, bsl::size_t position, int value)
+    // Store the specified 'value' as a big-endian 32-bit integer at the
+    // specified 'position' in the specified 'contents'.
+{
+    unsigned int bits = static_cast<unsigned int>(value);
+    for (bsl::size_t i = 4; i > 0; --i) {
+        (*contents)[position + i - 1] = static_cast<char>(bits & 0xFF);
+        bits >>= 8;
+    }
+}
+
+static
+TimeT64 toTimeT64(int year, int month, int day, int hour = 0)
+    // Return the number of seconds from the epoch to the specified 'year',
+    // 'month', 'day', and optionally specified 'hour'.
+{
+    return bdlt::EpochUtil::convertToTimeT64(
+                                   bdlt::Datetime(year, month, day, hour));
+}
+
+static
+void populate(bsl::vector<baltzo::Zoneinfo> *timeZones)
+    // Load, into the specified 'timeZones', a set of time zones that
+    // exercises every part of the database file format.
+{
+    const Descriptor gmt(0, false, "GMT");
+    const Descriptor est(-5 * 3600, false, "EST");
+    const Descriptor edt(-4 * 3600, true,  "EDT");
+    const Descriptor ist( 5 * 3600 + 1800, false, "IST");
+    const Descriptor lmt(-17762, false, "LMT");
+    const Descriptor far( 86399, true, "");
+
+    // A time zone with a single transition and no POSIX description.
+
+    baltzo::Zoneinfo utc;
+    utc.setIdentifier("Etc/UTC");
+    utc.addTransition(toTimeT64(1, 1, 1), gmt);
+    timeZones->push_back(utc);
+
+    // A time zone with many transitions sharing few descriptors.
+
+    baltzo::Zoneinfo newYork;
+    newYork.setIdentifier("America/New_York");
+    newYork.addTransition(toTimeT64(1, 1, 1), lmt);
+    newYork.addTransition(toTimeT64(1883, 11, 18, 17), est);
+    for (int year = 1970; year < 2038; ++year) {
+        newYork.addTransition(toTimeT64(year, 3, 10, 7), edt);
+        newYork.addTransition(toTimeT64(year, 11, 3, 6), est);
+    }
+    newYork.setPosixExtendedRangeDescription("EST5EDT,M3.2.0,M11.1.0");
+    timeZones->push_back(newYork);
+
+    // A time zone sharing descriptions with another, and with transitions
+    // at the extremes of the 64-bit range.
+
+    baltzo::Zoneinfo odd;
+    odd.setIdentifier("Test/Extremes");
+    odd.addTransition(bsl::numeric_limits<TimeT64>::min(), est);
+    odd.addTransition(-1, far);
+    odd.addTransition(0, ist);
+    odd.addTransition(0xFFFFFFFFLL, gmt);
+    odd.addTransition(bsl::numeric_limits<TimeT64>::max(), edt);
+    odd.setPosixExtendedRangeDescription("IST-5:30");
+    timeZones->push_back(odd);
+
+    // A time zone with no transitions.
+
+    baltzo::Zoneinfo empty;
+    empty.setIdentifier("Test/Empty");
+    timeZones->push_back(empty);
+
+    // Many small time zones, so that the directory search has some depth.
+
+    for (int i = 0; i < 100; ++i) {
+        bsl::ostringstream name;
+        name << "Zone/" << i;
+
+        baltzo::Zoneinfo zone;
+        zone.setIdentifier(name.str());
+        zone.addTransition(toTimeT64(1, 1, 1), gmt);
+        zone.addTransition(toTimeT64(2000, 1, 1) + i,
+                           Descriptor(i * 60, 0 == i % 2, name.str()));
+        timeZones->push_back(zone);
+    }
+}
+
+static
+void verifyEqual(const baltzo::Zoneinfo& expected,
+                 const baltzo::Zoneinfo& actual,
+                 int                     line)
+    // Verify that the specified 'actual' time zone has the same identifier,
+    // POSIX extended-range description, and transitions as the specified
+    // 'expected' time zone, reporting failures at the specified 'line'.
+{
+    ASSERTV(line, expected.identifier(), expected == actual);
+    ASSERTV(line,
+            expected.identifier(),
+            expected.posixExtendedRangeDescription() ==
+                                       actual.posixExtendedRangeDescription());
+    ASSERTV(line,
+            expected.identifier(),
+            expected.numTransitions() == actual.numTransitions());
+
+    baltzo::Zoneinfo::TransitionConstIterator it = expected.beginTransitions();
+    baltzo::Zoneinfo::TransitionConstIterator jt = actual.beginTransitions();
+    for (; it != expected.endTransitions() && jt != actual.endTransitions();
+         ++it, ++jt) {
+        ASSERTV(line, it->utcTime(), it->utcTime() == jt->utcTime());
+        ASSERTV(line, it->utcTime(), it->descriptor() == jt->descriptor());
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string fileNameString = tempFileName(test);
+        const char *fileName = fileNameString.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Loading Time Zones from a Database File
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a deployment step builds a time-zone database once per host,
+// and that the processes on the host load their time zones from it.
+//
+// First, the deployment step describes the time zones to be stored.  In
+// practice, 'writeFromDirectory' would be used to compile the system's
+// Zoneinfo directory:
+//..
+    baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+    baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+
+    bsl::vector<baltzo::Zoneinfo> timeZones(1);
+    baltzo::Zoneinfo& newYork = timeZones[0];
+    newYork.setIdentifier("America/New_York");
+    typedef bdlt::EpochUtil EU;
+    newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(1, 1, 1)), est);
+    newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(2026, 3, 8, 7)),
+                          edt);
+    newYork.addTransition(EU::convertToTimeT64(bdlt::Datetime(2026, 11, 1, 6)),
+                          est);
+    newYork.setPosixExtendedRangeDescription("EST5EDT,M3.2.0,M11.1.0");
+//..
+// Then, the time zones are written to the database file:
+//..
+    bsl::ofstream output(fileName, bsl::ios::binary);
+    int rc = baltzo::MmapDataFileLoader::write(output, timeZones);
+    ASSERT(0 == rc);
+    output.close();
+//..
+// Next, each process maps the database and uses it to supply a
+// 'baltzo::ZoneinfoCache':
+//..
+    baltzo::MmapDataFileLoader loader;
+    rc = loader.initialize(fileName);
+    ASSERT(0 == rc);
+    ASSERT(1 == loader.numTimeZones());
+
+    baltzo::ZoneinfoCache cache(&loader);
+//..
+// Finally, we look up a time zone and observe that it has the stored value,
+// and that an identifier that is not in the database is not supported:
+//..
+    const baltzo::Zoneinfo *timeZone = cache.getZoneinfo("America/New_York");
+    ASSERT(timeZone);
+    ASSERT(newYork == *timeZone);
+
+    rc = 0;
+    ASSERT(0 == cache.getZoneinfo(&rc, "Europe/Nowhere"));
+    ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+//..
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CORRUPT FILES
+        //
+        // Concerns:
+        //: 1 'initialize' fails, leaving the loader unchanged, if the file
+        //:   does not exist, is too short, or has a bad magic number,
+        //:   version, size, directory entry, or identifier order.
+        //:
+        //: 2 'loadTimeZone' returns a non-zero value other than
+        //:   'k_UNSUPPORTED_ID' for a corrupt record.
+        //
+        // Plan:
+        //: 1 Write a valid file to a string, corrupt one field at a time,
+        //:   and verify that 'initialize' fails and that a previously mapped
+        //:   file remains usable.  (C-1)
+        //:
+        //: 2 Corrupt one field of a record at a time and verify the status
+        //:   returned by 'loadTimeZone'.  (C-2)
+        //
+        // Testing:
+        //   CORRUPT FILES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CORRUPT FILES" << endl
+                                  << "=============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        bsl::vector<baltzo::Zoneinfo> timeZones(2);
+        timeZones[0].setIdentifier("A");
+        timeZones[0].addTransition(toTimeT64(1, 1, 1),
+                                   Descriptor(3600, true, "A1"));
+        timeZones[0].setPosixExtendedRangeDescription("P");
+        timeZones[1].setIdentifier("B");
+
+        bsl::ostringstream oss;
+        ASSERT(0 == Obj::write(oss, timeZones));
+        const bsl::string GOOD = oss.str();
+
+        ASSERT(GOOD.size() == static_cast<bsl::size_t>(getInt(GOOD, 12)));
+
+        const int UNSUPPORTED = baltzo::ErrorCode::k_UNSUPPORTED_ID;
+
+        if (verbose) cout << "\tTesting corrupt headers." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.initialize("no/such/time/zone/database"));
+            ASSERT(false == X.isInitialized());
+
+            writeFile(fileName, GOOD);
+            ASSERT(0 == mX.initialize(fileName.c_str()));
+            ASSERT(2 == X.numTimeZones());
+
+            const int ID_A     = getInt(GOOD, 16);
+            const int RECORD_A = getInt(GOOD, 20);
+
+            ASSERT(0 == RECORD_A % 4);
+
+            const struct {
+                int d_line;
+                int d_position;  // -1 to truncate to 'd_value' bytes
+                int d_value;
+            } DATA[] = {
+                //LINE  POSITION  VALUE
+                //----  --------  ----------
+                { L_,         -1,          0 },
+                { L_,         -1,          8 },
+                { L_,         -1,         15 },
+                { L_,          0, 0x58545a44 },  // "XTZD"
+                { L_,          4,          2 },
+                { L_,          8,         -1 },
+                { L_,          8, 0x10000000 },
+                { L_,         12,          0 },
+                { L_,         16,          0 },
+                { L_,         16,         20 },  // within the directory
+                { L_,         16, 0x7FFFFFF0 },
+                { L_,         20,          2 },
+                { L_,         20,   ID_A + 1 },
+                { L_,         20, 0x7FFFFFF0 },
+                { L_,         20,         -4 },
+                { L_,         24,       ID_A },  // duplicate identifier
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int POSITION = DATA[ti].d_position;
+                const int VALUE    = DATA[ti].d_value;
+
+                if (veryVerbose) { T_ P_(LINE) P_(POSITION) P(VALUE) }
+
+                bsl::string contents = GOOD;
+                if (0 > POSITION) {
+                    contents.resize(VALUE);
+                }
+                else {
+                    setInt(&contents, POSITION, VALUE);
+                }
+
+                const bsl::string otherFile = fileName + ".bad";
+                writeFile(otherFile, contents);
+                ASSERTV(LINE, 0 != mX.initialize(otherFile.c_str()));
+                bdls::FilesystemUtil::remove(otherFile);
+
+                ASSERTV(LINE, X.isInitialized());
+                ASSERTV(LINE, 2 == X.numTimeZones());
+
+                baltzo::Zoneinfo result;
+                ASSERTV(LINE, 0 == mX.loadTimeZone(&result, "A"));
+                ASSERTV(LINE, timeZones[0] == result);
+            }
+
+            // Identifiers out of order are rejected.
+
+            bsl::string contents = GOOD;
+            const int   idB      = getInt(GOOD, 24);
+            setInt(&contents, 16, idB);
+            setInt(&contents, 24, ID_A);
+            writeFile(fileName, contents);
+            ASSERT(0 != mX.initialize(fileName.c_str()));
+        }
+
+        if (verbose) cout << "\tTesting corrupt records." << endl;
+        {
+            const int RECORD = getInt(GOOD, 20);
+
+            const struct {
+                int d_line;
+                int d_offset;     // offset of the field within the record
+                int d_value;
+                int d_expected;   // 0 for success, -1 for any other failure
+            } DATA[] = {
+                //LINE  OFFSET  VALUE       EXP
+                //----  ------  ----------  ---
+                { L_,        0,         -1,  -1 },  // numDescriptors
+                { L_,        0, 0x10000000,  -1 },
+                { L_,        0,          0,  -1 },
+                { L_,        4,         -1,  -1 },  // numTransitions
+                { L_,        4, 0x10000000,  -1 },
+                { L_,        4,          0,   0 },
+                { L_,        8,          0,  -1 },  // posixDescriptionOffset
+                { L_,        8, 0x7FFFFFF0,  -1 },
+                { L_,       12,      86400,  -1 },  // utcOffsetInSeconds
+                { L_,       12,     -86400,  -1 },
+                { L_,       12,     -86399,   0 },
+                { L_,       16,          2,  -1 },  // dstInEffectFlag
+                { L_,       16,          0,   0 },
+                { L_,       20,         -1,  -1 },  // descriptionOffset
+                { L_,       32,          1,  -1 },  // descriptorIndex
+                { L_,       32,         -1,  -1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int OFFSET = DATA[ti].d_offset;
+                const int VALUE  = DATA[ti].d_value;
+                const int EXP    = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P_(OFFSET) P(VALUE) }
+
+                bsl::string contents = GOOD;
+                setInt(&contents, RECORD + OFFSET, VALUE);
+                writeFile(fileName, contents);
+
+                Obj mX;
+                ASSERTV(LINE, 0 == mX.initialize(fileName.c_str()));
+
+                baltzo::Zoneinfo result;
+                const int        rc = mX.loadTimeZone(&result, "A");
+                if (0 == EXP) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                }
+                else {
+                    ASSERTV(LINE, rc, 0 != rc && UNSUPPORTED != rc);
+                }
+
+                ASSERTV(LINE, 0 == mX.loadTimeZone(&result, "B"));
+                ASSERTV(LINE, timeZones[1] == result);
+            }
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WRITE FROM DIRECTORY
+        //
+        // Concerns:
+        //: 1 Every Zoneinfo binary file in the hierarchy is stored, under its
+        //:   path relative to the root using '/' as the separator.
+        //:
+        //: 2 Files that are not Zoneinfo binary files are skipped.
+        //:
+        //: 3 A loaded time zone has the value obtained by reading its file
+        //:   with 'baltzo::ZoneinfoBinaryReader'.
+        //:
+        //: 4 The root path may end with a separator.
+        //:
+        //: 5 A root path that is not a directory is reported as an error.
+        //
+        // Plan:
+        //: 1 Create a directory hierarchy holding copies of a Zoneinfo binary
+        //:   file and a text file, build a database from it, and compare the
+        //:   loaded time zones with the result of reading the binary file
+        //:   directly.  (C-1..4)
+        //:
+        //: 2 Call 'writeFromDirectory' with a missing directory.  (C-5)
+        //
+        // Testing:
+        //   int writeFromDirectory(bsl::ostream& stream, const char *root);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "WRITE FROM DIRECTORY" << endl
+                                  << "====================" << endl;
+
+        typedef bdls::FilesystemUtil Util;
+
+        const bsl::string fileName = tempFileName(test);
+        const bsl::string root     = fileName + ".dir";
+
+        bsl::string asia(root);
+        bdls::PathUtil::appendRaw(&asia, "Asia");
+        bsl::string etc(root);
+        bdls::PathUtil::appendRaw(&etc, "Etc");
+        ASSERT(0 == Util::createDirectories(asia, true));
+        ASSERT(0 == Util::createDirectories(etc, true));
+
+        const bsl::string data(reinterpret_cast<const char *>(
+                                                           ASIA_BANGKOK_DATA),
+                               sizeof ASIA_BANGKOK_DATA);
+
+        static const char *const FILES[] = {
+            "Asia/Bangkok", "Asia/Saigon", "Etc/ICT"
+        };
+        const int NUM_FILES = sizeof FILES / sizeof *FILES;
+
+        for (int i = 0; i < NUM_FILES; ++i) {
+            bsl::string path(root);
+            bdls::PathUtil::appendRaw(&path, FILES[i]);
+            writeFile(path, data);
+        }
+
+        bsl::string zoneTab(root);
+        bdls::PathUtil::appendRaw(&zoneTab, "zone.tab");
+        writeFile(zoneTab, "TH\t+1345+10031\tAsia/Bangkok\n");
+
+        baltzo::Zoneinfo expected;
+        {
+            bsl::istringstream input(data);
+            ASSERT(0 == baltzo::ZoneinfoBinaryReader::read(&expected, input));
+        }
+
+        const bsl::string ROOTS[] = { root, root + "/" };
+
+        for (int ri = 0; ri < 2; ++ri) {
+            if (veryVerbose) { T_ P(ROOTS[ri]) }
+
+            {
+                bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+                ASSERT(0 == Obj::writeFromDirectory(output,
+                                                    ROOTS[ri].c_str()));
+            }
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(ri, 0 == mX.initialize(fileName.c_str()));
+            ASSERTV(ri, X.numTimeZones(), NUM_FILES == X.numTimeZones());
+
+            for (int i = 0; i < NUM_FILES; ++i) {
+                expected.setIdentifier(FILES[i]);
+
+                baltzo::Zoneinfo result;
+                ASSERTV(ri, FILES[i], 0 == mX.loadTimeZone(&result, FILES[i]));
+                verifyEqual(expected, result, L_);
+            }
+
+            baltzo::Zoneinfo result;
+            ASSERTV(ri, baltzo::ErrorCode::k_UNSUPPORTED_ID ==
+                                         mX.loadTimeZone(&result, "zone.tab"));
+        }
+
+        {
+            bsl::ostringstream output;
+            ASSERT(0 != Obj::writeFromDirectory(output, zoneTab.c_str()));
+            ASSERT(0 != Obj::writeFromDirectory(
+                                             output,
+                                             (root + ".missing").c_str()));
+        }
+
+        Util::remove(root, true);
+        Util::remove(fileName);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP
+        //
+        // Concerns:
+        //: 1 A time zone loaded from a database is equal to the time zone
+        //:   that was written, including its POSIX extended-range description
+        //:   and the descriptor of each transition.
+        //:
+        //: 2 Transition times at the limits of the 64-bit range, empty
+        //:   descriptions, and time zones without transitions are supported.
+        //:
+        //: 3 Loading an identifier that is not in the database, or loading
+        //:   from an uninitialized loader, returns 'k_UNSUPPORTED_ID'.
+        //:
+        //: 4 'write' rejects empty and duplicate identifiers.
+        //:
+        //: 5 Re-initializing a loader maps the new file.
+        //
+        // Plan:
+        //: 1 Write a set of time zones covering each concern, map the file,
+        //:   and compare each loaded time zone with the original.  (C-1..3)
+        //:
+        //: 2 Call 'write' with empty and duplicate identifiers.  (C-4)
+        //:
+        //: 3 Write a second file and re-initialize the loader.  (C-5)
+        //
+        // Testing:
+        //   int write(bsl::ostream& s, const bsl::vector<Zoneinfo>& zones);
+        //   MmapDataFileLoader();
+        //   ~MmapDataFileLoader();
+        //   int initialize(const char *path);
+        //   int loadTimeZone(Zoneinfo *result, const char *timeZoneId);
+        //   bool isInitialized() const;
+        //   int numTimeZones() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ROUND TRIP" << endl
+                                  << "==========" << endl;
+
+        const int UNSUPPORTED = baltzo::ErrorCode::k_UNSUPPORTED_ID;
+
+        const bsl::string fileName = tempFileName(test);
+
+        bsl::vector<baltzo::Zoneinfo> timeZones;
+        populate(&timeZones);
+
+        {
+            bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+            ASSERT(0 == Obj::write(output, timeZones));
+        }
+
+        Obj mX;  const Obj& X = mX;
+
+        {
+            baltzo::Zoneinfo result;
+            ASSERT(UNSUPPORTED == mX.loadTimeZone(&result, "Etc/UTC"));
+        }
+
+        ASSERT(0 == mX.initialize(fileName.c_str()));
+        ASSERT(true == X.isInitialized());
+        ASSERT(static_cast<int>(timeZones.size()) == X.numTimeZones());
+
+        for (bsl::size_t i = 0; i < timeZones.size(); ++i) {
+            const baltzo::Zoneinfo& EXP = timeZones[i];
+
+            if (veryVerbose) { T_ P(EXP.identifier()) }
+
+            baltzo::Zoneinfo result;
+            result.setPosixExtendedRangeDescription("STALE");
+            result.addTransition(12345, Descriptor(60, false, "STALE"));
+
+            ASSERTV(EXP.identifier(),
+                    0 == mX.loadTimeZone(&result, EXP.identifier().c_str()));
+            verifyEqual(EXP, result, L_);
+        }
+
+        static const char *const MISSING[] = {
+            "", "America", "America/New_York ", "Etc/UTC/", "Zone/100",
+            "Zone/", "ZZZ", "A"
+        };
+        for (bsl::size_t i = 0; i < sizeof MISSING / sizeof *MISSING; ++i) {
+            baltzo::Zoneinfo result;
+            ASSERTV(MISSING[i],
+                    UNSUPPORTED == mX.loadTimeZone(&result, MISSING[i]));
+        }
+
+        if (verbose) cout << "\tTesting invalid identifiers." << endl;
+        {
+            bsl::vector<baltzo::Zoneinfo> bad(2);
+            bad[0].setIdentifier("X");
+            bad[1].setIdentifier("X");
+
+            bsl::ostringstream output;
+            ASSERT(0 != Obj::write(output, bad));
+
+            bad[1].setIdentifier("");
+            ASSERT(0 != Obj::write(output, bad));
+
+            bad[1].setIdentifier("Y");
+            ASSERT(0 == Obj::write(output, bad));
+        }
+
+        if (verbose) cout << "\tTesting re-initialization." << endl;
+        {
+            bsl::vector<baltzo::Zoneinfo> other(1, timeZones[0]);
+            other[0].setIdentifier("Other/UTC");
+
+            const bsl::string otherFile = fileName + ".2";
+            {
+                bsl::ofstream output(otherFile.c_str(), bsl::ios::binary);
+                ASSERT(0 == Obj::write(output, other));
+            }
+
+            ASSERT(0 == mX.initialize(otherFile.c_str()));
+            ASSERT(1 == X.numTimeZones());
+
+            baltzo::Zoneinfo result;
+            ASSERT(0 == mX.loadTimeZone(&result, "Other/UTC"));
+            verifyEqual(other[0], result, L_);
+            ASSERT(UNSUPPORTED == mX.loadTimeZone(&result, "Etc/UTC"));
+
+            bdls::FilesystemUtil::remove(otherFile);
+        }
+
+        if (verbose) cout << "\tTesting an empty database." << endl;
+        {
+            bsl::ostringstream oss;
+            ASSERT(0 == Obj::write(oss, bsl::vector<baltzo::Zoneinfo>()));
+            writeFile(fileName, oss.str());
+
+            Obj mY;  const Obj& Y = mY;
+            ASSERT(0 == mY.initialize(fileName.c_str()));
+            ASSERT(0 == Y.numTimeZones());
+
+            baltzo::Zoneinfo result;
+            ASSERT(UNSUPPORTED == mY.loadTimeZone(&result, "Etc/UTC"));
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write, map, and load a single time zone.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        bsl::vector<baltzo::Zoneinfo> timeZones(1);
+        timeZones[0].setIdentifier("Asia/Tokyo");
+        timeZones[0].addTransition(toTimeT64(1, 1, 1),
+                                   Descriptor(9 * 3600, false, "JST"));
+        timeZones[0].setPosixExtendedRangeDescription("JST-9");
+
+        {
+            bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+            ASSERT(0 == Obj::write(output, timeZones));
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(false == X.isInitialized());
+        ASSERT(0     == X.numTimeZones());
+
+        ASSERT(0     == mX.initialize(fileName.c_str()));
+        ASSERT(true  == X.isInitialized());
+        ASSERT(1     == X.numTimeZones());
+
+        baltzo::Zoneinfo result;
+        ASSERT(0 == mX.loadTimeZone(&result, "Asia/Tokyo"));
+        verifyEqual(timeZones[0], result, L_);
+        ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID ==
+                                     mX.loadTimeZone(&result, "Asia/Seoul"));
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -9,6 +9,7 @@ BSLS_IDENT_RCSID(baltzo_timezoneutil_cpp,"$Id$ $CSID$")
 #include <baltzo_localtimeperiod.h>
 #include <baltzo_testloader.h>                // for testing
 #include <baltzo_timezoneutilimp.h>
+#include <baltzo_zoneinfocache.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -63,6 +64,44 @@ int TimeZoneUtil::convertUtcToLocalTime(
     return 0;
 }
 
+int TimeZoneUtil::convertUtcToLocalTimes(
+                                       bdlt::DatetimeTz      *resultTimes,
+                                       const char            *targetTimeZoneId,
+                                       const bdlt::Datetime  *utcTimes,
+                                       int                    numTimes)
+{
+    BSLS_ASSERT(targetTimeZoneId);
+
+    const Zoneinfo *timeZone;
+    const int       rc = loadTimeZone(&timeZone, targetTimeZoneId);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    return ZoneinfoUtil::convertUtcToLocalTimes(resultTimes,
+                                                utcTimes,
+                                                numTimes,
+                                                *timeZone);
+}
+
+int TimeZoneUtil::convertUtcToLocalTimes(
+                              bdlt::DatetimeTz               *resultTimes,
+                              const char                     *targetTimeZoneId,
+                              const bdlt::EpochUtil::TimeT64 *utcTimes,
+                              int                             numTimes)
+{
+    BSLS_ASSERT(targetTimeZoneId);
+
+    const Zoneinfo *timeZone;
+    const int       rc = loadTimeZone(&timeZone, targetTimeZoneId);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    return ZoneinfoUtil::convertUtcToLocalTimes(resultTimes,
+                                                utcTimes,
+                                                numTimes,
+                                                *timeZone);
+}
+
 int TimeZoneUtil::convertLocalToLocalTime(
                                        LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
@@ -226,6 +265,24 @@ int TimeZoneUtil::loadLocalTimePeriodForUtc(LocalTimePeriod       *result,
                                   DefaultZoneinfoCache::defaultCache());
 }
 
+int TimeZoneUtil::loadTimeZone(const Zoneinfo **result,
+                               const char      *timeZoneId)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(timeZoneId);
+
+    int             rc       = 0;
+    const Zoneinfo *timeZone = DefaultZoneinfoCache::defaultCache()->
+                                                  getZoneinfo(&rc, timeZoneId);
+    if (0 == timeZone) {
+        BSLS_ASSERT(0 != rc);
+        return rc;                                                    // RETURN
+    }
+
+    *result = timeZone;
+    return 0;
+}
+
 int TimeZoneUtil::validateLocalTime(bool                    *result,
                                     const bdlt::DatetimeTz&  localTime,
                                     const char              *timeZoneId)
@@ -21,7 +21,9 @@ BSLS_IDENT("$Id: $")
 //: o 'convertLocalToUtc', for converting a local-time value into the
 //:   corresponding UTC time value;
 //: o 'initLocalTime', for initializing a local-time value.
-// Additionally, the 'loadLocalTimePeriod' and 'loadLocalTimePeriodForUtc'
+// The 'convertUtcToLocalTimes' methods convert arrays of UTC times in a single
+// call (see {Converting Batches of UTC Times}).  Additionally, the
+// 'loadLocalTimePeriod' and 'loadLocalTimePeriodForUtc'
 // methods enable clients to obtain information about a time value, such as
 // whether the provided time is a daylight-saving time value.  Finally note
 // that, all of the functions in this utility component make use of a
@@ -195,6 +197,28 @@ BSLS_IDENT("$Id: $")
 //:   later time is arbitrary, but is consistent with common implementations of
 //:   the C standard library.
 //
+///Converting Batches of UTC Times
+///-------------------------------
+// Each of the functions above looks up the time zone, by its identifier, in
+// the process-wide cache before performing the conversion, and
+// 'convertUtcToLocalTime' then searches the transitions of that time zone for
+// the supplied time.  Clients converting many times to the same time zone can
+// avoid both costs:
+//
+//: o 'loadTimeZone' resolves a time zone identifier once, loading the address
+//:   of the cached 'baltzo::Zoneinfo' object that describes the time zone.
+//:   That address remains valid for the lifetime of the cache (time zone
+//:   information in a 'baltzo::ZoneinfoCache' is never removed or modified),
+//:   and serves as a handle to the resolved time zone that may be supplied to
+//:   subsequent conversions.
+//:
+//: o 'convertUtcToLocalTimes' converts an array of UTC times, supplied either
+//:   as 'bdlt::Datetime' values or as 'bdlt::EpochUtil::TimeT64' values
+//:   (seconds since the epoch), to local times in a single call.  If the
+//:   array is sorted in ascending order the conversion advances linearly
+//:   through the transitions of the time zone rather than searching them for
+//:   each time (see {'baltzo_zoneinfoutil'}).
+//
 ///Thread Safety
 ///-------------
 // The functions provided by 'baltzo::TimeZoneUtil' are *thread-safe*, meaning
@@ -416,6 +440,57 @@ BSLS_IDENT("$Id: $")
 //  assert(bdlt::Datetime(2010,  3, 14, 7, 0, 0) == period.utcStartTime());
 //  assert(bdlt::Datetime(2010, 11,  7, 6, 0, 0) == period.utcEndTime());
 //..
+//
+///Example 5: Converting a Batch of UTC Times
+/// - - - - - - - - - - - - - - - - - - - - -
+// In this example we illustrate how to convert a sequence of UTC times, such
+// as the times of a day's trades, to local times in a given time zone.
+//
+// First, we resolve the time zone identifier once, obtaining a handle to the
+// time zone information for New York:
+//..
+//  const baltzo::Zoneinfo *newYork;
+//  int status = baltzo::TimeZoneUtil::loadTimeZone(&newYork,
+//                                                  "America/New_York");
+//  if (0 != status) {
+//      return 1;                                                     // RETURN
+//  }
+//..
+// Then, we create an array of UTC times, in ascending order, spanning the
+// transition to daylight-saving time on "Mar 14, 2010 07:00 UTC":
+//..
+//  const bdlt::Datetime utcTimes[] = {
+//      bdlt::Datetime(2010, 3, 14,  6, 30),
+//      bdlt::Datetime(2010, 3, 14,  6, 59),
+//      bdlt::Datetime(2010, 3, 14,  7,  0),
+//      bdlt::Datetime(2010, 3, 14, 12,  0),
+//  };
+//  const int NUM_TIMES = sizeof utcTimes / sizeof *utcTimes;
+//..
+// Now, we convert all of the times with a single call:
+//..
+//  bdlt::DatetimeTz localTimes[NUM_TIMES];
+//  status = baltzo::TimeZoneUtil::convertUtcToLocalTimes(localTimes,
+//                                                        *newYork,
+//                                                        utcTimes,
+//                                                        NUM_TIMES);
+//  if (0 != status) {
+//      return 1;                                                     // RETURN
+//  }
+//..
+// Finally, we verify that the times before the transition are in standard
+// time (UTC-5:00), and the times at and after it are in daylight-saving time
+// (UTC-4:00):
+//..
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 1, 30), -5 * 60)
+//                                                          == localTimes[0]);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 1, 59), -5 * 60)
+//                                                          == localTimes[1]);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 3,  0), -4 * 60)
+//                                                          == localTimes[2]);
+//  assert(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 8,  0), -4 * 60)
+//                                                          == localTimes[3]);
+//..
 
 #include <balscm_version.h>
 
@@ -424,10 +499,13 @@ BSLS_IDENT("$Id: $")
 #include <baltzo_localtimevalidity.h>
 #include <baltzo_timezoneutilimp.h>
 #include <baltzo_localdatetime.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoutil.h>
 
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
@@ -490,6 +568,63 @@ struct TimeZoneUtil {
         // operation would have been outside the range of values representable
         // by the 'result' type.
 
+    static int convertUtcToLocalTime(bdlt::DatetimeTz      *result,
+                                     const Zoneinfo&        targetTimeZone,
+                                     const bdlt::Datetime&  utcTime);
+        // Load, into the specified 'result', the local date-time value (in the
+        // time zone described by the specified 'targetTimeZone')
+        // corresponding to the specified 'utcTime'.  The offset from UTC of
+        // the time zone is rounded down to minute precision.  Return 0 on
+        // success, and a non-zero value with no effect otherwise.  A return
+        // value of 'ErrorCode::k_OUT_OF_RANGE' indicates that the result of
+        // the operation would have been outside the range of values
+        // representable by the 'result' type.  The behavior is undefined
+        // unless 'ZoneinfoUtil::isWellFormed(targetTimeZone)' is 'true' (as
+        // is the case for any time zone loaded by 'loadTimeZone').
+
+    static int convertUtcToLocalTimes(
+                                   bdlt::DatetimeTz      *resultTimes,
+                                   const char            *targetTimeZoneId,
+                                   const bdlt::Datetime  *utcTimes,
+                                   int                    numTimes);
+    static int convertUtcToLocalTimes(
+                                   bdlt::DatetimeTz      *resultTimes,
+                                   const Zoneinfo&        targetTimeZone,
+                                   const bdlt::Datetime  *utcTimes,
+                                   int                    numTimes);
+    static int convertUtcToLocalTimes(
+                              bdlt::DatetimeTz               *resultTimes,
+                              const char                     *targetTimeZoneId,
+                              const bdlt::EpochUtil::TimeT64 *utcTimes,
+                              int                             numTimes);
+    static int convertUtcToLocalTimes(
+                              bdlt::DatetimeTz               *resultTimes,
+                              const Zoneinfo&                 targetTimeZone,
+                              const bdlt::EpochUtil::TimeT64 *utcTimes,
+                              int                             numTimes);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'resultTimes' array, the local date-time value (in the
+        // time zone indicated by the specified 'targetTimeZoneId', or
+        // described by the specified 'targetTimeZone') corresponding to the
+        // respective element of the specified 'utcTimes' array.  The offset
+        // from UTC of the time zone is rounded down to minute precision.
+        // Return 0 on success, and a non-zero value otherwise.  A return value
+        // of 'ErrorCode::k_UNSUPPORTED_ID' indicates that 'targetTimeZoneId'
+        // was not recognized (and 'resultTimes' is unchanged), and a return
+        // value of 'ErrorCode::k_OUT_OF_RANGE' indicates that the conversion
+        // of an element would have been outside the range of values
+        // representable by 'bdlt::DatetimeTz' (or that an element of type
+        // 'bdlt::EpochUtil::TimeT64' is outside the range representable by
+        // 'bdlt::Datetime'), in which case the elements of 'resultTimes' at
+        // and after the position of that element are unspecified.  The
+        // behavior is undefined unless '0 <= numTimes', 'resultTimes' and
+        // 'utcTimes' each refer to an array of at least 'numTimes' elements,
+        // and 'ZoneinfoUtil::isWellFormed(targetTimeZone)' is 'true' (as is
+        // the case for any time zone loaded by 'loadTimeZone').  Note that
+        // the conversion takes linear time with respect to 'numTimes' and the
+        // number of transitions of the time zone if 'utcTimes' is sorted in
+        // ascending order.
+
     static int convertLocalToLocalTime(LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
                                        const LocalDatetime&   srcTime);
@@ -640,6 +775,19 @@ struct TimeZoneUtil {
         // otherwise.  A return value of 'ErrorCode::k_UNSUPPORTED_ID'
         // indicates that 'timeZoneId' was not recognized.
 
+    static int loadTimeZone(const Zoneinfo **result, const char *timeZoneId);
+        // Load, into the specified 'result', the address of the time zone
+        // information, held by the process-wide cache of time-zone
+        // information, for the time zone indicated by the specified
+        // 'timeZoneId'.  Return 0 on success, and a non-zero value with no
+        // effect otherwise.  A return value of 'ErrorCode::k_UNSUPPORTED_ID'
+        // indicates that 'timeZoneId' was not recognized.  Note that the
+        // loaded address remains valid, and the information it refers to
+        // remains unchanged, for the lifetime of the cache (see
+        // {'baltzo_defaultzoneinfocache'}), so it may be retained, and
+        // supplied to 'convertUtcToLocalTime' and 'convertUtcToLocalTimes',
+        // to avoid looking up the time zone for each conversion.
+
     static int now(bdlt::DatetimeTz *result, const char *timeZoneId);
     static int now(LocalDatetime *result, const char  *timeZoneId);
         // Load, into the specified 'result', the current local time value
@@ -702,6 +850,45 @@ int TimeZoneUtil::convertUtcToLocalTime(
                                          DefaultZoneinfoCache::defaultCache());
 }
 
+inline
+int TimeZoneUtil::convertUtcToLocalTime(bdlt::DatetimeTz      *result,
+                                        const Zoneinfo&        targetTimeZone,
+                                        const bdlt::Datetime&  utcTime)
+{
+    BSLS_ASSERT(result);
+
+    Zoneinfo::TransitionConstIterator transition;
+    return ZoneinfoUtil::convertUtcToLocalTime(result,
+                                               &transition,
+                                               utcTime,
+                                               targetTimeZone);
+}
+
+inline
+int TimeZoneUtil::convertUtcToLocalTimes(bdlt::DatetimeTz      *resultTimes,
+                                         const Zoneinfo&        targetTimeZone,
+                                         const bdlt::Datetime  *utcTimes,
+                                         int                    numTimes)
+{
+    return ZoneinfoUtil::convertUtcToLocalTimes(resultTimes,
+                                                utcTimes,
+                                                numTimes,
+                                                targetTimeZone);
+}
+
+inline
+int TimeZoneUtil::convertUtcToLocalTimes(
+                                bdlt::DatetimeTz               *resultTimes,
+                                const Zoneinfo&                 targetTimeZone,
+                                const bdlt::EpochUtil::TimeT64 *utcTimes,
+                                int                             numTimes)
+{
+    return ZoneinfoUtil::convertUtcToLocalTimes(resultTimes,
+                                                utcTimes,
+                                                numTimes,
+                                                targetTimeZone);
+}
+
 inline
 int TimeZoneUtil::convertLocalToLocalTime(
                                         LocalDatetime        *result,
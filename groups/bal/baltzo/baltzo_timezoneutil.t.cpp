@@ -12,6 +12,7 @@
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
 #include <bdlt_iso8601util.h>
 
 #include <bslim_testutil.h>
@@ -27,6 +28,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #include <bsls_asserttest.h>
 #include <bsls_types.h>
@@ -46,6 +48,12 @@ using namespace bsl;
 // CLASS METHODS
 // [ 6] convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
 // [ 6] convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+// [12] convertUtcToLocalTime(DatetmTz *, const Zoneinfo&, const Datetm&);
+// [12] convertUtcToLocalTimes(DatetmTz *, const char *, const Datetm *, int);
+// [12] convertUtcToLocalTimes(DatetmTz *, const Zi&, const Datetm *, int);
+// [12] convertUtcToLocalTimes(DatetmTz *, const char *, const T64 *, int);
+// [12] convertUtcToLocalTimes(DatetmTz *, const Zi&, const T64 *, int);
+// [12] loadTimeZone(const Zoneinfo **, const char *);
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const LclDatetm&)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const DatetmTz&);
 // [ 8] convertLocalToLocalTime(DatetmTz *, const ch *, const LclDatetm&);
@@ -68,7 +76,7 @@ using namespace bsl;
 // [ 9] validateLocalTime(bool * result, const DatetmTz&, const char *TZ);
 // ----------------------------------------------------------------------------
 // [11] TESTING TIME CONVERSION OUT OF RANGE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // ============================================================================
 
 // ============================================================================
@@ -920,7 +928,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&testCache);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1180,8 +1188,273 @@ int main(int argc, char *argv[])
 
             ASSERT(0 == defaultAllocator.numBytesInUse());
         }
+
+        if (veryVerbose) cout << "\tExample 5: convertUtcToLocalTimes" << endl;
+        {
+///Example 5: Converting a Batch of UTC Times
+/// - - - - - - - - - - - - - - - - - - - - -
+// In this example we illustrate how to convert a sequence of UTC times, such
+// as the times of a day's trades, to local times in a given time zone.
+//
+// First, we resolve the time zone identifier once, obtaining a handle to the
+// time zone information for New York:
+//..
+    const baltzo::Zoneinfo *newYork;
+    int status = baltzo::TimeZoneUtil::loadTimeZone(&newYork,
+                                                    "America/New_York");
+    if (0 != status) {
+        return 1;                                                     // RETURN
+    }
+//..
+// Then, we create an array of UTC times, in ascending order, spanning the
+// transition to daylight-saving time on "Mar 14, 2010 07:00 UTC":
+//..
+    const bdlt::Datetime utcTimes[] = {
+        bdlt::Datetime(2010, 3, 14,  6, 30),
+        bdlt::Datetime(2010, 3, 14,  6, 59),
+        bdlt::Datetime(2010, 3, 14,  7,  0),
+        bdlt::Datetime(2010, 3, 14, 12,  0),
+    };
+    const int NUM_TIMES = sizeof utcTimes / sizeof *utcTimes;
+//..
+// Now, we convert all of the times with a single call:
+//..
+    bdlt::DatetimeTz localTimes[NUM_TIMES];
+    status = baltzo::TimeZoneUtil::convertUtcToLocalTimes(localTimes,
+                                                          *newYork,
+                                                          utcTimes,
+                                                          NUM_TIMES);
+    if (0 != status) {
+        return 1;                                                     // RETURN
+    }
+//..
+// Finally, we verify that the times before the transition are in standard
+// time (UTC-5:00), and the times at and after it are in daylight-saving time
+// (UTC-4:00):
+//..
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 1, 30), -5 * 60)
+                                                            == localTimes[0]);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 1, 59), -5 * 60)
+                                                            == localTimes[1]);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 3,  0), -4 * 60)
+                                                            == localTimes[2]);
+    ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 3, 14, 8,  0), -4 * 60)
+                                                            == localTimes[3]);
+//..
+        }
         ASSERT(0 == defaultAllocator.numBytesInUse());
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS 'loadTimeZone' AND 'convertUtcToLocalTimes'
+        //
+        // Concerns:
+        //: 1 'loadTimeZone' loads the address of the cached time zone
+        //:   information for a supported identifier, the same address on
+        //:   each call, and returns 'k_UNSUPPORTED_ID' with no effect for an
+        //:   unsupported identifier.
+        //:
+        //: 2 'convertUtcToLocalTime' and 'convertUtcToLocalTimes', supplied a
+        //:   time zone loaded by 'loadTimeZone', or its identifier, produce
+        //:   the same results as 'convertUtcToLocalTime' supplied the
+        //:   identifier, for sorted and unsorted input.
+        //:
+        //: 3 'convertUtcToLocalTimes' supplied an unsupported identifier
+        //:   returns 'k_UNSUPPORTED_ID' and does not modify the results, and
+        //:   returns 'k_OUT_OF_RANGE' for a time whose conversion is out of
+        //:   range.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Call 'loadTimeZone' for supported and unsupported identifiers,
+        //:   and verify the result.  (C-1)
+        //:
+        //: 2 For each of a set of time zones, convert an ascending sequence of
+        //:   UTC times spanning several years, and the same sequence in
+        //:   descending order, using each overload, and compare each result
+        //:   with that of the single-time 'convertUtcToLocalTime'.  (C-2)
+        //:
+        //: 3 Call 'convertUtcToLocalTimes' with an unsupported identifier,
+        //:   and with the earliest 'bdlt::Datetime' in a time zone west of
+        //:   UTC, and verify the result.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   convertUtcToLocalTime(DatetmTz *, const Zoneinfo&, const Datetm&);
+        //   convertUtcToLocalTimes(DatetmTz *, const char *, const Datetm *,..
+        //   convertUtcToLocalTimes(DatetmTz *, const Zi&, const Datetm *, ..
+        //   convertUtcToLocalTimes(DatetmTz *, const char *, const T64 *, ..
+        //   convertUtcToLocalTimes(DatetmTz *, const Zi&, const T64 *, int);
+        //   loadTimeZone(const Zoneinfo **, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS 'loadTimeZone' AND "
+                          << "'convertUtcToLocalTimes'" << endl
+                          << "================================="
+                          << "========================" << endl;
+
+        if (verbose) cout << "\tTesting 'loadTimeZone'." << endl;
+        {
+            const baltzo::Zoneinfo *timeZone = 0;
+            ASSERT(0 == Obj::loadTimeZone(&timeZone, "America/New_York"));
+            ASSERT(0 != timeZone);
+            ASSERT(timeZone == testCache.lookupZoneinfo("America/New_York"));
+
+            const baltzo::Zoneinfo *other = 0;
+            ASSERT(0 == Obj::loadTimeZone(&other, "America/New_York"));
+            ASSERT(timeZone == other);
+
+            ASSERT(Err::k_UNSUPPORTED_ID ==
+                                      Obj::loadTimeZone(&other, "bogus/zone"));
+            ASSERT(timeZone == other);
+        }
+
+        if (verbose) cout << "\tTesting 'convertUtcToLocalTimes'." << endl;
+
+        const char *TIME_ZONES[] = {
+            "GMT",
+            "Etc/GMT+1",
+            "America/New_York",
+            "Asia/Riyadh",
+            "Asia/Saigon",
+            "Europe/Rome",
+        };
+        const int NUM_TIME_ZONES = sizeof TIME_ZONES / sizeof *TIME_ZONES;
+
+        enum { k_NUM_TIMES = 24 * 365 };
+
+        bsl::vector<bdlt::Datetime>           times(Z);
+        bsl::vector<bdlt::EpochUtil::TimeT64> epochTimes(Z);
+        bdlt::Datetime time(1970, 1, 1, 0, 17, 3);
+        for (int i = 0; i < k_NUM_TIMES; ++i) {
+            times.push_back(time);
+            epochTimes.push_back(bdlt::EpochUtil::convertToTimeT64(time));
+            time.addHours(11 * 24 + 7);
+        }
+        bsl::vector<bdlt::Datetime> reversed(times.rbegin(), times.rend(), Z);
+
+        bsl::vector<bdlt::DatetimeTz> results(k_NUM_TIMES, Z);
+
+        for (int ti = 0; ti < NUM_TIME_ZONES; ++ti) {
+            const char *TZ = TIME_ZONES[ti];
+
+            const baltzo::Zoneinfo *timeZone;
+            ASSERTV(TZ, 0 == Obj::loadTimeZone(&timeZone, TZ));
+
+            for (int m = 0; m < 5; ++m) {
+                bool reverse = false;
+                int  rc      = 0;
+                switch (m) {
+                  case 0: {
+                    rc = Obj::convertUtcToLocalTimes(results.data(),
+                                                     TZ,
+                                                     times.data(),
+                                                     k_NUM_TIMES);
+                  } break;
+                  case 1: {
+                    rc = Obj::convertUtcToLocalTimes(results.data(),
+                                                     *timeZone,
+                                                     times.data(),
+                                                     k_NUM_TIMES);
+                  } break;
+                  case 2: {
+                    rc = Obj::convertUtcToLocalTimes(results.data(),
+                                                     TZ,
+                                                     epochTimes.data(),
+                                                     k_NUM_TIMES);
+                  } break;
+                  case 3: {
+                    rc = Obj::convertUtcToLocalTimes(results.data(),
+                                                     *timeZone,
+                                                     epochTimes.data(),
+                                                     k_NUM_TIMES);
+                  } break;
+                  case 4: {
+                    reverse = true;
+                    rc = Obj::convertUtcToLocalTimes(results.data(),
+                                                     *timeZone,
+                                                     reversed.data(),
+                                                     k_NUM_TIMES);
+                  } break;
+                }
+                ASSERTV(TZ, m, 0 == rc);
+
+                for (int i = 0; i < k_NUM_TIMES; ++i) {
+                    const bdlt::Datetime& UTC =
+                                      reverse ? reversed[i] : times[i];
+
+                    bdlt::DatetimeTz expected;
+                    ASSERT(0 == Obj::convertUtcToLocalTime(&expected,
+                                                           TZ,
+                                                           UTC));
+                    ASSERTV(TZ, m, i, UTC, expected, results[i],
+                            expected == results[i]);
+
+                    bdlt::DatetimeTz single;
+                    if (0 == m) {
+                        ASSERT(0 == Obj::convertUtcToLocalTime(&single,
+                                                               *timeZone,
+                                                               UTC));
+                        ASSERTV(TZ, i, expected == single);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting errors." << endl;
+        {
+            const bdlt::DatetimeTz INITIAL(bdlt::Datetime(2000, 1, 1), 60);
+            bdlt::DatetimeTz       result(INITIAL);
+
+            ASSERT(Err::k_UNSUPPORTED_ID == Obj::convertUtcToLocalTimes(
+                                                                &result,
+                                                                "bogus/zone",
+                                                                times.data(),
+                                                                1));
+            ASSERT(INITIAL == result);
+            ASSERT(Err::k_UNSUPPORTED_ID == Obj::convertUtcToLocalTimes(
+                                                            &result,
+                                                            "bogus/zone",
+                                                            epochTimes.data(),
+                                                            1));
+            ASSERT(INITIAL == result);
+
+            const bdlt::Datetime MIN_TIME;
+            ASSERT(Err::k_OUT_OF_RANGE == Obj::convertUtcToLocalTimes(
+                                                           &result,
+                                                           "America/New_York",
+                                                           &MIN_TIME,
+                                                           1));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlt::DatetimeTz result;
+            ASSERT_PASS(Obj::convertUtcToLocalTimes(&result,
+                                                    "GMT",
+                                                    times.data(),
+                                                    1));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(&result,
+                                                    (const char *)0,
+                                                    times.data(),
+                                                    1));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(&result,
+                                                    (const char *)0,
+                                                    epochTimes.data(),
+                                                    1));
+
+            const baltzo::Zoneinfo *timeZone;
+            ASSERT_FAIL(Obj::loadTimeZone(0, "GMT"));
+            ASSERT_FAIL(Obj::loadTimeZone(&timeZone, 0));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 144183882
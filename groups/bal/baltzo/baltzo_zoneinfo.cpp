@@ -17,6 +17,31 @@ BSLS_IDENT_RCSID(baltzo_zoneinfo_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
+namespace {
+
+enum {
+    k_INDEX_BUCKET_SHIFT = 22,   // base-2 logarithm of the number of seconds
+                                 // covered by a bucket of the transition index
+
+    k_INDEX_NUM_BUCKETS  = 979,  // number of buckets in the transition index,
+                                 // covering 1970/01/01 through 2100/02/13
+
+    k_NO_TRANSITION      = 1 << k_INDEX_BUCKET_SHIFT,
+                                 // 'd_nextOffset' value for a bucket holding
+                                 // no transition (greater than any offset)
+
+    k_MANY_TRANSITIONS   = -1    // 'd_nextOffset' value (when converted to
+                                 // 'unsigned int') for a bucket holding more
+                                 // than one transition
+};
+
+const bdlt::EpochUtil::TimeT64 k_INDEX_END =
+           static_cast<bdlt::EpochUtil::TimeT64>(k_INDEX_NUM_BUCKETS)
+                                                      << k_INDEX_BUCKET_SHIFT;
+    // The first UTC time (in seconds since the epoch) not covered by the
+    // transition index.
+
+}  // close unnamed namespace
 
 // STATIC HELPER FUNCTIONS
 static
@@ -149,6 +174,7 @@ Zoneinfo::Zoneinfo(const Zoneinfo& original, const allocator_type &allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(original.d_posixExtendedRangeDescription,
                                   allocator)
+, d_transitionIndex(allocator)
 {
     d_transitions.reserve(original.d_transitions.size());
 
@@ -157,6 +183,11 @@ Zoneinfo::Zoneinfo(const Zoneinfo& original, const allocator_type &allocator)
     for (; it != end; ++it) {
         addTransition(it->utcTime(), it->descriptor());
     }
+
+    // 'addTransition' discarded the index, which refers to transitions by
+    // position and so remains valid for the copied sequence.
+
+    d_transitionIndex = original.d_transitionIndex;
 }
 
 Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
@@ -168,6 +199,8 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
       bslmf::MovableRefUtil::access(original).d_transitions))
 , d_posixExtendedRangeDescription(bslmf::MovableRefUtil::move(
       bslmf::MovableRefUtil::access(original).d_posixExtendedRangeDescription))
+, d_transitionIndex(bslmf::MovableRefUtil::move(
+      bslmf::MovableRefUtil::access(original).d_transitionIndex))
 {
 }
 
@@ -182,6 +215,7 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
       bslmf::MovableRefUtil::move(bslmf::MovableRefUtil::access(original)
                                       .d_posixExtendedRangeDescription),
       allocator)
+, d_transitionIndex(allocator)
 {
     const Zoneinfo& origRef = bslmf::MovableRefUtil::access(original);
 
@@ -192,6 +226,8 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
     for (; it != end; ++it) {
         addTransition(it->utcTime(), it->descriptor());
     }
+
+    d_transitionIndex = origRef.d_transitionIndex;
 }
 
 // MANIPULATORS
@@ -214,6 +250,8 @@ Zoneinfo& Zoneinfo::operator=(bslmf::MovableRef<Zoneinfo> rhs)
     d_posixExtendedRangeDescription =
            bslmf::MovableRefUtil::move(rhsRef.d_posixExtendedRangeDescription);
 
+    d_transitionIndex = bslmf::MovableRefUtil::move(rhsRef.d_transitionIndex);
+
     return *this;
 }
 
@@ -222,6 +260,10 @@ void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
 {
     typedef bsl::vector<ZoneinfoTransition>::iterator TransitionIterator;
 
+    // Positions in 'd_transitions' may change, so discard the index.
+
+    d_transitionIndex.clear();
+
     // Insert the description in the set and get back an iterator pointing to
     // the inserted item.
 
@@ -261,6 +303,56 @@ void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
     return;
 }
 
+void Zoneinfo::createTransitionIndex()
+{
+    if (d_transitions.empty() || 0 < d_transitions.front().utcTime()) {
+        return;                                                       // RETURN
+    }
+
+    TransitionIndex index(get_allocator());
+    index.resize(k_INDEX_NUM_BUCKETS);
+
+    // 'current' is the position of the transition in effect at the start of
+    // the bucket being filled.
+
+    bsl::size_t       current = 0;
+    const bsl::size_t count   = d_transitions.size();
+
+    for (int bucket = 0; bucket < k_INDEX_NUM_BUCKETS; ++bucket) {
+        const bdlt::EpochUtil::TimeT64 begin =
+                 static_cast<bdlt::EpochUtil::TimeT64>(bucket)
+                                                      << k_INDEX_BUCKET_SHIFT;
+        const bdlt::EpochUtil::TimeT64 end = begin + k_NO_TRANSITION;
+
+        while (current + 1 < count
+            && d_transitions[current + 1].utcTime() <= begin) {
+            ++current;
+        }
+
+        bsl::size_t last = current;
+        while (last + 1 < count && d_transitions[last + 1].utcTime() < end) {
+            ++last;
+        }
+
+        TransitionIndexEntry& entry = index[bucket];
+
+        entry.d_transitionIndex = static_cast<int>(current);
+
+        if (last == current) {
+            entry.d_nextOffset = k_NO_TRANSITION;
+        }
+        else if (last == current + 1) {
+            entry.d_nextOffset = static_cast<unsigned int>(
+                                   d_transitions[last].utcTime() - begin);
+        }
+        else {
+            entry.d_nextOffset = static_cast<unsigned int>(k_MANY_TRANSITIONS);
+        }
+    }
+
+    d_transitionIndex.swap(index);
+}
+
 // ACCESSORS
 Zoneinfo::TransitionConstIterator
 Zoneinfo::findTransitionForUtcTime(const bdlt::Datetime& utcTime) const
@@ -269,18 +361,42 @@ Zoneinfo::findTransitionForUtcTime(const bdlt::Datetime& utcTime) const
     BSLS_ASSERT(d_transitions.front().utcTime() <=
                                    bdlt::EpochUtil::convertToTimeT64(utcTime));
 
-    LocalTimeDescriptor dummyDescriptor;
-
     const bdlt::EpochUtil::TimeT64 utcTimeT64 =
                                     bdlt::EpochUtil::convertToTimeT64(utcTime);
+
+    TransitionConstIterator begin = d_transitions.begin();
+
+    if (!d_transitionIndex.empty() && 0 <= utcTimeT64
+                                   && utcTimeT64 < k_INDEX_END) {
+        const TransitionIndexEntry& entry =
+                   d_transitionIndex[static_cast<bsl::size_t>(
+                                     utcTimeT64 >> k_INDEX_BUCKET_SHIFT)];
+
+        const unsigned int offset = static_cast<unsigned int>(
+                                utcTimeT64 & (k_NO_TRANSITION - 1));
+
+        if (static_cast<unsigned int>(k_MANY_TRANSITIONS) !=
+                                                          entry.d_nextOffset) {
+            return begin + entry.d_transitionIndex
+                         + (offset >= entry.d_nextOffset ? 1 : 0);    // RETURN
+        }
+
+        // Several transitions occur within the bucket; search only those
+        // following the one in effect at its start.
+
+        begin += entry.d_transitionIndex;
+    }
+
+    LocalTimeDescriptor dummyDescriptor;
+
     TransitionConstIterator it = bsl::upper_bound(
-                                     d_transitions.begin(),
+                                     begin,
                                      d_transitions.end(),
                                      ZoneinfoTransition(
                                                             utcTimeT64,
                                                             &dummyDescriptor));
 
-    if (d_transitions.begin() != it) {
+    if (begin != it) {
         --it;
     }
 
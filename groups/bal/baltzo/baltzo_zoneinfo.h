@@ -79,6 +79,22 @@ BSLS_IDENT("$Id: $")
 // zone and vice-versa.  (See 'baltzo_zoneinfobinaryreader' for more
 // information about the binary file format.)
 //
+///Transition Index
+///----------------
+// 'findTransitionForUtcTime' locates a transition by binary search over the
+// sequence of transitions.  Clients that perform many conversions using the
+// same 'baltzo::Zoneinfo' object (e.g., 'baltzo::ZoneinfoCache', which does so
+// for every time zone it loads) can call 'createTransitionIndex' to build a
+// compact index that covers UTC times from 1970 through 2100.  The index
+// divides that range into buckets of 2^22 seconds (about 48.5 days), and
+// records, for each bucket, the transition in effect at the start of the
+// bucket and the offset of the (at most one, in practice) transition that
+// occurs within it.  For a UTC time in that range, 'findTransitionForUtcTime'
+// then reads a single 8-byte index entry instead of searching; times outside
+// the range, and the rare buckets containing several transitions, continue to
+// use a binary search.  The index is not part of the value of a
+// 'baltzo::Zoneinfo' object, and is discarded by 'addTransition'.
+//
 ///posixExtendedRangeDescription
 ///-----------------------------
 // This string may be populated with a POSIX-like TZ string that describes
@@ -401,6 +417,23 @@ class Zoneinfo {
         // Alias for the set of unique local-time descriptors that are managed
         // by a 'Zoneinfo' object.
 
+    struct TransitionIndexEntry {
+        // This 'struct' describes the transitions occurring in one bucket of
+        // the transition index (see {Transition Index}).
+
+        int          d_transitionIndex;  // index of the transition in effect
+                                         // at the start of the bucket
+
+        unsigned int d_nextOffset;       // offset, in seconds from the start
+                                         // of the bucket, of the single
+                                         // transition within the bucket, or a
+                                         // sentinel value if the bucket holds
+                                         // either none or several
+    };
+
+    typedef bsl::vector<TransitionIndexEntry> TransitionIndex;
+        // Alias for the index over the sequence of transitions.
+
     // DATA
     bsl::string         d_identifier;
                           // this time zone's id
@@ -418,6 +451,11 @@ class Zoneinfo {
                           // optional POSIX-like TZ environment string
                           // representing far-reaching times
 
+    TransitionIndex     d_transitionIndex;
+                          // optional index over 'd_transitions' (empty unless
+                          // 'createTransitionIndex' has been called since the
+                          // last change to 'd_transitions')
+
     // FRIENDS
     friend bool operator==(const Zoneinfo&, const Zoneinfo&);
 
@@ -489,6 +527,15 @@ class Zoneinfo {
         // 'utcTime' is already present, replace it's local-time descriptor
         // with 'descriptor'.
 
+    void createTransitionIndex();
+        // Create an index over the transitions of this object that allows
+        // 'findTransitionForUtcTime' to locate, without searching, the
+        // transition for a UTC time from 1970 through 2100 (see
+        // {Transition Index}).  This method has no effect unless
+        // 'numTransitions() > 0' and the first transition is at or before
+        // 1970/01/01 00:00:00 UTC.  Note that a subsequent call to
+        // 'addTransition' discards the index.
+
     void setIdentifier(const bslstl::StringRef&  value);
     void setIdentifier(const char               *value);
         // Set the 'identifier' attribute of this object to the specified
@@ -532,6 +579,10 @@ class Zoneinfo {
         // that if no allocator was supplied at construction the default
         // allocator in effect at construction is used.
 
+    bool hasTransitionIndex() const;
+        // Return 'true' if this object holds an index over its transitions
+        // (see 'createTransitionIndex'), and 'false' otherwise.
+
     const bsl::string& identifier() const;
         // Return a reference providing non-modifiable access to the
         // 'identifier' attribute of this object.
@@ -682,6 +733,7 @@ Zoneinfo::Zoneinfo()
 , d_descriptors()
 , d_transitions()
 , d_posixExtendedRangeDescription()
+, d_transitionIndex()
 {
 }
 
@@ -691,6 +743,7 @@ Zoneinfo::Zoneinfo(const allocator_type& allocator)
 , d_descriptors(allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(allocator)
+, d_transitionIndex(allocator)
 {
 }
 
@@ -744,6 +797,7 @@ void Zoneinfo::swap(Zoneinfo& other)
     bslalg::SwapUtil::swap(&d_transitions, &other.d_transitions);
     bslalg::SwapUtil::swap(&d_posixExtendedRangeDescription,
                            &other.d_posixExtendedRangeDescription);
+    bslalg::SwapUtil::swap(&d_transitionIndex, &other.d_transitionIndex);
 }
 
 // ACCESSORS
@@ -767,6 +821,12 @@ Zoneinfo::allocator_type Zoneinfo::get_allocator() const
     return d_identifier.get_allocator();
 }
 
+inline
+bool Zoneinfo::hasTransitionIndex() const
+{
+    return !d_transitionIndex.empty();
+}
+
 inline
 const bsl::string& Zoneinfo::identifier() const
 {
@@ -30,6 +30,7 @@
 #include <bsl_map.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #undef DS
 
@@ -103,6 +104,7 @@ using namespace bsl;
 // [14] baltzo::Zoneinfo& operator=(const baltzo::Zoneinfo& rhs);
 // [15] baltzo::Zoneinfo& operator=(MovableRef<Zoneinfo> rhs);
 // [ 2] void addTransition(TimeT64 time, const baltzo::LTD& d);
+// [17] void createTransitionIndex();
 // [ 2] void setPosixExtendedRangeDescription(const bslstl::StringRef&);
 // [ 2] void setPosixExtendedRangeDescription(const char *value);
 // [ 9] void setIdentifier(const bslstl::StringRef& identifier);
@@ -113,6 +115,7 @@ using namespace bsl;
 // [16] TransitionConstIterator findTransitionForUtcTime(utcTime) const;
 // [ 4] const Transition& firstTransition() const;
 // [ 4] allocator_type get_allocator() const;
+// [17] bool hasTransitionIndex() const;
 // [ 9] const bsl::string& identifier() const;
 // [ 4] bsl::size_t numTransitions() const;
 // [ 4] TransitionConstIterator beginTransitions() const;
@@ -129,7 +132,7 @@ using namespace bsl;
 // [13] void swap(baltzo::Zoneinfo& first, baltzo::Zoneinfo& second);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST: 'baltzo::Zoneinfo', 'baltzo::ZoneinfoTransition'
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -463,7 +466,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -574,6 +577,202 @@ int main(int argc, char *argv[])
     ASSERT(expectedTime == nyDatetime.localDatetime());
 //..
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // 'baltzo::Zoneinfo' TRANSITION INDEX
+        //   Ensure that the transition index yields the same transitions as a
+        //   search of the sequence of transitions.
+        //
+        // Concerns:
+        //: 1 An index is created only for an object having a first transition
+        //:   at or before the epoch.
+        //:
+        //: 2 With an index, 'findTransitionForUtcTime' returns the same
+        //:   transition as without one, for times inside and outside the
+        //:   indexed range, at and around each transition, and in buckets
+        //:   holding zero, one, or several transitions.
+        //:
+        //: 3 With an index, 'findTransitionForUtcTime' allocates no memory.
+        //:
+        //: 4 The index is carried by copies, moves, and 'swap', and is
+        //:   discarded by 'addTransition'.
+        //:
+        //: 5 The index is allocated from the object allocator.
+        //
+        // Plan:
+        //: 1 Verify that 'createTransitionIndex' has no effect on an empty
+        //:   object and on an object whose first transition follows the
+        //:   epoch.  (C-1)
+        //:
+        //: 2 Create two objects holding the same transitions, including
+        //:   transitions on bucket boundaries, several transitions within one
+        //:   bucket, and transitions before and after the indexed range, and
+        //:   create an index for one of them.  (C-5)
+        //:
+        //: 3 For a large set of UTC times, verify that both objects return the
+        //:   transition at the same position, and that no memory is allocated
+        //:   by the look-ups.  (C-2..3)
+        //:
+        //: 4 Verify 'hasTransitionIndex' after copying, moving, swapping, and
+        //:   adding a transition.  (C-4)
+        //
+        // Testing:
+        //   void createTransitionIndex();
+        //   bool hasTransitionIndex() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'baltzo::Zoneinfo' TRANSITION INDEX" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Descriptor STD(-5 * 3600, false, "EST", &da);
+        const Descriptor DST(-4 * 3600, true,  "EDT", &da);
+        const Descriptor LMT(-17762,    false, "LMT", &da);
+
+        const TimeT64 FIRST  = -62135596800LL;  // 0001/01/01 00:00:00
+        const TimeT64 BUCKET = 1 << 22;
+
+        if (verbose) cout << "\nObjects that cannot be indexed." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.createTransitionIndex();
+            ASSERT(!X.hasTransitionIndex());
+
+            mX.addTransition(1, STD);
+
+            mX.createTransitionIndex();
+            ASSERT(!X.hasTransitionIndex());
+
+            mX.addTransition(0, LMT);
+
+            mX.createTransitionIndex();
+            ASSERT( X.hasTransitionIndex());
+        }
+
+        if (verbose) cout << "\nComparing with a search." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;  // indexed
+            Obj mY(&oa);  const Obj& Y = mY;  // not indexed
+
+            bsl::vector<TimeT64> transitions(&da);
+
+            transitions.push_back(FIRST);
+            transitions.push_back(-1000000000LL);
+
+            // Two transitions per year from 1970 through 2037.
+
+            for (TimeT64 year = 0; year < 68; ++year) {
+                transitions.push_back(year * 31556952 + 6000000);
+                transitions.push_back(year * 31556952 + 26000000);
+            }
+
+            // Transitions on bucket boundaries, and several transitions
+            // within a single bucket.
+
+            transitions.push_back(500 * BUCKET);
+            transitions.push_back(501 * BUCKET - 1);
+            transitions.push_back(700 * BUCKET + 10);
+            transitions.push_back(700 * BUCKET + 20);
+            transitions.push_back(700 * BUCKET + 30);
+
+            // Transitions near the end of, and after, the indexed range.
+
+            transitions.push_back(4102444800LL);      // 2100/01/01
+            transitions.push_back(979 * BUCKET - 1);
+            transitions.push_back(979 * BUCKET);
+            transitions.push_back(5000000000LL);
+
+            for (bsl::size_t i = 0; i < transitions.size(); ++i) {
+                const Descriptor& D = 0 == i ? LMT : (i % 2 ? STD : DST);
+
+                mX.addTransition(transitions[i], D);
+                mY.addTransition(transitions[i], D);
+            }
+
+            ASSERT(!X.hasTransitionIndex());
+
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.createTransitionIndex();
+
+                ASSERT(oam.isTotalUp());
+                ASSERT(X.hasTransitionIndex());
+                ASSERT(!Y.hasTransitionIndex());
+            }
+
+            bsl::vector<TimeT64> times(&da);
+
+            for (bsl::size_t i = 1; i < transitions.size(); ++i) {
+                times.push_back(transitions[i] - 1);
+                times.push_back(transitions[i]);
+                times.push_back(transitions[i] + 1);
+            }
+            for (TimeT64 t = -BUCKET; t < 4200000000LL; t += 1234567) {
+                times.push_back(t);
+            }
+            for (TimeT64 b = 0; b <= 980; ++b) {
+                times.push_back(b * BUCKET - 1);
+                times.push_back(b * BUCKET);
+            }
+            times.push_back(FIRST);
+            times.push_back(253402300799LL);  // 9999/12/31 23:59:59
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                const TimeT64        T  = times[i];
+                const bdlt::Datetime DT =
+                                        bdlt::EpochUtil::convertFromTimeT64(T);
+
+                const int EXP    = static_cast<int>(
+                                           Y.findTransitionForUtcTime(DT) -
+                                           Y.beginTransitions());
+                const int RESULT = static_cast<int>(
+                                           X.findTransitionForUtcTime(DT) -
+                                           X.beginTransitions());
+
+                ASSERTV(T, EXP, RESULT, EXP == RESULT);
+            }
+
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) cout << "\nCopy, move, swap, and 'addTransition'."
+                          << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.addTransition(FIRST, LMT);
+            mX.addTransition(1000000, STD);
+            mX.createTransitionIndex();
+            ASSERT(X.hasTransitionIndex());
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(Y.hasTransitionIndex());
+            ASSERT(X == Y);
+
+            Obj mZ(bslmf::MovableRefUtil::move(mY), &oa);  const Obj& Z = mZ;
+            ASSERT(Z.hasTransitionIndex());
+
+            Obj mW(&oa);  const Obj& W = mW;
+            mW.swap(mZ);
+            ASSERT( W.hasTransitionIndex());
+            ASSERT(!Z.hasTransitionIndex());
+
+            mW.addTransition(2000000, DST);
+            ASSERT(!W.hasTransitionIndex());
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // 'baltzo::Zoneinfo' 'findTransitionForUtcTime'
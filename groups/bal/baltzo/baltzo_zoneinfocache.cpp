@@ -7,8 +7,7 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 #include <baltzo_errorcode.h>         // for testing only
 #include <baltzo_zoneinfoutil.h>
 
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
+#include <bslmt_lockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_rawdeleterproctor.h>
@@ -17,7 +16,6 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 
 #include <bsls_log.h>
 
-#include <bsl_set.h>
 #include <bsl_string.h>
 
 namespace BloombergLP {
@@ -27,14 +25,56 @@ namespace baltzo {
                             // class ZoneinfoCache
                             // -------------------
 
+// PRIVATE CLASS METHODS
+unsigned int ZoneinfoCache::bucketIndex(const char *timeZoneId)
+{
+    BSLS_ASSERT(0 != timeZoneId);
+
+    // FNV-1a hash of the time-zone identifier.
+
+    unsigned int hash = 2166136261u;
+    for (; *timeZoneId; ++timeZoneId) {
+        hash ^= static_cast<unsigned char>(*timeZoneId);
+        hash *= 16777619u;
+    }
+    return hash & (k_NUM_BUCKETS - 1);
+}
+
+// PRIVATE ACCESSORS
+Zoneinfo *ZoneinfoCache::find(const char *timeZoneId) const
+{
+    BSLS_ASSERT(0 != timeZoneId);
+
+    // The acquire load pairs with the release store that published the node
+    // at the head of the bucket, and so makes visible the node, every node
+    // after it in the chain, and the 'Zoneinfo' objects they refer to.
+
+    const IndexNode *node = d_buckets[bucketIndex(timeZoneId)].loadAcquire();
+
+    for (; 0 != node; node = node->d_next_p) {
+        if (node->d_zoneinfo_p->identifier() == timeZoneId) {
+            return node->d_zoneinfo_p;                                // RETURN
+        }
+    }
+    return 0;
+}
+
 // CREATORS
 ZoneinfoCache::~ZoneinfoCache()
 {
-    for (ZoneinfoMap::iterator it  = d_cache.begin();
-                               it != d_cache.end();
-                               ++it) {
-        BSLS_ASSERT(0 != it->second);
-        d_allocator.mechanism()->deleteObject(it->second);
+    bslma::Allocator *allocator = d_allocator.mechanism();
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        IndexNode *node = d_buckets[i].loadRelaxed();
+        while (0 != node) {
+            IndexNode *next = node->d_next_p;
+
+            BSLS_ASSERT(0 != node->d_zoneinfo_p);
+            allocator->deleteObject(node->d_zoneinfo_p);
+            allocator->deleteObject(node);
+
+            node = next;
+        }
     }
 }
 
@@ -52,75 +92,80 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
     BSLMF_ASSERT(static_cast<int>(ErrorCode::k_UNSUPPORTED_ID) !=
                  static_cast<int>(FAILURE));
 
-    const Zoneinfo *result = lookupZoneinfo(timeZoneId);
+    const Zoneinfo *result = find(timeZoneId);
 
     if (0 != result) {
         *rc = 0;
         return result;                                                // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
-
-    // We use 'lower_bound' to return the position where the 'timeZoneId'
-    // should be (even if it is not in the map), so that it can be used as an
-    // insertion hint.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    ZoneinfoMap::iterator it = d_cache.lower_bound(timeZoneId);
+    result = find(timeZoneId);
 
-    if (d_cache.end() != it && !(d_cache.key_comp()(timeZoneId, it->first))) {
-        // 'timeZoneId' must have been added to the map between the call to
-        // 'lookupTimeZone', and the acquisition of the write-lock on 'd_lock'.
+    if (0 != result) {
+        // 'timeZoneId' must have been added to the cache between the first
+        // call to 'find', and the acquisition of the lock on 'd_lock'.
 
-        BSLS_ASSERT(0 != it->second);
-        *rc    = 0;
-        result = it->second;
+        *rc = 0;
+        return result;                                                // RETURN
     }
-    else {
-        // Create a proctor for the new time zone value.
-
-        Zoneinfo *newTimeZonePtr =
-            new (*(d_allocator.mechanism())) Zoneinfo(d_allocator.mechanism());
-
-        bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator>  proctor(
-                                                      newTimeZonePtr,
-                                                      d_allocator.mechanism());
-
-        *rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
-        if (0 != *rc) {
-            if (ErrorCode::k_UNSUPPORTED_ID != *rc) {
-                BSLS_LOG_ERROR("Unexpected error code loading time zone "
-                               "%s : %d", timeZoneId, *rc);
-            }
-            return 0;                                                 // RETURN
-        }
-        if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
-            BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
-                           timeZoneId);
-            *rc = FAILURE;
-            return 0;                                                 // RETURN
-        }
 
-        if (newTimeZonePtr->identifier() != timeZoneId) {
-            BSLS_LOG_ERROR("Loaded time zone id %s does not match "
-                           "request id: %s",
-                           newTimeZonePtr->identifier().c_str(),
-                           timeZoneId);
-            *rc = FAILURE;
-            return 0;                                                 // RETURN
-        }
+    bslma::Allocator *allocator = d_allocator.mechanism();
 
-        d_cache.insert(
-                  it,
-                  ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
-                                          newTimeZonePtr));
-        result = newTimeZonePtr;
+    // Create a proctor for the new time zone value.
 
-        // The pointer has been copied, so the proctor must release ownership.
+    Zoneinfo *newTimeZonePtr = new (*allocator) Zoneinfo(allocator);
+
+    bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator> proctor(
+                                                               newTimeZonePtr,
+                                                               allocator);
+
+    *rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
+    if (0 != *rc) {
+        if (ErrorCode::k_UNSUPPORTED_ID != *rc) {
+            BSLS_LOG_ERROR("Unexpected error code loading time zone "
+                           "%s : %d", timeZoneId, *rc);
+        }
+        return 0;                                                     // RETURN
+    }
+    if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
+        BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
+                       timeZoneId);
+        *rc = FAILURE;
+        return 0;                                                     // RETURN
+    }
 
-        proctor.release();
+    if (newTimeZonePtr->identifier() != timeZoneId) {
+        BSLS_LOG_ERROR("Loaded time zone id %s does not match "
+                       "request id: %s",
+                       newTimeZonePtr->identifier().c_str(),
+                       timeZoneId);
+        *rc = FAILURE;
+        return 0;                                                     // RETURN
     }
 
-    return result;
+    // Index the transitions so that conversions using the cached object do
+    // not need to search them.
+
+    newTimeZonePtr->createTransitionIndex();
+
+    bsls::AtomicPointer<IndexNode>& bucket = d_buckets[
+                                                    bucketIndex(timeZoneId)];
+
+    IndexNode *node     = new (*allocator) IndexNode;
+    node->d_zoneinfo_p  = newTimeZonePtr;
+    node->d_next_p      = bucket.loadRelaxed();
+
+    // Publish the fully-initialized node; see 'find'.
+
+    bucket.storeRelease(node);
+
+    // The pointer has been copied, so the proctor must release ownership.
+
+    proctor.release();
+
+    return newTimeZonePtr;
 }
 
 // ACCESSORS
@@ -128,13 +173,7 @@ const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
-
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
-    if (d_cache.end() != it) {
-        return it->second;                                            // RETURN
-    }
-    return 0;
+    return find(timeZoneId);
 }
 
 }  // close package namespace
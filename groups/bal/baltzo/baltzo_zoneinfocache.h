@@ -28,6 +28,17 @@ BSLS_IDENT("$Id: $")
 // operations on an object can be safely invoked simultaneously from multiple
 // threads.
 //
+///Performance
+///-----------
+// Cached 'baltzo::Zoneinfo' objects are never removed from a
+// 'baltzo::ZoneinfoCache', which allows the cache to index them in an
+// append-only hash table whose buckets are published atomically.  A call to
+// 'lookupZoneinfo', or a call to 'getZoneinfo' for a time zone that is already
+// cache-resident, therefore acquires no lock and performs no atomic
+// read-modify-write operation: it hashes the identifier and walks a short,
+// immutable chain of nodes.  Only a call that must load a time zone acquires
+// the (exclusive) lock that serializes loads.
+//
 ///Usage
 ///-----
 // In this section, we demonstrate creating a 'baltzo::ZoneinfoCache' object
@@ -149,21 +160,17 @@ BSLS_IDENT("$Id: $")
 #include <baltzo_loader.h>
 #include <baltzo_zoneinfo.h>
 
-#include <bdlb_cstringless.h>
-
 #include <bslma_stdallocator.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_mutex.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_review.h>
 
-#include <bsl_map.h>
-
 namespace BloombergLP {
 namespace baltzo {
 
@@ -191,19 +198,45 @@ class ZoneinfoCache {
 
   private:
     // PRIVATE TYPES
-    typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
+    struct IndexNode {
+        // This 'struct' describes an element of a bucket chain in the index of
+        // cached time zones.  A node is fully initialized before it is
+        // published, is never modified afterwards, and is not removed before
+        // the cache is destroyed.
+
+        Zoneinfo  *d_zoneinfo_p;  // cached time-zone information (owned)
+        IndexNode *d_next_p;      // next node in the same bucket, or 0
+    };
+
+    enum { k_NUM_BUCKETS = 256 };  // number of buckets in the index (a power
+                                   // of 2)
 
     // DATA
-    ZoneinfoMap             d_cache;      // cached time-zone info, indexed by
-                                          // time-zone id
+    bsls::AtomicPointer<IndexNode>
+                            d_buckets[k_NUM_BUCKETS];
+                                          // cached time-zone info, indexed by
+                                          // a hash of the time-zone id; nodes
+                                          // are pushed, under 'd_lock', at the
+                                          // head of a bucket
 
     Loader                 *d_loader_p;   // loader used to obtain time-zone
                                           // information (held, not owned)
 
-    mutable bslmt::RWMutex  d_lock;       // cache access synchronization
+    bslmt::Mutex            d_lock;       // serializes loads into the cache
 
     allocator_type          d_allocator;  // allocator used to supply memory
 
+    // PRIVATE CLASS METHODS
+    static unsigned int bucketIndex(const char *timeZoneId);
+        // Return the index of the bucket in which information for the
+        // specified 'timeZoneId' is stored.
+
+    // PRIVATE ACCESSORS
+    Zoneinfo *find(const char *timeZoneId) const;
+        // Return the address of the cached information for the specified
+        // 'timeZoneId', or 0 if that information has not been cached.  This
+        // method acquires no lock.
+
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
     ZoneinfoCache& operator=(const ZoneinfoCache&);
@@ -276,8 +309,7 @@ class ZoneinfoCache {
 // CREATORS
 inline
 ZoneinfoCache::ZoneinfoCache(Loader *loader, const allocator_type&  allocator)
-: d_cache(allocator)
-, d_loader_p(loader)
+: d_loader_p(loader)
 , d_allocator(allocator)
 {
     BSLS_ASSERT(0 != loader);
@@ -27,11 +27,14 @@
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace std;
@@ -81,8 +84,9 @@ using namespace std;
 // [ 4] allocator_type get_allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 8] CONCERN: All methods are thread-safe
+// [ 9] CONCERN: Lookups are correct for many cached time zones
 // [ 7] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 6] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
 // [ 7] CONCERN: No memory is ever allocated from the global allocator.
@@ -648,7 +652,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -782,6 +786,90 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING MANY CACHED TIME ZONES
+        //
+        // Concerns:
+        //: 1 That, when many more time zones are cached than there are buckets
+        //:   in the index, 'lookupZoneinfo' and 'getZoneinfo' return the
+        //:   address of the object loaded for the supplied id.
+        //:
+        //: 2 That an id sharing a bucket with cached ids, but not itself
+        //:   cached, is not found by 'lookupZoneinfo'.
+        //:
+        //: 3 That a cached time zone is not reloaded.
+        //:
+        //: 4 That all memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Populate a test loader with 1000 time zones having distinct
+        //:   identifiers, and load every time zone into a cache using
+        //:   'getZoneinfo'.  (C-1)
+        //:
+        //: 2 Verify that 'lookupZoneinfo' and 'getZoneinfo' return the
+        //:   address originally returned for each id, and that the test
+        //:   loader was not asked for a time zone a second time.  (C-1, 3)
+        //:
+        //: 3 Verify that 'lookupZoneinfo' returns 0 for 1000 ids that were
+        //:   never loaded.  (C-2)
+        //:
+        //: 4 Verify that the object allocator has no outstanding allocations
+        //:   after the cache is destroyed.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Lookups are correct for many cached time zones
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING MANY CACHED TIME ZONES" << endl
+                                  << "==============================" << endl;
+
+        enum { NUM_ZONES = 1000 };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> ids(&ta);
+        bsl::vector<bsl::string> missingIds(&ta);
+        for (int i = 0; i < NUM_ZONES; ++i) {
+            char buffer[32];
+            bsl::sprintf(buffer, "Test/Zone_%d", i);
+            ids.push_back(bsl::string(buffer, &ta));
+            bsl::sprintf(buffer, "Test/Missing_%d", i);
+            missingIds.push_back(bsl::string(buffer, &ta));
+        }
+
+        TestDriverTestLoader testLoader(&ta);
+        for (int i = 0; i < NUM_ZONES; ++i) {
+            testLoader.addTimeZone(ids[i].c_str(), i % 720, false, "TST");
+        }
+
+        {
+            Obj mX(&testLoader, &oa);  const Obj& X = mX;
+
+            bsl::vector<const Zone *> addresses(&ta);
+            for (int i = 0; i < NUM_ZONES; ++i) {
+                const Zone *zone = mX.getZoneinfo(ids[i].c_str());
+
+                ASSERTV(i, 0 != zone);
+                ASSERTV(i, ids[i] == zone->identifier());
+                ASSERTV(i, ids[i] == testLoader.lastRequestedTimeZone());
+
+                addresses.push_back(zone);
+            }
+
+            for (int i = 0; i < NUM_ZONES; ++i) {
+                ASSERTV(i, addresses[i] == X.lookupZoneinfo(ids[i].c_str()));
+                ASSERTV(i, addresses[i] == mX.getZoneinfo(ids[i].c_str()));
+                ASSERTV(i, 0 == X.lookupZoneinfo(missingIds[i].c_str()));
+            }
+
+            // No further loads were requested.
+
+            ASSERT(ids[NUM_ZONES - 1] == testLoader.lastRequestedTimeZone());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCURRENT ACCESS
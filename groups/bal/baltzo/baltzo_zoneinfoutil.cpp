@@ -13,6 +13,7 @@ BSLS_IDENT_RCSID(baltzo_zoneinfoutil_cpp,"$Id$ $CSID$")
 
 #include <bsl_algorithm.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_string.h>
 
 #include <bsls_assert.h>
@@ -21,6 +22,104 @@ BSLS_IDENT_RCSID(baltzo_zoneinfoutil_cpp,"$Id$ $CSID$")
 #include <bsls_types.h>
 
 namespace BloombergLP {
+
+namespace {
+
+struct TransitionTimeLess {
+    // This 'struct' provides a comparator of a UTC time with the time of a
+    // transition, for use with 'bsl::upper_bound'.
+
+    bool operator()(bdlt::EpochUtil::TimeT64          utcTime,
+                    const baltzo::ZoneinfoTransition& transition) const
+        // Return 'true' if the specified 'utcTime' is before the time of the
+        // specified 'transition', and 'false' otherwise.
+    {
+        return utcTime < transition.utcTime();
+    }
+};
+
+class TransitionCursor {
+    // This class provides a mechanism that, for each of a sequence of UTC
+    // times, finds the transition in a time zone in effect at that time.  If
+    // a UTC time is at or after the previous time, the cursor advances
+    // linearly from the previous transition; otherwise it searches the
+    // transitions preceding the previous transition.
+
+    // DATA
+    baltzo::Zoneinfo::TransitionConstIterator d_begin;    // first transition
+
+    baltzo::Zoneinfo::TransitionConstIterator d_end;      // end of transitions
+
+    baltzo::Zoneinfo::TransitionConstIterator d_current;  // transition in
+                                                          // effect at the
+                                                          // previous time
+
+    bdlt::EpochUtil::TimeT64                  d_startTime;
+                                                  // time of 'd_current'
+
+    bdlt::EpochUtil::TimeT64                  d_nextTime;
+                                                  // time of the transition
+                                                  // after 'd_current', or the
+                                                  // maximum 'TimeT64' if
+                                                  // there is none
+
+    int                                       d_offsetInMinutes;
+                                                  // UTC offset of 'd_current'
+
+    // PRIVATE MANIPULATORS
+    void setCurrent(const baltzo::Zoneinfo::TransitionConstIterator& current)
+        // Make the specified 'current' the transition in effect.
+    {
+        d_current         = current;
+        d_startTime       = current->utcTime();
+        d_offsetInMinutes = current->descriptor().utcOffsetInSeconds() / 60;
+
+        baltzo::Zoneinfo::TransitionConstIterator next = current;
+        ++next;
+        d_nextTime = d_end == next
+                   ? bsl::numeric_limits<bdlt::EpochUtil::TimeT64>::max()
+                   : next->utcTime();
+    }
+
+  public:
+    // CREATORS
+    explicit TransitionCursor(const baltzo::Zoneinfo& timeZone)
+        // Create a cursor over the transitions of the specified 'timeZone'.
+        // The behavior is undefined unless
+        // 'baltzo::ZoneinfoUtil::isWellFormed(timeZone)' is 'true'.
+    : d_begin(timeZone.beginTransitions())
+    , d_end(timeZone.endTransitions())
+    {
+        setCurrent(d_begin);
+    }
+
+    // MANIPULATORS
+    int offsetInMinutes(bdlt::EpochUtil::TimeT64 utcTime)
+        // Return the UTC offset, rounded down to minute precision, of the
+        // transition in effect at the specified 'utcTime'.  The behavior is
+        // undefined unless 'utcTime' is at or after the first transition.
+    {
+        if (utcTime < d_startTime) {
+            baltzo::Zoneinfo::TransitionConstIterator it = bsl::upper_bound(
+                                                         d_begin,
+                                                         d_current,
+                                                         utcTime,
+                                                         TransitionTimeLess());
+            BSLS_ASSERT(d_begin != it);
+            setCurrent(--it);
+        }
+        else {
+            while (d_nextTime <= utcTime) {
+                baltzo::Zoneinfo::TransitionConstIterator next = d_current;
+                setCurrent(++next);
+            }
+        }
+        return d_offsetInMinutes;
+    }
+};
+
+}  // close unnamed namespace
+
 namespace baltzo {
 
                              // ------------------
@@ -57,6 +156,66 @@ int ZoneinfoUtil::convertUtcToLocalTime(
     return 0;
 }
 
+int ZoneinfoUtil::convertUtcToLocalTimes(bdlt::DatetimeTz      *resultTimes,
+                                         const bdlt::Datetime  *utcTimes,
+                                         int                    numTimes,
+                                         const Zoneinfo&        timeZone)
+{
+    BSLS_ASSERT(resultTimes || 0 == numTimes);
+    BSLS_ASSERT(utcTimes    || 0 == numTimes);
+    BSLS_ASSERT(0 <= numTimes);
+    BSLS_ASSERT_SAFE(isWellFormed(timeZone));
+
+    TransitionCursor cursor(timeZone);
+    for (int i = 0; i < numTimes; ++i) {
+        const int offsetInMinutes = cursor.offsetInMinutes(
+                               bdlt::EpochUtil::convertToTimeT64(utcTimes[i]));
+
+        bdlt::Datetime temp(utcTimes[i]);
+        if (0 != temp.addMinutesIfValid(offsetInMinutes)) {
+            return ErrorCode::k_OUT_OF_RANGE;                         // RETURN
+        }
+        resultTimes[i].setDatetimeTz(temp, offsetInMinutes);
+    }
+    return 0;
+}
+
+int ZoneinfoUtil::convertUtcToLocalTimes(
+                                  bdlt::DatetimeTz               *resultTimes,
+                                  const bdlt::EpochUtil::TimeT64 *utcTimes,
+                                  int                             numTimes,
+                                  const Zoneinfo&                 timeZone)
+{
+    BSLS_ASSERT(resultTimes || 0 == numTimes);
+    BSLS_ASSERT(utcTimes    || 0 == numTimes);
+    BSLS_ASSERT(0 <= numTimes);
+    BSLS_ASSERT_SAFE(isWellFormed(timeZone));
+
+    const bdlt::EpochUtil::TimeT64 minTime =
+                                        timeZone.beginTransitions()->utcTime();
+    const bdlt::EpochUtil::TimeT64 maxTime =
+                   bdlt::EpochUtil::convertToTimeT64(
+                                   bdlt::Datetime(9999, 12, 31, 23, 59, 59));
+
+    TransitionCursor cursor(timeZone);
+    for (int i = 0; i < numTimes; ++i) {
+        if (utcTimes[i] < minTime || maxTime < utcTimes[i]) {
+            return ErrorCode::k_OUT_OF_RANGE;                         // RETURN
+        }
+
+        const int offsetInMinutes = cursor.offsetInMinutes(utcTimes[i]);
+
+        bdlt::Datetime temp;
+        if (0 != bdlt::EpochUtil::convertFromTimeT64(
+                                     &temp,
+                                     utcTimes[i] + offsetInMinutes * 60)) {
+            return ErrorCode::k_OUT_OF_RANGE;                         // RETURN
+        }
+        resultTimes[i].setDatetimeTz(temp, offsetInMinutes);
+    }
+    return 0;
+}
+
 void ZoneinfoUtil::loadRelevantTransitions(
                      Zoneinfo::TransitionConstIterator *firstResultTransition,
                      Zoneinfo::TransitionConstIterator *secondResultTransition,
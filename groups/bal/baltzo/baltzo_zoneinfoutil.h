@@ -29,6 +29,14 @@ BSLS_IDENT("$Id: $")
 // whereas the time supplied as input to 'loadRelevantTransitions' is a *local*
 // time.
 //
+// 'convertUtcToLocalTimes' converts an array of UTC times (supplied either as
+// 'bdlt::Datetime' values or as 'bdlt::EpochUtil::TimeT64' values) in a
+// single call.  Consecutive times in ascending order are resolved by advancing
+// linearly through the sequence of transitions, rather than by searching the
+// sequence for each time, so converting a sorted array of 'N' times in a time
+// zone having 'M' transitions takes 'O(N + M)' time (and an unsorted array
+// takes no more than 'O(N * log(M))' time).
+//
 ///Determining Relevant Transitions with 'loadRelevantTransitions'
 ///---------------------------------------------------------------
 // The function 'loadRelevantTransitions' is used to find the transition in a
@@ -353,6 +361,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
 
 #include <bsl_iosfwd.h>
 
@@ -381,6 +390,32 @@ struct ZoneinfoUtil {
         // of the legal range that a 'bdlt::DatetimeTz' can represent.  The
         // behavior is undefined unless 'isWellFormed(timeZone)' is 'true'.
 
+    static int convertUtcToLocalTimes(bdlt::DatetimeTz      *resultTimes,
+                                      const bdlt::Datetime  *utcTimes,
+                                      int                    numTimes,
+                                      const Zoneinfo&        timeZone);
+    static int convertUtcToLocalTimes(
+                                 bdlt::DatetimeTz                *resultTimes,
+                                 const bdlt::EpochUtil::TimeT64  *utcTimes,
+                                 int                              numTimes,
+                                 const Zoneinfo&                  timeZone);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'resultTimes' array, the local date-time value, in the
+        // specified 'timeZone', corresponding to the respective element of the
+        // specified 'utcTimes' array.  Return 0 on success, and
+        // 'baltzo::ErrorCode::k_OUT_OF_RANGE' if a local time would be outside
+        // of the legal range that a 'bdlt::DatetimeTz' can represent (or, for
+        // 'bdlt::EpochUtil::TimeT64' values, if a UTC time is outside the
+        // range that a 'bdlt::Datetime' can represent), in which case the
+        // elements of 'resultTimes' at and after the position of that time
+        // are unspecified.  The behavior is undefined unless
+        // 'isWellFormed(timeZone)' is 'true', '0 <= numTimes', and
+        // 'resultTimes' and 'utcTimes' each refer to an array of at least
+        // 'numTimes' elements.  Note that the conversion is performed in
+        // linear time with respect to 'numTimes' and
+        // 'timeZone.numTransitions()' if 'utcTimes' is sorted in ascending
+        // order.
+
     static void loadRelevantTransitions(
                      Zoneinfo::TransitionConstIterator *firstResultTransition,
                      Zoneinfo::TransitionConstIterator *secondResultTransition,
@@ -17,6 +17,7 @@
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
@@ -54,11 +55,13 @@ using namespace std;
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [ 3] void convertUtcToLocalTime(DatetimeTz *, Transition *, UTC, Zone);
+// [ 6] int convertUtcToLocalTimes(DatetimeTz *, const Datetime *, int, Zone);
+// [ 6] int convertUtcToLocalTimes(DatetimeTz *, const TimeT64 *, int, Zone);
 // [ 4] void loadRelevantTransitions(TIt *, TIt *, Valid *, localTime, TZ);
 // [ 2] bool isWellFormed(const baltzo::Zoneinfo& timeZone);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 // [ 4] CONCERN: parameters are declared 'const'.
 // [ 4] CONCERN: No memory is ever allocated from the global allocator.
 // [ 4] CONCERN: Precondition violations are detected.
@@ -285,7 +288,7 @@ int main(int argc, char *argv[])
     const Validity::Enum I = baltzo::LocalTimeValidity::e_INVALID;
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -506,6 +509,236 @@ int main(int argc, char *argv[])
 //..
 
     } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING: 'convertUtcToLocalTimes'
+        //   Ensure that 'convertUtcToLocalTimes' loads, for each element of
+        //   the input array, the same value as 'convertUtcToLocalTime'.
+        //
+        // Concerns:
+        //: 1 Each element is converted using the transition in effect at that
+        //:   time, including times immediately before, at, and after a
+        //:   transition.
+        //:
+        //: 2 The conversion is correct whether the input is sorted in
+        //:   ascending order, sorted in descending order, or unsorted, and
+        //:   when consecutive times span several transitions.
+        //:
+        //: 3 The conversion of 'bdlt::EpochUtil::TimeT64' values matches the
+        //:   conversion of the corresponding 'bdlt::Datetime' values.
+        //:
+        //: 4 'ErrorCode::k_OUT_OF_RANGE' is returned if a result would be out
+        //:   of range, or if an epoch time is not a valid 'bdlt::Datetime'.
+        //:
+        //: 5 An empty array is converted without error.
+        //:
+        //: 6 No memory is allocated.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a time zone with a varied set of transitions, and an
+        //:   array of times at, and on either side of, each transition.
+        //:   (C-1)
+        //:
+        //: 2 Convert the array, and permutations of the array (reversed, and
+        //:   a fixed shuffle), as well as every other, and every fourth,
+        //:   element, and compare each result to that of
+        //:   'convertUtcToLocalTime'.  Repeat for the corresponding epoch
+        //:   times.  (C-1..3)
+        //:
+        //: 3 Convert the earliest representable time in a time zone west of
+        //:   UTC, and epoch times before and after the range of
+        //:   'bdlt::Datetime', and verify the result.  (C-4..5)
+        //:
+        //: 4 Verify that the default allocator was not used.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-7)
+        //
+        // Testing:
+        //   int convertUtcToLocalTimes(DatetimeTz *, const Datetime *, ...);
+        //   int convertUtcToLocalTimes(DatetimeTz *, const TimeT64 *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING: 'convertUtcToLocalTimes'"
+                          << "\n=================================" << endl;
+
+        const TransitionDescription TZ_DATA[] = {
+            { L_, "0001-01-01T00:00:00.000",   -5 * 60, "A", false },
+            { L_, "1900-01-01T00:00:00.000",    2 * 60, "B", false },
+            { L_, "1900-06-01T00:00:00.000",   -2 * 60, "C", true  },
+            { L_, "1950-06-01T00:00:00.000",    1 * 60, "D", false },
+            { L_, "2007-03-11T07:00:00.000",   -4 * 60, "E", true  },
+            { L_, "2007-11-04T06:00:00.000",   -5 * 60, "F", false },
+            { L_, "2010-03-14T07:00:00.000",   -4 * 60, "E", true  },
+            { L_, "2010-11-07T06:00:00.000",   -5 * 60, "F", false },
+            { L_, "9000-01-01T00:00:00.000",    3 * 60, "G", false },
+        };
+        const int NUM_TZ_DATA = sizeof TZ_DATA / sizeof *TZ_DATA;
+
+        baltzo::Zoneinfo timeZone(Z);
+        addTransitions(&timeZone, TZ_DATA, NUM_TZ_DATA);
+        ASSERT(Obj::isWellFormed(timeZone));
+
+        bsl::vector<bdlt::Datetime> times(Z);
+        for (int i = 1; i < NUM_TZ_DATA; ++i) {
+            const char           *TRANS      = TZ_DATA[i].d_transitionTime;
+            const bdlt::Datetime  TRANSITION = toDatetime(TRANS);
+            bdlt::Datetime time(TRANSITION);
+            time.addSeconds(-1);
+            times.push_back(time);
+            times.push_back(TRANSITION);
+            time = TRANSITION;
+            time.addSeconds(1);
+            times.push_back(time);
+            time.addDays(1);
+            times.push_back(time);
+        }
+        times.push_back(bdlt::Datetime(9999, 12, 30));
+
+        const int MAX_TIMES = static_cast<int>(times.size());
+
+        bsl::vector<bdlt::Datetime> reversed(times.rbegin(), times.rend(), Z);
+        bsl::vector<bdlt::Datetime> shuffled(Z);
+        for (int i = 0; i < MAX_TIMES; ++i) {
+            shuffled.push_back(times[(i * 7) % MAX_TIMES]);
+        }
+        bsl::vector<bdlt::Datetime> sparse(Z);
+        for (int i = 0; i < MAX_TIMES; i += 2) {
+            sparse.push_back(times[i]);
+        }
+        bsl::vector<bdlt::Datetime> sparser(Z);
+        for (int i = 0; i < MAX_TIMES; i += 4) {
+            sparser.push_back(times[i]);
+        }
+
+        const bsl::vector<bdlt::Datetime> *INPUTS[] = {
+            &times, &reversed, &shuffled, &sparse, &sparser
+        };
+        const int NUM_INPUTS = sizeof INPUTS / sizeof *INPUTS;
+
+        bsl::vector<bdlt::DatetimeTz>         results(MAX_TIMES, Z);
+        bsl::vector<bdlt::DatetimeTz>         epochResults(MAX_TIMES, Z);
+        bsl::vector<bdlt::EpochUtil::TimeT64> epochTimes(MAX_TIMES, Z);
+
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+            const bsl::vector<bdlt::Datetime>& INPUT = *INPUTS[ti];
+            const int NUM_TIMES = static_cast<int>(INPUT.size());
+
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                epochTimes[i] = toTimeT(INPUT[i]);
+            }
+
+            ASSERTV(ti, 0 == Obj::convertUtcToLocalTimes(results.data(),
+                                                         INPUT.data(),
+                                                         NUM_TIMES,
+                                                         timeZone));
+            ASSERTV(ti, 0 == Obj::convertUtcToLocalTimes(epochResults.data(),
+                                                         epochTimes.data(),
+                                                         NUM_TIMES,
+                                                         timeZone));
+
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                bdlt::DatetimeTz expected;
+                TzIt             it;
+                ASSERT(0 == Obj::convertUtcToLocalTime(&expected,
+                                                       &it,
+                                                       INPUT[i],
+                                                       timeZone));
+
+                if (veryVerbose) {
+                    P_(ti); P_(INPUT[i]); P_(expected); P(results[i]);
+                }
+                ASSERTV(ti, i, INPUT[i], expected, results[i],
+                        expected == results[i]);
+                ASSERTV(ti, i, INPUT[i], expected, epochResults[i],
+                        expected == epochResults[i]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting out of range values." << endl;
+        {
+            const baltzo::ErrorCode::Enum OUT_OF_RANGE =
+                                             baltzo::ErrorCode::k_OUT_OF_RANGE;
+
+            const bdlt::Datetime          MIN_TIME(1, 1, 1);
+            const bdlt::EpochUtil::TimeT64 MIN_T = toTimeT(MIN_TIME);
+            const bdlt::EpochUtil::TimeT64 MAX_T = toTimeT(
+                                     bdlt::Datetime(9999, 12, 31, 23, 59, 59));
+
+            ASSERT(OUT_OF_RANGE == Obj::convertUtcToLocalTimes(results.data(),
+                                                               &MIN_TIME,
+                                                               1,
+                                                               timeZone));
+            ASSERT(OUT_OF_RANGE == Obj::convertUtcToLocalTimes(results.data(),
+                                                               &MIN_T,
+                                                               1,
+                                                               timeZone));
+
+            baltzo::Zoneinfo utc(Z);
+            utc.addTransition(MIN_T, baltzo::LocalTimeDescriptor(0, false,
+                                                                 "UTC"));
+
+            const bdlt::EpochUtil::TimeT64 EPOCH_DATA[] = {
+                MIN_T - 1, MIN_T, MAX_T, MAX_T + 1
+            };
+            const int EXP[] = { OUT_OF_RANGE, 0, 0, OUT_OF_RANGE };
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, EXP[i] == Obj::convertUtcToLocalTimes(
+                                                             results.data(),
+                                                             EPOCH_DATA + i,
+                                                             1,
+                                                             utc));
+            }
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(9999, 12, 31, 23, 59, 59),
+                                    0) == results[0]);
+
+            ASSERT(0 == Obj::convertUtcToLocalTimes(results.data(),
+                                                    times.data(),
+                                                    0,
+                                                    timeZone));
+            ASSERT(0 == Obj::convertUtcToLocalTimes(
+                                          (bdlt::DatetimeTz *)0,
+                                          (const bdlt::EpochUtil::TimeT64 *)0,
+                                          0,
+                                          timeZone));
+        }
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Datetime           TIME(2000, 1, 1);
+            const bdlt::EpochUtil::TimeT64 T = toTimeT(TIME);
+            bdlt::DatetimeTz               result;
+
+            ASSERT_PASS(Obj::convertUtcToLocalTimes(&result, &TIME, 1,
+                                                    timeZone));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(0, &TIME, 1, timeZone));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(
+                                                 &result,
+                                                 (const bdlt::Datetime *)0,
+                                                 1,
+                                                 timeZone));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(&result, &TIME, -1,
+                                                    timeZone));
+
+            ASSERT_PASS(Obj::convertUtcToLocalTimes(&result, &T, 1,
+                                                    timeZone));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(0, &T, 1, timeZone));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(&result, &T, -1,
+                                                    timeZone));
+
+            baltzo::Zoneinfo badTimeZone(Z);
+            ASSERT_SAFE_FAIL(Obj::convertUtcToLocalTimes(&result, &TIME, 1,
+                                                         badTimeZone));
+        }
+      } break;
      case 5: {
         // --------------------------------------------------------------------
         // TESTING: 'loadRelevantTransitions'
@@ -0,0 +1,364 @@
+// bblb_mmapcalendarloader.cpp                                        -*-C++-*-
+#include <bblb_mmapcalendarloader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bblb_mmapcalendarloader_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bigendian.h>
+
+#include <bdls_mappedrecordfile.h>
+
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+#include <bdlt_dayofweekset.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+namespace {
+
+typedef bdlb::BigEndianInt32       Int32;
+typedef bdls::MappedRecordFile     MappedFile;
+typedef MappedFile::FileHeader     FileHeader;
+typedef MappedFile::DirectoryEntry DirectoryEntry;
+
+const char k_MAGIC[4] = { 'B', 'C', 'A', 'L' };
+const int  k_VERSION  = 1;
+
+const int  k_WEEKEND_DAYS_MASK = 0xFE;
+    // bits that may be set in a weekend-days mask ('bdlt::DayOfWeek::Enum'
+    // values are in the range '[1 .. 7]')
+
+struct RecordHeader {
+    // This 'struct' overlays the fixed-size prefix of a calendar record.
+
+    Int32 d_firstDate;
+    Int32 d_lastDate;
+    Int32 d_numTransitions;
+    Int32 d_numHolidays;
+    Int32 d_numHolidayCodes;
+};
+
+struct Transition {
+    // This 'struct' overlays one weekend-days transition in a calendar record.
+
+    Int32 d_date;
+    Int32 d_weekendDaysMask;
+};
+
+struct Holiday {
+    // This 'struct' overlays one holiday in a calendar record.
+
+    Int32 d_offset;
+    Int32 d_numCodes;
+};
+
+inline
+int toSerial(const bdlt::Date& date)
+    // Return the number of days between 0001/01/01 and the specified 'date'.
+{
+    return date - bdlt::Date();
+}
+
+inline
+bdlt::Date fromSerial(int serialDate)
+    // Return the date that is the specified 'serialDate' days after
+    // 0001/01/01.  The behavior is undefined unless
+    // 'isValidSerial(serialDate)'.
+{
+    return bdlt::Date() + serialDate;
+}
+
+inline
+bool isValidSerial(int serialDate)
+    // Return 'true' if the specified 'serialDate' represents a valid
+    // 'bdlt::Date', and 'false' otherwise.
+{
+    return 0 <= serialDate
+        && serialDate <= bdlt::Date(9999, 12, 31) - bdlt::Date();
+}
+
+int recordSize(const bdlt::PackedCalendar& calendar)
+    // Return the size, in bytes, of the record encoding the specified
+    // 'calendar'.
+{
+    return static_cast<int>(
+                    sizeof(RecordHeader)
+                  + calendar.numWeekendDaysTransitions() * sizeof(Transition)
+                  + calendar.numHolidays() * sizeof(Holiday)
+                  + calendar.numHolidayCodesTotal() * sizeof(Int32));
+}
+
+void putRecord(bsl::ostream& stream, const bdlt::PackedCalendar& calendar)
+    // Write the record encoding the specified 'calendar' to the specified
+    // 'stream'.
+{
+    MappedFile::writeInt(stream, toSerial(calendar.firstDate()));
+    MappedFile::writeInt(stream, toSerial(calendar.lastDate()));
+    MappedFile::writeInt(stream, calendar.numWeekendDaysTransitions());
+    MappedFile::writeInt(stream, calendar.numHolidays());
+    MappedFile::writeInt(stream, calendar.numHolidayCodesTotal());
+
+    typedef bdlt::PackedCalendar Calendar;
+
+    for (Calendar::WeekendDaysTransitionConstIterator it =
+                                       calendar.beginWeekendDaysTransitions();
+         it != calendar.endWeekendDaysTransitions();
+         ++it) {
+        int mask = 0;
+        for (int day = bdlt::DayOfWeek::e_SUN;
+             day <= bdlt::DayOfWeek::e_SAT;
+             ++day) {
+            if (it->second.isMember(static_cast<bdlt::DayOfWeek::Enum>(day))) {
+                mask |= 1 << day;
+            }
+        }
+        MappedFile::writeInt(stream, toSerial(it->first));
+        MappedFile::writeInt(stream, mask);
+    }
+
+    for (Calendar::HolidayConstIterator it =
+                                                      calendar.beginHolidays();
+         it != calendar.endHolidays();
+         ++it) {
+        MappedFile::writeInt(stream, *it - calendar.firstDate());
+        MappedFile::writeInt(stream, calendar.numHolidayCodes(*it));
+    }
+
+    for (Calendar::HolidayConstIterator it =
+                                                      calendar.beginHolidays();
+         it != calendar.endHolidays();
+         ++it) {
+        for (Calendar::HolidayCodeConstIterator jt =
+                                                calendar.beginHolidayCodes(it);
+             jt != calendar.endHolidayCodes(it);
+             ++jt) {
+            MappedFile::writeInt(stream, *jt);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class MmapCalendarLoader
+                          // ------------------------
+
+// CLASS METHODS
+int MmapCalendarLoader::write(
+                 bsl::ostream&                                      stream,
+                 const bsl::map<bsl::string, bdlt::PackedCalendar>& calendars)
+{
+    typedef bsl::map<bsl::string, bdlt::PackedCalendar>::const_iterator
+                                                                      CalIter;
+
+    const int numCalendars = static_cast<int>(calendars.size());
+
+    // Lay out the name table, padded so that the records that follow it are
+    // aligned on a 4-byte boundary.
+
+    const int namesOffset = static_cast<int>(
+                   sizeof(FileHeader) + numCalendars * sizeof(DirectoryEntry));
+
+    bsls::Types::Int64 namesEnd = namesOffset;
+    for (CalIter it = calendars.begin(); it != calendars.end(); ++it) {
+        namesEnd += it->first.size() + 1;
+    }
+
+    const bsls::Types::Int64 recordsOffset =
+          (namesEnd + sizeof(Int32) - 1) / sizeof(Int32) * sizeof(Int32);
+
+    bsls::Types::Int64 offset = recordsOffset;
+
+    bsl::vector<int> recordOffsets;
+    recordOffsets.reserve(numCalendars);
+    for (CalIter it = calendars.begin(); it != calendars.end(); ++it) {
+        recordOffsets.push_back(static_cast<int>(offset));
+        offset += recordSize(it->second);
+    }
+
+    if (offset > INT_MAX) {
+        return 1;                                                     // RETURN
+    }
+
+    MappedFile::writeHeader(stream,
+                            k_MAGIC,
+                            k_VERSION,
+                            numCalendars,
+                            static_cast<int>(offset));
+
+    int nameOffset = namesOffset;
+    int index      = 0;
+    for (CalIter it = calendars.begin(); it != calendars.end(); ++it) {
+        BSLS_ASSERT(bsl::string::npos == it->first.find('\0'));
+
+        MappedFile::writeInt(stream, nameOffset);
+        MappedFile::writeInt(stream, recordOffsets[index++]);
+        nameOffset += static_cast<int>(it->first.size() + 1);
+    }
+
+    for (CalIter it = calendars.begin(); it != calendars.end(); ++it) {
+        stream.write(it->first.c_str(), it->first.size() + 1);
+    }
+    for (bsls::Types::Int64 i = namesEnd; i < recordsOffset; ++i) {
+        stream.put('\0');
+    }
+
+    for (CalIter it = calendars.begin(); it != calendars.end(); ++it) {
+        putRecord(stream, it->second);
+    }
+
+    return stream.good() ? 0 : 2;
+}
+
+// CREATORS
+MmapCalendarLoader::MmapCalendarLoader()
+{
+}
+
+MmapCalendarLoader::~MmapCalendarLoader()
+{
+}
+
+// MANIPULATORS
+int MmapCalendarLoader::initialize(const char *path)
+{
+    BSLS_ASSERT(path);
+
+    return d_file.map(path, k_MAGIC, k_VERSION, sizeof(RecordHeader));
+}
+
+int MmapCalendarLoader::load(bdlt::PackedCalendar *result,
+                             const char           *calendarName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(calendarName);
+
+    const int recordOffset = d_file.findRecord(calendarName);
+    if (recordOffset < 0) {
+        return 1;                                                     // RETURN
+    }
+
+    // Validate the record before decoding it.  Note that 'd_file' has
+    // verified that the record header is within the file.
+
+    const RecordHeader *header = reinterpret_cast<const RecordHeader *>(
+                                                 d_file.data() + recordOffset);
+
+    const int firstDate       = header->d_firstDate;
+    const int lastDate        = header->d_lastDate;
+    const int numTransitions  = header->d_numTransitions;
+    const int numHolidays     = header->d_numHolidays;
+    const int numHolidayCodes = header->d_numHolidayCodes;
+
+    if (!isValidSerial(firstDate)
+     || !isValidSerial(lastDate)
+     || numTransitions  < 0
+     || numHolidays     < 0
+     || numHolidayCodes < 0
+     || (firstDate > lastDate && 0 != numHolidays)) {
+        return 2;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 size =
+              sizeof(RecordHeader)
+            + static_cast<bsls::Types::Int64>(numTransitions) *
+                                                            sizeof(Transition)
+            + static_cast<bsls::Types::Int64>(numHolidays) * sizeof(Holiday)
+            + static_cast<bsls::Types::Int64>(numHolidayCodes) * sizeof(Int32);
+
+    if (size > static_cast<bsls::Types::Int64>(d_file.size()
+                                                          - recordOffset)) {
+        return 3;                                                     // RETURN
+    }
+
+    const Transition *transitions =
+                            reinterpret_cast<const Transition *>(header + 1);
+    const Holiday    *holidays    =
+                      reinterpret_cast<const Holiday *>(transitions +
+                                                        numTransitions);
+    const Int32      *codes       =
+                           reinterpret_cast<const Int32 *>(holidays +
+                                                           numHolidays);
+
+    result->removeAll();
+
+    if (firstDate <= lastDate) {
+        result->setValidRange(fromSerial(firstDate), fromSerial(lastDate));
+    }
+    result->reserveHolidayCapacity(numHolidays);
+    result->reserveHolidayCodeCapacity(numHolidayCodes);
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const int date = transitions[i].d_date;
+        const int mask = transitions[i].d_weekendDaysMask;
+
+        if (!isValidSerial(date) || 0 != (mask & ~k_WEEKEND_DAYS_MASK)) {
+            return 4;                                                 // RETURN
+        }
+
+        bdlt::DayOfWeekSet weekendDays;
+        for (int day = bdlt::DayOfWeek::e_SUN;
+             day <= bdlt::DayOfWeek::e_SAT;
+             ++day) {
+            if (mask & (1 << day)) {
+                weekendDays.add(static_cast<bdlt::DayOfWeek::Enum>(day));
+            }
+        }
+        result->addWeekendDaysTransition(fromSerial(date), weekendDays);
+    }
+
+    const int length = lastDate - firstDate + 1;
+    int       code   = 0;
+
+    for (int i = 0; i < numHolidays; ++i) {
+        const int offset   = holidays[i].d_offset;
+        const int numCodes = holidays[i].d_numCodes;
+
+        if (offset < 0
+         || offset >= length
+         || numCodes < 0
+         || numCodes > numHolidayCodes - code) {
+            return 5;                                                 // RETURN
+        }
+
+        const bdlt::Date date = fromSerial(firstDate + offset);
+
+        result->addHoliday(date);
+        for (const int end = code + numCodes; code < end; ++code) {
+            result->addHolidayCode(date, codes[code]);
+        }
+    }
+
+    if (code != numHolidayCodes) {
+        return 6;                                                     // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,241 @@
+// bblb_mmapcalendarloader.h                                          -*-C++-*-
+#ifndef INCLUDED_BBLB_MMAPCALENDARLOADER
+#define INCLUDED_BBLB_MMAPCALENDARLOADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a calendar loader backed by a memory-mapped binary file.
+//
+//@CLASSES:
+//  bblb::MmapCalendarLoader: loader of calendars from a mapped binary file
+//
+//@SEE_ALSO: bdlt_calendarloader, bdlt_calendarcache, bdlt_packedcalendar,
+//           bdls_mappedrecordfile
+//
+//@DESCRIPTION: This component provides a concrete implementation,
+// 'bblb::MmapCalendarLoader', of the 'bdlt::CalendarLoader' protocol that
+// loads calendars from a single compact binary file.  The file is mapped
+// read-only into the address space of the process by 'initialize', and each
+// calendar is decoded directly from the mapped pages when it is requested by
+// name through 'load'.  No calendar is parsed, and no per-calendar work is
+// done, until it is first requested.
+//
+// Because the mapping is shared and read-only, every process that maps the
+// same calendar file shares a single copy of its pages in the operating
+// system's page cache; a host running many processes that use the same
+// holiday data therefore pays for that data once.  Note that
+// 'bdlt::PackedCalendar' owns its storage, so 'load' necessarily copies the
+// requested calendar out of the mapping; what the mapping eliminates is the
+// cost of reading and parsing the entire holiday database at startup.
+//
+// A calendar file is produced by the 'write' class method, which encodes a
+// set of named 'bdlt::PackedCalendar' objects.  Typically, a file is built
+// once from the authoritative holiday source and then distributed to the
+// hosts that use it.
+//
+///File Format
+///-----------
+// All integer fields in a calendar file are 32-bit signed values stored in
+// network (big-endian) byte order, so that a file is portable across
+// platforms.  Dates are stored as the number of days since 0001/01/01.  A file
+// consists of a header, a directory of calendar names sorted in increasing
+// lexicographic order, a table of null-terminated names, and one record per
+// calendar, laid out (and, except for the records, validated) as a
+// 'bdls::MappedRecordFile':
+//..
+//  header:     "BCAL" | version | numCalendars | fileSize
+//  directory:  numCalendars * { nameOffset | recordOffset }
+//  names:      null-terminated calendar names
+//  record:     firstDate | lastDate | numTransitions | numHolidays |
+//              numHolidayCodes |
+//              numTransitions  * { date | weekendDaysMask } |
+//              numHolidays     * { dateOffset | numCodesForHoliday } |
+//              numHolidayCodes * { holidayCode }
+//..
+// The 'weekendDaysMask' of a weekend-days transition has bit 'd' set if the
+// day whose 'bdlt::DayOfWeek::Enum' value is 'd' is a weekend day.  The
+// holiday codes of each holiday follow those of the preceding holiday in
+// the 'holidayCode' array.  The header and directory are validated by
+// 'initialize'; each record is validated when it is loaded.
+//
+///Thread Safety
+///-------------
+// 'bblb::MmapCalendarLoader' is *not* thread-safe while it is being
+// initialized.  Once 'initialize' has returned successfully, 'load' only
+// reads the mapped file and may be called concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Calendar File Among Processes
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service builds a calendar file from its holiday database,
+// and that many processes on each host need those calendars.
+//
+// First, the build step populates the calendars and writes them to a file:
+//..
+//  bsl::map<bsl::string, bdlt::PackedCalendar> calendars;
+//
+//  bdlt::PackedCalendar& us = calendars["US"];
+//  us.setValidRange(bdlt::Date(2026, 1, 1), bdlt::Date(2026, 12, 31));
+//  us.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+//  us.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+//  us.addHoliday(bdlt::Date(2026, 7, 3));
+//  us.addHolidayCode(bdlt::Date(2026, 12, 25), 25);
+//
+//  bdlt::PackedCalendar& gb = calendars["GB"];
+//  gb.setValidRange(bdlt::Date(2026, 1, 1), bdlt::Date(2026, 12, 31));
+//  gb.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+//  gb.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+//  gb.addHoliday(bdlt::Date(2026, 12, 28));
+//
+//  bsl::ofstream output(fileName, bsl::ios::binary);
+//  int rc = bblb::MmapCalendarLoader::write(output, calendars);
+//  assert(0 == rc);
+//  output.close();
+//..
+// Then, each process creates a loader and maps the file:
+//..
+//  bblb::MmapCalendarLoader loader;
+//
+//  rc = loader.initialize(fileName);
+//  assert(0 == rc);
+//  assert(2 == loader.numCalendars());
+//..
+// Next, the loader is installed in a calendar cache, which loads each calendar
+// the first time it is requested:
+//..
+//  bdlt::CalendarCache cache(&loader);
+//
+//  bsl::shared_ptr<const bdlt::Calendar> calendar = cache.getCalendar("US");
+//  assert(calendar);
+//  assert(calendar->isHoliday(bdlt::Date(2026, 7, 3)));
+//  assert(calendar->isWeekendDay(bdlt::Date(2026, 7, 4)));
+//  assert(25 == calendar->holidayCode(bdlt::Date(2026, 12, 25), 0));
+//..
+// Finally, we observe that a calendar that is not in the file is reported as
+// not found:
+//..
+//  assert(!cache.getCalendar("XX"));
+//..
+
+#include <bblscm_version.h>
+
+#include <bdls_mappedrecordfile.h>
+
+#include <bdlt_calendarloader.h>
+#include <bdlt_packedcalendar.h>
+
+#include <bsls_keyword.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+                          // ========================
+                          // class MmapCalendarLoader
+                          // ========================
+
+class MmapCalendarLoader : public bdlt::CalendarLoader {
+    // This class provides a concrete implementation of the
+    // 'bdlt::CalendarLoader' protocol that loads calendars from a binary
+    // calendar file that is memory-mapped read-only.  See {File Format}.
+
+    // DATA
+    bdls::MappedRecordFile d_file;  // mapped calendar file, if initialized
+
+  private:
+    // NOT IMPLEMENTED
+    MmapCalendarLoader(const MmapCalendarLoader&);
+    MmapCalendarLoader& operator=(const MmapCalendarLoader&);
+
+  public:
+    // CLASS METHODS
+    static int write(
+                bsl::ostream&                                      stream,
+                const bsl::map<bsl::string, bdlt::PackedCalendar>& calendars);
+        // Write, to the specified 'stream', a calendar file containing each
+        // of the specified 'calendars' under its associated name.  Return 0
+        // on success, and a non-zero value otherwise.  The behavior is
+        // undefined unless no name in 'calendars' contains a null character.
+
+    // CREATORS
+    MmapCalendarLoader();
+        // Create an uninitialized calendar loader.  Note that an uninitialized
+        // loader reports every calendar as not found.
+
+    ~MmapCalendarLoader() BSLS_KEYWORD_OVERRIDE;
+        // Unmap the calendar file, if any, and destroy this loader.
+
+    // MANIPULATORS
+    int initialize(const char *path);
+        // Map the calendar file at the specified 'path' and validate its
+        // header and directory.  Return 0 on success, and a non-zero value
+        // (with no effect on the state of this loader) otherwise.  On success,
+        // any file previously mapped by this loader is unmapped.
+
+    int load(bdlt::PackedCalendar *result, const char *calendarName)
+                                                         BSLS_KEYWORD_OVERRIDE;
+        // Load, into the specified 'result', the calendar identified by the
+        // specified 'calendarName'.  Return 0 on success, and a non-zero value
+        // otherwise.  If the calendar corresponding to 'calendarName' is not
+        // found, 1 is returned with no effect on '*result'.  If a non-zero
+        // value other than 1 is returned (indicating a corrupt record),
+        // '*result' is valid, but its value is undefined.
+
+    // ACCESSORS
+    bool isInitialized() const;
+        // Return 'true' if this loader has mapped a calendar file, and
+        // 'false' otherwise.
+
+    int numCalendars() const;
+        // Return the number of calendars in the mapped calendar file, or 0 if
+        // this loader is not initialized.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class MmapCalendarLoader
+                          // ------------------------
+
+// ACCESSORS
+inline
+bool MmapCalendarLoader::isInitialized() const
+{
+    return d_file.isMapped();
+}
+
+inline
+int MmapCalendarLoader::numCalendars() const
+{
+    return d_file.numRecords();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,704 @@
+// bblb_mmapcalendarloader.t.cpp                                      -*-C++-*-
+#include <bblb_mmapcalendarloader.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_calendar.h>
+#include <bdlt_calendarcache.h>
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+#include <bdlt_dayofweekset.h>
+#include <bdlt_packedcalendar.h>
+
+#include <bslim_testutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a calendar loader that maps a binary calendar
+// file written by its own 'write' class method.  We test that a set of
+// calendars exercising every part of the file format survives a round trip
+// through 'write', 'initialize', and 'load', that unknown names are reported
+// as not found without modifying the result, and that corrupt headers,
+// directories, and records are rejected.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int write(bsl::ostream& stream, const bsl::map<...>& calendars);
+//
+// CREATORS
+// [ 2] MmapCalendarLoader();
+// [ 2] ~MmapCalendarLoader();
+//
+// MANIPULATORS
+// [ 2] int initialize(const char *path);
+// [ 2] int load(bdlt::PackedCalendar *result, const char *calendarName);
+//
+// ACCESSORS
+// [ 2] bool isInitialized() const;
+// [ 2] int numCalendars() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CORRUPT FILES
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//             NON-STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define DAY(X) bdlt::DayOfWeek::e_##X       // Shorten qualified name
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bblb::MmapCalendarLoader                    Obj;
+typedef bsl::map<bsl::string, bdlt::PackedCalendar> CalendarMap;
+
+// ============================================================================
+//                           TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bblb_mmapcalendarloader." << bdls::ProcessUtil::getProcessId()
+        << "." << test << ".tmp";
+    return oss.str();
+}
+
+static
+void writeFile(const bsl::string& fileName, const bsl::string& contents)
+    // Write the specified 'contents' to the file having the specified
+    // 'fileName', replacing any existing file.
+{
+    bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+    output.write(contents.data(), contents.size());
+}
+
+static
+int getInt(const bsl::string& contents, bsl::size_t position)
+    // Return the big-endian 32-bit integer at the specified 'position' in the
+    // specified 'contents'.
+{
+    unsigned int value = 0;
+    for (bsl::size_t i = 0; i < 4; ++i) {
+        value = (value << 8)
+              | static_cast<unsigned char>(contents[position + i]);
+    }
+    return static_cast<int>(value);
+}
+
+static
+void setInt(bsl::string *contents, bsl::size_t position, int value)
+    // Store the specified 'value' as a big-endian 32-bit integer at the
+    // specified 'position' in the specified 'contents'.
+{
+    unsigned int bits = static_cast<unsigned int>(value);
+    for (bsl::size_t i = 4; i > 0; --i) {
+        (*contents)[position + i - 1] = static_cast<char>(bits & 0xFF);
+        bits >>= 8;
+    }
+}
+
+static
+void populate(CalendarMap *calendars)
+    // Load, into the specified 'calendars', a set of calendars that exercises
+    // every part of the calendar file format.
+{
+    // An empty calendar.
+
+    (*calendars)["EMPTY"];
+
+    // A calendar with weekend-days transitions but no valid range.
+
+    bdlt::PackedCalendar& noRange = (*calendars)["NO_RANGE"];
+    bdlt::DayOfWeekSet    weekendDays;
+    weekendDays.add(DAY(FRI));
+    noRange.addWeekendDaysTransition(bdlt::Date(2000, 1, 1), weekendDays);
+
+    // A single-day calendar.
+
+    bdlt::PackedCalendar& oneDay = (*calendars)["ONE_DAY"];
+    oneDay.setValidRange(bdlt::Date(2026, 10, 19), bdlt::Date(2026, 10, 19));
+    oneDay.addHolidayCode(bdlt::Date(2026, 10, 19), -7);
+
+    // A calendar spanning the full range of 'bdlt::Date'.
+
+    bdlt::PackedCalendar& full = (*calendars)["FULL"];
+    full.setValidRange(bdlt::Date(1, 1, 1), bdlt::Date(9999, 12, 31));
+    full.addHoliday(bdlt::Date(1, 1, 1));
+    full.addHoliday(bdlt::Date(9999, 12, 31));
+    full.addWeekendDay(DAY(SUN));
+
+    // A calendar with several transitions, holidays with and without codes,
+    // and holidays with several codes.
+
+    bdlt::PackedCalendar& big = (*calendars)["US NYSE"];
+    big.setValidRange(bdlt::Date(1990, 1, 1), bdlt::Date(2040, 12, 31));
+
+    bdlt::DayOfWeekSet sunOnly;
+    sunOnly.add(DAY(SUN));
+    bdlt::DayOfWeekSet satSun;
+    satSun.add(DAY(SAT));
+    satSun.add(DAY(SUN));
+    bdlt::DayOfWeekSet none;
+    big.addWeekendDaysTransition(bdlt::Date(1, 1, 1), sunOnly);
+    big.addWeekendDaysTransition(bdlt::Date(1995, 6, 1), satSun);
+    big.addWeekendDaysTransition(bdlt::Date(2030, 1, 1), none);
+
+    for (int year = 1990; year <= 2040; ++year) {
+        big.addHoliday(bdlt::Date(year, 1, 1));
+        big.addHolidayCode(bdlt::Date(year, 7, 4), year);
+        big.addHolidayCode(bdlt::Date(year, 12, 25), 1);
+        big.addHolidayCode(bdlt::Date(year, 12, 25), 2);
+        big.addHolidayCode(bdlt::Date(year, 12, 25), 1 << 30);
+    }
+
+    // Many small calendars, so that the directory search has some depth.
+
+    for (int i = 0; i < 100; ++i) {
+        bsl::ostringstream name;
+        name << "CAL" << i;
+
+        bdlt::PackedCalendar& calendar = (*calendars)[name.str()];
+        calendar.setValidRange(bdlt::Date(2000, 1, 1),
+                               bdlt::Date(2000, 1, 1) + 365 + i);
+        calendar.addHoliday(bdlt::Date(2000, 1, 1) + i);
+        calendar.addWeekendDay(static_cast<bdlt::DayOfWeek::Enum>(i % 7 + 1));
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string fileNameString = tempFileName(test);
+        const char *fileName = fileNameString.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Calendar File Among Processes
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service builds a calendar file from its holiday database,
+// and that many processes on each host need those calendars.
+//
+// First, the build step populates the calendars and writes them to a file:
+//..
+    bsl::map<bsl::string, bdlt::PackedCalendar> calendars;
+
+    bdlt::PackedCalendar& us = calendars["US"];
+    us.setValidRange(bdlt::Date(2026, 1, 1), bdlt::Date(2026, 12, 31));
+    us.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    us.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+    us.addHoliday(bdlt::Date(2026, 7, 3));
+    us.addHolidayCode(bdlt::Date(2026, 12, 25), 25);
+
+    bdlt::PackedCalendar& gb = calendars["GB"];
+    gb.setValidRange(bdlt::Date(2026, 1, 1), bdlt::Date(2026, 12, 31));
+    gb.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    gb.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+    gb.addHoliday(bdlt::Date(2026, 12, 28));
+
+    bsl::ofstream output(fileName, bsl::ios::binary);
+    int rc = bblb::MmapCalendarLoader::write(output, calendars);
+    ASSERT(0 == rc);
+    output.close();
+//..
+// Then, each process creates a loader and maps the file:
+//..
+    bblb::MmapCalendarLoader loader;
+
+    rc = loader.initialize(fileName);
+    ASSERT(0 == rc);
+    ASSERT(2 == loader.numCalendars());
+//..
+// Next, the loader is installed in a calendar cache, which loads each calendar
+// the first time it is requested:
+//..
+    bdlt::CalendarCache cache(&loader);
+
+    bsl::shared_ptr<const bdlt::Calendar> calendar = cache.getCalendar("US");
+    ASSERT(calendar);
+    ASSERT(calendar->isHoliday(bdlt::Date(2026, 7, 3)));
+    ASSERT(calendar->isWeekendDay(bdlt::Date(2026, 7, 4)));
+    ASSERT(25 == calendar->holidayCode(bdlt::Date(2026, 12, 25), 0));
+//..
+// Finally, we observe that a calendar that is not in the file is reported as
+// not found:
+//..
+    ASSERT(!cache.getCalendar("XX"));
+//..
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CORRUPT FILES
+        //
+        // Concerns:
+        //: 1 'initialize' fails, leaving the loader unchanged, if the file
+        //:   does not exist, is too short, or has a bad magic number,
+        //:   version, size, directory entry, or name order.
+        //:
+        //: 2 'load' returns a value other than 0 or 1 for a corrupt record.
+        //
+        // Plan:
+        //: 1 Write a valid file to a string, corrupt one field at a time,
+        //:   and verify that 'initialize' fails and that a previously mapped
+        //:   file remains usable.  (C-1)
+        //:
+        //: 2 Corrupt one field of a record at a time and verify the status
+        //:   returned by 'load'.  (C-2)
+        //
+        // Testing:
+        //   CORRUPT FILES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CORRUPT FILES" << endl
+                                  << "=============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        CalendarMap calendars;
+        bdlt::PackedCalendar& a = calendars["A"];
+        a.setValidRange(bdlt::Date(2026, 1, 1), bdlt::Date(2026, 12, 31));
+        a.addWeekendDay(DAY(SAT));
+        a.addHolidayCode(bdlt::Date(2026, 1, 1), 5);
+        calendars["B"];
+
+        bsl::ostringstream oss;
+        ASSERT(0 == Obj::write(oss, calendars));
+        const bsl::string GOOD = oss.str();
+
+        ASSERT(GOOD.size() == static_cast<bsl::size_t>(getInt(GOOD, 12)));
+
+        if (verbose) cout << "\tTesting corrupt headers." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.initialize("no/such/calendar/file"));
+            ASSERT(false == X.isInitialized());
+
+            writeFile(fileName, GOOD);
+            ASSERT(0 == mX.initialize(fileName.c_str()));
+            ASSERT(2 == X.numCalendars());
+
+            const int NAME_A   = getInt(GOOD, 16);
+            const int RECORD_A = getInt(GOOD, 20);
+
+            const struct {
+                int d_line;
+                int d_position;  // -1 to truncate to 'd_value' bytes
+                int d_value;
+            } DATA[] = {
+                //LINE  POSITION  VALUE
+                //----  --------  ----------
+                { L_,         -1,          0 },
+                { L_,         -1,          8 },
+                { L_,         -1,         15 },
+                { L_,          0, 0x58434154 },  // "XCAT"
+                { L_,          4,          2 },
+                { L_,          8,         -1 },
+                { L_,          8, 0x10000000 },
+                { L_,         12,          0 },
+                { L_,         16,          0 },
+                { L_,         16, 0x7FFFFFF0 },
+                { L_,         20,          2 },
+                { L_,         20, NAME_A + 1 },
+                { L_,         20, 0x7FFFFFF0 },
+                { L_,         20,         -4 },
+                { L_,         24,     NAME_A },  // duplicate name
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            ASSERT(0 == RECORD_A % 4);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int POSITION = DATA[ti].d_position;
+                const int VALUE    = DATA[ti].d_value;
+
+                if (veryVerbose) { T_ P_(LINE) P_(POSITION) P(VALUE) }
+
+                bsl::string contents = GOOD;
+                if (0 > POSITION) {
+                    contents.resize(VALUE);
+                }
+                else {
+                    setInt(&contents, POSITION, VALUE);
+                }
+
+                const bsl::string otherFile = fileName + ".bad";
+                writeFile(otherFile, contents);
+                ASSERTV(LINE, 0 != mX.initialize(otherFile.c_str()));
+                bdls::FilesystemUtil::remove(otherFile);
+
+                ASSERTV(LINE, X.isInitialized());
+                ASSERTV(LINE, 2 == X.numCalendars());
+
+                bdlt::PackedCalendar result;
+                ASSERTV(LINE, 0 == mX.load(&result, "A"));
+                ASSERTV(LINE, a == result);
+            }
+
+            // Names out of order are rejected.
+
+            bsl::string contents = GOOD;
+            const int   nameB    = getInt(GOOD, 24);
+            setInt(&contents, 16, nameB);
+            setInt(&contents, 24, NAME_A);
+            writeFile(fileName, contents);
+            ASSERT(0 != mX.initialize(fileName.c_str()));
+        }
+
+        if (verbose) cout << "\tTesting corrupt records." << endl;
+        {
+            const int RECORD = getInt(GOOD, 20);
+            const int LAST   = RECORD + 4;
+            const int NUM_T  = RECORD + 8;
+            const int NUM_H  = RECORD + 12;
+            const int NUM_C  = RECORD + 16;
+            const int T_MASK = RECORD + 24;
+            const int H_OFF  = RECORD + 28;
+            const int H_NUM  = RECORD + 32;
+
+            const int MAX_DATE = bdlt::Date(9999, 12, 31) - bdlt::Date() + 1;
+
+            const struct {
+                int d_line;
+                int d_field;
+                int d_value;
+                int d_expected;
+            } DATA[] = {
+                //LINE  FIELD  VALUE       EXP
+                //----  -----  ----------  ---
+                { L_,       0,         -1,   2 },
+                { L_,       0,   MAX_DATE,   2 },
+                { L_,       1,          0,   2 },
+                { L_,       2,         -1,   2 },
+                { L_,       3, 0x10000000,   3 },
+                { L_,       4, 0x10000000,   3 },
+                { L_,       5,          1,   4 },
+                { L_,       5,      0x100,   4 },
+                { L_,       6,         -1,   5 },
+                { L_,       6,        365,   5 },
+                { L_,       7,          2,   5 },
+                { L_,       7,          0,   6 },
+                { L_,       6,        364,   0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const int FIELDS[] = {
+                LAST, LAST, NUM_T, NUM_H, NUM_C, T_MASK, H_OFF, H_NUM
+            };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIELD = DATA[ti].d_field;
+                const int VALUE = DATA[ti].d_value;
+                const int EXP   = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIELD) P(VALUE) }
+
+                bsl::string contents = GOOD;
+                setInt(&contents, 0 == FIELD ? RECORD : FIELDS[FIELD], VALUE);
+                writeFile(fileName, contents);
+
+                Obj mX;
+                ASSERTV(LINE, 0 == mX.initialize(fileName.c_str()));
+
+                bdlt::PackedCalendar result;
+                ASSERTV(LINE, EXP, EXP == mX.load(&result, "A"));
+
+                bdlt::PackedCalendar empty;
+                ASSERTV(LINE, 0 == mX.load(&empty, "B"));
+                ASSERTV(LINE, bdlt::PackedCalendar() == empty);
+            }
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP
+        //
+        // Concerns:
+        //: 1 A calendar loaded from a file is equal to the calendar that was
+        //:   written, including its valid range, weekend-days transitions,
+        //:   holidays, and holiday codes.
+        //:
+        //: 2 Empty calendars, calendars without a valid range, and calendars
+        //:   at the limits of 'bdlt::Date' are supported.
+        //:
+        //: 3 Loading a name that is not in the file, or loading from an
+        //:   uninitialized loader, returns 1 and does not modify the result.
+        //:
+        //: 4 'load' replaces any previous value of the result.
+        //:
+        //: 5 Re-initializing a loader maps the new file.
+        //
+        // Plan:
+        //: 1 Write a set of calendars covering each concern, map the file,
+        //:   and compare each loaded calendar with the original.  (C-1..4)
+        //:
+        //: 2 Write a second file and re-initialize the loader.  (C-5)
+        //
+        // Testing:
+        //   int write(bsl::ostream& stream, const bsl::map<...>& calendars);
+        //   MmapCalendarLoader();
+        //   ~MmapCalendarLoader();
+        //   int initialize(const char *path);
+        //   int load(bdlt::PackedCalendar *result, const char *calendarName);
+        //   bool isInitialized() const;
+        //   int numCalendars() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ROUND TRIP" << endl
+                                  << "==========" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        CalendarMap calendars;
+        populate(&calendars);
+
+        {
+            bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+            ASSERT(0 == Obj::write(output, calendars));
+        }
+
+        Obj mX;  const Obj& X = mX;
+
+        bdlt::PackedCalendar sentinel;
+        sentinel.setValidRange(bdlt::Date(2020, 1, 1),
+                               bdlt::Date(2020, 1, 31));
+        sentinel.addHolidayCode(bdlt::Date(2020, 1, 2), 3);
+
+        {
+            bdlt::PackedCalendar result(sentinel);
+            ASSERT(1 == mX.load(&result, "EMPTY"));
+            ASSERT(sentinel == result);
+        }
+
+        ASSERT(0 == mX.initialize(fileName.c_str()));
+        ASSERT(true == X.isInitialized());
+        ASSERT(static_cast<int>(calendars.size()) == X.numCalendars());
+
+        for (CalendarMap::const_iterator it = calendars.begin();
+             it != calendars.end();
+             ++it) {
+            if (veryVerbose) { T_ P(it->first) }
+
+            bdlt::PackedCalendar result(sentinel);
+            ASSERTV(it->first, 0 == mX.load(&result, it->first.c_str()));
+            ASSERTV(it->first, it->second == result);
+        }
+
+        static const char *const MISSING[] = {
+            "", "A", "CAL", "CAL00", "CAL999", "EMPTY ", "ZZZ", "US"
+        };
+        for (bsl::size_t i = 0; i < sizeof MISSING / sizeof *MISSING; ++i) {
+            bdlt::PackedCalendar result(sentinel);
+            ASSERTV(MISSING[i], 1 == mX.load(&result, MISSING[i]));
+            ASSERTV(MISSING[i], sentinel == result);
+        }
+
+        if (verbose) cout << "\tTesting re-initialization." << endl;
+        {
+            CalendarMap other;
+            other["US"] = sentinel;
+
+            const bsl::string otherFile = fileName + ".2";
+            {
+                bsl::ofstream output(otherFile.c_str(), bsl::ios::binary);
+                ASSERT(0 == Obj::write(output, other));
+            }
+
+            ASSERT(0 == mX.initialize(otherFile.c_str()));
+            ASSERT(1 == X.numCalendars());
+
+            bdlt::PackedCalendar result;
+            ASSERT(0 == mX.load(&result, "US"));
+            ASSERT(sentinel == result);
+            ASSERT(1 == mX.load(&result, "FULL"));
+
+            bdls::FilesystemUtil::remove(otherFile);
+        }
+
+        if (verbose) cout << "\tTesting an empty file." << endl;
+        {
+            bsl::ostringstream oss;
+            ASSERT(0 == Obj::write(oss, CalendarMap()));
+            writeFile(fileName, oss.str());
+
+            Obj mY;  const Obj& Y = mY;
+            ASSERT(0 == mY.initialize(fileName.c_str()));
+            ASSERT(0 == Y.numCalendars());
+
+            bdlt::PackedCalendar result;
+            ASSERT(1 == mY.load(&result, "US"));
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write, map, and load a single calendar.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        CalendarMap calendars;
+        bdlt::PackedCalendar& calendar = calendars["NYSE"];
+        calendar.setValidRange(bdlt::Date(2026, 1, 1),
+                               bdlt::Date(2026, 12, 31));
+        calendar.addWeekendDay(DAY(SAT));
+        calendar.addWeekendDay(DAY(SUN));
+        calendar.addHoliday(bdlt::Date(2026, 1, 1));
+
+        {
+            bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+            ASSERT(0 == Obj::write(output, calendars));
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(false == X.isInitialized());
+        ASSERT(0     == X.numCalendars());
+
+        ASSERT(0     == mX.initialize(fileName.c_str()));
+        ASSERT(true  == X.isInitialized());
+        ASSERT(1     == X.numCalendars());
+
+        bdlt::PackedCalendar result;
+        ASSERT(0 == mX.load(&result, "NYSE"));
+        ASSERT(calendar == result);
+        ASSERT(1 == mX.load(&result, "LSE"));
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -21,6 +21,74 @@ BSLS_IDENT_RCSID(bbldc_basicdaycountutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
+namespace {
+
+                      // ==============================
+                      // struct BasicDayCountUtil_Batch
+                      // ==============================
+
+template <class CONVENTION>
+struct BasicDayCountUtil_Batch {
+    // This 'struct' provides a namespace for loops applying the day-count
+    // convention implemented by the template parameter 'CONVENTION' to arrays
+    // of date pairs.
+
+    // CLASS METHODS
+    static void daysDiff(int              *result,
+                         const bdlt::Date *beginDates,
+                         const bdlt::Date *endDates,
+                         int               numDates)
+        // Load, into the specified 'result', the day count of each of the
+        // specified 'numDates' pairs of elements of the specified 'beginDates'
+        // and 'endDates'.
+    {
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = CONVENTION::daysDiff(beginDates[i], endDates[i]);
+        }
+    }
+
+    static void yearsDiff(double           *result,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          int               numDates)
+        // Load, into the specified 'result', the year fraction of each of the
+        // specified 'numDates' pairs of elements of the specified 'beginDates'
+        // and 'endDates'.
+    {
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = CONVENTION::yearsDiff(beginDates[i], endDates[i]);
+        }
+    }
+};
+
+template <int DAYS_PER_YEAR>
+struct BasicDayCountUtil_ActualBatch {
+    // This 'struct' provides a namespace for loops applying an "Actual/N"
+    // day-count convention, having 'N == DAYS_PER_YEAR', to arrays of date
+    // pairs.  The loops use only the serial-date difference of each pair, and
+    // so can be vectorized.  Note that storing each quotient to the 'double'
+    // result array discards any extra precision, so that the results match
+    // those of (e.g.) 'BasicActual360::yearsDiff'.
+
+    // CLASS METHODS
+    static void yearsDiff(double           *result,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          int               numDates)
+        // Load, into the specified 'result', the year fraction of each of the
+        // specified 'numDates' pairs of elements of the specified 'beginDates'
+        // and 'endDates'.
+    {
+        const double daysPerYear = DAYS_PER_YEAR;
+
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = (endDates[i] - beginDates[i]) / daysPerYear;
+        }
+    }
+};
+
+}  // close unnamed namespace
+
                          // ------------------------
                          // struct BasicDayCountUtil
                          // ------------------------
@@ -69,6 +137,81 @@ int BasicDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void BasicDayCountUtil::daysDiff(int                      *result,
+                                 const bdlt::Date         *beginDates,
+                                 const bdlt::Date         *endDates,
+                                 int                       numDates,
+                                 DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        BasicDayCountUtil_Batch<BasicActual360>::daysDiff(result,
+                                                          beginDates,
+                                                          endDates,
+                                                          numDates);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        BasicDayCountUtil_Batch<BasicActual365Fixed>::daysDiff(result,
+                                                               beginDates,
+                                                               endDates,
+                                                               numDates);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        BasicDayCountUtil_Batch<TerminatedIsda30360Eom>::daysDiff(result,
+                                                                  beginDates,
+                                                                  endDates,
+                                                                  numDates);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        BasicDayCountUtil_Batch<BasicIsdaActualActual>::daysDiff(result,
+                                                                 beginDates,
+                                                                 endDates,
+                                                                 numDates);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        BasicDayCountUtil_Batch<BasicIsma30360>::daysDiff(result,
+                                                          beginDates,
+                                                          endDates,
+                                                          numDates);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        BasicDayCountUtil_Batch<BasicNl365>::daysDiff(result,
+                                                      beginDates,
+                                                      endDates,
+                                                      numDates);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        BasicDayCountUtil_Batch<BasicPsa30360Eom>::daysDiff(result,
+                                                            beginDates,
+                                                            endDates,
+                                                            numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        BasicDayCountUtil_Batch<BasicSia30360Eom>::daysDiff(result,
+                                                            beginDates,
+                                                            endDates,
+                                                            numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        BasicDayCountUtil_Batch<BasicSia30360Neom>::daysDiff(result,
+                                                             beginDates,
+                                                             endDates,
+                                                             numDates);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = 0;
+        }
+      } break;
+    }
+}
+
 bool BasicDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -136,6 +279,81 @@ double BasicDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void BasicDayCountUtil::yearsDiff(double                   *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numDates,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        BasicDayCountUtil_ActualBatch<360>::yearsDiff(result,
+                                                      beginDates,
+                                                      endDates,
+                                                      numDates);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        BasicDayCountUtil_ActualBatch<365>::yearsDiff(result,
+                                                      beginDates,
+                                                      endDates,
+                                                      numDates);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        BasicDayCountUtil_Batch<TerminatedIsda30360Eom>::yearsDiff(result,
+                                                                   beginDates,
+                                                                   endDates,
+                                                                   numDates);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        BasicDayCountUtil_Batch<BasicIsdaActualActual>::yearsDiff(result,
+                                                                  beginDates,
+                                                                  endDates,
+                                                                  numDates);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        BasicDayCountUtil_Batch<BasicIsma30360>::yearsDiff(result,
+                                                           beginDates,
+                                                           endDates,
+                                                           numDates);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        BasicDayCountUtil_Batch<BasicNl365>::yearsDiff(result,
+                                                       beginDates,
+                                                       endDates,
+                                                       numDates);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        BasicDayCountUtil_Batch<BasicPsa30360Eom>::yearsDiff(result,
+                                                             beginDates,
+                                                             endDates,
+                                                             numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        BasicDayCountUtil_Batch<BasicSia30360Eom>::yearsDiff(result,
+                                                             beginDates,
+                                                             endDates,
+                                                             numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        BasicDayCountUtil_Batch<BasicSia30360Neom>::yearsDiff(result,
+                                                              beginDates,
+                                                              endDates,
+                                                              numDates);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = 0.0;
+        }
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
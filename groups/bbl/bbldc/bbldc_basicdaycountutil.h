@@ -20,6 +20,18 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts (respectively, year fractions) of many date pairs
+// under a single convention.  The convention is dispatched once per call, and
+// each convention is applied by a loop specialized for that convention at
+// compile time.  For the actual-day conventions (Actual/360 and
+// Actual/365 Fixed) the loop operates directly on the serial representation of
+// 'bdlt::Date', without decomposing dates into year, month, and day, and is
+// amenable to vectorization by the compiler.  The results are identical to
+// those of the corresponding single-pair methods.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -80,6 +92,21 @@ struct BasicDayCountUtil {
         // 'beginDate <= endDate' then the result is non-negative.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' (i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numDates - 1]').  The behavior is undefined
+        // unless 'isSupported(convention)', '0 <= numDates', and each of
+        // 'result', 'beginDates', and 'endDates' refers to an array having at
+        // least 'numDates' elements.  See {Batch Computation}.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -95,6 +122,21 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numDates,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates' and
+        // 'endDates' arrays according to the specified day-count 'convention'
+        // (i.e., 'result[i] = yearsDiff(beginDates[i], endDates[i],
+        // convention)' for each 'i' in '[0 .. numDates - 1]').  The behavior
+        // is undefined unless 'isSupported(convention)', '0 <= numDates', and
+        // each of 'result', 'beginDates', and 'endDates' refers to an array
+        // having at least 'numDates' elements.  See {Batch Computation}.
 };
 
 }  // close package namespace
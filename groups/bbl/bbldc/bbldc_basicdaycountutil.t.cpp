@@ -11,6 +11,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +27,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numDates, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void yearsDiff(result, beginDates, endDates, numDates, convention);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -119,7 +122,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +177,151 @@ int main(int argc, char *argv[])
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array-based methods produce, for each date pair, the
+        //   value produced by the corresponding single-pair method.
+        //
+        // Concerns:
+        //: 1 For every supported convention, each element of the result of
+        //:   the batch 'daysDiff' and 'yearsDiff' is identical to the result
+        //:   of the single-pair method applied to the corresponding dates.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified,
+        //:   and 'numDates == 0' is supported.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Generate a set of date pairs, in both orders, including month
+        //:   ends and leap days.  For each supported convention, apply the
+        //:   batch methods to the set and compare each result exactly with
+        //:   that of the single-pair method.  (C-1)
+        //:
+        //: 2 Verify a sentinel following the last result is unmodified, and
+        //:   invoke the methods with 'numDates == 0'.  (C-2)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numDates, conv);
+        //   void yearsDiff(result, beginDates, endDates, numDates, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                          << "========================================"
+                          << endl;
+
+        static const Enum CONVENTIONS[] = { ACTUAL_360,
+                                            ACTUAL_365_FIXED,
+                                            ISDA_30_360_EOM,
+                                            ISDA_ACTUAL_ACTUAL,
+                                            ISMA_30_360,
+                                            NL_365,
+                                            PSA_30_360_EOM,
+                                            SIA_30_360_EOM,
+                                            SIA_30_360_NEOM };
+        const int NUM_CONVENTIONS = static_cast<int>(
+                                 sizeof CONVENTIONS / sizeof *CONVENTIONS);
+
+        bsl::vector<bdlt::Date> dates;
+        for (int year = 1999; year <= 2005; ++year) {
+            for (int month = 1; month <= 12; ++month) {
+                dates.push_back(bdlt::Date(year, month, 1));
+                dates.push_back(bdlt::Date(year, month, 15));
+                dates.push_back(bdlt::Date(year, month, 28));
+                if (bdlt::Date::isValidYearMonthDay(year, month, 29)) {
+                    dates.push_back(bdlt::Date(year, month, 29));
+                }
+                if (bdlt::Date::isValidYearMonthDay(year, month, 31)) {
+                    dates.push_back(bdlt::Date(year, month, 31));
+                }
+            }
+        }
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        for (int i = 0; i < static_cast<int>(dates.size()); i += 3) {
+            for (int j = 0; j < static_cast<int>(dates.size()); j += 7) {
+                beginDates.push_back(dates[i]);
+                endDates.push_back(dates[j]);
+            }
+        }
+        const int NUM_DATES = static_cast<int>(beginDates.size());
+
+        if (veryVerbose) { T_ P(NUM_DATES) }
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONV) }
+
+            bsl::vector<int>    days(NUM_DATES + 1, -7);
+            bsl::vector<double> years(NUM_DATES + 1, -7.0);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_DATES,
+                           CONV);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            CONV);
+
+            for (int i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date& X = beginDates[i];
+                const bdlt::Date& Y = endDates[i];
+
+                LOOP3_ASSERT(CONV, X, Y,
+                             Util::daysDiff(X, Y, CONV) == days[i]);
+                LOOP3_ASSERT(CONV, X, Y,
+                             Util::yearsDiff(X, Y, CONV) == years[i]);
+            }
+
+            LOOP_ASSERT(CONV, -7   == days[NUM_DATES]);
+            LOOP_ASSERT(CONV, -7.0 == years[NUM_DATES]);
+
+            Util::daysDiff(days.data(), 0, 0, 0, CONV);
+            Util::yearsDiff(years.data(), 0, 0, 0, CONV);
+
+            LOOP_ASSERT(CONV, -7   == days[NUM_DATES]);
+            LOOP_ASSERT(CONV, -7.0 == years[NUM_DATES]);
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date D(2012, 1, 1);
+            int              days;
+            double           years;
+
+            ASSERT_PASS(Util::daysDiff(&days, &D, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, &D, &D, -1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(0, &D, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, 0, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, &D, 0, 1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::daysDiff(&days,
+                                           &D,
+                                           &D,
+                                           1,
+                                           INVALID_CONVENTION));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &D, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, &D, -1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(0, &D, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years, 0, &D, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, 0, 1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::yearsDiff(&years,
+                                            &D,
+                                            &D,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
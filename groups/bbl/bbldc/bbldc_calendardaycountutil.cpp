@@ -44,6 +44,38 @@ int CalendarDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void CalendarDayCountUtil::daysDiff(int                      *result,
+                                    const bdlt::Date         *beginDates,
+                                    const bdlt::Date         *endDates,
+                                    int                       numDates,
+                                    const bdlt::Calendar&     calendar,
+                                    DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numDates; ++i) {
+            BSLS_ASSERT(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::daysDiff(beginDates[i],
+                                                        endDates[i],
+                                                        calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = 0;
+        }
+      } break;
+    }
+}
+
 bool CalendarDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -84,6 +116,38 @@ double CalendarDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void CalendarDayCountUtil::yearsDiff(double                   *result,
+                                     const bdlt::Date         *beginDates,
+                                     const bdlt::Date         *endDates,
+                                     int                       numDates,
+                                     const bdlt::Calendar&     calendar,
+                                     DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+    BSLS_ASSERT(result     || 0 == numDates);
+    BSLS_ASSERT(beginDates || 0 == numDates);
+    BSLS_ASSERT(endDates   || 0 == numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numDates; ++i) {
+            BSLS_ASSERT(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::yearsDiff(beginDates[i],
+                                                         endDates[i],
+                                                         calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = 0.0;
+        }
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
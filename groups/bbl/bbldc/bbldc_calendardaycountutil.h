@@ -20,6 +20,17 @@ BSLS_IDENT("$Id: $")
 // 'bbldc::CalendarDayCountUtil' take a trailing 'DayCountConvention::Enum'
 // argument indicating which particular day-count convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts (respectively, year fractions) of many date pairs
+// against a single calendar under a single convention, dispatching on the
+// convention once per call rather than once per pair.  The results are
+// identical to those of the corresponding single-pair methods.  Note that the
+// cost of each BUS-252 computation is dominated by counting business days in
+// the supplied calendar, which takes constant time if the calendar has a
+// business-day index (see 'bdlt::Calendar::createBusinessDayIndex').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -95,6 +106,25 @@ struct CalendarDayCountUtil {
         // Note that reversing the order of 'beginDate' and 'endDate' negates
         // the result and that the result is 0 when 'beginDate == endDate'.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         const bdlt::Calendar&     calendar,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with the
+        // specified 'calendar' providing the definition of business days
+        // (i.e., 'result[i] = daysDiff(beginDates[i], endDates[i], calendar,
+        // convention)' for each 'i' in '[0 .. numDates - 1]').  The behavior
+        // is undefined unless 'isSupported(convention)', '0 <= numDates', each
+        // of 'result', 'beginDates', and 'endDates' refers to an array having
+        // at least 'numDates' elements, and each of the first 'numDates'
+        // elements of 'beginDates' and 'endDates' is in the valid range of
+        // 'calendar'.  See {Batch Computation}.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -114,6 +144,25 @@ struct CalendarDayCountUtil {
         // '|yearsDiff(b, e, cal, c) + yearsDiff(e, b, cal, c)| <= 1.0e-15' for
         // all calendars 'cal', valid dates 'b' and 'e', and day-count
         // conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numDates,
+                          const bdlt::Calendar&     calendar,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates' and
+        // 'endDates' arrays according to the specified day-count 'convention'
+        // with the specified 'calendar' providing the definition of business
+        // days (i.e., 'result[i] = yearsDiff(beginDates[i], endDates[i],
+        // calendar, convention)' for each 'i' in '[0 .. numDates - 1]').  The
+        // behavior is undefined unless 'isSupported(convention)',
+        // '0 <= numDates', each of 'result', 'beginDates', and 'endDates'
+        // refers to an array having at least 'numDates' elements, and each of
+        // the first 'numDates' elements of 'beginDates' and 'endDates' is in
+        // the valid range of 'calendar'.  See {Batch Computation}.
 };
 
 }  // close package namespace
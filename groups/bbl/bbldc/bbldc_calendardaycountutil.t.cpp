@@ -12,6 +12,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -27,10 +28,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, calendar, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numDates, cal, conv);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, calendar, convention);
+// [ 4] void yearsDiff(result, beginDates, endDates, numDates, cal, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -124,7 +127,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -189,6 +192,135 @@ int main(int argc, char *argv[])
     ASSERT(0.2063 < yearsDiff && 0.2064 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array-based methods produce, for each date pair, the
+        //   value produced by the corresponding single-pair method.
+        //
+        // Concerns:
+        //: 1 Each element of the result of the batch 'daysDiff' and
+        //:   'yearsDiff' is identical to the result of the single-pair method
+        //:   applied to the corresponding dates, whether or not the calendar
+        //:   has a business-day index.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a calendar spanning several years having weekend days and
+        //:   holidays, and a set of date pairs, in both orders, within its
+        //:   valid range.  Apply the batch methods to the set, with and
+        //:   without a business-day index, and compare each result exactly
+        //:   with that of the single-pair method.  (C-1)
+        //:
+        //: 2 Verify a sentinel following the last result is unmodified.
+        //:   (C-2)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numDates, cal, conv);
+        //   void yearsDiff(result, beginDates, endDates, numDates, cal, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                          << "========================================"
+                          << endl;
+
+        const bdlt::Date FIRST(2010,  1,  1);
+        const bdlt::Date LAST (2019, 12, 31);
+
+        bdlt::Calendar mX(FIRST, LAST);  const bdlt::Calendar& X = mX;
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        for (int year = 2010; year <= 2019; ++year) {
+            mX.addHoliday(bdlt::Date(year,  1,  1));
+            mX.addHoliday(bdlt::Date(year,  7,  4));
+            mX.addHoliday(bdlt::Date(year, 12, 25));
+        }
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        for (bdlt::Date begin = FIRST; begin <= LAST; begin += 37) {
+            for (bdlt::Date end = FIRST; end <= LAST; end += 53) {
+                beginDates.push_back(begin);
+                endDates.push_back(end);
+            }
+        }
+        const int NUM_DATES = static_cast<int>(beginDates.size());
+
+        if (veryVerbose) { T_ P(NUM_DATES) }
+
+        for (int indexed = 0; indexed < 2; ++indexed) {
+            if (indexed) {
+                mX.createBusinessDayIndex();
+            }
+
+            if (veryVerbose) { T_ P(X.hasBusinessDayIndex()) }
+
+            bsl::vector<int>    days(NUM_DATES + 1, -7);
+            bsl::vector<double> years(NUM_DATES + 1, -7.0);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_DATES,
+                           X,
+                           CALENDAR_BUS_252);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_DATES,
+                            X,
+                            CALENDAR_BUS_252);
+
+            for (int i = 0; i < NUM_DATES; ++i) {
+                const bdlt::Date& B = beginDates[i];
+                const bdlt::Date& E = endDates[i];
+
+                LOOP3_ASSERT(indexed, B, E,
+                       Util::daysDiff(B, E, X, CALENDAR_BUS_252) == days[i]);
+                LOOP3_ASSERT(indexed, B, E,
+                       Util::yearsDiff(B, E, X, CALENDAR_BUS_252) == years[i]);
+            }
+
+            LOOP_ASSERT(indexed, -7   == days[NUM_DATES]);
+            LOOP_ASSERT(indexed, -7.0 == years[NUM_DATES]);
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date D(2015, 6, 1);
+            const bdlt::Date O(2015, 7, 1);  // out of range of 'CB'
+            const Enum       INVALID = static_cast<Enum>(2);
+            int              days;
+            double           years;
+
+            ASSERT_PASS(Util::daysDiff(&days, &D, &D, 1, CB,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(&days, &D, &D, -1, CB,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(&days, &O, &D, 1, CB,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(&days, &D, &O, 1, CB,
+                                       CALENDAR_BUS_252));
+            ASSERT_OPT_FAIL(Util::daysDiff(&days, &D, &D, 1, CB, INVALID));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &D, &D, 1, CB,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, &D, -1, CB,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(&years, &O, &D, 1, CB,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, &O, 1, CB,
+                                        CALENDAR_BUS_252));
+            ASSERT_OPT_FAIL(Util::yearsDiff(&years, &D, &D, 1, CB, INVALID));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -20,6 +20,15 @@ BSLS_IDENT("$Id: $")
 // take a trailing 'DayCountConvention::Enum' argument indicating which
 // particular period-based day-count convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts (respectively, year fractions) of many date pairs
+// under a single convention (and, for 'yearsDiff', a single period schedule),
+// dispatching on the convention and validating the schedule once per call
+// rather than once per pair.  The results are identical to those of the
+// corresponding single-pair methods.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -91,6 +100,21 @@ struct PeriodDayCountUtil {
         // behavior is undefined unless 'isSupported(convention)'.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' (i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numDates - 1]').  The behavior is undefined
+        // unless 'isSupported(convention)', '0 <= numDates', and each of
+        // 'result', 'beginDates', and 'endDates' refers to an array having at
+        // least 'numDates' elements.  See {Batch Computation}.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -115,6 +139,30 @@ struct PeriodDayCountUtil {
         // '|yearsDiff(b,e,pd,pyd,c) + yearsDiff(e,b,pd,pyd,c)| <= 1.0e-15' for
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
+
+    static void yearsDiff(double                         *result,
+                          const bdlt::Date               *beginDates,
+                          const bdlt::Date               *endDates,
+                          int                             numDates,
+                          const bsl::vector<bdlt::Date>&  periodDate,
+                          double                          periodYearDiff,
+                          DayCountConvention::Enum        convention);
+        // Load, into each of the first specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates' and
+        // 'endDates' arrays according to the specified day-count 'convention'
+        // with periods starting on the specified 'periodDate' values and each
+        // period having a duration of the specified 'periodYearDiff' years
+        // (i.e., 'result[i] = yearsDiff(beginDates[i], endDates[i],
+        // periodDate, periodYearDiff, convention)' for each 'i' in
+        // '[0 .. numDates - 1]').  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', each of 'result',
+        // 'beginDates', and 'endDates' refers to an array having at least
+        // 'numDates' elements, 'periodDate.size() >= 2', the values contained
+        // in 'periodDate' are unique and sorted from minimum to maximum, and
+        // each of the first 'numDates' elements of 'beginDates' and 'endDates'
+        // is in the range '[periodDate.front() .. periodDate.back()]'.  See
+        // {Batch Computation}.
 };
 
 }  // close package namespace
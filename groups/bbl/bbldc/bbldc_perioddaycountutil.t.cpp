@@ -11,6 +11,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +27,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numDates, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(begin, end, periodDate, periodYearDiff, conv);
+// [ 4] void yearsDiff(result, begins, ends, num, pD, pYD, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -110,7 +113,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +177,126 @@ int main(int argc, char *argv[])
     ASSERT(yearsDiff > 0.1983 && yearsDiff < 0.1985);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array-based methods produce, for each date pair, the
+        //   value produced by the corresponding single-pair method.
+        //
+        // Concerns:
+        //: 1 Each element of the result of the batch 'daysDiff' and
+        //:   'yearsDiff' is identical to the result of the single-pair method
+        //:   applied to the corresponding dates.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a quarterly schedule and a set of date pairs, in both
+        //:   orders, within it.  Apply the batch methods to the set and
+        //:   compare each result exactly with that of the single-pair method.
+        //:   (C-1)
+        //:
+        //: 2 Verify a sentinel following the last result is unmodified.
+        //:   (C-2)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numDates, convention);
+        //   void yearsDiff(result, begins, ends, num, pD, pYD, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                          << "========================================"
+                          << endl;
+
+        bsl::vector<bdlt::Date>        mSchedule;
+        const bsl::vector<bdlt::Date>& SCHEDULE = mSchedule;
+        for (int year = 2000; year <= 2010; ++year) {
+            for (int month = 1; month <= 12; month += 3) {
+                mSchedule.push_back(bdlt::Date(year, month, 1));
+            }
+        }
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        for (bdlt::Date begin = SCHEDULE.front();
+             begin <= SCHEDULE.back();
+             begin += 41) {
+            for (bdlt::Date end = SCHEDULE.front();
+                 end <= SCHEDULE.back();
+                 end += 67) {
+                beginDates.push_back(begin);
+                endDates.push_back(end);
+            }
+        }
+        const int NUM_DATES = static_cast<int>(beginDates.size());
+
+        if (veryVerbose) { T_ P(NUM_DATES) }
+
+        bsl::vector<int>    days(NUM_DATES + 1, -7);
+        bsl::vector<double> years(NUM_DATES + 1, -7.0);
+
+        Util::daysDiff(days.data(),
+                       beginDates.data(),
+                       endDates.data(),
+                       NUM_DATES,
+                       PERIOD_ICMA_ACTUAL_ACTUAL);
+        Util::yearsDiff(years.data(),
+                        beginDates.data(),
+                        endDates.data(),
+                        NUM_DATES,
+                        SCHEDULE,
+                        0.25,
+                        PERIOD_ICMA_ACTUAL_ACTUAL);
+
+        for (int i = 0; i < NUM_DATES; ++i) {
+            const bdlt::Date& B = beginDates[i];
+            const bdlt::Date& E = endDates[i];
+
+            LOOP2_ASSERT(B, E, Util::daysDiff(B, E, PERIOD_ICMA_ACTUAL_ACTUAL)
+                                                                   == days[i]);
+            LOOP2_ASSERT(B, E, Util::yearsDiff(B,
+                                               E,
+                                               SCHEDULE,
+                                               0.25,
+                                               PERIOD_ICMA_ACTUAL_ACTUAL)
+                                                                  == years[i]);
+        }
+
+        ASSERT(-7   == days[NUM_DATES]);
+        ASSERT(-7.0 == years[NUM_DATES]);
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date D(2005, 6, 1);
+            const bdlt::Date O(2011, 6, 1);  // after the schedule
+            const Enum       INVALID = static_cast<Enum>(2);
+            int              days;
+            double           years;
+
+            ASSERT_PASS(Util::daysDiff(&days, &D, &D, 1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(&days, &D, &D, -1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_OPT_FAIL(Util::daysDiff(&days, &D, &D, 1, INVALID));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &D, &D, 1, SCHEDULE, 0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, &D, -1, SCHEDULE, 0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(&years, &O, &D, 1, SCHEDULE, 0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(&years, &D, &O, 1, SCHEDULE, 0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_OPT_FAIL(Util::yearsDiff(&years, &D, &D, 1, SCHEDULE, 0.25,
+                                            INVALID));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -0,0 +1,271 @@
+// bdlbb_blobioutil.cpp                                               -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobioutil_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlbb::BlobIoUtil::FileDescriptor FileDescriptor;
+
+enum { k_MAX_NUM_BUFFERS = bdlbb::BlobIoUtil::k_MAX_NUM_BUFFERS };
+
+struct Segment {
+    // This 'struct' describes a contiguous range of bytes within one buffer
+    // of a blob.
+
+    char *d_data_p;  // address of the first byte
+    int   d_length;  // number of bytes
+};
+
+int loadSegments(Segment            *segments,
+                 const bdlbb::Blob&  blob,
+                 int                 offset,
+                 int                 length)
+    // Load into the specified 'segments' the ranges of the buffers of the
+    // specified 'blob' that hold the specified 'length' bytes starting at the
+    // specified 'offset', stopping after 'k_MAX_NUM_BUFFERS' ranges.  Return
+    // the number of ranges loaded.  The behavior is undefined unless
+    // '0 <= offset', '0 < length', 'offset + length <= blob.totalSize()', and
+    // 'segments' has room for 'k_MAX_NUM_BUFFERS' elements.
+{
+    BSLS_ASSERT(segments);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <  length);
+    BSLS_ASSERT(offset <= blob.totalSize() - length);
+
+    bsl::pair<int, int> place = bdlbb::BlobUtil::findBufferIndexAndOffset(
+                                                                       blob,
+                                                                       offset);
+    int index        = place.first;
+    int bufferOffset = place.second;
+    int numSegments  = 0;
+
+    while (0 < length && numSegments < k_MAX_NUM_BUFFERS) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(index);
+        const int                size   = bsl::min(
+                                                 buffer.size() - bufferOffset,
+                                                 length);
+        if (0 < size) {
+            segments[numSegments].d_data_p = buffer.data() + bufferOffset;
+            segments[numSegments].d_length = size;
+            ++numSegments;
+            length -= size;
+        }
+        bufferOffset = 0;
+        ++index;
+    }
+
+    return numSegments;
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+
+void loadIovecs(::iovec *iovecs, const Segment *segments, int numSegments)
+    // Load into the specified 'iovecs' a description of each of the specified
+    // 'numSegments' 'segments'.
+{
+    for (int i = 0; i < numSegments; ++i) {
+        iovecs[i].iov_base = segments[i].d_data_p;
+        iovecs[i].iov_len  = segments[i].d_length;
+    }
+}
+
+int readSegments(FileDescriptor  descriptor,
+                 const Segment  *segments,
+                 int             numSegments)
+    // Read from the specified 'descriptor' into the specified 'numSegments'
+    // 'segments' with a single system call.  Return the number of bytes read,
+    // or a negative value on error.
+{
+    ::iovec iovecs[k_MAX_NUM_BUFFERS];
+    loadIovecs(iovecs, segments, numSegments);
+
+    return static_cast<int>(::readv(descriptor, iovecs, numSegments));
+}
+
+int writeSegments(FileDescriptor  descriptor,
+                  const Segment  *segments,
+                  int             numSegments)
+    // Write to the specified 'descriptor' the specified 'numSegments'
+    // 'segments' with a single system call.  Return the number of bytes
+    // written, or a negative value on error.
+{
+    ::iovec iovecs[k_MAX_NUM_BUFFERS];
+    loadIovecs(iovecs, segments, numSegments);
+
+    return static_cast<int>(::writev(descriptor, iovecs, numSegments));
+}
+
+#else
+
+int readSegments(FileDescriptor  descriptor,
+                 const Segment  *segments,
+                 int             numSegments)
+    // Read from the specified 'descriptor' into the specified 'numSegments'
+    // 'segments', one segment at a time, stopping after the first short read.
+    // Return the number of bytes read, or a negative value if an error occurs
+    // before any bytes are read.
+{
+    int numBytes = 0;
+    for (int i = 0; i < numSegments; ++i) {
+        const int rc = bdls::FilesystemUtil::read(descriptor,
+                                                  segments[i].d_data_p,
+                                                  segments[i].d_length);
+        if (rc < 0) {
+            return 0 < numBytes ? numBytes : rc;                      // RETURN
+        }
+        numBytes += rc;
+        if (rc < segments[i].d_length) {
+            break;
+        }
+    }
+    return numBytes;
+}
+
+int writeSegments(FileDescriptor  descriptor,
+                  const Segment  *segments,
+                  int             numSegments)
+    // Write to the specified 'descriptor' the specified 'numSegments'
+    // 'segments', one segment at a time, stopping after the first short
+    // write.  Return the number of bytes written, or a negative value if an
+    // error occurs before any bytes are written.
+{
+    int numBytes = 0;
+    for (int i = 0; i < numSegments; ++i) {
+        const int rc = bdls::FilesystemUtil::write(descriptor,
+                                                   segments[i].d_data_p,
+                                                   segments[i].d_length);
+        if (rc < 0) {
+            return 0 < numBytes ? numBytes : rc;                      // RETURN
+        }
+        numBytes += rc;
+        if (rc < segments[i].d_length) {
+            break;
+        }
+    }
+    return numBytes;
+}
+
+#endif
+
+int readIntoCapacity(bdlbb::Blob *blob, FileDescriptor descriptor, int length)
+    // Read at most the specified 'length' bytes from the specified
+    // 'descriptor' into the capacity of the specified 'blob' beyond its
+    // length, and increase the length of 'blob' by the number of bytes read.
+    // Return the number of bytes read, or a negative value on error.  The
+    // behavior is undefined unless
+    // '0 <= length <= blob->totalSize() - blob->length()'.
+{
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const int oldLength = blob->length();
+
+    Segment   segments[k_MAX_NUM_BUFFERS];
+    const int numSegments = loadSegments(segments, *blob, oldLength, length);
+    const int rc          = readSegments(descriptor, segments, numSegments);
+
+    if (0 < rc) {
+        blob->setLength(oldLength + rc);
+    }
+    return rc;
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+int BlobIoUtil::read(Blob *blob, FileDescriptor descriptor)
+{
+    BSLS_ASSERT(blob);
+
+    return readIntoCapacity(blob,
+                            descriptor,
+                            blob->totalSize() - blob->length());
+}
+
+int BlobIoUtil::read(Blob *blob, FileDescriptor descriptor, int numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    const int length = blob->length();
+
+    if (blob->totalSize() - length < numBytes) {
+        // Grow the capacity of 'blob'; buffers beyond the restored length are
+        // retained as capacity.
+
+        blob->setLength(length + numBytes);
+        blob->setLength(length);
+    }
+
+    return readIntoCapacity(blob, descriptor, numBytes);
+}
+
+int BlobIoUtil::write(FileDescriptor descriptor, const Blob& blob, int offset)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(offset <= blob.length());
+
+    return write(descriptor, blob, offset, blob.length() - offset);
+}
+
+int BlobIoUtil::write(FileDescriptor descriptor,
+                      const Blob&    blob,
+                      int            offset,
+                      int            length)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= blob.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    Segment   segments[k_MAX_NUM_BUFFERS];
+    const int numSegments = loadSegments(segments, blob, offset, length);
+
+    return writeSegments(descriptor, segments, numSegments);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
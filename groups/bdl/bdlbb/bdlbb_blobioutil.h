@@ -0,0 +1,183 @@
+// bdlbb_blobioutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBIOUTIL
+#define INCLUDED_BDLBB_BLOBIOUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectored I/O between 'bdlbb::Blob' objects and descriptors.
+//
+//@CLASSES:
+//  bdlbb::BlobIoUtil: namespace for scatter/gather I/O on 'bdlbb::Blob'
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlbb::BlobIoUtil', that
+// is a namespace for functions that transfer data directly between the
+// buffers of a 'bdlbb::Blob' and a file or socket descriptor, without first
+// copying the data into (or out of) a contiguous temporary buffer.
+//
+// On POSIX platforms each function describes the relevant blob buffers with
+// an array of 'iovec' structures and performs a single 'readv' or 'writev'
+// system call.  At most 'k_MAX_NUM_BUFFERS' buffers are described by a single
+// call; a transfer spanning more buffers is reported as a partial transfer.
+// On Windows, which does not provide vectored I/O on arbitrary handles, each
+// buffer is transferred by a separate 'bdls::FilesystemUtil' call, stopping at
+// the first short transfer.  Note that, on POSIX platforms, a socket is
+// identified by a 'bdls::FilesystemUtil::FileDescriptor', so the same
+// functions serve files, pipes, and sockets.
+//
+///Partial Transfers
+///-----------------
+// Like the underlying system calls, 'write' may transfer fewer bytes than
+// requested (e.g., to a non-blocking socket whose send buffer is full), and
+// 'read' may transfer fewer bytes than there is room for.  Each function
+// returns the number of bytes transferred, so a caller tracks its progress by
+// advancing an offset into the blob, and need not retain any other state
+// between calls.  See {Example 1}.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Flushing a Blob to a Descriptor
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an outgoing message has been assembled in a blob, and that it
+// must be written to a descriptor that may accept only part of the message at
+// a time.
+//
+// First, we create a blob holding a message that spans several buffers:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(16);
+//  bdlbb::Blob                    message(&factory);
+//
+//  const char TEXT[] = "A message that spans several blob buffers.";
+//  bdlbb::BlobUtil::append(&message, TEXT, sizeof TEXT - 1);
+//  assert(1 < message.numDataBuffers());
+//..
+// Then, we write the message, advancing the offset of the first byte that has
+// not yet been written after each call.  A real application would wait for
+// the descriptor to become writable before retrying:
+//..
+//  int offset = 0;
+//  while (offset < message.length()) {
+//      int rc = bdlbb::BlobIoUtil::write(descriptor, message, offset);
+//      if (rc < 0) {
+//          break;  // error
+//      }
+//      offset += rc;
+//  }
+//  assert(message.length() == offset);
+//..
+// Next, we read the data back into another blob.  The first call fills the
+// capacity of the blob, allocating buffers from the factory as needed:
+//..
+//  bdls::FilesystemUtil::seek(descriptor,
+//                             0,
+//                             bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING);
+//
+//  bdlbb::Blob received(&factory);
+//  int rc = bdlbb::BlobIoUtil::read(&received, descriptor, 64);
+//  assert(sizeof TEXT - 1 == rc);
+//  assert(sizeof TEXT - 1 == received.length());
+//  assert(0 == bdlbb::BlobUtil::compare(message, received));
+//..
+// Finally, we observe that the remaining capacity of 'received' can be filled
+// without further allocation, and that reading at the end of the file
+// transfers no data:
+//..
+//  assert(received.length() < received.totalSize());
+//  rc = bdlbb::BlobIoUtil::read(&received, descriptor);
+//  assert(0 == rc);
+//  assert(sizeof TEXT - 1 == received.length());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+class Blob;
+
+                              // =================
+                              // struct BlobIoUtil
+                              // =================
+
+struct BlobIoUtil {
+    // This 'struct' provides a namespace for utility functions that perform
+    // scatter/gather I/O between 'Blob' objects and file or socket
+    // descriptors.
+
+    // TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor / file handle type.
+
+    enum {
+        k_MAX_NUM_BUFFERS = 64  // maximum number of blob buffers transferred
+                                // by a single call
+    };
+
+    // CLASS METHODS
+    static int read(Blob *blob, FileDescriptor descriptor);
+        // Read from the specified 'descriptor' into the capacity of the
+        // specified 'blob' beyond its length (i.e., the range
+        // '[blob->length(), blob->totalSize())'), and increase the length of
+        // 'blob' by the number of bytes read.  Return the number of bytes
+        // read, 0 if no capacity is available or the end of the input has
+        // been reached, and a negative value (with no effect on the length of
+        // 'blob') on error.
+
+    static int read(Blob *blob, FileDescriptor descriptor, int numBytes);
+        // Read at most the specified 'numBytes' bytes from the specified
+        // 'descriptor' and append them to the specified 'blob', first
+        // allocating buffers from the factory of 'blob' if its capacity
+        // beyond its length is less than 'numBytes'.  Return the number of
+        // bytes read, 0 if the end of the input has been reached, and a
+        // negative value (with no effect on the length of 'blob') on error.
+        // Note that buffers allocated by this function are retained as
+        // capacity even if fewer than 'numBytes' bytes are read.  The
+        // behavior is undefined unless '0 <= numBytes', and 'blob' has a
+        // buffer factory or sufficient capacity.
+
+    static int write(FileDescriptor descriptor, const Blob& blob, int offset);
+        // Write to the specified 'descriptor' the data of the specified
+        // 'blob' starting at the specified 'offset'.  Return the number of
+        // bytes written, which may be less than 'blob.length() - offset', or
+        // a negative value on error.  The behavior is undefined unless
+        // '0 <= offset <= blob.length()'.
+
+    static int write(FileDescriptor descriptor,
+                     const Blob&    blob,
+                     int            offset,
+                     int            length);
+        // Write to the specified 'descriptor' the specified 'length' bytes of
+        // the data of the specified 'blob' starting at the specified
+        // 'offset'.  Return the number of bytes written, which may be less
+        // than 'length', or a negative value on error.  The behavior is
+        // undefined unless '0 <= offset', '0 <= length', and
+        // 'offset + length <= blob.length()'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
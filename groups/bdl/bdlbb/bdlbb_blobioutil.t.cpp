@@ -0,0 +1,817 @@
+// bdlbb_blobioutil.t.cpp                                             -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility that transfers data between the
+// buffers of a blob and a descriptor.  We verify, for blobs of various buffer
+// layouts, that every byte in the requested range (and no other) is
+// transferred, that the length of a blob is increased only by the number of
+// bytes actually read, that a transfer spanning more than
+// 'k_MAX_NUM_BUFFERS' buffers is reported as partial, and that a caller can
+// complete a partial write to a non-blocking descriptor by advancing an
+// offset.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int read(Blob *blob, FileDescriptor descriptor);
+// [ 3] int read(Blob *blob, FileDescriptor descriptor, int numBytes);
+// [ 2] int write(FileDescriptor descriptor, const Blob& blob, int offset);
+// [ 2] int write(FileDescriptor d, const Blob& b, int offset, int length);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] PARTIAL WRITES
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobIoUtil         Obj;
+typedef bdls::FilesystemUtil      FileUtil;
+typedef FileUtil::FileDescriptor  FileDescriptor;
+
+// ============================================================================
+//                          GLOBAL HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdlbb_blobioutil." << bdls::ProcessUtil::getProcessId() << "."
+        << test << ".tmp";
+    return oss.str();
+}
+
+static
+FileDescriptor openTempFile(const bsl::string& fileName)
+    // Create (or truncate) the file having the specified 'fileName', and
+    // return a descriptor open for reading and writing it.
+{
+    return FileUtil::open(fileName,
+                          FileUtil::e_OPEN_OR_CREATE,
+                          FileUtil::e_READ_WRITE,
+                          FileUtil::e_TRUNCATE);
+}
+
+static
+void rewind(FileDescriptor descriptor)
+    // Set the file pointer of the specified 'descriptor' to the start of the
+    // file.
+{
+    FileUtil::seek(descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+}
+
+static
+bsl::string readAll(FileDescriptor descriptor)
+    // Return the contents of the file having the specified 'descriptor',
+    // leaving the file pointer at the end of the file.
+{
+    rewind(descriptor);
+
+    bsl::string result;
+    char        buffer[256];
+    int         rc;
+    while (0 < (rc = FileUtil::read(descriptor, buffer, sizeof buffer))) {
+        result.append(buffer, rc);
+    }
+    return result;
+}
+
+static
+void makeBlob(bdlbb::Blob *blob, const char *spec, const bsl::string& data)
+    // Append to the specified 'blob' one buffer for each character in the
+    // specified 'spec', each having the size given by that (decimal digit)
+    // character, and set the length of 'blob' to the length of the specified
+    // 'data', copying 'data' into the blob.  The behavior is undefined unless
+    // 'data.length()' does not exceed the total size of the buffers.
+{
+    for (; *spec; ++spec) {
+        const int size = *spec - '0';
+
+        bsl::shared_ptr<char> buffer(new char[size + 1],
+                                     bsl::default_delete<char[]>());
+        blob->appendBuffer(bdlbb::BlobBuffer(buffer, size));
+    }
+
+    blob->setLength(static_cast<int>(data.length()));
+
+    int position = 0;
+    for (int i = 0; position < blob->length(); ++i) {
+        const bdlbb::BlobBuffer& buffer = blob->buffer(i);
+        for (int j = 0; j < buffer.size() && position < blob->length(); ++j) {
+            buffer.data()[j] = data[position++];
+        }
+    }
+}
+
+static
+bsl::string blobContents(const bdlbb::Blob& blob)
+    // Return the data of the specified 'blob'.
+{
+    bsl::string result(blob.length(), '\0');
+    if (0 < blob.length()) {
+        bdlbb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+    }
+    return result;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string    fileName   = tempFileName(test);
+        const FileDescriptor descriptor = openTempFile(fileName);
+        ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Flushing a Blob to a Descriptor
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an outgoing message has been assembled in a blob, and that it
+// must be written to a descriptor that may accept only part of the message at
+// a time.
+//
+// First, we create a blob holding a message that spans several buffers:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(16);
+    bdlbb::Blob                    message(&factory);
+
+    const char TEXT[] = "A message that spans several blob buffers.";
+    bdlbb::BlobUtil::append(&message, TEXT, sizeof TEXT - 1);
+    ASSERT(1 < message.numDataBuffers());
+//..
+// Then, we write the message, advancing the offset of the first byte that has
+// not yet been written after each call.  A real application would wait for
+// the descriptor to become writable before retrying:
+//..
+    int offset = 0;
+    while (offset < message.length()) {
+        int rc = bdlbb::BlobIoUtil::write(descriptor, message, offset);
+        if (rc < 0) {
+            break;  // error
+        }
+        offset += rc;
+    }
+    ASSERT(message.length() == offset);
+//..
+// Next, we read the data back into another blob.  The first call fills the
+// capacity of the blob, allocating buffers from the factory as needed:
+//..
+    bdls::FilesystemUtil::seek(descriptor,
+                               0,
+                               bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING);
+
+    bdlbb::Blob received(&factory);
+    int rc = bdlbb::BlobIoUtil::read(&received, descriptor, 64);
+    ASSERT(sizeof TEXT - 1 == rc);
+    ASSERT(sizeof TEXT - 1 == received.length());
+    ASSERT(0 == bdlbb::BlobUtil::compare(message, received));
+//..
+// Finally, we observe that the remaining capacity of 'received' can be filled
+// without further allocation, and that reading at the end of the file
+// transfers no data:
+//..
+    ASSERT(received.length() < received.totalSize());
+    rc = bdlbb::BlobIoUtil::read(&received, descriptor);
+    ASSERT(0 == rc);
+    ASSERT(sizeof TEXT - 1 == received.length());
+//..
+
+        FileUtil::close(descriptor);
+        FileUtil::remove(fileName);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PARTIAL WRITES
+        //
+        // Concerns:
+        //: 1 'write' to a non-blocking descriptor that cannot accept all of
+        //:   the data returns the number of bytes accepted.
+        //:
+        //: 2 Advancing the offset by the value returned by each call
+        //:   eventually writes every byte exactly once, in order.
+        //:
+        //: 3 A write that the descriptor cannot accept at all returns a
+        //:   negative value.
+        //
+        // Plan:
+        //: 1 On POSIX platforms, write a blob larger than the capacity of a
+        //:   non-blocking pipe, draining the pipe between calls, and compare
+        //:   the drained data with the blob.  (C-1..3)
+        //
+        // Testing:
+        //   PARTIAL WRITES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PARTIAL WRITES" << endl
+                                  << "==============" << endl;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+        int fds[2];
+        ASSERT(0 == ::pipe(fds));
+        ASSERT(0 == ::fcntl(fds[0], F_SETFL, O_NONBLOCK));
+        ASSERT(0 == ::fcntl(fds[1], F_SETFL, O_NONBLOCK));
+
+        bdlbb::SimpleBlobBufferFactory factory(1000);
+        bdlbb::Blob                    blob(&factory);
+
+        bsl::string expected;
+        for (int i = 0; i < 1024 * 1024; ++i) {
+            expected.push_back(static_cast<char>('a' + i % 23));
+        }
+        bdlbb::BlobUtil::append(&blob,
+                                expected.data(),
+                                static_cast<int>(expected.length()));
+
+        bsl::string actual;
+        int         offset         = 0;
+        int         numCalls       = 0;
+        int         numShortWrites = 0;
+        bool        sawFullPipe    = false;
+
+        while (offset < blob.length()) {
+            const int rc = Obj::write(fds[1], blob, offset);
+            ++numCalls;
+
+            if (rc < 0) {
+                ASSERTV(errno, EAGAIN == errno || EWOULDBLOCK == errno);
+                sawFullPipe = true;
+            }
+            else {
+                if (rc < blob.length() - offset) {
+                    ++numShortWrites;
+                }
+                offset += rc;
+            }
+
+            char buffer[4096];
+            int  n;
+            while (0 < (n = static_cast<int>(
+                                    ::read(fds[0], buffer, sizeof buffer)))) {
+                actual.append(buffer, n);
+            }
+        }
+
+        if (veryVerbose) { T_ P_(numCalls) P_(numShortWrites) P(sawFullPipe) }
+
+        ASSERT(blob.length() == offset);
+        ASSERT(0 < numShortWrites);
+        ASSERT(expected == actual);
+
+        ::close(fds[0]);
+        ::close(fds[1]);
+#else
+        if (verbose) cout << "\tSkipped: requires non-blocking pipes." << endl;
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // READ
+        //
+        // Concerns:
+        //: 1 'read(blob, descriptor)' reads into exactly the capacity of the
+        //:   blob beyond its length, including the unused part of the last
+        //:   data buffer, and allocates no buffers.
+        //:
+        //: 2 'read(blob, descriptor, numBytes)' reads at most 'numBytes'
+        //:   bytes, allocating buffers only if the existing capacity is
+        //:   insufficient.
+        //:
+        //: 3 The length of the blob is increased by exactly the number of
+        //:   bytes read, and existing data is unchanged.
+        //:
+        //: 4 At the end of the input, and when no capacity is available, 0 is
+        //:   returned.
+        //:
+        //: 5 On error a negative value is returned and the length of the blob
+        //:   is unchanged.
+        //:
+        //: 6 At most 'k_MAX_NUM_BUFFERS' buffers are filled by a single call.
+        //
+        // Plan:
+        //: 1 Using a table of buffer layouts, initial lengths, and read
+        //:   sizes, read from a file holding known data and verify the
+        //:   contents, length, and total size of the blob.  (C-1..4)
+        //:
+        //: 2 Read from an invalid descriptor.  (C-5)
+        //:
+        //: 3 Read into a blob having more than 'k_MAX_NUM_BUFFERS' one-byte
+        //:   capacity buffers.  (C-6)
+        //
+        // Testing:
+        //   int read(Blob *blob, FileDescriptor descriptor);
+        //   int read(Blob *blob, FileDescriptor descriptor, int numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "READ" << endl
+                                  << "====" << endl;
+
+        const bsl::string    fileName   = tempFileName(test);
+        const FileDescriptor descriptor = openTempFile(fileName);
+        ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+        const bsl::string FILE_DATA = "0123456789abcdefghijklmnopqrstuvwxyz";
+        const int         FILE_SIZE = static_cast<int>(FILE_DATA.length());
+        ASSERT(FILE_SIZE == FileUtil::write(descriptor,
+                                            FILE_DATA.data(),
+                                            FILE_SIZE));
+
+        const bsl::string INITIAL = "ABCDEFGHIJ";
+
+        if (verbose) cout << "\tTesting 'read(blob, descriptor)'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;     // buffer sizes
+                int         d_length;   // initial length of the blob
+            } DATA[] = {
+                //LINE  SPEC          LENGTH
+                //----  ------------  ------
+                { L_,   "",                0 },
+                { L_,   "5",               0 },
+                { L_,   "5",               3 },
+                { L_,   "5",               5 },
+                { L_,   "123",             0 },
+                { L_,   "123",             1 },
+                { L_,   "123",             2 },
+                { L_,   "123",             6 },
+                { L_,   "90909",           4 },
+                { L_,   "9999999",        10 },
+                { L_,   "99999999",        0 },  // more than the file
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE   = DATA[ti].d_line;
+                const char        *SPEC   = DATA[ti].d_spec;
+                const int          LENGTH = DATA[ti].d_length;
+                const bsl::string  PREFIX = INITIAL.substr(0, LENGTH);
+
+                if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(LENGTH) }
+
+                bdlbb::Blob blob;
+                makeBlob(&blob, SPEC, PREFIX);
+
+                const int TOTAL_SIZE = blob.totalSize();
+                const int CAPACITY   = TOTAL_SIZE - LENGTH;
+                const int EXP        = bsl::min(CAPACITY, FILE_SIZE);
+
+                rewind(descriptor);
+                const int rc = Obj::read(&blob, descriptor);
+
+                ASSERTV(LINE, rc, EXP == rc);
+                ASSERTV(LINE, LENGTH + EXP == blob.length());
+                ASSERTV(LINE, TOTAL_SIZE == blob.totalSize());
+                ASSERTV(LINE, PREFIX + FILE_DATA.substr(0, EXP) ==
+                                                          blobContents(blob));
+
+                // Reading again either fills no capacity or reads at the end
+                // of the file.
+
+                const int rc2 = Obj::read(&blob, descriptor);
+                ASSERTV(LINE, rc2, 0 == rc2);
+                ASSERTV(LINE, LENGTH + EXP == blob.length());
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'read(blob, descriptor, numBytes)'."
+                          << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_bufferSize;  // size of factory buffers
+                int d_length;      // initial length of the blob
+                int d_numBytes;    // bytes requested
+            } DATA[] = {
+                //LINE  BUFFER  LENGTH  NUM_BYTES
+                //----  ------  ------  ---------
+                { L_,        1,      0,         0 },
+                { L_,        1,      0,         1 },
+                { L_,        1,      3,        10 },
+                { L_,        4,      0,         4 },
+                { L_,        4,      2,         5 },
+                { L_,        4,      4,        36 },
+                { L_,        7,      3,        40 },  // more than the file
+                { L_,       64,      0,        20 },
+                { L_,       64,     10,        36 },
+                { L_,       64,     10,       100 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const int         BUFFER    = DATA[ti].d_bufferSize;
+                const int         LENGTH    = DATA[ti].d_length;
+                const int         NUM_BYTES = DATA[ti].d_numBytes;
+                const bsl::string PREFIX    = INITIAL.substr(0, LENGTH);
+                const int         EXP       = bsl::min(NUM_BYTES, FILE_SIZE);
+
+                if (veryVerbose) { T_ P_(LINE) P_(BUFFER) P_(LENGTH)
+                                      P(NUM_BYTES) }
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER);
+                bdlbb::Blob                    blob(&factory);
+                bdlbb::BlobUtil::append(&blob, PREFIX.data(), LENGTH);
+
+                const int OLD_TOTAL_SIZE = blob.totalSize();
+
+                rewind(descriptor);
+                const int rc = Obj::read(&blob, descriptor, NUM_BYTES);
+
+                ASSERTV(LINE, rc, EXP == rc);
+                ASSERTV(LINE, LENGTH + EXP == blob.length());
+                ASSERTV(LINE, PREFIX + FILE_DATA.substr(0, EXP) ==
+                                                          blobContents(blob));
+
+                // Buffers are allocated only if needed, and then only enough
+                // to hold 'NUM_BYTES'.
+
+                if (OLD_TOTAL_SIZE - LENGTH >= NUM_BYTES) {
+                    ASSERTV(LINE, OLD_TOTAL_SIZE == blob.totalSize());
+                }
+                else {
+                    ASSERTV(LINE, blob.totalSize() >= LENGTH + NUM_BYTES);
+                    ASSERTV(LINE,
+                            blob.totalSize() < LENGTH + NUM_BYTES + BUFFER);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting errors." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::BlobUtil::append(&blob, "abc", 3);
+
+            const bsl::string    otherName = fileName + ".wo";
+            const FileDescriptor writeOnly = FileUtil::open(
+                                                   otherName,
+                                                   FileUtil::e_OPEN_OR_CREATE,
+                                                   FileUtil::e_WRITE_ONLY);
+            ASSERT(FileUtil::k_INVALID_FD != writeOnly);
+
+            ASSERT(0 > Obj::read(&blob, writeOnly));
+            ASSERT(3 == blob.length());
+            ASSERT(0 > Obj::read(&blob, writeOnly, 20));
+            ASSERT(3 == blob.length());
+            ASSERT("abc" == blobContents(blob));
+
+            FileUtil::close(writeOnly);
+            FileUtil::remove(otherName);
+        }
+
+        if (verbose) cout << "\tTesting many buffers." << endl;
+        {
+            const int NUM_BUFFERS = Obj::k_MAX_NUM_BUFFERS + 10;
+
+            // Extend the file so that it holds more than 'NUM_BUFFERS' bytes.
+
+            const bsl::string LONG_DATA = FILE_DATA + FILE_DATA + FILE_DATA;
+            ASSERT(NUM_BUFFERS < static_cast<int>(LONG_DATA.length()));
+            ASSERT(2 * FILE_SIZE == FileUtil::write(descriptor,
+                                                    LONG_DATA.data(),
+                                                    2 * FILE_SIZE));
+
+            bsl::string spec(NUM_BUFFERS, '1');
+            bdlbb::Blob blob;
+            makeBlob(&blob, spec.c_str(), "");
+
+            rewind(descriptor);
+            const int rc = Obj::read(&blob, descriptor);
+
+            ASSERTV(rc, Obj::k_MAX_NUM_BUFFERS == rc);
+            ASSERT(LONG_DATA.substr(0, rc) == blobContents(blob));
+
+            const int rc2 = Obj::read(&blob, descriptor);
+            ASSERTV(rc2, NUM_BUFFERS - rc == rc2);
+            ASSERT(LONG_DATA.substr(0, NUM_BUFFERS) == blobContents(blob));
+        }
+
+        FileUtil::close(descriptor);
+        FileUtil::remove(fileName);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WRITE
+        //
+        // Concerns:
+        //: 1 'write' transfers exactly the bytes of the requested range, in
+        //:   order, regardless of how the range is split across buffers,
+        //:   including empty buffers and ranges starting or ending within a
+        //:   buffer.
+        //:
+        //: 2 Capacity beyond the length of the blob is not written.
+        //:
+        //: 3 Writing an empty range transfers nothing and returns 0.
+        //:
+        //: 4 At most 'k_MAX_NUM_BUFFERS' buffers are written by a single
+        //:   call.
+        //:
+        //: 5 Writing to a descriptor that is not open for writing returns a
+        //:   negative value.
+        //
+        // Plan:
+        //: 1 Using a table of buffer layouts, offsets, and lengths, write to
+        //:   an empty file and compare its contents with the expected range.
+        //:   (C-1..3)
+        //:
+        //: 2 Write a blob having more than 'k_MAX_NUM_BUFFERS' one-byte
+        //:   buffers.  (C-4)
+        //:
+        //: 3 Write to a read-only descriptor.  (C-5)
+        //
+        // Testing:
+        //   int write(FileDescriptor d, const Blob& b, int offset);
+        //   int write(FileDescriptor d, const Blob& b, int offset, int len);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "WRITE" << endl
+                                  << "=====" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+        const bsl::string DATA_STRING = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        static const struct {
+            int         d_line;
+            const char *d_spec;     // buffer sizes
+            int         d_length;   // length of the blob
+            int         d_offset;
+            int         d_numBytes; // -1 to write to the end of the blob
+        } DATA[] = {
+            //LINE  SPEC          LENGTH  OFFSET  NUM_BYTES
+            //----  ------------  ------  ------  ---------
+            { L_,   "",                0,      0,        -1 },
+            { L_,   "5",               0,      0,        -1 },
+            { L_,   "5",               5,      0,        -1 },
+            { L_,   "5",               5,      5,        -1 },
+            { L_,   "5",               5,      2,         2 },
+            { L_,   "5",               3,      0,        -1 },  // capacity
+            { L_,   "123",             6,      0,        -1 },
+            { L_,   "123",             6,      1,        -1 },
+            { L_,   "123",             6,      2,         3 },
+            { L_,   "123",             6,      3,         0 },
+            { L_,   "123",             4,      0,        -1 },
+            { L_,   "1023",            6,      0,        -1 },  // empty buffer
+            { L_,   "1023",            6,      1,         4 },
+            { L_,   "90909",          18,      4,        -1 },
+            { L_,   "9999",           36,     17,        19 },
+            { L_,   "9999",           30,      9,        -1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE      = DATA[ti].d_line;
+            const char *SPEC      = DATA[ti].d_spec;
+            const int   LENGTH    = DATA[ti].d_length;
+            const int   OFFSET    = DATA[ti].d_offset;
+            const int   NUM_BYTES = DATA[ti].d_numBytes;
+            const int   EXP       = 0 > NUM_BYTES ? LENGTH - OFFSET
+                                                  : NUM_BYTES;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SPEC) P_(OFFSET) P(NUM_BYTES) }
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, SPEC, DATA_STRING.substr(0, LENGTH));
+
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERTV(LINE, FileUtil::k_INVALID_FD != descriptor);
+
+            const int rc = 0 > NUM_BYTES
+                         ? Obj::write(descriptor, blob, OFFSET)
+                         : Obj::write(descriptor, blob, OFFSET, NUM_BYTES);
+
+            ASSERTV(LINE, rc, EXP == rc);
+            ASSERTV(LINE, DATA_STRING.substr(OFFSET, EXP) ==
+                                                        readAll(descriptor));
+            ASSERTV(LINE, LENGTH == blob.length());
+
+            FileUtil::close(descriptor);
+        }
+
+        if (verbose) cout << "\tTesting many buffers." << endl;
+        {
+            const int NUM_BUFFERS = Obj::k_MAX_NUM_BUFFERS * 2 + 3;
+
+            bsl::string spec(NUM_BUFFERS, '1');
+            bsl::string data;
+            for (int i = 0; i < NUM_BUFFERS; ++i) {
+                data.push_back(static_cast<char>('A' + i % 26));
+            }
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, spec.c_str(), data);
+
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+            int offset   = 0;
+            int numCalls = 0;
+            while (offset < blob.length()) {
+                const int rc = Obj::write(descriptor, blob, offset);
+                ASSERTV(rc, 0 < rc && rc <= Obj::k_MAX_NUM_BUFFERS);
+                if (rc <= 0) {
+                    break;
+                }
+                offset += rc;
+                ++numCalls;
+            }
+
+            ASSERTV(numCalls, 3 == numCalls);
+            ASSERT(data == readAll(descriptor));
+
+            FileUtil::close(descriptor);
+        }
+
+        if (verbose) cout << "\tTesting errors." << endl;
+        {
+            bdlbb::Blob blob;
+            makeBlob(&blob, "55", "abcdefg");
+
+            const FileDescriptor readOnly = FileUtil::open(
+                                                   fileName,
+                                                   FileUtil::e_OPEN,
+                                                   FileUtil::e_READ_ONLY);
+            ASSERT(FileUtil::k_INVALID_FD != readOnly);
+
+            ASSERT(0 > Obj::write(readOnly, blob, 0));
+            ASSERT(0 > Obj::write(readOnly, blob, 2, 4));
+
+            FileUtil::close(readOnly);
+        }
+
+        FileUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a multi-buffer blob to a file and read it back into
+        //:   another blob.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string    fileName   = tempFileName(test);
+        const FileDescriptor descriptor = openTempFile(fileName);
+        ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+        bdlbb::SimpleBlobBufferFactory factory(4);
+
+        bdlbb::Blob source(&factory);
+        bdlbb::BlobUtil::append(&source, "hello, world", 12);
+        ASSERT(3 == source.numDataBuffers());
+
+        ASSERT(12 == Obj::write(descriptor, source, 0));
+        ASSERT( 5 == Obj::write(descriptor, source, 7, 5));
+
+        rewind(descriptor);
+
+        bdlbb::Blob target(&factory);
+        ASSERT( 0 == Obj::read(&target, descriptor));
+        ASSERT(17 == Obj::read(&target, descriptor, 100));
+        ASSERT(17 == target.length());
+        ASSERT("hello, worldworld" == blobContents(target));
+        ASSERT( 0 == Obj::read(&target, descriptor, 100));
+
+        FileUtil::close(descriptor);
+        FileUtil::remove(fileName);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -325,6 +325,40 @@ InBlobStreamBuf::~InBlobStreamBuf()
                            // ======================
 
 // PRIVATE MANIPULATORS
+char *OutBlobStreamBuf::reserveSlow(int numBytes)
+{
+    BSLS_ASSERT(0 == checkInvariant());
+    BSLS_ASSERT(numBytes > epptr() - pptr());
+
+    if (pptr() != epptr()) {
+        // The bytes would straddle the end of the current buffer.
+
+        return 0;                                                     // RETURN
+    }
+
+    // Advance to the next buffer as 'overflow' does, but without writing to
+    // it, and so without extending the length of the blob.
+
+    int currentPos;
+    if (0 == d_blob_p->totalSize() && 0 == d_blob_p->length()) {
+        currentPos = 0;
+    }
+    else {
+        currentPos = d_previousBuffersLength +
+                     d_blob_p->buffer(d_putBufferIndex).size();
+    }
+    if (currentPos >= d_blob_p->totalSize()) {
+        const int length = d_blob_p->length();
+
+        d_blob_p->setLength(currentPos + 1);  // add a buffer
+        d_blob_p->setLength(length);
+    }
+
+    setPutPosition(currentPos);
+
+    return numBytes <= epptr() - pptr() ? pptr() : 0;
+}
+
 void OutBlobStreamBuf::setPutPosition(bsl::size_t position)
 {
     BSLS_ASSERT(position <= static_cast<unsigned>(d_blob_p->totalSize()));
@@ -33,12 +33,115 @@ BSLS_IDENT("$Id: $")
 // behaves logically as a single indexed buffer.  'bdlbb::InBlobStreamBuf' and
 // 'bdlbb::OutBlobStreamBuf' can therefore respectively read from and write to
 // this buffer as if there were a single continuous index.
+//
+///Writing Directly to Blob Buffers
+///--------------------------------
+// In addition to the 'bsl::streambuf' protocol, 'bdlbb::OutBlobStreamBuf'
+// provides a pair of manipulators, 'reserve' and 'commit', with which a client
+// (e.g., an encoder formatting a number) can write a run of bytes directly
+// into the buffers of the blob, without a (virtual) call to 'sputn' and
+// without copying the bytes from an intermediate buffer.  'reserve(n)' returns
+// the address of 'n' contiguous bytes at the current put position, or 0 if
+// the current buffer of the blob has room for fewer than 'n' (but more than
+// 0) bytes, or if the current buffer is full and the next buffer is smaller
+// than 'n' bytes, in which case the client must write the bytes by means of
+// the 'streambuf' interface instead.  (When the current buffer is full,
+// 'reserve' moves to the next buffer, adding one to the blob if needed, even
+// if it then returns 0; the length of the blob is not changed.)  After
+// writing at most 'n' bytes to the address returned, the client calls
+// 'commit' with the number of bytes written to advance the put position past
+// them.  As with the bytes written
+// through the 'streambuf' interface, the length of the blob includes the
+// committed bytes after the next call to 'pubsync' (and on destruction of the
+// stream buffer).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Integers into a Blob
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write the decimal representations of many integers to a
+// blob, as an encoder does.  Rather than formatting each integer into a local
+// buffer and copying it into the blob with 'sputn', we format it directly
+// into the buffers of the blob whenever possible.
+//
+// First, we define a function that formats an unsigned integer into a buffer
+// of at least 10 bytes, and returns the number of bytes written:
+//..
+//  int formatDecimal(char *buffer, unsigned int value)
+//  {
+//      char  digits[10];
+//      char *end = digits + sizeof digits;
+//      char *p   = end;
+//      do {
+//          *--p   = static_cast<char>('0' + value % 10);
+//          value /= 10;
+//      } while (value);
+//      bsl::memcpy(buffer, p, end - p);
+//      return static_cast<int>(end - p);
+//  }
+//..
+// Then, we define a function that writes an integer and a separator to an
+// 'OutBlobStreamBuf', falling back to 'sputn' when the current buffer of the
+// blob cannot hold the longest representation of an integer:
+//..
+//  void writeValue(bdlbb::OutBlobStreamBuf *streamBuf, unsigned int value)
+//  {
+//      enum { k_MAX_LENGTH = 11 };  // 10 digits and a separator
+//
+//      char *span = streamBuf->reserve(k_MAX_LENGTH);
+//      if (span) {
+//          int length     = formatDecimal(span, value);
+//          span[length++] = ' ';
+//          streamBuf->commit(length);
+//      }
+//      else {
+//          char buffer[k_MAX_LENGTH];
+//          int  length      = formatDecimal(buffer, value);
+//          buffer[length++] = ' ';
+//          streamBuf->sputn(buffer, length);
+//      }
+//  }
+//..
+// Next, we create a blob whose buffers hold 16 bytes, and an
+// 'OutBlobStreamBuf' writing to it:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(16);
+//  bdlbb::Blob                    blob(&factory);
+//  bdlbb::OutBlobStreamBuf        streamBuf(&blob);
+//..
+// Now, we write a sequence of integers:
+//..
+//  for (unsigned int i = 0; i < 100; ++i) {
+//      writeValue(&streamBuf, i * 1001);
+//  }
+//  streamBuf.pubsync();
+//..
+// Finally, we verify that the blob holds the expected text, whichever way
+// each integer was written:
+//..
+//  bsl::string expected;
+//  for (unsigned int i = 0; i < 100; ++i) {
+//      char buffer[16];
+//      int  length = formatDecimal(buffer, i * 1001);
+//      expected.append(buffer, length);
+//      expected.push_back(' ');
+//  }
+//
+//  bsl::string             actual(blob.length(), '\0');
+//  bdlbb::InBlobStreamBuf  inStreamBuf(&blob);
+//  inStreamBuf.sgetn(&actual[0], blob.length());
+//
+//  assert(expected == actual);
+//..
 
 #include <bdlscm_version.h>
 
 #include <bdlbb_blob.h>
 
 #include <bsls_assert.h>
+#include <bsls_performancehint.h>
 #include <bsls_review.h>
 
 #include <bsl_ios.h>  // for 'bsl::streamsize'
@@ -186,6 +289,13 @@ class OutBlobStreamBuf : public bsl::streambuf {
 
   private:
     // PRIVATE MANIPULATORS
+    char *reserveSlow(int numBytes);
+        // Return the address of the specified 'numBytes' contiguous bytes at
+        // the current put position, advancing to (and, if needed, adding) the
+        // next buffer of the held blob if the current buffer is full, or 0 if
+        // they cannot be provided.  The behavior is undefined unless the
+        // current buffer has room for fewer than 'numBytes' bytes.
+
     void setPutPosition(bsl::size_t position);
         // Set the current location to the specified 'position'.
 
@@ -256,9 +366,36 @@ class OutBlobStreamBuf : public bsl::streambuf {
         // Destroy this stream buffer.
 
     // MANIPULATORS
+    void commit(int numBytes);
+        // Advance the put position of this stream buffer by the specified
+        // 'numBytes', which have been written to the address returned by the
+        // most recent call to 'reserve'.  The length of the blob held by this
+        // stream buffer is updated on the next call to 'pubsync' (or on
+        // destruction of this stream buffer).  The behavior is undefined
+        // unless 'reserve' returned a non-null address for at least
+        // 'numBytes' bytes, and the put position was not modified (other
+        // than by this call) since then.  See
+        // {Writing Directly to Blob Buffers}.
+
     bdlbb::Blob *data();
         // Return the address of the blob held by this stream buffer.
 
+    char *reserve(int numBytes);
+        // Return the address of the specified 'numBytes' contiguous bytes at
+        // the current put position of this stream buffer, into which a client
+        // may write, in place, bytes that it then passes to 'commit', or 0 if
+        // they cannot be provided.  If the current buffer of the held blob is
+        // full, first move the put area to the start of the next buffer
+        // (adding a buffer to the blob, as 'overflow' would, if there is
+        // none), and then return 0 if that buffer is smaller than 'numBytes';
+        // note that this move happens whether or not 0 is returned, and
+        // changes neither the put position (as reported by 'pubseekoff') nor
+        // the length of the blob, but may increase the number of buffers (and
+        // total size) of the blob.  Otherwise, return 0, having no effect, if
+        // the current buffer has room for fewer than 'numBytes' (but more
+        // than 0) bytes.  The behavior is undefined unless '0 < numBytes'.
+        // See {Writing Directly to Blob Buffers}.
+
     void reset(bdlbb::Blob *blob = 0);
         // Reset the put position of this buffer to the first location,
         // available for writing in the underlying 'bdlbb::Blob'. Optionally
@@ -329,12 +466,32 @@ int InBlobStreamBuf::previousBuffersLength() const
                            // ======================
 
 // MANIPULATORS
+inline
+void OutBlobStreamBuf::commit(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(numBytes <= epptr() - pptr());
+
+    pbump(numBytes);
+}
+
 inline
 bdlbb::Blob *OutBlobStreamBuf::data()
 {
     return d_blob_p;
 }
 
+inline
+char *OutBlobStreamBuf::reserve(int numBytes)
+{
+    BSLS_ASSERT(0 < numBytes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes <= epptr() - pptr())) {
+        return pptr();                                                // RETURN
+    }
+    return reserveSlow(numBytes);
+}
+
 inline
 void OutBlobStreamBuf::reset(bdlbb::Blob *blob)
 {
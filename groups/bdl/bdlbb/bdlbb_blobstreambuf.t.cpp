@@ -10,6 +10,7 @@
 #include <bdlbb_blobstreambuf.h>
 
 #include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 
 #include <bslim_testutil.h>
 
@@ -20,6 +21,7 @@
 #include <bslma_testallocator.h>                // for testing only
 #include <bslma_testallocatorexception.h>       // for testing only
 
+#include <bsls_asserttest.h>
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
@@ -54,12 +56,15 @@ using bsl::cerr;
 // CREATORS
 //
 // MANIPULATORS
+// [ 9] void OutBlobStreamBuf::commit(int numBytes);
+// [ 9] char *OutBlobStreamBuf::reserve(int numBytes);
 //
 // ACCESSORS
 //
 // FREE OPERATORS
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -105,6 +110,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
 class testBlobBufferFactory : public bdlbb::BlobBufferFactory
 {
     bslma::Allocator *d_allocator_p;
@@ -172,6 +184,45 @@ bool testBlobBufferFactory::growFlag() const
     return d_growFlag;
 }
 
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+int formatDecimal(char *buffer, unsigned int value)
+{
+    char  digits[10];
+    char *end = digits + sizeof digits;
+    char *p   = end;
+    do {
+        *--p   = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+    bsl::memcpy(buffer, p, end - p);
+    return static_cast<int>(end - p);
+}
+
+void writeValue(bdlbb::OutBlobStreamBuf *streamBuf, unsigned int value)
+{
+    enum { k_MAX_LENGTH = 11 };  // 10 digits and a separator
+
+    char *span = streamBuf->reserve(k_MAX_LENGTH);
+    if (span) {
+        int length     = formatDecimal(span, value);
+        span[length++] = ' ';
+        streamBuf->commit(length);
+    }
+    else {
+        char buffer[k_MAX_LENGTH];
+        int  length      = formatDecimal(buffer, value);
+        buffer[length++] = ' ';
+        streamBuf->sputn(buffer, length);
+    }
+}
+
+}  // close namespace usage
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -189,6 +240,279 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+        bdlbb::SimpleBlobBufferFactory factory(16);
+        bdlbb::Blob                    blob(&factory);
+        bdlbb::OutBlobStreamBuf        streamBuf(&blob);
+
+        for (unsigned int i = 0; i < 100; ++i) {
+            writeValue(&streamBuf, i * 1001);
+        }
+        streamBuf.pubsync();
+
+        bsl::string expected;
+        for (unsigned int i = 0; i < 100; ++i) {
+            char buffer[16];
+            int  length = formatDecimal(buffer, i * 1001);
+            expected.append(buffer, length);
+            expected.push_back(' ');
+        }
+
+        bsl::string             actual(blob.length(), '\0');
+        bdlbb::InBlobStreamBuf  inStreamBuf(&blob);
+        inStreamBuf.sgetn(&actual[0], blob.length());
+
+        ASSERT(expected == actual);
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserve' AND 'commit'
+        //
+        // Concerns:
+        //: 1 'reserve' returns the current put position if the current buffer
+        //:   has room for the requested number of bytes.
+        //:
+        //: 2 'reserve' returns 0, and has no effect, if the current buffer has
+        //:   room for fewer (but more than 0) bytes.
+        //:
+        //: 3 'reserve' advances to the next buffer if the current buffer is
+        //:   full, adding a buffer to the blob if needed, and returns 0 if
+        //:   that buffer is too small; in either case, neither the length of
+        //:   the blob nor the put position is modified.
+        //:
+        //: 4 'commit' advances the put position, and the committed bytes are
+        //:   part of the blob after 'pubsync', interleaved correctly with
+        //:   bytes written with 'sputn' and 'sputc'.
+        //:
+        //: 5 Bytes can be reserved and committed after seeking backwards.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a blob with a single buffer, reserve bytes at the start and
+        //:   at the end of the buffer, and verify the addresses returned and
+        //:   the length of the blob.  (C-1..3)
+        //:
+        //: 2 For a table of buffer sizes and reservation sizes, write a
+        //:   sequence of bytes to a blob, reserving and committing them when
+        //:   possible, and using 'sputc' and 'sputn' otherwise, and compare
+        //:   the blob to the sequence.  (C-1..4)
+        //:
+        //: 3 Seek backwards, and overwrite bytes using 'reserve' and
+        //:   'commit'.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void OutBlobStreamBuf::commit(int numBytes);
+        //   char *OutBlobStreamBuf::reserve(int numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reserve' AND 'commit'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting a single buffer." << endl;
+        {
+            testBlobBufferFactory fa(&ta, 8);
+            fa.setGrowFlag(false);
+
+            bdlbb::Blob             blob(&fa, &ta);
+            bdlbb::OutBlobStreamBuf out(&blob);
+
+            char *span = out.reserve(8);
+            ASSERT(0 != span);
+            ASSERT(1 == blob.numBuffers());
+            ASSERT(0 == blob.length());
+            ASSERT(blob.buffer(0).data() == span);
+
+            ASSERT(0 == out.reserve(9));
+
+            bsl::memcpy(span, "abcde", 5);
+            out.commit(5);
+            ASSERT(0 == blob.length());
+            ASSERT(5 == out.pubseekoff(0, bsl::ios_base::cur,
+                                          bsl::ios_base::out));
+            ASSERT(5 == blob.length());
+
+            ASSERT(blob.buffer(0).data() + 5 == out.reserve(3));
+            ASSERT(0 == out.reserve(4));
+            ASSERT(1 == blob.numBuffers());
+
+            out.commit(0);
+            ASSERT(3 == out.sputn("fgh", 3));
+            out.pubsync();
+            ASSERT(8 == blob.length());
+            ASSERT(1 == blob.numBuffers());
+
+            // The buffer is full: the next buffer is added, but not used, and
+            // the put position is unchanged.
+
+            ASSERT(0 == out.reserve(9));
+            ASSERT(2 == blob.numBuffers());
+            ASSERT(16 == blob.totalSize());
+            ASSERT(8 == blob.length());
+            ASSERT(8 == out.pubseekoff(0, bsl::ios_base::cur,
+                                          bsl::ios_base::out));
+
+            span = out.reserve(8);
+            ASSERT(blob.buffer(1).data() == span);
+            ASSERT(2 == blob.numBuffers());
+            ASSERT(8 == blob.length());
+
+            bsl::memcpy(span, "ij", 2);
+            out.commit(2);
+            out.pubsync();
+            ASSERT(10 == blob.length());
+            ASSERT(0 == bsl::memcmp(blob.buffer(0).data(), "abcdefgh", 8));
+            ASSERT(0 == bsl::memcmp(blob.buffer(1).data(), "ij", 2));
+        }
+
+        if (verbose) cout << "\nTesting sequences of writes." << endl;
+        {
+            const struct {
+                int d_line;          // source line number
+                int d_bufferSize;    // initial factory buffer size
+                int d_growFlag;      // whether buffer sizes grow
+                int d_reserveSize;   // number of bytes reserved
+            } DATA[] = {
+                //Line  Buffer Size  Grow  Reserve Size
+                //----  -----------  ----  ------------
+                { L_,   1,           0,    1            },
+                { L_,   1,           0,    2            },
+                { L_,   1,           1,    3            },
+                { L_,   3,           0,    2            },
+                { L_,   4,           1,    4            },
+                { L_,   7,           0,    3            },
+                { L_,   16,          0,    5            },
+                { L_,   16,          1,    16           },
+                { L_,   37,          0,    11           },
+            };
+            enum { k_DATA_SIZE = sizeof DATA / sizeof *DATA };
+
+            enum { k_DATA_LENGTH = 300 };
+
+            bsl::string data;
+            for (int i = 0; i < k_DATA_LENGTH; ++i) {
+                data.push_back(static_cast<char>('a' + i % 26));
+            }
+
+            for (int ti = 0; ti < k_DATA_SIZE; ++ti) {
+                const int LINE         = DATA[ti].d_line;
+                const int BUFFER_SIZE  = DATA[ti].d_bufferSize;
+                const int GROW         = DATA[ti].d_growFlag;
+                const int RESERVE_SIZE = DATA[ti].d_reserveSize;
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(BUFFER_SIZE) P_(GROW) P(RESERVE_SIZE)
+                }
+
+                testBlobBufferFactory fa(&ta, BUFFER_SIZE);
+                fa.setGrowFlag(GROW);
+
+                bdlbb::Blob blob(&fa, &ta);
+                {
+                    bdlbb::OutBlobStreamBuf out(&blob);
+
+                    int numReserved = 0;
+                    int pos         = 0;
+                    while (pos < k_DATA_LENGTH) {
+                        const int n = bsl::min(RESERVE_SIZE,
+                                               k_DATA_LENGTH - pos);
+
+                        char *span = out.reserve(RESERVE_SIZE);
+                        if (span) {
+                            ++numReserved;
+                            bsl::memcpy(span, data.data() + pos, n);
+                            out.commit(n);
+                        }
+                        else if (pos % 2) {
+                            ASSERTV(LINE, n == out.sputn(data.data() + pos,
+                                                         n));
+                        }
+                        else {
+                            for (int i = 0; i < n; ++i) {
+                                ASSERTV(LINE, data[pos + i] ==
+                                                   out.sputc(data[pos + i]));
+                            }
+                        }
+                        pos += n;
+                    }
+                    ASSERTV(LINE, numReserved,
+                            (RESERVE_SIZE <= BUFFER_SIZE || GROW) ==
+                                                          (0 < numReserved));
+
+                    // Overwrite the first bytes after seeking backwards.
+
+                    ASSERTV(LINE, 0 == out.pubseekpos(0, bsl::ios_base::out));
+
+                    char *span = out.reserve(1);
+                    ASSERTV(LINE, blob.buffer(0).data() == span);
+                    *span = 'A';
+                    out.commit(1);
+                    data[0] = 'A';
+
+                    ASSERTV(LINE, k_DATA_LENGTH == out.pubseekoff(
+                                                        0,
+                                                        bsl::ios_base::end,
+                                                        bsl::ios_base::out));
+                }
+                ASSERTV(LINE, blob.length(), k_DATA_LENGTH == blob.length());
+
+                bsl::string actual(blob.length(), '\0');
+                bdlbb::InBlobStreamBuf in(&blob);
+                ASSERTV(LINE, k_DATA_LENGTH == in.sgetn(&actual[0],
+                                                        k_DATA_LENGTH));
+                ASSERTV(LINE, data == actual);
+
+                data[0] = 'a';
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            testBlobBufferFactory fa(&ta, 8);
+
+            bdlbb::Blob             blob(&fa, &ta);
+            bdlbb::OutBlobStreamBuf out(&blob);
+
+            ASSERT_FAIL(out.reserve(0));
+            ASSERT_PASS(out.reserve(1));
+
+            ASSERT_FAIL(out.commit(-1));
+            ASSERT_PASS(out.commit(8));
+            ASSERT_FAIL(out.commit(1));
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCERN: EOF IS STREAMED CORRECTLY
@@ -0,0 +1,281 @@
+// bdlbb_mappedfileblobloader.cpp                                     -*-C++-*-
+#include <bdlbb_mappedfileblobloader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_mappedfileblobloader_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blob.h>
+
+#include <bdls_memoryutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace {
+
+typedef bdls::FilesystemUtil Util;
+
+                               // =============
+                               // class Mapping
+                               // =============
+
+class Mapping {
+    // This class owns a read-only mapping of a range of a file, which it
+    // unmaps on destruction.  The buffers appended to a blob by a call to
+    // 'MappedFileBlobLoader::load' share ownership of one object of this
+    // class.
+
+    // DATA
+    void        *d_address_p;  // base address of the mapping
+    bsl::size_t  d_size;       // size of the mapping
+
+  private:
+    // NOT IMPLEMENTED
+    Mapping(const Mapping&);
+    Mapping& operator=(const Mapping&);
+
+  public:
+    // CREATORS
+    Mapping();
+        // Create an object that owns no mapping.
+
+    ~Mapping();
+        // Unmap the mapping owned by this object, if any, and destroy this
+        // object.
+
+    // MANIPULATORS
+    int map(Util::FileDescriptor descriptor,
+            Util::Offset         offset,
+            bsl::size_t          size);
+        // Map read-only the specified 'size' bytes starting at the specified
+        // 'offset' of the file having the specified 'descriptor', and take
+        // ownership of the mapping.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless this object owns
+        // no mapping and 'offset' is a multiple of
+        // 'bdls::MemoryUtil::pageSize()'.
+
+    // ACCESSORS
+    char *address() const;
+        // Return the base address of the mapping owned by this object, or 0
+        // if this object owns no mapping.
+};
+
+                               // -------------
+                               // class Mapping
+                               // -------------
+
+// CREATORS
+Mapping::Mapping()
+: d_address_p(0)
+, d_size(0)
+{
+}
+
+Mapping::~Mapping()
+{
+    if (d_address_p) {
+        Util::unmap(d_address_p, d_size);
+    }
+}
+
+// MANIPULATORS
+int Mapping::map(Util::FileDescriptor descriptor,
+                 Util::Offset         offset,
+                 bsl::size_t          size)
+{
+    BSLS_ASSERT(!d_address_p);
+
+    void *address = 0;
+    if (0 != Util::map(descriptor,
+                       &address,
+                       offset,
+                       size,
+                       bdls::MemoryUtil::k_ACCESS_READ)) {
+        return 1;                                                     // RETURN
+    }
+
+    d_address_p = address;
+    d_size      = size;
+    return 0;
+}
+
+// ACCESSORS
+char *Mapping::address() const
+{
+    return static_cast<char *>(d_address_p);
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                         // --------------------------
+                         // class MappedFileBlobLoader
+                         // --------------------------
+
+// CREATORS
+MappedFileBlobLoader::MappedFileBlobLoader(bslma::Allocator *basicAllocator)
+: d_descriptor(Util::k_INVALID_FD)
+, d_fileSize(0)
+, d_windowSize(k_DEFAULT_WINDOW_SIZE)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+MappedFileBlobLoader::MappedFileBlobLoader(int               windowSize,
+                                           bslma::Allocator *basicAllocator)
+: d_descriptor(Util::k_INVALID_FD)
+, d_fileSize(0)
+, d_windowSize(windowSize)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < windowSize);
+}
+
+MappedFileBlobLoader::~MappedFileBlobLoader()
+{
+    close();
+}
+
+// MANIPULATORS
+void MappedFileBlobLoader::close()
+{
+    if (Util::k_INVALID_FD != d_descriptor) {
+        Util::close(d_descriptor);
+        d_descriptor = Util::k_INVALID_FD;
+        d_fileSize   = 0;
+    }
+}
+
+int MappedFileBlobLoader::open(const char *path)
+{
+    BSLS_ASSERT(path);
+
+    close();
+
+    FileDescriptor descriptor = Util::open(path,
+                                           Util::e_OPEN,
+                                           Util::e_READ_ONLY);
+    if (Util::k_INVALID_FD == descriptor) {
+        return 1;                                                     // RETURN
+    }
+
+    const Offset fileSize = Util::getFileSize(descriptor);
+    if (fileSize < 0) {
+        Util::close(descriptor);
+        return 2;                                                     // RETURN
+    }
+
+    d_descriptor = descriptor;
+    d_fileSize   = fileSize;
+
+    return 0;
+}
+
+// ACCESSORS
+int MappedFileBlobLoader::load(Blob *blob) const
+{
+    BSLS_ASSERT(blob);
+
+    if (d_fileSize > INT_MAX) {
+        return 1;                                                     // RETURN
+    }
+
+    return load(blob, 0, static_cast<int>(d_fileSize));
+}
+
+int MappedFileBlobLoader::load(Blob *blob, Offset offset, int length) const
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+
+    if (!isOpen()) {
+        return 1;                                                     // RETURN
+    }
+
+    if (offset > d_fileSize || length > d_fileSize - offset) {
+        return 2;                                                     // RETURN
+    }
+
+    if (length > INT_MAX - blob->length()) {
+        return 3;                                                     // RETURN
+    }
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    // The offset of a mapping must be a multiple of the page size (the
+    // allocation granularity on Windows), so map from the start of the page
+    // holding 'offset'.
+
+    const Offset      pageSize  = bdls::MemoryUtil::pageSize();
+    const Offset      mapOffset = offset - offset % pageSize;
+    const int         skip      = static_cast<int>(offset - mapOffset);
+    const bsl::size_t mapSize   = static_cast<bsl::size_t>(skip)
+                                + static_cast<bsl::size_t>(length);
+
+    // Create the owner of the mapping before mapping, so that the mapping
+    // cannot leak if an allocation fails.
+
+    bsl::shared_ptr<Mapping> mapping =
+                                  bsl::allocate_shared<Mapping>(d_allocator_p);
+
+    if (0 != mapping->map(d_descriptor, mapOffset, mapSize)) {
+        return 4;                                                     // RETURN
+    }
+
+    char *data = mapping->address() + skip;
+
+    // Build the buffers before modifying 'blob' so that a failure to allocate
+    // leaves 'blob' unchanged.
+
+    const int               numWindows = (length - 1) / d_windowSize + 1;
+    bsl::vector<BlobBuffer> buffers(d_allocator_p);
+    buffers.reserve(numWindows);
+
+    int position = 0;
+    while (position < length) {
+        const int size = length - position < d_windowSize
+                       ? length - position
+                       : d_windowSize;
+
+        buffers.push_back(BlobBuffer(bsl::shared_ptr<char>(mapping,
+                                                           data + position),
+                                     size));
+        position += size;
+    }
+
+    for (bsl::size_t i = 0; i < buffers.size(); ++i) {
+        blob->appendDataBuffer(buffers[i]);
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,277 @@
+// bdlbb_mappedfileblobloader.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLBB_MAPPEDFILEBLOBLOADER
+#define INCLUDED_BDLBB_MAPPEDFILEBLOBLOADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide read-only blob views of memory-mapped file ranges.
+//
+//@CLASSES:
+//  bdlbb::MappedFileBlobLoader: loads file ranges into blobs via 'mmap'
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobstreambuf, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlbb::MappedFileBlobLoader', that appends a range of an open file to a
+// 'bdlbb::Blob' without copying the file data.  Each call to 'load' maps the
+// requested range into memory with 'bdls::FilesystemUtil::map' and appends
+// to the blob a sequence of buffers, each of which is a window of at most
+// 'windowSize()' bytes into that mapping.  The buffers share ownership of the
+// mapping, which is unmapped when the last buffer referring to it is
+// released.  Consequently, the blob (and any blob to which its buffers are
+// copied, e.g., by 'bdlbb::BlobUtil::append') remains valid after the loader
+// is closed or destroyed.
+//
+// Decoders that read from a 'bdlbb::Blob' or a 'bdlbb::InBlobStreamBuf' can
+// therefore process the contents of a file directly from the page cache.  The
+// length of a blob is an 'int', so a file larger than 'INT_MAX' bytes is
+// processed as a sequence of ranges (see {Example 2}); only the range
+// currently loaded in a blob occupies address space.
+//
+///Read-Only Buffers
+///-----------------
+// The memory of the buffers appended by 'load' is mapped read-only.  The
+// behavior is undefined if the contents of any such buffer are modified (on
+// most platforms, the process is terminated).  Note that operations that
+// modify the *structure* of a blob, such as 'bdlbb::BlobUtil::erase' or
+// 'bdlbb::Blob::setLength', do not modify buffer contents, and are safe;
+// however, 'setLength' may expose the unused bytes of the last window as
+// capacity, which must not be written.  The behavior is also undefined if the
+// file is truncated while any part of it beyond the new end of file is
+// mapped.
+//
+///Thread Safety
+///-------------
+// 'bdlbb::MappedFileBlobLoader' is *const* *thread-safe*, meaning that
+// 'load' may be called concurrently on the same object provided that 'open'
+// and 'close' are not called concurrently.  The buffers appended by 'load'
+// may be released from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a File through a Stream Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a file, 'filename', holds text that is to be parsed by a
+// function accepting a 'bsl::streambuf'.
+//
+// First, we open the file with a loader that appends windows of at most 4096
+// bytes:
+//..
+//  bdlbb::MappedFileBlobLoader loader(4096);
+//  int rc = loader.open(filename);
+//  assert(0 == rc);
+//  assert(loader.isOpen());
+//..
+// Then, we load the whole file into a blob.  No buffer factory is needed,
+// because the blob does not allocate buffers:
+//..
+//  bdlbb::Blob blob;
+//  rc = loader.load(&blob);
+//  assert(0 == rc);
+//  assert(loader.fileSize() == blob.length());
+//..
+// Next, we close the loader, and observe that the blob remains valid:
+//..
+//  loader.close();
+//  assert(!loader.isOpen());
+//..
+// Finally, we read the contents of the file through a stream buffer:
+//..
+//  bdlbb::InBlobStreamBuf streamBuf(&blob);
+//  bsl::istream           stream(&streamBuf);
+//
+//  bsl::string firstLine;
+//  bsl::getline(stream, firstLine);
+//  assert("first line" == firstLine);
+//..
+//
+///Example 2: Processing a Large File in Ranges
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a file of captured records is too large to be loaded into one
+// blob, and that each record is processed by a function,
+// 'processRecords', that consumes complete records from the front of a blob.
+//
+// We load consecutive ranges of the file, appending each range to the bytes
+// left over from the previous one.  The pages of a range are unmapped as soon
+// as 'processRecords' erases the last record that refers to them:
+//..
+//  int processFile(const char *path, int rangeSize)
+//  {
+//      bdlbb::MappedFileBlobLoader loader;
+//      if (0 != loader.open(path)) {
+//          return -1;                                                // RETURN
+//      }
+//
+//      typedef bdlbb::MappedFileBlobLoader::Offset Offset;
+//
+//      bdlbb::Blob blob;
+//      Offset      offset = 0;
+//      while (offset < loader.fileSize()) {
+//          const Offset remaining = loader.fileSize() - offset;
+//          const int    length    = remaining < rangeSize
+//                                 ? static_cast<int>(remaining)
+//                                 : rangeSize;
+//          if (0 != loader.load(&blob, offset, length)) {
+//              return -1;                                            // RETURN
+//          }
+//          offset += length;
+//
+//          processRecords(&blob);
+//      }
+//      return blob.length();  // number of unprocessed bytes
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+class Blob;
+
+                         // ==========================
+                         // class MappedFileBlobLoader
+                         // ==========================
+
+class MappedFileBlobLoader {
+    // This mechanism class appends read-only, memory-mapped ranges of an open
+    // file to 'Blob' objects without copying the file data.
+
+  public:
+    // TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor / file handle type.
+
+    typedef bdls::FilesystemUtil::Offset         Offset;
+        // 'Offset' is an alias for a signed integral type representing an
+        // offset within a file.
+
+    enum {
+        k_DEFAULT_WINDOW_SIZE = 1024 * 1024  // default maximum size of the
+                                             // buffers appended by 'load'
+    };
+
+  private:
+    // DATA
+    FileDescriptor    d_descriptor;   // open file, or 'k_INVALID_FD'
+
+    Offset            d_fileSize;     // size of the file when opened
+
+    int               d_windowSize;   // maximum size of appended buffers
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    MappedFileBlobLoader(const MappedFileBlobLoader&);
+    MappedFileBlobLoader& operator=(const MappedFileBlobLoader&);
+
+  public:
+    // CREATORS
+    explicit
+    MappedFileBlobLoader(bslma::Allocator *basicAllocator = 0);
+    explicit
+    MappedFileBlobLoader(int windowSize, bslma::Allocator *basicAllocator = 0);
+        // Create a loader having no open file.  Optionally specify
+        // 'windowSize', the maximum size of each buffer appended by 'load'.
+        // If 'windowSize' is not specified, 'k_DEFAULT_WINDOW_SIZE' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory for the
+        // objects that track each mapping.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < windowSize'.
+
+    ~MappedFileBlobLoader();
+        // Close the file held by this loader, if any, and destroy this object.
+        // Note that blobs loaded by this object remain valid.
+
+    // MANIPULATORS
+    void close();
+        // Close the file held by this loader, if any.  Note that blobs loaded
+        // by this object remain valid.
+
+    int open(const char *path);
+        // Open the file at the specified 'path' for reading, closing the file
+        // previously held by this loader, if any.  Return 0 on success, and a
+        // non-zero value (with this loader having no open file) otherwise.
+
+    // ACCESSORS
+    Offset fileSize() const;
+        // Return the size of the file held by this loader at the time it was
+        // opened, or 0 if this loader has no open file.
+
+    bool isOpen() const;
+        // Return 'true' if this loader holds an open file, and 'false'
+        // otherwise.
+
+    int load(Blob *blob) const;
+    int load(Blob *blob, Offset offset, int length) const;
+        // Map the whole file held by this loader, or optionally the specified
+        // 'length' bytes of it starting at the specified 'offset', and append
+        // the mapped bytes to the specified 'blob' as a sequence of read-only
+        // buffers of at most 'windowSize()' bytes each.  Return 0 on success,
+        // and a non-zero value (with no effect on 'blob') if this loader has
+        // no open file, the range is not within the file, the range does not
+        // fit in 'blob', or the range cannot be mapped.  Loading an empty
+        // range succeeds and has no effect.  The behavior is undefined unless
+        // '0 <= offset' and '0 <= length'.  Note that the file may be
+        // processed in ranges if it is too large for a single blob.
+
+    int windowSize() const;
+        // Return the maximum size of each buffer appended by 'load'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class MappedFileBlobLoader
+                         // --------------------------
+
+// ACCESSORS
+inline
+MappedFileBlobLoader::Offset MappedFileBlobLoader::fileSize() const
+{
+    return d_fileSize;
+}
+
+inline
+bool MappedFileBlobLoader::isOpen() const
+{
+    return bdls::FilesystemUtil::k_INVALID_FD != d_descriptor;
+}
+
+inline
+int MappedFileBlobLoader::windowSize() const
+{
+    return d_windowSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
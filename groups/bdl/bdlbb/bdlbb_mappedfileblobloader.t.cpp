@@ -0,0 +1,738 @@
+// bdlbb_mappedfileblobloader.t.cpp                                   -*-C++-*-
+#include <bdlbb_mappedfileblobloader.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+#include <bdlbb_blobutil.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a mechanism that appends memory-mapped ranges
+// of a file to blobs.  We verify that the appended buffers hold exactly the
+// requested bytes of the file (including ranges that do not start on a page
+// boundary), that they are split into windows of the configured size, that
+// invalid ranges are rejected without modifying the blob, and that the
+// mapping remains valid, and its memory in use, until the last buffer
+// referring to it is released, independently of the lifetime of the loader.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit MappedFileBlobLoader(bslma::Allocator *ba = 0);
+// [ 2] MappedFileBlobLoader(int windowSize, bslma::Allocator *ba = 0);
+// [ 2] ~MappedFileBlobLoader();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const char *path);
+//
+// ACCESSORS
+// [ 2] Offset fileSize() const;
+// [ 2] bool isOpen() const;
+// [ 3] int load(Blob *blob) const;
+// [ 3] int load(Blob *blob, Offset offset, int length) const;
+// [ 2] int windowSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] MAPPING LIFETIME
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::MappedFileBlobLoader Obj;
+typedef Obj::Offset                 Offset;
+typedef bdls::FilesystemUtil        FileUtil;
+typedef FileUtil::FileDescriptor    FileDescriptor;
+
+// ============================================================================
+//                          GLOBAL HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdlbb_mappedfileblobloader." << bdls::ProcessUtil::getProcessId()
+        << "." << test << ".tmp";
+    return oss.str();
+}
+
+static
+bsl::string makeData(int length)
+    // Return a string of the specified 'length' whose bytes depend on their
+    // position, so that misplaced ranges are detected.
+{
+    bsl::string result(length, '\0');
+    for (int i = 0; i < length; ++i) {
+        result[i] = static_cast<char>('A' + (i * 7 + i / 251) % 53);
+    }
+    return result;
+}
+
+static
+void writeFile(const bsl::string& fileName, const bsl::string& data)
+    // Create (or truncate) the file having the specified 'fileName', and
+    // write the specified 'data' to it.
+{
+    FileDescriptor fd = FileUtil::open(fileName,
+                                       FileUtil::e_OPEN_OR_CREATE,
+                                       FileUtil::e_READ_WRITE,
+                                       FileUtil::e_TRUNCATE);
+    ASSERT(FileUtil::k_INVALID_FD != fd);
+
+    if (!data.empty()) {
+        const int rc = FileUtil::write(fd,
+                                       data.data(),
+                                       static_cast<int>(data.length()));
+        ASSERT(static_cast<int>(data.length()) == rc);
+    }
+    FileUtil::close(fd);
+}
+
+static
+bsl::string blobContents(const bdlbb::Blob& blob)
+    // Return the data of the specified 'blob'.
+{
+    bsl::string result(blob.length(), '\0');
+    if (0 < blob.length()) {
+        bdlbb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+    }
+    return result;
+}
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+enum { k_RECORD_SIZE = 10 };
+
+int numRecordsProcessed = 0;
+
+void processRecords(bdlbb::Blob *blob)
+    // Consume the complete records of 'k_RECORD_SIZE' bytes at the front of
+    // the specified 'blob', verifying the sequence number held by each.
+{
+    const int numRecords = blob->length() / k_RECORD_SIZE;
+
+    for (int i = 0; i < numRecords; ++i) {
+        char record[k_RECORD_SIZE];
+        bdlbb::BlobUtil::copy(record, *blob, i * k_RECORD_SIZE, k_RECORD_SIZE);
+
+        ASSERTV(numRecordsProcessed,
+                numRecordsProcessed == bsl::atoi(record));
+        ++numRecordsProcessed;
+    }
+
+    bdlbb::BlobUtil::erase(blob, 0, numRecords * k_RECORD_SIZE);
+}
+
+int processFile(const char *path, int rangeSize)
+{
+    bdlbb::MappedFileBlobLoader loader;
+    if (0 != loader.open(path)) {
+        return -1;                                                    // RETURN
+    }
+
+    typedef bdlbb::MappedFileBlobLoader::Offset Offset;
+
+    bdlbb::Blob blob;
+    Offset      offset = 0;
+    while (offset < loader.fileSize()) {
+        const Offset remaining = loader.fileSize() - offset;
+        const int    length    = remaining < rangeSize
+                               ? static_cast<int>(remaining)
+                               : rangeSize;
+        if (0 != loader.load(&blob, offset, length)) {
+            return -1;                                                // RETURN
+        }
+        offset += length;
+
+        processRecords(&blob);
+    }
+    return blob.length();  // number of unprocessed bytes
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage examples provided in the component header file
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage examples from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+        const char       *filename = fileName.c_str();
+
+        writeFile(fileName, "first line\nsecond line\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a File through a Stream Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a file, 'filename', holds text that is to be parsed by a
+// function accepting a 'bsl::streambuf'.
+//
+// First, we open the file with a loader that appends windows of at most 4096
+// bytes:
+//..
+    bdlbb::MappedFileBlobLoader loader(4096);
+    int rc = loader.open(filename);
+    ASSERT(0 == rc);
+    ASSERT(loader.isOpen());
+//..
+// Then, we load the whole file into a blob.  No buffer factory is needed,
+// because the blob does not allocate buffers:
+//..
+    bdlbb::Blob blob;
+    rc = loader.load(&blob);
+    ASSERT(0 == rc);
+    ASSERT(loader.fileSize() == blob.length());
+//..
+// Next, we close the loader, and observe that the blob remains valid:
+//..
+    loader.close();
+    ASSERT(!loader.isOpen());
+//..
+// Finally, we read the contents of the file through a stream buffer:
+//..
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+    bsl::istream           stream(&streamBuf);
+
+    bsl::string firstLine;
+    bsl::getline(stream, firstLine);
+    ASSERT("first line" == firstLine);
+//..
+//
+///Example 2: Processing a Large File in Ranges
+/// - - - - - - - - - - - - - - - - - - - - - -
+// See 'processFile' above; here we run it on a file of 1000 records, loading
+// ranges whose size is not a multiple of the record size.
+
+        {
+            bsl::string records;
+            for (int i = 0; i < 1000; ++i) {
+                char record[k_RECORD_SIZE + 1];
+                bsl::sprintf(record, "%09d\n", i);
+                records.append(record, k_RECORD_SIZE);
+            }
+            records.append("12345");  // incomplete trailing record
+            writeFile(fileName, records);
+
+            numRecordsProcessed = 0;
+            ASSERT(5 == processFile(filename, 777));
+            ASSERTV(numRecordsProcessed, 1000 == numRecordsProcessed);
+        }
+
+        FileUtil::remove(fileName);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MAPPING LIFETIME
+        //
+        // Concerns:
+        //: 1 The buffers appended by 'load' remain valid after the loader is
+        //:   closed or destroyed, and after the file is removed.
+        //:
+        //: 2 The mapping is released exactly when the last buffer referring
+        //:   to it is released, including buffers copied to other blobs.
+        //:
+        //: 3 Buffers from different calls to 'load' refer to independent
+        //:   mappings.
+        //
+        // Plan:
+        //: 1 Load ranges of a file using a test allocator, destroy the loader
+        //:   and remove the file, and verify the contents of the blob.  (C-1)
+        //:
+        //: 2 Copy buffers to a second blob, release the blobs in turn, and
+        //:   verify the number of blocks in use by the test allocator.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   MAPPING LIFETIME
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "MAPPING LIFETIME" << endl
+                                  << "================" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+        const bsl::string DATA     = makeData(10000);
+        writeFile(fileName, DATA);
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        bslma::TestAllocator ba("blob", veryVerbose);
+
+        {
+            bdlbb::Blob first(&ba);
+            bdlbb::Blob second(&ba);
+            {
+                Obj mX(1000, &ta);
+                ASSERT(0 == mX.open(fileName.c_str()));
+
+                ASSERT(0 == mX.load(&first, 0, 3000));
+                ASSERT(0 == mX.load(&first, 5000, 3000));
+                ASSERT(6 == first.numDataBuffers());
+            }
+            FileUtil::remove(fileName);
+
+            ASSERT(DATA.substr(0, 3000) + DATA.substr(5000, 3000) ==
+                                                        blobContents(first));
+
+            const bsls::Types::Int64 IN_USE = ta.numBlocksInUse();
+            ASSERTV(IN_USE, 0 < IN_USE);
+
+            // Copy the second buffer of each mapping to 'second'.
+
+            second.appendDataBuffer(first.buffer(1));
+            second.appendDataBuffer(first.buffer(4));
+
+            bdlbb::BlobUtil::erase(&first, 0, first.length());
+            first.removeAll();
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE == ta.numBlocksInUse());
+
+            ASSERT(DATA.substr(1000, 1000) + DATA.substr(6000, 1000) ==
+                                                       blobContents(second));
+
+            second.removeBuffer(0);
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE > ta.numBlocksInUse());
+            ASSERTV(ta.numBlocksInUse(), 0 < ta.numBlocksInUse());
+
+            ASSERT(DATA.substr(6000, 1000) == blobContents(second));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOAD
+        //
+        // Concerns:
+        //: 1 'load' appends exactly the requested range of the file, for
+        //:   offsets that are and are not multiples of the page size, and for
+        //:   ranges that span several pages.
+        //:
+        //: 2 The range is split into buffers of 'windowSize()' bytes, except
+        //:   for the last, which holds the remainder.
+        //:
+        //: 3 The range is appended after the existing data of the blob.
+        //:
+        //: 4 Loading an empty range succeeds and has no effect.
+        //:
+        //: 5 'load' fails, with no effect on the blob, if no file is open, if
+        //:   the range is not within the file, or if the range does not fit
+        //:   in the blob.
+        //:
+        //: 6 'load(blob)' loads the whole file.
+        //
+        // Plan:
+        //: 1 Using a table of offsets, lengths, and window sizes, load ranges
+        //:   of a file spanning several pages into a blob that already holds
+        //:   data, and verify the contents, number, and sizes of the buffers
+        //:   of the blob.  (C-1..4)
+        //:
+        //: 2 Verify that invalid ranges, including one that would make the
+        //:   length of the blob exceed 'INT_MAX', are rejected.  (C-5)
+        //:
+        //: 3 Load the whole file, and an empty file.  (C-6)
+        //
+        // Testing:
+        //   int load(Blob *blob) const;
+        //   int load(Blob *blob, Offset offset, int length) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "LOAD" << endl
+                                  << "====" << endl;
+
+        const int         PAGE     = bdls::MemoryUtil::pageSize();
+        const int         SIZE     = 3 * PAGE + 123;
+        const bsl::string fileName = tempFileName(test);
+        const bsl::string DATA     = makeData(SIZE);
+        writeFile(fileName, DATA);
+
+        const bsl::string PREFIX = "prefix";
+
+        static const struct {
+            int d_line;        // source line number
+            int d_offset;      // offset of the range, in bytes
+            int d_pages;       // additional offset, in pages
+            int d_length;      // length of the range
+            int d_windowSize;  // window size of the loader
+        } DATA_TABLE[] = {
+            //LINE  OFFSET  PAGES  LENGTH  WINDOW
+            //----  ------  -----  ------  ------
+            { L_,       0,     0,      0,    100 },
+            { L_,       0,     0,      1,    100 },
+            { L_,       0,     0,    100,    100 },
+            { L_,       0,     0,    101,    100 },
+            { L_,       1,     0,     99,    100 },
+            { L_,      17,     1,    500,     64 },
+            { L_,      -1,     1,      2,      1 },
+            { L_,       0,     1,   1000,   1000 },
+            { L_,       5,     0,   9999,  50000 },
+            { L_,     123,     0,     -1,   4096 },
+            { L_,       0,     3,    123,      7 },
+            { L_,     122,     3,      1,      7 },
+            { L_,     123,     3,      0,      7 },
+        };
+        const int NUM_DATA = sizeof DATA_TABLE / sizeof *DATA_TABLE;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE   = DATA_TABLE[ti].d_line;
+            const int OFFSET = DATA_TABLE[ti].d_offset
+                             + DATA_TABLE[ti].d_pages * PAGE;
+            const int LENGTH = -1 == DATA_TABLE[ti].d_length
+                             ? SIZE - OFFSET
+                             : bsl::min(DATA_TABLE[ti].d_length,
+                                        SIZE - OFFSET);
+            const int WINDOW = DATA_TABLE[ti].d_windowSize;
+
+            if (veryVerbose) { T_ P_(LINE) P_(OFFSET) P_(LENGTH) P(WINDOW) }
+
+            bslma::TestAllocator ta("test", veryVerbose);
+
+            Obj mX(WINDOW, &ta);  const Obj& X = mX;
+            ASSERTV(LINE, 0 == mX.open(fileName.c_str()));
+
+            bdlbb::Blob blob;
+            blob.appendDataBuffer(bdlbb::BlobBuffer(
+                           bsl::shared_ptr<char>(const_cast<char *>(
+                                                             PREFIX.c_str()),
+                                                 bslstl::SharedPtrNilDeleter(),
+                                                 &ta),
+                           static_cast<int>(PREFIX.length())));
+
+            ASSERTV(LINE, 0 == X.load(&blob, OFFSET, LENGTH));
+
+            const int NUM_WINDOWS = (LENGTH + WINDOW - 1) / WINDOW;
+            ASSERTV(LINE, blob.numDataBuffers(),
+                    1 + NUM_WINDOWS == blob.numDataBuffers());
+            ASSERTV(LINE, PREFIX + DATA.substr(OFFSET, LENGTH) ==
+                                                         blobContents(blob));
+
+            for (int i = 0; i < NUM_WINDOWS; ++i) {
+                const int EXP = i < NUM_WINDOWS - 1
+                              ? WINDOW
+                              : LENGTH - (NUM_WINDOWS - 1) * WINDOW;
+                ASSERTV(LINE, i, blob.buffer(1 + i).size(),
+                        EXP == blob.buffer(1 + i).size());
+            }
+            ASSERTV(LINE, blob.length() == blob.totalSize());
+        }
+
+        if (verbose) cout << "\nInvalid ranges." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bdlbb::Blob blob;
+
+            ASSERT(0 != X.load(&blob));
+            ASSERT(0 != X.load(&blob, 0, 1));
+            ASSERT(0 != X.load(&blob, 0, 0));
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+
+            ASSERT(0 != X.load(&blob, 0, SIZE + 1));
+            ASSERT(0 != X.load(&blob, SIZE, 1));
+            ASSERT(0 != X.load(&blob, SIZE + 1, 0));
+            ASSERT(0 != X.load(&blob, 1, SIZE));
+            ASSERT(0 == X.load(&blob, SIZE, 0));
+            ASSERT(0 == blob.length());
+            ASSERT(0 == blob.numBuffers());
+
+            // A blob whose length is near 'INT_MAX'.  The data of the buffer
+            // is never accessed.
+
+            char                  byte;
+            bsl::shared_ptr<char> fake(&byte, bslstl::SharedPtrNilDeleter());
+
+            blob.appendDataBuffer(bdlbb::BlobBuffer(fake, INT_MAX - 10));
+
+            ASSERT(0 != X.load(&blob, 0, 11));
+            ASSERT(0 == X.load(&blob, 0, 10));
+            ASSERT(INT_MAX == blob.length());
+            ASSERT(DATA.substr(0, 10) ==
+                            bsl::string(blob.buffer(1).data(),
+                                        blob.buffer(1).size()));
+        }
+
+        if (verbose) cout << "\nWhole file." << endl;
+        {
+            Obj mX(PAGE);  const Obj& X = mX;
+            ASSERT(0 == mX.open(fileName.c_str()));
+
+            bdlbb::Blob blob;
+            ASSERT(0 == X.load(&blob));
+            ASSERT(DATA == blobContents(blob));
+            ASSERT(4 == blob.numDataBuffers());
+
+            // Note that the file must not be truncated while it is mapped.
+
+            const bsl::string emptyFileName = fileName + ".empty";
+            writeFile(emptyFileName, "");
+            ASSERT(0 == mX.open(emptyFileName.c_str()));
+            ASSERT(0 == X.fileSize());
+            ASSERT(0 == X.load(&blob));
+            ASSERT(DATA == blobContents(blob));
+
+            FileUtil::remove(emptyFileName);
+        }
+
+        FileUtil::remove(fileName);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'open', 'close', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed loader has the default window size, and a
+        //:   loader constructed with a window size reports it.
+        //:
+        //: 2 A new loader has no open file, and a file size of 0.
+        //:
+        //: 3 'open' of an existing file succeeds and records its size; 'open'
+        //:   of a missing file fails and leaves no file open.
+        //:
+        //: 4 'open' closes any file held previously, and 'close' may be
+        //:   called on a loader having no open file.
+        //:
+        //: 5 No memory is allocated by construction, 'open', or 'close'.
+        //
+        // Plan:
+        //: 1 Construct loaders with and without a window size and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Open and close existing and missing files, verifying the
+        //:   accessors and the test allocators after each operation.
+        //:   (C-3..5)
+        //
+        // Testing:
+        //   explicit MappedFileBlobLoader(bslma::Allocator *ba = 0);
+        //   MappedFileBlobLoader(int windowSize, bslma::Allocator *ba = 0);
+        //   ~MappedFileBlobLoader();
+        //   void close();
+        //   int open(const char *path);
+        //   Offset fileSize() const;
+        //   bool isOpen() const;
+        //   int windowSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'open', 'close', AND BASIC ACCESSORS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        const bsl::string fileName = tempFileName(test);
+        const bsl::string missing  = fileName + ".missing";
+        writeFile(fileName, makeData(1234));
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_WINDOW_SIZE == X.windowSize());
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+        }
+        {
+            Obj mX(17, &ta);  const Obj& X = mX;
+            ASSERT(17 == X.windowSize());
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+            ASSERT(X.isOpen());
+            ASSERT(1234 == X.fileSize());
+
+            writeFile(missing, "abc");
+            ASSERT(0 == mX.open(missing.c_str()));
+            ASSERT(X.isOpen());
+            ASSERT(3 == X.fileSize());
+            FileUtil::remove(missing);
+
+            ASSERT(0 != mX.open(missing.c_str()));
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+            ASSERT(X.isOpen());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+            ASSERT(17 == X.windowSize());
+
+            ASSERT(0 == mX.open(fileName.c_str()));
+        }
+
+        ASSERT(0 == ta.numBlocksTotal());
+
+        FileUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Load a file into a blob and compare the contents of the blob
+        //:   with the file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+        writeFile(fileName, "hello, world");
+
+        Obj mX(5);  const Obj& X = mX;
+        ASSERT(0 == mX.open(fileName.c_str()));
+        ASSERT(12 == X.fileSize());
+
+        bdlbb::Blob blob;
+        ASSERT(0 == X.load(&blob));
+        ASSERT(3 == blob.numDataBuffers());
+        ASSERT("hello, world" == blobContents(blob));
+
+        ASSERT(0 == X.load(&blob, 7, 5));
+        ASSERT("hello, worldworld" == blobContents(blob));
+
+        mX.close();
+        FileUtil::remove(fileName);
+
+        ASSERT("hello, worldworld" == blobContents(blob));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
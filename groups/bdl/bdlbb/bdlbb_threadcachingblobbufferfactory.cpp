@@ -0,0 +1,344 @@
+// bdlbb_threadcachingblobbufferfactory.cpp                           -*-C++-*-
+#include <bdlbb_threadcachingblobbufferfactory.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_threadcachingblobbufferfactory_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                 // ========================================
+                 // class ThreadCachingBlobBufferFactory_Rep
+                 // ========================================
+
+class ThreadCachingBlobBufferFactory_Rep : public bslma::SharedPtrRep {
+    // This component-private class provides the shared-pointer representation
+    // stored at the start of each memory block dispensed by a
+    // 'ThreadCachingBlobBufferFactory'; the buffer data follows it in the same
+    // block.  When all references to the buffer are released, the
+    // representation returns the block to its factory.  Objects of this type
+    // are never destroyed; their memory is released with the pool of the
+    // factory.
+
+    // DATA
+    ThreadCachingBlobBufferFactory     *d_factory_p;  // owning factory
+
+  public:
+    // PUBLIC DATA
+    ThreadCachingBlobBufferFactory_Rep *d_next_p;     // next block in a
+                                                      // thread's cache
+
+    // CLASS DATA
+    static const int k_HEADER_SIZE;   // offset of the buffer data within a
+                                      // block
+
+    // CREATORS
+    explicit
+    ThreadCachingBlobBufferFactory_Rep(
+                                    ThreadCachingBlobBufferFactory *factory);
+        // Create a representation, having one shared reference, of a buffer
+        // owned by the specified 'factory'.
+
+    // MANIPULATORS
+    void disposeObject() BSLS_KEYWORD_OVERRIDE;
+        // Do nothing.  The buffer data requires no destruction.
+
+    void disposeRep() BSLS_KEYWORD_OVERRIDE;
+        // Return this block to the factory that dispensed it.
+
+    void *getDeleter(const std::type_info& type) BSLS_KEYWORD_OVERRIDE;
+        // Return 0.  Buffers dispensed by a factory have no deleter.
+
+    // ACCESSORS
+    char *data() const;
+        // Return the address of the buffer data held by this block.
+
+    void *originalPtr() const BSLS_KEYWORD_OVERRIDE;
+        // Return the address of the buffer data held by this block.
+};
+
+                // ==========================================
+                // struct ThreadCachingBlobBufferFactory_Cache
+                // ==========================================
+
+struct ThreadCachingBlobBufferFactory_Cache {
+    // This component-private 'struct' holds the buffers cached by one thread
+    // for one 'ThreadCachingBlobBufferFactory'.  Only 'd_prev_p' and
+    // 'd_next_p' are accessed by threads other than the owning thread, under
+    // the mutex of the factory.
+
+    // PUBLIC DATA
+    ThreadCachingBlobBufferFactory       *d_factory_p;   // owning factory
+
+    ThreadCachingBlobBufferFactory_Rep   *d_head_p;      // cached blocks
+
+    int                                   d_numBuffers;  // length of
+                                                         // 'd_head_p' list
+
+    ThreadCachingBlobBufferFactory_Cache *d_prev_p;      // previous and next
+    ThreadCachingBlobBufferFactory_Cache *d_next_p;      // caches of the
+                                                         // factory
+};
+
+                 // ----------------------------------------
+                 // class ThreadCachingBlobBufferFactory_Rep
+                 // ----------------------------------------
+
+// CLASS DATA
+const int ThreadCachingBlobBufferFactory_Rep::k_HEADER_SIZE =
+      static_cast<int>((sizeof(ThreadCachingBlobBufferFactory_Rep)
+                        + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                       & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1));
+
+// CREATORS
+ThreadCachingBlobBufferFactory_Rep::ThreadCachingBlobBufferFactory_Rep(
+                                       ThreadCachingBlobBufferFactory *factory)
+: d_factory_p(factory)
+, d_next_p(0)
+{
+}
+
+// MANIPULATORS
+void ThreadCachingBlobBufferFactory_Rep::disposeObject()
+{
+}
+
+void ThreadCachingBlobBufferFactory_Rep::disposeRep()
+{
+    d_factory_p->releaseBuffer(this);
+}
+
+void *ThreadCachingBlobBufferFactory_Rep::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+// ACCESSORS
+char *ThreadCachingBlobBufferFactory_Rep::data() const
+{
+    return const_cast<char *>(reinterpret_cast<const char *>(this))
+                                                               + k_HEADER_SIZE;
+}
+
+void *ThreadCachingBlobBufferFactory_Rep::originalPtr() const
+{
+    return data();
+}
+
+                    // ------------------------------------
+                    // class ThreadCachingBlobBufferFactory
+                    // ------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingBlobBufferFactory::destroyCache(void *cache)
+{
+    Cache                          *c       = static_cast<Cache *>(cache);
+    ThreadCachingBlobBufferFactory *factory = c->d_factory_p;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&factory->d_mutex);
+
+        while (c->d_head_p) {
+            Rep *rep    = c->d_head_p;
+            c->d_head_p = rep->d_next_p;
+            factory->d_pool.deallocate(rep);
+        }
+
+        if (c->d_prev_p) {
+            c->d_prev_p->d_next_p = c->d_next_p;
+        }
+        else {
+            factory->d_caches_p = c->d_next_p;
+        }
+        if (c->d_next_p) {
+            c->d_next_p->d_prev_p = c->d_prev_p;
+        }
+    }
+
+    factory->d_allocator_p->deallocate(c);
+}
+
+// PRIVATE MANIPULATORS
+ThreadCachingBlobBufferFactory::Cache *
+ThreadCachingBlobBufferFactory::threadCache()
+{
+    if (!d_hasKey) {
+        return 0;                                                     // RETURN
+    }
+
+    Cache *cache = static_cast<Cache *>(bslmt::ThreadUtil::getSpecific(d_key));
+    if (cache) {
+        return cache;                                                 // RETURN
+    }
+
+    cache = static_cast<Cache *>(d_allocator_p->allocate(sizeof(Cache)));
+    cache->d_factory_p  = this;
+    cache->d_head_p     = 0;
+    cache->d_numBuffers = 0;
+    cache->d_prev_p     = 0;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        cache->d_next_p = d_caches_p;
+        if (d_caches_p) {
+            d_caches_p->d_prev_p = cache;
+        }
+        d_caches_p = cache;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        destroyCache(cache);
+        return 0;                                                     // RETURN
+    }
+
+    return cache;
+}
+
+void ThreadCachingBlobBufferFactory::releaseBuffer(Rep *rep)
+{
+    // This function is invoked from 'disposeRep', which must not throw;
+    // therefore, only an existing cache is used, and a cache is never created
+    // here.
+
+    Cache *cache = d_hasKey
+                 ? static_cast<Cache *>(bslmt::ThreadUtil::getSpecific(d_key))
+                 : 0;
+
+    if (cache && cache->d_numBuffers < d_maxCachedBuffers) {
+        rep->d_next_p   = cache->d_head_p;
+        cache->d_head_p = rep;
+        ++cache->d_numBuffers;
+    }
+    else {
+        d_pool.deallocate(rep);
+    }
+}
+
+// CREATORS
+ThreadCachingBlobBufferFactory::ThreadCachingBlobBufferFactory(
+                                              int               bufferSize,
+                                              bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxCachedBuffers(k_DEFAULT_MAX_CACHED_BUFFERS)
+, d_pool(Rep::k_HEADER_SIZE + bufferSize, basicAllocator)
+, d_key()
+, d_hasKey(false)
+, d_mutex()
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(&d_key, &destroyCache);
+}
+
+ThreadCachingBlobBufferFactory::ThreadCachingBlobBufferFactory(
+                                            int               bufferSize,
+                                            int               maxCachedBuffers,
+                                            bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxCachedBuffers(maxCachedBuffers)
+, d_pool(Rep::k_HEADER_SIZE + bufferSize, basicAllocator)
+, d_key()
+, d_hasKey(false)
+, d_mutex()
+, d_caches_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+    BSLS_ASSERT(0 <= maxCachedBuffers);
+
+    if (0 < maxCachedBuffers) {
+        d_hasKey = 0 == bslmt::ThreadUtil::createKey(&d_key, &destroyCache);
+    }
+}
+
+ThreadCachingBlobBufferFactory::~ThreadCachingBlobBufferFactory()
+{
+    // Deleting the key prevents 'destroyCache' from being invoked for the
+    // caches of threads that exit later.  The cached blocks themselves are
+    // released with 'd_pool'.
+
+    if (d_hasKey) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_caches_p) {
+        Cache *cache = d_caches_p;
+        d_caches_p   = cache->d_next_p;
+        d_allocator_p->deallocate(cache);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachingBlobBufferFactory::allocate(BlobBuffer *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    // Note that the cache of the calling thread is created here, and not by
+    // 'releaseBuffer', which must not allocate memory.
+
+    Cache *cache = threadCache();
+    Rep   *rep;
+
+    if (cache && cache->d_head_p) {
+        rep             = cache->d_head_p;
+        cache->d_head_p = rep->d_next_p;
+        --cache->d_numBuffers;
+
+        rep->resetCountsRaw(1, 0);
+    }
+    else {
+        rep = new (d_pool.allocate()) Rep(this);
+    }
+
+    bsl::shared_ptr<char> handle(rep->data(),
+                                 static_cast<bslma::SharedPtrRep *>(rep));
+    buffer->buffer().swap(handle);
+    buffer->setSize(d_bufferSize);
+}
+
+// ACCESSORS
+int ThreadCachingBlobBufferFactory::numCachedBuffers() const
+{
+    if (!d_hasKey) {
+        return 0;                                                     // RETURN
+    }
+
+    const Cache *cache = static_cast<const Cache *>(
+                                      bslmt::ThreadUtil::getSpecific(d_key));
+    return cache ? cache->d_numBuffers : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,277 @@
+// bdlbb_threadcachingblobbufferfactory.h                             -*-C++-*-
+#ifndef INCLUDED_BDLBB_THREADCACHINGBLOBBUFFERFACTORY
+#define INCLUDED_BDLBB_THREADCACHINGBLOBBUFFERFACTORY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a blob buffer factory with per-thread buffer caches.
+//
+//@CLASSES:
+//  bdlbb::ThreadCachingBlobBufferFactory: factory caching buffers per thread
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_pooledblobbufferfactory
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlbb::ThreadCachingBlobBufferFactory', that implements the
+// 'bdlbb::BlobBufferFactory' protocol for high allocation rates from many
+// threads.  Like 'bdlbb::PooledBlobBufferFactory', it dispenses buffers of a
+// fixed size specified at construction from a pool of memory blocks.  Unlike
+// that factory:
+//
+//: o Each memory block holds, ahead of the buffer data, a shared-pointer
+//:   representation object whose reference counts are the only per-buffer
+//:   bookkeeping: no separate allocation and no deleter object are needed, and
+//:   a released buffer is recycled with its representation intact.
+//:
+//: o When the last reference to a buffer is released, the buffer is returned
+//:   to a cache owned by the *releasing* thread rather than to the shared
+//:   pool, and 'allocate' takes buffers from the cache of the *calling* thread
+//:   before resorting to the shared pool.  In the steady state of a thread
+//:   that repeatedly allocates and releases buffers, neither operation touches
+//:   memory shared with other threads, other than the reference count of the
+//:   buffer itself.  A thread's cache is created by its first call to
+//:   'allocate'; buffers released by a thread that has never allocated from
+//:   the factory are returned to the shared pool.
+//
+// The number of buffers cached by each thread is limited by a value specified
+// at construction; buffers released by a thread whose cache is full are
+// returned to the shared pool.  When a thread exits, the buffers in its cache
+// are returned to the shared pool.
+//
+// Each factory uses one key of the operating system's thread-specific storage,
+// which is a limited resource; a program should therefore create a small,
+// fixed number of these factories (typically one per buffer size) rather than
+// one per connection or session.  If no key is available, the factory operates
+// correctly, but without per-thread caches.
+//
+///Thread Safety
+///-------------
+// 'bdlbb::ThreadCachingBlobBufferFactory' is fully thread-safe, meaning that
+// 'allocate' may be called concurrently from multiple threads, and that
+// buffers may be released by any thread.  As for
+// 'bdlbb::PooledBlobBufferFactory', destroying the factory releases the memory
+// of every buffer it has allocated; the behavior is undefined if any such
+// buffer is referenced after the factory is destroyed, or if a thread that has
+// used the factory exits concurrently with its destruction.  Note that a
+// thread that has called 'allocate' is considered to be using the factory
+// until that thread exits, because its cache is released on exit.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Buffers for a Message
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the network layer of an application assembles each incoming
+// message in a blob, and releases the blob once the message is processed.
+//
+// First, we create a factory shared by all of the threads of the network
+// layer, caching up to 32 buffers of 1024 bytes per thread:
+//..
+//  bdlbb::ThreadCachingBlobBufferFactory factory(1024, 32);
+//  assert(1024 == factory.bufferSize());
+//  assert(  32 == factory.maxCachedBuffers());
+//..
+// Then, we use the factory to supply the buffers of a blob, and observe that
+// the buffers are cached by this thread when the blob is destroyed:
+//..
+//  const char *data[3];
+//  {
+//      bdlbb::Blob blob(&factory);
+//      blob.setLength(3000);
+//      assert(3 == blob.numDataBuffers());
+//
+//      for (int i = 0; i < 3; ++i) {
+//          data[i] = blob.buffer(i).data();
+//      }
+//  }
+//  assert(3 == factory.numCachedBuffers());
+//..
+// Finally, we observe that the next blob created by this thread reuses the
+// cached buffers:
+//..
+//  bdlbb::Blob blob(&factory);
+//  blob.setLength(3000);
+//  assert(0 == factory.numCachedBuffers());
+//
+//  for (int i = 0; i < 3; ++i) {
+//      const char *buffer = blob.buffer(i).data();
+//      assert(data[0] == buffer || data[1] == buffer || data[2] == buffer);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+class ThreadCachingBlobBufferFactory_Rep;
+struct ThreadCachingBlobBufferFactory_Cache;
+
+                    // ====================================
+                    // class ThreadCachingBlobBufferFactory
+                    // ====================================
+
+class ThreadCachingBlobBufferFactory : public BlobBufferFactory {
+    // This class implements the 'BlobBufferFactory' protocol and provides a
+    // mechanism for allocating 'BlobBuffer' objects of a fixed size passed at
+    // construction, caching released buffers in the thread that releases
+    // them.
+
+    // PRIVATE TYPES
+    typedef ThreadCachingBlobBufferFactory_Rep   Rep;
+    typedef ThreadCachingBlobBufferFactory_Cache Cache;
+
+    // DATA
+    int                     d_bufferSize;        // size of allocated buffers
+
+    int                     d_maxCachedBuffers;  // maximum number of buffers
+                                                 // cached by each thread
+
+    bdlma::ConcurrentPool   d_pool;              // shared pool of blocks,
+                                                 // each holding a 'Rep' and
+                                                 // the buffer data
+
+    bslmt::ThreadUtil::Key  d_key;               // key of each thread's
+                                                 // cache
+
+    bool                    d_hasKey;            // 'true' if 'd_key' was
+                                                 // created successfully
+
+    bslmt::Mutex            d_mutex;             // guards 'd_caches_p'
+
+    Cache                  *d_caches_p;          // list of the caches of all
+                                                 // threads
+
+    bslma::Allocator       *d_allocator_p;       // memory allocator (held)
+
+    // FRIENDS
+    friend class ThreadCachingBlobBufferFactory_Rep;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingBlobBufferFactory(const ThreadCachingBlobBufferFactory&);
+    ThreadCachingBlobBufferFactory& operator=(
+                                        const ThreadCachingBlobBufferFactory&);
+
+  private:
+    // PRIVATE CLASS METHODS
+    static void destroyCache(void *cache);
+        // Return the buffers held by the specified 'cache' to the shared pool
+        // of the factory that owns it, and destroy 'cache'.  This function is
+        // invoked by the operating system when a thread having a cache exits.
+
+    // PRIVATE MANIPULATORS
+    Cache *threadCache();
+        // Return the cache of the calling thread, creating it if necessary,
+        // or 0 if the cache does not exist and cannot be created.  Note that
+        // this function is invoked only by 'allocate'.
+
+    void releaseBuffer(Rep *rep);
+        // Return the buffer having the specified 'rep' to the cache of the
+        // calling thread, or to the shared pool if that cache is full or
+        // does not exist.  This function is invoked when the last reference
+        // to the buffer is released, and never allocates memory.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_MAX_CACHED_BUFFERS = 64  // default maximum number of
+                                           // buffers cached by each thread
+    };
+
+    // CREATORS
+    explicit
+    ThreadCachingBlobBufferFactory(int               bufferSize,
+                                   bslma::Allocator *basicAllocator = 0);
+    ThreadCachingBlobBufferFactory(int               bufferSize,
+                                   int               maxCachedBuffers,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create a factory for allocating 'BlobBuffer' objects of the
+        // specified 'bufferSize'.  Optionally specify 'maxCachedBuffers', the
+        // maximum number of released buffers cached by each thread.  If
+        // 'maxCachedBuffers' is not specified, 'k_DEFAULT_MAX_CACHED_BUFFERS'
+        // is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < bufferSize' and '0 <= maxCachedBuffers'.  Note that a
+        // 'maxCachedBuffers' of 0 disables the per-thread caches.
+
+    ~ThreadCachingBlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this factory.  This operation releases all 'BlobBuffer'
+        // objects allocated via this factory.
+
+    // MANIPULATORS
+    void allocate(BlobBuffer *buffer) BSLS_KEYWORD_OVERRIDE;
+        // Allocate a new buffer with the buffer size specified at construction
+        // and load it into the specified 'buffer'.  The buffer is taken from
+        // the cache of the calling thread if that cache is not empty, and
+        // from the shared pool otherwise.  The cache of the calling thread is
+        // created, if possible, by its first call to this method.  Note that
+        // destruction of this factory releases all 'BlobBuffer' objects
+        // allocated via this factory.
+
+    // ACCESSORS
+    int bufferSize() const;
+        // Return the buffer size specified at construction of this factory.
+
+    int maxCachedBuffers() const;
+        // Return the maximum number of buffers cached by each thread.
+
+    int numCachedBuffers() const;
+        // Return the number of buffers in the cache of the calling thread.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // ------------------------------------
+                    // class ThreadCachingBlobBufferFactory
+                    // ------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+int ThreadCachingBlobBufferFactory::maxCachedBuffers() const
+{
+    return d_maxCachedBuffers;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,751 @@
+// bdlbb_threadcachingblobbufferfactory.t.cpp                         -*-C++-*-
+#include <bdlbb_threadcachingblobbufferfactory.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a blob buffer factory that caches released
+// buffers in the releasing thread.  We verify that allocated buffers have the
+// requested size, are distinct, writable, and maximally aligned; that a
+// buffer released by a thread is reused by the next allocation in that thread
+// (and not before all references, including weak references, are released);
+// that the per-thread cache is bounded; that buffers cached by a thread are
+// returned to the factory when the thread exits; and that concurrent
+// allocation and cross-thread release do not corrupt buffers.  A test
+// allocator verifies that all memory is released by the destructor.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingBlobBufferFactory(int, Allocator *);
+// [ 2] ThreadCachingBlobBufferFactory(int, int, Allocator *);
+// [ 2] ~ThreadCachingBlobBufferFactory();
+//
+// MANIPULATORS
+// [ 2] void allocate(BlobBuffer *buffer);
+//
+// ACCESSORS
+// [ 2] int bufferSize() const;
+// [ 2] int maxCachedBuffers() const;
+// [ 3] int numCachedBuffers() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] PER-THREAD CACHING
+// [ 4] CONCURRENT ALLOCATION AND RELEASE
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::ThreadCachingBlobBufferFactory Obj;
+
+// ============================================================================
+//                          GLOBAL HELPER CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct CountCachedBuffers {
+    // This functor loads, into a result, the number of buffers cached by the
+    // calling thread after releasing a set of buffers, optionally allocating
+    // a buffer first.
+
+    Obj                            *d_factory_p;
+    bsl::vector<bdlbb::BlobBuffer> *d_buffers_p;
+    bool                            d_allocateFirst;
+    int                            *d_result_p;
+
+    void operator()() const
+        // Allocate a buffer if 'd_allocateFirst' is 'true', then release the
+        // buffers and record the number of cached buffers.
+    {
+        bdlbb::BlobBuffer buffer;
+        if (d_allocateFirst) {
+            d_factory_p->allocate(&buffer);
+        }
+        d_buffers_p->clear();
+        *d_result_p = d_factory_p->numCachedBuffers();
+    }
+};
+
+struct ReleaseAndReallocate {
+    // This functor releases a buffer allocated by another thread, then
+    // allocates a buffer and records its address.
+
+    Obj               *d_factory_p;
+    bdlbb::BlobBuffer *d_buffer_p;
+    const char       **d_reallocated_p;
+
+    void operator()() const
+        // Allocate a buffer to create the cache of the calling thread, then
+        // release and reallocate.
+    {
+        bdlbb::BlobBuffer first;
+        d_factory_p->allocate(&first);
+
+        d_buffer_p->reset();
+
+        bdlbb::BlobBuffer buffer;
+        d_factory_p->allocate(&buffer);
+        *d_reallocated_p = buffer.data();
+    }
+};
+
+struct Worker {
+    // This functor repeatedly allocates buffers, fills them with a pattern
+    // unique to the thread, hands one of them to a neighbouring thread
+    // through a shared slot array, and verifies the contents of the buffers
+    // it holds before releasing them.
+
+    Obj                            *d_factory_p;
+    bslmt::Barrier                 *d_barrier_p;
+    bsl::vector<bdlbb::BlobBuffer> *d_slots_p;   // one slot per thread
+    int                             d_id;
+    int                             d_numThreads;
+    int                             d_numIterations;
+    int                            *d_numErrors_p;
+
+    void operator()() const
+        // Run the worker.
+    {
+        const int  size    = d_factory_p->bufferSize();
+        const char pattern = static_cast<char>('A' + d_id);
+        int        errors  = 0;
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            bsl::vector<bdlbb::BlobBuffer> local(8);
+            for (bsl::size_t j = 0; j < local.size(); ++j) {
+                d_factory_p->allocate(&local[j]);
+                bsl::memset(local[j].data(), pattern, size);
+            }
+
+            // Publish one buffer for the next thread, and wait for all
+            // threads to do the same.
+
+            (*d_slots_p)[d_id] = local[0];
+            d_barrier_p->wait();
+
+            // Take the buffer published by the previous thread.
+
+            const int         from = (d_id + d_numThreads - 1) % d_numThreads;
+            bdlbb::BlobBuffer received = (*d_slots_p)[from];
+            d_barrier_p->wait();
+
+            (*d_slots_p)[d_id].reset();
+
+            const char expected = static_cast<char>('A' + from);
+            for (int k = 0; k < size; ++k) {
+                if (expected != received.data()[k]) {
+                    ++errors;
+                    break;
+                }
+            }
+            for (bsl::size_t j = 1; j < local.size(); ++j) {
+                for (int k = 0; k < size; ++k) {
+                    if (pattern != local[j].data()[k]) {
+                        ++errors;
+                        break;
+                    }
+                }
+            }
+
+            d_barrier_p->wait();
+        }
+
+        *d_numErrors_p = errors;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Buffers for a Message
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the network layer of an application assembles each incoming
+// message in a blob, and releases the blob once the message is processed.
+//
+// First, we create a factory shared by all of the threads of the network
+// layer, caching up to 32 buffers of 1024 bytes per thread:
+//..
+    bdlbb::ThreadCachingBlobBufferFactory factory(1024, 32);
+    ASSERT(1024 == factory.bufferSize());
+    ASSERT(  32 == factory.maxCachedBuffers());
+//..
+// Then, we use the factory to supply the buffers of a blob, and observe that
+// the buffers are cached by this thread when the blob is destroyed:
+//..
+    const char *data[3];
+    {
+        bdlbb::Blob blob(&factory);
+        blob.setLength(3000);
+        ASSERT(3 == blob.numDataBuffers());
+
+        for (int i = 0; i < 3; ++i) {
+            data[i] = blob.buffer(i).data();
+        }
+    }
+    ASSERT(3 == factory.numCachedBuffers());
+//..
+// Finally, we observe that the next blob created by this thread reuses the
+// cached buffers:
+//..
+    bdlbb::Blob blob(&factory);
+    blob.setLength(3000);
+    ASSERT(0 == factory.numCachedBuffers());
+
+    for (int i = 0; i < 3; ++i) {
+        const char *buffer = blob.buffer(i).data();
+        ASSERT(data[0] == buffer || data[1] == buffer || data[2] == buffer);
+    }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ALLOCATION AND RELEASE
+        //
+        // Concerns:
+        //: 1 Buffers allocated concurrently by several threads are distinct.
+        //:
+        //: 2 Buffers released by a thread other than the allocating thread
+        //:   are safely recycled.
+        //:
+        //: 3 Buffers cached by threads that have exited are released by the
+        //:   destructor of the factory, and nothing is leaked.
+        //
+        // Plan:
+        //: 1 Run several threads that each allocate buffers, fill them with
+        //:   a thread-specific pattern, exchange one buffer per iteration
+        //:   with a neighbouring thread, and verify the pattern of every
+        //:   buffer before releasing it.  Use a small cache so that buffers
+        //:   move between the caches and the shared pool.  (C-1..2)
+        //:
+        //: 2 Supply a test allocator and verify that no memory is in use
+        //:   after the factory is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT ALLOCATION AND RELEASE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT ALLOCATION AND RELEASE"
+                          << endl << "================================="
+                          << endl;
+
+        const int NUM_THREADS    = 4;
+        const int NUM_ITERATIONS = 2000;
+
+        bslma::TestAllocator ta("factory", veryVerbose);
+        {
+            Obj mX(128, 4, &ta);
+
+            bslmt::Barrier                 barrier(NUM_THREADS);
+            bsl::vector<bdlbb::BlobBuffer> slots(NUM_THREADS);
+            int                            numErrors[NUM_THREADS];
+
+            bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                Worker worker = { &mX,
+                                  &barrier,
+                                  &slots,
+                                  i,
+                                  NUM_THREADS,
+                                  NUM_ITERATIONS,
+                                  &numErrors[i] };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], worker));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(i, numErrors[i], 0 == numErrors[i]);
+            }
+
+            // The caches of the exited threads have been returned, so only
+            // the shared pool holds memory.
+
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PER-THREAD CACHING
+        //
+        // Concerns:
+        //: 1 A buffer is returned to the cache of the releasing thread only
+        //:   when its last reference, shared or weak, is released.
+        //:
+        //: 2 The next allocation in that thread reuses the most recently
+        //:   cached buffer.
+        //:
+        //: 3 At most 'maxCachedBuffers()' buffers are cached by a thread;
+        //:   further released buffers are returned to the shared pool.
+        //:
+        //: 4 A 'maxCachedBuffers' of 0 disables caching.
+        //:
+        //: 5 A buffer allocated by one thread and released by another is
+        //:   cached by the releasing thread if that thread has allocated from
+        //:   the factory, and reused by that thread; otherwise, it is returned
+        //:   to the shared pool.
+        //:
+        //: 6 A thread's cache is not visible to other threads, and is
+        //:   released when the thread exits.
+        //
+        // Plan:
+        //: 1 Allocate and release buffers in the main thread, holding copies
+        //:   and weak pointers, and observe 'numCachedBuffers' and the
+        //:   addresses of reallocated buffers.  (C-1..4)
+        //:
+        //: 2 Release buffers in a second thread and observe the caches of
+        //:   both threads, and the memory in use after the second thread
+        //:   exits.  (C-5..6)
+        //
+        // Testing:
+        //   int numCachedBuffers() const;
+        //   PER-THREAD CACHING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PER-THREAD CACHING" << endl
+                                  << "==================" << endl;
+
+        bslma::TestAllocator ta("factory", veryVerbose);
+
+        if (verbose) cout << "\tTesting reuse in the releasing thread."
+                          << endl;
+        {
+            Obj mX(64, 3, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.numCachedBuffers());
+
+            bdlbb::BlobBuffer a;
+            mX.allocate(&a);
+            const char *A = a.data();
+
+            bdlbb::BlobBuffer copy(a);
+            a.reset();
+            ASSERT(0 == X.numCachedBuffers());
+
+            bsl::weak_ptr<char> weak(copy.buffer());
+            copy.reset();
+            ASSERT(0 == X.numCachedBuffers());
+            ASSERT(weak.expired());
+
+            weak.reset();
+            ASSERT(1 == X.numCachedBuffers());
+
+            bdlbb::BlobBuffer b;
+            mX.allocate(&b);
+            ASSERT(A == b.data());
+            ASSERT(0 == X.numCachedBuffers());
+            ASSERT(1 == b.buffer().use_count());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting the cache limit." << endl;
+        {
+            Obj mX(64, 3, &ta);  const Obj& X = mX;
+
+            bsl::vector<bdlbb::BlobBuffer> buffers(5);
+            const char                    *ADDRESS[5];
+            for (int i = 0; i < 5; ++i) {
+                mX.allocate(&buffers[i]);
+                ADDRESS[i] = buffers[i].data();
+            }
+
+            const bsls::Types::Int64 IN_USE = ta.numBlocksInUse();
+
+            for (int i = 0; i < 5; ++i) {
+                buffers[i].reset();
+                ASSERTV(i, X.numCachedBuffers(),
+                        bsl::min(i + 1, 3) == X.numCachedBuffers());
+            }
+
+            // Buffers beyond the limit were returned to the shared pool,
+            // which does not return memory to the allocator; releasing
+            // buffers allocates no memory, the cache of this thread having
+            // been created by its first call to 'allocate'.
+
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE == ta.numBlocksInUse());
+
+            // The cache is last-in, first-out: buffers 0, 1, and 2 were
+            // cached, in that order.
+
+            for (int i = 2; i >= 0; --i) {
+                bdlbb::BlobBuffer b;
+                mX.allocate(&b);
+                ASSERTV(i, ADDRESS[i] == b.data());
+                ASSERTV(i, i == X.numCachedBuffers());
+                buffers[i] = b;
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting a disabled cache." << endl;
+        {
+            Obj mX(64, 0, &ta);  const Obj& X = mX;
+            ASSERT(0 == X.maxCachedBuffers());
+
+            for (int i = 0; i < 10; ++i) {
+                bdlbb::BlobBuffer b;
+                mX.allocate(&b);
+                bsl::memset(b.data(), i, 64);
+            }
+            ASSERT(0 == X.numCachedBuffers());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting release by another thread." << endl;
+        {
+            Obj mX(64, 8, &ta);  const Obj& X = mX;
+
+            bsl::vector<bdlbb::BlobBuffer> buffers(4);
+            for (int i = 0; i < 4; ++i) {
+                mX.allocate(&buffers[i]);
+            }
+            bsl::vector<bdlbb::BlobBuffer> single(1);
+            mX.allocate(&single[0]);
+
+            // A thread that has never allocated from the factory has no cache,
+            // and returns released buffers to the shared pool.
+
+            int                numCached = -1;
+            CountCachedBuffers releaseOnly = {
+                                           &mX, &single, false, &numCached };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, releaseOnly));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(numCached, 0 == numCached);
+            ASSERT(0 == X.numCachedBuffers());
+
+            const bsls::Types::Int64 IN_USE = ta.numBlocksInUse();
+
+            numCached                = -1;
+            CountCachedBuffers count = { &mX, &buffers, true, &numCached };
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, count));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // The other thread, having allocated the buffer released to the
+            // shared pool above, cached all four buffers; the cache of the
+            // main thread is unaffected, and the other thread's cache was
+            // released when it exited.
+
+            ASSERTV(numCached, 4 == numCached);
+            ASSERT(0 == X.numCachedBuffers());
+            ASSERTV(IN_USE, ta.numBlocksInUse(),
+                    IN_USE == ta.numBlocksInUse());
+
+            // A buffer released by another thread is reused by that thread.
+
+            bdlbb::BlobBuffer    buffer;
+            mX.allocate(&buffer);
+            const char          *ORIGINAL    = buffer.data();
+            const char          *reallocated = 0;
+            ReleaseAndReallocate release     = { &mX, &buffer, &reallocated };
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, release));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(ORIGINAL == reallocated);
+            ASSERT(0 == X.numCachedBuffers());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'allocate', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors record the buffer size and cache limit, using
+        //:   the default cache limit if none is specified.
+        //:
+        //: 2 Allocated buffers have the requested size, are distinct,
+        //:   writable over their entire size, and maximally aligned.
+        //:
+        //: 3 'allocate' releases any buffer previously held by its argument.
+        //:
+        //: 4 Memory is supplied by the specified allocator, or the default
+        //:   allocator if none is specified, and is released by the
+        //:   destructor.
+        //
+        // Plan:
+        //: 1 Create factories with a table of buffer sizes and cache limits,
+        //:   allocate several buffers from each, and verify their
+        //:   properties.  (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default and supply another, and
+        //:   verify the memory in use.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingBlobBufferFactory(int, Allocator *);
+        //   ThreadCachingBlobBufferFactory(int, int, Allocator *);
+        //   ~ThreadCachingBlobBufferFactory();
+        //   void allocate(BlobBuffer *buffer);
+        //   int bufferSize() const;
+        //   int maxCachedBuffers() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS, 'allocate', AND ACCESSORS"
+                          << endl << "==================================="
+                          << endl;
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;
+            int d_maxCached;   // -1 for the default
+        } DATA[] = {
+            //LINE  SIZE   MAX
+            //----  -----  ---
+            { L_,       1,  -1 },
+            { L_,       1,   0 },
+            { L_,       7,   1 },
+            { L_,      64,  -1 },
+            { L_,     100,  10 },
+            { L_,    4096,   2 },
+            { L_,   65536,  -1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int SIZE = DATA[ti].d_bufferSize;
+            const int MAX  = DATA[ti].d_maxCached;
+            const int EXP_MAX = 0 > MAX ? Obj::k_DEFAULT_MAX_CACHED_BUFFERS
+                                        : MAX;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SIZE) P(MAX) }
+
+            bslma::TestAllocator da("default", veryVerbose);
+            bslma::TestAllocator sa("supplied", veryVerbose);
+            bslma::TestAllocator scratch("scratch", veryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            for (int ai = 0; ai < 2; ++ai) {
+                bslma::TestAllocator& ua = ai ? sa : da;
+                bslma::TestAllocator& oa = ai ? da : sa;
+
+                const bsls::Types::Int64 OTHER_TOTAL = oa.numBlocksTotal();
+
+                {
+                    bsl::unique_ptr<Obj> mX;
+                    if (0 > MAX) {
+                        mX.reset(ai ? new Obj(SIZE, &sa) : new Obj(SIZE));
+                    }
+                    else {
+                        mX.reset(ai ? new Obj(SIZE, MAX, &sa)
+                                    : new Obj(SIZE, MAX));
+                    }
+                    const Obj& X = *mX;
+
+                    ASSERTV(LINE, SIZE    == X.bufferSize());
+                    ASSERTV(LINE, EXP_MAX == X.maxCachedBuffers());
+
+                    bsl::vector<bdlbb::BlobBuffer> buffers(&scratch);
+                    bsl::set<const char *>         addresses(&scratch);
+                    buffers.resize(10);
+                    for (int i = 0; i < 10; ++i) {
+                        mX->allocate(&buffers[i]);
+
+                        bdlbb::BlobBuffer& b = buffers[i];
+                        ASSERTV(LINE, i, SIZE == b.size());
+                        ASSERTV(LINE, i, 0 ==
+                                 reinterpret_cast<bsls::Types::UintPtr>(
+                                                                  b.data()) %
+                                      bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+                        bsl::memset(b.data(), i, SIZE);
+                        addresses.insert(b.data());
+                    }
+                    ASSERTV(LINE, 10 == addresses.size());
+                    for (int i = 0; i < 10; ++i) {
+                        ASSERTV(LINE, i,
+                                static_cast<char>(i) == buffers[i].data()[0]);
+                        ASSERTV(LINE, i,
+                                static_cast<char>(i) ==
+                                              buffers[i].data()[SIZE - 1]);
+                    }
+
+                    ASSERTV(LINE, ai, 0 < ua.numBlocksInUse());
+
+                    // Reallocating into a held buffer releases the held
+                    // buffer.
+
+                    bsl::weak_ptr<char> weak(buffers[0].buffer());
+                    mX->allocate(&buffers[0]);
+                    ASSERTV(LINE, weak.expired());
+                    ASSERTV(LINE, SIZE == buffers[0].size());
+                }
+
+                ASSERTV(LINE, ai, 0 == ua.numBlocksInUse());
+                ASSERTV(LINE, ai, OTHER_TOTAL == oa.numBlocksTotal());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate buffers for a blob, release them, and allocate again.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("factory", veryVerbose);
+        {
+            Obj mX(16, &ta);  const Obj& X = mX;
+            ASSERT(16 == X.bufferSize());
+            ASSERT(Obj::k_DEFAULT_MAX_CACHED_BUFFERS == X.maxCachedBuffers());
+
+            {
+                bdlbb::Blob blob(&mX);
+                blob.setLength(40);
+                ASSERT(3 == blob.numDataBuffers());
+                ASSERT(48 == blob.totalSize());
+            }
+            ASSERT(3 == X.numCachedBuffers());
+
+            bdlbb::Blob blob(&mX);
+            blob.setLength(20);
+            ASSERT(1 == X.numCachedBuffers());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
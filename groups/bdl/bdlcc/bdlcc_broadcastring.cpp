@@ -0,0 +1,54 @@
+// bdlcc_broadcastring.cpp                                            -*-C++-*-
+#include <bdlcc_broadcastring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_broadcastring_cpp,"$Id$$CSID$")
+
+///Implementation Notes
+///====================
+// The ring holds 'capacity()' slots, a power of two, and each value pushed is
+// identified by a 64-bit sequence number (which never wraps in practice); the
+// value of sequence number 's' is stored in slot 's & (capacity() - 1)'.  The
+// producer publishes the count of values pushed, 'd_published', and each
+// consumer publishes its cursor, the sequence number of the next value that it
+// will consume.  A consumer reads up to its barrier (the lesser of
+// 'd_published' and the cursors on which it depends), and the producer writes
+// sequence number 's' only once every cursor exceeds 's - capacity()'.  Each
+// side keeps a private cache of the position of the other side
+// ('d_cachedBarrier' and 'd_cachedGate'), so that the shared cache lines of
+// the other side are read only when the cached position is exhausted.
+//
+// A consumer registered while the producer is pushing starts at its barrier,
+// which the producer must not overtake before it observes the new cursor.
+// Registration stores the cursor, increments 'd_numRegistrations', and reads
+// the barrier again, retrying until the barrier is unchanged; the producer
+// reads 'd_numRegistrations' before and after reading the cursors, and reads
+// them again if it changed.  A gate computed without the new cursor therefore
+// read the cursors and the count of values published before the barrier was
+// last read, and so does not exceed the starting cursor.
+//
+// A thread that must block increments a waiting count under 'd_mutex', and
+// then reads the cursors again, before waiting on a condition; a thread that
+// advances a cursor stores it and then reads the waiting counts (both with
+// sequentially consistent operations), and signals the condition (under
+// 'd_mutex') only if a count is non-zero.  Therefore, no wakeup is lost, and
+// no lock is taken unless a thread is blocked.
+
+namespace BloombergLP {
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
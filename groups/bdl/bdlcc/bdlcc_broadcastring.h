@@ -0,0 +1,1113 @@
+// bdlcc_broadcastring.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLCC_BROADCASTRING
+#define INCLUDED_BDLCC_BROADCASTRING
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a single-producer ring whose items reach every consumer.
+//
+//@CLASSES:
+//  bdlcc::BroadcastRing: lock-free single-producer broadcast ring buffer
+//
+//@SEE_ALSO: bdlcc_singleproducersingleconsumerboundedqueue
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::BroadcastRing', that provides a bounded ring buffer through which a
+// single producer passes a stream of values to several consumers, each of
+// which receives *every* value (in the order in which the values were
+// pushed).  Unlike the queues of this package, where each value is removed by
+// exactly one consumer, a 'BroadcastRing' keeps one cursor for each consumer,
+// so that one stream (e.g., of market data) can be fanned out to several
+// clients without copying each value into a queue for each of them.  The
+// design follows the "disruptor" pattern: the values are stored in
+// preallocated slots of the ring, the producer and each consumer advance
+// their own sequence numbers, and neither pushing nor popping takes a lock
+// unless a thread must block.
+//
+// The values are pushed with 'pushBack' (or 'tryPushBack') by a single
+// producer (one thread or a group of threads using external synchronization).
+// A consumer is registered with 'addConsumer', which returns an identifier
+// that is passed to the consuming methods; a consumer receives the values
+// pushed after it was registered.  Each consumer must be used by one thread
+// at a time, and different consumers may be used concurrently.  A consumer
+// that is no longer needed is unregistered with 'removeConsumer'.
+//
+///Gating
+///------
+// A slot of the ring is not overwritten until every consumer has consumed the
+// value stored in it; i.e., the producer is gated by the slowest consumer.
+// When the producer is a full 'capacity()' values ahead of the slowest
+// consumer, 'pushBack' blocks until that consumer catches up, and
+// 'tryPushBack' fails.  A consumer that stops consuming therefore eventually
+// stops the producer; removing the consumer releases the producer.  If no
+// consumer is registered, values are pushed (and discarded) without blocking.
+//
+// To avoid reading the cursor of every consumer on each push, the producer
+// caches the position of the slowest consumer, and reads the cursors again
+// only when the cached position indicates that the ring is full.
+//
+///Sequence Barriers
+///-----------------
+// A consumer may be registered with a list of other consumers on which it
+// depends.  Such a consumer receives a value only after every consumer on
+// which it depends has consumed that value, which allows the consumers to
+// form a pipeline (e.g., a journaling consumer and a replicating consumer
+// that must both see a value before a processing consumer acts on it)
+// without any additional queues.  The position up to which a consumer may
+// read, the lesser of the number of values published and the cursors of the
+// consumers on which it depends, is called its *barrier*.  Once a consumer on
+// which another depends is removed, it no longer holds back the dependent
+// consumer (until its identifier is reused by a subsequent 'addConsumer').
+//
+///Batched Consumption
+///-------------------
+// 'popFront' and 'tryPopFront' copy one value from the ring.  'popFrontBatch'
+// and 'tryPopFrontBatch' instead invoke a visitor, in place, on every value
+// that is available to the consumer (up to a specified maximum), and then
+// release all of these values to the producer in one step.  A consumer that
+// falls behind therefore catches up with one read of its barrier and one
+// update of its cursor, rather than one of each per value.  If the visitor
+// throws an exception, no value of the batch is consumed.
+//
+// The values stay in the ring until they are overwritten, so a value that
+// owns a resource (e.g., a shared pointer) holds it until the producer reuses
+// its slot.
+//
+///Disabling
+///---------
+// The ring may be placed into an "enqueue disabled" state using the
+// 'disablePushBack' method, which marks the end of the stream.  When disabled,
+// 'pushBack' and 'tryPushBack' fail immediately, and a producer blocked in
+// 'pushBack' returns an error code.  Each consumer still receives every value
+// pushed before the ring was disabled; once it has consumed them all, the
+// consuming methods return 'e_DISABLED' instead of blocking.  The ring may be
+// restored to normal operation with the 'enablePushBack' method.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::BroadcastRing' is a template that is parameterized on the type of
+// the values contained within the ring.  The supplied template argument,
+// 'TYPE', must provide a default constructor, a copy constructor, and an
+// assignment operator.  The ring default-constructs 'capacity()' values on
+// construction, and pushing a value assigns it to a slot.  If the default
+// constructor accepts a 'bslma::Allocator *', 'TYPE' must declare the uses
+// 'bslma::Allocator' trait (see 'bslma_usesbslmaallocator') so that the
+// allocator of the ring is propagated to the values.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out a Stream of Quotes
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market data handler receives a stream of quotes, each of
+// which must be seen by several trading strategies that run in threads of
+// their own.
+//
+// First, we define the type of a quote:
+//..
+//  struct Quote {
+//      int    d_instrument;  // identifies the instrument
+//      double d_bid;         // best bid price
+//      double d_ask;         // best ask price
+//  };
+//..
+// Then, we define a visitor, invoked in place on each quote in the ring, that
+// accumulates the mid price of the quotes it sees:
+//..
+//  struct MidPriceSummer {
+//      // This 'struct' accumulates the mid prices of the quotes it visits.
+//
+//      double *d_sum_p;  // running sum (held, not owned)
+//
+//      void operator()(const Quote& quote) const
+//          // Add the mid price of the specified 'quote' to the sum.
+//      {
+//          *d_sum_p += (quote.d_bid + quote.d_ask) / 2;
+//      }
+//  };
+//..
+// Next, we define the function run by the thread of each strategy, which
+// consumes quotes in batches until the end of the stream:
+//..
+//  struct Strategy {
+//      // This 'struct' defines a functor that consumes the quotes of a ring.
+//
+//      bdlcc::BroadcastRing<Quote> *d_ring_p;      // ring (held, not owned)
+//      int                          d_consumerId;  // registered consumer
+//      double                      *d_sum_p;       // result (held)
+//
+//      void operator()() const
+//          // Consume every quote of the ring.
+//      {
+//          MidPriceSummer summer = { d_sum_p };
+//          while (0 < d_ring_p->popFrontBatch(d_consumerId, summer, 64)) {
+//          }
+//      }
+//  };
+//..
+// Then, we create a ring of 1024 quotes with room for up to 4 consumers, and
+// register a consumer for each of 2 strategies, before any quote is pushed:
+//..
+//  bdlcc::BroadcastRing<Quote> ring(1024, 4);
+//
+//  double sums[2] = { 0, 0 };
+//
+//  bslmt::ThreadGroup strategies;
+//  for (int i = 0; i < 2; ++i) {
+//      const int consumerId = ring.addConsumer();
+//      assert(0 <= consumerId);
+//
+//      Strategy strategy = { &ring, consumerId, &sums[i] };
+//      strategies.addThread(strategy);
+//  }
+//..
+// Next, we push the quotes (here, synthetic ones), each of which reaches both
+// strategies without being copied into a queue for each:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      Quote quote = { i % 16, 100.0 + i % 3, 101.0 + i % 3 };
+//      int   rc    = ring.pushBack(quote);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, we disable the ring to mark the end of the stream, wait for the
+// strategies to consume every quote, and observe that both saw every quote:
+//..
+//  ring.disablePushBack();
+//  strategies.joinAll();
+//
+//  assert(sums[0] == sums[1]);
+//  assert(1014999.0 == sums[0]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                            // ===================
+                            // class BroadcastRing
+                            // ===================
+
+template <class TYPE>
+class BroadcastRing {
+    // This class provides a bounded ring buffer through which a single
+    // producer passes values to several consumers, each of which receives
+    // every value.  See {Gating} and {Sequence Barriers} for details.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64                          Int64;
+    typedef bsls::AtomicOperations                      AtomicOp;
+    typedef bsls::AtomicOperations::AtomicTypes::Int    AtomicInt;
+    typedef bsls::AtomicOperations::AtomicTypes::Int64  AtomicInt64;
+
+    struct Consumer {
+        // This 'struct' holds the state of one consumer, padded so that the
+        // cursors of different consumers are in different cache lines.
+
+        AtomicInt64 d_cursor;         // sequence number of the next value to
+                                      // consume, or 'k_INACTIVE' if the
+                                      // consumer is not registered
+
+        Int64       d_cachedBarrier;  // barrier last read by the consumer;
+                                      // used only by the consumer
+
+        char        d_pad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                          - sizeof(AtomicInt64)
+                          - sizeof(Int64)];
+                                      // padding to the end of the cache line
+    };
+
+    // PRIVATE CONSTANTS
+    static const Int64 k_INACTIVE = 0x7FFFFFFFFFFFFFFFLL;
+                                      // cursor of an unregistered consumer;
+                                      // never less than another cursor
+
+    // DATA
+    AtomicInt64                      d_published;     // number of values
+                                                      // pushed
+
+    Int64                            d_cachedGate;    // lower bound on the
+                                                      // cursors of the
+                                                      // consumers; used only
+                                                      // by the producer
+
+    const char                       d_producerPad[
+                                           bslmt::Platform::e_CACHE_LINE_SIZE
+                                         - sizeof(AtomicInt64)
+                                         - sizeof(Int64)];
+                                                      // padding to prevent
+                                                      // subsequent data from
+                                                      // being in the same
+                                                      // cache line as the
+                                                      // prior data
+
+    bsl::vector<TYPE>                d_slots;         // slots of the ring
+
+    const Int64                      d_mask;          // 'capacity() - 1'
+
+    Consumer                        *d_consumers_p;   // array of
+                                                      // 'd_maxConsumers'
+                                                      // consumers (owned)
+
+    const int                        d_maxConsumers;  // maximum number of
+                                                      // registered consumers
+
+    bsl::vector<bsl::vector<int> >   d_dependencies;  // consumers on which
+                                                      // each consumer depends
+
+    AtomicInt                        d_producerWaiting;
+                                                      // 1 if the producer is
+                                                      // blocked in 'pushBack',
+                                                      // and 0 otherwise
+
+    AtomicInt                        d_numWaitingConsumers;
+                                                      // number of consumers
+                                                      // blocked
+
+    AtomicInt                        d_numWaitingDependents;
+                                                      // number of blocked
+                                                      // consumers that depend
+                                                      // on other consumers
+
+    AtomicInt                        d_disabled;      // 1 if pushing is
+                                                      // disabled, and 0
+                                                      // otherwise
+
+    AtomicInt                        d_numRegistrations;
+                                                      // number of consumers
+                                                      // registered so far;
+                                                      // incremented once each
+                                                      // starting cursor is
+                                                      // stored
+
+    bslmt::Mutex                     d_mutex;         // serializes
+                                                      // registration, and
+                                                      // blocking and waking
+
+    bslmt::Condition                 d_readCondition; // signaled when values
+                                                      // become available to
+                                                      // blocked consumers
+
+    bslmt::Condition                 d_writeCondition;
+                                                      // signaled when slots
+                                                      // become available to
+                                                      // a blocked producer
+
+    bslma::Allocator                *d_allocator_p;   // allocator (held, not
+                                                      // owned)
+
+    // PRIVATE MANIPULATORS
+    void notifyConsumers();
+        // Wake the consumers that are blocked, if any.  The behavior is
+        // undefined unless this method is invoked by the producer after
+        // publishing a value.
+
+    int popFrontImp(int consumerId, TYPE *value, bool isTry);
+        // Load into the specified 'value' the next value for the consumer
+        // having the specified 'consumerId', and consume it.  If no value is
+        // available and the specified 'isTry' is 'false', block until one is.
+        // Return 'e_SUCCESS' on success, 'e_DISABLED' if pushing is disabled
+        // and the consumer has consumed every value pushed, 'e_EMPTY' if
+        // 'isTry' is 'true' and no value is available, and 'e_FAILED' if an
+        // underlying mechanism returns an error.
+
+    template <class VISITOR>
+    int popFrontBatchImp(int            consumerId,
+                         const VISITOR& visitor,
+                         int            maxValues,
+                         bool           isTry);
+        // Invoke the specified 'visitor' on each of the values available to
+        // the consumer having the specified 'consumerId', up to the specified
+        // 'maxValues' values, and then consume them.  If no value is
+        // available and the specified 'isTry' is 'false', block until one is.
+        // Return the number of values consumed on success, 'e_DISABLED' if
+        // pushing is disabled and the consumer has consumed every value
+        // pushed, 'e_EMPTY' if 'isTry' is 'true' and no value is available,
+        // and 'e_FAILED' if an underlying mechanism returns an error.
+
+    int pushBackImp(const TYPE& value, bool isTry);
+        // Append the specified 'value' to the back of this ring.  If the ring
+        // is full and the specified 'isTry' is 'false', block until it is
+        // not.  Return 'e_SUCCESS' on success, 'e_DISABLED' if pushing is
+        // disabled, 'e_FULL' if 'isTry' is 'true' and the ring is full, and
+        // 'e_FAILED' if an underlying mechanism returns an error.
+
+    void release(int consumerId, Int64 cursor);
+        // Set the cursor of the consumer having the specified 'consumerId' to
+        // the specified 'cursor', and wake the producer and the dependent
+        // consumers that are blocked, if any.
+
+    int waitForValues(int consumerId, Int64 cursor, bool isTry);
+        // Wait until the barrier of the consumer having the specified
+        // 'consumerId', whose cursor is the specified 'cursor', is beyond
+        // 'cursor', and load that barrier into the cached barrier of the
+        // consumer.  If the specified 'isTry' is 'true', do not block.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if pushing is disabled and the
+        // consumer has consumed every value pushed, 'e_EMPTY' if 'isTry' is
+        // 'true' and no value is available, and 'e_FAILED' if an underlying
+        // mechanism returns an error.
+
+    int waitForSlot(bool isTry);
+        // Wait until the slot of the next value to push is consumed by every
+        // consumer.  If the specified 'isTry' is 'true', do not block.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if pushing is disabled,
+        // 'e_FULL' if 'isTry' is 'true' and the ring is full, and 'e_FAILED'
+        // if an underlying mechanism returns an error.
+
+    // PRIVATE ACCESSORS
+    Int64 barrier(int consumerId) const;
+        // Return the barrier of the consumer having the specified
+        // 'consumerId': the lesser of the number of values published and the
+        // cursors of the consumers on which it depends.
+
+    Int64 gate() const;
+        // Return the lesser of the number of values published and the cursors
+        // of the consumers.  The result does not exceed the starting cursor
+        // of a consumer being registered concurrently by 'addConsumer'.
+
+    bool isActive(int consumerId) const;
+        // Return 'true' if the specified 'consumerId' identifies a registered
+        // consumer, and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    BroadcastRing(const BroadcastRing&);
+    BroadcastRing& operator=(const BroadcastRing&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BroadcastRing, bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,
+        e_EMPTY    = -1,
+        e_FULL     = -2,
+        e_DISABLED = -3,
+        e_FAILED   = -4
+    };
+
+    // CREATORS
+    BroadcastRing(bsl::size_t       capacity,
+                  int               maxConsumers,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a ring holding the specified 'capacity' values (rounded up to
+        // a power of two), to which up to the specified 'maxConsumers'
+        // consumers can be registered at a time.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < capacity' and '0 < maxConsumers'.
+
+    ~BroadcastRing();
+        // Destroy this object.  The behavior is undefined unless no thread is
+        // using this object.
+
+    // MANIPULATORS
+    int addConsumer();
+        // Register a consumer of this ring that receives the values pushed
+        // from now on, and return its non-negative identifier, or a negative
+        // value if 'maxConsumers()' consumers are already registered.
+
+    int addConsumer(const int *dependencies, int numDependencies);
+        // Register a consumer of this ring that receives each value pushed
+        // from now on once the consumers identified by the specified
+        // 'numDependencies' elements of the specified 'dependencies' array
+        // have consumed it, and return its non-negative identifier.  Return a
+        // negative value, without registering a consumer, if 'maxConsumers()'
+        // consumers are already registered or if an element of
+        // 'dependencies' does not identify a registered consumer.  The
+        // behavior is undefined unless '0 <= numDependencies', and
+        // 'dependencies' refers to an array of at least 'numDependencies'
+        // elements (or 'numDependencies' is 0).  See {Sequence Barriers}.
+
+    int popFront(int consumerId, TYPE *value);
+        // Load into the specified 'value' the next value for the consumer
+        // having the specified 'consumerId', and consume it.  If no value is
+        // available to the consumer, block until one is.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()' and
+        // the consumer has consumed every value pushed, and 'e_FAILED' if an
+        // underlying mechanism returns an error.  On failure, 'value' is not
+        // changed.  The behavior is undefined unless 'consumerId' identifies a
+        // registered consumer that is not used concurrently by another
+        // thread.
+
+    template <class VISITOR>
+    int popFrontBatch(int consumerId, const VISITOR& visitor, int maxValues);
+        // Invoke the specified 'visitor' on each of the values available to
+        // the consumer having the specified 'consumerId', up to the specified
+        // 'maxValues' values, in order and in place, and then consume these
+        // values.  If no value is available to the consumer, block until one
+        // is.  Return the (positive) number of values consumed on success,
+        // and a negative value otherwise.  Specifically, return 'e_DISABLED'
+        // if 'isPushBackDisabled()' and the consumer has consumed every value
+        // pushed, and 'e_FAILED' if an underlying mechanism returns an error.
+        // 'visitor' is invoked as if by 'visitor(value)', where 'value' is a
+        // 'const TYPE&'.  If 'visitor' throws an exception, no value is
+        // consumed.  The behavior is undefined unless 'consumerId' identifies
+        // a registered consumer that is not used concurrently by another
+        // thread, and '0 < maxValues'.  See {Batched Consumption}.
+
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this ring, blocking
+        // until the slowest consumer has consumed the value in the slot to be
+        // reused.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPushBackDisabled()', and 'e_FAILED' if an underlying mechanism
+        // returns an error.  A producer blocked because the ring is full
+        // returns 'e_DISABLED' if 'disablePushBack' is invoked.  The behavior
+        // is undefined unless the invoker of this method is the single
+        // producer.  See {Gating}.
+
+    void removeConsumer(int consumerId);
+        // Unregister the consumer having the specified 'consumerId'.  The
+        // values that it has not consumed no longer hold back the producer or
+        // the consumers that depend on it.  The behavior is undefined unless
+        // 'consumerId' identifies a registered consumer that is not in use by
+        // another thread.
+
+    int tryPopFront(int consumerId, TYPE *value);
+        // Attempt to load into the specified 'value' the next value for the
+        // consumer having the specified 'consumerId', without blocking, and,
+        // if successful, consume it.  Return 0 on success, and a non-zero
+        // value otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and the consumer has consumed
+        // every value pushed, and 'e_EMPTY' if no value is available to the
+        // consumer.  On failure, 'value' is not changed.  The behavior is
+        // undefined unless 'consumerId' identifies a registered consumer that
+        // is not used concurrently by another thread.
+
+    template <class VISITOR>
+    int tryPopFrontBatch(int            consumerId,
+                         const VISITOR& visitor,
+                         int            maxValues);
+        // Invoke the specified 'visitor' on each of the values available to
+        // the consumer having the specified 'consumerId', up to the specified
+        // 'maxValues' values, in order and in place, and then consume these
+        // values, without blocking.  Return the (positive) number of values
+        // consumed on success, and a negative value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPushBackDisabled()' and the consumer has
+        // consumed every value pushed, and 'e_EMPTY' if no value is available
+        // to the consumer.  'visitor' is invoked as if by 'visitor(value)',
+        // where 'value' is a 'const TYPE&'.  If 'visitor' throws an exception,
+        // no value is consumed.  The behavior is undefined unless
+        // 'consumerId' identifies a registered consumer that is not used
+        // concurrently by another thread, and '0 < maxValues'.
+
+    int tryPushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this ring if the slowest
+        // consumer has consumed the value in the slot to be reused.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()', and
+        // 'e_FULL' if '!isPushBackDisabled()' and the ring was full.  The
+        // behavior is undefined unless the invoker of this method is the
+        // single producer.
+
+                              // Enqueue State
+
+    void disablePushBack();
+        // Disable enqueueing into this ring.  All subsequent invocations of
+        // 'pushBack' or 'tryPushBack' will fail immediately, and a producer
+        // blocked in 'pushBack' will fail immediately.  Consumers that have
+        // consumed every value pushed fail, rather than block, in subsequent
+        // invocations of the consuming methods.  If the ring is already
+        // enqueue disabled, this method has no effect.
+
+    void enablePushBack();
+        // Enable enqueueing.  If the ring is not enqueue disabled, this call
+        // has no effect.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the maximum number of values that a consumer may lag behind
+        // the producer.
+
+    bool isPushBackDisabled() const;
+        // Return 'true' if this ring is enqueue disabled, and 'false'
+        // otherwise.
+
+    int maxConsumers() const;
+        // Return the maximum number of consumers registered at a time.
+
+    bsl::size_t numElements(int consumerId) const;
+        // Return the number of values pushed that the consumer having the
+        // specified 'consumerId' has not yet consumed.  The behavior is
+        // undefined unless 'consumerId' identifies a registered consumer.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class BroadcastRing
+                            // -------------------
+
+// PRIVATE CONSTANTS
+template <class TYPE>
+const bsls::Types::Int64 BroadcastRing<TYPE>::k_INACTIVE;
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void BroadcastRing<TYPE>::notifyConsumers()
+{
+    if (AtomicOp::getInt(&d_numWaitingConsumers)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_readCondition.broadcast();
+    }
+}
+
+template <class TYPE>
+int BroadcastRing<TYPE>::popFrontImp(int consumerId, TYPE *value, bool isTry)
+{
+    const Int64 cursor =
+              AtomicOp::getInt64Relaxed(&d_consumers_p[consumerId].d_cursor);
+
+    const int rc = waitForValues(consumerId, cursor, isTry);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *value = d_slots[static_cast<bsl::size_t>(cursor & d_mask)];
+
+    release(consumerId, cursor + 1);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+template <class VISITOR>
+int BroadcastRing<TYPE>::popFrontBatchImp(int            consumerId,
+                                          const VISITOR& visitor,
+                                          int            maxValues,
+                                          bool           isTry)
+{
+    Consumer&   consumer = d_consumers_p[consumerId];
+    const Int64 cursor   = AtomicOp::getInt64Relaxed(&consumer.d_cursor);
+
+    const int rc = waitForValues(consumerId, cursor, isTry);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Every value up to the cached barrier is available, so the batch is
+    // visited without reading the barrier (or any other shared state) again.
+
+    const Int64 end = consumer.d_cachedBarrier - cursor < maxValues
+                    ? consumer.d_cachedBarrier
+                    : cursor + maxValues;
+
+    const bsl::vector<TYPE>& slots = d_slots;
+    for (Int64 i = cursor; i < end; ++i) {
+        visitor(slots[static_cast<bsl::size_t>(i & d_mask)]);
+    }
+
+    release(consumerId, end);
+
+    return static_cast<int>(end - cursor);
+}
+
+template <class TYPE>
+int BroadcastRing<TYPE>::pushBackImp(const TYPE& value, bool isTry)
+{
+    const int rc = waitForSlot(isTry);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const Int64 next = AtomicOp::getInt64Relaxed(&d_published);
+
+    d_slots[static_cast<bsl::size_t>(next & d_mask)] = value;
+
+    // See 'release' for the ordering of storing the count and reading the
+    // waiting count.
+
+    AtomicOp::setInt64(&d_published, next + 1);
+    notifyConsumers();
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void BroadcastRing<TYPE>::release(int consumerId, Int64 cursor)
+{
+    // The cursor is stored, and the waiting counts are then read, with
+    // sequential consistency: either a blocking thread (which increments its
+    // waiting count under 'd_mutex' before reading the cursors) observes the
+    // new cursor, or this thread observes the waiting count and signals the
+    // blocked thread.
+
+    AtomicOp::setInt64(&d_consumers_p[consumerId].d_cursor, cursor);
+
+    if (   AtomicOp::getInt(&d_producerWaiting)
+        || AtomicOp::getInt(&d_numWaitingDependents)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_writeCondition.signal();
+        d_readCondition.broadcast();
+    }
+}
+
+template <class TYPE>
+int BroadcastRing<TYPE>::waitForValues(int   consumerId,
+                                       Int64 cursor,
+                                       bool  isTry)
+{
+    Int64& cachedBarrier = d_consumers_p[consumerId].d_cachedBarrier;
+
+    if (cachedBarrier > cursor) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    cachedBarrier = barrier(consumerId);
+    if (cachedBarrier > cursor) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    if (AtomicOp::getInt(&d_disabled)
+     && cursor >= AtomicOp::getInt64(&d_published)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (isTry) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    bslmt::ThreadUtil::yield();
+
+    cachedBarrier = barrier(consumerId);
+    if (cachedBarrier > cursor) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    const bool isDependent = !d_dependencies[consumerId].empty();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    AtomicOp::addInt(&d_numWaitingConsumers, 1);
+    if (isDependent) {
+        AtomicOp::addInt(&d_numWaitingDependents, 1);
+    }
+
+    int rc = e_SUCCESS;
+    while ((cachedBarrier = barrier(consumerId)) <= cursor) {
+        if (AtomicOp::getInt(&d_disabled)
+         && cursor >= AtomicOp::getInt64(&d_published)) {
+            rc = e_DISABLED;
+            break;
+        }
+        if (d_readCondition.wait(&d_mutex)) {
+            rc = e_FAILED;
+            break;
+        }
+    }
+
+    if (isDependent) {
+        AtomicOp::addInt(&d_numWaitingDependents, -1);
+    }
+    AtomicOp::addInt(&d_numWaitingConsumers, -1);
+
+    return rc;
+}
+
+template <class TYPE>
+int BroadcastRing<TYPE>::waitForSlot(bool isTry)
+{
+    if (AtomicOp::getInt(&d_disabled)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    // The slot of sequence number 'next' was last used for the value of
+    // sequence number 'next - capacity', which every consumer has consumed
+    // once every cursor is beyond it.
+
+    const Int64 next = AtomicOp::getInt64Relaxed(&d_published);
+
+    if (next - d_cachedGate <= d_mask) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    d_cachedGate = gate();
+    if (next - d_cachedGate <= d_mask) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    if (isTry) {
+        return e_FULL;                                                // RETURN
+    }
+
+    bslmt::ThreadUtil::yield();
+
+    d_cachedGate = gate();
+    if (next - d_cachedGate <= d_mask) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    AtomicOp::setInt(&d_producerWaiting, 1);
+
+    int rc = e_SUCCESS;
+    while (next - (d_cachedGate = gate()) > d_mask) {
+        if (AtomicOp::getInt(&d_disabled)) {
+            rc = e_DISABLED;
+            break;
+        }
+        if (d_writeCondition.wait(&d_mutex)) {
+            rc = e_FAILED;
+            break;
+        }
+    }
+
+    AtomicOp::setInt(&d_producerWaiting, 0);
+
+    return rc;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+bsls::Types::Int64 BroadcastRing<TYPE>::barrier(int consumerId) const
+{
+    Int64 result = AtomicOp::getInt64(&d_published);
+
+    const bsl::vector<int>& dependencies = d_dependencies[consumerId];
+    for (bsl::size_t i = 0; i < dependencies.size(); ++i) {
+        const Int64 cursor =
+                  AtomicOp::getInt64(&d_consumers_p[dependencies[i]].d_cursor);
+        if (cursor < result) {
+            result = cursor;
+        }
+    }
+    return result;
+}
+
+template <class TYPE>
+bsls::Types::Int64 BroadcastRing<TYPE>::gate() const
+{
+    // The result is bounded by the number of values published so that a
+    // consumer registered later (whose cursor starts at, or after, the values
+    // published) is accounted for by a cached gate.  The cursors are read
+    // again if a consumer was registered while they were read (see
+    // 'addConsumer').
+
+    for (;;) {
+        const int numRegistrations = AtomicOp::getInt(&d_numRegistrations);
+
+        Int64 result = AtomicOp::getInt64Relaxed(&d_published);
+
+        for (int i = 0; i < d_maxConsumers; ++i) {
+            const Int64 cursor =
+                               AtomicOp::getInt64(&d_consumers_p[i].d_cursor);
+            if (cursor < result) {
+                result = cursor;
+            }
+        }
+
+        if (numRegistrations == AtomicOp::getInt(&d_numRegistrations)) {
+            return result;                                            // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+inline
+bool BroadcastRing<TYPE>::isActive(int consumerId) const
+{
+    return 0 <= consumerId
+        && consumerId < d_maxConsumers
+        && k_INACTIVE !=
+              AtomicOp::getInt64Relaxed(&d_consumers_p[consumerId].d_cursor);
+}
+
+// CREATORS
+template <class TYPE>
+BroadcastRing<TYPE>::BroadcastRing(bsl::size_t       capacity,
+                                   int               maxConsumers,
+                                   bslma::Allocator *basicAllocator)
+: d_cachedGate(0)
+, d_producerPad()
+, d_slots(static_cast<bsl::size_t>(
+                      bdlb::BitUtil::roundUpToBinaryPower(
+                                       static_cast<bsl::uint64_t>(capacity))),
+          basicAllocator)
+, d_mask(static_cast<Int64>(d_slots.size()) - 1)
+, d_consumers_p(0)
+, d_maxConsumers(maxConsumers)
+, d_dependencies(maxConsumers, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 < maxConsumers);
+
+    AtomicOp::initInt64(&d_published, 0);
+    AtomicOp::initInt(&d_producerWaiting, 0);
+    AtomicOp::initInt(&d_numWaitingConsumers, 0);
+    AtomicOp::initInt(&d_numWaitingDependents, 0);
+    AtomicOp::initInt(&d_disabled, 0);
+    AtomicOp::initInt(&d_numRegistrations, 0);
+
+    d_consumers_p = static_cast<Consumer *>(
+                     d_allocator_p->allocate(sizeof(Consumer) * maxConsumers));
+
+    for (int i = 0; i < maxConsumers; ++i) {
+        AtomicOp::initInt64(&d_consumers_p[i].d_cursor, k_INACTIVE);
+        d_consumers_p[i].d_cachedBarrier = 0;
+    }
+}
+
+template <class TYPE>
+BroadcastRing<TYPE>::~BroadcastRing()
+{
+    d_allocator_p->deallocate(d_consumers_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::addConsumer()
+{
+    return addConsumer(0, 0);
+}
+
+template <class TYPE>
+int BroadcastRing<TYPE>::addConsumer(const int *dependencies,
+                                     int        numDependencies)
+{
+    BSLS_ASSERT(0 <= numDependencies);
+    BSLS_ASSERT(dependencies || 0 == numDependencies);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    int consumerId = 0;
+    while (consumerId < d_maxConsumers && isActive(consumerId)) {
+        ++consumerId;
+    }
+    if (d_maxConsumers == consumerId) {
+        return e_FULL;                                                // RETURN
+    }
+
+    for (int i = 0; i < numDependencies; ++i) {
+        if (!isActive(dependencies[i])) {
+            return e_FAILED;                                          // RETURN
+        }
+    }
+
+    d_dependencies[consumerId].assign(dependencies,
+                                      dependencies + numDependencies);
+
+    // The consumer starts at its barrier.  A gate computed by the producer
+    // without observing the new cursor may exceed the cursor, letting the
+    // producer overwrite slots that the new consumer is about to read, if
+    // the barrier advanced (i.e., a value was published, or a consumer on
+    // which it depends advanced) since the gate read it.  So, having stored
+    // the cursor, the number of registrations is incremented, which makes any
+    // gate computed concurrently read the cursors again; a gate that
+    // completed before the increment read each cursor contributing to the
+    // barrier no later than the barrier is read again below.  Therefore, the
+    // registration is retried until the barrier is unchanged.
+
+    Consumer& consumer = d_consumers_p[consumerId];
+    Int64     cursor   = barrier(consumerId);
+    for (;;) {
+        consumer.d_cachedBarrier = cursor;
+        AtomicOp::setInt64(&consumer.d_cursor, cursor);
+        AtomicOp::addInt(&d_numRegistrations, 1);
+
+        const Int64 current = barrier(consumerId);
+        if (current == cursor) {
+            break;
+        }
+        cursor = current;
+    }
+
+    return consumerId;
+}
+
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::popFront(int consumerId, TYPE *value)
+{
+    BSLS_ASSERT(isActive(consumerId));
+    BSLS_ASSERT(value);
+
+    return popFrontImp(consumerId, value, false);
+}
+
+template <class TYPE>
+template <class VISITOR>
+inline
+int BroadcastRing<TYPE>::popFrontBatch(int            consumerId,
+                                       const VISITOR& visitor,
+                                       int            maxValues)
+{
+    BSLS_ASSERT(isActive(consumerId));
+    BSLS_ASSERT(0 < maxValues);
+
+    return popFrontBatchImp(consumerId, visitor, maxValues, false);
+}
+
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::pushBack(const TYPE& value)
+{
+    return pushBackImp(value, false);
+}
+
+template <class TYPE>
+void BroadcastRing<TYPE>::removeConsumer(int consumerId)
+{
+    BSLS_ASSERT(isActive(consumerId));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    AtomicOp::setInt64(&d_consumers_p[consumerId].d_cursor, k_INACTIVE);
+
+    d_writeCondition.signal();
+    d_readCondition.broadcast();
+}
+
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::tryPopFront(int consumerId, TYPE *value)
+{
+    BSLS_ASSERT(isActive(consumerId));
+    BSLS_ASSERT(value);
+
+    return popFrontImp(consumerId, value, true);
+}
+
+template <class TYPE>
+template <class VISITOR>
+inline
+int BroadcastRing<TYPE>::tryPopFrontBatch(int            consumerId,
+                                          const VISITOR& visitor,
+                                          int            maxValues)
+{
+    BSLS_ASSERT(isActive(consumerId));
+    BSLS_ASSERT(0 < maxValues);
+
+    return popFrontBatchImp(consumerId, visitor, maxValues, true);
+}
+
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::tryPushBack(const TYPE& value)
+{
+    return pushBackImp(value, true);
+}
+
+                              // Enqueue State
+
+template <class TYPE>
+void BroadcastRing<TYPE>::disablePushBack()
+{
+    AtomicOp::setInt(&d_disabled, 1);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_writeCondition.signal();
+    d_readCondition.broadcast();
+}
+
+template <class TYPE>
+inline
+void BroadcastRing<TYPE>::enablePushBack()
+{
+    AtomicOp::setInt(&d_disabled, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t BroadcastRing<TYPE>::capacity() const
+{
+    return d_slots.size();
+}
+
+template <class TYPE>
+inline
+bool BroadcastRing<TYPE>::isPushBackDisabled() const
+{
+    return 0 != AtomicOp::getInt(&d_disabled);
+}
+
+template <class TYPE>
+inline
+int BroadcastRing<TYPE>::maxConsumers() const
+{
+    return d_maxConsumers;
+}
+
+template <class TYPE>
+inline
+bsl::size_t BroadcastRing<TYPE>::numElements(int consumerId) const
+{
+    BSLS_ASSERT(isActive(consumerId));
+
+    return static_cast<bsl::size_t>(
+                AtomicOp::getInt64(&d_published)
+              - AtomicOp::getInt64(&d_consumers_p[consumerId].d_cursor));
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *BroadcastRing<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
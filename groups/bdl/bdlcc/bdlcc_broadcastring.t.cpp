@@ -0,0 +1,1464 @@
+// bdlcc_broadcastring.t.cpp                                          -*-C++-*-
+#include <bdlcc_broadcastring.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_buildtarget.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a ring buffer through which a single producer
+// passes values to several consumers, each of which receives every value.  We
+// verify the geometry and the memory use of the ring, the registration of
+// consumers (with and without dependencies), the delivery of every value to
+// every consumer, the gating of the producer by the slowest consumer, the
+// barriers of dependent consumers, the batched consuming methods, and the
+// blocking and disabling of the producer and of the consumers, first from a
+// single thread with the non-blocking methods, and then concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BroadcastRing(size_t capacity, int maxConsumers, Allocator *ba = 0);
+// [ 2] ~BroadcastRing();
+//
+// MANIPULATORS
+// [ 3] int addConsumer();
+// [ 3] int addConsumer(const int *dependencies, int numDependencies);
+// [ 6] int popFront(int consumerId, TYPE *value);
+// [ 6] int popFrontBatch(int consumerId, const VISITOR& v, int max);
+// [ 6] int pushBack(const TYPE& value);
+// [ 3] void removeConsumer(int consumerId);
+// [ 4] int tryPopFront(int consumerId, TYPE *value);
+// [ 5] int tryPopFrontBatch(int consumerId, const VISITOR& v, int max);
+// [ 4] int tryPushBack(const TYPE& value);
+// [ 4] void disablePushBack();
+// [ 4] void enablePushBack();
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 4] bool isPushBackDisabled() const;
+// [ 2] int maxConsumers() const;
+// [ 3] size_t numElements(int consumerId) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::BroadcastRing<int> Obj;
+
+// ============================================================================
+//                          GLOBAL HELPER CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                               // ==============
+                               // struct Collect
+                               // ==============
+
+struct Collect {
+    // This 'struct' defines a visitor that appends the values it visits to a
+    // vector.
+
+    // DATA
+    bsl::vector<int> *d_values_p;  // values visited (held, not owned)
+
+    // ACCESSORS
+    void operator()(const int& value) const
+        // Append the specified 'value' to the vector.
+    {
+        d_values_p->push_back(value);
+    }
+};
+
+                              // ================
+                              // struct ThrowAt
+                              // ================
+
+struct ThrowAt {
+    // This 'struct' defines a visitor that counts the values it visits, and
+    // throws the value it visits when that value is a specified one.
+
+    // DATA
+    int *d_count_p;  // number of values visited (held, not owned)
+    int  d_value;    // value at which to throw
+
+    // ACCESSORS
+    void operator()(const int& value) const
+        // Increment the count, and throw 'value' if it is 'd_value'.
+    {
+        ++*d_count_p;
+        if (d_value == value) {
+            throw value;
+        }
+    }
+};
+
+                              // ===============
+                              // struct Producer
+                              // ===============
+
+struct Producer {
+    // This 'struct' defines a functor that pushes the integers '0' to
+    // 'd_numValues - 1' to a ring with 'pushBack', and then disables the ring.
+
+    // DATA
+    Obj *d_ring_p;     // ring (held, not owned)
+    int  d_numValues;  // number of values to push
+
+    // MANIPULATORS
+    void operator()() const
+        // Push the values, then disable the ring.
+    {
+        for (int i = 0; i < d_numValues; ++i) {
+            ASSERTV(i, 0 == d_ring_p->pushBack(i));
+        }
+        d_ring_p->disablePushBack();
+    }
+};
+
+                              // ===============
+                              // struct PushBack
+                              // ===============
+
+struct PushBack {
+    // This 'struct' defines a functor that pushes a value to a ring with
+    // 'pushBack', and records the result.
+
+    // DATA
+    Obj             *d_ring_p;  // ring (held, not owned)
+    int              d_value;   // value to push
+    bsls::AtomicInt *d_rc_p;    // result of 'pushBack' (held, not owned)
+
+    // MANIPULATORS
+    void operator()() const
+        // Push the value, and record the result.
+    {
+        *d_rc_p = d_ring_p->pushBack(d_value);
+    }
+};
+
+                               // =============
+                               // struct PopTwo
+                               // =============
+
+struct PopTwo {
+    // This 'struct' defines a functor that pops two values from a ring with
+    // 'popFront', recording the first value and the result of the second
+    // 'popFront'.
+
+    // DATA
+    Obj             *d_ring_p;      // ring (held, not owned)
+    int              d_consumerId;  // registered consumer
+    bsls::AtomicInt *d_value_p;     // first value popped (held, not owned)
+    bsls::AtomicInt *d_rc_p;        // result of the second 'popFront'
+                                    // (held, not owned)
+
+    // MANIPULATORS
+    void operator()() const
+        // Pop two values, and record the first one and the second result.
+    {
+        int value = -1;
+        *d_rc_p    = d_ring_p->popFront(d_consumerId, &value);
+        *d_value_p = value;
+        *d_rc_p    = d_ring_p->popFront(d_consumerId, &value);
+    }
+};
+
+                             // ====================
+                             // struct OrderChecker
+                             // ====================
+
+struct OrderChecker {
+    // This 'struct' defines a visitor that verifies that the values it visits
+    // are consecutive integers, and that each value has been visited by the
+    // consumers on which the visiting consumer depends.
+
+    // DATA
+    int                     *d_next_p;        // next value expected (held)
+    bsls::AtomicInt         *d_lastVisited_p; // last value visited (held)
+    const bsls::AtomicInt  **d_dependencies_p;
+                                              // last values visited by the
+                                              // consumers depended on
+    int                      d_numDependencies;
+                                              // number of dependencies
+
+    // ACCESSORS
+    void operator()(const int& value) const
+        // Verify the specified 'value', and record it as visited.
+    {
+        ASSERTV(*d_next_p, value, *d_next_p == value);
+        for (int i = 0; i < d_numDependencies; ++i) {
+            ASSERTV(i, value, value <= d_dependencies_p[i]->load());
+        }
+        *d_next_p = value + 1;
+        d_lastVisited_p->store(value);
+    }
+};
+
+                              // ===============
+                              // struct Consumer
+                              // ===============
+
+struct Consumer {
+    // This 'struct' defines a functor that consumes the values of a ring,
+    // singly or in batches, until the ring is disabled, and verifies them.
+
+    // DATA
+    Obj          *d_ring_p;      // ring (held, not owned)
+    int           d_consumerId;  // registered consumer
+    int           d_batchSize;   // maximum batch size, or 0 for 'popFront'
+    OrderChecker  d_checker;     // verifies each value
+    int           d_numValues;   // number of values expected
+
+    // MANIPULATORS
+    void operator()() const
+        // Consume and verify the values of the ring.
+    {
+        int rc;
+        if (d_batchSize) {
+            while (0 < (rc = d_ring_p->popFrontBatch(d_consumerId,
+                                                     d_checker,
+                                                     d_batchSize))) {
+                ASSERTV(rc, rc <= d_batchSize);
+            }
+        }
+        else {
+            int value;
+            while (0 == (rc = d_ring_p->popFront(d_consumerId, &value))) {
+                d_checker(value);
+            }
+        }
+        ASSERTV(d_consumerId, rc, Obj::e_DISABLED == rc);
+        ASSERTV(d_consumerId, *d_checker.d_next_p,
+                d_numValues == *d_checker.d_next_p);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out a Stream of Quotes
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market data handler receives a stream of quotes, each of
+// which must be seen by several trading strategies that run in threads of
+// their own.
+//
+// First, we define the type of a quote:
+//..
+    struct Quote {
+        int    d_instrument;  // identifies the instrument
+        double d_bid;         // best bid price
+        double d_ask;         // best ask price
+    };
+//..
+// Then, we define a visitor, invoked in place on each quote in the ring, that
+// accumulates the mid price of the quotes it sees:
+//..
+    struct MidPriceSummer {
+        // This 'struct' accumulates the mid prices of the quotes it visits.
+
+        double *d_sum_p;  // running sum (held, not owned)
+
+        void operator()(const Quote& quote) const
+            // Add the mid price of the specified 'quote' to the sum.
+        {
+            *d_sum_p += (quote.d_bid + quote.d_ask) / 2;
+        }
+    };
+//..
+// Next, we define the function run by the thread of each strategy, which
+// consumes quotes in batches until the end of the stream:
+//..
+    struct Strategy {
+        // This 'struct' defines a functor that consumes the quotes of a ring.
+
+        bdlcc::BroadcastRing<Quote> *d_ring_p;      // ring (held, not owned)
+        int                          d_consumerId;  // registered consumer
+        double                      *d_sum_p;       // result (held)
+
+        void operator()() const
+            // Consume every quote of the ring.
+        {
+            MidPriceSummer summer = { d_sum_p };
+            while (0 < d_ring_p->popFrontBatch(d_consumerId, summer, 64)) {
+            }
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator da("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a ring of 1024 quotes with room for up to 4 consumers, and
+// register a consumer for each of 2 strategies, before any quote is pushed:
+//..
+    bdlcc::BroadcastRing<Quote> ring(1024, 4);
+
+    double sums[2] = { 0, 0 };
+
+    bslmt::ThreadGroup strategies;
+    for (int i = 0; i < 2; ++i) {
+        const int consumerId = ring.addConsumer();
+        ASSERT(0 <= consumerId);
+
+        Strategy strategy = { &ring, consumerId, &sums[i] };
+        strategies.addThread(strategy);
+    }
+//..
+// Next, we push the quotes (here, synthetic ones), each of which reaches both
+// strategies without being copied into a queue for each:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        Quote quote = { i % 16, 100.0 + i % 3, 101.0 + i % 3 };
+        int   rc    = ring.pushBack(quote);
+        ASSERT(0 == rc);
+    }
+//..
+// Finally, we disable the ring to mark the end of the stream, wait for the
+// strategies to consume every quote, and observe that both saw every quote:
+//..
+    ring.disablePushBack();
+    strategies.joinAll();
+
+    ASSERT(sums[0] == sums[1]);
+    ASSERT(1014999.0 == sums[0]);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BLOCKING AND CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Every consumer receives every value, in order, when the producer
+        //:   and the consumers run concurrently, with single and batched
+        //:   consumption.
+        //:
+        //: 2 A dependent consumer receives a value only after the consumers
+        //:   on which it depends have consumed it.
+        //:
+        //: 3 'pushBack' blocks while the ring is full, and 'popFront' and
+        //:   'popFrontBatch' block while no value is available.
+        //:
+        //: 4 'disablePushBack' releases a blocked producer (which returns
+        //:   'e_DISABLED') and, once they have consumed every value, the
+        //:   blocked consumers (which return 'e_DISABLED').
+        //:
+        //: 5 'removeConsumer' releases a producer gated by the removed
+        //:   consumer.
+        //:
+        //: 6 A dependent consumer registered while the producer pushes to a
+        //:   full ring starts on a value that its dependency has visited, and
+        //:   never reads a slot that the producer is overwriting.
+        //
+        // Plan:
+        //: 1 Using a small ring, start a producer thread pushing many values,
+        //:   two independent consumer threads (consuming in batches of one and
+        //:   of 64 values, so that each records a value as visited before
+        //:   releasing it), and a consumer thread, consuming singly, depending
+        //:   on both.  Each consumer verifies the order of the values, and the
+        //:   dependent one verifies that both of its dependencies have visited
+        //:   each value it visits.  The producer disables the ring at the end.
+        //:   (C-1..4)
+        //:
+        //: 2 Fill a ring whose consumer does not consume, and block the
+        //:   producer in 'pushBack'; then release it with 'removeConsumer',
+        //:   and, in another run, with 'disablePushBack'.  (C-3..5)
+        //:
+        //: 3 Block a consumer in 'popFront', and release it by pushing a
+        //:   value, and then by disabling the ring.  (C-3..4)
+        //:
+        //: 4 While a producer thread pushes consecutive values to a small ring
+        //:   gated by a consumer thread, repeatedly register a consumer
+        //:   depending on that consumer, pop a few values, verifying that they
+        //:   are consecutive and have been visited by the dependency, and
+        //:   remove it.  (C-6)
+        //
+        // Testing:
+        //   int popFront(int consumerId, TYPE *value);
+        //   int popFrontBatch(int consumerId, const VISITOR& v, int max);
+        //   int pushBack(const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BLOCKING AND CONCURRENCY" << endl
+                                  << "========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nPipeline of consumers." << endl;
+        {
+            enum { k_NUM_VALUES = 50000 };
+
+            const int CAPACITIES[] = { 1, 16, 1024 };
+            for (int ti = 0; ti < 3; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                Obj mX(CAPACITY, 4, &ta);
+
+                const int ID0 = mX.addConsumer();
+                const int ID1 = mX.addConsumer();
+                const int DEPENDENCIES[] = { ID0, ID1 };
+                const int ID2 = mX.addConsumer(DEPENDENCIES, 2);
+                ASSERT(0 <= ID0 && 0 <= ID1 && 0 <= ID2);
+
+                int             next[3] = { 0, 0, 0 };
+                bsls::AtomicInt lastVisited[3];
+                lastVisited[0] = -1;
+                lastVisited[1] = -1;
+                lastVisited[2] = -1;
+
+                const bsls::AtomicInt *dependencies[] = { &lastVisited[0],
+                                                          &lastVisited[1] };
+
+                Consumer consumers[3] = {
+                    { &mX, ID0, 1,  { &next[0], &lastVisited[0], 0, 0 },
+                      k_NUM_VALUES },
+                    { &mX, ID1, 64, { &next[1], &lastVisited[1], 0, 0 },
+                      k_NUM_VALUES },
+                    { &mX, ID2, 0,  { &next[2],
+                                      &lastVisited[2],
+                                      dependencies,
+                                      2 },
+                      k_NUM_VALUES },
+                };
+
+                bslmt::ThreadGroup threadGroup(&ta);
+                for (int i = 0; i < 3; ++i) {
+                    ASSERT(0 == threadGroup.addThread(consumers[i]));
+                }
+                Producer producer = { &mX, k_NUM_VALUES };
+                ASSERT(0 == threadGroup.addThread(producer));
+
+                threadGroup.joinAll();
+
+                ASSERTV(CAPACITY, k_NUM_VALUES - 1 == lastVisited[2]);
+            }
+        }
+
+        if (verbose) cout << "\nRegistering dependents while pushing."
+                          << endl;
+        {
+            enum { k_NUM_VALUES = 100000, k_NUM_REGISTRATIONS = 5000 };
+
+            const int CAPACITIES[] = { 1, 4, 16 };
+            for (int ti = 0; ti < 3; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                Obj mX(CAPACITY, 2, &ta);
+
+                const int ID = mX.addConsumer();
+                ASSERT(0 <= ID);
+
+                int             next = 0;
+                bsls::AtomicInt lastVisited(-1);
+
+                // The dependency consumes in batches of one value, so that it
+                // records each value as visited before releasing it.
+
+                Consumer consumer = {
+                    &mX, ID, 1, { &next, &lastVisited, 0, 0 }, k_NUM_VALUES
+                };
+
+                bslmt::ThreadGroup threadGroup(&ta);
+                ASSERT(0 == threadGroup.addThread(consumer));
+                Producer producer = { &mX, k_NUM_VALUES };
+                ASSERT(0 == threadGroup.addThread(producer));
+
+                int numRegistrations = 0;
+                int numValues        = 0;
+                while (k_NUM_REGISTRATIONS > numRegistrations
+                    && k_NUM_VALUES - 1 > lastVisited) {
+                    const int DEPENDENT = mX.addConsumer(&ID, 1);
+                    ASSERT(0 <= DEPENDENT);
+                    ++numRegistrations;
+
+                    int previous = -1;
+                    for (int i = 0; i < 8; ++i) {
+                        int value;
+                        if (0 != mX.popFront(DEPENDENT, &value)) {
+                            break;
+                        }
+
+                        // A value read from a slot being overwritten would
+                        // not yet have been visited by the dependency, or
+                        // would not follow the previous value.
+
+                        ASSERTV(CAPACITY, value, lastVisited.load(),
+                                value <= lastVisited);
+                        ASSERTV(CAPACITY, previous, value,
+                                -1 == previous || previous + 1 == value);
+                        previous = value;
+                        ++numValues;
+                    }
+                    mX.removeConsumer(DEPENDENT);
+                }
+                threadGroup.joinAll();
+
+                if (veryVerbose) { T_ P_(numRegistrations) P(numValues) }
+
+                ASSERTV(CAPACITY, k_NUM_VALUES - 1 == lastVisited);
+            }
+        }
+
+        if (verbose) cout << "\nReleasing a blocked producer." << endl;
+        {
+            for (int release = 0; release < 2; ++release) {
+                Obj mX(4, 2, &ta);
+
+                const int ID = mX.addConsumer();
+                for (int i = 0; i < 4; ++i) {
+                    ASSERT(0 == mX.tryPushBack(i));
+                }
+                ASSERT(Obj::e_FULL == mX.tryPushBack(4));
+
+                bsls::AtomicInt           rc(1);
+                bslmt::ThreadUtil::Handle handle;
+
+                PushBack pushFour = { &mX, 4, &rc };
+
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                                   pushFour,
+                                                                   &ta));
+
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(1 == rc);  // still blocked
+
+                if (0 == release) {
+                    mX.removeConsumer(ID);
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(0 == rc);
+                }
+                else {
+                    mX.disablePushBack();
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(Obj::e_DISABLED == rc);
+                    ASSERT(4 == mX.numElements(ID));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nReleasing a blocked consumer." << endl;
+        {
+            Obj mX(4, 2, &ta);
+
+            const int ID = mX.addConsumer();
+
+            bsls::AtomicInt value(-2);
+            bsls::AtomicInt rc(1);
+            PopTwo          popTwo = { &mX, ID, &value, &rc };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                               popTwo,
+                                                               &ta));
+
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+            ASSERT(-2 == value);  // still blocked
+
+            ASSERT(0 == mX.pushBack(42));
+
+            while (-2 == value) {
+                bslmt::ThreadUtil::yield();
+            }
+            ASSERT(42 == value);
+
+            mX.disablePushBack();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(Obj::e_DISABLED == rc);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BATCHED CONSUMPTION
+        //
+        // Concerns:
+        //: 1 'tryPopFrontBatch' visits, in order, every value available to
+        //:   the consumer, up to the specified maximum, returns their number,
+        //:   and consumes them.
+        //:
+        //: 2 'tryPopFrontBatch' returns 'e_EMPTY' if no value is available,
+        //:   and 'e_DISABLED' if the ring is disabled and every value is
+        //:   consumed.
+        //:
+        //: 3 The batch of a dependent consumer ends at its barrier.
+        //:
+        //: 4 If the visitor throws, no value of the batch is consumed.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Push values, and consume them with batches of several maximum
+        //:   sizes, verifying the values visited and the numbers returned.
+        //:   (C-1..3)
+        //:
+        //: 2 Consume with a visitor that throws at a given value, and verify
+        //:   that the next batch starts with the first value of the failed
+        //:   batch.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int tryPopFrontBatch(int consumerId, const VISITOR& v, int max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BATCHED CONSUMPTION" << endl
+                                  << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nBatches of several sizes." << endl;
+        {
+            const int BATCH_SIZES[] = { 1, 2, 3, 7, 16, 100 };
+            for (int ti = 0; ti < 6; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                Obj mX(16, 2, &ta);
+
+                const int ID = mX.addConsumer();
+
+                bsl::vector<int> values(&ta);
+                Collect          collect = { &values };
+
+                ASSERTV(BATCH_SIZE,
+                        Obj::e_EMPTY == mX.tryPopFrontBatch(ID,
+                                                            collect,
+                                                            BATCH_SIZE));
+
+                int pushed = 0;
+                for (int round = 0; round < 10; ++round) {
+                    const int NUM_PUSHED = 1 + round % 16;
+                    for (int i = 0; i < NUM_PUSHED; ++i) {
+                        ASSERT(0 == mX.tryPushBack(pushed++));
+                    }
+                    int remaining = NUM_PUSHED;
+                    while (remaining) {
+                        const int EXPECTED = remaining < BATCH_SIZE
+                                           ? remaining
+                                           : BATCH_SIZE;
+                        const int rc = mX.tryPopFrontBatch(ID,
+                                                           collect,
+                                                           BATCH_SIZE);
+                        ASSERTV(BATCH_SIZE, round, rc, EXPECTED == rc);
+                        if (rc <= 0) {
+                            break;
+                        }
+                        remaining -= rc;
+                    }
+                    ASSERTV(BATCH_SIZE, round,
+                            Obj::e_EMPTY == mX.tryPopFrontBatch(ID,
+                                                                collect,
+                                                                BATCH_SIZE));
+                }
+
+                ASSERTV(BATCH_SIZE, pushed == static_cast<int>(values.size()));
+                for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+                    ASSERTV(BATCH_SIZE, i, values[i], i == values[i]);
+                }
+
+                ASSERT(0 == mX.tryPushBack(pushed));
+                mX.disablePushBack();
+                ASSERT(1 == mX.tryPopFrontBatch(ID, collect, BATCH_SIZE));
+                ASSERT(Obj::e_DISABLED == mX.tryPopFrontBatch(ID,
+                                                              collect,
+                                                              BATCH_SIZE));
+            }
+        }
+
+        if (verbose) cout << "\nBatches of a dependent consumer." << endl;
+        {
+            Obj mX(16, 2, &ta);
+
+            const int ID0 = mX.addConsumer();
+            const int ID1 = mX.addConsumer(&ID0, 1);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.tryPushBack(i));
+            }
+
+            bsl::vector<int> values0(&ta);
+            bsl::vector<int> values1(&ta);
+            Collect          collect0 = { &values0 };
+            Collect          collect1 = { &values1 };
+
+            ASSERT(Obj::e_EMPTY == mX.tryPopFrontBatch(ID1, collect1, 100));
+            ASSERT(4 == mX.tryPopFrontBatch(ID0, collect0, 4));
+            ASSERT(4 == mX.tryPopFrontBatch(ID1, collect1, 100));
+            ASSERT(Obj::e_EMPTY == mX.tryPopFrontBatch(ID1, collect1, 100));
+            ASSERT(6 == mX.tryPopFrontBatch(ID0, collect0, 100));
+            ASSERT(3 == mX.tryPopFrontBatch(ID1, collect1, 3));
+            ASSERT(3 == mX.tryPopFrontBatch(ID1, collect1, 100));
+
+            ASSERT(values0 == values1);
+            ASSERT(10 == values1.size());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nThrowing visitor." << endl;
+        {
+            Obj mX(16, 1, &ta);
+
+            const int ID = mX.addConsumer();
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.tryPushBack(i));
+            }
+
+            int     count   = 0;
+            ThrowAt throwAt = { &count, 5 };
+            try {
+                mX.tryPopFrontBatch(ID, throwAt, 100);
+                ASSERT(!"no exception");
+            }
+            catch (int value) {
+                ASSERT(5 == value);
+            }
+            ASSERT(6 == count);
+            ASSERT(10 == mX.numElements(ID));
+
+            bsl::vector<int> values(&ta);
+            Collect          collect = { &values };
+            ASSERT(10 == mX.tryPopFrontBatch(ID, collect, 100));
+            ASSERT(0 == values.front());
+        }
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(16, 2, &ta);
+
+            const int ID = mX.addConsumer();
+
+            bsl::vector<int> values(&ta);
+            Collect          collect = { &values };
+
+            ASSERT_FAIL(mX.tryPopFrontBatch(ID, collect, 0));
+            ASSERT_PASS(mX.tryPopFrontBatch(ID, collect, 1));
+            ASSERT_FAIL(mX.tryPopFrontBatch(ID + 1, collect, 1));
+            ASSERT_FAIL(mX.tryPopFrontBatch(-1, collect, 1));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // NON-BLOCKING PUSH AND POP
+        //
+        // Concerns:
+        //: 1 Every consumer receives every value pushed, in order.
+        //:
+        //: 2 'tryPushBack' returns 'e_FULL' exactly when the slowest consumer
+        //:   is 'capacity()' values behind the producer, and never if no
+        //:   consumer is registered.
+        //:
+        //: 3 'tryPopFront' returns 'e_EMPTY' exactly when no value is
+        //:   available to the consumer.
+        //:
+        //: 4 A dependent consumer receives a value only once each consumer on
+        //:   which it depends has consumed it, or has been removed.
+        //:
+        //: 5 When the ring is disabled, 'tryPushBack' returns 'e_DISABLED',
+        //:   consumers receive the values already pushed, and then
+        //:   'tryPopFront' returns 'e_DISABLED'; 'enablePushBack' restores
+        //:   normal operation.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using rings of several capacities, push and pop values with
+        //:   consumers that lag by various amounts, and verify each result
+        //:   against the values pushed and the cursors of the consumers.
+        //:   (C-1..3)
+        //:
+        //: 2 Register consumers depending on others, and verify the values
+        //:   available to them as their dependencies consume values and are
+        //:   removed.  (C-4)
+        //:
+        //: 3 Disable and enable the ring, and verify the results of the
+        //:   methods.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int tryPopFront(int consumerId, TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   void disablePushBack();
+        //   void enablePushBack();
+        //   bool isPushBackDisabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "NON-BLOCKING PUSH AND POP" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nGating by the slowest consumer." << endl;
+        {
+            const int CAPACITIES[] = { 1, 2, 4, 8, 32 };
+            for (int ti = 0; ti < 5; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                Obj mX(CAPACITY, 3, &ta);
+
+                // Without consumers, values are never gated.
+
+                for (int i = 0; i < 3 * CAPACITY; ++i) {
+                    ASSERTV(CAPACITY, i, 0 == mX.tryPushBack(-1));
+                }
+
+                const int ID[] = { mX.addConsumer(),
+                                   mX.addConsumer(),
+                                   mX.addConsumer() };
+
+                // Consumer 'c' pops one value for every 'c + 1' values pushed
+                // by the producer, while there is room.
+
+                int pushed    = 0;
+                int popped[3] = { 0, 0, 0 };
+                for (int step = 0; step < 20 * CAPACITY; ++step) {
+                    int slowest = popped[0];
+                    for (int c = 1; c < 3; ++c) {
+                        slowest = popped[c] < slowest ? popped[c] : slowest;
+                    }
+
+                    const int rc = mX.tryPushBack(pushed);
+                    if (pushed - slowest < CAPACITY) {
+                        ASSERTV(CAPACITY, step, rc, 0 == rc);
+                        ++pushed;
+                    }
+                    else {
+                        ASSERTV(CAPACITY, step, rc, Obj::e_FULL == rc);
+                    }
+
+                    for (int c = 0; c < 3; ++c) {
+                        if (step % (c + 1)) {
+                            continue;
+                        }
+                        int value = -1;
+                        const int rc = mX.tryPopFront(ID[c], &value);
+                        if (popped[c] < pushed) {
+                            ASSERTV(CAPACITY, step, c, rc, 0 == rc);
+                            ASSERTV(CAPACITY, step, c, value,
+                                    popped[c] == value);
+                            ++popped[c];
+                        }
+                        else {
+                            ASSERTV(CAPACITY, step, c, rc,
+                                    Obj::e_EMPTY == rc);
+                            ASSERTV(CAPACITY, step, c, value, -1 == value);
+                        }
+                        ASSERTV(CAPACITY, step, c,
+                             pushed - popped[c] ==
+                                      static_cast<int>(mX.numElements(ID[c])));
+                    }
+                }
+                ASSERTV(CAPACITY, pushed, 4 * CAPACITY <= pushed);
+            }
+        }
+
+        if (verbose) cout << "\nDependent consumers." << endl;
+        {
+            Obj mX(8, 4, &ta);
+
+            const int A  = mX.addConsumer();
+            const int B  = mX.addConsumer();
+            const int AB[] = { A, B };
+            const int C  = mX.addConsumer(AB, 2);
+            const int D  = mX.addConsumer(&C, 1);
+            ASSERT(0 <= A && 0 <= B && 0 <= C && 0 <= D);
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.tryPushBack(i));
+            }
+
+            int value;
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(C, &value));
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(D, &value));
+            ASSERT(4 == mX.numElements(C));
+
+            ASSERT(0 == mX.tryPopFront(A, &value));  ASSERT(0 == value);
+            ASSERT(0 == mX.tryPopFront(A, &value));  ASSERT(1 == value);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(C, &value));
+
+            ASSERT(0 == mX.tryPopFront(B, &value));  ASSERT(0 == value);
+            ASSERT(0 == mX.tryPopFront(C, &value));  ASSERT(0 == value);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(C, &value));
+
+            ASSERT(0 == mX.tryPopFront(D, &value));  ASSERT(0 == value);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(D, &value));
+
+            // Removing 'B' releases 'C' up to the cursor of 'A'.
+
+            mX.removeConsumer(B);
+            ASSERT(0 == mX.tryPopFront(C, &value));  ASSERT(1 == value);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(C, &value));
+
+            // The producer is gated by the dependent consumers too.
+
+            for (int i = 4; i < 9; ++i) {
+                ASSERT(0 == mX.tryPushBack(i));
+            }
+            ASSERT(Obj::e_FULL == mX.tryPushBack(9));
+            ASSERT(0 == mX.tryPopFront(D, &value));  ASSERT(1 == value);
+            ASSERT(0 == mX.tryPushBack(9));
+            ASSERT(Obj::e_FULL == mX.tryPushBack(10));
+
+            // Removing 'A' releases 'C' up to the values published.
+
+            mX.removeConsumer(A);
+            for (int i = 2; i < 10; ++i) {
+                ASSERTV(i, 0 == mX.tryPopFront(C, &value));
+                ASSERTV(i, value, i == value);
+            }
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(C, &value));
+        }
+
+        if (verbose) cout << "\nDisabling." << endl;
+        {
+            Obj mX(8, 2, &ta);
+            ASSERT(!mX.isPushBackDisabled());
+
+            const int A = mX.addConsumer();
+            const int B = mX.addConsumer(&A, 1);
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT(0 == mX.tryPushBack(1));
+
+            mX.disablePushBack();
+            ASSERT(mX.isPushBackDisabled());
+            mX.disablePushBack();
+            ASSERT(mX.isPushBackDisabled());
+
+            ASSERT(Obj::e_DISABLED == mX.tryPushBack(2));
+
+            int value;
+            ASSERT(Obj::e_EMPTY    == mX.tryPopFront(B, &value));
+            ASSERT(0               == mX.tryPopFront(A, &value));
+            ASSERT(0               == mX.tryPopFront(A, &value));
+            ASSERT(1               == value);
+            ASSERT(Obj::e_DISABLED == mX.tryPopFront(A, &value));
+            ASSERT(0               == mX.tryPopFront(B, &value));
+            ASSERT(0               == mX.tryPopFront(B, &value));
+            ASSERT(Obj::e_DISABLED == mX.tryPopFront(B, &value));
+            ASSERT(1               == value);
+
+            mX.enablePushBack();
+            ASSERT(!mX.isPushBackDisabled());
+            mX.enablePushBack();
+            ASSERT(!mX.isPushBackDisabled());
+
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(A, &value));
+            ASSERT(0 == mX.tryPushBack(2));
+            ASSERT(0 == mX.tryPopFront(A, &value));
+            ASSERT(2 == value);
+        }
+
+        if (verbose) cout << "\nValues of an allocating type." << endl;
+        {
+            bdlcc::BroadcastRing<bsl::string> mX(4, 2, &ta);
+
+            const int A = mX.addConsumer();
+            const int B = mX.addConsumer();
+
+            const bsl::string LONG(100, 'x', &ta);
+
+            ASSERT(0 == mX.tryPushBack(LONG));
+            ASSERT(0 == mX.tryPushBack("short"));
+
+            bsl::string value(&ta);
+            ASSERT(0 == mX.tryPopFront(A, &value));  ASSERT(LONG == value);
+            ASSERT(0 == mX.tryPopFront(B, &value));  ASSERT(LONG == value);
+            ASSERT(0 == mX.tryPopFront(A, &value));  ASSERT("short" == value);
+            ASSERT(0 == mX.tryPopFront(B, &value));  ASSERT("short" == value);
+
+            ASSERT(0 == mX.tryPushBack(LONG));
+            ASSERT(0 == mX.tryPopFront(A, &value));  ASSERT(LONG == value);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8, 2, &ta);
+
+            const int ID = mX.addConsumer();
+
+            int value;
+            ASSERT_FAIL(mX.tryPopFront(ID, 0));
+            ASSERT_FAIL(mX.tryPopFront(ID + 1, &value));
+            ASSERT_FAIL(mX.tryPopFront(-1, &value));
+            ASSERT_FAIL(mX.tryPopFront(2, &value));
+            ASSERT_PASS(mX.tryPopFront(ID, &value));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // REGISTERING CONSUMERS
+        //
+        // Concerns:
+        //: 1 'addConsumer' returns distinct non-negative identifiers, up to
+        //:   'maxConsumers()' of them, and a negative value thereafter.
+        //:
+        //: 2 'removeConsumer' makes its identifier available for reuse.
+        //:
+        //: 3 A consumer receives the values pushed after it is registered.
+        //:
+        //: 4 'addConsumer' fails for a dependency that is not a registered
+        //:   consumer, and a dependent consumer starts at its barrier.
+        //:
+        //: 5 'numElements' returns the number of values a consumer has yet to
+        //:   consume.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Register consumers until 'addConsumer' fails, remove some, and
+        //:   register them again.  (C-1..2)
+        //:
+        //: 2 Register consumers after pushing values, and verify the values
+        //:   they receive and 'numElements'.  (C-3, 5)
+        //:
+        //: 3 Register dependent consumers, with valid and invalid
+        //:   dependencies.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int addConsumer();
+        //   int addConsumer(const int *dependencies, int numDependencies);
+        //   void removeConsumer(int consumerId);
+        //   size_t numElements(int consumerId) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "REGISTERING CONSUMERS" << endl
+                                  << "=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nIdentifiers." << endl;
+        {
+            Obj mX(8, 4, &ta);
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, i == mX.addConsumer());
+            }
+            ASSERT(0 > mX.addConsumer());
+            ASSERT(0 > mX.addConsumer());
+
+            mX.removeConsumer(2);
+            mX.removeConsumer(0);
+            ASSERT(0 == mX.addConsumer());
+            ASSERT(2 == mX.addConsumer());
+            ASSERT(0 > mX.addConsumer());
+        }
+
+        if (verbose) cout << "\nStarting position." << endl;
+        {
+            Obj mX(8, 4, &ta);
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT(0 == mX.tryPushBack(1));
+
+            const int A = mX.addConsumer();
+            ASSERT(0 == mX.numElements(A));
+
+            ASSERT(0 == mX.tryPushBack(2));
+            ASSERT(1 == mX.numElements(A));
+
+            const int B = mX.addConsumer(&A, 1);
+            ASSERT(1 == mX.numElements(B));
+
+            ASSERT(0 == mX.tryPushBack(3));
+            ASSERT(2 == mX.numElements(A));
+            ASSERT(2 == mX.numElements(B));
+
+            int value;
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(B, &value));
+            ASSERT(0 == mX.tryPopFront(A, &value));
+            ASSERT(2 == value);
+            ASSERT(1 == mX.numElements(A));
+            ASSERT(0 == mX.tryPopFront(B, &value));
+            ASSERT(2 == value);
+
+            mX.removeConsumer(A);
+            const int C = mX.addConsumer();
+            ASSERT(0 == mX.numElements(C));
+            ASSERT(0 == mX.tryPushBack(4));
+            ASSERT(0 == mX.tryPopFront(C, &value));
+            ASSERT(4 == value);
+        }
+
+        if (verbose) cout << "\nDependencies." << endl;
+        {
+            Obj mX(8, 4, &ta);
+
+            const int A = mX.addConsumer();
+
+            const int INVALID[] = { A, 1 };
+            ASSERT(0 > mX.addConsumer(INVALID + 1, 1));
+            ASSERT(0 > mX.addConsumer(INVALID, 2));
+
+            const int NEGATIVE = -1;
+            ASSERT(0 > mX.addConsumer(&NEGATIVE, 1));
+
+            const int LARGE = 4;
+            ASSERT(0 > mX.addConsumer(&LARGE, 1));
+
+            const int B = mX.addConsumer(INVALID, 1);
+            ASSERT(1 == B);
+
+            const int C = mX.addConsumer(0, 0);
+            ASSERT(2 == C);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8, 4, &ta);
+
+            const int A = mX.addConsumer();
+
+            ASSERT_FAIL(mX.addConsumer(&A, -1));
+            ASSERT_FAIL(mX.addConsumer(0, 1));
+            ASSERT_PASS(mX.addConsumer(&A, 1));
+
+            ASSERT_FAIL(mX.removeConsumer(-1));
+            ASSERT_FAIL(mX.removeConsumer(4));
+            ASSERT_FAIL(mX.removeConsumer(2));
+            ASSERT_PASS(mX.removeConsumer(A));
+            ASSERT_FAIL(mX.removeConsumer(A));
+
+            ASSERT_FAIL(mX.numElements(A));
+            ASSERT_PASS(mX.numElements(1));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two.
+        //:
+        //: 2 'maxConsumers' returns the value supplied at construction.
+        //:
+        //: 3 The ring uses the supplied allocator (or the default allocator if
+        //:   none is supplied), for itself and for its values, and releases
+        //:   all memory on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct rings of several capacities and numbers of consumers,
+        //:   with and without an allocator, and verify the accessors and the
+        //:   use of memory.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   BroadcastRing(size_t capacity, int maxConsumers, Allocator *ba);
+        //   ~BroadcastRing();
+        //   size_t capacity() const;
+        //   int maxConsumers() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS AND ACCESSORS" << endl
+                                  << "======================" << endl;
+
+        const struct {
+            int         d_line;          // source line number
+            bsl::size_t d_capacity;      // requested capacity
+            int         d_maxConsumers;  // maximum number of consumers
+            bsl::size_t d_expCapacity;   // expected capacity
+        } DATA[] = {
+            //LINE  CAPACITY  MAX CONSUMERS  EXP CAPACITY
+            //----  --------  -------------  ------------
+            { L_,   1,        1,             1            },
+            { L_,   2,        1,             2            },
+            { L_,   3,        2,             4            },
+            { L_,   4,        3,             4            },
+            { L_,   5,        8,             8            },
+            { L_,   1000,     16,            1024         },
+            { L_,   1024,     64,            1024         },
+            { L_,   1025,     1,             2048         },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int         LINE          = DATA[ti].d_line;
+            const bsl::size_t CAPACITY      = DATA[ti].d_capacity;
+            const int         MAX_CONSUMERS = DATA[ti].d_maxConsumers;
+            const bsl::size_t EXP_CAPACITY  = DATA[ti].d_expCapacity;
+
+            if (veryVerbose) { T_ P_(LINE) P_(CAPACITY) P(MAX_CONSUMERS) }
+
+            bslma::TestAllocator ta("object", veryVerbose);
+            {
+                const Obj X(CAPACITY, MAX_CONSUMERS, &ta);
+                ASSERTV(LINE, EXP_CAPACITY  == X.capacity());
+                ASSERTV(LINE, MAX_CONSUMERS == X.maxConsumers());
+                ASSERTV(LINE, &ta           == X.allocator());
+                ASSERTV(LINE, !X.isPushBackDisabled());
+                ASSERTV(LINE, 0 < ta.numBlocksInUse());
+                ASSERTV(LINE, 0 == da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+            {
+                const Obj X(CAPACITY, MAX_CONSUMERS);
+                ASSERTV(LINE, EXP_CAPACITY  == X.capacity());
+                ASSERTV(LINE, &da           == X.allocator());
+                ASSERTV(LINE, 0 < da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nAllocator propagation." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+            bslma::TestAllocator sa("scratch", veryVerbose);
+
+            const bsl::string LONG(100, 'x', &sa);
+
+            bdlcc::BroadcastRing<bsl::string> mX(4, 1, &ta);
+            const bsls::Types::Int64 numBlocks = da.numBlocksTotal();
+
+            mX.addConsumer();
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.tryPushBack(LONG));
+            }
+            ASSERT(numBlocks == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator ta("object", veryVerbose);
+
+            ASSERT_FAIL(Obj(0, 1, &ta));
+            ASSERT_FAIL(Obj(1, 0, &ta));
+            ASSERT_PASS(Obj(1, 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a ring, register two consumers, and verify that each
+        //:   receives every value pushed.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        Obj mX(4, 2, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+        ASSERT(2 == X.maxConsumers());
+
+        const int A = mX.addConsumer();
+        const int B = mX.addConsumer();
+        ASSERT(0 == A);
+        ASSERT(1 == B);
+
+        int value;
+        ASSERT(Obj::e_EMPTY == mX.tryPopFront(A, &value));
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT(0 == mX.pushBack(i));
+        }
+        ASSERT(Obj::e_FULL == mX.tryPushBack(4));
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT(0 == mX.popFront(A, &value));
+            ASSERT(i == value);
+        }
+        ASSERT(Obj::e_FULL == mX.tryPushBack(4));
+        ASSERT(4 == X.numElements(B));
+
+        bsl::vector<int> values(&ta);
+        Collect          collect = { &values };
+        ASSERT(4 == mX.popFrontBatch(B, collect, 10));
+        ASSERT(4 == values.size());
+        ASSERT(3 == values.back());
+
+        ASSERT(0 == mX.tryPushBack(4));
+        ASSERT(1 == X.numElements(A));
+        ASSERT(1 == X.numElements(B));
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
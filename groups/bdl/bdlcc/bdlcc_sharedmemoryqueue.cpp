@@ -0,0 +1,761 @@
+// bdlcc_sharedmemoryqueue.cpp                                        -*-C++-*-
+#include <bdlcc_sharedmemoryqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_sharedmemoryqueue_cpp,"$Id$ $CSID$")
+
+#include <bdls_memoryutil.h>
+#include <bdls_processutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#define U_USE_FUTEX 1
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+typedef bsls::AtomicOperations              AtomicOp;
+typedef bsls::AtomicOperations::AtomicTypes AtomicTypes;
+
+enum { k_CACHE_LINE_SIZE = 64 };
+
+                       // ===============================
+                       // struct SharedMemoryQueue_Header
+                       // ===============================
+
+struct SharedMemoryQueue_Header {
+    // This 'struct' defines the layout of the header at the start of a queue
+    // file.
+
+    // DATA
+    AtomicTypes::Int64 d_magic;            // 'k_MAGIC' once initialized
+
+    int                d_numProducers;     // number of rings
+
+    int                d_ringSize;         // size of each ring
+
+    char               d_pad0[k_CACHE_LINE_SIZE - 16];
+
+    AtomicTypes::Int   d_consumerPid;      // process owning the consumer
+                                           // role, or 0
+
+    AtomicTypes::Int   d_consumerWaiting;  // 1 while the consumer waits on
+                                           // 'd_dataSignal'
+
+    AtomicTypes::Int   d_dataSignal;       // futex incremented when a
+                                           // message is published while the
+                                           // consumer waits
+
+    char               d_pad1[k_CACHE_LINE_SIZE - 12];
+};
+
+                        // =============================
+                        // struct SharedMemoryQueue_Ring
+                        // =============================
+
+struct SharedMemoryQueue_Ring {
+    // This 'struct' defines the layout of the control block of the ring of one
+    // producer.  The fields written by the producer, and those written by the
+    // consumer, are in separate cache lines.
+
+    // DATA
+    AtomicTypes::Int64 d_writeCursor;      // number of bytes published
+
+    AtomicTypes::Int   d_producerPid;      // process owning the producer
+                                           // role, or 0
+
+    AtomicTypes::Int   d_producerWaiting;  // 1 while the producer waits on
+                                           // 'd_spaceSignal'
+
+    char               d_pad0[k_CACHE_LINE_SIZE - 16];
+
+    AtomicTypes::Int64 d_readCursor;       // number of bytes consumed
+
+    AtomicTypes::Int   d_spaceSignal;      // futex incremented when a message
+                                           // is consumed while the producer
+                                           // waits
+
+    char               d_pad1[k_CACHE_LINE_SIZE - 12];
+};
+
+BSLMF_ASSERT(2 * k_CACHE_LINE_SIZE == sizeof(SharedMemoryQueue_Header));
+BSLMF_ASSERT(2 * k_CACHE_LINE_SIZE == sizeof(SharedMemoryQueue_Ring));
+
+namespace {
+
+const bsls::Types::Int64 k_MAGIC = 0x626465514d485331LL;  // "bdeQMHS1"
+
+enum {
+    k_FRAME_HEADER_SIZE = 8,   // size of the header of each message
+
+    k_FRAME_ALIGNMENT   = 8,   // alignment of each message in a ring
+
+    k_PADDING           = -1,  // frame header marking the unused end of a
+                               // ring
+
+    k_MIN_RING_SIZE     = 64,  // smallest ring
+
+    k_POLL_INTERVAL     = 200  // microseconds between polls without futexes
+};
+
+inline
+bsls::Types::Int64 frameSize(int length)
+    // Return the number of bytes occupied in a ring by a message of the
+    // specified 'length'.
+{
+    return (k_FRAME_HEADER_SIZE + length + k_FRAME_ALIGNMENT - 1)
+         & ~static_cast<bsls::Types::Int64>(k_FRAME_ALIGNMENT - 1);
+}
+
+bsl::size_t fileSize(int numProducers, int ringSize)
+    // Return the size of a queue file for the specified 'numProducers' having
+    // rings of the specified 'ringSize'.
+{
+    return sizeof(SharedMemoryQueue_Header)
+         + numProducers * (sizeof(SharedMemoryQueue_Ring)
+                           + static_cast<bsl::size_t>(ringSize));
+}
+
+bool isProcessRunning(int pid)
+    // Return 'true' if a process having the specified 'pid' is running, and
+    // 'false' otherwise.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    HANDLE process = ::OpenProcess(SYNCHRONIZE, FALSE, pid);
+    if (!process) {
+        return ERROR_ACCESS_DENIED == ::GetLastError();               // RETURN
+    }
+    const bool isRunning = WAIT_TIMEOUT == ::WaitForSingleObject(process, 0);
+    ::CloseHandle(process);
+    return isRunning;
+#else
+    return 0 == ::kill(static_cast<pid_t>(pid), 0) || EPERM == errno;
+#endif
+}
+
+int acquireRole(AtomicTypes::Int *owner)
+    // Record the current process as the owner of the role whose owner is at
+    // the specified 'owner' address, unless another process that is running
+    // (or the current process) owns it.  Return 0 on success, and a non-zero
+    // value otherwise.
+{
+    const int pid      = bdls::ProcessUtil::getProcessId();
+    int       previous = AtomicOp::getIntAcquire(owner);
+    while (true) {
+        if (0 != previous && isProcessRunning(previous)) {
+            return -1;                                                // RETURN
+        }
+        const int actual = AtomicOp::testAndSwapIntAcqRel(owner,
+                                                          previous,
+                                                          pid);
+        if (actual == previous) {
+            return 0;                                                 // RETURN
+        }
+        previous = actual;
+    }
+}
+
+void releaseRole(AtomicTypes::Int *owner)
+    // Clear the owner of the role at the specified 'owner' address if it is
+    // the current process.
+{
+    AtomicOp::testAndSwapIntAcqRel(owner,
+                                   bdls::ProcessUtil::getProcessId(),
+                                   0);
+}
+
+void waitOnSignal(AtomicTypes::Int          *signal,
+                  int                        value,
+                  const bsls::TimeInterval  *timeout)
+    // Block until the specified 'signal' no longer has the specified 'value'
+    // or, if the specified 'timeout' is not 0, until '*timeout' has elapsed;
+    // this function may also return spuriously.
+{
+#if defined(U_USE_FUTEX)
+    struct timespec  duration;
+    struct timespec *durationPtr = 0;
+    if (timeout) {
+        duration.tv_sec  = static_cast<time_t>(timeout->seconds());
+        duration.tv_nsec = timeout->nanoseconds();
+        durationPtr      = &duration;
+    }
+    ::syscall(SYS_futex,
+              reinterpret_cast<int *>(signal),
+              FUTEX_WAIT,
+              value,
+              durationPtr,
+              0,
+              0);
+#else
+    (void)signal;
+    (void)value;
+
+    int interval = k_POLL_INTERVAL;
+    if (timeout && timeout->totalMicroseconds() < interval) {
+        interval = static_cast<int>(timeout->totalMicroseconds());
+    }
+    bslmt::ThreadUtil::microSleep(interval);
+#endif
+}
+
+void wakeSignal(AtomicTypes::Int *signal)
+    // Change the value of the specified 'signal', and wake the process blocked
+    // in 'waitOnSignal' on it, if any.
+{
+    AtomicOp::addIntAcqRel(signal, 1);
+#if defined(U_USE_FUTEX)
+    ::syscall(SYS_futex,
+              reinterpret_cast<int *>(signal),
+              FUTEX_WAKE,
+              1,
+              0,
+              0,
+              0);
+#endif
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // class SharedMemoryQueue
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+int SharedMemoryQueue::map(const bsl::string& path)
+{
+    typedef bdls::FilesystemUtil FsUtil;
+
+    d_descriptor = FsUtil::open(path, FsUtil::e_OPEN, FsUtil::e_READ_WRITE);
+    if (FsUtil::k_INVALID_FD == d_descriptor) {
+        return -1;                                                    // RETURN
+    }
+
+    const FsUtil::Offset size = FsUtil::getFileSize(d_descriptor);
+    if (size < static_cast<FsUtil::Offset>(fileSize(1, k_MIN_RING_SIZE))) {
+        FsUtil::close(d_descriptor);
+        return -2;                                                    // RETURN
+    }
+
+    void *address;
+    if (0 != FsUtil::map(d_descriptor,
+                         &address,
+                         0,
+                         static_cast<bsl::size_t>(size),
+                         bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FsUtil::close(d_descriptor);
+        return -3;                                                    // RETURN
+    }
+    d_mapping_p   = static_cast<char *>(address);
+    d_mappingSize = static_cast<bsl::size_t>(size);
+    d_header_p    = reinterpret_cast<SharedMemoryQueue_Header *>(d_mapping_p);
+
+    // The sizes are read once, after the magic number that publishes them,
+    // and only the validated copies are used thereafter.
+
+    if (k_MAGIC != AtomicOp::getInt64Acquire(&d_header_p->d_magic)) {
+        unmap();
+        return -4;                                                    // RETURN
+    }
+
+    const int numProducers = d_header_p->d_numProducers;
+    const int ringSize     = d_header_p->d_ringSize;
+    if (0 >= numProducers
+     || k_MIN_RING_SIZE > ringSize
+     || 0 != (ringSize & (ringSize - 1))
+     || d_mappingSize < fileSize(numProducers, ringSize)) {
+        unmap();
+        return -4;                                                    // RETURN
+    }
+
+    d_rings_p      = reinterpret_cast<SharedMemoryQueue_Ring *>(
+                                                              d_header_p + 1);
+    d_ringData_p   = reinterpret_cast<char *>(d_rings_p + numProducers);
+    d_numProducers = numProducers;
+    d_ringSize     = ringSize;
+    return 0;
+}
+
+int SharedMemoryQueue::popFrontImp(bsl::string               *message,
+                                   const bsls::TimeInterval  *absTime)
+{
+    int rc = tryPopFront(message);
+    if (e_EMPTY != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Announce that the consumer is about to wait before checking the rings
+    // again, so that a producer publishing a message after the check sees the
+    // announcement and changes the signal.
+
+    AtomicTypes::Int *waiting = &d_header_p->d_consumerWaiting;
+    AtomicTypes::Int *signal  = &d_header_p->d_dataSignal;
+    while (true) {
+        AtomicOp::setInt(waiting, 1);
+        const int value = AtomicOp::getInt(signal);
+
+        rc = tryPopFront(message);
+        if (e_EMPTY != rc) {
+            break;
+        }
+
+        if (absTime) {
+            const bsls::TimeInterval now =
+                                          bsls::SystemTime::nowRealtimeClock();
+            if (now >= *absTime) {
+                rc = e_TIMED_OUT;
+                break;
+            }
+            const bsls::TimeInterval timeout = *absTime - now;
+            waitOnSignal(signal, value, &timeout);
+        }
+        else {
+            waitOnSignal(signal, value, 0);
+        }
+    }
+    AtomicOp::setInt(waiting, 0);
+    return rc;
+}
+
+int SharedMemoryQueue::popFromRing(bsl::string *message, int index)
+{
+    const bsls::Types::Int64 mask = d_ringSize - 1;
+
+    SharedMemoryQueue_Ring& ring = d_rings_p[index];
+
+    bsls::Types::Int64       read  =
+                                AtomicOp::getInt64Relaxed(&ring.d_readCursor);
+    const bsls::Types::Int64 write = AtomicOp::getInt64(&ring.d_writeCursor);
+    if (read == write) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    const char         *data     = ringData(index);
+    bsls::Types::Int64  position = read & mask;
+
+    // The frames are read from a file that any process may write, so a frame
+    // that is not within the data published by the producer, or whose length
+    // is out of range, is rejected without advancing the cursor.
+
+    if (0 != position % k_FRAME_ALIGNMENT
+     || write - read < k_FRAME_HEADER_SIZE) {
+        return e_FAILED;                                              // RETURN
+    }
+
+    int length;
+    bsl::memcpy(&length, data + position, sizeof length);
+    if (k_PADDING == length) {
+        read     += mask + 1 - position;
+        position  = 0;
+        if (write - read < k_FRAME_HEADER_SIZE) {
+            return e_FAILED;                                          // RETURN
+        }
+        bsl::memcpy(&length, data, sizeof length);
+    }
+
+    if (0 > length
+     || maxMessageLength() < length
+     || mask + 1 - position < frameSize(length)
+     || write - read < frameSize(length)) {
+        return e_FAILED;                                              // RETURN
+    }
+
+    message->assign(data + position + k_FRAME_HEADER_SIZE, length);
+
+    // Release the space only once the message has been copied.
+
+    AtomicOp::setInt64(&ring.d_readCursor, read + frameSize(length));
+    if (AtomicOp::getInt(&ring.d_producerWaiting)) {
+        wakeSignal(&ring.d_spaceSignal);
+    }
+    return e_SUCCESS;
+}
+
+void SharedMemoryQueue::unmap()
+{
+    bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+    bdls::FilesystemUtil::close(d_descriptor);
+
+    d_descriptor   = bdls::FilesystemUtil::k_INVALID_FD;
+    d_mapping_p    = 0;
+    d_mappingSize  = 0;
+    d_header_p     = 0;
+    d_rings_p      = 0;
+    d_ringData_p   = 0;
+    d_numProducers = 0;
+    d_ringSize     = 0;
+}
+
+// PRIVATE ACCESSORS
+char *SharedMemoryQueue::ringData(int index) const
+{
+    return d_ringData_p + static_cast<bsl::size_t>(index) * d_ringSize;
+}
+
+// CLASS METHODS
+int SharedMemoryQueue::create(const bsl::string& path,
+                              int                numProducers,
+                              int                ringSize)
+{
+    BSLS_ASSERT(0 < numProducers);
+    BSLS_ASSERT(k_MIN_RING_SIZE <= ringSize);
+    BSLS_ASSERT(0 == (ringSize & (ringSize - 1)));
+
+    typedef bdls::FilesystemUtil FsUtil;
+
+    const FileDescriptor descriptor = FsUtil::open(path,
+                                                   FsUtil::e_CREATE,
+                                                   FsUtil::e_READ_WRITE);
+    if (FsUtil::k_INVALID_FD == descriptor) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t size = fileSize(numProducers, ringSize);
+
+    void *address;
+    if (0 != FsUtil::growFile(descriptor, size)
+     || 0 != FsUtil::map(descriptor,
+                         &address,
+                         0,
+                         size,
+                         bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FsUtil::close(descriptor);
+        FsUtil::remove(path);
+        return -2;                                                    // RETURN
+    }
+
+    // The data of the rings need not be initialized.
+
+    bsl::memset(address,
+                0,
+                sizeof(SharedMemoryQueue_Header)
+                              + numProducers * sizeof(SharedMemoryQueue_Ring));
+
+    SharedMemoryQueue_Header *header =
+                            static_cast<SharedMemoryQueue_Header *>(address);
+    header->d_numProducers = numProducers;
+    header->d_ringSize     = ringSize;
+    AtomicOp::setInt64Release(&header->d_magic, k_MAGIC);
+
+    FsUtil::unmap(address, size);
+    FsUtil::close(descriptor);
+    return 0;
+}
+
+// CREATORS
+SharedMemoryQueue::SharedMemoryQueue()
+: d_descriptor(bdls::FilesystemUtil::k_INVALID_FD)
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_header_p(0)
+, d_rings_p(0)
+, d_ringData_p(0)
+, d_numProducers(0)
+, d_ringSize(0)
+, d_role(e_CLOSED)
+, d_producerIndex(-1)
+, d_cachedCursor(0)
+, d_nextRing(0)
+, d_failedRing(-1)
+{
+}
+
+SharedMemoryQueue::~SharedMemoryQueue()
+{
+    close();
+}
+
+// MANIPULATORS
+void SharedMemoryQueue::close()
+{
+    if (e_CLOSED == d_role) {
+        return;                                                       // RETURN
+    }
+
+    if (e_CONSUMER == d_role) {
+        releaseRole(&d_header_p->d_consumerPid);
+    }
+    else {
+        releaseRole(&d_rings_p[d_producerIndex].d_producerPid);
+    }
+    unmap();
+
+    d_role          = e_CLOSED;
+    d_producerIndex = -1;
+}
+
+void SharedMemoryQueue::discardRing(int index)
+{
+    BSLS_ASSERT(e_CONSUMER == d_role);
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < d_numProducers);
+
+    SharedMemoryQueue_Ring& ring = d_rings_p[index];
+
+    AtomicOp::setInt64(&ring.d_readCursor,
+                       AtomicOp::getInt64(&ring.d_writeCursor));
+    if (AtomicOp::getInt(&ring.d_producerWaiting)) {
+        wakeSignal(&ring.d_spaceSignal);
+    }
+
+    if (index == d_failedRing) {
+        d_failedRing = -1;
+    }
+}
+
+int SharedMemoryQueue::openConsumer(const bsl::string& path)
+{
+    BSLS_ASSERT(e_CLOSED == d_role);
+
+    if (0 != map(path)) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != acquireRole(&d_header_p->d_consumerPid)) {
+        unmap();
+        return -2;                                                    // RETURN
+    }
+
+    // A previous consumer may have terminated while waiting.
+
+    AtomicOp::setInt(&d_header_p->d_consumerWaiting, 0);
+
+    d_role       = e_CONSUMER;
+    d_nextRing   = 0;
+    d_failedRing = -1;
+    return 0;
+}
+
+int SharedMemoryQueue::openProducer(const bsl::string& path,
+                                    int                producerIndex)
+{
+    BSLS_ASSERT(e_CLOSED == d_role);
+    BSLS_ASSERT(0 <= producerIndex);
+
+    if (0 != map(path)) {
+        return -1;                                                    // RETURN
+    }
+    if (producerIndex >= d_numProducers) {
+        unmap();
+        return -2;                                                    // RETURN
+    }
+
+    SharedMemoryQueue_Ring& ring = d_rings_p[producerIndex];
+    if (0 != acquireRole(&ring.d_producerPid)) {
+        unmap();
+        return -3;                                                    // RETURN
+    }
+
+    // A previous producer may have terminated while waiting.
+
+    AtomicOp::setInt(&ring.d_producerWaiting, 0);
+
+    d_role          = e_PRODUCER;
+    d_producerIndex = producerIndex;
+    d_cachedCursor  = AtomicOp::getInt64Acquire(&ring.d_readCursor);
+    return 0;
+}
+
+int SharedMemoryQueue::popFront(bsl::string *message)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(e_CONSUMER == d_role);
+
+    return popFrontImp(message, 0);
+}
+
+int SharedMemoryQueue::pushBack(const char *data, int length)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(e_PRODUCER == d_role);
+
+    int rc = tryPushBack(data, length);
+    if (e_FULL != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Announce that this producer is about to wait before trying again (see
+    // 'popFrontImp').
+
+    SharedMemoryQueue_Ring& ring    = d_rings_p[d_producerIndex];
+    AtomicTypes::Int       *waiting = &ring.d_producerWaiting;
+    AtomicTypes::Int       *signal  = &ring.d_spaceSignal;
+    while (true) {
+        AtomicOp::setInt(waiting, 1);
+        const int value = AtomicOp::getInt(signal);
+
+        rc = tryPushBack(data, length);
+        if (e_FULL != rc) {
+            break;
+        }
+        waitOnSignal(signal, value, 0);
+    }
+    AtomicOp::setInt(waiting, 0);
+    return rc;
+}
+
+int SharedMemoryQueue::timedPopFront(bsl::string               *message,
+                                     const bsls::TimeInterval&  absTime)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(e_CONSUMER == d_role);
+
+    return popFrontImp(message, &absTime);
+}
+
+int SharedMemoryQueue::tryPopFront(bsl::string *message)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(e_CONSUMER == d_role);
+
+    // Visit the rings in turn, starting after the ring of the last message
+    // popped, so that no producer is starved.  A ring whose next message is
+    // corrupt is skipped, so that it does not block the other rings.
+
+    int rc    = e_EMPTY;
+    int index = d_nextRing;
+    for (int i = 0; i < d_numProducers; ++i) {
+        const int ringRc = popFromRing(message, index);
+        if (e_SUCCESS == ringRc) {
+            d_nextRing = index + 1 == d_numProducers ? 0 : index + 1;
+            return e_SUCCESS;                                         // RETURN
+        }
+        if (e_FAILED == ringRc) {
+            d_failedRing = index;
+            rc           = e_FAILED;
+        }
+        index = index + 1 == d_numProducers ? 0 : index + 1;
+    }
+    return rc;
+}
+
+int SharedMemoryQueue::tryPushBack(const char *data, int length)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(e_PRODUCER == d_role);
+
+    if (length > maxMessageLength()) {
+        return e_FAILED;                                              // RETURN
+    }
+
+    SharedMemoryQueue_Ring& ring = d_rings_p[d_producerIndex];
+
+    const bsls::Types::Int64 size     = d_ringSize;
+    const bsls::Types::Int64 write    =
+                               AtomicOp::getInt64Relaxed(&ring.d_writeCursor);
+    const bsls::Types::Int64 frame    = frameSize(length);
+    bsls::Types::Int64       position = write & (size - 1);
+
+    // A message that does not fit before the end of the ring is preceded by
+    // padding to the end of the ring.
+
+    const bsls::Types::Int64 padding = position + frame > size
+                                     ? size - position
+                                     : 0;
+    const bsls::Types::Int64 end     = write + padding + frame;
+
+    if (end - d_cachedCursor > size) {
+        d_cachedCursor = AtomicOp::getInt64(&ring.d_readCursor);
+        if (end - d_cachedCursor > size) {
+            return e_FULL;                                            // RETURN
+        }
+    }
+
+    char *buffer = ringData(d_producerIndex);
+    if (padding) {
+        const int marker = k_PADDING;
+        bsl::memcpy(buffer + position, &marker, sizeof marker);
+        position = 0;
+    }
+    bsl::memcpy(buffer + position, &length, sizeof length);
+    if (length) {
+        bsl::memcpy(buffer + position + k_FRAME_HEADER_SIZE, data, length);
+    }
+
+    // Publish the message, then wake the consumer if it is waiting (see
+    // 'popFrontImp').
+
+    AtomicOp::setInt64(&ring.d_writeCursor, end);
+    if (AtomicOp::getInt(&d_header_p->d_consumerWaiting)) {
+        wakeSignal(&d_header_p->d_dataSignal);
+    }
+    return e_SUCCESS;
+}
+
+// ACCESSORS
+int SharedMemoryQueue::failedRing() const
+{
+    BSLS_ASSERT(e_CONSUMER == d_role);
+
+    return d_failedRing;
+}
+
+int SharedMemoryQueue::maxMessageLength() const
+{
+    BSLS_ASSERT(e_CLOSED != d_role);
+
+    return d_ringSize / 2 - k_FRAME_HEADER_SIZE;
+}
+
+int SharedMemoryQueue::numProducers() const
+{
+    BSLS_ASSERT(e_CLOSED != d_role);
+
+    return d_numProducers;
+}
+
+int SharedMemoryQueue::producerIndex() const
+{
+    BSLS_ASSERT(e_PRODUCER == d_role);
+
+    return d_producerIndex;
+}
+
+int SharedMemoryQueue::ringSize() const
+{
+    BSLS_ASSERT(e_CLOSED != d_role);
+
+    return d_ringSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
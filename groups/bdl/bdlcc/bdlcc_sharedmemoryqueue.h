@@ -0,0 +1,404 @@
+// bdlcc_sharedmemoryqueue.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHAREDMEMORYQUEUE
+#define INCLUDED_BDLCC_SHAREDMEMORYQUEUE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an interprocess message queue in a memory-mapped file.
+//
+//@CLASSES:
+//  bdlcc::SharedMemoryQueue: multi-producer, single-consumer byte queue
+//
+//@SEE_ALSO: bdlcc_singleproducersingleconsumerboundedqueue,
+//            bdls_filesystemutil
+//
+//@DESCRIPTION: This component defines a mechanism, 'bdlcc::SharedMemoryQueue',
+// that passes variable-length byte messages between processes on the same
+// host through a memory-mapped file, without a system call for each message.
+// A queue file is created once, with the 'create' class method, for a fixed
+// number of producers.  Each process then opens the file, either as the single
+// consumer (with 'openConsumer'), or as the producer having one of the
+// producer indices of the file (with 'openProducer').
+//
+// The file holds one bounded ring buffer for each producer index.  A producer
+// appends a message to its own ring, and the consumer takes messages from
+// each ring in turn.  Hence, the messages of each producer are received in the
+// order in which they were pushed, but no order is defined between the
+// messages of different producers.  A producer and the consumer synchronize
+// only through the cursors of their ring, with no lock.
+//
+// The 'pushBack' and 'popFront' methods block while the ring of the producer
+// is full, and while every ring is empty, respectively.  Non-blocking methods,
+// 'tryPushBack' and 'tryPopFront', and a 'timedPopFront' method, are also
+// provided.  On Linux, blocked processes wait on a futex in the file, and a
+// process that adds (or removes) a message makes the system call that wakes a
+// waiting process only if one is waiting.  On other platforms, blocked
+// processes poll the file, sleeping between polls.
+//
+///Message Size
+///------------
+// Each message occupies, in its ring, the message bytes preceded by an 8-byte
+// header, rounded up to a multiple of 8 bytes; a message is never split across
+// the end of the ring.  The longest message accepted, 'maxMessageLength()', is
+// 8 bytes fewer than half of the size of each ring.
+//
+///Process Failure and Reattachment
+///--------------------------------
+// A producer publishes a message (by advancing the write cursor of its ring)
+// only once the message has been written in full.  A producer process that
+// terminates while writing a message therefore leaves its ring in a
+// consistent state, and the message is discarded.  Likewise, the consumer
+// consumes a message (by advancing the read cursor of the ring) only once it
+// has been copied out.
+//
+// Each producer index, and the consumer role, is owned by at most one open
+// 'SharedMemoryQueue' object at a time; the process identifier of the owner
+// is recorded in the file, and is cleared by 'close' (and by the destructor).
+// If the owning process terminates without closing the queue, another process
+// may reattach to the role (e.g., when the producer is restarted): 'open*'
+// succeeds if the recorded owner is no longer running.  A producer that
+// reattaches continues to append to its ring after the last message published
+// by the previous owner, and a consumer that reattaches continues with the
+// first message not yet consumed.  Note that, as process identifiers may be
+// reused by the operating system, a role whose owner terminated may appear
+// owned until its identifier is no longer in use.
+//
+///Corrupt Messages
+///----------------
+// Any process that maps a queue file may write to it, so the consumer
+// validates the frame of each message before copying it (see 'tryPopFront'),
+// and the number of producers and the size of the rings are read from the
+// file only when it is opened.  A ring whose next message is corrupt is
+// skipped, so that the messages of other producers are still received, and
+// its index is reported by 'failedRing'.  The consumer may then drop the
+// unconsumed messages of that ring with 'discardRing', after which the ring
+// is used again.
+//
+///Thread Safety
+///-------------
+// 'SharedMemoryQueue' is *not* thread-safe: an object must be used by one
+// thread at a time.  Any number of objects (in any number of processes) may
+// use the same file concurrently, within the constraints on roles described
+// above.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Processes
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a feed handler process publishes quotes to a strategy process
+// on the same host.  In this example, both roles are played by one process,
+// but each would normally be in a separate process.
+//
+// First, we create the queue file, for one producer, with rings of 64KB:
+//..
+//  int rc = bdlcc::SharedMemoryQueue::create(path, 1, 64 * 1024);
+//  assert(0 == rc);
+//..
+// Then, the strategy process opens the queue as its consumer:
+//..
+//  bdlcc::SharedMemoryQueue consumer;
+//  rc = consumer.openConsumer(path);
+//  assert(0 == rc);
+//..
+// Next, the feed handler opens the queue as its producer, having producer
+// index 0, and publishes a quote:
+//..
+//  bdlcc::SharedMemoryQueue producer;
+//  rc = producer.openProducer(path, 0);
+//  assert(0 == rc);
+//
+//  const char quote[] = "IBM 142.10 142.12";
+//  rc = producer.pushBack(quote, sizeof quote - 1);
+//  assert(0 == rc);
+//..
+// Now, the strategy process receives the quote:
+//..
+//  bsl::string message;
+//  rc = consumer.popFront(&message);
+//  assert(0 == rc);
+//  assert("IBM 142.10 142.12" == message);
+//..
+// Finally, each process closes the queue, and the file is removed once it is
+// no longer needed:
+//..
+//  producer.close();
+//  consumer.close();
+//
+//  bdls::FilesystemUtil::remove(path);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+struct SharedMemoryQueue_Header;
+struct SharedMemoryQueue_Ring;
+
+                          // =======================
+                          // class SharedMemoryQueue
+                          // =======================
+
+class SharedMemoryQueue {
+    // This class provides a multi-producer, single-consumer queue of byte
+    // messages in a memory-mapped file shared between processes.  An object
+    // of this class is, after being opened, either the consumer or one of the
+    // producers of a queue file.
+
+    // PRIVATE TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+
+    enum Role { e_CLOSED, e_CONSUMER, e_PRODUCER };
+
+    // DATA
+    FileDescriptor            d_descriptor;      // descriptor of the file
+
+    char                     *d_mapping_p;       // mapped file (owned)
+
+    bsl::size_t               d_mappingSize;     // size of 'd_mapping_p'
+
+    SharedMemoryQueue_Header *d_header_p;        // header of the file
+
+    SharedMemoryQueue_Ring   *d_rings_p;         // control blocks of the
+                                                 // rings
+
+    char                     *d_ringData_p;      // data of the first ring
+
+    int                       d_numProducers;    // number of rings, as
+                                                 // validated by 'map'
+
+    int                       d_ringSize;        // size of each ring, as
+                                                 // validated by 'map'
+
+    Role                      d_role;            // role of this object
+
+    int                       d_producerIndex;   // index of the ring owned by
+                                                 // this producer
+
+    bsls::Types::Int64        d_cachedCursor;    // read cursor of the ring
+                                                 // last loaded by this
+                                                 // producer
+
+    int                       d_nextRing;        // ring from which this
+                                                 // consumer pops next
+
+    int                       d_failedRing;      // ring whose next message
+                                                 // this consumer last found
+                                                 // corrupt, or -1
+
+    // NOT IMPLEMENTED
+    SharedMemoryQueue(const SharedMemoryQueue&);
+    SharedMemoryQueue& operator=(const SharedMemoryQueue&);
+
+    // PRIVATE MANIPULATORS
+    int map(const bsl::string& path);
+        // Open and map the queue file at the specified 'path', validate its
+        // header, and copy the number of producers and the ring size from
+        // it.  Return 0 on success, and a non-zero value (having closed the
+        // file) otherwise.  Note that the copies, rather than the header, are
+        // used thereafter, as the header may be modified by any process.
+
+    int popFrontImp(bsl::string *message, const bsls::TimeInterval *absTime);
+        // Load into the specified 'message' the next message of the queue,
+        // blocking until one is available or, if the specified 'absTime' is
+        // not 0, until '*absTime' is reached.  Return 0 on success, and
+        // 'e_TIMED_OUT' if the timeout expired.
+
+    int popFromRing(bsl::string *message, int index);
+        // Load into the specified 'message' the next message of the ring
+        // having the specified 'index' if one is available.  Return 0 on
+        // success, 'e_EMPTY' if the ring is empty, and 'e_FAILED' (leaving
+        // the ring and 'message' unchanged) if the next message of the ring
+        // is corrupt.
+
+    void unmap();
+        // Unmap and close the queue file.
+
+    // PRIVATE ACCESSORS
+    char *ringData(int index) const;
+        // Return the address of the data of the ring having the specified
+        // 'index'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS   =  0,
+        e_EMPTY     = -1,  // no message is available
+        e_FULL      = -2,  // the ring of the producer is full
+        e_FAILED    = -4,  // the operation is invalid
+        e_TIMED_OUT = -5   // the timeout expired
+    };
+
+    // CLASS METHODS
+    static int create(const bsl::string& path,
+                      int                numProducers,
+                      int                ringSize);
+        // Create a queue file at the specified 'path' for the specified
+        // 'numProducers', each having a ring of the specified 'ringSize'
+        // bytes.  Return 0 on success, and a non-zero value if a file exists
+        // at 'path' or the file could not be created.  The behavior is
+        // undefined unless '0 < numProducers', and 'ringSize' is a power of 2
+        // that is at least 64.  Note that the file, of about
+        // 'numProducers * ringSize' bytes, persists until it is removed.
+
+    // CREATORS
+    SharedMemoryQueue();
+        // Create a 'SharedMemoryQueue' object that is not open.
+
+    ~SharedMemoryQueue();
+        // Close this object, and destroy it.
+
+    // MANIPULATORS
+    void close();
+        // Release the role of this object, and unmap the queue file.  This
+        // method has no effect if this object is not open.
+
+    void discardRing(int index);
+        // Discard the messages of the ring of the producer having the
+        // specified 'index' that have not been consumed, so that a ring whose
+        // next message is corrupt (see 'failedRing') is used again, and set
+        // 'failedRing()' to -1 if it is 'index'.  The behavior is undefined
+        // unless this object is the consumer, and
+        // '0 <= index < numProducers()'.
+
+    int openConsumer(const bsl::string& path);
+        // Open the queue file at the specified 'path' as its consumer.  Return
+        // 0 on success, and a non-zero value if the file is not a valid queue
+        // file, or the queue has a consumer whose process is running.  The
+        // behavior is undefined if this object is open.
+
+    int openProducer(const bsl::string& path, int producerIndex);
+        // Open the queue file at the specified 'path' as its producer having
+        // the specified 'producerIndex'.  Return 0 on success, and a non-zero
+        // value if the file is not a valid queue file, 'producerIndex' is not
+        // less than the number of producers of the file, or the queue has a
+        // producer with 'producerIndex' whose process is running.  The
+        // behavior is undefined if this object is open, or unless
+        // '0 <= producerIndex'.
+
+    int popFront(bsl::string *message);
+        // Load into the specified 'message' the next message of the queue,
+        // blocking until one is available.  Return 0 on success, and a
+        // non-zero value otherwise (e.g., 'e_FAILED' if no message is
+        // available but the next message of a ring is corrupt; see
+        // 'tryPopFront').  The behavior is undefined unless this object is the
+        // consumer.
+
+    int pushBack(const char *data, int length);
+        // Append to the queue a message holding the specified 'length' bytes
+        // at the specified 'data', blocking until the ring of this producer
+        // has room for it.  Return 0 on success, and 'e_FAILED' if 'length' is
+        // greater than 'maxMessageLength()'.  The behavior is undefined unless
+        // this object is a producer, and '0 <= length'.
+
+    int timedPopFront(bsl::string               *message,
+                      const bsls::TimeInterval&  absTime);
+        // Load into the specified 'message' the next message of the queue,
+        // blocking until one is available or until the specified 'absTime'
+        // (an absolute time, measured from the epoch of the real-time clock)
+        // is reached.  Return 0 on success, 'e_TIMED_OUT' if the timeout
+        // expired, and a non-zero value otherwise.  The behavior is undefined
+        // unless this object is the consumer.
+
+    int tryPopFront(bsl::string *message);
+        // Load into the specified 'message' the next message of the queue if
+        // one is available.  A ring whose next message is corrupt (i.e., its
+        // frame is not within the data published by its producer, or its
+        // length is negative or greater than 'maxMessageLength()') is skipped,
+        // leaving the message in the ring, and its index is recorded as
+        // 'failedRing()'.  Return 0 on success, 'e_FAILED' (leaving 'message'
+        // unchanged) if no message is available but a ring was skipped, and
+        // 'e_EMPTY' otherwise.  The behavior is undefined unless this object
+        // is the consumer.
+
+    int tryPushBack(const char *data, int length);
+        // Append to the queue a message holding the specified 'length' bytes
+        // at the specified 'data' if the ring of this producer has room for
+        // it.  Return 0 on success, 'e_FULL' if the ring has no room for the
+        // message, and 'e_FAILED' if 'length' is greater than
+        // 'maxMessageLength()'.  The behavior is undefined unless this object
+        // is a producer, and '0 <= length'.
+
+    // ACCESSORS
+    int failedRing() const;
+        // Return the index of the ring whose next message this consumer most
+        // recently found corrupt, or -1 if it has found none since it was
+        // opened or that ring was discarded (see 'discardRing').  The
+        // behavior is undefined unless this object is the consumer.
+
+    bool isConsumer() const;
+        // Return 'true' if this object is open as the consumer of a queue,
+        // and 'false' otherwise.
+
+    bool isProducer() const;
+        // Return 'true' if this object is open as a producer of a queue, and
+        // 'false' otherwise.
+
+    int maxMessageLength() const;
+        // Return the length of the longest message accepted by the queue.
+        // The behavior is undefined unless this object is open.
+
+    int numProducers() const;
+        // Return the number of producers of the queue.  The behavior is
+        // undefined unless this object is open.
+
+    int producerIndex() const;
+        // Return the producer index of this object.  The behavior is
+        // undefined unless this object is a producer.
+
+    int ringSize() const;
+        // Return the size of the ring of each producer of the queue.  The
+        // behavior is undefined unless this object is open.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class SharedMemoryQueue
+                          // -----------------------
+
+// ACCESSORS
+inline
+bool SharedMemoryQueue::isConsumer() const
+{
+    return e_CONSUMER == d_role;
+}
+
+inline
+bool SharedMemoryQueue::isProducer() const
+{
+    return e_PRODUCER == d_role;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
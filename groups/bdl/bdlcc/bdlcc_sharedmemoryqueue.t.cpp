@@ -0,0 +1,1271 @@
+// bdlcc_sharedmemoryqueue.t.cpp                                      -*-C++-*-
+#include <bdlcc_sharedmemoryqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <sys/types.h>
+#include <sys/wait.h>        // 'waitpid'
+#include <unistd.h>          // 'fork', '_exit'
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a queue of byte messages in a memory-mapped
+// file.  Each object maps the file separately, so we exercise the shared
+// memory protocol within one process by using several objects (from several
+// threads), and, on POSIX platforms, across processes by forking.  We verify
+// the validation of queue files and of roles, the framing of messages of each
+// length (including messages that would straddle the end of a ring), the
+// capacity of each ring, the blocking and timed methods, and the
+// reattachment of a role whose owning process terminated without closing the
+// queue.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int create(const string& path, int numProducers, int ringSize);
+//
+// CREATORS
+// [ 2] SharedMemoryQueue();
+// [ 2] ~SharedMemoryQueue();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 3] void discardRing(int index);
+// [ 2] int openConsumer(const string& path);
+// [ 2] int openProducer(const string& path, int producerIndex);
+// [ 4] int popFront(string *message);
+// [ 4] int pushBack(const char *data, int length);
+// [ 4] int timedPopFront(string *message, const TimeInterval& absTime);
+// [ 3] int tryPopFront(string *message);
+// [ 3] int tryPushBack(const char *data, int length);
+//
+// ACCESSORS
+// [ 3] int failedRing() const;
+// [ 2] bool isConsumer() const;
+// [ 2] bool isProducer() const;
+// [ 2] int maxMessageLength() const;
+// [ 2] int numProducers() const;
+// [ 2] int producerIndex() const;
+// [ 2] int ringSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] PROCESS REATTACHMENT
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::SharedMemoryQueue Obj;
+typedef bdls::FilesystemUtil     FileUtil;
+
+// ============================================================================
+//                          GLOBAL HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdlcc_sharedmemoryqueue." << bdls::ProcessUtil::getProcessId()
+        << "." << test << ".tmp";
+    return oss.str();
+}
+
+static
+bsl::string makeMessage(int producer, int sequence, int length)
+    // Return a message of the specified 'length' whose bytes are determined
+    // by the specified 'producer' and 'sequence' number.
+{
+    bsl::string result(length, '\0');
+    for (int i = 0; i < length; ++i) {
+        result[i] = static_cast<char>(producer * 31 + sequence * 7 + i);
+    }
+    return result;
+}
+
+static
+int messageLength(int sequence, int maxLength)
+    // Return the length of the message having the specified 'sequence'
+    // number, which is at most the specified 'maxLength'.
+{
+    return (sequence * 37) % (maxLength + 1);
+}
+
+namespace {
+
+                            // ===============
+                            // struct Producer
+                            // ===============
+
+struct Producer {
+    // This 'struct' defines a functor that opens a queue file as a producer,
+    // and pushes a sequence of messages with 'pushBack'.
+
+    // DATA
+    bsl::string    d_path;           // path of the queue file
+    int            d_producerIndex;  // producer index to open
+    int            d_numMessages;    // number of messages to push
+    int            d_maxLength;      // longest message to push
+    bslmt::Barrier *d_barrier_p;     // barrier to wait on once open (held)
+
+    // MANIPULATORS
+    void operator()()
+        // Open the queue, wait on the barrier, and push the messages.
+    {
+        Obj producer;
+        ASSERTV(d_producerIndex,
+                0 == producer.openProducer(d_path, d_producerIndex));
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numMessages; ++i) {
+            const bsl::string message = makeMessage(
+                                           d_producerIndex,
+                                           i,
+                                           messageLength(i, d_maxLength));
+            ASSERTV(d_producerIndex, i, 0 == producer.pushBack(
+                                   message.data(),
+                                   static_cast<int>(message.length())));
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // The queue itself does not allocate memory.
+
+    bslma::TestAllocator da("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string path = tempFileName(test);
+
+        int rc = bdlcc::SharedMemoryQueue::create(path, 1, 64 * 1024);
+        ASSERT(0 == rc);
+
+        bdlcc::SharedMemoryQueue consumer;
+        rc = consumer.openConsumer(path);
+        ASSERT(0 == rc);
+
+        bdlcc::SharedMemoryQueue producer;
+        rc = producer.openProducer(path, 0);
+        ASSERT(0 == rc);
+
+        const char quote[] = "IBM 142.10 142.12";
+        rc = producer.pushBack(quote, sizeof quote - 1);
+        ASSERT(0 == rc);
+
+        bsl::string message;
+        rc = consumer.popFront(&message);
+        ASSERT(0 == rc);
+        ASSERT("IBM 142.10 142.12" == message);
+
+        producer.close();
+        consumer.close();
+
+        bdls::FilesystemUtil::remove(path);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PROCESS REATTACHMENT
+        //
+        // Concerns:
+        //: 1 A role whose owning process terminated without closing the queue
+        //:   can be reopened by another process.
+        //:
+        //: 2 A reattached producer continues after the last message published
+        //:   by the previous owner, and a reattached consumer continues with
+        //:   the first message not yet consumed.
+        //:
+        //: 3 Messages pushed by one process are popped by another, including
+        //:   when the consumer blocks in 'popFront'.
+        //
+        // Plan:
+        //: 1 On POSIX platforms, fork a child process that opens the queue as
+        //:   producer 0, pushes messages, and exits without closing the queue.
+        //:   Then open producer 0 in the parent, and verify that the messages
+        //:   of the child, then those of the parent, are popped.  (C-1..2)
+        //:
+        //: 2 Fork a child process that opens the queue as its consumer, pops
+        //:   some messages, and exits without closing the queue, then reopen
+        //:   the consumer in the parent, and verify the remaining messages.
+        //:   (C-1..2)
+        //:
+        //: 3 Fork a child process that pushes messages to a ring smaller than
+        //:   their total size, while the parent pops them with 'popFront'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   PROCESS REATTACHMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PROCESS REATTACHMENT" << endl
+                                  << "====================" << endl;
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+        if (verbose) cout << "Not supported on this platform." << endl;
+#else
+        const bsl::string path = tempFileName(test);
+        ASSERT(0 == Obj::create(path, 2, 1024));
+
+        if (verbose) cout << "\nReattaching a producer." << endl;
+        {
+            cout << bsl::flush;
+
+            pid_t child = ::fork();
+            if (0 == child) {
+                Obj producer;
+                if (0 != producer.openProducer(path, 0)) {
+                    ::_exit(1);
+                }
+                for (int i = 0; i < 10; ++i) {
+                    const bsl::string message = makeMessage(0, i, 20);
+                    if (0 != producer.tryPushBack(message.data(), 20)) {
+                        ::_exit(2);
+                    }
+                }
+                ::_exit(0);  // without closing 'producer'
+            }
+            ASSERT(0 < child);
+
+            int status = -1;
+            ASSERT(child == ::waitpid(child, &status, 0));
+            ASSERTV(status, WIFEXITED(status) && 0 == WEXITSTATUS(status));
+
+            Obj producer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            for (int i = 10; i < 15; ++i) {
+                const bsl::string message = makeMessage(0, i, 20);
+                ASSERT(0 == producer.tryPushBack(message.data(), 20));
+            }
+
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            bsl::string message;
+            for (int i = 0; i < 15; ++i) {
+                ASSERTV(i, 0 == consumer.tryPopFront(&message));
+                ASSERTV(i, makeMessage(0, i, 20) == message);
+            }
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+        }
+
+        if (verbose) cout << "\nReattaching the consumer." << endl;
+        {
+            Obj producer;
+            ASSERT(0 == producer.openProducer(path, 1));
+            for (int i = 0; i < 10; ++i) {
+                const bsl::string message = makeMessage(1, i, i);
+                ASSERT(0 == producer.tryPushBack(message.data(), i));
+            }
+
+            cout << bsl::flush;
+
+            pid_t child = ::fork();
+            if (0 == child) {
+                Obj         consumer;
+                bsl::string message;
+                if (0 != consumer.openConsumer(path)) {
+                    ::_exit(1);
+                }
+                for (int i = 0; i < 4; ++i) {
+                    if (0 != consumer.popFront(&message)
+                     || makeMessage(1, i, i) != message) {
+                        ::_exit(2);
+                    }
+                }
+                ::_exit(0);  // without closing 'consumer'
+            }
+            ASSERT(0 < child);
+
+            int status = -1;
+            ASSERT(child == ::waitpid(child, &status, 0));
+            ASSERTV(status, WIFEXITED(status) && 0 == WEXITSTATUS(status));
+
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            bsl::string message;
+            for (int i = 4; i < 10; ++i) {
+                ASSERTV(i, 0 == consumer.tryPopFront(&message));
+                ASSERTV(i, makeMessage(1, i, i) == message);
+            }
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+        }
+
+        if (verbose) cout << "\nBlocking across processes." << endl;
+        {
+            enum { k_NUM_MESSAGES = 2000 };
+
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            cout << bsl::flush;
+
+            pid_t child = ::fork();
+            if (0 == child) {
+                Obj producer;
+                if (0 != producer.openProducer(path, 1)) {
+                    ::_exit(1);
+                }
+                const int maxLength = producer.maxMessageLength();
+                for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+                    const bsl::string message =
+                           makeMessage(1, i, messageLength(i, maxLength));
+                    if (0 != producer.pushBack(
+                                  message.data(),
+                                  static_cast<int>(message.length()))) {
+                        ::_exit(2);
+                    }
+                }
+                producer.close();
+                ::_exit(0);
+            }
+            ASSERT(0 < child);
+
+            const int   maxLength = consumer.maxMessageLength();
+            bsl::string message;
+            for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+                ASSERTV(i, 0 == consumer.popFront(&message));
+                ASSERTV(i, makeMessage(1, i, messageLength(i, maxLength))
+                                                                  == message);
+            }
+
+            int status = -1;
+            ASSERT(child == ::waitpid(child, &status, 0));
+            ASSERTV(status, WIFEXITED(status) && 0 == WEXITSTATUS(status));
+        }
+
+        FileUtil::remove(path);
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BLOCKING AND CONCURRENCY
+        //
+        // Concerns:
+        //: 1 'pushBack' blocks while the ring of the producer is full, and
+        //:   resumes when the consumer pops messages.
+        //:
+        //: 2 'popFront' blocks while every ring is empty, and resumes when a
+        //:   producer pushes a message.
+        //:
+        //: 3 The messages of each producer are popped in the order in which
+        //:   they were pushed, when several producers push concurrently.
+        //:
+        //: 4 'timedPopFront' returns 'e_TIMED_OUT' once the timeout expires
+        //:   if no message is available, and a message otherwise.
+        //:
+        //: 5 'pushBack' fails for a message longer than 'maxMessageLength'.
+        //
+        // Plan:
+        //: 1 Create a queue with small rings, and start one thread for each
+        //:   producer, each of which pushes many messages of varying lengths.
+        //:   In the main thread, pop every message with 'popFront', and
+        //:   verify that the messages of each producer arrive in order and
+        //:   are intact.  (C-1..3)
+        //:
+        //: 2 Call 'timedPopFront' on an empty queue with a short timeout, and
+        //:   verify the result and the time elapsed; then push a message and
+        //:   verify that it is returned.  (C-4)
+        //:
+        //: 3 Call 'pushBack' with a message one byte longer than the maximum.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int popFront(string *message);
+        //   int pushBack(const char *data, int length);
+        //   int timedPopFront(string *message, const TimeInterval& absTime);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BLOCKING AND CONCURRENCY" << endl
+                                  << "========================" << endl;
+
+        const bsl::string path = tempFileName(test);
+
+        if (verbose) cout << "\nConcurrent producers." << endl;
+        {
+            enum { k_NUM_PRODUCERS = 4, k_NUM_MESSAGES = 5000 };
+
+            ASSERT(0 == Obj::create(path, k_NUM_PRODUCERS, 256));
+
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            const int maxLength = consumer.maxMessageLength();
+
+            bslma::TestAllocator        ta("threads", veryVerbose);
+            bslmt::Barrier              barrier(k_NUM_PRODUCERS + 1);
+            bslmt::ThreadGroup          threadGroup(&ta);
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                Producer producer = { path,
+                                      i,
+                                      k_NUM_MESSAGES,
+                                      maxLength,
+                                      &barrier };
+                ASSERT(0 == threadGroup.addThread(producer));
+            }
+            barrier.wait();
+
+            int         nextSequence[k_NUM_PRODUCERS] = { 0 };
+            bsl::string message;
+            for (int i = 0; i < k_NUM_PRODUCERS * k_NUM_MESSAGES; ++i) {
+                ASSERTV(i, 0 == consumer.popFront(&message));
+
+                // Identify the producer by its first byte (or, for an empty
+                // message, by elimination of the producers whose next message
+                // is not empty).
+
+                bool found = false;
+                for (int p = 0; p < k_NUM_PRODUCERS && !found; ++p) {
+                    const int sequence = nextSequence[p];
+                    if (k_NUM_MESSAGES <= sequence) {
+                        continue;
+                    }
+                    if (makeMessage(p,
+                                    sequence,
+                                    messageLength(sequence, maxLength))
+                                                                 == message) {
+                        ++nextSequence[p];
+                        found = true;
+                    }
+                }
+                ASSERTV(i, message.length(), found);
+                if (!found) {
+                    break;
+                }
+            }
+            threadGroup.joinAll();
+
+            for (int p = 0; p < k_NUM_PRODUCERS; ++p) {
+                ASSERTV(p, nextSequence[p], k_NUM_MESSAGES == nextSequence[p]);
+            }
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nTimed pop." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 1, 64));
+
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            bsl::string message;
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+            ASSERT(Obj::e_TIMED_OUT == consumer.timedPopFront(
+                          &message,
+                          bsls::SystemTime::nowRealtimeClock()
+                                            + bsls::TimeInterval(0.05)));
+            stopwatch.stop();
+            ASSERTV(stopwatch.elapsedTime(), 0.04 <= stopwatch.elapsedTime());
+
+            ASSERT(Obj::e_TIMED_OUT == consumer.timedPopFront(
+                                      &message,
+                                      bsls::SystemTime::nowRealtimeClock()));
+
+            Obj producer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == producer.pushBack("abc", 3));
+
+            ASSERT(0 == consumer.timedPopFront(
+                                       &message,
+                                       bsls::SystemTime::nowRealtimeClock()
+                                                   + bsls::TimeInterval(10)));
+            ASSERT("abc" == message);
+
+            const bsl::string tooLong(producer.maxMessageLength() + 1, 'x');
+            ASSERT(Obj::e_FAILED == producer.pushBack(
+                                       tooLong.data(),
+                                       static_cast<int>(tooLong.length())));
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NON-BLOCKING PUSH AND POP
+        //
+        // Concerns:
+        //: 1 Messages of every length from 0 to 'maxMessageLength()' are
+        //:   popped as pushed, including messages that would straddle the end
+        //:   of the ring.
+        //:
+        //: 2 'tryPushBack' returns 'e_FULL' exactly when the ring has no room
+        //:   for the message, and 'e_FAILED' for a message longer than
+        //:   'maxMessageLength()'.
+        //:
+        //: 3 'tryPopFront' returns 'e_EMPTY' exactly when every ring is empty.
+        //:
+        //: 4 'tryPopFront' takes messages from the rings in turn.
+        //:
+        //: 5 'tryPopFront' returns 'e_FAILED', without changing the message or
+        //:   consuming the frame, if the length of the next frame (as written
+        //:   in the file) is negative, greater than 'maxMessageLength()',
+        //:   beyond the end of the ring, or beyond the data published by the
+        //:   producer.
+        //:
+        //: 6 A ring whose next message is corrupt is reported by
+        //:   'failedRing' and does not block the messages of other rings, and
+        //:   'discardRing' makes it usable again.
+        //:
+        //: 7 The number of producers and the ring size are unaffected by a
+        //:   change to the header of the file after it is opened.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each message length, push and pop a sequence of messages
+        //:   of that length, so that, over all lengths, the messages wrap
+        //:   around the end of the ring at every offset.  (C-1)
+        //:
+        //: 2 Push messages of a fixed length until 'tryPushBack' fails, and
+        //:   verify the number pushed against the size of the ring, then pop
+        //:   one message and verify that one more can be pushed.  (C-2..3)
+        //:
+        //: 3 Push messages to three rings, and verify the order in which they
+        //:   are popped.  (C-4)
+        //:
+        //: 4 Push a message, overwrite the length in its frame header through
+        //:   the file with each kind of invalid value, and verify that
+        //:   'tryPopFront' fails and leaves the message in the queue; then
+        //:   restore the length and verify that the message is popped.  (C-5)
+        //:
+        //: 5 Push messages to two rings, corrupt the first frame of one ring,
+        //:   and verify that the messages of the other ring are popped, that
+        //:   the corrupt ring is then reported, and that, once it is
+        //:   discarded, both rings are used again.  (C-6)
+        //:
+        //: 6 Overwrite the sizes in the header of an open queue file, and
+        //:   verify that the accessors, and pushing and popping messages, are
+        //:   unaffected.  (C-7)
+        //:
+        //: 7 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments and roles.  (C-8)
+        //
+        // Testing:
+        //   void discardRing(int index);
+        //   int tryPopFront(string *message);
+        //   int tryPushBack(const char *data, int length);
+        //   int failedRing() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "NON-BLOCKING PUSH AND POP" << endl
+                                  << "=========================" << endl;
+
+        const bsl::string path = tempFileName(test);
+
+        if (verbose) cout << "\nMessages of each length." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 1, 256));
+
+            Obj producer;
+            Obj consumer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == consumer.openConsumer(path));
+
+            const int maxLength = producer.maxMessageLength();
+            ASSERTV(maxLength, 120 == maxLength);
+
+            bsl::string message;
+            for (int length = 0; length <= maxLength; ++length) {
+                for (int i = 0; i < 7; ++i) {
+                    const bsl::string EXPECTED = makeMessage(length,
+                                                             i,
+                                                             length);
+
+                    ASSERTV(length, i, 0 == producer.tryPushBack(
+                                                              EXPECTED.data(),
+                                                              length));
+                    ASSERTV(length, i, 0 == consumer.tryPopFront(&message));
+                    ASSERTV(length, i, EXPECTED == message);
+                }
+                ASSERTV(length,
+                        Obj::e_EMPTY == consumer.tryPopFront(&message));
+            }
+
+            const bsl::string tooLong(maxLength + 1, 'x');
+            ASSERT(Obj::e_FAILED == producer.tryPushBack(tooLong.data(),
+                                                         maxLength + 1));
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nCapacity." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 1, 1024));
+
+            Obj producer;
+            Obj consumer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == consumer.openConsumer(path));
+
+            const int LENGTHS[] = { 0, 1, 8, 9, 24, 100 };
+            for (int ti = 0; ti < 6; ++ti) {
+                const int         LENGTH = LENGTHS[ti];
+                const bsl::string data(LENGTH, 'y');
+                const int         FRAME  = (8 + LENGTH + 7) / 8 * 8;
+
+                int numPushed = 0;
+                while (0 == producer.tryPushBack(data.data(), LENGTH)) {
+                    ++numPushed;
+                }
+                ASSERTV(LENGTH, Obj::e_FULL == producer.tryPushBack(
+                                                                data.data(),
+                                                                LENGTH));
+
+                // The ring holds every whole frame, except that a frame that
+                // would straddle the end of the ring leaves the space before
+                // the end (at most 'FRAME - 8' bytes) unused.
+
+                ASSERTV(LENGTH, numPushed,
+                        (1024 - FRAME + 8) / FRAME <= numPushed);
+                ASSERTV(LENGTH, numPushed, numPushed * FRAME <= 1024);
+
+                bsl::string message;
+                ASSERTV(LENGTH, 0 == consumer.tryPopFront(&message));
+                ASSERTV(LENGTH, data == message);
+                if (0 == 1024 % FRAME) {
+                    ASSERTV(LENGTH, 0 == producer.tryPushBack(data.data(),
+                                                              LENGTH));
+                    ++numPushed;
+                }
+                for (int i = 1; i < numPushed; ++i) {
+                    ASSERTV(LENGTH, i, 0 == consumer.tryPopFront(&message));
+                }
+                ASSERTV(LENGTH,
+                        Obj::e_EMPTY == consumer.tryPopFront(&message));
+            }
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nRings in turn." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 3, 256));
+
+            Obj producers[3];
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == producers[i].openProducer(path, i));
+            }
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+
+            // Ring 0 holds "a0" and "a1", ring 1 holds nothing, and ring 2
+            // holds "c0", "c1", and "c2".
+
+            ASSERT(0 == producers[0].tryPushBack("a0", 2));
+            ASSERT(0 == producers[0].tryPushBack("a1", 2));
+            ASSERT(0 == producers[2].tryPushBack("c0", 2));
+            ASSERT(0 == producers[2].tryPushBack("c1", 2));
+            ASSERT(0 == producers[2].tryPushBack("c2", 2));
+
+            const char *EXPECTED[] = { "a0", "c0", "a1", "c1", "c2" };
+
+            bsl::string message;
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, 0 == consumer.tryPopFront(&message));
+                ASSERTV(i, message, EXPECTED[i] == message);
+            }
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            for (int i = 0; i < 3; ++i) {
+                producers[i].close();
+            }
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nCorrupt frames." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 1, 256));
+
+            Obj producer;
+            Obj consumer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == consumer.openConsumer(path));
+
+            ASSERT(0 == producer.tryPushBack("hello", 5));
+
+            // The data of the only ring follows the header of the file and the
+            // control block of the ring (128 bytes each), and starts with the
+            // 4-byte length of the frame of "hello".
+
+            const FileUtil::FileDescriptor fd = FileUtil::open(
+                                                  path,
+                                                  FileUtil::e_OPEN,
+                                                  FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            const int LENGTHS[] = {
+                -2,          // negative
+                -1,          // padding beyond the data published
+                121,         // greater than 'maxMessageLength()'
+                100,         // beyond the data published
+                0x7fffffff,  // huge
+            };
+            for (int ti = 0; ti < 5; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                ASSERTV(LENGTH, 256 == FileUtil::seek(
+                                         fd,
+                                         256,
+                                         FileUtil::e_SEEK_FROM_BEGINNING));
+                ASSERTV(LENGTH, 4 == FileUtil::write(fd, &LENGTH, 4));
+
+                bsl::string message("unchanged");
+                ASSERTV(LENGTH,
+                        Obj::e_FAILED == consumer.tryPopFront(&message));
+                ASSERTV(LENGTH, "unchanged" == message);
+            }
+
+            const int LENGTH = 5;
+            ASSERT(256 == FileUtil::seek(fd,
+                                         256,
+                                         FileUtil::e_SEEK_FROM_BEGINNING));
+            ASSERT(4 == FileUtil::write(fd, &LENGTH, 4));
+            ASSERT(0 == FileUtil::close(fd));
+
+            bsl::string message;
+            ASSERT(0 == consumer.tryPopFront(&message));
+            ASSERT("hello" == message);
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nCorrupt ring among several." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 2, 256));
+
+            Obj producers[2];
+            for (int i = 0; i < 2; ++i) {
+                ASSERTV(i, 0 == producers[i].openProducer(path, i));
+            }
+            Obj consumer;
+            ASSERT(0 == consumer.openConsumer(path));
+            ASSERT(-1 == consumer.failedRing());
+
+            ASSERT(0 == producers[0].tryPushBack("a0", 2));
+            ASSERT(0 == producers[0].tryPushBack("a1", 2));
+            ASSERT(0 == producers[1].tryPushBack("b0", 2));
+            ASSERT(0 == producers[1].tryPushBack("b1", 2));
+
+            // The data of ring 0 follows the header of the file and the
+            // control blocks of both rings (128 bytes each), and starts with
+            // the 4-byte length of the frame of "a0".
+
+            const FileUtil::FileDescriptor fd = FileUtil::open(
+                                                  path,
+                                                  FileUtil::e_OPEN,
+                                                  FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            const int LENGTH = -2;
+            ASSERT(384 == FileUtil::seek(fd,
+                                         384,
+                                         FileUtil::e_SEEK_FROM_BEGINNING));
+            ASSERT(4 == FileUtil::write(fd, &LENGTH, 4));
+            ASSERT(0 == FileUtil::close(fd));
+
+            // Ring 0 is skipped, and the messages of ring 1 are still
+            // received.
+
+            bsl::string message;
+            ASSERT(0 == consumer.tryPopFront(&message));
+            ASSERT("b0" == message);
+            ASSERT(0 == consumer.failedRing());
+            ASSERT(0 == consumer.popFront(&message));
+            ASSERT("b1" == message);
+
+            message = "unchanged";
+            ASSERT(Obj::e_FAILED == consumer.tryPopFront(&message));
+            ASSERT("unchanged" == message);
+            ASSERT(Obj::e_FAILED == consumer.popFront(&message));
+            ASSERT(0 == consumer.failedRing());
+
+            // Discarding ring 0 lets its producer continue.
+
+            consumer.discardRing(0);
+            ASSERT(-1 == consumer.failedRing());
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            ASSERT(0 == producers[0].tryPushBack("a2", 2));
+            ASSERT(0 == producers[1].tryPushBack("b2", 2));
+            ASSERT(0 == consumer.tryPopFront(&message));
+            ASSERT("a2" == message);
+            ASSERT(0 == consumer.tryPopFront(&message));
+            ASSERT("b2" == message);
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            for (int i = 0; i < 2; ++i) {
+                producers[i].close();
+            }
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nHeader rewritten after opening." << endl;
+        {
+            ASSERT(0 == Obj::create(path, 1, 256));
+
+            Obj producer;
+            Obj consumer;
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == consumer.openConsumer(path));
+
+            // The number of producers and the ring size follow the 8-byte
+            // magic number of the header.
+
+            const FileUtil::FileDescriptor fd = FileUtil::open(
+                                                  path,
+                                                  FileUtil::e_OPEN,
+                                                  FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            const int SIZES[] = { 1000, 1 << 30 };
+            ASSERT(8 == FileUtil::seek(fd,
+                                       8,
+                                       FileUtil::e_SEEK_FROM_BEGINNING));
+            ASSERT(8 == FileUtil::write(fd, SIZES, 8));
+            ASSERT(0 == FileUtil::close(fd));
+
+            ASSERT(1   == consumer.numProducers());
+            ASSERT(256 == consumer.ringSize());
+            ASSERT(120 == producer.maxMessageLength());
+
+            const bsl::string data(100, 'z');
+            bsl::string       message;
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, 0 == producer.tryPushBack(data.data(), 100));
+                ASSERTV(i, 0 == consumer.tryPopFront(&message));
+                ASSERTV(i, data == message);
+            }
+            ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT(0 == Obj::create(path, 1, 64));
+
+            Obj         closed;
+            Obj         producer;
+            Obj         consumer;
+            bsl::string message;
+
+            ASSERT(0 == producer.openProducer(path, 0));
+            ASSERT(0 == consumer.openConsumer(path));
+
+            ASSERT_FAIL(producer.tryPushBack(0, 1));
+            ASSERT_FAIL(producer.tryPushBack("a", -1));
+            ASSERT_PASS(producer.tryPushBack(0, 0));
+            ASSERT_FAIL(consumer.tryPushBack("a", 1));
+            ASSERT_FAIL(closed.tryPushBack("a", 1));
+
+            ASSERT_FAIL(consumer.tryPopFront(0));
+            ASSERT_FAIL(producer.tryPopFront(&message));
+            ASSERT_PASS(consumer.tryPopFront(&message));
+
+            ASSERT_FAIL(consumer.discardRing(-1));
+            ASSERT_FAIL(consumer.discardRing(1));
+            ASSERT_FAIL(producer.discardRing(0));
+            ASSERT_PASS(consumer.discardRing(0));
+            ASSERT_FAIL(producer.failedRing());
+            ASSERT_PASS(consumer.failedRing());
+
+            ASSERT_FAIL(closed.openProducer(path, -1));
+            ASSERT_FAIL(producer.openConsumer(path));
+
+            ASSERT_FAIL(Obj::create(path + ".x", 0, 64));
+            ASSERT_FAIL(Obj::create(path + ".x", 1, 32));
+            ASSERT_FAIL(Obj::create(path + ".x", 1, 96));
+
+            producer.close();
+            consumer.close();
+            FileUtil::remove(path);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATE, OPEN, AND CLOSE
+        //
+        // Concerns:
+        //: 1 'create' creates a queue file of the requested geometry, and
+        //:   fails if a file exists at the path.
+        //:
+        //: 2 'openConsumer' and 'openProducer' fail for a missing file, and
+        //:   for a file that is not a queue file.
+        //:
+        //: 3 'openProducer' fails for a producer index that is out of range.
+        //:
+        //: 4 A role owned by an open object (of a running process) cannot be
+        //:   opened by another object, and can be once the owner is closed
+        //:   (or destroyed).
+        //:
+        //: 5 The accessors report the role and the geometry of the queue.
+        //:
+        //: 6 The queue does not allocate memory.
+        //
+        // Plan:
+        //: 1 Create queue files of several geometries, and open them, and
+        //:   verify the accessors.  (C-1, 5)
+        //:
+        //: 2 Attempt to open a missing file, an empty file, and a file of
+        //:   arbitrary bytes.  (C-2)
+        //:
+        //: 3 Open every role twice, and verify that the second attempt fails
+        //:   until the first object is closed.  (C-3..4)
+        //:
+        //: 4 Verify that the default allocator is not used.  (C-6)
+        //
+        // Testing:
+        //   static int create(const string& path, int numProducers, int size);
+        //   SharedMemoryQueue();
+        //   ~SharedMemoryQueue();
+        //   void close();
+        //   int openConsumer(const string& path);
+        //   int openProducer(const string& path, int producerIndex);
+        //   bool isConsumer() const;
+        //   bool isProducer() const;
+        //   int maxMessageLength() const;
+        //   int numProducers() const;
+        //   int producerIndex() const;
+        //   int ringSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATE, OPEN, AND CLOSE" << endl
+                                  << "=======================" << endl;
+
+        const bsl::string path = tempFileName(test);
+
+        if (verbose) cout << "\nGeometries." << endl;
+        {
+            const struct {
+                int d_line;          // source line number
+                int d_numProducers;  // number of producers
+                int d_ringSize;      // size of each ring
+            } DATA[] = {
+                //LINE  NUM PRODUCERS  RING SIZE
+                //----  -------------  ---------
+                { L_,   1,             64        },
+                { L_,   1,             4096      },
+                { L_,   3,             128       },
+                { L_,   8,             65536     },
+            };
+            enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+                const int LINE          = DATA[ti].d_line;
+                const int NUM_PRODUCERS = DATA[ti].d_numProducers;
+                const int RING_SIZE     = DATA[ti].d_ringSize;
+
+                if (veryVerbose) { T_ P_(LINE) P_(NUM_PRODUCERS) P(RING_SIZE) }
+
+                const bsls::Types::Int64 numAllocations = da.numAllocations();
+
+                ASSERTV(LINE,
+                        0 == Obj::create(path, NUM_PRODUCERS, RING_SIZE));
+                ASSERTV(LINE,
+                        0 != Obj::create(path, NUM_PRODUCERS, RING_SIZE));
+                ASSERTV(LINE, NUM_PRODUCERS * RING_SIZE <
+                                                  FileUtil::getFileSize(path));
+
+                Obj consumer;
+                ASSERTV(LINE, !consumer.isConsumer());
+                ASSERTV(LINE, !consumer.isProducer());
+
+                ASSERTV(LINE, 0 == consumer.openConsumer(path));
+                ASSERTV(LINE,  consumer.isConsumer());
+                ASSERTV(LINE, !consumer.isProducer());
+                ASSERTV(LINE, NUM_PRODUCERS == consumer.numProducers());
+                ASSERTV(LINE, RING_SIZE     == consumer.ringSize());
+                ASSERTV(LINE, RING_SIZE / 2 - 8 ==
+                                                  consumer.maxMessageLength());
+
+                {
+                    Obj other;
+                    ASSERTV(LINE, 0 != other.openConsumer(path));
+                    ASSERTV(LINE, !other.isConsumer());
+                }
+
+                for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                    Obj producer;
+                    ASSERTV(LINE, i, 0 == producer.openProducer(path, i));
+                    ASSERTV(LINE, i,  producer.isProducer());
+                    ASSERTV(LINE, i, !producer.isConsumer());
+                    ASSERTV(LINE, i, i == producer.producerIndex());
+                    ASSERTV(LINE, i, NUM_PRODUCERS == producer.numProducers());
+                    ASSERTV(LINE, i, RING_SIZE     == producer.ringSize());
+
+                    Obj other;
+                    ASSERTV(LINE, i, 0 != other.openProducer(path, i));
+                    ASSERTV(LINE, i, !other.isProducer());
+
+                    producer.close();
+                    ASSERTV(LINE, i, !producer.isProducer());
+
+                    ASSERTV(LINE, i, 0 == other.openProducer(path, i));
+                }
+                {
+                    Obj producer;
+                    ASSERTV(LINE, 0 != producer.openProducer(path,
+                                                             NUM_PRODUCERS));
+                    ASSERTV(LINE, !producer.isProducer());
+                }
+
+                consumer.close();
+                ASSERTV(LINE, !consumer.isConsumer());
+                consumer.close();
+
+                {
+                    Obj other;
+                    ASSERTV(LINE, 0 == other.openConsumer(path));
+                }
+                {
+                    Obj other;
+                    ASSERTV(LINE, 0 == other.openConsumer(path));
+                }
+
+                ASSERTV(LINE, numAllocations == da.numAllocations());
+
+                ASSERTV(LINE, 0 == FileUtil::remove(path));
+            }
+        }
+
+        if (verbose) cout << "\nInvalid files." << endl;
+        {
+            Obj mX;
+            ASSERT(0 != mX.openConsumer(path));
+            ASSERT(0 != mX.openProducer(path, 0));
+
+            FileUtil::FileDescriptor fd = FileUtil::open(
+                                                      path,
+                                                      FileUtil::e_CREATE,
+                                                      FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+
+            ASSERT(0 != mX.openConsumer(path));
+
+            char garbage[4096];
+            for (int i = 0; i < 4096; ++i) {
+                garbage[i] = static_cast<char>(i * 13);
+            }
+            ASSERT(4096 == FileUtil::write(fd, garbage, 4096));
+            FileUtil::close(fd);
+
+            ASSERT(0 != mX.openConsumer(path));
+            ASSERT(0 != mX.openProducer(path, 0));
+            ASSERT(!mX.isConsumer());
+            ASSERT(!mX.isProducer());
+
+            ASSERT(0 != Obj::create(path, 1, 64));
+
+            FileUtil::remove(path);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, open a producer and the consumer, and pass a few
+        //:   messages.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string path = tempFileName(test);
+        ASSERT(0 == Obj::create(path, 2, 4096));
+
+        Obj consumer;
+        Obj producer;
+        ASSERT(0 == consumer.openConsumer(path));
+        ASSERT(0 == producer.openProducer(path, 1));
+
+        bsl::string message;
+        ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+        ASSERT(0 == producer.pushBack("hello", 5));
+        ASSERT(0 == producer.pushBack("", 0));
+        ASSERT(0 == producer.tryPushBack("world", 5));
+
+        ASSERT(0 == consumer.popFront(&message));
+        ASSERT("hello" == message);
+        ASSERT(0 == consumer.tryPopFront(&message));
+        ASSERT(""      == message);
+        ASSERT(0 == consumer.popFront(&message));
+        ASSERT("world" == message);
+        ASSERT(Obj::e_EMPTY == consumer.tryPopFront(&message));
+
+        producer.close();
+        consumer.close();
+
+        FileUtil::remove(path);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,62 @@
+// bdlcc_singleconsumerboundedqueue.cpp                               -*-C++-*-
+#include <bdlcc_singleconsumerboundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_singleconsumerboundedqueue_cpp,"$Id$$CSID$")
+
+///Implementation Notes
+///====================
+// The queue holds 'capacity()' nodes, a power of two, and each push is
+// identified by a 64-bit position (which never wraps in practice); the value
+// of position 'p' is stored in node 'p & (capacity() - 1)'.  Each node holds a
+// sequence number that encodes its state: the node is writable by the push at
+// position 'p' when its sequence is 'p', and readable by the pop at position
+// 'p' when its sequence is 'p + 1'.  Initially, the sequence of node 'i' is
+// 'i'.
+//
+// A producer reserves position 'p' by a compare-and-swap of the push index,
+// 'd_pushIndex', from 'p' to 'p + 1', which succeeds only if the node of 'p'
+// is writable; otherwise the queue is full (if the sequence is less than
+// 'p'), or another producer reserved 'p' first.  The producer then constructs
+// the value in the node and stores the sequence 'p + 1'.  The consumer, having
+// popped position 'p', destroys the value, stores the sequence
+// 'p + capacity()', making the node writable by the push a lap later, and
+// advances the pop index, 'd_popIndex'.  Therefore producers contend with one
+// another only on 'd_pushIndex', and the consumer writes only 'd_popIndex'
+// and the nodes that it pops; the two indices are in different cache lines.
+// Note that, since the capacity is at least 2, the sequence of a readable node
+// never equals the position of a later push to the same node.
+//
+// If the construction of a value throws, the producer marks the node for
+// reclamation and stores the sequence 'p + 1' regardless, so that the
+// consumer, which must consume positions in order, is not blocked; the
+// consumer skips such a node.
+//
+// A thread that must block (the consumer when the node at the pop index is
+// not readable, a producer when the queue is full, or a thread in
+// 'waitUntilEmpty') sets or increments a waiting flag or count under
+// 'd_mutex', and then checks its condition again, before waiting on a
+// condition variable; a thread that changes the state stores it and then reads
+// the waiting flags and counts (both with sequentially consistent operations),
+// and signals the condition variable (under 'd_mutex') only if a thread is
+// waiting.  Therefore, no wakeup is lost, and no lock is taken unless a thread
+// is blocked.
+
+namespace BloombergLP {
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1306 @@
+// bdlcc_singleconsumerboundedqueue.h                                 -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_SINGLECONSUMERBOUNDEDQUEUE
+#define INCLUDED_BDLCC_SINGLECONSUMERBOUNDEDQUEUE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-aware bounded single consumer queue of values.
+//
+//@CLASSES:
+//  bdlcc::SingleConsumerBoundedQueue: bounded MPSC concurrent queue
+//
+//@SEE_ALSO: bdlcc_singleconsumerqueue, bdlcc_boundedqueue
+//
+//@DESCRIPTION: This component defines a type,
+// 'bdlcc::SingleConsumerBoundedQueue', that provides an efficient,
+// thread-aware bounded (capacity fixed at construction) queue of values
+// assuming a single consumer (the use of 'popFront', 'popFrontBatch',
+// 'tryPopFront', 'tryPopFrontBatch', and 'removeAll' is done by one thread or
+// a group of threads using external synchronization), and any number of
+// producers.  The behavior of these methods is undefined unless the use is by
+// a single consumer.  This class is ideal for synchronization and
+// communication between threads in a producer-consumer model when there is
+// only one consumer thread (e.g., an event loop) and the memory used by the
+// queue must stay bounded under bursts of pushes.
+//
+// Unlike 'bdlcc::SingleConsumerQueue', which allocates a node for each value
+// as needed, a 'bdlcc::SingleConsumerBoundedQueue' holds its values in an
+// array allocated on construction, and never allocates memory thereafter
+// (other than that allocated by the values themselves).  The producers and the
+// consumer access the array without locks; the count of values pushed
+// (updated by the producers) and the count of values popped (updated by the
+// consumer) are kept in different cache lines, so that the producers and the
+// consumer do not contend for a cache line unless the queue is nearly empty
+// or nearly full.
+//
+// The queue provides 'pushBack' and 'popFront' methods for pushing data into
+// the queue and popping data from the queue.  When the queue is full, the
+// 'pushBack' methods block until data is removed from the queue.  When the
+// queue is empty, the 'popFront' methods block until data appears in the
+// queue.  Non-blocking methods 'tryPushBack' and 'tryPopFront' are also
+// provided.  The 'tryPushBack' method fails immediately, returning a non-zero
+// value, if the queue is full, which allows a producer to apply backpressure
+// (e.g., by discarding or coalescing data) rather than block.  The
+// 'tryPopFront' method fails immediately, returning a non-zero value, if the
+// queue is empty.
+//
+// The consumer may also remove, in one call, every value that is available
+// (up to a specified maximum) with 'popFrontBatch' (which blocks until at
+// least one value is available) or 'tryPopFrontBatch', which append the
+// values to a vector.  Note that a value is available once the push that
+// stored it completes; a push that is in progress on one thread delays the
+// values pushed after it by other threads.
+//
+// The queue may be placed into a "enqueue disabled" state using the
+// 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
+// immediately and return an error code.  Any threads blocked in 'pushBack'
+// when the queue is enqueue disabled return from 'pushBack' immediately and
+// return an error code.  The queue may be restored to normal operation with
+// the 'enablePushBack' method.
+//
+// The queue may be placed into a "dequeue disabled" state using the
+// 'disablePopFront' method.  When dequeue disabled, 'popFront',
+// 'popFrontBatch', 'tryPopFront', and 'tryPopFrontBatch' fail immediately and
+// return an error code.  Any threads blocked in 'popFront', 'popFrontBatch',
+// or 'waitUntilEmpty' when the queue is dequeue disabled return immediately
+// and return an error code.  The queue may be restored to normal operation
+// with the 'enablePopFront' method.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::SingleConsumerBoundedQueue' is a template that is parameterized on
+// the type of element contained within the queue.  The supplied template
+// argument, 'TYPE', must provide both a default constructor and a copy
+// constructor, as well as an assignment operator.  If the default constructor
+// accepts a 'bslma::Allocator *', 'TYPE' must declare the uses
+// 'bslma::Allocator' trait (see 'bslma_usesbslmaallocator') so that the
+// allocator of the queue is propagated to the elements contained in the queue.
+//
+///Exception safety
+///----------------
+// A 'bdlcc::SingleConsumerBoundedQueue' is exception neutral, and all of the
+// methods of 'bdlcc::SingleConsumerBoundedQueue' provide the basic exception
+// safety guarantee (see 'bsldoc_glossary').  If the construction of a value
+// in 'pushBack' or 'tryPushBack' throws, the element of the queue reserved for
+// the value is skipped by the consumer.
+//
+///Move Semantics in C++03
+///-----------------------
+// Move-only types are supported by 'bdlcc::SingleConsumerBoundedQueue' on
+// C++11 platforms only (where 'BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES' is
+// defined), and are not supported on C++03 platforms.  Unfortunately, in
+// C++03, there are user types where a 'bslmf::MovableRef' will not safely
+// degrade to a lvalue reference when a move constructor is not available
+// (types providing a constructor template taking any type), so
+// 'bslmf::MovableRefUtil::move' cannot be used directly on a user supplied
+// template type.  See internal bug report 99039150 for more information.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Draining Events in an Event Loop
+///- - - - - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::SingleConsumerBoundedQueue' is used to
+// pass events from several "producer" threads to the single thread of an
+// event loop, which processes every pending event in each pass of its loop.
+//
+// First, we define the type of an event, and the function that the event loop
+// uses to process an event:
+//..
+//  struct my_Event {
+//      int d_source;  // identifies the producer
+//      int d_value;   // event payload
+//  };
+//
+//  void myProcess(bsl::vector<int> *totals, const my_Event& event)
+//      // Process the specified 'event', accumulating its value into the
+//      // specified 'totals'.
+//  {
+//      (*totals)[event.d_source] += event.d_value;
+//  }
+//..
+// Then, we define the event loop, which removes every pending event (up to
+// 256 at a time) in one call to 'popFrontBatch', processes them, and reuses
+// the same vector in each pass, until the queue is dequeue disabled:
+//..
+//  void myEventLoop(bdlcc::SingleConsumerBoundedQueue<my_Event> *queue,
+//                   bsl::vector<int>                            *totals)
+//      // Process the events of the specified 'queue', accumulating their
+//      // values into the specified 'totals', until 'queue' is dequeue
+//      // disabled.
+//  {
+//      bsl::vector<my_Event> events;
+//      events.reserve(256);
+//
+//      while (0 == queue->popFrontBatch(&events, 256)) {
+//          for (bsl::size_t i = 0; i < events.size(); ++i) {
+//              myProcess(totals, events[i]);
+//          }
+//          events.clear();
+//      }
+//  }
+//..
+// Next, we define a producer, which posts its events with 'tryPushBack' and,
+// when the queue is full, applies backpressure by yielding before trying
+// again (a real producer might instead coalesce or discard events):
+//..
+//  void myProducer(bdlcc::SingleConsumerBoundedQueue<my_Event> *queue,
+//                  int                                          source,
+//                  int                                          numEvents)
+//      // Push the specified 'numEvents' events from the specified 'source'
+//      // into the specified 'queue'.
+//  {
+//      for (int i = 0; i < numEvents; ++i) {
+//          my_Event event = { source, 1 };
+//          while (0 != queue->tryPushBack(event)) {
+//              bslmt::ThreadUtil::yield();
+//          }
+//      }
+//  }
+//..
+// Finally, we create a queue of 1024 events, start the event loop and 4
+// producers, wait for the producers to finish and for the queue to empty, and
+// stop the event loop:
+//..
+//  bdlcc::SingleConsumerBoundedQueue<my_Event> queue(1024);
+//
+//  bsl::vector<int> totals(4, 0);
+//
+//  bslmt::ThreadGroup eventLoop;
+//  eventLoop.addThread(bdlf::BindUtil::bind(&myEventLoop, &queue, &totals));
+//
+//  bslmt::ThreadGroup producers;
+//  for (int i = 0; i < 4; ++i) {
+//      producers.addThread(bdlf::BindUtil::bind(&myProducer,
+//                                               &queue,
+//                                               i,
+//                                               10000));
+//  }
+//  producers.joinAll();
+//
+//  queue.waitUntilEmpty();
+//  queue.disablePopFront();
+//  eventLoop.joinAll();
+//
+//  for (int i = 0; i < 4; ++i) {
+//      assert(10000 == totals[i]);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                // ================================================
+                // class SingleConsumerBoundedQueue_PopCompleteGuard
+                // ================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerBoundedQueue_PopCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::popComplete' on a
+    // 'NODE' upon destruction.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;   // managed queue owning the managed node
+    NODE   *d_node_p;    // managed node
+    Uint64  d_position;  // position of the managed node in the queue
+
+    // NOT IMPLEMENTED
+    SingleConsumerBoundedQueue_PopCompleteGuard();
+    SingleConsumerBoundedQueue_PopCompleteGuard(
+                          const SingleConsumerBoundedQueue_PopCompleteGuard&);
+    SingleConsumerBoundedQueue_PopCompleteGuard& operator=(
+                          const SingleConsumerBoundedQueue_PopCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerBoundedQueue_PopCompleteGuard(TYPE   *queue,
+                                                NODE   *node,
+                                                Uint64  position);
+        // Create a guard managing the specified 'queue' that will invoke
+        // 'popComplete' with the specified 'node' and 'position'.
+
+    ~SingleConsumerBoundedQueue_PopCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::popComplete' method with
+        // the managed node and position.
+};
+
+             // ====================================================
+             // class SingleConsumerBoundedQueue_PushExceptionProctor
+             // ====================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerBoundedQueue_PushExceptionProctor {
+    // This class implements a proctor that invokes
+    // 'TYPE::pushExceptionComplete' on a 'NODE' upon destruction unless
+    // 'release' has been called.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;   // managed queue, or 0 if released
+    NODE   *d_node_p;    // managed node
+    Uint64  d_position;  // position of the managed node in the queue
+
+    // NOT IMPLEMENTED
+    SingleConsumerBoundedQueue_PushExceptionProctor();
+    SingleConsumerBoundedQueue_PushExceptionProctor(
+                      const SingleConsumerBoundedQueue_PushExceptionProctor&);
+    SingleConsumerBoundedQueue_PushExceptionProctor& operator=(
+                      const SingleConsumerBoundedQueue_PushExceptionProctor&);
+
+  public:
+    // CREATORS
+    SingleConsumerBoundedQueue_PushExceptionProctor(TYPE   *queue,
+                                                    NODE   *node,
+                                                    Uint64  position);
+        // Create a proctor managing the specified 'queue' that will, unless
+        // released, invoke 'pushExceptionComplete' with the specified 'node'
+        // and 'position'.
+
+    ~SingleConsumerBoundedQueue_PushExceptionProctor();
+        // Destroy this object and, if 'release' has not been invoked, invoke
+        // the 'TYPE::pushExceptionComplete' method with the managed node and
+        // position.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the queue currently managed by this
+        // proctor.
+};
+
+                   // ======================================
+                   // struct SingleConsumerBoundedQueue_Node
+                   // ======================================
+
+template <class TYPE>
+struct SingleConsumerBoundedQueue_Node {
+    // This 'struct' provides an element of the array of a
+    // 'SingleConsumerBoundedQueue'.
+
+    // PUBLIC DATA
+    bsls::AtomicOperations::AtomicTypes::Uint64
+                             d_sequence;  // position for which the node is
+                                          // writable, or one more than the
+                                          // position for which it is readable
+
+    bool                     d_reclaim;   // 'true' if the value could not be
+                                          // constructed, and 'false'
+                                          // otherwise
+
+    bsls::ObjectBuffer<TYPE> d_value;     // stored value
+};
+
+                     // ================================
+                     // class SingleConsumerBoundedQueue
+                     // ================================
+
+template <class TYPE>
+class SingleConsumerBoundedQueue {
+    // This class provides a thread-safe bounded queue of values that assumes
+    // a single consumer thread.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64                          Int64;
+    typedef bsls::Types::Uint64                         Uint64;
+    typedef bsls::AtomicOperations                      AtomicOp;
+    typedef bsls::AtomicOperations::AtomicTypes::Int    AtomicInt;
+    typedef bsls::AtomicOperations::AtomicTypes::Uint64 AtomicUint64;
+
+    typedef SingleConsumerBoundedQueue_Node<TYPE>       Node;
+
+    typedef SingleConsumerBoundedQueue_PopCompleteGuard<
+                                              SingleConsumerBoundedQueue<TYPE>,
+                                              Node>   PopGuard;
+
+    typedef SingleConsumerBoundedQueue_PushExceptionProctor<
+                                              SingleConsumerBoundedQueue<TYPE>,
+                                              Node>   PushProctor;
+
+    // DATA
+    AtomicUint64              d_pushIndex;       // position of the next
+                                                 // element to reserve for a
+                                                 // push
+
+    const char                d_pushPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                        - sizeof(AtomicUint64)];
+                                                 // padding to prevent
+                                                 // subsequent data from being
+                                                 // in the same cache line as
+                                                 // the prior data
+
+    AtomicUint64              d_popIndex;        // position of the next
+                                                 // element to pop
+
+    const char                d_popPad[  bslmt::Platform::e_CACHE_LINE_SIZE
+                                       - sizeof(AtomicUint64)];
+                                                 // padding to prevent
+                                                 // subsequent data from being
+                                                 // in the same cache line as
+                                                 // the prior data
+
+    Node                     *d_element_p;       // array of elements that
+                                                 // comprise the bounded queue
+
+    const Uint64              d_capacity;        // capacity of the queue; a
+                                                 // power of two
+
+    AtomicInt                 d_consumerWaiting; // 1 if the consumer is
+                                                 // blocked in a "pop", and 0
+                                                 // otherwise
+
+    AtomicInt                 d_numWaitingProducers;
+                                                 // number of producers blocked
+                                                 // in 'pushBack'
+
+    mutable AtomicInt         d_emptyCount;      // count of threads in
+                                                 // 'waitUntilEmpty'
+
+    AtomicInt                 d_popDisabled;     // 1 if dequeueing is
+                                                 // disabled, and 0 otherwise
+
+    AtomicInt                 d_pushDisabled;    // 1 if enqueueing is
+                                                 // disabled, and 0 otherwise
+
+    mutable bslmt::Mutex      d_mutex;           // blocking point for all
+                                                 // conditions
+
+    bslmt::Condition          d_popCondition;    // condition for blocking the
+                                                 // consumer when the queue is
+                                                 // empty
+
+    bslmt::Condition          d_pushCondition;   // condition for blocking the
+                                                 // producers when the queue is
+                                                 // full
+
+    mutable bslmt::Condition  d_emptyCondition;  // condition variable for
+                                                 // 'waitUntilEmpty'
+
+    bslma::Allocator         *d_allocator_p;     // allocator, held not owned
+
+    // FRIENDS
+    friend class SingleConsumerBoundedQueue_PopCompleteGuard<
+                                              SingleConsumerBoundedQueue<TYPE>,
+                                              Node>;
+
+    friend class SingleConsumerBoundedQueue_PushExceptionProctor<
+                                              SingleConsumerBoundedQueue<TYPE>,
+                                              Node>;
+
+    // PRIVATE MANIPULATORS
+    void popComplete(Node *node, Uint64 position);
+        // Destroy the value stored in the specified 'node' (unless it is
+        // marked for reclamation), mark the 'node' writable for the push
+        // 'capacity()' positions after the specified 'position', advance the
+        // pop index past 'position', and wake the blocked producers and the
+        // threads waiting for the queue to be empty, if any.  This method is
+        // used by a guard to complete the reclamation of a node in the
+        // presence of an exception.
+
+    int popFrontImp(TYPE *value, bool isTry);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty and the
+        // specified 'isTry' is 'false', block until it is not empty.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()',
+        // 'e_EMPTY' if 'isTry' is 'true' and the queue is empty, and
+        // 'e_FAILED' if an error occurs.
+
+    int popFrontBatchImp(bsl::vector<TYPE> *values,
+                         bsl::size_t        maxNumValues,
+                         bool               isTry);
+        // Remove the elements from the front of this queue that are
+        // available, up to the specified 'maxNumValues', and append them to
+        // the specified 'values'.  If no element is available and the
+        // specified 'isTry' is 'false', block until one is.  Return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()',
+        // 'e_EMPTY' if 'isTry' is 'true' and the queue is empty, and
+        // 'e_FAILED' if an error occurs.
+
+    int popWait(bool isTry);
+        // Wait until the element at the front of this queue is available.  If
+        // the specified 'isTry' is 'true', do not block.  Return 'e_SUCCESS'
+        // on success, 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // 'isTry' is 'true' and the element is not available, and 'e_FAILED'
+        // if an error occurs.
+
+    int pushBackImp(const TYPE& value, bool isTry);
+        // Append the specified 'value' to the back of this queue.  If the
+        // queue is full and the specified 'isTry' is 'false', block until it
+        // is not full.  Return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPushBackDisabled()', 'e_FULL' if 'isTry' is 'true' and the queue
+        // is full, and 'e_FAILED' if an error occurs.
+
+    int pushBackImp(bslmf::MovableRef<TYPE> value, bool isTry);
+        // Append the specified move-insertable 'value' to the back of this
+        // queue.  If the queue is full and the specified 'isTry' is 'false',
+        // block until it is not full.  Return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL' if 'isTry' is
+        // 'true' and the queue is full, and 'e_FAILED' if an error occurs.  On
+        // failure, 'value' is not changed.
+
+    void pushComplete(Node *node, Uint64 position);
+        // Mark the specified 'node' readable for the pop at the specified
+        // 'position', and wake the consumer if it is blocked.
+
+    void pushExceptionComplete(Node *node, Uint64 position);
+        // Mark the specified 'node' for reclamation, and complete the push at
+        // the specified 'position'.  This method is used by a proctor to
+        // release a reserved node in the presence of an exception.
+
+    int reserve(Uint64 *position, bool isTry);
+        // Reserve the element at the back of this queue for a push, and load
+        // its position into the specified 'position'.  If the queue is full
+        // and the specified 'isTry' is 'false', block until it is not full.
+        // Return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPushBackDisabled()', 'e_FULL' if 'isTry' is 'true' and the queue
+        // is full, and 'e_FAILED' if an error occurs.
+
+    // PRIVATE ACCESSORS
+    bool isReadable(Uint64 position) const;
+        // Return 'true' if the element at the specified 'position' has been
+        // pushed, and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    SingleConsumerBoundedQueue(const SingleConsumerBoundedQueue&);
+    SingleConsumerBoundedQueue& operator=(const SingleConsumerBoundedQueue&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SingleConsumerBoundedQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef TYPE value_type;  // The type for elements.
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,  // must be 0
+        e_EMPTY    = -1,
+        e_FULL     = -2,
+        e_DISABLED = -3,
+        e_FAILED   = -4
+    };
+
+    // CREATORS
+    explicit
+    SingleConsumerBoundedQueue(bsl::size_t       capacity,
+                               bslma::Allocator *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified
+        // 'capacity'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  Note that the capacity is rounded up to a power
+        // of two, and is at least 2.
+
+    ~SingleConsumerBoundedQueue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPopFrontDisabled()' and 'e_FAILED' if an error
+        // occurs.  On failure, 'value' is not changed.  Threads blocked due to
+        // the queue being empty will return 'e_DISABLED' if 'disablePopFront'
+        // is invoked.  The behavior is undefined unless the invoker of this
+        // method is the single consumer.
+
+    int popFrontBatch(bsl::vector<TYPE> *values, bsl::size_t maxNumValues);
+        // Remove the elements available at the front of this queue, up to the
+        // specified 'maxNumValues', and append them, in order, to the
+        // specified 'values'.  If the queue is empty, block until it is not
+        // empty.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success (in which case at least
+        // one element is appended), 'e_DISABLED' if 'isPopFrontDisabled()'
+        // and 'e_FAILED' if an error occurs.  On failure, 'values' is not
+        // changed.  Threads blocked due to the queue being empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
+        // undefined unless the invoker of this method is the single consumer
+        // and '0 < maxNumValues'.
+
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue.  If the
+        // queue is full, block until it is not full.  Return 0 on success, and
+        // a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // error occurs.  Threads blocked due to the queue being full will
+        // return 'e_DISABLED' if 'disablePushBack' is invoked.
+
+    int pushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to the back of this
+        // queue.  If the queue is full, block until it is not full.  'value'
+        // is left in a valid but unspecified state.  Return 0 on success, and
+        // a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // error occurs.  On failure, 'value' is not changed.  Threads blocked
+        // due to the queue being full will return 'e_DISABLED' if
+        // 'disablePushBack' is invoked.
+
+    void removeAll();
+        // Remove all items currently in this queue.  Note that this operation
+        // is not atomic; if other threads are concurrently pushing items into
+        // the queue the result of 'numElements()' after this function returns
+        // is not guaranteed to be 0.  The behavior is undefined unless the
+        // invoker of this method is the single consumer.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, 'value' is not changed.  The behavior
+        // is undefined unless the invoker of this method is the single
+        // consumer.
+
+    int tryPopFrontBatch(bsl::vector<TYPE> *values, bsl::size_t maxNumValues);
+        // Attempt to remove the elements available at the front of this
+        // queue, up to the specified 'maxNumValues', without blocking, and
+        // append them, in order, to the specified 'values'.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success (in which case at least one element is
+        // appended), 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, 'values' is not changed.  The behavior
+        // is undefined unless the invoker of this method is the single
+        // consumer and '0 < maxNumValues'.
+
+    int tryPushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()',
+        // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
+        // 'e_FAILED' if an error occurs.
+
+    int tryPushBack(bslmf::MovableRef<TYPE> value);
+        // Append the specified move-insertable 'value' to the back of this
+        // queue.  'value' is left in a valid but unspecified state.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPushBackDisabled()',
+        // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
+        // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
+
+                       // Enqueue/Dequeue State
+
+    void disablePopFront();
+        // Disable dequeueing from this queue.  All subsequent invocations of
+        // 'popFront', 'popFrontBatch', 'tryPopFront', and 'tryPopFrontBatch'
+        // will fail immediately.  All blocked invocations of 'popFront',
+        // 'popFrontBatch', and 'waitUntilEmpty' will fail immediately.  If the
+        // queue is already dequeue disabled, this method has no effect.
+
+    void disablePushBack();
+        // Disable enqueueing into this queue.  All subsequent invocations of
+        // 'pushBack' or 'tryPushBack' will fail immediately.  All blocked
+        // invocations of 'pushBack' will fail immediately.  If the queue is
+        // already enqueue disabled, this method has no effect.
+
+    void enablePopFront();
+        // Enable dequeueing.  If the queue is not dequeue disabled, this call
+        // has no effect.
+
+    void enablePushBack();
+        // Enable queuing.  If the queue is not enqueue disabled, this call has
+        // no effect.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), or 'false'
+        // otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (has no available capacity), or
+        // 'false' otherwise.
+
+    bool isPopFrontDisabled() const;
+        // Return 'true' if this queue is dequeue disabled, and 'false'
+        // otherwise.  Note that the queue is created in the "dequeue enabled"
+        // state.
+
+    bool isPushBackDisabled() const;
+        // Return 'true' if this queue is enqueue disabled, and 'false'
+        // otherwise.  Note that the queue is created in the "enqueue enabled"
+        // state.
+
+    bsl::size_t numElements() const;
+        // Returns the number of elements currently in this queue (including
+        // those whose push is in progress).
+
+    int waitUntilEmpty() const;
+        // Block until all the elements in this queue are removed.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if
+        // '!isEmpty() && isPopFrontDisabled()', and 'e_FAILED' if an error
+        // occurs.  A blocked thread waiting for the queue to empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                // ------------------------------------------------
+                // class SingleConsumerBoundedQueue_PopCompleteGuard
+                // ------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+SingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>::
+                  SingleConsumerBoundedQueue_PopCompleteGuard(TYPE   *queue,
+                                                              NODE   *node,
+                                                              Uint64  position)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_position(position)
+{
+}
+
+template <class TYPE, class NODE>
+inline
+SingleConsumerBoundedQueue_PopCompleteGuard<TYPE, NODE>::
+                                 ~SingleConsumerBoundedQueue_PopCompleteGuard()
+{
+    d_queue_p->popComplete(d_node_p, d_position);
+}
+
+             // ----------------------------------------------------
+             // class SingleConsumerBoundedQueue_PushExceptionProctor
+             // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+SingleConsumerBoundedQueue_PushExceptionProctor<TYPE, NODE>::
+              SingleConsumerBoundedQueue_PushExceptionProctor(TYPE   *queue,
+                                                              NODE   *node,
+                                                              Uint64  position)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_position(position)
+{
+}
+
+template <class TYPE, class NODE>
+inline
+SingleConsumerBoundedQueue_PushExceptionProctor<TYPE, NODE>::
+                             ~SingleConsumerBoundedQueue_PushExceptionProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pushExceptionComplete(d_node_p, d_position);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerBoundedQueue_PushExceptionProctor<TYPE, NODE>::release()
+{
+    d_queue_p = 0;
+}
+
+                     // --------------------------------
+                     // class SingleConsumerBoundedQueue
+                     // --------------------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::popComplete(Node   *node,
+                                                   Uint64  position)
+{
+    if (node->d_reclaim) {
+        node->d_reclaim = false;
+    }
+    else {
+        node->d_value.object().~TYPE();
+    }
+
+    // The node and the pop index are stored, and then the waiting counts are
+    // read, with sequential consistency: either a blocked thread (which
+    // increments its waiting count under 'd_mutex' before reading the node or
+    // the indices) observes the stores, or this thread observes the waiting
+    // count and wakes the blocked thread.
+
+    AtomicOp::setUint64(&node->d_sequence, position + d_capacity);
+    AtomicOp::setUint64(&d_popIndex, position + 1);
+
+    if (AtomicOp::getInt(&d_numWaitingProducers)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_pushCondition.broadcast();
+    }
+
+    if (AtomicOp::getInt(&d_emptyCount) && isEmpty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_emptyCondition.broadcast();
+    }
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::popFrontImp(TYPE *value, bool isTry)
+{
+    for (;;) {
+        const int rv = popWait(isTry);
+        if (rv) {
+            return rv;                                                // RETURN
+        }
+
+        const Uint64  position = AtomicOp::getUint64Relaxed(&d_popIndex);
+        Node         *node     = &d_element_p[position & (d_capacity - 1)];
+
+        PopGuard guard(this, node, position);
+
+        // A node marked for reclamation holds no value, and is skipped.
+
+        if (!node->d_reclaim) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            *value = bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+            *value = node->d_value.object();
+#endif
+            return e_SUCCESS;                                         // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::popFrontBatchImp(
+                                             bsl::vector<TYPE> *values,
+                                             bsl::size_t        maxNumValues,
+                                             bool               isTry)
+{
+    const bsl::size_t initialSize = values->size();
+
+    while (values->size() == initialSize) {
+        const int rv = popWait(isTry);
+        if (rv) {
+            return rv;                                                // RETURN
+        }
+
+        // Remove every node that is readable, up to the maximum.  The
+        // readiness of each subsequent node is checked without blocking.
+
+        Uint64 position = AtomicOp::getUint64Relaxed(&d_popIndex);
+        do {
+            Node *node = &d_element_p[position & (d_capacity - 1)];
+
+            PopGuard guard(this, node, position);
+
+            if (!node->d_reclaim) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                values->push_back(
+                          bslmf::MovableRefUtil::move(node->d_value.object()));
+#else
+                values->push_back(node->d_value.object());
+#endif
+            }
+            ++position;
+        } while (values->size() - initialSize < maxNumValues
+              && isReadable(position));
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::popWait(bool isTry)
+{
+    if (AtomicOp::getIntAcquire(&d_popDisabled)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    const Uint64 position = AtomicOp::getUint64Relaxed(&d_popIndex);
+
+    if (isReadable(position)) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    if (isTry) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    bslmt::ThreadUtil::yield();
+
+    if (isReadable(position)) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    AtomicOp::setInt(&d_consumerWaiting, 1);
+
+    int rv = e_SUCCESS;
+    while (!isReadable(position)) {
+        if (AtomicOp::getInt(&d_popDisabled)) {
+            rv = e_DISABLED;
+            break;
+        }
+        if (d_popCondition.wait(&d_mutex)) {
+            rv = e_FAILED;
+            break;
+        }
+    }
+
+    AtomicOp::setInt(&d_consumerWaiting, 0);
+
+    return rv;
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::pushBackImp(const TYPE& value,
+                                                  bool        isTry)
+{
+    Uint64    position;
+    const int rv = reserve(&position, isTry);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    Node *node = &d_element_p[position & (d_capacity - 1)];
+
+    PushProctor proctor(this, node, position);
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                            value,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::pushBackImp(
+                                              bslmf::MovableRef<TYPE> value,
+                                              bool                    isTry)
+{
+    Uint64    position;
+    const int rv = reserve(&position, isTry);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    Node *node = &d_element_p[position & (d_capacity - 1)];
+
+    PushProctor proctor(this, node, position);
+
+    TYPE& dummy = value;
+    bslalg::ScalarPrimitives::moveConstruct(node->d_value.address(),
+                                            dummy,
+                                            d_allocator_p);
+
+    proctor.release();
+
+    pushComplete(node, position);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::pushComplete(Node   *node,
+                                                    Uint64  position)
+{
+    // See 'popComplete' for the ordering of storing the node and reading the
+    // waiting count.
+
+    AtomicOp::setUint64(&node->d_sequence, position + 1);
+
+    if (AtomicOp::getInt(&d_consumerWaiting)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_popCondition.signal();
+    }
+}
+
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::pushExceptionComplete(
+                                                             Node   *node,
+                                                             Uint64  position)
+{
+    node->d_reclaim = true;
+
+    pushComplete(node, position);
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::reserve(Uint64 *position, bool isTry)
+{
+    for (;;) {
+        if (AtomicOp::getIntAcquire(&d_pushDisabled)) {
+            return e_DISABLED;                                        // RETURN
+        }
+
+        // A node is writable for the push at 'index' once its sequence is
+        // 'index', and is a full queue behind if its sequence is less.
+
+        Uint64 index = AtomicOp::getUint64Relaxed(&d_pushIndex);
+        for (;;) {
+            Node&       node     = d_element_p[index & (d_capacity - 1)];
+            const Int64 distance = static_cast<Int64>(
+                         AtomicOp::getUint64Acquire(&node.d_sequence) - index);
+            if (0 == distance) {
+                const Uint64 previous = AtomicOp::testAndSwapUint64AcqRel(
+                                                                  &d_pushIndex,
+                                                                  index,
+                                                                  index + 1);
+                if (previous == index) {
+                    *position = index;
+                    return e_SUCCESS;                                 // RETURN
+                }
+                index = previous;
+            }
+            else if (distance < 0) {
+                break;
+            }
+            else {
+                index = AtomicOp::getUint64Relaxed(&d_pushIndex);
+            }
+        }
+
+        if (isTry) {
+            return e_FULL;                                            // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        AtomicOp::addInt(&d_numWaitingProducers, 1);
+
+        int rv = e_SUCCESS;
+        while (isFull() && !AtomicOp::getInt(&d_pushDisabled)) {
+            if (d_pushCondition.wait(&d_mutex)) {
+                rv = e_FAILED;
+                break;
+            }
+        }
+
+        AtomicOp::addInt(&d_numWaitingProducers, -1);
+
+        if (rv) {
+            return rv;                                                // RETURN
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bool SingleConsumerBoundedQueue<TYPE>::isReadable(Uint64 position) const
+{
+    return position + 1 == AtomicOp::getUint64(
+                   &d_element_p[position & (d_capacity - 1)].d_sequence);
+}
+
+// CREATORS
+template <class TYPE>
+SingleConsumerBoundedQueue<TYPE>::SingleConsumerBoundedQueue(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_pushPad()
+, d_popPad()
+, d_element_p(0)
+, d_capacity(capacity > 2 ? bdlb::BitUtil::roundUpToBinaryPower(
+                                          static_cast<bsl::uint64_t>(capacity))
+                          : 2)
+, d_mutex()
+, d_popCondition()
+, d_pushCondition()
+, d_emptyCondition()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    AtomicOp::initUint64(&d_pushIndex, 0);
+    AtomicOp::initUint64(&d_popIndex,  0);
+
+    AtomicOp::initInt(&d_consumerWaiting,     0);
+    AtomicOp::initInt(&d_numWaitingProducers, 0);
+    AtomicOp::initInt(&d_emptyCount,          0);
+    AtomicOp::initInt(&d_popDisabled,         0);
+    AtomicOp::initInt(&d_pushDisabled,        0);
+
+    d_element_p = static_cast<Node *>(d_allocator_p->allocate(
+                       static_cast<bsl::size_t>(d_capacity) * sizeof(Node)));
+
+    for (Uint64 i = 0; i < d_capacity; ++i) {
+        AtomicOp::initUint64(&d_element_p[i].d_sequence, i);
+        d_element_p[i].d_reclaim = false;
+    }
+}
+
+template <class TYPE>
+SingleConsumerBoundedQueue<TYPE>::~SingleConsumerBoundedQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_element_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    return popFrontImp(value, false);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::popFrontBatch(
+                                              bsl::vector<TYPE> *values,
+                                              bsl::size_t        maxNumValues)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    return popFrontBatchImp(values, maxNumValues, false);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::pushBack(const TYPE& value)
+{
+    return pushBackImp(value, false);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
+{
+    return pushBackImp(bslmf::MovableRefUtil::move(value), false);
+}
+
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::removeAll()
+{
+    Uint64 position = AtomicOp::getUint64Relaxed(&d_popIndex);
+    while (isReadable(position)) {
+        popComplete(&d_element_p[position & (d_capacity - 1)], position);
+        ++position;
+    }
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    return popFrontImp(value, true);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::tryPopFrontBatch(
+                                              bsl::vector<TYPE> *values,
+                                              bsl::size_t        maxNumValues)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    return popFrontBatchImp(values, maxNumValues, true);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    return pushBackImp(value, true);
+}
+
+template <class TYPE>
+inline
+int SingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    return pushBackImp(bslmf::MovableRefUtil::move(value), true);
+}
+
+                       // Enqueue/Dequeue State
+
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::disablePopFront()
+{
+    AtomicOp::setInt(&d_popDisabled, 1);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_popCondition.broadcast();
+    d_emptyCondition.broadcast();
+}
+
+template <class TYPE>
+void SingleConsumerBoundedQueue<TYPE>::disablePushBack()
+{
+    AtomicOp::setInt(&d_pushDisabled, 1);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_pushCondition.broadcast();
+}
+
+template <class TYPE>
+inline
+void SingleConsumerBoundedQueue<TYPE>::enablePopFront()
+{
+    AtomicOp::setInt(&d_popDisabled, 0);
+}
+
+template <class TYPE>
+inline
+void SingleConsumerBoundedQueue<TYPE>::enablePushBack()
+{
+    AtomicOp::setInt(&d_pushDisabled, 0);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t SingleConsumerBoundedQueue<TYPE>::capacity() const
+{
+    return static_cast<bsl::size_t>(d_capacity);
+}
+
+template <class TYPE>
+inline
+bool SingleConsumerBoundedQueue<TYPE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE>
+inline
+bool SingleConsumerBoundedQueue<TYPE>::isFull() const
+{
+    return d_capacity <= numElements();
+}
+
+template <class TYPE>
+inline
+bool SingleConsumerBoundedQueue<TYPE>::isPopFrontDisabled() const
+{
+    return 0 != AtomicOp::getInt(&d_popDisabled);
+}
+
+template <class TYPE>
+inline
+bool SingleConsumerBoundedQueue<TYPE>::isPushBackDisabled() const
+{
+    return 0 != AtomicOp::getInt(&d_pushDisabled);
+}
+
+template <class TYPE>
+inline
+bsl::size_t SingleConsumerBoundedQueue<TYPE>::numElements() const
+{
+    // The pop index is read first, so that the result is not negative.
+
+    const Uint64 popIndex = AtomicOp::getUint64(&d_popIndex);
+
+    return static_cast<bsl::size_t>(AtomicOp::getUint64(&d_pushIndex)
+                                                                  - popIndex);
+}
+
+template <class TYPE>
+int SingleConsumerBoundedQueue<TYPE>::waitUntilEmpty() const
+{
+    if (isEmpty()) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    AtomicOp::addInt(&d_emptyCount, 1);
+
+    int rv = e_SUCCESS;
+    while (!isEmpty()) {
+        if (AtomicOp::getInt(&d_popDisabled)) {
+            rv = e_DISABLED;
+            break;
+        }
+        if (d_emptyCondition.wait(&d_mutex)) {
+            rv = e_FAILED;
+            break;
+        }
+    }
+
+    AtomicOp::addInt(&d_emptyCount, -1);
+
+    return rv;
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *SingleConsumerBoundedQueue<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1313 @@
+// bdlcc_singleconsumerboundedqueue.t.cpp                             -*-C++-*-
+#include <bdlcc_singleconsumerboundedqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_buildtarget.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a bounded queue into which any number of
+// producers push values that a single consumer pops, singly or in batches.
+// We verify the geometry and the memory use of the queue, the order and the
+// lifetime of the values pushed and popped (through several laps of the
+// array), the backpressure of a full queue, the batched popping methods, the
+// recovery from a value whose construction throws, and the blocking and
+// disabling of the producers and of the consumer, first from a single thread
+// with the non-blocking methods, and then concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SingleConsumerBoundedQueue(size_t capacity, Allocator *ba = 0);
+// [ 2] ~SingleConsumerBoundedQueue();
+//
+// MANIPULATORS
+// [ 5] int popFront(TYPE *value);
+// [ 5] int popFrontBatch(bsl::vector<TYPE> *values, size_t max);
+// [ 5] int pushBack(const TYPE& value);
+// [ 5] int pushBack(bslmf::MovableRef<TYPE> value);
+// [ 3] void removeAll();
+// [ 3] int tryPopFront(TYPE *value);
+// [ 4] int tryPopFrontBatch(bsl::vector<TYPE> *values, size_t max);
+// [ 3] int tryPushBack(const TYPE& value);
+// [ 3] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [ 3] void disablePopFront();
+// [ 3] void disablePushBack();
+// [ 3] void enablePopFront();
+// [ 3] void enablePushBack();
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 3] bool isEmpty() const;
+// [ 3] bool isFull() const;
+// [ 3] bool isPopFrontDisabled() const;
+// [ 3] bool isPushBackDisabled() const;
+// [ 3] size_t numElements() const;
+// [ 5] int waitUntilEmpty() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::SingleConsumerBoundedQueue<int> Obj;
+
+// ============================================================================
+//                          GLOBAL HELPER CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                             // =================
+                             // class ThrowOnCopy
+                             // =================
+
+class ThrowOnCopy {
+    // This class holds an integer value, and throws that value when copied if
+    // the value is negative.
+
+    // DATA
+    int d_value;  // held value
+
+  public:
+    // CREATORS
+    explicit ThrowOnCopy(int value)
+        // Create an object holding the specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    ThrowOnCopy(const ThrowOnCopy& original)
+        // Create an object holding the value of the specified 'original', and
+        // throw that value if it is negative.
+    : d_value(original.d_value)
+    {
+        if (0 > d_value) {
+            throw d_value;
+        }
+    }
+
+    // MANIPULATORS
+    ThrowOnCopy& operator=(const ThrowOnCopy& rhs)
+        // Assign to this object the value of the specified 'rhs', and return a
+        // reference providing modifiable access to this object.  Note that,
+        // unlike the copy constructor, assignment does not throw.
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the held value.
+    {
+        return d_value;
+    }
+};
+
+                              // ===============
+                              // struct Producer
+                              // ===============
+
+struct Producer {
+    // This 'struct' defines a functor that pushes the values 'd_id << 24' to
+    // '(d_id << 24) + d_numValues - 1' to a queue, with 'pushBack' or, if
+    // 'd_useTry', with 'tryPushBack' (yielding while the queue is full).
+
+    // DATA
+    Obj  *d_queue_p;    // queue (held, not owned)
+    int   d_id;         // identifies the producer
+    int   d_numValues;  // number of values to push
+    bool  d_useTry;     // 'true' to use 'tryPushBack'
+
+    // MANIPULATORS
+    void operator()() const
+        // Push the values.
+    {
+        for (int i = 0; i < d_numValues; ++i) {
+            const int value = (d_id << 24) + i;
+            if (d_useTry) {
+                int rc;
+                while (Obj::e_FULL == (rc = d_queue_p->tryPushBack(value))) {
+                    bslmt::ThreadUtil::yield();
+                }
+                ASSERTV(d_id, i, rc, 0 == rc);
+            }
+            else {
+                ASSERTV(d_id, i, 0 == d_queue_p->pushBack(value));
+            }
+        }
+    }
+};
+
+                              // ===============
+                              // struct PushBack
+                              // ===============
+
+struct PushBack {
+    // This 'struct' defines a functor that pushes a value to a queue with
+    // 'pushBack', and records the result.
+
+    // DATA
+    Obj             *d_queue_p;  // queue (held, not owned)
+    int              d_value;    // value to push
+    bsls::AtomicInt *d_rc_p;     // result of 'pushBack' (held, not owned)
+
+    // MANIPULATORS
+    void operator()() const
+        // Push the value, and record the result.
+    {
+        *d_rc_p = d_queue_p->pushBack(d_value);
+    }
+};
+
+                              // ===============
+                              // struct PopFront
+                              // ===============
+
+struct PopFront {
+    // This 'struct' defines a functor that pops a value from a queue with
+    // 'popFront' or, if 'd_batch', with 'popFrontBatch', and records the
+    // value (or the first value of the batch) and the result.
+
+    // DATA
+    Obj             *d_queue_p;  // queue (held, not owned)
+    bool             d_batch;    // 'true' to use 'popFrontBatch'
+    bsls::AtomicInt *d_value_p;  // value popped (held, not owned)
+    bsls::AtomicInt *d_rc_p;     // result (held, not owned)
+
+    // MANIPULATORS
+    void operator()() const
+        // Pop a value, and record the value and the result.
+    {
+        if (d_batch) {
+            bslma::TestAllocator ta("batch");
+            bsl::vector<int>     values(&ta);
+
+            const int rc = d_queue_p->popFrontBatch(&values, 16);
+            if (0 == rc) {
+                *d_value_p = values.front();
+            }
+            *d_rc_p = rc;
+        }
+        else {
+            int value = -1;
+
+            const int rc = d_queue_p->popFront(&value);
+            *d_value_p   = value;
+            *d_rc_p      = rc;
+        }
+    }
+};
+
+                           // =====================
+                           // struct WaitUntilEmpty
+                           // =====================
+
+struct WaitUntilEmpty {
+    // This 'struct' defines a functor that waits for a queue to be empty, and
+    // records the result.
+
+    // DATA
+    const Obj       *d_queue_p;  // queue (held, not owned)
+    bsls::AtomicInt *d_rc_p;     // result (held, not owned)
+
+    // MANIPULATORS
+    void operator()() const
+        // Wait for the queue to be empty, and record the result.
+    {
+        *d_rc_p = d_queue_p->waitUntilEmpty();
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Draining Events in an Event Loop
+///- - - - - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::SingleConsumerBoundedQueue' is used to
+// pass events from several "producer" threads to the single thread of an
+// event loop, which processes every pending event in each pass of its loop.
+//
+// First, we define the type of an event, and the function that the event loop
+// uses to process an event:
+//..
+    struct my_Event {
+        int d_source;  // identifies the producer
+        int d_value;   // event payload
+    };
+
+    void myProcess(bsl::vector<int> *totals, const my_Event& event)
+        // Process the specified 'event', accumulating its value into the
+        // specified 'totals'.
+    {
+        (*totals)[event.d_source] += event.d_value;
+    }
+//..
+// Then, we define the event loop, which removes every pending event (up to
+// 256 at a time) in one call to 'popFrontBatch', processes them, and reuses
+// the same vector in each pass, until the queue is dequeue disabled:
+//..
+    void myEventLoop(bdlcc::SingleConsumerBoundedQueue<my_Event> *queue,
+                     bsl::vector<int>                            *totals)
+        // Process the events of the specified 'queue', accumulating their
+        // values into the specified 'totals', until 'queue' is dequeue
+        // disabled.
+    {
+        bsl::vector<my_Event> events;
+        events.reserve(256);
+
+        while (0 == queue->popFrontBatch(&events, 256)) {
+            for (bsl::size_t i = 0; i < events.size(); ++i) {
+                myProcess(totals, events[i]);
+            }
+            events.clear();
+        }
+    }
+//..
+// Next, we define a producer, which posts its events with 'tryPushBack' and,
+// when the queue is full, applies backpressure by yielding before trying
+// again (a real producer might instead coalesce or discard events):
+//..
+    void myProducer(bdlcc::SingleConsumerBoundedQueue<my_Event> *queue,
+                    int                                          source,
+                    int                                          numEvents)
+        // Push the specified 'numEvents' events from the specified 'source'
+        // into the specified 'queue'.
+    {
+        for (int i = 0; i < numEvents; ++i) {
+            my_Event event = { source, 1 };
+            while (0 != queue->tryPushBack(event)) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator da("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        using namespace usage;
+
+        // The usage example allocates from the default allocator.
+
+        bslma::TestAllocator         ua("usage", veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&ua);
+
+// Finally, we create a queue of 1024 events, start the event loop and 4
+// producers, wait for the producers to finish and for the queue to empty, and
+// stop the event loop:
+//..
+    bdlcc::SingleConsumerBoundedQueue<my_Event> queue(1024);
+
+    bsl::vector<int> totals(4, 0);
+
+    bslmt::ThreadGroup eventLoop;
+    eventLoop.addThread(bdlf::BindUtil::bind(&myEventLoop, &queue, &totals));
+
+    bslmt::ThreadGroup producers;
+    for (int i = 0; i < 4; ++i) {
+        producers.addThread(bdlf::BindUtil::bind(&myProducer,
+                                                 &queue,
+                                                 i,
+                                                 10000));
+    }
+    producers.joinAll();
+
+    queue.waitUntilEmpty();
+    queue.disablePopFront();
+    eventLoop.joinAll();
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT(10000 == totals[i]);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BLOCKING AND CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The consumer receives every value, in the order pushed by each
+        //:   producer, when several producers run concurrently, with single
+        //:   and batched popping, and with blocking and non-blocking pushing.
+        //:
+        //: 2 'pushBack' blocks while the queue is full, and is released by a
+        //:   pop or by 'disablePushBack' (returning 'e_DISABLED').
+        //:
+        //: 3 'popFront' and 'popFrontBatch' block while the queue is empty,
+        //:   and are released by a push or by 'disablePopFront' (returning
+        //:   'e_DISABLED').
+        //:
+        //: 4 'waitUntilEmpty' blocks while the queue is not empty, and is
+        //:   released when the queue empties or by 'disablePopFront'
+        //:   (returning 'e_DISABLED').
+        //:
+        //: 5 The move overload of 'pushBack' moves the value.
+        //
+        // Plan:
+        //: 1 Using queues of several capacities, start producer threads
+        //:   pushing many values (half with 'pushBack' and half with
+        //:   'tryPushBack'), and pop them in the main thread, alternating
+        //:   'popFront' and 'popFrontBatch', verifying that the values of each
+        //:   producer arrive in order.  (C-1)
+        //:
+        //: 2 Block a producer on a full queue, and release it by popping a
+        //:   value, and, in another run, by 'disablePushBack'.  (C-2)
+        //:
+        //: 3 Block the consumer, with each popping method, on an empty queue,
+        //:   and release it by pushing a value, and, in another run, by
+        //:   'disablePopFront'.  (C-3)
+        //:
+        //: 4 Block a thread in 'waitUntilEmpty', and release it by popping
+        //:   every value, and, in another run, by 'disablePopFront'.  (C-4)
+        //:
+        //: 5 Push a string with the move overload of 'pushBack', and verify
+        //:   that the memory of the string moves to the queue.  (C-5)
+        //
+        // Testing:
+        //   int popFront(TYPE *value);
+        //   int popFrontBatch(bsl::vector<TYPE> *values, size_t max);
+        //   int pushBack(const TYPE& value);
+        //   int pushBack(bslmf::MovableRef<TYPE> value);
+        //   int waitUntilEmpty() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BLOCKING AND CONCURRENCY" << endl
+                                  << "========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nSeveral producers." << endl;
+        {
+            enum { k_NUM_PRODUCERS = 4, k_NUM_VALUES = 50000 };
+
+            const bsl::size_t CAPACITIES[] = { 2, 16, 1024 };
+            for (int ti = 0; ti < 3; ++ti) {
+                const bsl::size_t CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                Obj mX(CAPACITY, &ta);
+
+                bslmt::ThreadGroup producers(&ta);
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    Producer producer = { &mX, i, k_NUM_VALUES, 1 == i % 2 };
+                    ASSERT(0 == producers.addThread(producer));
+                }
+
+                int              next[k_NUM_PRODUCERS] = { 0, 0, 0, 0 };
+                bsl::vector<int> values(&ta);
+                int              numPopped = 0;
+                while (k_NUM_PRODUCERS * k_NUM_VALUES > numPopped) {
+                    values.clear();
+                    if (numPopped % 2) {
+                        int value;
+                        ASSERT(0 == mX.popFront(&value));
+                        values.push_back(value);
+                    }
+                    else {
+                        ASSERT(0 == mX.popFrontBatch(&values, 100));
+                        ASSERTV(values.size(), 1   <= values.size());
+                        ASSERTV(values.size(), 100 >= values.size());
+                    }
+                    for (bsl::size_t i = 0; i < values.size(); ++i) {
+                        const int id    = values[i] >> 24;
+                        const int count = values[i] & 0xffffff;
+                        ASSERTV(id, 0 <= id && k_NUM_PRODUCERS > id);
+                        if (0 <= id && k_NUM_PRODUCERS > id) {
+                            ASSERTV(id, next[id], count, next[id] == count);
+                            next[id] = count + 1;
+                        }
+                    }
+                    numPopped += static_cast<int>(values.size());
+                }
+                producers.joinAll();
+
+                ASSERTV(CAPACITY, numPopped,
+                        k_NUM_PRODUCERS * k_NUM_VALUES == numPopped);
+                ASSERT(mX.isEmpty());
+            }
+        }
+
+        if (verbose) cout << "\nReleasing a blocked producer." << endl;
+        {
+            for (int release = 0; release < 2; ++release) {
+                Obj mX(2, &ta);
+
+                ASSERT(0 == mX.tryPushBack(0));
+                ASSERT(0 == mX.tryPushBack(1));
+                ASSERT(Obj::e_FULL == mX.tryPushBack(2));
+
+                bsls::AtomicInt           rc(1);
+                bslmt::ThreadUtil::Handle handle;
+
+                PushBack pushTwo = { &mX, 2, &rc };
+
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                                   pushTwo,
+                                                                   &ta));
+
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(1 == rc);  // still blocked
+
+                if (0 == release) {
+                    int value;
+                    ASSERT(0 == mX.popFront(&value));
+                    ASSERT(0 == value);
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(0 == rc);
+
+                    ASSERT(0 == mX.popFront(&value));
+                    ASSERT(1 == value);
+                    ASSERT(0 == mX.popFront(&value));
+                    ASSERT(2 == value);
+                }
+                else {
+                    mX.disablePushBack();
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(Obj::e_DISABLED == rc);
+                    ASSERT(2 == mX.numElements());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nReleasing a blocked consumer." << endl;
+        {
+            for (int ti = 0; ti < 4; ++ti) {
+                const bool BATCH   = ti / 2;
+                const bool RELEASE = ti % 2;
+
+                if (veryVerbose) { T_ P_(BATCH) P(RELEASE) }
+
+                Obj mX(4, &ta);
+
+                bsls::AtomicInt value(-2);
+                bsls::AtomicInt rc(1);
+                PopFront        popFront = { &mX, BATCH, &value, &rc };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(&handle,
+                                                                   popFront,
+                                                                   &ta));
+
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(1 == rc);  // still blocked
+
+                if (!RELEASE) {
+                    ASSERT(0 == mX.pushBack(42));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(0  == rc);
+                    ASSERT(42 == value);
+                }
+                else {
+                    mX.disablePopFront();
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(Obj::e_DISABLED == rc);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nReleasing a thread waiting for empty." << endl;
+        {
+            for (int release = 0; release < 2; ++release) {
+                Obj mX(4, &ta);
+
+                bsls::AtomicInt rc(1);
+                WaitUntilEmpty  waitUntilEmpty = { &mX, &rc };
+
+                ASSERT(0 == mX.waitUntilEmpty());
+
+                ASSERT(0 == mX.pushBack(0));
+                ASSERT(0 == mX.pushBack(1));
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                               &handle,
+                                                               waitUntilEmpty,
+                                                               &ta));
+
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(1 == rc);  // still blocked
+
+                int value;
+                ASSERT(0 == mX.popFront(&value));
+
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(1 == rc);  // still blocked
+
+                if (0 == release) {
+                    ASSERT(0 == mX.popFront(&value));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(0 == rc);
+                }
+                else {
+                    mX.disablePopFront();
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERT(Obj::e_DISABLED == rc);
+                    ASSERT(Obj::e_DISABLED == mX.waitUntilEmpty());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nMoving a value." << endl;
+        {
+            bslma::TestAllocator sa("scratch", veryVerbose);
+
+            bdlcc::SingleConsumerBoundedQueue<bsl::string> mX(4, &ta);
+
+            bsl::string value(100, 'x', &ta);
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            ASSERT(0 == mX.pushBack(bslmf::MovableRefUtil::move(value)));
+            ASSERT(numBlocks == ta.numBlocksTotal());
+
+            bsl::string result(&sa);
+            ASSERT(0 == mX.popFront(&result));
+            ASSERT(bsl::string(100, 'x', &sa) == result);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BATCHED POPPING
+        //
+        // Concerns:
+        //: 1 'tryPopFrontBatch' appends, in order, the values available, up to
+        //:   the specified maximum, and leaves the remaining values in the
+        //:   queue.
+        //:
+        //: 2 'tryPopFrontBatch' returns 'e_EMPTY' on an empty queue, and
+        //:   'e_DISABLED' on a dequeue disabled queue, without changing the
+        //:   vector.
+        //:
+        //: 3 A batch frees the capacity of the values it pops.
+        //:
+        //: 4 A batch skips the elements whose value could not be constructed.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several numbers of values and maximums, push the values, pop
+        //:   them in batches appended to a non-empty vector, and verify the
+        //:   vector and the queue.  (C-1, 3)
+        //:
+        //: 2 Verify the result and the vector of a batch on an empty queue
+        //:   and on a dequeue disabled queue.  (C-2)
+        //:
+        //: 3 When exceptions are enabled, push values, some of whose copy
+        //:   constructors throw, and verify that a batch returns the other
+        //:   values.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int tryPopFrontBatch(bsl::vector<TYPE> *values, size_t max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BATCHED POPPING" << endl
+                                  << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nBatches of several sizes." << endl;
+        {
+            for (int numValues = 1; numValues <= 8; ++numValues) {
+                for (bsl::size_t max = 1; max <= 10; ++max) {
+                    if (veryVerbose) { T_ P_(numValues) P(max) }
+
+                    Obj mX(8, &ta);  const Obj& X = mX;
+
+                    // Advance the queue by a partial lap, so that the
+                    // batches wrap around the end of the array.
+
+                    for (int i = 0; i < 5; ++i) {
+                        int value;
+                        ASSERT(0 == mX.tryPushBack(-1));
+                        ASSERT(0 == mX.tryPopFront(&value));
+                    }
+
+                    for (int i = 0; i < numValues; ++i) {
+                        ASSERT(0 == mX.tryPushBack(i));
+                    }
+
+                    bsl::vector<int> values(1, -1, &ta);
+
+                    int next = 0;
+                    while (next < numValues) {
+                        const bsl::size_t SIZE = values.size();
+                        const int         EXP  =
+                                       static_cast<int>(max) < numValues - next
+                                       ? static_cast<int>(max)
+                                       : numValues - next;
+
+                        ASSERT(0 == mX.tryPopFrontBatch(&values, max));
+                        ASSERTV(numValues, max, SIZE + EXP == values.size());
+                        for (int i = 0; i < EXP; ++i) {
+                            ASSERTV(i, next + i == values[SIZE + i]);
+                        }
+                        next += EXP;
+                        ASSERT(static_cast<bsl::size_t>(numValues - next) ==
+                                                            X.numElements());
+
+                        // The capacity popped is available.
+
+                        ASSERT(!X.isFull() || 8 == numValues - next);
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(-1 == values.front());
+
+                    const bsl::size_t SIZE = values.size();
+                    ASSERT(Obj::e_EMPTY == mX.tryPopFrontBatch(&values, max));
+                    ASSERT(SIZE == values.size());
+
+                    ASSERT(0 == mX.tryPushBack(0));
+                    mX.disablePopFront();
+                    ASSERT(Obj::e_DISABLED ==
+                                            mX.tryPopFrontBatch(&values, max));
+                    ASSERT(Obj::e_DISABLED == mX.popFrontBatch(&values, max));
+                    ASSERT(SIZE == values.size());
+                    ASSERT(1 == X.numElements());
+
+                    mX.enablePopFront();
+                    ASSERT(0 == mX.popFrontBatch(&values, max));
+                    ASSERT(SIZE + 1 == values.size());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nValues whose construction throws." << endl;
+        {
+#if defined(BDE_BUILD_TARGET_EXC)
+            bdlcc::SingleConsumerBoundedQueue<ThrowOnCopy> mX(4, &ta);
+
+            const int VALUES[] = { -1, 1, -2, -3, 2 };
+            for (int i = 0; i < 5; ++i) {
+                bool thrown = false;
+                try {
+                    ASSERT(0 == mX.tryPushBack(ThrowOnCopy(VALUES[i])));
+                }
+                catch (int value) {
+                    ASSERTV(value, VALUES[i] == value);
+                    thrown = true;
+                }
+                ASSERTV(i, (0 > VALUES[i]) == thrown);
+
+                if (2 == i) {
+                    // Pop the reclaimed element and 1, to make room.
+
+                    bsl::vector<ThrowOnCopy> values(&ta);
+                    ASSERT(0 == mX.tryPopFrontBatch(&values, 10));
+                    ASSERT(1 == values.size());
+                    ASSERT(1 == values[0].value());
+                }
+            }
+
+            bsl::vector<ThrowOnCopy> values(&ta);
+            ASSERT(0 == mX.tryPopFrontBatch(&values, 10));
+            ASSERT(1 == values.size());
+            ASSERT(2 == values[0].value());
+            ASSERT(mX.isEmpty());
+
+            // A batch consisting only of reclaimed elements is empty.
+
+            try {
+                mX.tryPushBack(ThrowOnCopy(-1));
+                ASSERT(false);
+            }
+            catch (int) {
+            }
+            ASSERT(Obj::e_EMPTY == mX.tryPopFrontBatch(&values, 10));
+            ASSERT(1 == values.size());
+            ASSERT(mX.isEmpty());
+#else
+            if (verbose) cout << "\tSkipped: exceptions are disabled." << endl;
+#endif
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(4, &ta);
+
+            bsl::vector<int> values(&ta);
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT_FAIL(mX.tryPopFrontBatch(0, 1));
+            ASSERT_FAIL(mX.tryPopFrontBatch(&values, 0));
+            ASSERT_PASS(mX.tryPopFrontBatch(&values, 1));
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT_FAIL(mX.popFrontBatch(0, 1));
+            ASSERT_FAIL(mX.popFrontBatch(&values, 0));
+            ASSERT_PASS(mX.popFrontBatch(&values, 1));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NON-BLOCKING PUSH AND POP
+        //
+        // Concerns:
+        //: 1 'tryPopFront' returns the values pushed by 'tryPushBack' in the
+        //:   order pushed, through several laps of the array.
+        //:
+        //: 2 'tryPushBack' returns 'e_FULL' when the queue holds 'capacity()'
+        //:   values, and 'tryPopFront' returns 'e_EMPTY' when it holds none,
+        //:   without changing the queue or the output value.
+        //:
+        //: 3 'numElements', 'isEmpty', and 'isFull' reflect the number of
+        //:   values held.
+        //:
+        //: 4 'disablePushBack' and 'disablePopFront' make the respective
+        //:   methods return 'e_DISABLED', without changing the queue, until
+        //:   'enablePushBack' and 'enablePopFront' are called.
+        //:
+        //: 5 'removeAll' removes every value held.
+        //:
+        //: 6 The values are constructed with the allocator of the queue, and
+        //:   destroyed when popped or removed, or when the queue is
+        //:   destroyed.
+        //:
+        //: 7 A value that cannot be constructed leaves the queue usable, and
+        //:   the element reserved for it is skipped by the consumer.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Fill and empty queues of several capacities several times,
+        //:   verifying the values and the accessors at each step.  (C-1..3)
+        //:
+        //: 2 Disable and enable a queue, verifying the results of the
+        //:   non-blocking methods and the state accessors.  (C-4)
+        //:
+        //: 3 Push strings (by copy and by move) into a queue, and verify the
+        //:   memory in use by the allocator of the queue as they are popped,
+        //:   removed, and destroyed.  (C-5..6)
+        //:
+        //: 4 When exceptions are enabled, push values whose copy constructor
+        //:   throws, and verify that the other values are popped in order.
+        //:   (C-7)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void removeAll();
+        //   int tryPopFront(TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   int tryPushBack(bslmf::MovableRef<TYPE> value);
+        //   void disablePopFront();
+        //   void disablePushBack();
+        //   void enablePopFront();
+        //   void enablePushBack();
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   bool isPopFrontDisabled() const;
+        //   bool isPushBackDisabled() const;
+        //   size_t numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "NON-BLOCKING PUSH AND POP" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        if (verbose) cout << "\nFilling and emptying." << endl;
+        {
+            const bsl::size_t CAPACITIES[] = { 2, 4, 8, 64 };
+            for (int ti = 0; ti < 4; ++ti) {
+                const bsl::size_t CAPACITY = CAPACITIES[ti];
+                const int         N        = static_cast<int>(CAPACITY);
+
+                if (veryVerbose) { T_ P(CAPACITY) }
+
+                Obj mX(CAPACITY, &ta);  const Obj& X = mX;
+
+                int next = 0;
+                for (int lap = 0; lap < 3; ++lap) {
+                    // Fill the queue, starting at a different element on each
+                    // lap.
+
+                    for (int i = 0; i < N; ++i) {
+                        ASSERTV(lap, i, !X.isFull());
+                        ASSERT(0 == mX.tryPushBack(next + i));
+                        ASSERTV(lap, i, i + 1 == static_cast<int>(
+                                                            X.numElements()));
+                        ASSERT(!X.isEmpty());
+                    }
+                    ASSERT(X.isFull());
+                    ASSERT(Obj::e_FULL == mX.tryPushBack(-1));
+                    ASSERT(CAPACITY == X.numElements());
+
+                    for (int i = 0; i < N; ++i) {
+                        int value = -2;
+                        ASSERT(0 == mX.tryPopFront(&value));
+                        ASSERTV(lap, i, value, next + i == value);
+                        ASSERT(!X.isFull());
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(0 == X.numElements());
+
+                    int value = -2;
+                    ASSERT(Obj::e_EMPTY == mX.tryPopFront(&value));
+                    ASSERT(-2 == value);
+
+                    // Leave one value, so that the next lap is offset.
+
+                    ASSERT(0 == mX.tryPushBack(-3));
+                    ASSERT(0 == mX.tryPopFront(&value));
+                    ASSERT(-3 == value);
+
+                    next += N;
+                }
+
+                // Interleave pushes and pops.
+
+                for (int i = 0; i < 5 * N; ++i) {
+                    int value;
+                    ASSERT(0 == mX.tryPushBack(i));
+                    ASSERT(0 == mX.tryPushBack(i));
+                    ASSERT(0 == mX.tryPopFront(&value));
+                    ASSERT(0 == mX.tryPopFront(&value));
+                    ASSERT(i == value);
+                }
+                ASSERT(X.isEmpty());
+            }
+        }
+
+        if (verbose) cout << "\nDisabling." << endl;
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(!X.isPushBackDisabled());
+            ASSERT(!X.isPopFrontDisabled());
+
+            ASSERT(0 == mX.tryPushBack(1));
+
+            mX.disablePushBack();
+            ASSERT( X.isPushBackDisabled());
+            ASSERT(!X.isPopFrontDisabled());
+            ASSERT(Obj::e_DISABLED == mX.tryPushBack(2));
+            ASSERT(Obj::e_DISABLED == mX.pushBack(2));
+            ASSERT(1 == X.numElements());
+
+            mX.disablePushBack();
+            ASSERT(X.isPushBackDisabled());
+
+            mX.disablePopFront();
+            ASSERT(X.isPopFrontDisabled());
+
+            int value = -1;
+            ASSERT(Obj::e_DISABLED == mX.tryPopFront(&value));
+            ASSERT(Obj::e_DISABLED == mX.popFront(&value));
+            ASSERT(-1 == value);
+            ASSERT(1 == X.numElements());
+
+            mX.enablePushBack();
+            ASSERT(!X.isPushBackDisabled());
+            ASSERT(0 == mX.tryPushBack(2));
+
+            mX.enablePopFront();
+            ASSERT(!X.isPopFrontDisabled());
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value);
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(2 == value);
+
+            mX.enablePopFront();
+            ASSERT(!X.isPopFrontDisabled());
+        }
+
+        if (verbose) cout << "\nValues of an allocating type." << endl;
+        {
+            bslma::TestAllocator sa("scratch", veryVerbose);
+
+            const bsl::string LONG(100, 'x', &sa);
+
+            {
+                bdlcc::SingleConsumerBoundedQueue<bsl::string> mX(4, &ta);
+
+                const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+                ASSERT(0 == mX.tryPushBack(LONG));
+                ASSERT(numBlocks + 1 == ta.numBlocksInUse());
+
+                bsl::string moved(LONG, &ta);
+                ASSERT(numBlocks + 2 == ta.numBlocksInUse());
+                ASSERT(0 == mX.tryPushBack(
+                                        bslmf::MovableRefUtil::move(moved)));
+                ASSERT(numBlocks + 2 == ta.numBlocksInUse());
+
+                ASSERT(0 == mX.tryPushBack(LONG));
+                ASSERT(0 == mX.tryPushBack(LONG));
+                ASSERT(numBlocks + 4 == ta.numBlocksInUse());
+
+                bsl::string value(&sa);
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(LONG == value);
+                ASSERT(numBlocks + 3 == ta.numBlocksInUse());
+
+                mX.removeAll();
+                ASSERT(mX.isEmpty());
+                ASSERT(numBlocks == ta.numBlocksInUse());
+
+                ASSERT(0 == mX.tryPushBack(LONG));
+                ASSERT(0 == mX.tryPushBack(LONG));
+                ASSERT(numBlocks + 2 == ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nValues whose construction throws." << endl;
+        {
+#if defined(BDE_BUILD_TARGET_EXC)
+            bdlcc::SingleConsumerBoundedQueue<ThrowOnCopy> mX(2, &ta);
+
+            for (int i = 0; i < 4; ++i) {
+                try {
+                    mX.tryPushBack(ThrowOnCopy(-1));
+                    ASSERT(false);
+                }
+                catch (int value) {
+                    ASSERTV(value, -1 == value);
+                }
+                ASSERT(1 == mX.numElements());
+
+                ASSERT(0 == mX.tryPushBack(ThrowOnCopy(i)));
+                ASSERT(mX.isFull());
+
+                ThrowOnCopy value(-3);
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(i == value.value());
+                ASSERT(mX.isEmpty());
+            }
+
+            try {
+                mX.tryPushBack(ThrowOnCopy(-1));
+                ASSERT(false);
+            }
+            catch (int) {
+            }
+            ThrowOnCopy value(-3);
+            ASSERT(Obj::e_EMPTY == mX.tryPopFront(&value));
+            ASSERT(-3 == value.value());
+            ASSERT(mX.isEmpty());
+#else
+            if (verbose) cout << "\tSkipped: exceptions are disabled." << endl;
+#endif
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(4, &ta);
+
+            int value;
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT_FAIL(mX.tryPopFront(0));
+            ASSERT_PASS(mX.tryPopFront(&value));
+
+            ASSERT(0 == mX.tryPushBack(0));
+            ASSERT_FAIL(mX.popFront(0));
+            ASSERT_PASS(mX.popFront(&value));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and is at least 2.
+        //:
+        //: 2 A queue is created empty, and enqueue and dequeue enabled.
+        //:
+        //: 3 The queue uses the supplied allocator (or the default allocator
+        //:   if none is supplied), for itself and for its values, and
+        //:   releases all memory on destruction.
+        //
+        // Plan:
+        //: 1 Construct queues of several capacities, with and without an
+        //:   allocator, and verify the accessors and the use of memory.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   SingleConsumerBoundedQueue(size_t capacity, Allocator *ba = 0);
+        //   ~SingleConsumerBoundedQueue();
+        //   size_t capacity() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS AND ACCESSORS" << endl
+                                  << "======================" << endl;
+
+        const struct {
+            int         d_line;          // source line number
+            bsl::size_t d_capacity;      // requested capacity
+            bsl::size_t d_expCapacity;   // expected capacity
+        } DATA[] = {
+            //LINE  CAPACITY  EXP CAPACITY
+            //----  --------  ------------
+            { L_,   0,        2            },
+            { L_,   1,        2            },
+            { L_,   2,        2            },
+            { L_,   3,        4            },
+            { L_,   4,        4            },
+            { L_,   5,        8            },
+            { L_,   1000,     1024         },
+            { L_,   1024,     1024         },
+            { L_,   1025,     2048         },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int         LINE         = DATA[ti].d_line;
+            const bsl::size_t CAPACITY     = DATA[ti].d_capacity;
+            const bsl::size_t EXP_CAPACITY = DATA[ti].d_expCapacity;
+
+            if (veryVerbose) { T_ P_(LINE) P(CAPACITY) }
+
+            bslma::TestAllocator ta("object", veryVerbose);
+            {
+                const Obj X(CAPACITY, &ta);
+                ASSERTV(LINE, EXP_CAPACITY == X.capacity());
+                ASSERTV(LINE, &ta          == X.allocator());
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, !X.isFull());
+                ASSERTV(LINE, 0 == X.numElements());
+                ASSERTV(LINE, !X.isPopFrontDisabled());
+                ASSERTV(LINE, !X.isPushBackDisabled());
+                ASSERTV(LINE, 0 < ta.numBlocksInUse());
+                ASSERTV(LINE, 0 == da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+            {
+                const Obj X(CAPACITY);
+                ASSERTV(LINE, EXP_CAPACITY == X.capacity());
+                ASSERTV(LINE, &da          == X.allocator());
+                ASSERTV(LINE, 0 < da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nAllocator propagation." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+            bslma::TestAllocator sa("scratch", veryVerbose);
+
+            const bsl::string LONG(100, 'x', &sa);
+
+            bdlcc::SingleConsumerBoundedQueue<bsl::string> mX(4, &ta);
+            const bsls::Types::Int64 numBlocks = da.numBlocksTotal();
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.tryPushBack(LONG));
+            }
+            ASSERT(numBlocks == da.numBlocksTotal());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, fill it, and verify that the values are popped in
+        //:   order, singly and in a batch.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        Obj mX(4, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        int value;
+        ASSERT(Obj::e_EMPTY == mX.tryPopFront(&value));
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT(0 == mX.pushBack(i));
+        }
+        ASSERT(X.isFull());
+        ASSERT(Obj::e_FULL == mX.tryPushBack(4));
+
+        ASSERT(0 == mX.popFront(&value));
+        ASSERT(0 == value);
+        ASSERT(0 == mX.tryPushBack(4));
+
+        bsl::vector<int> values(&ta);
+        ASSERT(0 == mX.popFrontBatch(&values, 10));
+        ASSERT(4 == values.size());
+        ASSERT(1 == values.front());
+        ASSERT(4 == values.back());
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == X.waitUntilEmpty());
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
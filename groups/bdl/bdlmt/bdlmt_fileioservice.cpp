@@ -0,0 +1,918 @@
+// bdlmt_fileioservice.cpp                                            -*-C++-*-
+#include <bdlmt_fileioservice.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_fileioservice_cpp, "$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+// 'io_uring' is used directly through its system calls, so that no library
+// beyond the kernel headers is required.
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define U_HAVE_IO_URING 1
+#endif
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                       // ==============================
+                       // struct FileIoService_Operation
+                       // ==============================
+
+struct FileIoService_Operation {
+    // This component-private 'struct' describes an operation submitted to a
+    // 'FileIoService'.
+
+    // TYPES
+    enum Type {
+        // Enumerate the types of operations.
+
+        e_READ,
+        e_WRITE,
+        e_SYNC
+    };
+
+    // PUBLIC DATA
+    int                                 d_type;        // 'Type'
+
+    FileIoService::FileDescriptor       d_descriptor;  // file
+
+    void                               *d_buffer_p;    // data (for 'e_READ'
+                                                       // and 'e_WRITE')
+
+    int                                 d_numBytes;    // size of 'd_buffer_p'
+
+    FileIoService::Offset               d_offset;      // offset in the file
+
+    FileIoService::Callback             d_callback;    // completion callback
+
+    FileIoService_Operation            *d_next_p;      // next queued operation
+
+#if defined(U_HAVE_IO_URING)
+    ::iovec                             d_iovec;       // 'd_buffer_p' and
+                                                       // 'd_numBytes', as
+                                                       // read by the kernel
+#endif
+
+    // CREATORS
+    FileIoService_Operation(int                            type,
+                            FileIoService::FileDescriptor  descriptor,
+                            void                          *buffer,
+                            int                            numBytes,
+                            FileIoService::Offset          offset,
+                            const FileIoService::Callback& callback,
+                            bslma::Allocator              *basicAllocator);
+        // Create an operation having the specified 'type', 'descriptor',
+        // 'buffer', 'numBytes', 'offset', and 'callback', using the specified
+        // 'basicAllocator' to supply memory.
+};
+
+// CREATORS
+FileIoService_Operation::FileIoService_Operation(
+                             int                            type,
+                             FileIoService::FileDescriptor  descriptor,
+                             void                          *buffer,
+                             int                            numBytes,
+                             FileIoService::Offset          offset,
+                             const FileIoService::Callback& callback,
+                             bslma::Allocator              *basicAllocator)
+: d_type(type)
+, d_descriptor(descriptor)
+, d_buffer_p(buffer)
+, d_numBytes(numBytes)
+, d_offset(offset)
+, d_callback(bsl::allocator_arg, basicAllocator, callback)
+, d_next_p(0)
+{
+}
+
+#if defined(U_HAVE_IO_URING)
+
+                          // ========================
+                          // class FileIoService_Ring
+                          // ========================
+
+class FileIoService_Ring {
+    // This component-private class provides an 'io_uring' instance, mapping
+    // its submission and completion queues into the address space of the
+    // process.  Submission and completion are performed by a single thread.
+
+    // DATA
+    int                  d_fd;            // 'io_uring' file descriptor
+
+    void                *d_sqRing_p;      // mapped submission queue ring
+    bsl::size_t          d_sqRingSize;
+
+    void                *d_cqRing_p;      // mapped completion queue ring
+    bsl::size_t          d_cqRingSize;    // (may equal 'd_sqRing_p')
+
+    io_uring_sqe        *d_sqes_p;        // mapped submission queue entries
+    bsl::size_t          d_sqesSize;
+
+    unsigned            *d_sqHead_p;      // consumed by the kernel
+    unsigned            *d_sqTail_p;      // produced by this object
+    unsigned            *d_sqArray_p;     // indices of entries to submit
+    unsigned             d_sqMask;
+    unsigned             d_sqNumEntries;
+    unsigned             d_sqTail;        // tail, including unpublished
+                                          // entries
+    unsigned             d_numToSubmit;   // entries not yet submitted
+
+    unsigned            *d_cqHead_p;      // consumed by this object
+    unsigned            *d_cqTail_p;      // produced by the kernel
+    unsigned             d_cqMask;
+    io_uring_cqe        *d_cqes_p;
+
+  private:
+    // NOT IMPLEMENTED
+    FileIoService_Ring(const FileIoService_Ring&);
+    FileIoService_Ring& operator=(const FileIoService_Ring&);
+
+  public:
+    // CREATORS
+    FileIoService_Ring();
+        // Create an object having no 'io_uring' instance.
+
+    ~FileIoService_Ring();
+        // Destroy the 'io_uring' instance of this object, if any, and destroy
+        // this object.
+
+    // MANIPULATORS
+    int open(unsigned numEntries);
+        // Create an 'io_uring' instance having a submission queue of at least
+        // the specified 'numEntries' entries.  Return 0 on success, and a
+        // non-zero value (e.g., if the kernel does not support 'io_uring')
+        // otherwise.
+
+    void close();
+        // Destroy the 'io_uring' instance of this object, if any.
+
+    io_uring_sqe *nextSqe();
+        // Return the address of a cleared submission queue entry to be
+        // submitted by the next call to 'enter', or 0 if the submission queue
+        // is full.
+
+    int enter(unsigned minNumCompletions);
+        // Submit the entries returned by 'nextSqe' since the last call, and
+        // wait until at least the specified 'minNumCompletions' completions
+        // are available.  Return 0 on success, and a non-zero value if the
+        // wait was interrupted or failed.
+
+    bool popCqe(io_uring_cqe *result);
+        // Load into the specified 'result' the oldest available completion,
+        // and remove it from the completion queue.  Return 'true' if a
+        // completion was available, and 'false' otherwise.
+
+    // ACCESSORS
+    unsigned numEntries() const;
+        // Return the number of entries of the submission queue.
+};
+
+// CREATORS
+FileIoService_Ring::FileIoService_Ring()
+: d_fd(-1)
+, d_sqRing_p(0)
+, d_sqRingSize(0)
+, d_cqRing_p(0)
+, d_cqRingSize(0)
+, d_sqes_p(0)
+, d_sqesSize(0)
+, d_sqHead_p(0)
+, d_sqTail_p(0)
+, d_sqArray_p(0)
+, d_sqMask(0)
+, d_sqNumEntries(0)
+, d_sqTail(0)
+, d_numToSubmit(0)
+, d_cqHead_p(0)
+, d_cqTail_p(0)
+, d_cqMask(0)
+, d_cqes_p(0)
+{
+}
+
+FileIoService_Ring::~FileIoService_Ring()
+{
+    close();
+}
+
+// MANIPULATORS
+int FileIoService_Ring::open(unsigned numEntries)
+{
+    BSLS_ASSERT(-1 == d_fd);
+
+    io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    const int fd = static_cast<int>(::syscall(__NR_io_uring_setup,
+                                              numEntries,
+                                              &params));
+    if (fd < 0) {
+        return 1;                                                     // RETURN
+    }
+    d_fd = fd;
+
+    d_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    d_cqRingSize = params.cq_off.cqes
+                                  + params.cq_entries * sizeof(io_uring_cqe);
+
+    const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMap && d_cqRingSize > d_sqRingSize) {
+        d_sqRingSize = d_cqRingSize;
+    }
+
+    d_sqRing_p = ::mmap(0,
+                        d_sqRingSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        fd,
+                        IORING_OFF_SQ_RING);
+    if (MAP_FAILED == d_sqRing_p) {
+        d_sqRing_p = 0;
+        close();
+        return 2;                                                     // RETURN
+    }
+
+    if (singleMap) {
+        d_cqRing_p   = d_sqRing_p;
+        d_cqRingSize = 0;
+    }
+    else {
+        d_cqRing_p = ::mmap(0,
+                            d_cqRingSize,
+                            PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE,
+                            fd,
+                            IORING_OFF_CQ_RING);
+        if (MAP_FAILED == d_cqRing_p) {
+            d_cqRing_p = 0;
+            close();
+            return 3;                                                 // RETURN
+        }
+    }
+
+    d_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes = ::mmap(0,
+                        d_sqesSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        fd,
+                        IORING_OFF_SQES);
+    if (MAP_FAILED == sqes) {
+        close();
+        return 4;                                                     // RETURN
+    }
+    d_sqes_p = static_cast<io_uring_sqe *>(sqes);
+
+    char *sq = static_cast<char *>(d_sqRing_p);
+    char *cq = static_cast<char *>(d_cqRing_p);
+
+    d_sqHead_p     = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    d_sqTail_p     = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    d_sqArray_p    = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    d_sqMask       = *reinterpret_cast<unsigned *>(sq
+                                                  + params.sq_off.ring_mask);
+    d_sqNumEntries = params.sq_entries;
+    d_sqTail       = *d_sqTail_p;
+    d_numToSubmit  = 0;
+
+    d_cqHead_p = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    d_cqTail_p = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    d_cqMask   = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    d_cqes_p   = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    return 0;
+}
+
+void FileIoService_Ring::close()
+{
+    if (d_sqes_p) {
+        ::munmap(d_sqes_p, d_sqesSize);
+        d_sqes_p = 0;
+    }
+    if (d_cqRing_p && d_cqRing_p != d_sqRing_p) {
+        ::munmap(d_cqRing_p, d_cqRingSize);
+    }
+    d_cqRing_p = 0;
+    if (d_sqRing_p) {
+        ::munmap(d_sqRing_p, d_sqRingSize);
+        d_sqRing_p = 0;
+    }
+    if (0 <= d_fd) {
+        ::close(d_fd);
+        d_fd = -1;
+    }
+}
+
+io_uring_sqe *FileIoService_Ring::nextSqe()
+{
+    const unsigned head = __atomic_load_n(d_sqHead_p, __ATOMIC_ACQUIRE);
+    if (d_sqTail - head >= d_sqNumEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned index = d_sqTail & d_sqMask;
+    d_sqArray_p[index]   = index;
+    ++d_sqTail;
+    ++d_numToSubmit;
+
+    io_uring_sqe *sqe = d_sqes_p + index;
+    bsl::memset(sqe, 0, sizeof *sqe);
+    return sqe;
+}
+
+int FileIoService_Ring::enter(unsigned minNumCompletions)
+{
+    __atomic_store_n(d_sqTail_p, d_sqTail, __ATOMIC_RELEASE);
+
+    const int rc = static_cast<int>(::syscall(
+                                     __NR_io_uring_enter,
+                                     d_fd,
+                                     d_numToSubmit,
+                                     minNumCompletions,
+                                     minNumCompletions ? IORING_ENTER_GETEVENTS
+                                                       : 0,
+                                     0,
+                                     0));
+    if (rc < 0) {
+        return 1;                                                     // RETURN
+    }
+
+    d_numToSubmit -= static_cast<unsigned>(rc);
+    return 0;
+}
+
+bool FileIoService_Ring::popCqe(io_uring_cqe *result)
+{
+    const unsigned head = *d_cqHead_p;
+    if (head == __atomic_load_n(d_cqTail_p, __ATOMIC_ACQUIRE)) {
+        return false;                                                 // RETURN
+    }
+
+    *result = d_cqes_p[head & d_cqMask];
+    __atomic_store_n(d_cqHead_p, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// ACCESSORS
+unsigned FileIoService_Ring::numEntries() const
+{
+    return d_sqNumEntries;
+}
+
+#endif
+
+namespace {
+
+#if defined(U_HAVE_IO_URING)
+
+unsigned ringSize(int maxNumPendingOperations)
+    // Return the number of submission queue entries for an 'io_uring'
+    // instance serving at most the specified 'maxNumPendingOperations'
+    // operations, including one entry for the wakeup of the dispatcher.
+{
+    const unsigned k_MAX_RING_SIZE = 4096;
+
+    unsigned size = 2;
+    while (size < k_MAX_RING_SIZE
+        && size < static_cast<unsigned>(maxNumPendingOperations) + 1) {
+        size *= 2;
+    }
+    return size;
+}
+
+void prepareSqe(io_uring_sqe *sqe, FileIoService_Operation *operation)
+    // Load into the specified 'sqe' the submission of the specified
+    // 'operation'.
+{
+    sqe->fd        = operation->d_descriptor;
+    sqe->user_data = reinterpret_cast<unsigned long long>(operation);
+
+    switch (operation->d_type) {
+      case FileIoService_Operation::e_READ:
+      case FileIoService_Operation::e_WRITE: {
+        operation->d_iovec.iov_base = operation->d_buffer_p;
+        operation->d_iovec.iov_len  = operation->d_numBytes;
+
+        sqe->opcode = FileIoService_Operation::e_READ == operation->d_type
+                    ? IORING_OP_READV
+                    : IORING_OP_WRITEV;
+        sqe->addr   = reinterpret_cast<unsigned long long>(
+                                                         &operation->d_iovec);
+        sqe->len    = 1;
+        sqe->off    = operation->d_offset;
+      } break;
+      default: {
+        BSLS_ASSERT(FileIoService_Operation::e_SYNC == operation->d_type);
+
+        sqe->opcode = IORING_OP_FSYNC;
+      } break;
+    }
+}
+
+void wakeUp(int eventFd)
+    // Increment the counter of the specified 'eventFd', completing any read
+    // of it that is in progress.
+{
+    const unsigned long long one = 1;
+    ssize_t rc;
+    do {
+        rc = ::write(eventFd, &one, sizeof one);
+    } while (rc < 0 && EINTR == errno);
+}
+
+#endif
+
+int performOperation(const FileIoService_Operation& operation)
+    // Perform the specified 'operation' with a blocking system call.  Return
+    // the number of bytes transferred (0 for 'e_SYNC'), or a negative value on
+    // error.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    OVERLAPPED overlapped;
+    bsl::memset(&overlapped, 0, sizeof overlapped);
+    overlapped.Offset     = static_cast<DWORD>(operation.d_offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(operation.d_offset >> 32);
+
+    DWORD numBytes = 0;
+    BOOL  success;
+
+    switch (operation.d_type) {
+      case FileIoService_Operation::e_READ: {
+        success = ReadFile(operation.d_descriptor,
+                           operation.d_buffer_p,
+                           operation.d_numBytes,
+                           &numBytes,
+                           &overlapped);
+        if (!success && ERROR_HANDLE_EOF == GetLastError()) {
+            return 0;                                                 // RETURN
+        }
+      } break;
+      case FileIoService_Operation::e_WRITE: {
+        success = WriteFile(operation.d_descriptor,
+                            operation.d_buffer_p,
+                            operation.d_numBytes,
+                            &numBytes,
+                            &overlapped);
+      } break;
+      default: {
+        success = FlushFileBuffers(operation.d_descriptor);
+      } break;
+    }
+
+    return success ? static_cast<int>(numBytes)
+                   : -static_cast<int>(GetLastError());
+#else
+    ssize_t rc;
+
+    do {
+        switch (operation.d_type) {
+          case FileIoService_Operation::e_READ: {
+            rc = ::pread(operation.d_descriptor,
+                         operation.d_buffer_p,
+                         operation.d_numBytes,
+                         operation.d_offset);
+          } break;
+          case FileIoService_Operation::e_WRITE: {
+            rc = ::pwrite(operation.d_descriptor,
+                          operation.d_buffer_p,
+                          operation.d_numBytes,
+                          operation.d_offset);
+          } break;
+          default: {
+            rc = ::fsync(operation.d_descriptor);
+          } break;
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return rc < 0 ? -errno : static_cast<int>(rc);
+#endif
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class FileIoService
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void FileIoService::complete(Operation *operation, int result)
+{
+    operation->d_callback(result);
+
+    operation->~Operation();
+    d_operationPool.deallocate(operation);
+
+    --d_numPending;
+}
+
+void FileIoService::dispatch()
+{
+#if defined(U_HAVE_IO_URING)
+    // The dispatcher keeps a read of 'd_wakeupFd' in progress ("armed") while
+    // it may be needed: submitters write to 'd_wakeupFd' after queuing an
+    // operation, which completes the read and wakes the dispatcher from
+    // 'enter'.  The dispatcher exits once 'stop' has been called, the queue
+    // is empty, and no operation (including the read) is in progress.
+
+    FileIoService_Ring& ring        = *d_ring_p;
+    const int           maxInFlight = static_cast<int>(ring.numEntries()) - 1;
+
+    int                 inFlight = 0;
+    bool                isArmed  = false;
+    unsigned long long  wakeupValue;
+    ::iovec             wakeupIovec = { &wakeupValue, sizeof wakeupValue };
+
+    for (;;) {
+        bool isDone;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_isWakeupPending = false;
+
+            while (d_queueHead_p && inFlight < maxInFlight) {
+                Operation *operation = d_queueHead_p;
+                d_queueHead_p        = operation->d_next_p;
+
+                io_uring_sqe *sqe = ring.nextSqe();
+                BSLS_ASSERT(sqe);
+
+                prepareSqe(sqe, operation);
+                ++inFlight;
+            }
+            if (!d_queueHead_p) {
+                d_queueTail_p = 0;
+            }
+
+            isDone = d_isStopping && !d_queueHead_p;
+        }
+
+        if (!isArmed && !isDone) {
+            io_uring_sqe *sqe = ring.nextSqe();
+            BSLS_ASSERT(sqe);
+
+            sqe->opcode    = IORING_OP_READV;
+            sqe->fd        = d_wakeupFd;
+            sqe->addr      = reinterpret_cast<unsigned long long>(
+                                                                &wakeupIovec);
+            sqe->len       = 1;
+            sqe->user_data = 0;
+            isArmed        = true;
+        }
+
+        if (isDone && 0 == inFlight && !isArmed) {
+            break;
+        }
+
+        ring.enter(1);
+
+        io_uring_cqe cqe;
+        while (ring.popCqe(&cqe)) {
+            if (0 == cqe.user_data) {
+                isArmed = false;
+                continue;
+            }
+
+            Operation *operation = reinterpret_cast<Operation *>(
+                                                                cqe.user_data);
+            --inFlight;
+
+            d_threadPool.enqueueJob(bdlf::BindUtil::bind(
+                                                      &FileIoService::complete,
+                                                      this,
+                                                      operation,
+                                                      cqe.res));
+        }
+    }
+#endif
+}
+
+void FileIoService::execute(Operation *operation)
+{
+    complete(operation, performOperation(*operation));
+}
+
+int FileIoService::submit(int             type,
+                          FileDescriptor  descriptor,
+                          void           *buffer,
+                          int             numBytes,
+                          Offset          offset,
+                          const Callback& callback)
+{
+    if (++d_numPending > d_maxNumPending) {
+        --d_numPending;
+        return 1;                                                     // RETURN
+    }
+
+    Operation *operation = new (d_operationPool.allocate())
+                                                   Operation(type,
+                                                             descriptor,
+                                                             buffer,
+                                                             numBytes,
+                                                             offset,
+                                                             callback,
+                                                             d_allocator_p);
+
+    bool isAccepted = false;
+    bool isQueued   = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (d_isStarted && !d_isStopping) {
+            isAccepted = true;
+
+#if defined(U_HAVE_IO_URING)
+            if (e_IO_URING == d_backend) {
+                if (d_queueTail_p) {
+                    d_queueTail_p->d_next_p = operation;
+                }
+                else {
+                    d_queueHead_p = operation;
+                }
+                d_queueTail_p = operation;
+                isQueued      = true;
+
+                // The wakeup is written while holding the mutex, so that
+                // 'stop' cannot close 'd_wakeupFd' concurrently.  It is
+                // written only once per drain of the queue by the dispatcher.
+
+                if (!d_isWakeupPending) {
+                    d_isWakeupPending = true;
+                    wakeUp(d_wakeupFd);
+                }
+            }
+#endif
+        }
+    }
+
+    if (isQueued) {
+        return 0;                                                     // RETURN
+    }
+
+    if (isAccepted
+     && 0 == d_threadPool.tryEnqueueJob(bdlf::BindUtil::bind(
+                                                       &FileIoService::execute,
+                                                       this,
+                                                       operation))) {
+        return 0;                                                     // RETURN
+    }
+
+    operation->~Operation();
+    d_operationPool.deallocate(operation);
+    --d_numPending;
+
+    return 2;
+}
+
+// CREATORS
+FileIoService::FileIoService(int               numThreads,
+                             int               maxNumPendingOperations,
+                             bslma::Allocator *basicAllocator)
+: d_requestedBackend(e_IO_URING)
+, d_backend(e_THREAD_POOL)
+, d_maxNumPending(maxNumPendingOperations)
+, d_numPending(0)
+, d_threadPool(numThreads, maxNumPendingOperations, basicAllocator)
+, d_operationPool(sizeof(Operation), basicAllocator)
+, d_mutex()
+, d_isStarted(false)
+, d_isStopping(false)
+, d_queueHead_p(0)
+, d_queueTail_p(0)
+, d_isWakeupPending(false)
+, d_ring_p(0)
+, d_wakeupFd(-1)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(1 <= maxNumPendingOperations);
+}
+
+FileIoService::FileIoService(Backend           backend,
+                             int               numThreads,
+                             int               maxNumPendingOperations,
+                             bslma::Allocator *basicAllocator)
+: d_requestedBackend(backend)
+, d_backend(e_THREAD_POOL)
+, d_maxNumPending(maxNumPendingOperations)
+, d_numPending(0)
+, d_threadPool(numThreads, maxNumPendingOperations, basicAllocator)
+, d_operationPool(sizeof(Operation), basicAllocator)
+, d_mutex()
+, d_isStarted(false)
+, d_isStopping(false)
+, d_queueHead_p(0)
+, d_queueTail_p(0)
+, d_isWakeupPending(false)
+, d_ring_p(0)
+, d_wakeupFd(-1)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(1 <= maxNumPendingOperations);
+}
+
+FileIoService::~FileIoService()
+{
+    stop();
+}
+
+// MANIPULATORS
+int FileIoService::read(FileDescriptor  descriptor,
+                        void           *buffer,
+                        int             numBytes,
+                        Offset          offset,
+                        const Callback& callback)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(callback);
+
+    return submit(Operation::e_READ,
+                  descriptor,
+                  buffer,
+                  numBytes,
+                  offset,
+                  callback);
+}
+
+int FileIoService::start()
+{
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 != d_threadPool.start()) {
+        return 1;                                                     // RETURN
+    }
+
+    Backend backend = e_THREAD_POOL;
+
+#if defined(U_HAVE_IO_URING)
+    if (e_IO_URING == d_requestedBackend) {
+        FileIoService_Ring *ring = new (*d_allocator_p) FileIoService_Ring();
+        const int           fd   = ::eventfd(0, EFD_CLOEXEC);
+
+        if (0 <= fd && 0 == ring->open(ringSize(d_maxNumPending))) {
+            d_ring_p   = ring;
+            d_wakeupFd = fd;
+
+            if (0 == bslmt::ThreadUtil::createWithAllocator(
+                             &d_dispatcherThread,
+                             bdlf::BindUtil::bind(&FileIoService::dispatch,
+                                                  this),
+                             d_allocator_p)) {
+                backend = e_IO_URING;
+            }
+            else {
+                d_ring_p   = 0;
+                d_wakeupFd = -1;
+            }
+        }
+
+        if (e_IO_URING != backend) {
+            if (0 <= fd) {
+                ::close(fd);
+            }
+            d_allocator_p->deleteObject(ring);
+        }
+    }
+#endif
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_backend   = backend;
+    d_isStarted = true;
+
+    return 0;
+}
+
+void FileIoService::stop()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isStarted) {
+            return;                                                   // RETURN
+        }
+        d_isStopping = true;
+
+#if defined(U_HAVE_IO_URING)
+        if (e_IO_URING == d_backend) {
+            wakeUp(d_wakeupFd);
+        }
+#endif
+    }
+
+#if defined(U_HAVE_IO_URING)
+    if (d_ring_p) {
+        bslmt::ThreadUtil::join(d_dispatcherThread);
+        d_dispatcherThread = bslmt::ThreadUtil::invalidHandle();
+
+        ::close(d_wakeupFd);
+        d_wakeupFd = -1;
+
+        d_allocator_p->deleteObject(d_ring_p);
+        d_ring_p = 0;
+    }
+#endif
+
+    // Wait for the remaining callbacks, and (for the 'e_THREAD_POOL' backend)
+    // operations, to complete.
+
+    d_threadPool.stop();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_isStarted  = false;
+    d_isStopping = false;
+}
+
+int FileIoService::sync(FileDescriptor descriptor, const Callback& callback)
+{
+    BSLS_ASSERT(callback);
+
+    return submit(Operation::e_SYNC, descriptor, 0, 0, 0, callback);
+}
+
+int FileIoService::write(FileDescriptor  descriptor,
+                         const void     *buffer,
+                         int             numBytes,
+                         Offset          offset,
+                         const Callback& callback)
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(callback);
+
+    return submit(Operation::e_WRITE,
+                  descriptor,
+                  const_cast<void *>(buffer),
+                  numBytes,
+                  offset,
+                  callback);
+}
+
+// ACCESSORS
+FileIoService::Backend FileIoService::backend() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isStarted ? d_backend : d_requestedBackend;
+}
+
+bool FileIoService::isStarted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isStarted;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
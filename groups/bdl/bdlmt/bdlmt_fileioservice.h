@@ -0,0 +1,463 @@
+// bdlmt_fileioservice.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMT_FILEIOSERVICE
+#define INCLUDED_BDLMT_FILEIOSERVICE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide asynchronous file I/O with completion callbacks.
+//
+//@CLASSES:
+//  bdlmt::FileIoService: asynchronous positional file reads, writes and syncs
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlmt::FileIoService',
+// that performs positional reads, positional writes, and syncs of open files
+// asynchronously, and reports the result of each operation to a callback
+// supplied when the operation is submitted.  Submitting an operation never
+// blocks the calling thread on disk I/O, so a latency-sensitive thread can
+// hand off its file I/O without dedicating a thread to each file.
+//
+// Completion callbacks are invoked by the threads of a
+// 'bdlmt::FixedThreadPool' owned by the service, and may be invoked
+// concurrently with one another.
+// Callbacks should not block for long, because they delay the completion of
+// other operations.
+//
+///Backends
+///--------
+// The service performs I/O using one of two backends, selected when it is
+// started:
+//
+//: 'e_IO_URING':
+//:   On Linux, if the kernel supports 'io_uring', a dispatcher thread places
+//:   submitted operations in the submission queue of an 'io_uring' instance,
+//:   and hands each completion to the thread pool.  Operations submitted while
+//:   the dispatcher is busy are passed to the kernel together, in a single
+//:   system call, and the number of operations in progress is not limited by
+//:   the number of threads.
+//:
+//: 'e_THREAD_POOL':
+//:   On other platforms, if 'io_uring' is unavailable (e.g., on older kernels,
+//:   or if it is disabled by a security policy), or if this backend is
+//:   requested explicitly, each operation is performed by a thread of the
+//:   pool using a blocking system call, and the callback is invoked by the
+//:   same thread.  At most 'numThreads' operations are in progress at once.
+//
+// The results reported to callbacks are the same for both backends.
+//
+///Operations and Results
+///----------------------
+// 'read' and 'write' transfer bytes at an offset specified with the operation,
+// independently of (and without changing) the file position of the
+// descriptor, so operations on the same descriptor may be in progress
+// concurrently.  'sync' flushes the data and metadata of a file to its storage
+// device.
+//
+// The callback of each operation is invoked exactly once, with an 'int'
+// result: for 'read' and 'write', the number of bytes transferred (which, as
+// for the underlying system calls, may be less than requested); for 'sync', 0;
+// and for any operation that fails, a negative value (on POSIX platforms, the
+// negated 'errno' value).  The descriptor, and the memory of the buffer passed
+// to 'read' or 'write', must remain valid until the callback is invoked.
+//
+// Operations are *not* ordered with respect to one another, even on the same
+// descriptor.  In particular, a 'sync' submitted after a 'write' does not
+// necessarily flush the data of that write; a client that requires this
+// ordering submits the 'sync' from the callback of the 'write'.
+//
+///Capacity and Shutdown
+///---------------------
+// The number of operations that have been submitted, but whose callbacks have
+// not yet returned, is limited by the 'maxNumPendingOperations' specified at
+// construction.  A submission that would exceed the limit, or that is made
+// while the service is not started, fails immediately with a non-zero status,
+// and the callback is not invoked.
+//
+// 'stop' waits until the callbacks of all accepted operations have returned.
+// Operations submitted concurrently with 'stop' (including from callbacks) may
+// or may not be accepted.
+//
+///Thread Safety
+///-------------
+// 'bdlmt::FileIoService' is fully thread-safe, meaning that operations may be
+// submitted concurrently from any number of threads, including from within
+// callbacks.  'start' and 'stop' must not be called concurrently with each
+// other, or from a callback.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Record and Syncing the File
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread handling requests must make a record durable before
+// acknowledging it, but must not block on the disk while doing so.
+//
+// First, we create and start a service having two threads for callbacks (and,
+// with the fallback backend, for I/O) and room for 100 pending operations:
+//..
+//  bdlmt::FileIoService service(2, 100);
+//  int rc = service.start();
+//  assert(0 == rc);
+//..
+// Then, we define the callbacks that complete the work.  When the write
+// completes, we submit a 'sync'; when the 'sync' completes, the record is
+// durable:
+//..
+//  struct Record {
+//      bslmt::Latch        d_done;
+//      int                 d_syncResult;
+//      const char         *d_data_p;
+//      int                 d_length;
+//
+//      Record() : d_done(1), d_syncResult(-1), d_data_p(0), d_length(0) {}
+//  };
+//
+//  void onSynced(Record *record, int result)
+//  {
+//      record->d_syncResult = result;
+//      record->d_done.arrive();
+//  }
+//
+//  void onWritten(bdlmt::FileIoService                 *service,
+//                 bdlmt::FileIoService::FileDescriptor  descriptor,
+//                 Record                               *record,
+//                 int                                   result)
+//  {
+//      if (result != record->d_length
+//       || 0 != service->sync(descriptor,
+//                             bdlf::BindUtil::bind(&onSynced,
+//                                                  record,
+//                                                  bdlf::PlaceHolders::_1))) {
+//          record->d_done.arrive();                 // failure: not durable
+//      }
+//  }
+//..
+// Next, we submit a write of the record at the start of an open file, and
+// continue with other work:
+//..
+//  Record record;
+//  record.d_data_p = "record #1\n";
+//  record.d_length = 10;
+//
+//  rc = service.write(descriptor,
+//                     record.d_data_p,
+//                     record.d_length,
+//                     0,
+//                     bdlf::BindUtil::bind(&onWritten,
+//                                          &service,
+//                                          descriptor,
+//                                          &record,
+//                                          bdlf::PlaceHolders::_1));
+//  assert(0 == rc);
+//..
+// Finally, we wait for the record to become durable, and stop the service:
+//..
+//  record.d_done.wait();
+//  assert(0 == record.d_syncResult);
+//
+//  service.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_functional.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+struct FileIoService_Operation;
+class FileIoService_Ring;
+
+                            // ===================
+                            // class FileIoService
+                            // ===================
+
+class FileIoService {
+    // This class provides a mechanism that performs file reads, writes, and
+    // syncs asynchronously, invoking a callback on completion of each
+    // operation.
+
+  public:
+    // TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor / file handle type.
+
+    typedef bdls::FilesystemUtil::Offset         Offset;
+        // 'Offset' is an alias for a signed integral type representing an
+        // offset within a file.
+
+    typedef bsl::function<void(int)>             Callback;
+        // 'Callback' is an alias for the type of a function invoked with the
+        // result of an operation.
+
+    enum Backend {
+        // Enumerate the mechanisms used to perform I/O.
+
+        e_THREAD_POOL,  // blocking system calls on the threads of the pool
+        e_IO_URING      // Linux 'io_uring'
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef FileIoService_Operation Operation;
+
+    // DATA
+    Backend                    d_requestedBackend;  // backend requested at
+                                                    // construction
+
+    Backend                    d_backend;           // backend in use
+
+    int                        d_maxNumPending;     // maximum number of
+                                                    // pending operations
+
+    bsls::AtomicInt            d_numPending;        // number of operations
+                                                    // whose callbacks have
+                                                    // not yet returned
+
+    FixedThreadPool            d_threadPool;        // threads for callbacks
+                                                    // (and for I/O with the
+                                                    // 'e_THREAD_POOL' backend)
+
+    bdlma::ConcurrentPool      d_operationPool;     // memory of operations
+
+    mutable bslmt::Mutex       d_mutex;             // guards the data below
+
+    bool                       d_isStarted;         // 'true' between 'start'
+                                                    // and 'stop'
+
+    bool                       d_isStopping;        // 'true' while 'stop' is
+                                                    // waiting for the
+                                                    // dispatcher
+
+    Operation                 *d_queueHead_p;       // operations not yet
+    Operation                 *d_queueTail_p;       // passed to the
+                                                    // dispatcher
+
+    bool                       d_isWakeupPending;   // 'true' if the dispatcher
+                                                    // has been signaled and
+                                                    // has not yet drained the
+                                                    // queue
+
+    FileIoService_Ring        *d_ring_p;            // 'io_uring' instance, or
+                                                    // 0 (owned)
+
+    int                        d_wakeupFd;          // 'eventfd' signaled to
+                                                    // wake the dispatcher
+
+    bslmt::ThreadUtil::Handle  d_dispatcherThread;  // 'io_uring' dispatcher
+
+    bslma::Allocator          *d_allocator_p;       // memory allocator (held,
+                                                    // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    FileIoService(const FileIoService&);
+    FileIoService& operator=(const FileIoService&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void complete(Operation *operation, int result);
+        // Invoke the callback of the specified 'operation' with the specified
+        // 'result', and release 'operation'.
+
+    void dispatch();
+        // Pass queued operations to the 'io_uring' instance, and hand each
+        // completion to the thread pool, until this service is stopped and
+        // every operation has completed.  This function is the entry point of
+        // the dispatcher thread.
+
+    void execute(Operation *operation);
+        // Perform the specified 'operation' with a blocking system call, and
+        // invoke its callback with the result.
+
+    int submit(int             type,
+               FileDescriptor  descriptor,
+               void           *buffer,
+               int             numBytes,
+               Offset          offset,
+               const Callback& callback);
+        // Submit an operation of the specified 'type' having the specified
+        // 'descriptor', 'buffer', 'numBytes', 'offset', and 'callback'.
+        // Return 0 on success, and a non-zero value otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FileIoService, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FileIoService(int               numThreads,
+                  int               maxNumPendingOperations,
+                  bslma::Allocator *basicAllocator = 0);
+    FileIoService(Backend           backend,
+                  int               numThreads,
+                  int               maxNumPendingOperations,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a service, initially not started, whose callbacks are
+        // invoked by a pool of the specified 'numThreads' threads, and that
+        // accepts at most the specified 'maxNumPendingOperations' operations
+        // whose callbacks have not yet returned.  Optionally specify the
+        // 'backend' to use.  If 'backend' is not specified, or is
+        // 'e_IO_URING', 'io_uring' is used if it is available when the service
+        // is started, and 'e_THREAD_POOL' is used otherwise.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numThreads' and
+        // '1 <= maxNumPendingOperations <= 0x01FFFFFF'.
+
+    ~FileIoService();
+        // Stop this service, waiting until the callbacks of all accepted
+        // operations have returned, and destroy this object.
+
+    // MANIPULATORS
+    int read(FileDescriptor  descriptor,
+             void           *buffer,
+             int             numBytes,
+             Offset          offset,
+             const Callback& callback);
+        // Submit a read of at most the specified 'numBytes' bytes, starting
+        // at the specified 'offset', from the file having the specified
+        // 'descriptor' into the specified 'buffer', and arrange for the
+        // specified 'callback' to be invoked with the number of bytes read
+        // (0 at the end of the file), or a negative value on error.  Return 0
+        // if the operation is accepted, and a non-zero value (without invoking
+        // 'callback') otherwise.  The behavior is undefined unless
+        // '0 <= numBytes', '0 <= offset', and 'descriptor' and the 'numBytes'
+        // bytes at 'buffer' remain valid until 'callback' is invoked.
+
+    int start();
+        // Start this service, selecting its backend.  Return 0 on success, and
+        // a non-zero value otherwise.  Starting a service that is already
+        // started has no effect.
+
+    void stop();
+        // Stop accepting operations, wait until the callbacks of all accepted
+        // operations have returned, and stop this service.  Stopping a service
+        // that is not started has no effect.  Note that a stopped service can
+        // be started again.
+
+    int sync(FileDescriptor descriptor, const Callback& callback);
+        // Submit a flush of the data and metadata of the file having the
+        // specified 'descriptor' to its storage device, and arrange for the
+        // specified 'callback' to be invoked with 0 on success, or a negative
+        // value on error.  Return 0 if the operation is accepted, and a
+        // non-zero value (without invoking 'callback') otherwise.  The
+        // behavior is undefined unless 'descriptor' remains valid until
+        // 'callback' is invoked.  Note that the flush is not ordered with
+        // respect to other operations on 'descriptor' that have not yet
+        // completed.
+
+    int write(FileDescriptor  descriptor,
+              const void     *buffer,
+              int             numBytes,
+              Offset          offset,
+              const Callback& callback);
+        // Submit a write of the specified 'numBytes' bytes from the specified
+        // 'buffer' to the file having the specified 'descriptor', starting at
+        // the specified 'offset', and arrange for the specified 'callback' to
+        // be invoked with the number of bytes written, or a negative value on
+        // error.  Return 0 if the operation is accepted, and a non-zero value
+        // (without invoking 'callback') otherwise.  The behavior is undefined
+        // unless '0 <= numBytes', '0 <= offset', and 'descriptor' and the
+        // 'numBytes' bytes at 'buffer' remain valid until 'callback' is
+        // invoked.
+
+    // ACCESSORS
+    Backend backend() const;
+        // Return the backend used by this service if it is started, and the
+        // backend that will be attempted by 'start' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if this service is started, and 'false' otherwise.
+
+    int maxNumPendingOperations() const;
+        // Return the maximum number of accepted operations whose callbacks
+        // have not yet returned.
+
+    int numPendingOperations() const;
+        // Return a snapshot of the number of accepted operations whose
+        // callbacks have not yet returned.
+
+    int numThreads() const;
+        // Return the number of threads of the pool of this service.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class FileIoService
+                            // -------------------
+
+// ACCESSORS
+inline
+int FileIoService::maxNumPendingOperations() const
+{
+    return d_maxNumPending;
+}
+
+inline
+int FileIoService::numPendingOperations() const
+{
+    return d_numPending;
+}
+
+inline
+int FileIoService::numThreads() const
+{
+    return d_threadPool.numThreads();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *FileIoService::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
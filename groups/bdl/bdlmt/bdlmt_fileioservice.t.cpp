@@ -0,0 +1,994 @@
+// bdlmt_fileioservice.t.cpp                                          -*-C++-*-
+#include <bdlmt_fileioservice.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a mechanism that performs file I/O
+// asynchronously using one of two backends.  Each test of the operations is
+// performed with both backends: 'e_THREAD_POOL', and the backend selected
+// when 'e_IO_URING' is requested (which is 'e_IO_URING' where the kernel
+// supports it).  We verify that each operation transfers the expected bytes
+// at the expected offset and reports the same result with either backend,
+// that each accepted operation's callback is invoked exactly once before
+// 'stop' returns, that submissions are rejected when the service is not
+// started or is at capacity, and that the service is safe to use from many
+// threads, including from callbacks.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FileIoService(int numThreads, int maxNumPending, Allocator *ba);
+// [ 2] FileIoService(Backend, int, int, Allocator *ba = 0);
+// [ 2] ~FileIoService();
+//
+// MANIPULATORS
+// [ 3] int read(FileDescriptor, void *, int, Offset, const Callback&);
+// [ 2] int start();
+// [ 2] void stop();
+// [ 3] int sync(FileDescriptor descriptor, const Callback& callback);
+// [ 3] int write(FileDescriptor, const void *, int, Offset, const Callback&);
+//
+// ACCESSORS
+// [ 2] Backend backend() const;
+// [ 2] bool isStarted() const;
+// [ 2] int maxNumPendingOperations() const;
+// [ 4] int numPendingOperations() const;
+// [ 2] int numThreads() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CAPACITY
+// [ 5] CONCURRENCY
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::FileIoService Obj;
+typedef Obj::FileDescriptor  FileDescriptor;
+typedef bdls::FilesystemUtil FileUtil;
+
+static const Obj::Backend BACKENDS[] = { Obj::e_THREAD_POOL,
+                                         Obj::e_IO_URING };
+static const int          NUM_BACKENDS = sizeof BACKENDS / sizeof *BACKENDS;
+
+// ============================================================================
+//                          GLOBAL HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdlmt_fileioservice." << bdls::ProcessUtil::getProcessId() << "."
+        << test << ".tmp";
+    return oss.str();
+}
+
+static
+FileDescriptor openTempFile(const bsl::string& fileName)
+    // Create (or truncate) the file having the specified 'fileName', and
+    // return a descriptor open for reading and writing it.
+{
+    return FileUtil::open(fileName,
+                          FileUtil::e_OPEN_OR_CREATE,
+                          FileUtil::e_READ_WRITE,
+                          FileUtil::e_TRUNCATE);
+}
+
+static
+bsl::string fileContents(const bsl::string& fileName)
+    // Return the contents of the file having the specified 'fileName'.
+{
+    FileDescriptor fd = FileUtil::open(fileName,
+                                       FileUtil::e_OPEN,
+                                       FileUtil::e_READ_ONLY);
+    ASSERT(FileUtil::k_INVALID_FD != fd);
+
+    bsl::string result;
+    char        buffer[256];
+    int         rc;
+    while (0 < (rc = FileUtil::read(fd, buffer, sizeof buffer))) {
+        result.append(buffer, rc);
+    }
+    FileUtil::close(fd);
+    return result;
+}
+
+                              // =============
+                              // struct Result
+                              // =============
+
+struct Result {
+    // This 'struct' records the result of one operation.
+
+    // PUBLIC DATA
+    bslmt::Latch    d_done;        // arrived on completion
+    bsls::AtomicInt d_numCalls;    // number of invocations of the callback
+    int             d_value;       // result passed to the callback
+
+    // CREATORS
+    Result()
+    : d_done(1)
+    , d_numCalls(0)
+    , d_value(-9999)
+    {
+    }
+
+    // MANIPULATORS
+    Obj::Callback callback()
+        // Return a callback that records its result in this object.
+    {
+        return bdlf::BindUtil::bind(&Result::record,
+                                    this,
+                                    bdlf::PlaceHolders::_1);
+    }
+
+    void record(int value)
+        // Record the specified 'value', and arrive on 'd_done'.
+    {
+        d_value = value;
+        ++d_numCalls;
+        d_done.arrive();
+    }
+
+    int wait()
+        // Wait for the operation to complete, and return its result.
+    {
+        d_done.wait();
+        return d_value;
+    }
+};
+
+void countCall(bsls::AtomicInt *counter, int result, int expected)
+    // Increment the specified 'counter' and verify that the specified 'result'
+    // is equal to the specified 'expected' value.
+{
+    ASSERTV(result, expected, result == expected);
+    ++*counter;
+}
+
+void blockingCall(bslmt::Latch *gate, bsls::AtomicInt *counter, int)
+    // Wait until the specified 'gate' is open, and then increment the
+    // specified 'counter'.
+{
+    gate->wait();
+    ++*counter;
+}
+
+                             // ================
+                             // class ChainWrite
+                             // ================
+
+class ChainWrite {
+    // This class writes a sequence of bytes to a file one at a time, with each
+    // write submitted from the callback of the previous one.
+
+    // DATA
+    Obj             *d_service_p;
+    FileDescriptor   d_descriptor;
+    const char      *d_data_p;
+    int              d_length;
+    int              d_position;
+    bslmt::Latch    *d_done_p;
+
+  public:
+    // CREATORS
+    ChainWrite(Obj            *service,
+               FileDescriptor  descriptor,
+               const char     *data,
+               int             length,
+               bslmt::Latch   *done)
+    : d_service_p(service)
+    , d_descriptor(descriptor)
+    , d_data_p(data)
+    , d_length(length)
+    , d_position(0)
+    , d_done_p(done)
+    {
+    }
+
+    // MANIPULATORS
+    void next(int result)
+        // Verify that the specified 'result' of the previous write is 1, and
+        // submit the next write, or arrive on the latch if none remain.
+    {
+        ASSERTV(result, 1 == result);
+
+        if (d_position == d_length) {
+            d_done_p->arrive();
+            return;                                                   // RETURN
+        }
+
+        const int position = d_position++;
+        const int rc       = d_service_p->write(
+                                        d_descriptor,
+                                        d_data_p + position,
+                                        1,
+                                        position,
+                                        bdlf::BindUtil::bind(
+                                                     &ChainWrite::next,
+                                                     this,
+                                                     bdlf::PlaceHolders::_1));
+        ASSERTV(rc, 0 == rc);
+    }
+};
+
+                              // =============
+                              // struct Worker
+                              // =============
+
+struct Worker {
+    // This 'struct' submits writes of distinct one-byte records from one
+    // thread.
+
+    // DATA
+    Obj             *d_service_p;
+    FileDescriptor   d_descriptor;
+    int              d_id;
+    int              d_numThreads;
+    int              d_numRecords;
+    bsls::AtomicInt *d_numCompleted_p;
+    bslmt::Barrier  *d_barrier_p;
+
+    // MANIPULATORS
+    void operator()()
+        // Write each record for which this thread is responsible, retrying
+        // while the service is at capacity.
+    {
+        static const char LETTERS[] = "abcdefghijklmnopqrstuvwxyz";
+
+        d_barrier_p->wait();
+
+        for (int i = d_id; i < d_numRecords; i += d_numThreads) {
+            while (0 != d_service_p->write(
+                                       d_descriptor,
+                                       &LETTERS[i % 26],
+                                       1,
+                                       i,
+                                       bdlf::BindUtil::bind(
+                                                       &countCall,
+                                                       d_numCompleted_p,
+                                                       bdlf::PlaceHolders::_1,
+                                                       1))) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct Record {
+    bslmt::Latch        d_done;
+    int                 d_syncResult;
+    const char         *d_data_p;
+    int                 d_length;
+
+    Record() : d_done(1), d_syncResult(-1), d_data_p(0), d_length(0) {}
+};
+
+void onSynced(Record *record, int result)
+{
+    record->d_syncResult = result;
+    record->d_done.arrive();
+}
+
+void onWritten(bdlmt::FileIoService                 *service,
+               bdlmt::FileIoService::FileDescriptor  descriptor,
+               Record                               *record,
+               int                                   result)
+{
+    if (result != record->d_length
+     || 0 != service->sync(descriptor,
+                           bdlf::BindUtil::bind(&onSynced,
+                                                record,
+                                                bdlf::PlaceHolders::_1))) {
+        record->d_done.arrive();                 // failure: not durable
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string    fileName   = tempFileName(test);
+        const FileDescriptor descriptor = openTempFile(fileName);
+        ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Record and Syncing the File
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread handling requests must make a record durable before
+// acknowledging it, but must not block on the disk while doing so.
+//
+// First, we create and start a service having two threads for callbacks (and,
+// with the fallback backend, for I/O) and room for 100 pending operations:
+//..
+    bdlmt::FileIoService service(2, 100);
+    int rc = service.start();
+    ASSERT(0 == rc);
+//..
+// Then, we define the callbacks that complete the work (see 'onWritten' and
+// 'onSynced' above).  When the write completes, we submit a 'sync'; when the
+// 'sync' completes, the record is durable.
+//
+// Next, we submit a write of the record at the start of an open file, and
+// continue with other work:
+//..
+    Record record;
+    record.d_data_p = "record #1\n";
+    record.d_length = 10;
+
+    rc = service.write(descriptor,
+                       record.d_data_p,
+                       record.d_length,
+                       0,
+                       bdlf::BindUtil::bind(&onWritten,
+                                            &service,
+                                            descriptor,
+                                            &record,
+                                            bdlf::PlaceHolders::_1));
+    ASSERT(0 == rc);
+//..
+// Finally, we wait for the record to become durable, and stop the service:
+//..
+    record.d_done.wait();
+    ASSERT(0 == record.d_syncResult);
+
+    service.stop();
+//..
+
+        ASSERT("record #1\n" == fileContents(fileName));
+
+        FileUtil::close(descriptor);
+        FileUtil::remove(fileName);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Operations may be submitted concurrently from many threads, and
+        //:   each is performed exactly once.
+        //:
+        //: 2 Operations may be submitted from callbacks.
+        //:
+        //: 3 'stop' returns only after every callback has returned.
+        //
+        // Plan:
+        //: 1 For each backend, have several threads write disjoint one-byte
+        //:   records, retrying while the service is at capacity, and verify
+        //:   the number of callbacks and the contents of the file after
+        //:   'stop'.  (C-1, 3)
+        //:
+        //: 2 For each backend, write a sequence of bytes, each submitted from
+        //:   the callback of the previous write, and verify the file.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY" << endl
+                                  << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 4000 };
+
+        bsl::string expected;
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            expected.push_back(static_cast<char>('a' + i % 26));
+        }
+
+        for (int bi = 0; bi < NUM_BACKENDS; ++bi) {
+            const Obj::Backend BACKEND = BACKENDS[bi];
+
+            if (veryVerbose) { T_ P(BACKEND) }
+
+            const bsl::string    fileName   = tempFileName(test);
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(BACKEND, 3, 64, &ta);
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt numCompleted(0);
+                bslmt::Barrier  barrier(k_NUM_THREADS);
+
+                bslmt::ThreadGroup threads(&ta);
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    Worker worker = { &mX,
+                                      descriptor,
+                                      i,
+                                      k_NUM_THREADS,
+                                      k_NUM_RECORDS,
+                                      &numCompleted,
+                                      &barrier };
+                    ASSERT(0 == threads.addThread(worker));
+                }
+                threads.joinAll();
+
+                mX.stop();
+                ASSERTV(BACKEND, numCompleted,
+                        k_NUM_RECORDS == numCompleted);
+                ASSERT(0 == mX.numPendingOperations());
+                ASSERTV(BACKEND, expected == fileContents(fileName));
+
+                // Chained writes.
+
+                const char DATA[] = "submitted from callbacks";
+
+                ASSERT(0 == mX.start());
+
+                bslmt::Latch done(1);
+                ChainWrite   chain(&mX,
+                                   descriptor,
+                                   DATA,
+                                   sizeof DATA - 1,
+                                   &done);
+                chain.next(1);
+                done.wait();
+
+                mX.stop();
+
+                ASSERTV(BACKEND,
+                        bsl::string(DATA) + expected.substr(sizeof DATA - 1)
+                                                    == fileContents(fileName));
+            }
+            ASSERTV(BACKEND, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            FileUtil::close(descriptor);
+            FileUtil::remove(fileName);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 An operation is pending from its submission until its callback
+        //:   returns.
+        //:
+        //: 2 A submission that would exceed 'maxNumPendingOperations()' is
+        //:   rejected without invoking its callback, and is accepted once a
+        //:   pending operation completes.
+        //:
+        //: 3 'stop' waits for pending callbacks.
+        //
+        // Plan:
+        //: 1 For each backend, create a service with room for two operations,
+        //:   whose callbacks block until a latch is opened.  Submit three
+        //:   operations, and verify that the third is rejected and that
+        //:   'numPendingOperations' is 2.  Open the latch, stop the service,
+        //:   and verify the callbacks.  (C-1..3)
+        //
+        // Testing:
+        //   int numPendingOperations() const;
+        //   CAPACITY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CAPACITY" << endl
+                                  << "========" << endl;
+
+        for (int bi = 0; bi < NUM_BACKENDS; ++bi) {
+            const Obj::Backend BACKEND = BACKENDS[bi];
+
+            if (veryVerbose) { T_ P(BACKEND) }
+
+            const bsl::string    fileName   = tempFileName(test);
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(BACKEND, 2, 2, &ta);  const Obj& X = mX;
+                ASSERT(0 == mX.start());
+                ASSERT(0 == X.numPendingOperations());
+
+                bslmt::Latch    gate(1);
+                bsls::AtomicInt numCalls(0);
+
+                const Obj::Callback callback = bdlf::BindUtil::bind(
+                                                       &blockingCall,
+                                                       &gate,
+                                                       &numCalls,
+                                                       bdlf::PlaceHolders::_1);
+
+                ASSERT(0 == mX.write(descriptor, "a", 1, 0, callback));
+                ASSERT(1 == X.numPendingOperations());
+                ASSERT(0 == mX.sync(descriptor, callback));
+                ASSERT(2 == X.numPendingOperations());
+                ASSERT(0 != mX.write(descriptor, "b", 1, 1, callback));
+                ASSERT(0 != mX.sync(descriptor, callback));
+                ASSERT(2 == X.numPendingOperations());
+
+                gate.arrive();
+
+                mX.stop();
+                ASSERTV(BACKEND, numCalls, 2 == numCalls);
+                ASSERT(0 == X.numPendingOperations());
+
+                ASSERT(0 == mX.start());
+
+                Result result;
+                ASSERT(0 == mX.write(descriptor, "b", 1, 1,
+                                     result.callback()));
+                ASSERT(1 == result.wait());
+
+                mX.stop();
+            }
+            ASSERTV(BACKEND, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            ASSERT("ab" == fileContents(fileName));
+
+            FileUtil::close(descriptor);
+            FileUtil::remove(fileName);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // OPERATIONS
+        //
+        // Concerns:
+        //: 1 'write' writes the requested bytes at the requested offset,
+        //:   extending the file (with a gap) if necessary, and reports the
+        //:   number of bytes written.
+        //:
+        //: 2 'read' reads the requested bytes from the requested offset, and
+        //:   reports the number of bytes read, which is less than requested
+        //:   at the end of the file, and 0 beyond it.
+        //:
+        //: 3 'read' and 'write' do not use or change the file position of
+        //:   the descriptor.
+        //:
+        //: 4 'sync' reports 0.
+        //:
+        //: 5 Each operation on an invalid descriptor reports a negative
+        //:   value.
+        //:
+        //: 6 Both backends report the same results.
+        //:
+        //: 7 Zero-length reads and writes report 0.
+        //
+        // Plan:
+        //: 1 For each backend, perform a table of writes and reads on a
+        //:   temporary file, and verify the results and the file contents.
+        //:   (C-1..3, 6..7)
+        //:
+        //: 2 For each backend, sync the file, and perform each operation on a
+        //:   descriptor that is not open.  (C-4..6)
+        //
+        // Testing:
+        //   int read(FileDescriptor, void *, int, Offset, const Callback&);
+        //   int sync(FileDescriptor descriptor, const Callback& callback);
+        //   int write(FileDescriptor, const void *, int, Offset, const
+        //   Callback&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "OPERATIONS" << endl
+                                  << "==========" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            bool        d_isWrite;   // 'true' for 'write', 'false' for 'read'
+            int         d_offset;    // offset of the operation
+            const char *d_data_p;    // data to write, or expected data read
+            int         d_numBytes;  // number of bytes to read (or -1 to
+                                     // write 'd_data_p')
+            int         d_result;    // expected result
+        } DATA[] = {
+            //LINE  WRITE  OFFSET  DATA             NUM  RESULT
+            //----  -----  ------  ---------------  ---  ------
+            { L_,   false,      0, "",               10,      0 },
+            { L_,   true,       0, "hello",          -1,      5 },
+            { L_,   true,       5, ", world",        -1,      7 },
+            { L_,   false,      0, "hello, world",   12,     12 },
+            { L_,   false,      7, "world",          20,      5 },
+            { L_,   false,     12, "",               10,      0 },
+            { L_,   false,    100, "",               10,      0 },
+            { L_,   true,       0, "J",              -1,      1 },
+            { L_,   false,      0, "Jello",           5,      5 },
+            { L_,   true,      14, "!",              -1,      1 },
+            { L_,   false,     11, "d\0\0!",         10,      4 },
+            { L_,   true,       3, "",               -1,      0 },
+            { L_,   false,      3, "",                0,      0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int bi = 0; bi < NUM_BACKENDS; ++bi) {
+            const Obj::Backend BACKEND = BACKENDS[bi];
+
+            if (veryVerbose) { T_ P(BACKEND) }
+
+            const bsl::string    fileName   = tempFileName(test);
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(BACKEND, 2, 10, &ta);
+                ASSERT(0 == mX.start());
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int         LINE     = DATA[ti].d_line;
+                    const bool        IS_WRITE = DATA[ti].d_isWrite;
+                    const int         OFFSET   = DATA[ti].d_offset;
+                    const char *const EXP      = DATA[ti].d_data_p;
+                    const int         RESULT   = DATA[ti].d_result;
+                    const int         NUM      = -1 == DATA[ti].d_numBytes
+                                   ? static_cast<int>(bsl::strlen(EXP))
+                                   : DATA[ti].d_numBytes;
+
+                    if (veryVerbose) { T_ T_ P_(LINE) P_(IS_WRITE) P(OFFSET) }
+
+                    Result result;
+                    char   buffer[32];
+                    bsl::memset(buffer, 'X', sizeof buffer);
+
+                    if (IS_WRITE) {
+                        ASSERTV(LINE, 0 == mX.write(descriptor,
+                                                    EXP,
+                                                    NUM,
+                                                    OFFSET,
+                                                    result.callback()));
+                    }
+                    else {
+                        ASSERTV(LINE, 0 == mX.read(descriptor,
+                                                   buffer,
+                                                   NUM,
+                                                   OFFSET,
+                                                   result.callback()));
+                    }
+
+                    const int rc = result.wait();
+                    ASSERTV(LINE, BACKEND, rc, RESULT == rc);
+                    ASSERTV(LINE, 1 == result.d_numCalls);
+
+                    if (!IS_WRITE) {
+                        ASSERTV(LINE, 0 == bsl::memcmp(buffer, EXP, RESULT));
+                        ASSERTV(LINE, 'X' == buffer[RESULT]);
+                    }
+                }
+
+                // The file position is unchanged.
+
+                ASSERT(0 == FileUtil::seek(descriptor,
+                                           0,
+                                           FileUtil::e_SEEK_FROM_CURRENT));
+
+                ASSERT(bsl::string("Jello, world\0\0!", 15) ==
+                                                       fileContents(fileName));
+
+                Result syncResult;
+                ASSERT(0 == mX.sync(descriptor, syncResult.callback()));
+                ASSERTV(BACKEND, syncResult.wait(), 0 == syncResult.wait());
+
+                // Operations on a descriptor that is not open.
+
+                const FileDescriptor closed = openTempFile(fileName + ".x");
+                FileUtil::close(closed);
+                FileUtil::remove(fileName + ".x");
+
+                char   buffer[4];
+                Result readResult;
+                Result writeResult;
+                Result badSyncResult;
+
+                ASSERT(0 == mX.read(closed,
+                                    buffer,
+                                    4,
+                                    0,
+                                    readResult.callback()));
+                ASSERT(0 == mX.write(closed,
+                                     "abcd",
+                                     4,
+                                     0,
+                                     writeResult.callback()));
+                ASSERT(0 == mX.sync(closed, badSyncResult.callback()));
+
+                ASSERTV(readResult.wait(),    0 > readResult.wait());
+                ASSERTV(writeResult.wait(),   0 > writeResult.wait());
+                ASSERTV(badSyncResult.wait(), 0 > badSyncResult.wait());
+            }
+            ASSERTV(BACKEND, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            FileUtil::close(descriptor);
+            FileUtil::remove(fileName);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'start', 'stop', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors record the number of threads, the capacity,
+        //:   the requested backend, and the allocator.
+        //:
+        //: 2 A new service is not started, and rejects operations without
+        //:   invoking their callbacks.
+        //:
+        //: 3 'start' starts the service, selecting 'e_THREAD_POOL' if it is
+        //:   requested, and 'e_IO_URING' only if it is requested; 'start' of
+        //:   a started service has no effect.
+        //:
+        //: 4 'stop' stops the service, after which operations are rejected;
+        //:   'stop' of a stopped service has no effect, and a stopped service
+        //:   may be started again.
+        //:
+        //: 5 The destructor stops a started service.
+        //:
+        //: 6 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Construct services with each constructor, and verify the
+        //:   accessors before and after 'start' and 'stop', and that
+        //:   operations are accepted only while the service is started.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   FileIoService(int numThreads, int maxNumPending, Allocator *ba);
+        //   FileIoService(Backend, int, int, Allocator *ba = 0);
+        //   ~FileIoService();
+        //   int start();
+        //   void stop();
+        //   Backend backend() const;
+        //   bool isStarted() const;
+        //   int maxNumPendingOperations() const;
+        //   int numThreads() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'start', 'stop', AND ACCESSORS" << endl
+                          << "=======================================" << endl;
+
+        const bsl::string    fileName   = tempFileName(test);
+        const FileDescriptor descriptor = openTempFile(fileName);
+        ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(3, 17, &ta);  const Obj& X = mX;
+
+            ASSERT(3  == X.numThreads());
+            ASSERT(17 == X.maxNumPendingOperations());
+            ASSERT(&ta == X.allocator());
+            ASSERT(Obj::e_IO_URING == X.backend());
+            ASSERT(!X.isStarted());
+
+            Result result;
+            ASSERT(0 != mX.sync(descriptor, result.callback()));
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+            const Obj::Backend BACKEND = X.backend();
+            if (verbose) { P(BACKEND) }
+
+            ASSERT(0 == mX.start());
+            ASSERT(BACKEND == X.backend());
+
+            ASSERT(0 == mX.sync(descriptor, result.callback()));
+            ASSERT(0 == result.wait());
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+            ASSERT(Obj::e_IO_URING == X.backend());
+            ASSERT(0 == X.numPendingOperations());
+            ASSERT(1 == result.d_numCalls);
+
+            Result rejected;
+            ASSERT(0 != mX.sync(descriptor, rejected.callback()));
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(BACKEND == X.backend());
+            mX.stop();
+
+            ASSERT(0 == rejected.d_numCalls);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            Obj mX(Obj::e_THREAD_POOL, 1, 1, &ta);  const Obj& X = mX;
+
+            ASSERT(1  == X.numThreads());
+            ASSERT(1  == X.maxNumPendingOperations());
+            ASSERT(Obj::e_THREAD_POOL == X.backend());
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+            ASSERT(Obj::e_THREAD_POOL == X.backend());
+
+            // The destructor stops the service.
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        FileUtil::close(descriptor);
+        FileUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 For each backend, write to a file, sync it, and read the data
+        //:   back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        for (int bi = 0; bi < NUM_BACKENDS; ++bi) {
+            const bsl::string    fileName   = tempFileName(test);
+            const FileDescriptor descriptor = openTempFile(fileName);
+            ASSERT(FileUtil::k_INVALID_FD != descriptor);
+
+            Obj mX(BACKENDS[bi], 1, 4);
+            ASSERT(0 == mX.start());
+
+            Result written;
+            ASSERT(0 == mX.write(descriptor, "hello", 5, 0,
+                                 written.callback()));
+            ASSERT(5 == written.wait());
+
+            Result synced;
+            ASSERT(0 == mX.sync(descriptor, synced.callback()));
+            ASSERT(0 == synced.wait());
+
+            char   buffer[8];
+            Result read;
+            ASSERT(0 == mX.read(descriptor, buffer, sizeof buffer, 1,
+                                read.callback()));
+            ASSERT(4 == read.wait());
+            ASSERT(0 == bsl::memcmp(buffer, "ello", 4));
+
+            mX.stop();
+
+            FileUtil::close(descriptor);
+            FileUtil::remove(fileName);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,564 @@
+// bdlmt_filetreeutil.cpp                                             -*-C++-*-
+#include <bdlmt_filetreeutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_filetreeutil_cpp, "$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+
+#include <bdlde_charconvertutf16.h>
+#else
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/syscall.h>
+#endif
+#endif
+
+// Directories are read with the 'getdents64' system call on Linux, and with
+// 'readdir' on other POSIX platforms.
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_getdents64)
+#define U_USE_GETDENTS64 1
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlmt::FileTreeUtil Util;
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+const char k_SEPARATOR = '\\';
+#else
+const char k_SEPARATOR = '/';
+#endif
+
+enum EntryKind {
+    // Enumerate the kinds of entries found when reading a directory.
+
+    e_FILE,       // a regular file
+    e_DIRECTORY,  // a directory
+    e_OTHER       // a symbolic link, or another kind of file
+};
+
+#if defined(U_USE_GETDENTS64)
+struct LinuxDirent64 {
+    // This 'struct' has the layout of the records returned by the
+    // 'getdents64' system call, which the C library does not declare on all
+    // supported versions.
+
+    unsigned long long d_ino;
+    long long          d_off;
+    unsigned short     d_reclen;
+    unsigned char      d_type;
+    char               d_name[1];
+};
+
+enum {
+    k_DIRECTORY_BUFFER_SIZE = 32 * 1024  // bytes read by each 'getdents64'
+};
+#endif
+
+                        // =======================
+                        // local utility functions
+                        // =======================
+
+bool isDotOrDots(const char *name)
+    // Return 'true' if the specified 'name' is "." or "..", and 'false'
+    // otherwise.
+{
+    return '.' == name[0]
+        && (0 == name[1] || ('.' == name[1] && 0 == name[2]));
+}
+
+const char *nextCharacter(const char *string)
+    // Return the address of the character following the (UTF-8 encoded)
+    // character at the specified 'string'.  The behavior is undefined unless
+    // '*string' is not 0.
+{
+    ++string;
+    while (0x80 == (static_cast<unsigned char>(*string) & 0xc0)) {
+        ++string;
+    }
+    return string;
+}
+
+bool matchesPattern(const char *pattern, const char *name)
+    // Return 'true' if the specified 'name' matches the specified 'pattern',
+    // in which '*' matches any sequence of characters and '?' matches any one
+    // character, and 'false' otherwise.  On POSIX platforms, a 'name'
+    // beginning with '.' is matched only by a 'pattern' beginning with '.'.
+{
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+    if ('.' == *name && '.' != *pattern) {
+        return false;                                                 // RETURN
+    }
+#endif
+
+    // Match greedily, returning to the character after the last '*' on a
+    // mismatch; only the last '*' need be retried.
+
+    const char *starPattern = 0;
+    const char *starName    = 0;
+
+    while (*name) {
+        if ('*' == *pattern) {
+            starPattern = ++pattern;
+            starName    = name;
+        }
+        else if ('?' == *pattern) {
+            ++pattern;
+            name = nextCharacter(name);
+        }
+        else if (*pattern == *name) {
+            ++pattern;
+            ++name;
+        }
+        else if (starPattern) {
+            pattern  = starPattern;
+            starName = nextCharacter(starName);
+            name     = starName;
+        }
+        else {
+            return false;                                             // RETURN
+        }
+    }
+
+    while ('*' == *pattern) {
+        ++pattern;
+    }
+    return 0 == *pattern;
+}
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+bool isIgnorableError(int error)
+    // Return 'true' if the specified 'error' (an 'errno' value) indicates that
+    // a directory is not accessible, or no longer exists (or is no longer a
+    // directory), and 'false' otherwise.
+{
+    return EACCES  == error
+        || EPERM   == error
+        || ENOENT  == error
+        || ENOTDIR == error
+        || ELOOP   == error;
+}
+
+EntryKind kindFromStat(int directoryDescriptor, const char *name)
+    // Return the kind of the entry having the specified 'name' in the
+    // directory having the specified 'directoryDescriptor', without following
+    // symbolic links.  Return 'e_OTHER' if the entry cannot be examined.
+{
+    struct stat status;
+    if (0 != ::fstatat(directoryDescriptor,
+                       name,
+                       &status,
+                       AT_SYMLINK_NOFOLLOW)) {
+        return e_OTHER;                                               // RETURN
+    }
+    return S_ISREG(status.st_mode) ? e_FILE
+         : S_ISDIR(status.st_mode) ? e_DIRECTORY
+         : e_OTHER;
+}
+#endif
+
+                              // ===============
+                              // class Traversal
+                              // ===============
+
+class Traversal {
+    // This class holds the state shared by the threads taking part in one
+    // traversal of a tree, and scans its directories.
+
+    // DATA
+    bdlmt::FixedThreadPool *d_threadPool_p;  // pool scanning subdirectories
+
+    const bsl::string&      d_pattern;       // pattern for leaf names
+
+    const Util::Visitor&    d_visitor;       // visitor of matching entries
+
+    bslmt::Mutex            d_mutex;         // guards 'd_numJobs'
+
+    bslmt::Condition        d_condition;     // signaled when 'd_numJobs'
+                                             // becomes 0
+
+    int                     d_numJobs;       // number of enqueued scans not
+                                             // yet completed
+
+    bsls::AtomicBool        d_hasError;      // 'true' if a directory could
+                                             // not be read
+
+    bslma::Allocator       *d_allocator_p;   // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    Traversal(const Traversal&);
+    Traversal& operator=(const Traversal&);
+
+    // PRIVATE MANIPULATORS
+    void onEntry(bsl::string              *path,
+                 bsl::size_t               prefixLength,
+                 const char               *name,
+                 EntryKind                 kind,
+                 bsl::vector<bsl::string> *subdirectories);
+        // Visit the entry having the specified 'name' and 'kind', whose path
+        // is formed by appending 'name' to the specified 'prefixLength'
+        // characters of the specified 'path', if it matches, and append its
+        // path to the specified 'subdirectories' if it is a directory.
+
+    int readDirectory(const bsl::string&        directory,
+                      bsl::vector<bsl::string> *subdirectories);
+        // Visit each matching entry of the specified 'directory', and load
+        // the paths of its subdirectories into the specified
+        // 'subdirectories'.  Return 0 on success, and a non-zero value if the
+        // directory could not be read for a reason other than it not being
+        // accessible or no longer existing.
+
+    void scanJob(const bsl::string& directory);
+        // Scan the specified 'directory', and signal the completion of the
+        // enqueued job that called this function.
+
+  public:
+    // CREATORS
+    Traversal(bdlmt::FixedThreadPool *threadPool,
+              const bsl::string&      pattern,
+              const Util::Visitor&    visitor,
+              bslma::Allocator       *allocator);
+        // Create a traversal that visits entries matching the specified
+        // 'pattern' with the specified 'visitor', using the specified
+        // 'threadPool' to scan subdirectories, and the specified 'allocator'
+        // to supply memory.
+
+    // MANIPULATORS
+    void scan(const bsl::string& directory);
+        // Visit each matching entry of the specified 'directory', and enqueue
+        // (or, if that fails, scan in this thread) each of its
+        // subdirectories.
+
+    void wait();
+        // Block until every enqueued scan has completed.
+
+    // ACCESSORS
+    bool hasError() const;
+        // Return 'true' if a directory of the tree could not be read, and
+        // 'false' otherwise.
+};
+
+                              // ---------------
+                              // class Traversal
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+void Traversal::onEntry(bsl::string              *path,
+                        bsl::size_t               prefixLength,
+                        const char               *name,
+                        EntryKind                 kind,
+                        bsl::vector<bsl::string> *subdirectories)
+{
+    if (isDotOrDots(name) || (e_FILE != kind && e_DIRECTORY != kind)) {
+        return;                                                       // RETURN
+    }
+
+    path->resize(prefixLength);
+    path->append(name);
+
+    if (matchesPattern(d_pattern.c_str(), name)) {
+        d_visitor(path->c_str(),
+                  e_FILE == kind ? Util::e_REGULAR_FILE : Util::e_DIRECTORY);
+    }
+
+    if (e_DIRECTORY == kind) {
+        subdirectories->push_back(*path);
+    }
+}
+
+int Traversal::readDirectory(const bsl::string&        directory,
+                             bsl::vector<bsl::string> *subdirectories)
+{
+    bsl::string path(directory, d_allocator_p);
+    if (path.empty() || k_SEPARATOR != path.back()) {
+        path.push_back(k_SEPARATOR);
+    }
+    const bsl::size_t prefixLength = path.length();
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    // Use '-' to replace invalid characters, rather than the default '?',
+    // which is a wildcard.
+
+    path.push_back('*');
+    bsl::wstring widePattern(d_allocator_p);
+    (void)bdlde::CharConvertUtf16::utf8ToUtf16(&widePattern,
+                                               path.c_str(),
+                                               0,
+                                               '-');
+
+    WIN32_FIND_DATAW data;
+    HANDLE           handle = FindFirstFileExW(widePattern.c_str(),
+                                               FindExInfoBasic,
+                                               &data,
+                                               FindExSearchNameMatch,
+                                               NULL,
+                                               FIND_FIRST_EX_LARGE_FETCH);
+    if (INVALID_HANDLE_VALUE == handle) {
+        const DWORD error = GetLastError();
+        return ERROR_ACCESS_DENIED == error
+            || ERROR_FILE_NOT_FOUND == error
+            || ERROR_PATH_NOT_FOUND == error
+            || ERROR_DIRECTORY == error ? 0 : 1;                      // RETURN
+    }
+
+    bsl::string name(d_allocator_p);
+    do {
+        const DWORD     attributes = data.dwFileAttributes;
+        const EntryKind kind       =
+                         attributes & FILE_ATTRIBUTE_REPARSE_POINT ? e_OTHER
+                       : attributes & FILE_ATTRIBUTE_DIRECTORY ? e_DIRECTORY
+                       : attributes & FILE_ATTRIBUTE_DEVICE ? e_OTHER
+                       : e_FILE;
+
+        name.clear();
+        (void)bdlde::CharConvertUtf16::utf16ToUtf8(&name,
+                                                   data.cFileName,
+                                                   0,
+                                                   '-');
+        onEntry(&path, prefixLength, name.c_str(), kind, subdirectories);
+    } while (FindNextFileW(handle, &data));
+
+    const DWORD error = GetLastError();
+    FindClose(handle);
+
+    return ERROR_NO_MORE_FILES == error ? 0 : 1;
+#elif defined(U_USE_GETDENTS64)
+    const int descriptor = ::open(directory.c_str(),
+                                  O_RDONLY | O_DIRECTORY | O_NOFOLLOW
+                                                                | O_CLOEXEC);
+    if (0 > descriptor) {
+        return isIgnorableError(errno) ? 0 : 1;                       // RETURN
+    }
+
+    // The records returned by 'getdents64' are 8-byte aligned within the
+    // buffer, which the allocator aligns maximally.
+
+    bsl::vector<char> buffer(k_DIRECTORY_BUFFER_SIZE, d_allocator_p);
+    int               rc = 0;
+
+    while (true) {
+        const long numBytes = ::syscall(SYS_getdents64,
+                                        descriptor,
+                                        buffer.data(),
+                                        buffer.size());
+        if (0 == numBytes) {
+            break;
+        }
+        if (0 > numBytes) {
+            if (EINTR == errno) {
+                continue;
+            }
+            rc = isIgnorableError(errno) ? 0 : 1;
+            break;
+        }
+
+        for (long position = 0; position < numBytes;) {
+            const LinuxDirent64 *entry =
+                 reinterpret_cast<const LinuxDirent64 *>(&buffer[position]);
+            position += entry->d_reclen;
+
+            const EntryKind kind = DT_REG     == entry->d_type ? e_FILE
+                                 : DT_DIR     == entry->d_type ? e_DIRECTORY
+                                 : DT_UNKNOWN == entry->d_type
+                                 ? kindFromStat(descriptor, entry->d_name)
+                                 : e_OTHER;
+
+            onEntry(&path, prefixLength, entry->d_name, kind, subdirectories);
+        }
+    }
+
+    ::close(descriptor);
+    return rc;
+#else
+    DIR *dir = ::opendir(directory.c_str());
+    if (0 == dir) {
+        return isIgnorableError(errno) ? 0 : 1;                       // RETURN
+    }
+
+    // 'readdir' is safe to call concurrently on distinct directory streams on
+    // all supported platforms.
+
+    int rc = 0;
+    while (true) {
+        errno = 0;
+        const struct dirent *entry = ::readdir(dir);
+        if (0 == entry) {
+            if (0 != errno) {
+                rc = isIgnorableError(errno) ? 0 : 1;
+            }
+            break;
+        }
+
+#if defined(DT_UNKNOWN) && defined(DT_DIR) && defined(DT_REG)
+        const EntryKind kind = DT_REG     == entry->d_type ? e_FILE
+                             : DT_DIR     == entry->d_type ? e_DIRECTORY
+                             : DT_UNKNOWN == entry->d_type
+                             ? kindFromStat(::dirfd(dir), entry->d_name)
+                             : e_OTHER;
+#else
+        const EntryKind kind = kindFromStat(::dirfd(dir), entry->d_name);
+#endif
+
+        onEntry(&path, prefixLength, entry->d_name, kind, subdirectories);
+    }
+
+    ::closedir(dir);
+    return rc;
+#endif
+}
+
+void Traversal::scanJob(const bsl::string& directory)
+{
+    scan(directory);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    if (0 == --d_numJobs) {
+        d_condition.signal();
+    }
+}
+
+// CREATORS
+Traversal::Traversal(bdlmt::FixedThreadPool *threadPool,
+                     const bsl::string&      pattern,
+                     const Util::Visitor&    visitor,
+                     bslma::Allocator       *allocator)
+: d_threadPool_p(threadPool)
+, d_pattern(pattern)
+, d_visitor(visitor)
+, d_numJobs(0)
+, d_hasError(false)
+, d_allocator_p(allocator)
+{
+}
+
+// MANIPULATORS
+void Traversal::scan(const bsl::string& directory)
+{
+    bsl::vector<bsl::string> subdirectories(d_allocator_p);
+
+    if (0 != readDirectory(directory, &subdirectories)) {
+        d_hasError = true;
+    }
+
+    for (bsl::size_t i = 0; i < subdirectories.size(); ++i) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            ++d_numJobs;
+        }
+
+        if (0 == d_threadPool_p->tryEnqueueJob(
+                        bdlf::BindUtil::bindS(d_allocator_p,
+                                              &Traversal::scanJob,
+                                              this,
+                                              subdirectories[i]))) {
+            continue;
+        }
+
+        // The job was not enqueued (and so will never signal), so scan the
+        // subdirectory in this thread.  Note that the count of jobs cannot
+        // have reached 0, because the scan calling this function is either
+        // itself a job, or is waited for before 'wait' is called.
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            --d_numJobs;
+        }
+
+        scan(subdirectories[i]);
+    }
+}
+
+void Traversal::wait()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    while (0 != d_numJobs) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+// ACCESSORS
+bool Traversal::hasError() const
+{
+    return d_hasError;
+}
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                            // -------------------
+                            // struct FileTreeUtil
+                            // -------------------
+
+// CLASS METHODS
+int FileTreeUtil::visitTree(FixedThreadPool    *threadPool,
+                            const bsl::string&  root,
+                            const bsl::string&  pattern,
+                            const Visitor&      visitor)
+{
+    BSLS_ASSERT(threadPool);
+
+    if (!bdls::FilesystemUtil::isDirectory(root)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (bsl::string::npos != pattern.find(k_SEPARATOR)) {
+        return -2;                                                    // RETURN
+    }
+
+    Traversal traversal(threadPool,
+                        pattern,
+                        visitor,
+                        bslma::Default::defaultAllocator());
+
+    traversal.scan(root);
+    traversal.wait();
+
+    return traversal.hasError() ? -3 : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
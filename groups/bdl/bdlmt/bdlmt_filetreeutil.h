@@ -0,0 +1,189 @@
+// bdlmt_filetreeutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLMT_FILETREEUTIL
+#define INCLUDED_BDLMT_FILETREEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel traversal of a directory tree.
+//
+//@CLASSES:
+//  bdlmt::FileTreeUtil: namespace for parallel directory tree traversal
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlmt::FileTreeUtil', whose 'visitTree' function traverses a directory
+// tree, as does 'bdls::FilesystemUtil::visitTree', but scans the
+// subdirectories of the tree concurrently using the threads of a
+// 'bdlmt::FixedThreadPool' supplied by the caller, and passes each matching
+// path to a visitor as soon as it is found.  It is intended for trees holding
+// very many files (e.g., directories of rotated log files), where a serial
+// traversal is dominated by the latency of reading directories and of
+// querying the type of each entry.
+//
+///Traversal
+///---------
+// 'visitTree' visits each regular file and each directory in the tree whose
+// leaf name matches a pattern, passing the visitor its full path (starting
+// with the specified root) and its type.  Symbolic links (and any other files
+// that are neither regular files nor directories) are not visited and are not
+// followed.  Every directory in the tree is traversed, whether or not it
+// matches the pattern.  The root itself is never visited.  In the pattern,
+// '*' matches any sequence of characters and '?' matches any one character;
+// all other characters match only themselves.  The special directories '.'
+// and '..' are never matched, and, on POSIX platforms, a name beginning with
+// '.' is matched only by a pattern that begins with '.' (as with
+// 'bdls::FilesystemUtil::visitTree').
+//
+// Where the operating system reports the type of each entry when a directory
+// is read (e.g., the 'd_type' field on Linux and BSD, and the file attributes
+// on Windows), no additional system call is made to determine the type of an
+// entry.  On Linux, directories are read with 'getdents64' into a large
+// buffer, so that a directory of many entries is read in few system calls.
+//
+///Concurrency
+///-----------
+// The calling thread scans the root directory, and each subdirectory that it
+// finds is enqueued on the thread pool, whose threads scan it and enqueue
+// their own subdirectories in turn.  If a subdirectory cannot be enqueued
+// (e.g., because the queue of the pool is full, or the pool is not started),
+// it is scanned by the thread that found it.  'visitTree' returns when every
+// directory of the tree has been scanned.
+//
+// The visitor is invoked by the calling thread and by the threads of the pool,
+// and may be invoked concurrently from several threads; it must therefore be
+// thread-safe.  The order in which paths are visited is unspecified.  A
+// visitor that needs to process paths serially can collect them (under a
+// lock) and process them after 'visitTree' returns.
+//
+// The pool may be used for other jobs during (and between) traversals, and
+// several traversals may use the same pool concurrently.  However,
+// 'visitTree' must not be called from a thread of the pool that it is
+// supplied: the calling thread waits for jobs of that pool to complete.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Size of a Log Directory Tree
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an application writes log files, named with the suffix
+// ".log", in a tree of directories, and that we want the total size of these
+// files.
+//
+// First, we define a visitor that adds the size of each regular file that it
+// visits to an atomic total.  The visitor is invoked concurrently, so it uses
+// no other state:
+//..
+//  void addFileSize(bsls::AtomicInt64              *total,
+//                   const char                     *path,
+//                   bdlmt::FileTreeUtil::EntryType  type)
+//  {
+//      if (bdlmt::FileTreeUtil::e_REGULAR_FILE == type) {
+//          bdls::FilesystemUtil::Offset size =
+//                                     bdls::FilesystemUtil::getFileSize(path);
+//          if (0 < size) {
+//              total->addRelaxed(size);
+//          }
+//      }
+//  }
+//..
+// Then, we create and start a thread pool for the traversal:
+//..
+//  bdlmt::FixedThreadPool threadPool(4, 1000);
+//  int rc = threadPool.start();
+//  assert(0 == rc);
+//..
+// Next, we traverse the tree rooted at 'logRoot', which (in this example)
+// holds 3 log files of 100 bytes, and other files:
+//..
+//  bsls::AtomicInt64 total(0);
+//
+//  using bdlf::PlaceHolders::_1;
+//  using bdlf::PlaceHolders::_2;
+//
+//  rc = bdlmt::FileTreeUtil::visitTree(
+//                       &threadPool,
+//                       logRoot,
+//                       "*.log",
+//                       bdlf::BindUtil::bind(&addFileSize, &total, _1, _2));
+//  assert(0 == rc);
+//..
+// Finally, we observe the total, and stop the pool:
+//..
+//  assert(300 == total);
+//
+//  threadPool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bsl_functional.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                            // ===================
+                            // struct FileTreeUtil
+                            // ===================
+
+struct FileTreeUtil {
+    // This 'struct' provides a namespace for functions that traverse a
+    // directory tree in parallel.
+
+    // TYPES
+    enum EntryType {
+        // Enumerate the types of the entries passed to a visitor.
+
+        e_REGULAR_FILE,  // a regular file
+        e_DIRECTORY      // a directory
+    };
+
+    typedef bsl::function<void(const char *path, EntryType type)> Visitor;
+        // 'Visitor' is an alias for the type of a function invoked with the
+        // path and the type of each matching entry of a tree.
+
+    // CLASS METHODS
+    static int visitTree(FixedThreadPool    *threadPool,
+                         const bsl::string&  root,
+                         const bsl::string&  pattern,
+                         const Visitor&      visitor);
+        // Traverse the directory tree rooted at the specified 'root', using
+        // the threads of the specified 'threadPool', and invoke the specified
+        // 'visitor' with the full path and the type of each regular file and
+        // directory of the tree (other than 'root') whose leaf name matches
+        // the specified 'pattern'.  'visitor' may be invoked concurrently
+        // from the calling thread and from threads of 'threadPool'.  Return 0
+        // on success, -1 if 'root' is not a directory, -2 if 'pattern'
+        // contains a path separator, and -3 if any directory of the tree
+        // (other than one that is not accessible, or that is removed during
+        // the traversal) could not be read; in the last case, every entry of
+        // the tree that could be read is visited.  The behavior is undefined
+        // if this function is called from a thread of 'threadPool'.  See
+        // {Traversal} and {Concurrency} for details.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,782 @@
+// bdlmt_filetreeutil.t.cpp                                           -*-C++-*-
+#include <bdlmt_filetreeutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <unistd.h>          // 'symlink'
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility that traverses a directory tree using
+// a thread pool.  We create trees of temporary files, and verify that the set
+// of entries visited, and the type reported for each, is the set expected,
+// and (for patterns that 'bdls::FilesystemUtil::visitTree' interprets in the
+// same way) the set of paths that it visits.  We verify the traversal with
+// pools of various sizes, with a pool whose queue is too small to hold every
+// subdirectory, and with a pool that is not started, and we run several
+// traversals concurrently on the same pool.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int visitTree(FixedThreadPool *, root, pattern, visitor);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] TREE TRAVERSAL
+// [ 4] CONCURRENT TRAVERSALS
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::FileTreeUtil                  Util;
+typedef bdls::FilesystemUtil                 FileUtil;
+typedef bsl::pair<bsl::string, bool>         Entry;    // path, is directory
+typedef bsl::vector<Entry>                   Entries;
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+static const char k_SEPARATOR = '\\';
+#else
+static const char k_SEPARATOR = '/';
+#endif
+
+// ============================================================================
+//                          GLOBAL HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempDirectoryName(int test)
+    // Return a name for a temporary directory that is unique to this process
+    // and the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdlmt_filetreeutil." << bdls::ProcessUtil::getProcessId() << "."
+        << test << ".tmp";
+    return oss.str();
+}
+
+static
+bsl::string join(const bsl::string& directory, const bsl::string& leaf)
+    // Return the path of the specified 'leaf' in the specified 'directory'.
+{
+    bsl::string result(directory);
+    bdls::PathUtil::appendRaw(&result, leaf.c_str());
+    return result;
+}
+
+static
+void createFile(const bsl::string& path)
+    // Create an empty file at the specified 'path'.
+{
+    FileUtil::FileDescriptor fd = FileUtil::open(path,
+                                                 FileUtil::e_CREATE,
+                                                 FileUtil::e_READ_WRITE);
+    ASSERTV(path, FileUtil::k_INVALID_FD != fd);
+    FileUtil::close(fd);
+}
+
+static
+void createDirectory(const bsl::string& path)
+    // Create a directory at the specified 'path'.
+{
+    ASSERTV(path, 0 == FileUtil::createDirectories(path, true));
+}
+
+                              // ===============
+                              // class Collector
+                              // ===============
+
+class Collector {
+    // This class collects the entries passed to a visitor, from any number of
+    // threads.
+
+    // DATA
+    bslmt::Mutex d_mutex;
+    Entries      d_entries;
+
+  public:
+    // MANIPULATORS
+    Util::Visitor visitor()
+        // Return a visitor that adds each entry it is passed to this object.
+    {
+        return bdlf::BindUtil::bind(&Collector::add,
+                                    this,
+                                    bdlf::PlaceHolders::_1,
+                                    bdlf::PlaceHolders::_2);
+    }
+
+    void add(const char *path, Util::EntryType type)
+        // Add the specified 'path', of the specified 'type'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_entries.push_back(Entry(path, Util::e_DIRECTORY == type));
+    }
+
+    Entries sorted()
+        // Return the entries collected, in sorted order.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        Entries result(d_entries);
+        bsl::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+static
+void collectPath(bsl::vector<bsl::string> *paths, const char *path)
+    // Append the specified 'path' to the specified 'paths'.
+{
+    paths->push_back(path);
+}
+
+static
+Entries expectedEntries(const bsl::string& root, const bsl::string& pattern)
+    // Return the entries that 'bdls::FilesystemUtil::visitTree' visits under
+    // the specified 'root' for the specified 'pattern', in sorted order.
+{
+    bsl::vector<bsl::string> paths;
+    int rc = FileUtil::visitTree(root,
+                                 pattern,
+                                 bdlf::BindUtil::bind(&collectPath,
+                                                      &paths,
+                                                      bdlf::PlaceHolders::_1));
+    ASSERTV(rc, 0 == rc);
+
+    Entries result;
+    for (bsl::size_t i = 0; i < paths.size(); ++i) {
+        result.push_back(Entry(paths[i], FileUtil::isDirectory(paths[i])));
+    }
+    bsl::sort(result.begin(), result.end());
+    return result;
+}
+
+static
+void createTree(const bsl::string& root, int depth, int width, int numFiles)
+    // Create under the specified 'root' a tree of the specified 'depth', in
+    // which each directory has the specified 'width' subdirectories, named
+    // "d0", "d1", ..., and 'numFiles' files named "f0.log", "f1.txt",
+    // "f2.log", ....
+{
+    createDirectory(root);
+
+    for (int i = 0; i < numFiles; ++i) {
+        bsl::ostringstream oss;
+        oss << "f" << i << (0 == i % 2 ? ".log" : ".txt");
+        createFile(join(root, oss.str()));
+    }
+
+    if (0 < depth) {
+        for (int i = 0; i < width; ++i) {
+            bsl::ostringstream oss;
+            oss << "d" << i;
+            createTree(join(root, oss.str()), depth - 1, width, numFiles);
+        }
+    }
+}
+
+                              // =============
+                              // struct Worker
+                              // =============
+
+struct Worker {
+    // This 'struct' traverses a tree and verifies the entries visited.
+
+    // DATA
+    bdlmt::FixedThreadPool *d_threadPool_p;
+    const bsl::string      *d_root_p;
+    const char             *d_pattern_p;
+    const Entries          *d_expected_p;
+    int                     d_numIterations;
+
+    // MANIPULATORS
+    void operator()()
+        // Traverse the tree 'd_numIterations' times, verifying the entries
+        // visited each time.
+    {
+        for (int i = 0; i < d_numIterations; ++i) {
+            Collector collector;
+            int       rc = Util::visitTree(d_threadPool_p,
+                                           *d_root_p,
+                                           d_pattern_p,
+                                           collector.visitor());
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(d_pattern_p, *d_expected_p == collector.sorted());
+        }
+    }
+};
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void addFileSize(bsls::AtomicInt64              *total,
+                 const char                     *path,
+                 bdlmt::FileTreeUtil::EntryType  type)
+{
+    if (bdlmt::FileTreeUtil::e_REGULAR_FILE == type) {
+        bdls::FilesystemUtil::Offset size =
+                                     bdls::FilesystemUtil::getFileSize(path);
+        if (0 < size) {
+            total->addRelaxed(size);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Traversals allocate from the default allocator.
+
+    bslma::TestAllocator da("default", veryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string logRoot = tempDirectoryName(test);
+        createDirectory(join(logRoot, "a"));
+        createDirectory(join(join(logRoot, "a"), "b"));
+
+        const char *const FILES[] = { "x.log", "a/y.log", "a/b/z.log",
+                                      "a/notes.txt" };
+        for (int i = 0; i < 4; ++i) {
+            bsl::string path(logRoot);
+            path += '/';
+            path += FILES[i];
+
+            FileUtil::FileDescriptor fd = FileUtil::open(
+                                                       path,
+                                                       FileUtil::e_CREATE,
+                                                       FileUtil::e_READ_WRITE);
+            ASSERT(FileUtil::k_INVALID_FD != fd);
+            const bsl::string data(100, 'x');
+            ASSERT(100 == FileUtil::write(fd, data.data(), 100));
+            FileUtil::close(fd);
+        }
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Size of a Log Directory Tree
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an application writes log files, named with the suffix
+// ".log", in a tree of directories, and that we want the total size of these
+// files.
+//
+// First, we define a visitor that adds the size of each regular file that it
+// visits to an atomic total (see 'addFileSize' above).
+//
+// Then, we create and start a thread pool for the traversal:
+//..
+    bdlmt::FixedThreadPool threadPool(4, 1000);
+    int rc = threadPool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we traverse the tree rooted at 'logRoot', which (in this example)
+// holds 3 log files of 100 bytes, and other files:
+//..
+    bsls::AtomicInt64 total(0);
+
+    using bdlf::PlaceHolders::_1;
+    using bdlf::PlaceHolders::_2;
+
+    rc = bdlmt::FileTreeUtil::visitTree(
+                         &threadPool,
+                         logRoot,
+                         "*.log",
+                         bdlf::BindUtil::bind(&addFileSize, &total, _1, _2));
+    ASSERT(0 == rc);
+//..
+// Finally, we observe the total, and stop the pool:
+//..
+    ASSERT(300 == total);
+
+    threadPool.stop();
+//..
+
+        FileUtil::remove(logRoot, true);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT TRAVERSALS
+        //
+        // Concerns:
+        //: 1 Several traversals may use the same pool concurrently, and each
+        //:   visits exactly the entries of its own pattern.
+        //
+        // Plan:
+        //: 1 Create a tree, and have several threads traverse it repeatedly
+        //:   with different patterns, using one pool, verifying the entries
+        //:   visited by each traversal.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT TRAVERSALS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT TRAVERSALS" << endl
+                                  << "=====================" << endl;
+
+        const bsl::string root = tempDirectoryName(test);
+        createTree(root, 3, 4, 10);
+
+        const char *const PATTERNS[] = { "*", "*.log", "d?", "f1*" };
+        enum { k_NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS };
+
+        Entries expected[k_NUM_PATTERNS];
+        for (int i = 0; i < k_NUM_PATTERNS; ++i) {
+            expected[i] = expectedEntries(root, PATTERNS[i]);
+        }
+        ASSERTV(expected[0].size(), (1 + 4 + 16 + 64) * 10 + 4 + 16 + 64 ==
+                                                          expected[0].size());
+
+        bdlmt::FixedThreadPool threadPool(4, 16);
+        ASSERT(0 == threadPool.start());
+
+        bslmt::ThreadGroup threads;
+        for (int i = 0; i < 2 * k_NUM_PATTERNS; ++i) {
+            Worker worker = { &threadPool,
+                              &root,
+                              PATTERNS[i % k_NUM_PATTERNS],
+                              &expected[i % k_NUM_PATTERNS],
+                              10 };
+            ASSERT(0 == threads.addThread(worker));
+        }
+        threads.joinAll();
+
+        threadPool.stop();
+
+        FileUtil::remove(root, true);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TREE TRAVERSAL
+        //
+        // Concerns:
+        //: 1 Every directory of the tree is traversed, and every matching
+        //:   regular file and directory is visited exactly once, with its
+        //:   type.
+        //:
+        //: 2 The entries visited are those visited by
+        //:   'bdls::FilesystemUtil::visitTree' for the same pattern.
+        //:
+        //: 3 The traversal is complete regardless of the number of threads of
+        //:   the pool, whether the queue of the pool can hold every
+        //:   subdirectory, and whether the pool is started.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create a tree, and, for pools having 1 and 4 threads and queues
+        //:   of various capacities (started and not started), traverse it for
+        //:   several patterns, and compare the entries visited with those
+        //:   visited by 'bdls::FilesystemUtil::visitTree'.  (C-1..4)
+        //
+        // Testing:
+        //   TREE TRAVERSAL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TREE TRAVERSAL" << endl
+                                  << "==============" << endl;
+
+        const bsl::string root = tempDirectoryName(test);
+        createTree(root, 3, 3, 5);
+
+        const char *const PATTERNS[] = { "*", "*.log", "d*", "d1", "f?.txt",
+                                         "nothing" };
+        enum { k_NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS };
+
+        static const struct {
+            int  d_line;
+            int  d_numThreads;
+            int  d_queueCapacity;
+            bool d_start;
+        } DATA[] = {
+            //LINE  THREADS  CAPACITY  START
+            //----  -------  --------  -----
+            { L_,         1,        1,  true },
+            { L_,         1,      100,  true },
+            { L_,         4,        1,  true },
+            { L_,         4,        2,  true },
+            { L_,         4,      100,  true },
+            { L_,         4,      100, false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int pi = 0; pi < k_NUM_PATTERNS; ++pi) {
+            const char *const PATTERN  = PATTERNS[pi];
+            const Entries     EXPECTED = expectedEntries(root, PATTERN);
+
+            if (veryVerbose) { T_ P_(PATTERN) P(EXPECTED.size()) }
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE     = DATA[ti].d_line;
+                const int  THREADS  = DATA[ti].d_numThreads;
+                const int  CAPACITY = DATA[ti].d_queueCapacity;
+                const bool START    = DATA[ti].d_start;
+
+                bslma::TestAllocator   pa("pool", veryVerbose);
+                bdlmt::FixedThreadPool threadPool(THREADS, CAPACITY, &pa);
+                if (START) {
+                    ASSERT(0 == threadPool.start());
+                }
+
+                const bsls::Types::Int64 numBlocks = da.numBlocksInUse();
+                {
+                    Collector collector;
+                    int       rc = Util::visitTree(&threadPool,
+                                                   root,
+                                                   PATTERN,
+                                                   collector.visitor());
+                    ASSERTV(LINE, PATTERN, rc, 0 == rc);
+                    ASSERTV(LINE, PATTERN, EXPECTED == collector.sorted());
+                }
+
+                threadPool.stop();
+                ASSERTV(LINE, numBlocks == da.numBlocksInUse());
+            }
+        }
+
+        FileUtil::remove(root, true);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'visitTree'
+        //
+        // Concerns:
+        //: 1 '*' matches any sequence of characters, '?' matches any one
+        //:   character, and other characters match only themselves.
+        //:
+        //: 2 '.' and '..' are never visited, and (on POSIX platforms) a name
+        //:   beginning with '.' is matched only by a pattern beginning with
+        //:   '.'.
+        //:
+        //: 3 Regular files and directories are visited with their types, and
+        //:   symbolic links are neither visited nor followed.
+        //:
+        //: 4 The root is not visited, and may be specified with or without a
+        //:   trailing separator.
+        //:
+        //: 5 A root that is not a directory, or a pattern containing a
+        //:   separator, is reported as an error.
+        //
+        // Plan:
+        //: 1 Create a directory holding files, a subdirectory and (on POSIX
+        //:   platforms) symbolic links, and, for a table of patterns, verify
+        //:   the entries visited.  (C-1..4)
+        //:
+        //: 2 Call 'visitTree' with a root that does not exist, a root that is
+        //:   a file, and a pattern containing a separator, and verify the
+        //:   status.  (C-5)
+        //
+        // Testing:
+        //   int visitTree(FixedThreadPool *, root, pattern, visitor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'visitTree'" << endl
+                                  << "===========" << endl;
+
+        const bsl::string root = tempDirectoryName(test);
+        createDirectory(root);
+        createFile(join(root, "a.log"));
+        createFile(join(root, "ab.log"));
+        createFile(join(root, "a.txt"));
+        createFile(join(root, ".hidden.log"));
+        createFile(join(root, "\xc3\xa9.log"));              // e-acute
+        createDirectory(join(root, "sub.log"));
+        createFile(join(join(root, "sub.log"), "c.log"));
+        createDirectory(join(root, "target"));
+        createFile(join(join(root, "target"), "t.log"));
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+        ASSERT(0 == ::symlink("a.log", join(root, "link.log").c_str()));
+        ASSERT(0 == ::symlink("target", join(root, "dirlink").c_str()));
+#endif
+
+        static const struct {
+            int         d_line;
+            const char *d_pattern_p;
+            const char *d_expected_p;   // leaves visited, in order; a
+                                        // trailing '/' marks a directory
+        } DATA[] = {
+            //LINE  PATTERN         EXPECTED
+            //----  -------------   ---------------------------------------
+            { L_,   "*",            "a.log a.txt ab.log sub.log/ "
+                                    "sub.log/c.log target/ target/t.log "
+                                    "\xc3\xa9.log" },
+            { L_,   "*.log",        "a.log ab.log sub.log/ sub.log/c.log "
+                                    "target/t.log \xc3\xa9.log" },
+            { L_,   "?.log",        "a.log sub.log/c.log target/t.log "
+                                    "\xc3\xa9.log" },
+            { L_,   "??.log",       "ab.log" },
+            { L_,   "a*",           "a.log a.txt ab.log" },
+            { L_,   "*.*",          "a.log a.txt ab.log sub.log/ "
+                                    "sub.log/c.log target/t.log "
+                                    "\xc3\xa9.log" },
+            { L_,   "a.log",        "a.log" },
+            { L_,   "a*b*",         "ab.log" },
+            { L_,   "*t*",          "a.txt target/ target/t.log" },
+            { L_,   "**g",          "a.log ab.log sub.log/ sub.log/c.log "
+                                    "target/t.log \xc3\xa9.log" },
+            { L_,   "target",       "target/" },
+            { L_,   "x*",           "" },
+            { L_,   "",             "" },
+            { L_,   ".",            "" },
+            { L_,   "..",           "" },
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+            { L_,   ".*",           ".hidden.log" },
+            { L_,   ".h*",          ".hidden.log" },
+#endif
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bdlmt::FixedThreadPool threadPool(2, 10);
+        ASSERT(0 == threadPool.start());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const PATTERN = DATA[ti].d_pattern_p;
+
+            Entries expected;
+            {
+                bsl::istringstream iss(DATA[ti].d_expected_p);
+                bsl::string        leaf;
+                while (iss >> leaf) {
+                    const bool isDirectory = '/' == leaf[leaf.length() - 1];
+                    if (isDirectory) {
+                        leaf.resize(leaf.length() - 1);
+                    }
+                    bsl::replace(leaf.begin(), leaf.end(), '/', k_SEPARATOR);
+                    expected.push_back(Entry(root + k_SEPARATOR + leaf,
+                                             isDirectory));
+                }
+                bsl::sort(expected.begin(), expected.end());
+            }
+
+            for (int si = 0; si < 2; ++si) {
+                const bsl::string ROOT = si ? root + k_SEPARATOR : root;
+
+                if (veryVerbose) { T_ P_(LINE) P_(PATTERN) P(ROOT) }
+
+                Collector collector;
+                int       rc = Util::visitTree(&threadPool,
+                                               ROOT,
+                                               PATTERN,
+                                               collector.visitor());
+                ASSERTV(LINE, rc, 0 == rc);
+
+                const Entries actual = collector.sorted();
+                ASSERTV(LINE, PATTERN, actual.size(), expected.size(),
+                        expected == actual);
+                if (veryVerbose || expected != actual) {
+                    for (bsl::size_t i = 0; i < actual.size(); ++i) {
+                        T_ T_ P_(actual[i].first) P(actual[i].second)
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tErrors." << endl;
+        {
+            Collector collector;
+
+            ASSERT(-1 == Util::visitTree(&threadPool,
+                                         join(root, "missing"),
+                                         "*",
+                                         collector.visitor()));
+            ASSERT(-1 == Util::visitTree(&threadPool,
+                                         join(root, "a.log"),
+                                         "*",
+                                         collector.visitor()));
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+            ASSERT(-1 == Util::visitTree(&threadPool,
+                                         join(root, "dirlink"),
+                                         "*",
+                                         collector.visitor()));
+            ASSERT(-2 == Util::visitTree(&threadPool,
+                                         root,
+                                         "sub.log/*",
+                                         collector.visitor()));
+#else
+            ASSERT(-2 == Util::visitTree(&threadPool,
+                                         root,
+                                         "sub.log\\*",
+                                         collector.visitor()));
+#endif
+            ASSERT(collector.sorted().empty());
+        }
+
+        threadPool.stop();
+
+        FileUtil::remove(root, true);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The function is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a small tree, traverse it, and verify the entries
+        //:   visited.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        const bsl::string root = tempDirectoryName(test);
+        createTree(root, 1, 2, 2);
+
+        bdlmt::FixedThreadPool threadPool(2, 10);
+        ASSERT(0 == threadPool.start());
+
+        Collector collector;
+        ASSERT(0 == Util::visitTree(&threadPool,
+                                    root,
+                                    "*",
+                                    collector.visitor()));
+
+        const Entries entries = collector.sorted();
+        ASSERTV(entries.size(), 8 == entries.size());
+        ASSERT(Entry(join(root, "d0"), true)                   == entries[0]);
+        ASSERT(Entry(join(join(root, "d0"), "f0.log"), false) == entries[1]);
+        ASSERT(Entry(join(root, "f1.txt"), false)              == entries[7]);
+
+        threadPool.stop();
+
+        FileUtil::remove(root, true);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
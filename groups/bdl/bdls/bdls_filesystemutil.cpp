@@ -2032,6 +2032,18 @@ int FilesystemUtil::visitTree(
                 continue;
             }
 
+#if defined(DT_UNKNOWN) && defined(DT_DIR)
+            // Where the file system reports the type of the entry, use it to
+            // avoid a 'stat' of every entry of the directory.
+
+            if (DT_UNKNOWN != entry.d_type) {
+                if (DT_DIR == entry.d_type) {
+                    nameRecs.push_back(NameRec(basename, false));
+                }
+                continue;
+            }
+#endif
+
             fullFn.resize(truncTo);
             fullFn += basename;
 
@@ -0,0 +1,269 @@
+// bdls_mappedrecordfile.cpp                                          -*-C++-*-
+#include <bdls_mappedrecordfile.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_mappedrecordfile_cpp,"$Id$ $CSID$")
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+namespace {
+
+typedef MappedRecordFile::FileHeader     FileHeader;
+typedef MappedRecordFile::DirectoryEntry DirectoryEntry;
+
+const int k_ALIGNMENT = 4;  // alignment of each record in a file
+
+int validate(const char  *data,
+             bsl::size_t  size,
+             const char  *magic,
+             int          version,
+             bsl::size_t  recordHeaderSize)
+    // Return 0 if the file of the specified 'size' at the specified 'data'
+    // address has a valid header and directory (see {File Format}) for the
+    // specified 'magic', 'version', and 'recordHeaderSize', and a non-zero
+    // value otherwise.
+{
+    if (size < sizeof(FileHeader)) {
+        return 1;                                                     // RETURN
+    }
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(data);
+
+    if (0 != bsl::memcmp(header->d_magic,
+                         magic,
+                         MappedRecordFile::k_MAGIC_LENGTH)) {
+        return 2;                                                     // RETURN
+    }
+
+    if (version != header->d_version) {
+        return 3;                                                     // RETURN
+    }
+
+    if (static_cast<int>(size) != header->d_fileSize) {
+        return 4;                                                     // RETURN
+    }
+
+    const int numRecords = header->d_numRecords;
+    if (numRecords < 0
+     || static_cast<bsls::Types::Int64>(numRecords) * sizeof(DirectoryEntry)
+                                      > size - sizeof(FileHeader)) {
+        return 5;                                                     // RETURN
+    }
+
+    const DirectoryEntry *directory =
+                         reinterpret_cast<const DirectoryEntry *>(header + 1);
+    const int             namesOffset = static_cast<int>(
+                     sizeof(FileHeader) + numRecords * sizeof(DirectoryEntry));
+    const char           *previousName = 0;
+
+    for (int i = 0; i < numRecords; ++i) {
+        const int nameOffset   = directory[i].d_nameOffset;
+        const int recordOffset = directory[i].d_recordOffset;
+
+        if (nameOffset < namesOffset
+         || nameOffset >= static_cast<int>(size)
+         || 0 == bsl::memchr(data + nameOffset, '\0', size - nameOffset)) {
+            return 6;                                                 // RETURN
+        }
+
+        if (recordOffset < namesOffset
+         || recordOffset > static_cast<int>(size)
+         || 0 != recordOffset % k_ALIGNMENT
+         || recordHeaderSize > size - recordOffset) {
+            return 7;                                                 // RETURN
+        }
+
+        // The directory is searched by bisection, so the names must be
+        // strictly increasing.
+
+        const char *name = data + nameOffset;
+        if (previousName && bsl::strcmp(previousName, name) >= 0) {
+            return 8;                                                 // RETURN
+        }
+        previousName = name;
+    }
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class MappedRecordFile
+                           // ----------------------
+
+// CLASS METHODS
+void MappedRecordFile::writeHeader(bsl::ostream&  stream,
+                                   const char    *magic,
+                                   int            version,
+                                   int            numRecords,
+                                   int            fileSize)
+{
+    BSLS_ASSERT(magic);
+
+    stream.write(magic, k_MAGIC_LENGTH);
+    writeInt(stream, version);
+    writeInt(stream, numRecords);
+    writeInt(stream, fileSize);
+}
+
+void MappedRecordFile::writeInt(bsl::ostream& stream, int value)
+{
+    const bdlb::BigEndianInt32 data = bdlb::BigEndianInt32::make(value);
+    stream.write(reinterpret_cast<const char *>(&data), sizeof data);
+}
+
+// CREATORS
+MappedRecordFile::MappedRecordFile()
+: d_data_p(0)
+, d_size(0)
+, d_numRecords(0)
+{
+}
+
+MappedRecordFile::~MappedRecordFile()
+{
+    unmap();
+}
+
+// MANIPULATORS
+int MappedRecordFile::map(const char  *path,
+                          const char  *magic,
+                          int          version,
+                          bsl::size_t  recordHeaderSize)
+{
+    BSLS_ASSERT(path);
+    BSLS_ASSERT(magic);
+
+    typedef FilesystemUtil Util;
+
+    Util::FileDescriptor fd = Util::open(path,
+                                         Util::e_OPEN,
+                                         Util::e_READ_ONLY);
+    if (Util::k_INVALID_FD == fd) {
+        return 1;                                                     // RETURN
+    }
+
+    const Util::Offset fileSize = Util::getFileSize(fd);
+    if (fileSize < static_cast<Util::Offset>(sizeof(FileHeader))
+     || fileSize > INT_MAX) {
+        Util::close(fd);
+        return 2;                                                     // RETURN
+    }
+
+    const bsl::size_t size    = static_cast<bsl::size_t>(fileSize);
+    void             *address = 0;
+
+    const int rc = Util::map(fd,
+                             &address,
+                             0,
+                             size,
+                             MemoryUtil::k_ACCESS_READ);
+
+    // The mapping remains valid after the descriptor is closed.
+
+    Util::close(fd);
+
+    if (0 != rc) {
+        return 3;                                                     // RETURN
+    }
+
+    const char *data = static_cast<const char *>(address);
+
+    if (0 != validate(data, size, magic, version, recordHeaderSize)) {
+        Util::unmap(address, size);
+        return 4;                                                     // RETURN
+    }
+
+    unmap();
+
+    d_data_p     = data;
+    d_size       = size;
+    d_numRecords = reinterpret_cast<const FileHeader *>(data)->d_numRecords;
+
+    return 0;
+}
+
+void MappedRecordFile::unmap()
+{
+    if (d_data_p) {
+        FilesystemUtil::unmap(const_cast<char *>(d_data_p), d_size);
+
+        d_data_p     = 0;
+        d_size       = 0;
+        d_numRecords = 0;
+    }
+}
+
+// ACCESSORS
+int MappedRecordFile::findRecord(const char *name) const
+{
+    BSLS_ASSERT(name);
+
+    if (!d_data_p) {
+        return -1;                                                    // RETURN
+    }
+
+    const DirectoryEntry *directory = reinterpret_cast<const DirectoryEntry *>(
+                                                         d_data_p
+                                                       + sizeof(FileHeader));
+
+    int low  = 0;
+    int high = d_numRecords;
+    while (low < high) {
+        const int mid = low + (high - low) / 2;
+        if (bsl::strcmp(d_data_p + directory[mid].d_nameOffset, name) < 0) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    if (low == d_numRecords
+     || 0 != bsl::strcmp(d_data_p + directory[low].d_nameOffset, name)) {
+        return -1;                                                    // RETURN
+    }
+
+    return directory[low].d_recordOffset;
+}
+
+const char *MappedRecordFile::findString(int offset) const
+{
+    if (offset < static_cast<int>(sizeof(FileHeader))
+     || offset >= static_cast<int>(d_size)
+     || 0 == bsl::memchr(d_data_p + offset, '\0', d_size - offset)) {
+        return 0;                                                     // RETURN
+    }
+    return d_data_p + offset;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
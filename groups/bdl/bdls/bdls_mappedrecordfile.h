@@ -0,0 +1,280 @@
+// bdls_mappedrecordfile.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLS_MAPPEDRECORDFILE
+#define INCLUDED_BDLS_MAPPEDRECORDFILE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a read-only mapping of a file of named binary records.
+//
+//@CLASSES:
+//  bdls::MappedRecordFile: owner of a validated read-only file mapping
+//
+//@SEE_ALSO: bdls_filesystemutil, bdlb_bigendian
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdls::MappedRecordFile', that maps a file of named binary records
+// read-only into the address space of the process, validates its header and
+// directory, and finds a record by name without reading or parsing the rest
+// of the file.  The format of each record is defined by the client; this
+// component provides only the layout shared by all such files, and the
+// functions to write it.
+//
+///File Format
+///-----------
+// All integer fields are 32-bit signed values stored in network (big-endian)
+// byte order, and all offsets are from the start of the file.  A file
+// consists of a header, a directory of record names sorted in strictly
+// increasing order (as by 'bsl::strcmp'), a table of null-terminated names,
+// and the records:
+//..
+//  header:     magic (4 bytes) | version | numRecords | fileSize
+//  directory:  numRecords * { nameOffset | recordOffset }
+//  names:      null-terminated record names
+//  records:    client-defined records, each starting on a 4-byte boundary
+//..
+// A file is valid (see 'map') if it has the expected magic number and
+// version, its size is 'fileSize', each name is null-terminated within the
+// file and is at or after the end of the directory, and each record starts
+// at or after the end of the directory on a 4-byte boundary with at least the
+// number of bytes of a record header (as supplied by the client) before the
+// end of the file.  Any other field of a record must be validated by the
+// client when the record is decoded.
+//
+///Thread Safety
+///-------------
+// 'bdls::MappedRecordFile' is *const* *thread-safe*: its accessors may be
+// called concurrently, but not concurrently with 'map' or 'unmap'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Mapping a File of Records
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a single integer under each of a set of
+// names, so that a process can look up a name without reading the file.
+//
+// First, we write the header, the directory, the names, and the records
+// (each being a single integer) to a file named by 'fileName':
+//..
+//  typedef bdls::MappedRecordFile Obj;
+//
+//  const char k_MAGIC[4] = { 'D', 'E', 'M', 'O' };
+//
+//  const int namesOffset   = sizeof(Obj::FileHeader)
+//                          + 2 * sizeof(Obj::DirectoryEntry);
+//  const int recordsOffset = namesOffset + 8;  // "ABC\0EFG\0"
+//  const int fileSize      = recordsOffset + 2 * 4;
+//
+//  bsl::ofstream output(fileName, bsl::ios::binary);
+//  Obj::writeHeader(output, k_MAGIC, 1, 2, fileSize);
+//
+//  Obj::writeInt(output, namesOffset);
+//  Obj::writeInt(output, recordsOffset);
+//  Obj::writeInt(output, namesOffset + 4);
+//  Obj::writeInt(output, recordsOffset + 4);
+//
+//  output.write("ABC\0EFG\0", 8);
+//
+//  Obj::writeInt(output, 17);
+//  Obj::writeInt(output, 42);
+//  output.close();
+//..
+// Then, we map the file, supplying the magic number and version we expect
+// and the size of a record header:
+//..
+//  Obj mappedFile;
+//
+//  int rc = mappedFile.map(fileName, k_MAGIC, 1, 4);
+//  assert(0 == rc);
+//  assert(2 == mappedFile.numRecords());
+//..
+// Finally, we find a record by name, and decode it:
+//..
+//  const int offset = mappedFile.findRecord("EFG");
+//  assert(0 < offset);
+//
+//  const bdlb::BigEndianInt32 *record =
+//         reinterpret_cast<const bdlb::BigEndianInt32 *>(mappedFile.data() +
+//                                                        offset);
+//  assert(42 == *record);
+//
+//  assert(-1 == mappedFile.findRecord("XYZ"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bigendian.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+                           // ======================
+                           // class MappedRecordFile
+                           // ======================
+
+class MappedRecordFile {
+    // This mechanism maps, read-only, a file of named records having the
+    // layout described in {File Format}, and unmaps it on destruction.
+
+  public:
+    // TYPES
+    enum { k_MAGIC_LENGTH = 4 };  // number of bytes of the magic number
+
+    struct FileHeader {
+        // This 'struct' overlays the header of a file.
+
+        char                 d_magic[k_MAGIC_LENGTH];
+        bdlb::BigEndianInt32 d_version;
+        bdlb::BigEndianInt32 d_numRecords;
+        bdlb::BigEndianInt32 d_fileSize;
+    };
+
+    struct DirectoryEntry {
+        // This 'struct' overlays one entry in the directory of a file.
+
+        bdlb::BigEndianInt32 d_nameOffset;
+        bdlb::BigEndianInt32 d_recordOffset;
+    };
+
+  private:
+    // DATA
+    const char  *d_data_p;      // address of the mapped file, or 0 if none
+                                // is mapped
+
+    bsl::size_t  d_size;        // size of the mapped file in bytes
+
+    int          d_numRecords;  // number of records in the mapped file
+
+  private:
+    // NOT IMPLEMENTED
+    MappedRecordFile(const MappedRecordFile&);
+    MappedRecordFile& operator=(const MappedRecordFile&);
+
+  public:
+    // CLASS METHODS
+    static void writeHeader(bsl::ostream&  stream,
+                            const char    *magic,
+                            int            version,
+                            int            numRecords,
+                            int            fileSize);
+        // Write, to the specified 'stream', a file header having the
+        // 'k_MAGIC_LENGTH' bytes at the specified 'magic' address, and the
+        // specified 'version', 'numRecords', and 'fileSize'.  The behavior is
+        // undefined unless 'magic' has at least 'k_MAGIC_LENGTH' bytes.
+
+    static void writeInt(bsl::ostream& stream, int value);
+        // Write the specified 'value' to the specified 'stream' in network
+        // byte order.
+
+    // CREATORS
+    MappedRecordFile();
+        // Create an object that has no file mapped.
+
+    ~MappedRecordFile();
+        // Unmap the file, if any, and destroy this object.
+
+    // MANIPULATORS
+    int map(const char  *path,
+            const char  *magic,
+            int          version,
+            bsl::size_t  recordHeaderSize);
+        // Map, read-only, the file at the specified 'path', and validate its
+        // header and directory (see {File Format}) against the
+        // 'k_MAGIC_LENGTH' bytes at the specified 'magic' address, the
+        // specified 'version', and the specified 'recordHeaderSize', the
+        // minimum size of a record.  Return 0 on success, and a non-zero
+        // value (with no effect on the state of this object) otherwise: 1 if
+        // the file cannot be opened, 2 if its size is not valid, 3 if it
+        // cannot be mapped, and 4 if it is not valid.  On success, any file
+        // previously mapped by this object is unmapped.  The behavior is
+        // undefined unless 'magic' has at least 'k_MAGIC_LENGTH' bytes.
+
+    void unmap();
+        // Unmap the file, if any, mapped by this object.
+
+    // ACCESSORS
+    const char *data() const;
+        // Return the address of the mapped file, or 0 if no file is mapped.
+
+    int findRecord(const char *name) const;
+        // Return the offset of the record having the specified 'name' in the
+        // mapped file, or -1 if no file is mapped or the file has no such
+        // record.  Note that the directory is searched by bisection.
+
+    const char *findString(int offset) const;
+        // Return the address of the null-terminated string at the specified
+        // 'offset' in the mapped file, or 0 if no file is mapped, or if
+        // 'offset' is within the header or does not refer to a string that is
+        // terminated within the file.
+
+    bool isMapped() const;
+        // Return 'true' if this object has a file mapped, and 'false'
+        // otherwise.
+
+    int numRecords() const;
+        // Return the number of records in the mapped file, or 0 if no file is
+        // mapped.
+
+    bsl::size_t size() const;
+        // Return the size, in bytes, of the mapped file, or 0 if no file is
+        // mapped.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class MappedRecordFile
+                           // ----------------------
+
+// ACCESSORS
+inline
+const char *MappedRecordFile::data() const
+{
+    return d_data_p;
+}
+
+inline
+bool MappedRecordFile::isMapped() const
+{
+    return 0 != d_data_p;
+}
+
+inline
+int MappedRecordFile::numRecords() const
+{
+    return d_numRecords;
+}
+
+inline
+bsl::size_t MappedRecordFile::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,734 @@
+// bdls_mappedrecordfile.t.cpp                                        -*-C++-*-
+#include <bdls_mappedrecordfile.h>
+
+#include <bdlb_bigendian.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism that maps a file of named records
+// and validates its header and directory.  We test that the writing class
+// methods produce the documented layout, that a valid file is mapped and its
+// records found by name, that each kind of corrupt header or directory is
+// rejected without affecting a previously mapped file, and that strings are
+// found only when they are terminated within the file.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] void writeHeader(ostream&, const char *, int, int, int);
+// [ 1] void writeInt(bsl::ostream& stream, int value);
+//
+// CREATORS
+// [ 2] MappedRecordFile();
+// [ 2] ~MappedRecordFile();
+//
+// MANIPULATORS
+// [ 2] int map(const char *, const char *, int, bsl::size_t);
+// [ 2] void unmap();
+//
+// ACCESSORS
+// [ 2] const char *data() const;
+// [ 2] bool isMapped() const;
+// [ 2] int numRecords() const;
+// [ 2] bsl::size_t size() const;
+// [ 3] int findRecord(const char *name) const;
+// [ 3] const char *findString(int offset) const;
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::MappedRecordFile Obj;
+
+const char k_MAGIC[4] = { 'T', 'E', 'S', 'T' };
+const int  k_VERSION  = 3;
+
+const int  k_RECORD_HEADER_SIZE = 8;  // size of each record of 'goodFile'
+
+// ============================================================================
+//                           TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+bsl::string tempFileName(int test)
+    // Return a name for a temporary file that is unique to this process and
+    // the specified 'test' case.
+{
+    bsl::ostringstream oss;
+    oss << "bdls_mappedrecordfile." << bdls::ProcessUtil::getProcessId()
+        << "." << test << ".tmp";
+    return oss.str();
+}
+
+static
+void writeFile(const bsl::string& fileName, const bsl::string& contents)
+    // Write the specified 'contents' to the file having the specified
+    // 'fileName', replacing any existing file.
+{
+    bsl::ofstream output(fileName.c_str(), bsl::ios::binary);
+    output.write(contents.data(), contents.size());
+}
+
+static
+int getInt(const bsl::string& contents, bsl::size_t position)
+    // Return the big-endian 32-bit integer at the specified 'position' in the
+    // specified 'contents'.
+{
+    unsigned int value = 0;
+    for (bsl::size_t i = 0; i < 4; ++i) {
+        value = (value << 8)
+              | static_cast<unsigned char>(contents[position + i]);
+    }
+    return static_cast<int>(value);
+}
+
+static
+void setInt(bsl::string *contents, bsl::size_t position, int value)
+    // Replace the big-endian 32-bit integer at the specified 'position' in the
+    // specified 'contents' with the specified 'value'.
+{
+    const unsigned int bits = static_cast<unsigned int>(value);
+    for (bsl::size_t i = 0; i < 4; ++i) {
+        (*contents)[position + i] = static_cast<char>(bits >> (24 - 8 * i));
+    }
+}
+
+static
+bsl::string goodFile()
+    // Return the contents of a valid file having three records, named "A",
+    // "BB", and "C", each of 'k_RECORD_HEADER_SIZE' bytes holding the index
+    // of the record followed by 10 times that index.  The names start at
+    // offset 40, and the records at offsets 48, 56, and 64.
+{
+    bsl::ostringstream oss;
+
+    Obj::writeHeader(oss, k_MAGIC, k_VERSION, 3, 72);
+
+    Obj::writeInt(oss, 40);  Obj::writeInt(oss, 48);
+    Obj::writeInt(oss, 42);  Obj::writeInt(oss, 56);
+    Obj::writeInt(oss, 45);  Obj::writeInt(oss, 64);
+
+    oss.write("A\0BB\0C\0", 7);
+    oss.put('\0');
+
+    for (int i = 0; i < 3; ++i) {
+        Obj::writeInt(oss, i);
+        Obj::writeInt(oss, 10 * i);
+    }
+
+    return oss.str();
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        const bsl::string  fileNameString = tempFileName(test);
+        const char        *fileName       = fileNameString.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Mapping a File of Records
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store a single integer under each of a set of
+// names, so that a process can look up a name without reading the file.
+//
+// First, we write the header, the directory, the names, and the records
+// (each being a single integer) to a file named by 'fileName':
+//..
+    typedef bdls::MappedRecordFile Obj;
+
+    const char k_MAGIC[4] = { 'D', 'E', 'M', 'O' };
+
+    const int namesOffset   = sizeof(Obj::FileHeader)
+                            + 2 * sizeof(Obj::DirectoryEntry);
+    const int recordsOffset = namesOffset + 8;  // "ABC\0EFG\0"
+    const int fileSize      = recordsOffset + 2 * 4;
+
+    bsl::ofstream output(fileName, bsl::ios::binary);
+    Obj::writeHeader(output, k_MAGIC, 1, 2, fileSize);
+
+    Obj::writeInt(output, namesOffset);
+    Obj::writeInt(output, recordsOffset);
+    Obj::writeInt(output, namesOffset + 4);
+    Obj::writeInt(output, recordsOffset + 4);
+
+    output.write("ABC\0EFG\0", 8);
+
+    Obj::writeInt(output, 17);
+    Obj::writeInt(output, 42);
+    output.close();
+//..
+// Then, we map the file, supplying the magic number and version we expect
+// and the size of a record header:
+//..
+    Obj mappedFile;
+
+    int rc = mappedFile.map(fileName, k_MAGIC, 1, 4);
+    ASSERT(0 == rc);
+    ASSERT(2 == mappedFile.numRecords());
+//..
+// Finally, we find a record by name, and decode it:
+//..
+    const int offset = mappedFile.findRecord("EFG");
+    ASSERT(0 < offset);
+
+    const bdlb::BigEndianInt32 *record =
+           reinterpret_cast<const bdlb::BigEndianInt32 *>(mappedFile.data() +
+                                                          offset);
+    ASSERT(42 == *record);
+
+    ASSERT(-1 == mappedFile.findRecord("XYZ"));
+//..
+
+        mappedFile.unmap();
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'findRecord' AND 'findString'
+        //
+        // Concerns:
+        //: 1 'findRecord' returns the offset of the record having the
+        //:   supplied name, for each record, and -1 for any other name
+        //:   (including names that sort before, between, and after those of
+        //:   the file, and prefixes and extensions of them).
+        //:
+        //: 2 'findString' returns the address of a string that is terminated
+        //:   within the file, and 0 for an offset within the header, at or
+        //:   past the end of the file, or of an unterminated string.
+        //:
+        //: 3 Both return "not found" if no file is mapped.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Map a valid file and, using the table-driven technique, verify
+        //:   'findRecord' for a set of names.  (C-1)
+        //:
+        //: 2 Verify 'findString' for a set of offsets, in a file whose last
+        //:   byte is not 0.  (C-2)
+        //:
+        //: 3 Verify both on an object having no file mapped.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   int findRecord(const char *name) const;
+        //   const char *findString(int offset) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findRecord' AND 'findString'" << endl
+                          << "=====================================" << endl;
+
+        const bsl::string fileName = tempFileName(test);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(-1 == X.findRecord("A"));
+            ASSERT( 0 == X.findString(40));
+
+            writeFile(fileName, goodFile());
+            ASSERT(0 == mX.map(fileName.c_str(),
+                               k_MAGIC,
+                               k_VERSION,
+                               k_RECORD_HEADER_SIZE));
+
+            static const struct {
+                int         d_line;
+                const char *d_name;
+                int         d_offset;
+            } DATA[] = {
+                //LINE  NAME   OFFSET
+                //----  ----   ------
+                { L_,   "A",       48 },
+                { L_,   "BB",      56 },
+                { L_,   "C",       64 },
+                { L_,   "",        -1 },
+                { L_,   "0",       -1 },
+                { L_,   "AA",      -1 },
+                { L_,   "B",       -1 },
+                { L_,   "BBB",     -1 },
+                { L_,   "BC",      -1 },
+                { L_,   "D",       -1 },
+                { L_,   "a",       -1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *NAME   = DATA[ti].d_name;
+                const int   OFFSET = DATA[ti].d_offset;
+
+                if (veryVerbose) { T_ P_(LINE) P_(NAME) P(OFFSET) }
+
+                ASSERTV(LINE, NAME, OFFSET == X.findRecord(NAME));
+            }
+
+            ASSERT(0 == bsl::strcmp("A",  X.findString(40)));
+            ASSERT(0 == bsl::strcmp("BB", X.findString(42)));
+            ASSERT(0 == bsl::strcmp("B",  X.findString(43)));
+            ASSERT(0 == bsl::strcmp("",   X.findString(44)));
+            ASSERT(0 == bsl::strcmp("",   X.findString(47)));
+            ASSERT(0 == bsl::strcmp("",   X.findString(70)));
+            ASSERT(0 == X.findString(-1));
+            ASSERT(0 == X.findString(0));
+            ASSERT(0 == X.findString(15));
+            ASSERT(X.data() + 16 == X.findString(16));  // empty
+            ASSERT(0 == X.findString(71));  // unterminated
+            ASSERT(0 == X.findString(72));
+            ASSERT(0 == X.findString(0x7FFFFFFF));
+
+            // A string that is not terminated within the file is not found.
+
+            bsl::string contents = goodFile();
+            setInt(&contents, 68, 0x01010101);
+            writeFile(fileName, contents);
+            ASSERT(0 == mX.map(fileName.c_str(),
+                               k_MAGIC,
+                               k_VERSION,
+                               k_RECORD_HEADER_SIZE));
+
+            ASSERT(X.data() + 64 == X.findString(64));
+            ASSERT(0 == X.findString(68));
+            ASSERT(0 == X.findString(71));
+
+            mX.unmap();
+            ASSERT(-1 == X.findRecord("A"));
+            ASSERT( 0 == X.findString(40));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_PASS(X.findRecord("A"));
+            ASSERT_FAIL(X.findRecord(0));
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'map' AND 'unmap'
+        //
+        // Concerns:
+        //: 1 A default-constructed object has no file mapped.
+        //:
+        //: 2 'map' maps a valid file, and the accessors reflect it.
+        //:
+        //: 3 'map' fails, returning the documented status and leaving the
+        //:   object unchanged, if the file does not exist, is too short, or
+        //:   has a bad magic number, version, size, number of records,
+        //:   directory entry, or name order, or if a record header extends
+        //:   past the end of the file.
+        //:
+        //: 4 A successful 'map' replaces the previously mapped file.
+        //:
+        //: 5 'unmap' unmaps the file, and has no effect if none is mapped.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Map a valid file and verify the accessors.  (C-1..2)
+        //:
+        //: 2 Using the table-driven technique, corrupt one field of a valid
+        //:   file at a time, and verify that 'map' fails with the expected
+        //:   status, and that the previously mapped file remains mapped.
+        //:   (C-3)
+        //:
+        //: 3 Map a second valid file and verify the accessors.  (C-4)
+        //:
+        //: 4 Call 'unmap' twice and verify the accessors.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   MappedRecordFile();
+        //   ~MappedRecordFile();
+        //   int map(const char *, const char *, int, bsl::size_t);
+        //   void unmap();
+        //   const char *data() const;
+        //   bool isMapped() const;
+        //   int numRecords() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'map' AND 'unmap'" << endl
+                                  << "=========================" << endl;
+
+        const bsl::string fileName  = tempFileName(test);
+        const bsl::string otherFile = fileName + ".bad";
+        const bsl::string GOOD      = goodFile();
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(false == X.isMapped());
+            ASSERT(0     == X.data());
+            ASSERT(0     == X.size());
+            ASSERT(0     == X.numRecords());
+
+            ASSERT(1 == mX.map("no/such/record/file",
+                               k_MAGIC,
+                               k_VERSION,
+                               k_RECORD_HEADER_SIZE));
+            ASSERT(false == X.isMapped());
+
+            writeFile(fileName, GOOD);
+            ASSERT(0 == mX.map(fileName.c_str(),
+                               k_MAGIC,
+                               k_VERSION,
+                               k_RECORD_HEADER_SIZE));
+
+            ASSERT(true == X.isMapped());
+            ASSERT(0    != X.data());
+            ASSERT(GOOD.size() == X.size());
+            ASSERT(3    == X.numRecords());
+            ASSERT(0    == bsl::memcmp(X.data(), GOOD.data(), GOOD.size()));
+
+            static const struct {
+                int d_line;
+                int d_position;  // -1 to truncate to 'd_value' bytes
+                int d_value;
+                int d_status;
+            } DATA[] = {
+                //LINE  POSITION  VALUE       STATUS
+                //----  --------  ----------  ------
+                { L_,         -1,          0,      2 },
+                { L_,         -1,         15,      2 },
+                { L_,         -1,         71,      4 },
+                { L_,          0, 0x54455354,      0 },  // "TEST"
+                { L_,          0, 0x54455355,      4 },  // "TESU"
+                { L_,          4,  k_VERSION,      0 },
+                { L_,          4,          4,      4 },
+                { L_,          8,         -1,      4 },
+                { L_,          8,          7,      4 },
+                { L_,          8, 0x10000000,      4 },
+                { L_,         12,         73,      4 },
+                { L_,         16,         39,      4 },  // name in directory
+                { L_,         16,         72,      4 },  // name past end
+                { L_,         16, 0x7FFFFFF0,      4 },
+                { L_,         20,         36,      4 },  // record in directory
+                { L_,         20,         50,      4 },  // misaligned record
+                { L_,         20,         68,      4 },  // header past end
+                { L_,         20,         72,      4 },
+                { L_,         20,         -4,      4 },
+                { L_,         24,         40,      4 },  // duplicate name
+                { L_,         24,         43,      0 },  // "B" follows "A"
+                { L_,         32,         43,      4 },  // "B" after "BB"
+                { L_,         32,         42,      4 },  // "BB" after "BB"
+                { L_,         20,         64,      0 },  // shared record
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int POSITION = DATA[ti].d_position;
+                const int VALUE    = DATA[ti].d_value;
+                const int STATUS   = DATA[ti].d_status;
+
+                if (veryVerbose) { T_ P_(LINE) P_(POSITION) P_(VALUE) }
+
+                bsl::string contents = GOOD;
+                if (0 > POSITION) {
+                    contents.resize(VALUE);
+                }
+                else {
+                    setInt(&contents, POSITION, VALUE);
+                }
+
+                Obj mY;  const Obj& Y = mY;
+
+                writeFile(otherFile, contents);
+                ASSERTV(LINE, STATUS == mY.map(otherFile.c_str(),
+                                               k_MAGIC,
+                                               k_VERSION,
+                                               k_RECORD_HEADER_SIZE));
+                ASSERTV(LINE, (0 == STATUS) == Y.isMapped());
+
+                if (0 != STATUS) {
+                    ASSERTV(LINE, STATUS == mX.map(otherFile.c_str(),
+                                                   k_MAGIC,
+                                                   k_VERSION,
+                                                   k_RECORD_HEADER_SIZE));
+                    ASSERTV(LINE, X.isMapped());
+                    ASSERTV(LINE, 3  == X.numRecords());
+                    ASSERTV(LINE, 56 == X.findRecord("BB"));
+                }
+                bdls::FilesystemUtil::remove(otherFile);
+            }
+
+            // A larger record header than the file allows is rejected.
+
+            Obj mY;  const Obj& Y = mY;
+            ASSERT(4 == mY.map(fileName.c_str(), k_MAGIC, k_VERSION, 9));
+            ASSERT(0 == mY.map(fileName.c_str(), k_MAGIC, k_VERSION, 8));
+            ASSERT(3 == Y.numRecords());
+
+            // A successful 'map' replaces the mapped file.
+
+            bsl::ostringstream oss;
+            Obj::writeHeader(oss, k_MAGIC, k_VERSION, 0, 16);
+            writeFile(otherFile, oss.str());
+            ASSERT(0 == mX.map(otherFile.c_str(),
+                               k_MAGIC,
+                               k_VERSION,
+                               k_RECORD_HEADER_SIZE));
+            ASSERT(true == X.isMapped());
+            ASSERT(16   == X.size());
+            ASSERT(0    == X.numRecords());
+            ASSERT(-1   == X.findRecord("A"));
+            bdls::FilesystemUtil::remove(otherFile);
+
+            mX.unmap();
+            ASSERT(false == X.isMapped());
+            ASSERT(0     == X.data());
+            ASSERT(0     == X.size());
+            ASSERT(0     == X.numRecords());
+
+            mX.unmap();
+            ASSERT(false == X.isMapped());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.map(fileName.c_str(), k_MAGIC, k_VERSION, 8));
+            ASSERT_FAIL(mX.map(0,                k_MAGIC, k_VERSION, 8));
+            ASSERT_FAIL(mX.map(fileName.c_str(), 0,       k_VERSION, 8));
+        }
+
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeHeader' AND 'writeInt'
+        //
+        // Concerns:
+        //: 1 'writeInt' writes four bytes, most significant first, for any
+        //:   value, including negative values.
+        //:
+        //: 2 'writeHeader' writes the magic number followed by the version,
+        //:   the number of records, and the file size, as by 'writeInt'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write a set of values and
+        //:   verify the bytes written.  (C-1)
+        //:
+        //: 2 Write a header and verify the bytes written.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   void writeHeader(ostream&, const char *, int, int, int);
+        //   void writeInt(bsl::ostream& stream, int value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeHeader' AND 'writeInt'" << endl
+                          << "====================================" << endl;
+
+        static const struct {
+            int         d_line;
+            int         d_value;
+            const char *d_bytes;
+        } DATA[] = {
+            //LINE  VALUE        BYTES
+            //----  -----------  ------------------
+            { L_,             0, "\x00\x00\x00\x00" },
+            { L_,             1, "\x00\x00\x00\x01" },
+            { L_,           256, "\x00\x00\x01\x00" },
+            { L_,    0x12345678, "\x12\x34\x56\x78" },
+            { L_,    0x7FFFFFFF, "\x7F\xFF\xFF\xFF" },
+            { L_,            -1, "\xFF\xFF\xFF\xFF" },
+            { L_,   -0x7FFFFFFF, "\x80\x00\x00\x01" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const int   VALUE = DATA[ti].d_value;
+            const char *BYTES = DATA[ti].d_bytes;
+
+            if (veryVerbose) { T_ P_(LINE) P(VALUE) }
+
+            bsl::ostringstream oss;
+            Obj::writeInt(oss, VALUE);
+
+            ASSERTV(LINE, bsl::string(BYTES, 4) == oss.str());
+            ASSERTV(LINE, VALUE == getInt(oss.str(), 0));
+        }
+
+        {
+            bsl::ostringstream oss;
+            Obj::writeHeader(oss, k_MAGIC, 1, 2, 0x01020304);
+
+            ASSERT(bsl::string("TEST"
+                               "\x00\x00\x00\x01"
+                               "\x00\x00\x00\x02"
+                               "\x01\x02\x03\x04", 16) == oss.str());
+            ASSERT(sizeof(Obj::FileHeader) == oss.str().size());
+            ASSERT(8 == sizeof(Obj::DirectoryEntry));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::ostringstream oss;
+
+            ASSERT_PASS(Obj::writeHeader(oss, k_MAGIC, 1, 0, 16));
+            ASSERT_FAIL(Obj::writeHeader(oss,       0, 1, 0, 16));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
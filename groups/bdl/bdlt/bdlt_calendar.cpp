@@ -7,6 +7,7 @@ BSLS_IDENT_RCSID(bdlt_calendar_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -23,6 +24,8 @@ BSLMF_ASSERT(-1 == static_cast<int>(bdlc::BitArray::k_INVALID_INDEX));
 // PRIVATE MANIPULATORS
 void Calendar::synchronizeCache()
 {
+    d_businessDayRanks.clear();
+
     const int length = d_packedCalendar.length();
     d_nonBusinessDays.setLength(length);
     if (length) {
@@ -123,6 +126,7 @@ bool Calendar::isCacheSynchronized() const
 Calendar::Calendar(bslma::Allocator *basicAllocator)
 : d_packedCalendar(basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
 }
 
@@ -131,6 +135,7 @@ Calendar::Calendar(const Date&       firstDate,
                    bslma::Allocator *basicAllocator)
 : d_packedCalendar(firstDate, lastDate, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
     d_nonBusinessDays.setLength(d_packedCalendar.length(), 0);
 }
@@ -139,6 +144,7 @@ Calendar::Calendar(const PackedCalendar&  packedCalendar,
                    bslma::Allocator      *basicAllocator)
 : d_packedCalendar(packedCalendar, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
     synchronizeCache();
 }
@@ -146,6 +152,7 @@ Calendar::Calendar(const PackedCalendar&  packedCalendar,
 Calendar::Calendar(const Calendar& original, bslma::Allocator *basicAllocator)
 : d_packedCalendar(original.d_packedCalendar, basicAllocator)
 , d_nonBusinessDays(original.d_nonBusinessDays, basicAllocator)
+, d_businessDayRanks(original.d_businessDayRanks, basicAllocator)
 {
 }
 
@@ -194,6 +201,7 @@ void Calendar::addHoliday(const Date& date)
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        d_businessDayRanks.clear();
     }
 }
 
@@ -227,6 +235,7 @@ void Calendar::addHolidayCode(const Date& date, int holidayCode)
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        d_businessDayRanks.clear();
     }
 }
 
@@ -235,6 +244,8 @@ void Calendar::addWeekendDay(DayOfWeek::Enum weekendDay)
     d_packedCalendar.addWeekendDay(weekendDay);
 
     if (length()) {
+        d_businessDayRanks.clear();
+
         int weekendDayIndex = (static_cast<int>(weekendDay)
                              - static_cast<int>(
                                       d_packedCalendar.firstDate().dayOfWeek())
@@ -261,6 +272,28 @@ void Calendar::addWeekendDays(const DayOfWeekSet& weekendDays)
     }
 }
 
+void Calendar::createBusinessDayIndex()
+{
+    const int length    = this->length();
+    const int numBlocks = (length + k_RANK_BLOCK_SIZE - 1) / k_RANK_BLOCK_SIZE;
+
+    bsl::vector<int> ranks(allocator());
+    ranks.reserve(numBlocks + 1);
+
+    int rank = 0;
+    ranks.push_back(rank);
+    for (int begin = 0; begin < length; begin += k_RANK_BLOCK_SIZE) {
+        const int end = begin + k_RANK_BLOCK_SIZE < length
+                      ? begin + k_RANK_BLOCK_SIZE
+                      : length;
+
+        rank += static_cast<int>(d_nonBusinessDays.num0(begin, end));
+        ranks.push_back(rank);
+    }
+
+    d_businessDayRanks.swap(ranks);
+}
+
 void Calendar::unionBusinessDays(const PackedCalendar& other)
 {
     int newLength;
@@ -316,6 +349,56 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
     int offset = date - firstDate();
+
+    if (!d_businessDayRanks.empty()) {
+        // Locate the block holding the 'target'-th business day of the
+        // calendar (counting from 1) by binary search over the index, then
+        // skip whole words within that block by population count before
+        // searching the final word bit by bit.
+
+        const int preceding = businessDayRank(offset + 1);
+
+        if (nth > d_businessDayRanks.back() - preceding) {
+            return e_FAILURE;                                         // RETURN
+        }
+
+        const int target = preceding + nth;
+
+        const int block = static_cast<int>(
+                            bsl::lower_bound(d_businessDayRanks.begin(),
+                                             d_businessDayRanks.end(),
+                                             target)
+                          - d_businessDayRanks.begin()) - 1;
+
+        int remaining = target - d_businessDayRanks[block];
+        int begin     = block * k_RANK_BLOCK_SIZE;
+
+        enum { k_BITS_PER_WORD = 64 };
+
+        for (;;) {
+            const int end = begin + k_BITS_PER_WORD < length()
+                          ? begin + k_BITS_PER_WORD
+                          : length();
+            const int count = static_cast<int>(
+                                         d_nonBusinessDays.num0(begin, end));
+            if (count >= remaining) {
+                break;
+            }
+            remaining -= count;
+            begin      = end;
+        }
+
+        offset = begin - 1;
+        while (remaining) {
+            offset = static_cast<int>(
+                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
+            --remaining;
+        }
+        *nextBusinessDay = firstDate() + offset;
+
+        return e_SUCCESS;                                             // RETURN
+    }
+
     while (nth) {
         offset = static_cast<int>(
                                 d_nonBusinessDays.find0AtMinIndex(offset + 1));
@@ -70,6 +70,31 @@ BSLS_IDENT("$Id: $")
 // calendars can be significantly more efficient for certain repeated
 // "is-common-business-day" determinations among two or more calendars.
 //
+///Business-Day Index
+///------------------
+// 'bdlt::Calendar' stores its non-business days in a bit array, so
+// 'isBusinessDay' is a single bit test, and 'numBusinessDays' counts business
+// days with a population count over the words spanning the supplied range.
+// For calendars that are queried repeatedly over long date ranges (e.g., by
+// day-count conventions such as 'bbldc::CalendarBus252', or by schedule
+// generation), the 'createBusinessDayIndex' method can additionally build a
+// rank directory recording the number of business days preceding each
+// 512-day block of the valid range.  With the index:
+//
+//: o 'numBusinessDays(beginDate, endDate)' runs in constant time, counting
+//:   bits in at most two partial blocks.
+//:
+//: o 'getNextBusinessDay(&result, date, nth)' (i.e., "the 'nth' business day
+//:   after 'date'") runs in time logarithmic in the length of the calendar,
+//:   using a binary search over the directory followed by a population count
+//:   within a single block, instead of visiting each of the 'nth' business
+//:   days.
+//
+// The index occupies 4 bytes per 512 days, is not part of the value of a
+// calendar, is carried by copy construction, assignment, and 'swap', and is
+// discarded by any manipulator that may change the set of business days.
+// 'bdlt::CalendarCache' indexes every calendar it loads.
+//
 ///Weekend Days and Weekend-Days Transitions
 ///-----------------------------------------
 // A calendar maintains a set of dates considered to be weekend days.
@@ -481,6 +506,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_iosfwd.h>
 #include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
@@ -519,6 +545,14 @@ class Calendar {
                                // of the valid range is defined by
                                // 'd_packedCalendar.firstDate() + length() - 1'
 
+    bsl::vector<int>  d_businessDayRanks;
+                               // optional business-day index: element 'k' is
+                               // the number of business days among the first
+                               // 'k * k_RANK_BLOCK_SIZE' days of the valid
+                               // range (empty unless 'createBusinessDayIndex'
+                               // was called since the last change to
+                               // 'd_nonBusinessDays')
+
     // FRIENDS
     friend bool operator==(const Calendar&, const Calendar&);
     friend bool operator!=(const Calendar&, const Calendar&);
@@ -526,6 +560,10 @@ class Calendar {
     friend void hashAppend(HASHALG& hashAlg, const Calendar&);
 
   private:
+    // PRIVATE CONSTANTS
+    enum { k_RANK_BLOCK_SIZE = 512 };  // number of days summarized by each
+                                       // element of 'd_businessDayRanks'
+
     // PRIVATE MANIPULATORS
     void synchronizeCache();
         // Synchronize this calendar's cache by first clearing the cache, then
@@ -535,6 +573,12 @@ class Calendar {
         // handled by the caller.
 
     // PRIVATE ACCESSORS
+    int businessDayRank(int offset) const;
+        // Return the number of business days among the first 'offset' days of
+        // the valid range of this calendar.  The behavior is undefined unless
+        // this calendar has a business-day index and
+        // '0 <= offset <= length()'.
+
     bool isCacheSynchronized() const;
         // Return 'true' if this calendar's cache correctly represents the
         // holiday and weekend information stored in this calendar's
@@ -692,6 +736,14 @@ class Calendar {
         // are affected by the use of this method.  Note that this method does
         // not extend the valid range of the calendar.
 
+    void createBusinessDayIndex();
+        // Create an index over the business days of this calendar that allows
+        // 'numBusinessDays(beginDate, endDate)' to run in constant time, and
+        // 'getNextBusinessDay(nextBusinessDay, date, nth)' to run in time
+        // logarithmic in 'length()' (see {Business-Day Index}).  Note that the
+        // index is discarded by any subsequent call to a manipulator that may
+        // change the set of business days of this calendar.
+
     void intersectBusinessDays(const Calendar&       other);
     void intersectBusinessDays(const PackedCalendar& other);
         // Merge the specified 'other' calendar into this calendar such that
@@ -964,6 +1016,10 @@ class Calendar {
         // particular, using this method to iterate over the holiday codes for
         // 'date' is less efficient than using a 'HolidayCodeConstIterator'.
 
+    bool hasBusinessDayIndex() const;
+        // Return 'true' if this calendar holds an index over its business days
+        // (see 'createBusinessDayIndex'), and 'false' otherwise.
+
     bool isBusinessDay(const Date& date) const;
         // Return 'true' if the specified 'date' is a business day (i.e., not
         // a holiday or weekend day) in this calendar, and 'false' otherwise.
@@ -1395,6 +1451,20 @@ Calendar_BusinessDayConstIter operator--(
                             // class Calendar
                             // --------------
 
+// PRIVATE ACCESSORS
+inline
+int Calendar::businessDayRank(int offset) const
+{
+    BSLS_ASSERT_SAFE(!d_businessDayRanks.empty());
+    BSLS_ASSERT_SAFE(0 <= offset && offset <= length());
+
+    const int block = offset / k_RANK_BLOCK_SIZE;
+    const int begin = block * k_RANK_BLOCK_SIZE;
+
+    return d_businessDayRanks[block]
+         + static_cast<int>(d_nonBusinessDays.num0(begin, offset));
+}
+
 // CLASS METHODS
 
                                   // Aspects
@@ -1479,6 +1549,7 @@ void Calendar::removeAll()
 {
     d_packedCalendar.removeAll();
     d_nonBusinessDays.removeAll();
+    d_businessDayRanks.clear();
 }
 
 inline
@@ -1488,6 +1559,7 @@ void Calendar::removeHoliday(const Date& date)
 
     if (true == isInRange(date) && false == isWeekendDay(date)) {
         d_nonBusinessDays.assign0(date - firstDate());
+        d_businessDayRanks.clear();
     }
 }
 
@@ -1566,6 +1638,8 @@ void Calendar::swap(Calendar& other)
 
     bslalg::SwapUtil::swap(&d_packedCalendar,  &other.d_packedCalendar);
     bslalg::SwapUtil::swap(&d_nonBusinessDays, &other.d_nonBusinessDays);
+    bslalg::SwapUtil::swap(&d_businessDayRanks,
+                           &other.d_businessDayRanks);
 }
 
 // ACCESSORS
@@ -1725,6 +1799,12 @@ int Calendar::holidayCode(const Date& date, int index) const
     return d_packedCalendar.holidayCode(date, index);
 }
 
+inline
+bool Calendar::hasBusinessDayIndex() const
+{
+    return !d_businessDayRanks.empty();
+}
+
 inline
 bool Calendar::isBusinessDay(const Date& date) const
 {
@@ -1788,6 +1868,11 @@ int Calendar::numBusinessDays(const Date& beginDate, const Date& endDate) const
     BSLS_ASSERT_SAFE(isInRange(endDate));
     BSLS_ASSERT_SAFE(beginDate <= endDate);
 
+    if (!d_businessDayRanks.empty()) {
+        return businessDayRank(endDate - firstDate() + 1)
+             - businessDayRank(beginDate - firstDate());              // RETURN
+    }
+
     return static_cast<int>(d_nonBusinessDays.num0(beginDate - firstDate(),
                                                    endDate - firstDate() + 1));
 }
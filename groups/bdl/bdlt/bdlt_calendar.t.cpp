@@ -103,6 +103,7 @@ using namespace bsl;
 // [18] void unionBusinessDays(const PackedCalendar& calendar);
 // [18] void unionNonBusinessDays(const Calendar& calendar);
 // [18] void unionNonBusinessDays(const PackedCalendar& calendar);
+// [31] void createBusinessDayIndex();
 // [10] STREAM& bdexStreamIn(STREAM& stream, int version);
 // [ 8] void swap(Calendar& other);
 //
@@ -122,6 +123,7 @@ using namespace bsl;
 // [19] HolidayConstIterator endHolidays(const Date& date) const;
 // [25] WDTCI endWeekendDaysTransitions() const;
 // [ 4] const Date& firstDate() const;
+// [31] bool hasBusinessDayIndex() const;
 // [28] int getNextBusinessDay(Date *nextBusinessDay, const Date& date);
 // [28] int getNextBusinessDay(Date *nBD, const Date& date, int nth);
 // [ 4] bdlt::Date holiday(int index) const;
@@ -181,7 +183,8 @@ using namespace bsl;
 // [ 8] void swap(Calendar& a, Calendar& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [31] USAGE EXAMPLE
+// [31] CONCERN: BUSINESS-DAY INDEX
+// [32] USAGE EXAMPLE
 // [ 3] CALENDAR& gg(CALENDAR *o, const char *s);
 // [ 3] int ggg(CALENDAR *obj, const char *spec, bool vF);
 // ============================================================================
@@ -1167,7 +1170,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1236,6 +1239,256 @@ int main(int argc, char *argv[])
                          MyCalendarUtil::modifiedFollowing(31, 7, 2015, cal2));
 //..
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // CONCERN: BUSINESS-DAY INDEX
+        //   Ensure that a calendar having a business-day index answers
+        //   business-day queries exactly as one without an index does, and
+        //   that the index is discarded whenever the business days change.
+        //
+        // Concerns:
+        //: 1 'createBusinessDayIndex' creates an index, reflected by
+        //:   'hasBusinessDayIndex', using the object allocator.
+        //:
+        //: 2 With the index, 'numBusinessDays(beginDate, endDate)' and
+        //:   'getNextBusinessDay(&result, date, nth)' return the same values
+        //:   as without the index, including at block boundaries, at the ends
+        //:   of the valid range, and when the requested business day does
+        //:   not exist.
+        //:
+        //: 3 The index is retained by copy construction, copy assignment, and
+        //:   'swap', and is discarded by every manipulator that may change the
+        //:   set of business days.
+        //:
+        //: 4 The index is not part of the value of a calendar.
+        //:
+        //: 5 Empty calendars, and calendars having no business days, can be
+        //:   indexed.
+        //
+        // Plan:
+        //: 1 Create a calendar spanning several years having weekend days, a
+        //:   weekend-days transition, and pseudo-random holidays, and a copy
+        //:   having an index.  Compare the results of the accessors on the two
+        //:   objects for a large number of inputs.  (C-1..2, 4)
+        //:
+        //: 2 Apply each manipulator that may change the business days to an
+        //:   indexed calendar and verify the index is discarded; verify that
+        //:   copying and swapping retain the index.  (C-3)
+        //:
+        //: 3 Index an empty calendar and a calendar having no business days
+        //:   and verify the accessors.  (C-5)
+        //
+        // Testing:
+        //   void createBusinessDayIndex();
+        //   bool hasBusinessDayIndex() const;
+        //   CONCERN: BUSINESS-DAY INDEX
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: BUSINESS-DAY INDEX" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const bdlt::Date FIRST(2000, 1,  1);
+        const bdlt::Date LAST (2009, 12, 31);
+
+        Obj mY(FIRST, LAST, &sa);  const Obj& Y = mY;  // without index
+        {
+            bdlt::DayOfWeekSet weekendDays;
+            weekendDays.add(bdlt::DayOfWeek::e_SAT);
+            weekendDays.add(bdlt::DayOfWeek::e_SUN);
+            mY.addWeekendDaysTransition(bdlt::Date(1, 1, 1), weekendDays);
+
+            weekendDays.removeAll();
+            weekendDays.add(bdlt::DayOfWeek::e_FRI);
+            mY.addWeekendDaysTransition(bdlt::Date(2004, 3, 1), weekendDays);
+
+            unsigned int seed = 12345;
+            for (bdlt::Date date = FIRST; date <= LAST; ++date) {
+                seed = seed * 1103515245u + 12345u;
+                if (0 == (seed >> 16) % 19) {
+                    mY.addHoliday(date);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nCreating the index." << endl;
+
+        Obj mX(Y, &sa);  const Obj& X = mX;
+
+        ASSERT(!X.hasBusinessDayIndex());
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            bslma::TestAllocatorMonitor sam(&sa);
+
+            mX.createBusinessDayIndex();
+
+            ASSERT(X.hasBusinessDayIndex());
+            ASSERT(sam.isInUseUp());
+            ASSERT(dam.isTotalSame());
+        }
+        ASSERT(Y == X);
+
+        if (verbose) cout << "\nComparing 'numBusinessDays'." << endl;
+        {
+            const int LENGTH = X.length();
+
+            ASSERT(Y.numBusinessDays(FIRST, LAST) ==
+                                               X.numBusinessDays(FIRST, LAST));
+
+            for (int i = 0; i < LENGTH; i += 7) {
+                for (int j = i; j < LENGTH; j += 61) {
+                    const bdlt::Date BEGIN = FIRST + i;
+                    const bdlt::Date END   = FIRST + j;
+
+                    LOOP2_ASSERT(i, j, Y.numBusinessDays(BEGIN, END) ==
+                                               X.numBusinessDays(BEGIN, END));
+                }
+            }
+
+            // Block boundaries.
+
+            for (int i = 510; i < LENGTH; i += 512) {
+                for (int d = 0; d < 4; ++d) {
+                    const bdlt::Date BEGIN = FIRST + i + d - 2;
+
+                    LOOP2_ASSERT(i, d, Y.numBusinessDays(FIRST, BEGIN) ==
+                                             X.numBusinessDays(FIRST, BEGIN));
+                    LOOP2_ASSERT(i, d, Y.numBusinessDays(BEGIN, LAST) ==
+                                              X.numBusinessDays(BEGIN, LAST));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nComparing 'getNextBusinessDay'." << endl;
+        {
+            const int LENGTH = X.length();
+            const int NUM    = Y.numBusinessDays();
+
+            static const int NTHS[] = { 1, 2, 3, 5, 31, 63, 64, 65, 250,
+                                        511, 512, 513, 1000, 2500 };
+            const int NUM_NTHS = static_cast<int>(sizeof NTHS / sizeof *NTHS);
+
+            for (int i = -1; i < LENGTH - 1; i += 3) {
+                const bdlt::Date DATE = FIRST + i;
+
+                for (int n = 0; n < NUM_NTHS; ++n) {
+                    const int NTH = NTHS[n];
+
+                    bdlt::Date expected(1, 1, 1);
+                    bdlt::Date result(1, 1, 1);
+
+                    const int EXP = Y.getNextBusinessDay(&expected, DATE, NTH);
+                    const int RV  = X.getNextBusinessDay(&result,   DATE, NTH);
+
+                    LOOP2_ASSERT(i, NTH, EXP      == RV);
+                    LOOP2_ASSERT(i, NTH, expected == result);
+                }
+
+                bdlt::Date result(1, 1, 1);
+                LOOP_ASSERT(i, 0 != X.getNextBusinessDay(&result,
+                                                         DATE,
+                                                         NUM + 1));
+                LOOP_ASSERT(i, bdlt::Date(1, 1, 1) == result);
+            }
+
+            bdlt::Date result;
+            ASSERT(0 == X.getNextBusinessDay(&result, FIRST - 1, NUM));
+            ASSERT(result == *Y.rbeginBusinessDays());
+            ASSERT(0 == X.getNextBusinessDay(&result, FIRST - 1, 1));
+            ASSERT(result == *Y.beginBusinessDays());
+            ASSERT(0 != X.getNextBusinessDay(&result, FIRST - 1, 0x7fffffff));
+        }
+
+        if (verbose) cout << "\nCopying and swapping." << endl;
+        {
+            Obj mA(X, &sa);  const Obj& A = mA;
+            ASSERT(A.hasBusinessDayIndex());
+
+            Obj mB(&sa);  const Obj& B = mB;
+            mB = X;
+            ASSERT(B.hasBusinessDayIndex());
+
+            Obj mC(Y, &sa);  const Obj& C = mC;
+            mC.swap(mB);
+            ASSERT( C.hasBusinessDayIndex());
+            ASSERT(!B.hasBusinessDayIndex());
+
+            mC = X.packedCalendar();
+            ASSERT(!C.hasBusinessDayIndex());
+        }
+
+        if (verbose) cout << "\nDiscarding the index." << endl;
+        {
+            const bdlt::Date DATE(2005, 6, 15);
+
+            Obj mA(X, &sa);  const Obj& A = mA;
+
+            mA.addHoliday(DATE);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.removeHoliday(DATE);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.addHolidayCode(DATE, 7);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.addDay(LAST + 1);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.setValidRange(FIRST, LAST);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.unionBusinessDays(X);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.intersectNonBusinessDays(Y);
+            ASSERT(!A.hasBusinessDayIndex());
+
+            mA.createBusinessDayIndex();
+            mA.removeAll();
+            ASSERT(!A.hasBusinessDayIndex());
+
+            Obj mW(FIRST, LAST, &sa);  const Obj& W = mW;
+
+            mW.createBusinessDayIndex();
+            mW.addWeekendDay(bdlt::DayOfWeek::e_WED);
+            ASSERT(!W.hasBusinessDayIndex());
+
+            // Manipulators that do not change the business days retain the
+            // index.
+
+            Obj mB(X, &sa);  const Obj& B = mB;
+
+            mB.removeHolidayCode(DATE, 7);
+            mB.reserveHolidayCapacity(1000);
+            ASSERT(B.hasBusinessDayIndex());
+        }
+
+        if (verbose) cout << "\nEmpty and non-business calendars." << endl;
+        {
+            Obj mA(&sa);  const Obj& A = mA;
+
+            mA.createBusinessDayIndex();
+            ASSERT(A.hasBusinessDayIndex());
+
+            Obj mB(FIRST, FIRST + 1000, &sa);  const Obj& B = mB;
+            mB.addWeekendDays(~bdlt::DayOfWeekSet());  // every day
+            mB.createBusinessDayIndex();
+
+            ASSERT(0 == B.numBusinessDays(FIRST, FIRST + 1000));
+
+            bdlt::Date result;
+            ASSERT(0 != B.getNextBusinessDay(&result, FIRST, 1));
+        }
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING: hashAppend
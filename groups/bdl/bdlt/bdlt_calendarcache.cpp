@@ -10,15 +10,34 @@ BSLS_IDENT_RCSID(bdlt_calendarcache_cpp,"$Id$ $CSID$")
 #include <bdlt_packedcalendar.h>
 
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>      // 'INT_MAX'
 
 namespace BloombergLP {
 namespace bdlt {
+namespace {
+
+CalendarCache_HazardSlot *alignHazardSlots(CalendarCache_HazardSlot *storage)
+    // Return the first address within the specified 'storage' that is aligned
+    // to a cache line.
+{
+    char *address = reinterpret_cast<char *>(storage);
+
+    return reinterpret_cast<CalendarCache_HazardSlot *>(
+                      address + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                 address,
+                                 CalendarCache_HazardSlot::k_CACHE_LINE_SIZE));
+}
+
+}  // close unnamed namespace
 
                         // -------------------------
                         // class CalendarCache_Entry
@@ -72,14 +91,214 @@ Datetime CalendarCache_Entry::loadTime() const
     return d_loadTime;
 }
 
+                       // -----------------------------
+                       // struct CalendarCache_Snapshot
+                       // -----------------------------
+
+struct CalendarCache_Snapshot {
+    // This component-private 'struct' holds the contents of a calendar cache
+    // at some point in time.  A snapshot is never modified once it has been
+    // published.
+
+    // TYPES
+    typedef bsl::map<bsl::string, CalendarCache_Entry> Map;
+
+    // DATA
+    Map d_cache;  // cache of (name, handle) pairs
+
+    // CREATORS
+    explicit
+    CalendarCache_Snapshot(bslma::Allocator *basicAllocator)
+    : d_cache(basicAllocator)
+    {
+    }
+
+    CalendarCache_Snapshot(const CalendarCache_Snapshot&  original,
+                           bslma::Allocator              *basicAllocator)
+    : d_cache(original.d_cache, basicAllocator)
+    {
+    }
+};
+
                            // -------------------
                            // class CalendarCache
                            // -------------------
 
+// PRIVATE MANIPULATORS
+void CalendarCache::insertEntry(const char                 *calendarName,
+                                const CalendarCache_Entry&  entry)
+{
+    const CalendarCache_Snapshot *current = d_snapshot_p.loadRelaxed();
+
+    CalendarCache_Snapshot *snapshot = current
+        ? new (*d_allocator_p) CalendarCache_Snapshot(*current, d_allocator_p)
+        : new (*d_allocator_p) CalendarCache_Snapshot(d_allocator_p);
+
+    bslma::RawDeleterProctor<CalendarCache_Snapshot, bslma::Allocator>
+                                           proctor(snapshot, d_allocator_p);
+
+    snapshot->d_cache[calendarName] = entry;
+    d_retired.reserve(d_retired.size() + 1);
+
+    proctor.release();
+
+    publish(snapshot);
+}
+
+// PRIVATE ACCESSORS
+bool CalendarCache::isExpired(const CalendarCache_Entry& entry) const
+{
+    return d_hasTimeOutFlag
+        && !(d_timeOut > CurrentTime::utc() - entry.loadTime());
+}
+
+int CalendarCache::lookupEntry(bsl::shared_ptr<const Calendar> *calendar,
+                               Datetime                        *loadTime,
+                               const char                      *calendarName)
+                                                                          const
+{
+    CalendarCache_Snapshot *snapshot = d_snapshot_p.load();
+
+    if (0 == snapshot) {
+        return 1;                                                     // RETURN
+    }
+
+    // Announce 'snapshot' in a free hazard slot, starting the search at a slot
+    // determined by the calling thread so that concurrent readers tend to use
+    // different slots.  Thread ids are often multiples of a large power of
+    // two, so the id is mixed (by a multiplicative hash) before it is reduced.
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    const int start = static_cast<int>(((id * 0x9E3779B97F4A7C15ULL) >> 32)
+                                                         % k_NUM_HAZARD_SLOTS);
+
+    bsls::AtomicPointer<CalendarCache_Snapshot> *slot = 0;
+
+    for (int i = 0; i < k_NUM_HAZARD_SLOTS; ++i) {
+        bsls::AtomicPointer<CalendarCache_Snapshot>& candidate =
+                d_hazardSlots_p[(start + i) % k_NUM_HAZARD_SLOTS].d_snapshot_p;
+
+        if (0 == candidate.loadRelaxed()
+         && 0 == candidate.testAndSwap(0, snapshot)) {
+            slot = &candidate;
+            break;
+        }
+    }
+
+    if (0 == slot) {
+        return -1;                                                    // RETURN
+    }
+
+    // The announcement protects 'snapshot' only if it was still current once
+    // the announcement became visible; otherwise, a writer may already have
+    // scanned the hazard slots and freed it.  Both this load and the writer's
+    // store of a new snapshot are sequentially consistent.
+
+    if (d_snapshot_p.load() != snapshot) {
+        slot->storeRelease(0);
+        return -1;                                                    // RETURN
+    }
+
+    int rc = 1;
+
+    CalendarCache_Snapshot::Map::const_iterator iter =
+                                          snapshot->d_cache.find(calendarName);
+
+    if (iter != snapshot->d_cache.end()) {
+        if (isExpired(iter->second)) {
+            rc = -1;
+        }
+        else {
+            if (calendar) {
+                *calendar = iter->second.get();
+            }
+            if (loadTime) {
+                *loadTime = iter->second.loadTime();
+            }
+            rc = 0;
+        }
+    }
+
+    slot->storeRelease(0);
+
+    return rc;
+}
+
+void CalendarCache::publish(CalendarCache_Snapshot *snapshot) const
+{
+    BSLS_ASSERT(d_retired.size() < d_retired.capacity());
+
+    CalendarCache_Snapshot *previous = d_snapshot_p.loadRelaxed();
+
+    d_snapshot_p.store(snapshot);
+
+    if (previous) {
+        d_retired.push_back(previous);
+    }
+
+    // Free each retired snapshot that is not announced in a hazard slot.  A
+    // reader that announces a retired snapshot after this scan will find that
+    // the snapshot is no longer current, and will not access it.
+
+    bsl::vector<CalendarCache_Snapshot *>::iterator end = d_retired.begin();
+
+    for (bsl::vector<CalendarCache_Snapshot *>::iterator it =
+                                                            d_retired.begin();
+         it != d_retired.end();
+         ++it) {
+        bool inUse = false;
+
+        for (int i = 0; i < k_NUM_HAZARD_SLOTS; ++i) {
+            if (d_hazardSlots_p[i].d_snapshot_p.load() == *it) {
+                inUse = true;
+                break;
+            }
+        }
+
+        if (inUse) {
+            *end = *it;
+            ++end;
+        }
+        else {
+            d_allocator_p->deleteObject(*it);
+        }
+    }
+
+    d_retired.erase(end, d_retired.end());
+}
+
+void CalendarCache::removeEntry(const char *calendarName) const
+{
+    const CalendarCache_Snapshot *current = d_snapshot_p.loadRelaxed();
+
+    BSLS_ASSERT(current);
+
+    CalendarCache_Snapshot *snapshot = 0;
+
+    if (1 < current->d_cache.size()) {
+        snapshot = new (*d_allocator_p) CalendarCache_Snapshot(*current,
+                                                               d_allocator_p);
+    }
+
+    bslma::RawDeleterProctor<CalendarCache_Snapshot, bslma::Allocator>
+                                           proctor(snapshot, d_allocator_p);
+
+    if (snapshot) {
+        snapshot->d_cache.erase(calendarName);
+    }
+    d_retired.reserve(d_retired.size() + 1);
+
+    proctor.release();
+
+    publish(snapshot);
+}
+
 // CREATORS
 CalendarCache::CalendarCache(CalendarLoader   *loader,
                              bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
+: d_snapshot_p(0)
+, d_hazardSlots_p(alignHazardSlots(d_hazardSlotStorage))
+, d_retired(basicAllocator)
 , d_loader_p(loader)
 , d_timeOut(0)
 , d_hasTimeOutFlag(false)
@@ -92,7 +311,9 @@ CalendarCache::CalendarCache(CalendarLoader   *loader,
 CalendarCache::CalendarCache(CalendarLoader            *loader,
                              const bsls::TimeInterval&  timeout,
                              bslma::Allocator          *basicAllocator)
-: d_cache(basicAllocator)
+: d_snapshot_p(0)
+, d_hazardSlots_p(alignHazardSlots(d_hazardSlotStorage))
+, d_retired(basicAllocator)
 , d_loader_p(loader)
 , d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
 , d_hasTimeOutFlag(true)
@@ -106,6 +327,13 @@ CalendarCache::CalendarCache(CalendarLoader            *loader,
 
 CalendarCache::~CalendarCache()
 {
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        d_allocator_p->deleteObject(d_retired[i]);
+    }
+
+    if (CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed()) {
+        d_allocator_p->deleteObject(snapshot);
+    }
 }
 
 // MANIPULATORS
@@ -114,18 +342,30 @@ CalendarCache::getCalendar(const char *calendarName)
 {
     BSLS_ASSERT(calendarName);
 
-    {
+    bsl::shared_ptr<const Calendar> calendar;
+
+    const int rc = lookupEntry(&calendar, 0, calendarName);
+
+    if (0 == rc) {
+        return calendar;                                              // RETURN
+    }
+
+    if (0 > rc) {
         bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-        CacheIterator iter = d_cache.find(calendarName);
+        const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
-        if (iter != d_cache.end()) {
-            if (   !d_hasTimeOutFlag
-                || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-                return iter->second.get();                            // RETURN
-            }
-            else {
-                d_cache.erase(iter);
+        if (snapshot) {
+            CalendarCache_Snapshot::Map::const_iterator iter =
+                                          snapshot->d_cache.find(calendarName);
+
+            if (iter != snapshot->d_cache.end()) {
+                if (!isExpired(iter->second)) {
+                    return iter->second.get();                        // RETURN
+                }
+                else {
+                    removeEntry(calendarName);
+                }
             }
         }
     }
@@ -145,6 +385,17 @@ CalendarCache::getCalendar(const char *calendarName)
     Calendar *calendarPtr = new (*d_allocator_p) Calendar(packedCalendar,
                                                           d_allocator_p);
 
+    // Index the business days of the new calendar so that business-day
+    // arithmetic on the shared, immutable result is fast.
+
+    {
+        bslma::RawDeleterProctor<Calendar, bslma::Allocator> proctor(
+                                                                calendarPtr,
+                                                                d_allocator_p);
+        calendarPtr->createBusinessDayIndex();
+        proctor.release();
+    }
+
     CalendarCache_Entry entry(calendarPtr, timestamp, d_allocator_p);
 
     // Insert newly-loaded calendar into cache if another thread hasn't done so
@@ -152,18 +403,23 @@ CalendarCache::getCalendar(const char *calendarName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    ConstCacheIterator iter = d_cache.find(calendarName);
+    const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
     // Here, we assume that the time elapsed between the last check and the
     // loading of the calendar is insignificant compared to the timeout, so we
     // will simply return the entry in the cache if it has been inserted by
     // another thread.
 
-    if (iter != d_cache.end()) {
-        return iter->second.get();                                    // RETURN
+    if (snapshot) {
+        CalendarCache_Snapshot::Map::const_iterator iter =
+                                          snapshot->d_cache.find(calendarName);
+
+        if (iter != snapshot->d_cache.end()) {
+            return iter->second.get();                                // RETURN
+        }
     }
 
-    d_cache[calendarName] = entry;
+    insertEntry(calendarName, entry);
 
     return entry.get();
 }
@@ -174,10 +430,10 @@ int CalendarCache::invalidate(const char *calendarName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        d_cache.erase(iter);
+    if (snapshot && snapshot->d_cache.count(calendarName)) {
+        removeEntry(calendarName);
 
         return 1;                                                     // RETURN
     }
@@ -189,9 +445,17 @@ int CalendarCache::invalidateAll()
 {
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    const int numInvalidated = static_cast<int>(d_cache.size());
+    const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
-    d_cache.clear();
+    if (0 == snapshot) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numInvalidated = static_cast<int>(snapshot->d_cache.size());
+
+    d_retired.reserve(d_retired.size() + 1);
+
+    publish(0);
 
     return numInvalidated;
 }
@@ -202,17 +466,27 @@ CalendarCache::lookupCalendar(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
+    bsl::shared_ptr<const Calendar> calendar;
+
+    if (0 <= lookupEntry(&calendar, 0, calendarName)) {
+        return calendar;                                              // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.get();                                // RETURN
-        }
-        else {
-            d_cache.erase(iter);
+    if (snapshot) {
+        CalendarCache_Snapshot::Map::const_iterator iter =
+                                          snapshot->d_cache.find(calendarName);
+
+        if (iter != snapshot->d_cache.end()) {
+            if (!isExpired(iter->second)) {
+                return iter->second.get();                            // RETURN
+            }
+            else {
+                removeEntry(calendarName);
+            }
         }
     }
 
@@ -223,17 +497,27 @@ Datetime CalendarCache::lookupLoadTime(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
+    Datetime loadTime;
+
+    if (0 <= lookupEntry(0, &loadTime, calendarName)) {
+        return loadTime;                                              // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const CalendarCache_Snapshot *snapshot = d_snapshot_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.loadTime();                           // RETURN
-        }
-        else {
-            d_cache.erase(iter);
+    if (snapshot) {
+        CalendarCache_Snapshot::Map::const_iterator iter =
+                                          snapshot->d_cache.find(calendarName);
+
+        if (iter != snapshot->d_cache.end()) {
+            if (!isExpired(iter->second)) {
+                return iter->second.loadTime();                       // RETURN
+            }
+            else {
+                removeEntry(calendarName);
+            }
         }
     }
 
@@ -61,6 +61,35 @@ BSLS_IDENT("$Id: $")
 // allocator in effect during the lifetime of cache objects are both fully
 // thread-safe.
 //
+///Performance
+///-----------
+// The contents of a 'bdlt::CalendarCache' are held in an immutable snapshot
+// that is replaced, copy-on-write, by operations that modify the cache (i.e.,
+// loading, invalidating, or expiring a calendar).  A request that finds an
+// unexpired calendar in the cache -- a cache hit from 'getCalendar',
+// 'lookupCalendar', or 'lookupLoadTime' -- reads the current snapshot without
+// acquiring a lock.  The reading thread announces the snapshot it is using in
+// one of a small number of padded hazard slots, so that a concurrent
+// modification defers freeing that snapshot until the reader is done; a
+// reader that finds no free slot, or that finds that the snapshot changed
+// before its announcement became visible, simply falls back to the locked
+// path.  The only atomic reference-count increment on a cache hit is that of
+// the 'bsl::shared_ptr<const bdlt::Calendar>' returned to the caller;
+// 'lookupLoadTime' performs none.
+//
+// Modifications are serialized by a mutex, and each one copies the whole table
+// of cached calendars, incrementing the reference count of every cached
+// calendar.  A modification of a cache holding 'N' calendars therefore takes
+// time linear in 'N' while holding the mutex, and loading 'N' calendars into
+// an empty cache takes time quadratic in 'N'.  This is inexpensive for the
+// few dozen calendars a process typically uses, but a cache expected to hold
+// many hundreds of calendars, or whose calendars expire (and so are reloaded)
+// frequently, should weigh that cost against the benefit of lock-free cache
+// hits.
+// Each calendar is given a business-day index when it is loaded (see
+// 'bdlt::Calendar::createBusinessDayIndex'), so that business-day counting and
+// offsetting on cached calendars do not scan the calendar day by day.
+//
 ///Usage
 ///-----
 // The following example illustrates how to use a 'bdlt::CalendarCache'.
@@ -257,11 +286,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
 #include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -273,6 +304,7 @@ namespace bdlt {
 
 class CalendarLoader;
 class CalendarCache_Entry;
+struct CalendarCache_Snapshot;
 
                         // =========================
                         // class CalendarCache_Entry
@@ -336,6 +368,27 @@ class CalendarCache_Entry {
         // entry object was loaded.
 };
 
+                      // ===============================
+                      // struct CalendarCache_HazardSlot
+                      // ===============================
+
+struct CalendarCache_HazardSlot {
+    // This component-private 'struct' holds the address of the snapshot of a
+    // calendar cache that a reading thread is currently accessing (or 0 if the
+    // slot is free).  The slot occupies a whole cache line, so that slots
+    // used by different threads, once aligned to a cache line, do not share
+    // one.
+
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+    // DATA
+    bsls::AtomicPointer<CalendarCache_Snapshot> d_snapshot_p;
+                                                   // snapshot in use, or 0
+
+    char d_padding[k_CACHE_LINE_SIZE -
+                   sizeof(bsls::AtomicPointer<CalendarCache_Snapshot>)];
+};
+
                            // ===================
                            // class CalendarCache
                            // ===================
@@ -360,9 +413,33 @@ class CalendarCache {
     //
     // This class is fully thread-safe (see 'bsldoc_glossary').
 
+    // PRIVATE TYPES
+    enum { k_NUM_HAZARD_SLOTS = 16 };  // number of concurrent lock-free
+                                       // readers
+
     // DATA
-    mutable bsl::map<bsl::string, CalendarCache_Entry>
-                            d_cache;           // cache of (name, handle) pairs
+    mutable bsls::AtomicPointer<CalendarCache_Snapshot>
+                            d_snapshot_p;      // current contents of the
+                                               // cache, or 0 if empty (owned)
+
+    mutable CalendarCache_HazardSlot
+                            d_hazardSlotStorage[k_NUM_HAZARD_SLOTS + 1];
+                                               // storage for
+                                               // 'd_hazardSlots_p', with one
+                                               // extra slot of room to align
+                                               // it
+
+    CalendarCache_HazardSlot
+                           *d_hazardSlots_p;   // 'k_NUM_HAZARD_SLOTS'
+                                               // snapshots in use by
+                                               // lock-free readers, aligned
+                                               // to a cache line within
+                                               // 'd_hazardSlotStorage'
+
+    mutable bsl::vector<CalendarCache_Snapshot *>
+                            d_retired;         // replaced snapshots that may
+                                               // still be in use by a reader
+                                               // (owned)
 
     CalendarLoader         *d_loader_p;        // calendar loader (held, not
                                                // owned)
@@ -374,17 +451,51 @@ class CalendarCache {
                                                // timeout value and 'false'
                                                // otherwise
 
-    mutable bslmt::Mutex    d_lock;            // guard access to cache
+    mutable bslmt::Mutex    d_lock;            // serializes modifications of
+                                               // the cache
 
     bslma::Allocator       *d_allocator_p;     // memory allocator (held, not
                                                // owned)
 
-  private:
-    // PRIVATE TYPES
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::iterator CacheIterator;
-
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::const_iterator
-                                                            ConstCacheIterator;
+    // PRIVATE MANIPULATORS
+    void insertEntry(const char                 *calendarName,
+                     const CalendarCache_Entry&  entry);
+        // Publish a snapshot of this cache that additionally holds the
+        // specified 'entry' for the specified 'calendarName'.  The behavior is
+        // undefined unless 'd_lock' is held by the calling thread and
+        // 'calendarName' is not in the cache.
+
+    // PRIVATE ACCESSORS
+    bool isExpired(const CalendarCache_Entry& entry) const;
+        // Return 'true' if the specified 'entry' has expired per the timeout
+        // of this cache, and 'false' otherwise.
+
+    int lookupEntry(bsl::shared_ptr<const Calendar> *calendar,
+                    Datetime                        *loadTime,
+                    const char                      *calendarName) const;
+        // Without acquiring a lock, look up the calendar having the specified
+        // 'calendarName' in this cache.  If the calendar is present and has
+        // not expired, load a reference to it into the specified 'calendar'
+        // (unless 'calendar' is 0), load its load time into the specified
+        // 'loadTime' (unless 'loadTime' is 0), and return 0.  Return a
+        // positive value if the calendar is definitely not in the cache, and
+        // a negative value if the caller must repeat the look-up while holding
+        // 'd_lock' (i.e., the calendar has expired, or the current snapshot
+        // could not be protected).
+
+    void publish(CalendarCache_Snapshot *snapshot) const;
+        // Make the specified 'snapshot' (which may be 0 to indicate an empty
+        // cache) the current contents of this cache, retire the previous
+        // snapshot, and free every retired snapshot that is no longer in use
+        // by a reader.  The behavior is undefined unless 'd_lock' is held by
+        // the calling thread and 'd_retired' has capacity for one more
+        // element.
+
+    void removeEntry(const char *calendarName) const;
+        // Publish a snapshot of this cache that does not hold the calendar
+        // having the specified 'calendarName'.  The behavior is undefined
+        // unless 'd_lock' is held by the calling thread and 'calendarName' is
+        // in the cache.
 
   private:
     // NOT IMPLEMENTED
@@ -80,11 +80,12 @@ using namespace bsl;
 // [ 3] Datetime lookupLoadTime(const char *name) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ 5] CONCERN: All memory allocation is exception neutral.
 // [ 6] CONCERN: All manipulators and accessors are thread-safe.
+// [ 7] CONCERN: Lock-free look-ups are safe during modifications.
 // [-1] CONCERN: A non-trivial timeout is processed correctly.
 
 // ============================================================================
@@ -652,6 +653,81 @@ extern "C" void *threadFunction3(void *arg)
 
 }  // close namespace TestCase6
 
+namespace TestCase7 {
+
+struct ThreadInfo {
+    int  d_numIterations;
+    Obj *d_cache_p;
+};
+
+extern "C" void *readerThread(void *arg)
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;  const Obj& X = mX;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        {
+            Entry e = X.lookupCalendar("CAL-1");
+            if (e.get()) {
+                ASSERT(e->firstDate() == gFirstDate1);
+            }
+        }
+
+        {
+            Entry e = mX.getCalendar("CAL-2");
+            ASSERT(e.get());
+            if (e.get()) {
+                ASSERT(e->firstDate() == gFirstDate2);
+            }
+        }
+
+        {
+            Entry e = X.lookupCalendar("CAL-3");
+            if (e.get()) {
+                ASSERT(e->firstDate() == gFirstDate3);
+            }
+        }
+
+        {
+            Entry e = X.lookupCalendar("CAL-Z");
+            ASSERT(!e.get());
+        }
+
+        {
+            const Datetime loadTime = X.lookupLoadTime("CAL-1");
+            ASSERT(loadTime <= bdlt::CurrentTime::utc());
+        }
+    }
+
+    return 0;
+}
+
+extern "C" void *writerThread(void *arg)
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        Entry e1 = mX.getCalendar("CAL-1");
+        ASSERT(e1.get());
+
+        Entry e3 = mX.getCalendar("CAL-3");
+        ASSERT(e3.get());
+
+        ASSERT(1 == mX.invalidate("CAL-1"));
+
+        if (0 == i % 4) {
+            mX.invalidateAll();
+        }
+    }
+
+    return 0;
+}
+
+}  // close namespace TestCase7
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -737,7 +813,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -951,6 +1027,76 @@ int main(int argc, char *argv[])
 //..
         }
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE LOOK-UPS DURING MODIFICATIONS
+        //   Ensure that calendars found without acquiring a lock remain valid
+        //   while other threads modify the cache.
+        //
+        // Concerns:
+        //: 1 A calendar returned by 'getCalendar' or 'lookupCalendar' is the
+        //:   calendar having the requested name, even when other threads
+        //:   concurrently load and invalidate calendars.
+        //:
+        //: 2 When more threads read the cache than there are hazard slots,
+        //:   readers that find no free slot still obtain correct results.
+        //:
+        //: 3 Snapshots retired by modifications are eventually freed, and no
+        //:   memory is leaked.
+        //
+        // Plan:
+        //: 1 Create a cache without a timeout, and start 24 reader threads
+        //:   that repeatedly fetch calendars using 'getCalendar',
+        //:   'lookupCalendar', and 'lookupLoadTime', and verify each result.
+        //:   Concurrently, run a writer thread that repeatedly loads and
+        //:   invalidates calendars.  (C-1..2)
+        //:
+        //: 2 Verify that no memory from the supplied allocator is in use once
+        //:   the cache has been destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Lock-free look-ups are safe during modifications.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK-FREE LOOK-UPS DURING MODIFICATIONS" << endl
+                          << "=======================================" << endl;
+
+        using namespace TestCase7;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { k_NUM_READERS = 24 };
+
+        {
+            Obj mX(&loader, &sa);
+
+            ThreadInfo readerInfo = { 2000, &mX };
+            ThreadInfo writerInfo = {  500, &mX };
+
+            ThreadId readers[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                readers[i] = createThread(&readerThread, &readerInfo);
+            }
+
+            ThreadId writer = createThread(&writerThread, &writerInfo);
+
+            joinThread(writer);
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                joinThread(readers[i]);
+            }
+        }
+
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
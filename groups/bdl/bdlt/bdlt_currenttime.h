@@ -17,6 +17,21 @@ BSLS_IDENT("$Id: $")
 // the local time zone of the executing process.  It also provides a facility
 // for customizing the means by which the time is retrieved.
 //
+///Performance
+///-----------
+// Converting the current time to a 'bdlt::Datetime' (e.g., by 'utc') requires
+// only integer arithmetic on the number of microseconds since the epoch; the
+// calendar date is not decomposed into year, month, and day until requested.
+// The cost of these functions is therefore dominated by reading the system
+// clock.  Applications that read the current time very frequently and require
+// only millisecond precision (e.g., for timestamping log records) can reduce
+// that cost by installing 'bsls::SystemTime::nowCoarseRealtimeClock' as the
+// current-time callback:
+//..
+//  bdlt::CurrentTime::setCurrentTimeCallback(
+//                                 &bsls::SystemTime::nowCoarseRealtimeClock);
+//..
+//
 ///Thread Safety
 ///-------------
 // The functions provided by 'bdlt::CurrentTime' are *thread-safe* (meaning
@@ -0,0 +1,223 @@
+// bdlt_fixedformatimputil.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLT_FIXEDFORMATIMPUTIL
+#define INCLUDED_BDLT_FIXEDFORMATIMPUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities for matching fixed-width datetime layouts.
+//
+//@CLASSES:
+//  bdlt::FixedFormatImpUtil: namespace for fixed-width layout matching
+//
+//@SEE_ALSO: bdlt_iso8601util, bdlt_fixutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlt::FixedFormatImpUtil', that implements the fast path shared by the
+// parsers of 'bdlt_iso8601util' and 'bdlt_fixutil' for datetimes in one of a
+// small set of canonical fixed-width layouts.  Each parser defines a table of
+// 'FixedFormatImpUtil::Format' objects describing its layouts, selects the
+// layout of an input by its length ('findFormat'), and then validates the
+// input against the pattern of that layout, and extracts the values of its
+// digits, eight characters at a time ('loadDigits').
+//
+// This component is intended for use only by 'bdlt_iso8601util' and
+// 'bdlt_fixutil'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Fixed-Width Time
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we want to parse times in the layouts "hh:mm" and "hh:mm:ss".
+// First, we define a table describing the layouts:
+//..
+//  static const bdlt::FixedFormatImpUtil::Format FORMATS[] = {
+//      {  5, 0, 0, "00:00"    },
+//      {  8, 0, 0, "00:00:00" },
+//  };
+//  const int NUM_FORMATS = static_cast<int>(sizeof FORMATS / sizeof *FORMATS);
+//..
+// Then, we find the layout of an input by its length:
+//..
+//  const char *input  = "12:34:56";
+//  const int   length = 8;
+//
+//  const bdlt::FixedFormatImpUtil::Format *format =
+//         bdlt::FixedFormatImpUtil::findFormat(FORMATS, NUM_FORMATS, length);
+//  assert(format == FORMATS + 1);
+//..
+// Next, we copy the input into a buffer of the required size, so that the
+// characters past its end are 0:
+//..
+//  char buffer[bdlt::FixedFormatImpUtil::k_MAX_LENGTH] = { 0 };
+//  bsl::memcpy(buffer, input, length);
+//..
+// Finally, we match the buffer against the pattern of the layout, and compute
+// the values of the fields from the digits:
+//..
+//  unsigned char d[bdlt::FixedFormatImpUtil::k_MAX_LENGTH];
+//
+//  assert(bdlt::FixedFormatImpUtil::loadDigits(d,
+//                                              buffer,
+//                                              format->d_pattern,
+//                                              length));
+//  assert(12 == d[0] * 10 + d[1]);
+//  assert(34 == d[3] * 10 + d[4]);
+//  assert(56 == d[6] * 10 + d[7]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlt {
+
+                         // =========================
+                         // struct FixedFormatImpUtil
+                         // =========================
+
+struct FixedFormatImpUtil {
+    // This 'struct' provides a namespace for utilities that match datetimes
+    // against canonical fixed-width layouts.
+
+    // TYPES
+    enum { k_MAX_LENGTH = 40 };  // capacity (a multiple of 8) of the buffers
+                                 // compared by 'loadDigits'
+
+    struct Format {
+        // This 'struct' describes one of the canonical fixed-width layouts of
+        // a datetime.
+
+        int  d_length;                 // length of the layout
+        int  d_fractionLength;         // number of fractional-second digits
+                                       // (0, 3, or 6)
+        char d_zone;                   // 0 (none), 'Z', or '+' (offset)
+        char d_pattern[k_MAX_LENGTH];  // '0' for each digit, and the
+                                       // canonical character elsewhere
+    };
+
+    // CLASS METHODS
+    static const Format *findFormat(const Format *formats,
+                                    int           numFormats,
+                                    int           length);
+        // Return the address of the first of the specified 'numFormats'
+        // elements of the specified 'formats' array whose length is the
+        // specified 'length', or 0 if there is no such element.
+
+    static bool loadDigits(unsigned char *digits,
+                           const char    *buffer,
+                           const char    *pattern,
+                           int            length);
+        // Compare the first specified 'length' characters (rounded up to a
+        // multiple of 8) of the specified 'buffer' with those of the
+        // specified 'pattern', in which each '0' stands for any decimal digit
+        // and every other character must match exactly.  If they match, load
+        // into each element of the specified 'digits' array the numeric value
+        // of the corresponding digit of 'buffer' (or 0 for positions that are
+        // not digits) and return 'true'; otherwise, return 'false' with
+        // 'digits' in an unspecified state.  The behavior is undefined unless
+        // '0 < length <= k_MAX_LENGTH' and each of 'digits', 'buffer', and
+        // 'pattern' has at least 'k_MAX_LENGTH' elements.  Note that the
+        // comparison is performed eight characters at a time using arithmetic
+        // on 64-bit words, and does not depend on the byte order of the
+        // platform.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct FixedFormatImpUtil
+                         // -------------------------
+
+// CLASS METHODS
+inline
+const FixedFormatImpUtil::Format *
+FixedFormatImpUtil::findFormat(const Format *formats,
+                               int           numFormats,
+                               int           length)
+{
+    BSLS_ASSERT(formats || 0 == numFormats);
+
+    for (int i = 0; i < numFormats; ++i) {
+        if (length == formats[i].d_length) {
+            return formats + i;                                       // RETURN
+        }
+    }
+    return 0;
+}
+
+inline
+bool FixedFormatImpUtil::loadDigits(unsigned char *digits,
+                                    const char    *buffer,
+                                    const char    *pattern,
+                                    int            length)
+{
+    BSLS_ASSERT(digits);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(pattern);
+    BSLS_ASSERT(0 < length && length <= k_MAX_LENGTH);
+
+    typedef bsls::Types::Uint64 Word;
+
+    const Word k_ONES  = 0x0101010101010101ULL;
+    const Word k_LOW7  = k_ONES * 0x7F;
+    const Word k_HIGH  = k_ONES * 0x80;
+    const Word k_ZEROS = k_ONES * '0';
+
+    Word invalid = 0;
+
+    for (int i = 0; i < length; i += static_cast<int>(sizeof(Word))) {
+        Word input, expected;
+        bsl::memcpy(&input,    buffer  + i, sizeof input);
+        bsl::memcpy(&expected, pattern + i, sizeof expected);
+
+        // 'value' holds the value of each digit at the positions of a '0' in
+        // 'pattern', and is 0 wherever 'input' matches any other character.
+        // Each of the masks below has the high bit of a byte set if the
+        // indicated condition holds for that byte (the low 7 bits of each
+        // byte are masked before adding so that no carry crosses a byte).
+
+        const Word value = input ^ expected;
+        const Word fixed = expected ^ k_ZEROS;
+
+        const Word isFixed   = (((fixed & k_LOW7) + k_LOW7) | fixed) & k_HIGH;
+        const Word isNonZero = (((value & k_LOW7) + k_LOW7) | value) & k_HIGH;
+        const Word isAbove9  = (((value & k_LOW7) + k_LOW7 - k_ONES * 9)
+                                                             | value) & k_HIGH;
+
+        invalid |= (isFixed & isNonZero) | (~isFixed & isAbove9);
+
+        bsl::memcpy(digits + i, &value, sizeof value);
+    }
+
+    return 0 == invalid;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
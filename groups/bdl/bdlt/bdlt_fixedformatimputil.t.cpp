@@ -0,0 +1,440 @@
+// bdlt_fixedformatimputil.t.cpp                                      -*-C++-*-
+#include <bdlt_fixedformatimputil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a utility 'struct' providing two pure
+// functions: 'findFormat', a linear search of a table by length, and
+// 'loadDigits', which compares a buffer with a pattern eight characters at a
+// time.  'loadDigits' is verified against a straightforward character-by-
+// character oracle, for every byte value at every position of a set of
+// patterns.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] const Format *findFormat(const Format *, int, int);
+// [ 2] bool loadDigits(unsigned char *, const char *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBALS, TYPEDEFS, CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::FixedFormatImpUtil Util;
+
+const int k_MAX_LENGTH = Util::k_MAX_LENGTH;
+
+static
+bool oracleLoadDigits(unsigned char *digits,
+                      const char    *buffer,
+                      const char    *pattern,
+                      int            length)
+    // Return the result that 'Util::loadDigits' is specified to return for
+    // the specified 'buffer', 'pattern', and 'length', and, if that result is
+    // 'true', load into the specified 'digits' the values it is specified to
+    // load.  The comparison is made one character at a time.
+{
+    const int end = (length + 7) / 8 * 8;
+
+    for (int i = 0; i < end; ++i) {
+        if ('0' == pattern[i]) {
+            if (buffer[i] < '0' || '9' < buffer[i]) {
+                return false;                                         // RETURN
+            }
+            digits[i] = static_cast<unsigned char>(buffer[i] - '0');
+        }
+        else {
+            if (buffer[i] != pattern[i]) {
+                return false;                                         // RETURN
+            }
+            digits[i] = 0;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Fixed-Width Time
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we want to parse times in the layouts "hh:mm" and "hh:mm:ss".
+// First, we define a table describing the layouts:
+//..
+    static const bdlt::FixedFormatImpUtil::Format FORMATS[] = {
+        {  5, 0, 0, "00:00"    },
+        {  8, 0, 0, "00:00:00" },
+    };
+    const int NUM_FORMATS = static_cast<int>(sizeof FORMATS / sizeof *FORMATS);
+//..
+// Then, we find the layout of an input by its length:
+//..
+    const char *input  = "12:34:56";
+    const int   length = 8;
+
+    const bdlt::FixedFormatImpUtil::Format *format =
+           bdlt::FixedFormatImpUtil::findFormat(FORMATS, NUM_FORMATS, length);
+    ASSERT(format == FORMATS + 1);
+//..
+// Next, we copy the input into a buffer of the required size, so that the
+// characters past its end are 0:
+//..
+    char buffer[bdlt::FixedFormatImpUtil::k_MAX_LENGTH] = { 0 };
+    bsl::memcpy(buffer, input, length);
+//..
+// Finally, we match the buffer against the pattern of the layout, and compute
+// the values of the fields from the digits:
+//..
+    unsigned char d[bdlt::FixedFormatImpUtil::k_MAX_LENGTH];
+
+    ASSERT(bdlt::FixedFormatImpUtil::loadDigits(d,
+                                                buffer,
+                                                format->d_pattern,
+                                                length));
+    ASSERT(12 == d[0] * 10 + d[1]);
+    ASSERT(34 == d[3] * 10 + d[4]);
+    ASSERT(56 == d[6] * 10 + d[7]);
+//..
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigits'
+        //
+        // Concerns:
+        //: 1 A buffer matching the pattern, with any decimal digit at each
+        //:   '0' of the pattern, is accepted, and the value of each digit is
+        //:   loaded (and 0 at each other position).
+        //:
+        //: 2 A buffer having any character other than a decimal digit at a
+        //:   '0' of the pattern, or any character other than that of the
+        //:   pattern at another position, is rejected, whatever the value of
+        //:   the character (including those having the high bit set).
+        //:
+        //: 3 The comparison extends to the end of the 8-character word that
+        //:   contains the last character.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of patterns, including each length from 1 to
+        //:   'k_MAX_LENGTH', and for each position up to the end of the last
+        //:   word, replace the character of a matching buffer at that
+        //:   position with each of the 256 character values, and verify that
+        //:   the result, and the digits loaded, are those of a character-by-
+        //:   character oracle.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   bool loadDigits(unsigned char *, const char *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadDigits'" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_pattern;
+        } DATA[] = {
+            //LINE  PATTERN
+            //----  -------
+            { L_,   "0"                                        },
+            { L_,   "-"                                        },
+            { L_,   "00:00"                                    },
+            { L_,   "0000000"                                  },
+            { L_,   "00000000"                                 },
+            { L_,   "000000000"                                },
+            { L_,   "00000000-00:00:00"                        },
+            { L_,   "00000000-00:00:00.000000+00:00"           },
+            { L_,   "0000-00-00T00:00:00"                      },
+            { L_,   "0000-00-00T00:00:00.000Z"                 },
+            { L_,   "0000-00-00T00:00:00.000000+00:00"         },
+            { L_,   "T0.0Z+0-0:0T0.0Z+0-0:0T0.0Z+0-0:0T0.0Z+0" },
+            { L_,   "0000000000000000000000000000000000000000" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE   = DATA[ti].d_line;
+            const int LENGTH = static_cast<int>(
+                                              bsl::strlen(DATA[ti].d_pattern));
+            const int END    = (LENGTH + 7) / 8 * 8;
+
+            ASSERTV(LINE, LENGTH <= k_MAX_LENGTH);
+
+            char pattern[k_MAX_LENGTH] = { 0 };
+            bsl::memcpy(pattern, DATA[ti].d_pattern, LENGTH);
+
+            if (veryVerbose) { T_ P_(LINE) P(DATA[ti].d_pattern) }
+
+            // A matching buffer has a digit, which differs from position to
+            // position, at each '0' of the pattern.
+
+            char match[k_MAX_LENGTH] = { 0 };
+            for (int i = 0; i < LENGTH; ++i) {
+                match[i] = '0' == pattern[i]
+                           ? static_cast<char>('0' + (i * 7 + 3) % 10)
+                           : pattern[i];
+            }
+
+            for (int pos = 0; pos < END; ++pos) {
+                for (int c = 0; c < 256; ++c) {
+                    char buffer[k_MAX_LENGTH];
+                    bsl::memcpy(buffer, match, sizeof buffer);
+                    buffer[pos] = static_cast<char>(c);
+
+                    unsigned char expected[k_MAX_LENGTH];
+                    unsigned char digits[k_MAX_LENGTH];
+
+                    const bool EXP = oracleLoadDigits(expected,
+                                                      buffer,
+                                                      pattern,
+                                                      LENGTH);
+                    const bool RES = Util::loadDigits(digits,
+                                                      buffer,
+                                                      pattern,
+                                                      LENGTH);
+
+                    ASSERTV(LINE, pos, c, EXP, RES, EXP == RES);
+
+                    if (EXP && RES) {
+                        ASSERTV(LINE, pos, c,
+                                0 == bsl::memcmp(expected, digits, END));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char          buffer[k_MAX_LENGTH]  = { 0 };
+            char          pattern[k_MAX_LENGTH] = { 0 };
+            unsigned char digits[k_MAX_LENGTH];
+
+            ASSERT_PASS(Util::loadDigits(digits, buffer, pattern, 1));
+            ASSERT_PASS(Util::loadDigits(digits,
+                                         buffer,
+                                         pattern,
+                                         k_MAX_LENGTH));
+
+            ASSERT_FAIL(Util::loadDigits(digits, buffer, pattern, 0));
+            ASSERT_FAIL(Util::loadDigits(digits,
+                                         buffer,
+                                         pattern,
+                                         k_MAX_LENGTH + 1));
+
+            ASSERT_FAIL(Util::loadDigits(     0, buffer, pattern, 1));
+            ASSERT_FAIL(Util::loadDigits(digits,      0, pattern, 1));
+            ASSERT_FAIL(Util::loadDigits(digits, buffer,       0, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING 'findFormat'
+        //
+        // Concerns:
+        //: 1 The address of the first format having the supplied length is
+        //:   returned.
+        //:
+        //: 2 0 is returned if no format has the supplied length, including
+        //:   for an empty table.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Search a table, in which two formats have the same length, for
+        //:   each length from -1 to 'k_MAX_LENGTH + 1', and verify the result
+        //:   against a linear search.  Search an empty table.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   const Format *findFormat(const Format *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findFormat'" << endl
+                          << "====================" << endl;
+
+        static const Util::Format FORMATS[] = {
+            { 19, 0,   0, "0000-00-00T00:00:00"              },
+            { 20, 0, 'Z', "0000-00-00T00:00:00Z"             },
+            {  5, 0,   0, "00:00"                            },
+            { 20, 0, 'X', "0000-00-00T00:00:00X"             },
+            { 32, 6, '+', "0000-00-00T00:00:00.000000+00:00" },
+        };
+        const int NUM_FORMATS = static_cast<int>(
+                                             sizeof FORMATS / sizeof *FORMATS);
+
+        for (int length = -1; length <= k_MAX_LENGTH + 1; ++length) {
+            const Util::Format *EXPECTED = 0;
+            for (int i = 0; i < NUM_FORMATS; ++i) {
+                if (length == FORMATS[i].d_length) {
+                    EXPECTED = FORMATS + i;
+                    break;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(length) P(EXPECTED) }
+
+            ASSERTV(length,
+                    EXPECTED == Util::findFormat(FORMATS,
+                                                 NUM_FORMATS,
+                                                 length));
+            ASSERTV(length, 0 == Util::findFormat(FORMATS, 0, length));
+            ASSERTV(length, 0 == Util::findFormat(0, 0, length));
+        }
+
+        ASSERT(FORMATS + 1 == Util::findFormat(FORMATS, NUM_FORMATS, 20));
+        ASSERT(0           == Util::findFormat(FORMATS, 1, 20));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::findFormat(FORMATS, NUM_FORMATS, 1));
+            ASSERT_PASS(Util::findFormat(      0,           0, 1));
+            ASSERT_FAIL(Util::findFormat(      0,           1, 1));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -9,9 +9,12 @@ BSLS_IDENT_RCSID(bdlt_fixutil_cpp,"$Id$ $CSID$")
 #include <bdlt_datetimeinterval.h>
 #include <bdlt_datetimetz.h>
 #include <bdlt_datetz.h>
+#include <bdlt_fixedformatimputil.h>
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -374,6 +377,126 @@ int parseTime(const char **nextPos,
     return 0;
 }
 
+// FIXED-WIDTH PARSING
+
+// The canonical fixed-width layouts of a FIX datetime that 'parse'
+// recognizes by length (see 'parseFixedFormatDatetimeTz').
+
+static const FixedFormatImpUtil::Format k_FIXED_FORMATS[] = {
+    { 17, 0,   0, "00000000-00:00:00"              },
+    { 18, 0, 'Z', "00000000-00:00:00Z"             },
+    { 23, 0, '+', "00000000-00:00:00+00:00"        },
+    { 21, 3,   0, "00000000-00:00:00.000"          },
+    { 22, 3, 'Z', "00000000-00:00:00.000Z"         },
+    { 27, 3, '+', "00000000-00:00:00.000+00:00"    },
+    { 24, 6,   0, "00000000-00:00:00.000000"       },
+    { 25, 6, 'Z', "00000000-00:00:00.000000Z"      },
+    { 30, 6, '+', "00000000-00:00:00.000000+00:00" },
+};
+
+static
+bool parseFixedFormatDatetimeTz(DatetimeTz *result,
+                                const char *string,
+                                int         length)
+    // If the specified 'string' having the specified 'length' is a valid FIX
+    // datetime in one of the canonical fixed-width layouts
+    // "YYYYMMDD-hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}", load into the specified
+    // 'result' the value that the general parsing functions of this component
+    // would load, and return 'true'; otherwise, return 'false' with no effect.
+    // Note that 'false' is also returned for a valid string that the general
+    // parser must handle (e.g., one denoting a leap second).
+{
+    const int k_NUM_FIXED_FORMATS = static_cast<int>(
+                             sizeof k_FIXED_FORMATS / sizeof *k_FIXED_FORMATS);
+
+    const FixedFormatImpUtil::Format *format = FixedFormatImpUtil::findFormat(
+                                                           k_FIXED_FORMATS,
+                                                           k_NUM_FIXED_FORMATS,
+                                                           length);
+
+    if (!format) {
+        return false;                                                 // RETURN
+    }
+
+    // Copy the input, then replace a '-' sign of the timezone offset with
+    // '+', so that the input can be compared with a single pattern.
+
+    char buffer[FixedFormatImpUtil::k_MAX_LENGTH] = { 0 };
+    bsl::memcpy(buffer, string, length);
+
+    enum { k_FRACTION_POS = 17 };
+
+    const int zonePos = k_FRACTION_POS
+                      + (format->d_fractionLength
+                         ? format->d_fractionLength + 1
+                         : 0);
+
+    bool negativeOffset = false;
+    if ('+' == format->d_zone && '-' == buffer[zonePos]) {
+        buffer[zonePos] = '+';
+        negativeOffset  = true;
+    }
+
+    unsigned char d[FixedFormatImpUtil::k_MAX_LENGTH];
+
+    if (!FixedFormatImpUtil::loadDigits(d,
+                                        buffer,
+                                        format->d_pattern,
+                                        length)) {
+        return false;                                                 // RETURN
+    }
+
+    const int year   = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    const int month  = d[4] * 10 + d[5];
+    const int day    = d[6] * 10 + d[7];
+    const int hour   = d[9] * 10 + d[10];
+    const int minute = d[12] * 10 + d[13];
+    const int second = d[15] * 10 + d[16];
+
+    int fraction = 0;  // in microseconds
+    for (int i = 0; i < format->d_fractionLength; ++i) {
+        fraction = fraction * 10 + d[k_FRACTION_POS + 1 + i];
+    }
+    if (3 == format->d_fractionLength) {
+        fraction *= 1000;
+    }
+
+    int tzOffset = 0;
+    if ('+' == format->d_zone) {
+        const int offsetHour   = d[zonePos + 1] * 10 + d[zonePos + 2];
+        const int offsetMinute = d[zonePos + 4] * 10 + d[zonePos + 5];
+
+        if (offsetHour >= 24 || offsetMinute > 59) {
+            return false;                                             // RETURN
+        }
+
+        tzOffset = offsetHour * 60 + offsetMinute;
+        if (negativeOffset) {
+            tzOffset = -tzOffset;
+        }
+    }
+
+    // Leap seconds, and the invalid hour 24, are left to the general parser.
+
+    Date date;
+    Time time;
+
+    if (hour >= 24
+     || second >= 60
+     || 0 != date.setYearMonthDayIfValid(year, month, day)
+     || 0 != time.setTimeIfValid(hour,
+                                 minute,
+                                 second,
+                                 fraction / 1000,
+                                 fraction % 1000)) {
+        return false;                                                 // RETURN
+    }
+
+    result->setDatetimeTz(Datetime(date, time), tzOffset);
+
+    return true;
+}
+
 static
 int generateInt(char *buffer, int value, int paddedLen)
     // Write, to the specified 'buffer', the decimal string representation of
@@ -899,11 +1022,14 @@ int FixUtil::generateRaw(char                        *buffer,
 {
     BSLS_ASSERT(buffer);
 
+    int year, month, day;
+    object.getYearMonthDay(&year, &month, &day);
+
     char *p = buffer;
 
-    p += generateInt(p, object.year() , 4);
-    p += generateInt(p, object.month(), 2);
-    p += generateInt(p, object.day()  , 2);
+    p += generateInt(p, year , 4);
+    p += generateInt(p, month, 2);
+    p += generateInt(p, day  , 2);
 
     return static_cast<int>(p - buffer);
 }
@@ -950,15 +1076,20 @@ int FixUtil::generateRaw(char                        *buffer,
 
     char *p = buffer + dateLen + 1;
 
-    p += generateInt(p, 24 > object.hour() ? object.hour() : 0, 2, ':');
-    p += generateInt(p, object.minute(), 2, ':');
+    // Decompose the time of day once, rather than once per field.
+
+    int hour, minute, second, millisecond, microsecond;
+    object.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    p += generateInt(p, 24 > hour ? hour : 0, 2, ':');
+    p += generateInt(p, minute, 2, ':');
 
     int precision = configuration.fractionalSecondPrecision();
 
     if (precision) {
-        p += generateInt(p, object.second(), 2, '.');
+        p += generateInt(p, second, 2, '.');
 
-        int value = object.millisecond() * 1000 + object.microsecond();
+        int value = millisecond * 1000 + microsecond;
 
         for (int i = 6; i > precision; --i) {
             value /= 10;
@@ -967,7 +1098,7 @@ int FixUtil::generateRaw(char                        *buffer,
         p += generateInt(p, value, precision);
     }
     else {
-        p += generateInt(p, object.second(), 2);
+        p += generateInt(p, second, 2);
     }
 
     return static_cast<int>(p - buffer);
@@ -1231,6 +1362,14 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
         return -1;                                                    // RETURN
     }
 
+    // Valid strings in the canonical fixed-width layouts (e.g., those produced
+    // by 'generate' with a fractional-second precision of 3 or 6) are parsed
+    // without the general parser.
+
+    if (parseFixedFormatDatetimeTz(result, string, length)) {
+        return 0;                                                     // RETURN
+    }
+
     const char *p   = string;
     const char *end = string + length;
 
@@ -138,6 +138,13 @@ BSLS_IDENT("$Id: $")
 // specified in all types, which is in contradiction to some of the types in
 // the referenced FIX protocol specification.
 //
+// The 'parse' functions for 'Datetime' and 'DatetimeTz' recognize, by their
+// length, strings in the fixed-width layouts produced by 'generate' with a
+// fractional-second precision of 0, 3, or 6 (e.g., "20050131-08:59:59.123"),
+// and parse them without the general parser, validating all of their digits
+// and separators a machine word at a time.  Strings in any other layout are
+// handled by the general parser.  The result is the same in either case.
+//
 ///Timezone Offsets
 /// - - - - - - - -
 // The timezone offset is optional, and can be present when parsing for *any*
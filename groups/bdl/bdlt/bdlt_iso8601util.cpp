@@ -9,9 +9,12 @@ BSLS_IDENT_RCSID(bdlt_iso8601util_cpp,"$Id$ $CSID$")
 #include <bdlt_datetimeinterval.h>
 #include <bdlt_datetimetz.h>
 #include <bdlt_datetz.h>
+#include <bdlt_fixedformatimputil.h>
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -323,6 +326,143 @@ int parseTime(const char         **nextPos,
     return 0;
 }
 
+// FIXED-WIDTH PARSING
+
+// The canonical fixed-width layouts of an ISO 8601 datetime that 'parse'
+// recognizes by length (see 'lexFixedFormatDatetimeTz').
+
+static const FixedFormatImpUtil::Format k_FIXED_FORMATS[] = {
+    { 19, 0,   0, "0000-00-00T00:00:00"              },
+    { 20, 0, 'Z', "0000-00-00T00:00:00Z"             },
+    { 25, 0, '+', "0000-00-00T00:00:00+00:00"        },
+    { 23, 3,   0, "0000-00-00T00:00:00.000"          },
+    { 24, 3, 'Z', "0000-00-00T00:00:00.000Z"         },
+    { 29, 3, '+', "0000-00-00T00:00:00.000+00:00"    },
+    { 26, 6,   0, "0000-00-00T00:00:00.000000"       },
+    { 27, 6, 'Z', "0000-00-00T00:00:00.000000Z"      },
+    { 32, 6, '+', "0000-00-00T00:00:00.000000+00:00" },
+};
+
+static
+bool lexFixedFormatDatetimeTz(int                *year,
+                              int                *month,
+                              int                *day,
+                              int                *hour,
+                              int                *minute,
+                              int                *second,
+                              int                *millisecond,
+                              bsls::Types::Int64 *microsecond,
+                              bool               *hasLeapSecond,
+                              int                *tzOffset,
+                              const char         *string,
+                              int                 length)
+    // If the specified 'string' having the specified 'length' is in one of the
+    // canonical fixed-width layouts "YYYY-MM-DDThh:mm:ss{.fff|.ffffff}{Z|
+    // (+|-)hh:mm}" (allowing the alternative characters 't', ',', and 'z'),
+    // load the values of its fields into the specified 'year', 'month',
+    // 'day', 'hour', 'minute', 'second', 'millisecond', 'microsecond',
+    // 'hasLeapSecond', and 'tzOffset' exactly as the general parsing
+    // functions of this component would, and return 'true'; otherwise, return
+    // 'false' with no effect.  Note that the values are not validated beyond
+    // their syntax (except for the zone designator), and that 'false' is also
+    // returned for a syntactically valid string that the general parser must
+    // handle.
+{
+    const int k_NUM_FIXED_FORMATS = static_cast<int>(
+                             sizeof k_FIXED_FORMATS / sizeof *k_FIXED_FORMATS);
+
+    const FixedFormatImpUtil::Format *format = FixedFormatImpUtil::findFormat(
+                                                           k_FIXED_FORMATS,
+                                                           k_NUM_FIXED_FORMATS,
+                                                           length);
+
+    if (!format) {
+        return false;                                                 // RETURN
+    }
+
+    // Copy the input, then replace each character for which ISO 8601 allows
+    // alternatives with its canonical form, so that the input can be compared
+    // with a single pattern.
+
+    char buffer[FixedFormatImpUtil::k_MAX_LENGTH] = { 0 };
+    bsl::memcpy(buffer, string, length);
+
+    enum { k_T_POS = 10, k_FRACTION_POS = 19 };
+
+    const int zonePos = k_FRACTION_POS
+                      + (format->d_fractionLength
+                         ? format->d_fractionLength + 1
+                         : 0);
+
+    if ('t' == buffer[k_T_POS]) {
+        buffer[k_T_POS] = 'T';
+    }
+    if (format->d_fractionLength && ',' == buffer[k_FRACTION_POS]) {
+        buffer[k_FRACTION_POS] = '.';
+    }
+
+    bool negativeOffset = false;
+    if ('Z' == format->d_zone && 'z' == buffer[zonePos]) {
+        buffer[zonePos] = 'Z';
+    }
+    else if ('+' == format->d_zone && '-' == buffer[zonePos]) {
+        buffer[zonePos] = '+';
+        negativeOffset  = true;
+    }
+
+    unsigned char d[FixedFormatImpUtil::k_MAX_LENGTH];
+
+    if (!FixedFormatImpUtil::loadDigits(d,
+                                        buffer,
+                                        format->d_pattern,
+                                        length)) {
+        return false;                                                 // RETURN
+    }
+
+    int offset = 0;
+    if ('+' == format->d_zone) {
+        const int offsetHour   = d[zonePos + 1] * 10 + d[zonePos + 2];
+        const int offsetMinute = d[zonePos + 4] * 10 + d[zonePos + 5];
+
+        if (offsetHour >= 24 || offsetMinute > 59) {
+            return false;                                             // RETURN
+        }
+
+        offset = offsetHour * 60 + offsetMinute;
+        if (negativeOffset) {
+            offset = -offset;
+        }
+    }
+
+    int fraction = 0;  // in microseconds
+    for (int i = 0; i < format->d_fractionLength; ++i) {
+        fraction = fraction * 10 + d[k_FRACTION_POS + 1 + i];
+    }
+    if (3 == format->d_fractionLength) {
+        fraction *= 1000;
+    }
+
+    *year        = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    *month       = d[5] * 10 + d[6];
+    *day         = d[8] * 10 + d[9];
+    *hour        = d[11] * 10 + d[12];
+    *minute      = d[14] * 10 + d[15];
+    *second      = d[17] * 10 + d[18];
+    *millisecond = fraction / 1000;
+    *microsecond = fraction % 1000;
+    *tzOffset    = offset;
+
+    if (60 == *second) {
+        *hasLeapSecond = true;
+        *second        = 59;
+    }
+    else {
+        *hasLeapSecond = false;
+    }
+
+    return true;
+}
+
 static
 int parseZoneDesignator(const char **nextPos,
                         int         *minuteOffset,
@@ -1109,11 +1249,14 @@ int Iso8601Util::generateRaw(
 {
     BSLS_ASSERT(buffer);
 
+    int year, month, day;
+    object.getYearMonthDay(&year, &month, &day);
+
     char *p = buffer;
 
-    p += generateInt(p, object.year() , 4, '-');
-    p += generateInt(p, object.month(), 2, '-');
-    p += generateInt(p, object.day()  , 2     );
+    p += generateInt(p, year , 4, '-');
+    p += generateInt(p, month, 2, '-');
+    p += generateInt(p, day  , 2     );
 
     return static_cast<int>(p - buffer);
 }
@@ -1164,8 +1307,13 @@ int Iso8601Util::generateRaw(char                            *buffer,
 
     char *p = buffer + dateLen + 1;
 
-    p += generateInt(p, object.hour()       , 2, ':');
-    p += generateInt(p, object.minute()     , 2, ':');
+    // Decompose the time of day once, rather than once per field.
+
+    int hour, minute, second, millisecond, microsecond;
+    object.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    p += generateInt(p, hour  , 2, ':');
+    p += generateInt(p, minute, 2, ':');
 
     const char decimalSign = configuration.useCommaForDecimalSign()
                              ? ','
@@ -1174,9 +1322,9 @@ int Iso8601Util::generateRaw(char                            *buffer,
     int precision = configuration.fractionalSecondPrecision();
 
     if (precision) {
-        p += generateInt(p, object.second(), 2, decimalSign);
+        p += generateInt(p, second, 2, decimalSign);
 
-        int value = object.millisecond() * 1000 + object.microsecond();
+        int value = millisecond * 1000 + microsecond;
 
         for (int i = 6; i > precision; --i) {
             value /= 10;
@@ -1185,7 +1333,7 @@ int Iso8601Util::generateRaw(char                            *buffer,
         p += generateInt(p, value, precision);
     }
     else {
-        p += generateInt(p, object.second(), 2);
+        p += generateInt(p, second, 2);
     }
 
     return static_cast<int>(p - buffer);
@@ -1725,47 +1873,63 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
         return -1;                                                    // RETURN
     }
 
-    const char *p   = string;
-    const char *end = string + length;
-
-    // 1. Parse date.
-
-    int year, month, day;
-
-    if (0 != parseDate(&p, &year, &month, &day, p, end)
-     || p == end
-     || ('T' != *p && 't' != *p)) {
-
-        return -1;                                                    // RETURN
-    }
-    ++p;  // skip 'T' or 't'
-
-    // 2. Parse time.
-
+    int                year, month, day;
     int                hour, minute, second, millisecond;
     bsls::Types::Int64 microsecond;
     bool               hasLeapSecond;
+    int                tzOffset = 0;  // minutes from UTC
+
+    // Strings in the canonical fixed-width layouts (e.g., those produced by
+    // 'generate' with a fractional-second precision of 3 or 6) are lexed
+    // without the general parser; all others take steps 1 to 3.
+
+    if (!lexFixedFormatDatetimeTz(&year,
+                                  &month,
+                                  &day,
+                                  &hour,
+                                  &minute,
+                                  &second,
+                                  &millisecond,
+                                  &microsecond,
+                                  &hasLeapSecond,
+                                  &tzOffset,
+                                  string,
+                                  length)) {
+        const char *p   = string;
+        const char *end = string + length;
+
+        // 1. Parse date.
+
+        if (0 != parseDate(&p, &year, &month, &day, p, end)
+         || p == end
+         || ('T' != *p && 't' != *p)) {
 
-    if (0 != parseTime(&p,
-                       &hour,
-                       &minute,
-                       &second,
-                       &millisecond,
-                       &microsecond,
-                       &hasLeapSecond,
-                       p,
-                       end,
-                       1)) {
-        return -1;                                                    // RETURN
-    }
-
-    // 3. Parse zone designator, if any.
+            return -1;                                                // RETURN
+        }
+        ++p;  // skip 'T' or 't'
+
+        // 2. Parse time.
+
+        if (0 != parseTime(&p,
+                           &hour,
+                           &minute,
+                           &second,
+                           &millisecond,
+                           &microsecond,
+                           &hasLeapSecond,
+                           p,
+                           end,
+                           1)) {
+            return -1;                                                // RETURN
+        }
 
-    int tzOffset = 0;  // minutes from UTC
+        // 3. Parse zone designator, if any.
 
-    if (p != end) {
-        if (0 != parseZoneDesignator(&p, &tzOffset, p, end) || p != end) {
-            return -1;                                                // RETURN
+        if (p != end) {
+            if (0 != parseZoneDesignator(&p, &tzOffset, p, end)
+             || p != end) {
+                return -1;                                            // RETURN
+            }
         }
     }
 
@@ -145,6 +145,14 @@ BSLS_IDENT("$Id: $")
 // and treat '+00:00', '+0000', 'Z', and 'z' as equivalent zone designators
 // (all denoting UTC).
 //
+// The 'parse' functions for 'Datetime' and 'DatetimeTz' recognize, by their
+// length, strings in the fixed-width layouts produced by 'generate' with a
+// fractional-second precision of 0, 3, or 6 (e.g.,
+// "2005-01-31T08:59:59.123456+04:00"), and lex them without the general
+// parser, validating all of their digits and separators a machine word at a
+// time.  Strings in any other layout are handled by the general parser.  The
+// result is the same in either case.
+//
 ///Zone Designators
 /// - - - - - - - -
 // The zone designator is optional, and can be present when parsing for *any*
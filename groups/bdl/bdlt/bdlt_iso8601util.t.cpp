@@ -134,7 +134,8 @@ using namespace bsl;
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [12] CONCERN: fixed-width strings are parsed as by the general parser
+// [13] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -794,7 +795,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -991,6 +992,165 @@ if (veryVerbose)
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING FIXED-WIDTH PARSING
+        //   Strings in the canonical fixed-width layouts are parsed by a fast
+        //   path that must be indistinguishable from the general parser.
+        //
+        // Concerns:
+        //: 1 A valid string in each of the fixed-width layouts is parsed to
+        //:   the same value as by the general parser.
+        //:
+        //: 2 Every alternative spelling accepted by the general parser, and
+        //:   the leap second, are handled identically.
+        //:
+        //: 3 Strings having an invalid character in any position, or an
+        //:   invalid field value, are rejected as by the general parser.
+        //:
+        //: 4 The values at the boundaries of the valid range are parsed
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of strings in
+        //:   the fixed-width layouts, both valid and invalid, and the expected
+        //:   status of parsing each.
+        //:
+        //: 2 For each string, derive an equivalent string that is not in a
+        //:   fixed-width layout (and so is handled by the general parser) by
+        //:   appending a '0' to its fractional second (or by adding a
+        //:   fractional second of ".0").
+        //:
+        //: 3 Parse both strings as 'Datetime' and 'DatetimeTz', and verify
+        //:   that the status and the resulting value are the same in each
+        //:   case, and that the status is as expected.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: fixed-width strings are parsed as by the general parser
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING FIXED-WIDTH PARSING" << endl
+                          << "===========================" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input;    // string in a fixed-width layout
+            bool        d_isValid;  // 'true' if 'd_input' is valid
+        } DATA[] = {
+            { L_, "2005-01-31T08:59:59",              true  },
+            { L_, "2005-01-31T08:59:59Z",             true  },
+            { L_, "2005-01-31T08:59:59+04:00",        true  },
+            { L_, "2005-01-31T08:59:59.123",          true  },
+            { L_, "2005-01-31T08:59:59.123Z",         true  },
+            { L_, "2005-01-31T08:59:59.123-04:30",    true  },
+            { L_, "2005-01-31T08:59:59.123456",       true  },
+            { L_, "2005-01-31T08:59:59.123456Z",      true  },
+            { L_, "2005-01-31T08:59:59.123456+23:59", true  },
+            { L_, "2005-01-31t08:59:59,123z",         true  },
+            { L_, "2005-01-31T08:59:59,123456-00:00", true  },
+            { L_, "0001-01-01T00:00:00.000000",       true  },
+            { L_, "9999-12-31T23:59:59.999999",       true  },
+            { L_, "0001-01-01T00:00:00.000+00:01",    true  },
+            { L_, "9999-12-31T23:59:59.999-00:01",    true  },
+            { L_, "2004-02-29T12:00:00.000",          true  },
+            { L_, "2005-02-29T12:00:00.000",          false },
+            { L_, "2005-12-31T23:59:60.999",          true  },
+            { L_, "9999-12-31T23:59:60.000",          false },
+            { L_, "2005-01-31T24:00:00",              true  },
+            { L_, "2005-01-31T24:00:00.000001",       false },
+            { L_, "2005-01-31T25:00:00.000",          false },
+            { L_, "2005-01-31T08:60:00.000",          false },
+            { L_, "2005-13-31T08:59:59.123",          false },
+            { L_, "2005-00-31T08:59:59.123",          false },
+            { L_, "0000-01-31T08:59:59.123",          false },
+            { L_, "2005-01-31T08:59:59.12a",          false },
+            { L_, "2005-01-31T08:59:59/123",          false },
+            { L_, "2005-01-31 08:59:59.123",          false },
+            { L_, "2005/01-31T08:59:59.123",          false },
+            { L_, "2005-01-31T08:59:59.123+24:00",    false },
+            { L_, "2005-01-31T08:59:59.123+04:60",    false },
+            { L_, "2005-01-31T08:59:59.123*04:00",    false },
+            { L_, "2005-01-31T08:59:59.123+04-00",    false },
+            { L_, "2005-01-31T08:59:59.123Y",         false },
+            { L_, "2005-01-31T08:59:59\x7f",          false },
+            { L_, "2005-01-31T08:59:59.1\xb3" "3",     false },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char       *INPUT    = DATA[ti].d_input;
+            const bool        IS_VALID = DATA[ti].d_isValid;
+            const bsl::string STRING(INPUT);
+
+            // Form the equivalent string handled by the general parser.
+
+            bsl::string general(STRING);
+            if ('.' == general[19] || ',' == general[19]) {
+                bsl::string::size_type zone =
+                                    general.find_first_of("Zz+-", 19);
+                if (bsl::string::npos == zone) {
+                    zone = general.length();
+                }
+                general.insert(zone, "0");
+            }
+            else {
+                general.insert(19, ".0");
+            }
+
+            if (veryVerbose) { T_ P_(LINE) P_(STRING) P(general) }
+
+            bdlt::DatetimeTz mXTz;  const bdlt::DatetimeTz& XTz = mXTz;
+            bdlt::DatetimeTz mYTz;  const bdlt::DatetimeTz& YTz = mYTz;
+            bdlt::Datetime   mX;    const bdlt::Datetime&   X   = mX;
+            bdlt::Datetime   mY;    const bdlt::Datetime&   Y   = mY;
+
+            const int RC_TZ = Util::parse(&mXTz,
+                                          STRING.c_str(),
+                                          static_cast<int>(STRING.length()));
+            const int RC    = Util::parse(&mX,
+                                          STRING.c_str(),
+                                          static_cast<int>(STRING.length()));
+
+            ASSERTV(LINE, STRING, RC_TZ, IS_VALID == (0 == RC_TZ));
+
+            ASSERTV(LINE, STRING, RC_TZ, Util::parse(&mYTz, general) == RC_TZ);
+            ASSERTV(LINE, STRING, XTz, YTz, XTz == YTz);
+
+            ASSERTV(LINE, STRING, RC, Util::parse(&mY, general) == RC);
+            ASSERTV(LINE, STRING, X, Y, X == Y);
+        }
+
+        if (verbose) cout << "\nRound trip through 'generate'." << endl;
+        {
+            const bdlt::DatetimeTz XTz(bdlt::Datetime(2026, 10, 19,
+                                                      23, 59, 58, 123, 456),
+                                       -330);
+
+            for (int precision = 0; precision <= 6; precision += 3) {
+                Config mC;  const Config& C = mC;
+                mC.setFractionalSecondPrecision(precision);
+
+                char buffer[Util::k_DATETIMETZ_STRLEN + 1];
+                const int LEN = Util::generate(buffer, sizeof buffer, XTz, C);
+
+                bdlt::DatetimeTz mY;  const bdlt::DatetimeTz& Y = mY;
+
+                ASSERTV(precision, 0 == Util::parse(&mY, buffer, LEN));
+                ASSERTV(precision, XTz.offset() == Y.offset());
+
+                bdlt::Datetime expected(XTz.localDatetime());
+                if (precision < 6) {
+                    expected.setMicrosecond(0);
+                }
+                if (precision < 3) {
+                    expected.setMillisecond(0);
+                }
+                ASSERTV(precision, Y, expected == Y.localDatetime());
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
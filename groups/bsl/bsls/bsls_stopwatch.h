@@ -33,6 +33,16 @@ BSLS_IDENT("$Id: $")
 // 'bsls::Stopwatch' may be slow or inconsistent on some Windows machines.  See
 // the 'Accuracy and Precision' section of 'bsls_timeutil.h'.
 //
+///Cycle-Counter Wall Time
+///------------------------
+// By default, a 'bsls::Stopwatch' reads wall time using
+// 'bsls::TimeUtil::getTimerRaw'.  A stopwatch constructed with
+// 'e_CYCLE_COUNTER' instead reads the processor's cycle counter using
+// 'bsls::TimeUtil::getCycleCounterTimer', which is considerably cheaper where
+// an invariant cycle counter is available (and equivalent to the default
+// otherwise), making it suitable for timing short operations at high rates.
+// See the 'Cycle-Counter Timer' section of 'bsls_timeutil.h'.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate basic use of a 'bsls::Stopwatch'
@@ -115,6 +125,11 @@ class Stopwatch {
                                            // wall time when started
                                            // (nanoseconds)
 
+    Types::Int64 d_startCycleCounterTime;  // cycle-counter time when
+                                           // started, if
+                                           // 'd_useCycleCounterFlag'
+                                           // (nanoseconds)
+
     Types::Int64 d_accumulatedSystemTime;  // accumulated system time
                                            // (nanoseconds)
 
@@ -130,11 +145,23 @@ class Stopwatch {
     bool         d_collectCpuTimesFlag;    // 'true' if cpu times are being
                                            // collected
 
+    bool         d_useCycleCounterFlag;    // 'true' if wall time is read
+                                           // from the cycle counter
+
     // CLASS DATA
     static const double      s_nanosecondsPerSecond;   // conversion factor
                                                        // (for nanoseconds to
                                                        // seconds)
 
+  public:
+    // TYPES
+    enum WallTimer {
+        // Enumerate the timers from which a stopwatch may read wall time.
+
+        e_SYSTEM_TIMER,   // 'TimeUtil::getTimerRaw' (the default)
+        e_CYCLE_COUNTER   // 'TimeUtil::getCycleCounterTimer'
+    };
+
   private:
     // NOT IMPLEMENTED
     Stopwatch& operator=(const Stopwatch&) BSLS_KEYWORD_DELETED;
@@ -144,23 +171,28 @@ class Stopwatch {
     void updateTimes();
         // Update the CPU times accumulated but this stopwatch.
 
-    // PRIVATE ACCESSORS
-    void accumulatedTimesRaw(Types::Int64               *systemTime,
-                             Types::Int64               *userTime,
-                             TimeUtil::OpaqueNativeTime *wallTime) const;
-        // Load into the specified 'systemTime', 'userTime', and 'wallTime' the
-        // values of the system time, user time, and wall time (in
-        // nanoseconds), respectively, as provided by 'TimeUtil'.
+    void startWallTime();
+        // Record the current wall time as the time at which this stopwatch
+        // was started, reading the timer indicated by
+        // 'd_useCycleCounterFlag'.
 
-    Types::Int64 elapsedWallTime(TimeUtil::OpaqueNativeTime rawWallTime) const;
-        // Return the elapsed time, in nanoseconds, between the current
-        // 'd_startWallTime' and the specified 'rawWallTime'.
+    // PRIVATE ACCESSORS
+    Types::Int64 elapsedWallTime() const;
+        // Return the elapsed wall time, in nanoseconds, between the time
+        // recorded by 'startWallTime' and now.
 
   public:
     // CREATORS
     Stopwatch();
         // Create a stopwatch in the STOPPED state having total accumulated
-        // system, user, and wall times all equal to 0.0.
+        // system, user, and wall times all equal to 0.0, that reads wall time
+        // from 'TimeUtil::getTimerRaw'.
+
+    explicit Stopwatch(WallTimer wallTimer);
+        // Create a stopwatch in the STOPPED state having total accumulated
+        // system, user, and wall times all equal to 0.0, that reads wall time
+        // from the timer indicated by the specified 'wallTimer' (see
+        // {Cycle-Counter Wall Time}).
 
     //! Stopwatch(const Stopwatch& other) = default;
         // Create a stopwatch having the state and total accumulated system,
@@ -223,6 +255,9 @@ class Stopwatch {
     bool isRunning() const;
         // Return 'true' if this stopwatch is in the RUNNING state, and 'false'
         // otherwise.
+
+    WallTimer wallTimer() const;
+        // Return the timer from which this stopwatch reads wall time.
 };
 
 // ============================================================================
@@ -233,21 +268,30 @@ class Stopwatch {
                              // class Stopwatch
                              // ---------------
 
-// PRIVATE ACCESSORS
+// PRIVATE MANIPULATORS
 inline
-void Stopwatch::accumulatedTimesRaw(Types::Int64               *systemTime,
-                                    Types::Int64               *userTime,
-                                    TimeUtil::OpaqueNativeTime *wallTime) const
+void Stopwatch::startWallTime()
 {
-    TimeUtil::getProcessTimers(systemTime, userTime);
-    TimeUtil::getTimerRaw(wallTime);
+    if (d_useCycleCounterFlag) {
+        d_startCycleCounterTime = TimeUtil::getCycleCounterTimer();
+    }
+    else {
+        TimeUtil::getTimerRaw(&d_startWallTime);
+    }
 }
 
+// PRIVATE ACCESSORS
 inline
-Types::Int64 Stopwatch::elapsedWallTime(
-                                  TimeUtil::OpaqueNativeTime rawWallTime) const
+Types::Int64 Stopwatch::elapsedWallTime() const
 {
-    return TimeUtil::convertRawTime(rawWallTime)
+    if (d_useCycleCounterFlag) {
+        return TimeUtil::getCycleCounterTimer() - d_startCycleCounterTime;
+                                                                      // RETURN
+    }
+
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+    return TimeUtil::convertRawTime(now)
          - TimeUtil::convertRawTime(d_startWallTime);
 }
 
@@ -257,11 +301,30 @@ Stopwatch::Stopwatch()
 : d_startSystemTime(0)
 , d_startUserTime(0)
 // , d_startWallTime(0)  // opaque type, no default ctor from 0.
+, d_startCycleCounterTime(0)
 , d_accumulatedSystemTime(0)
 , d_accumulatedUserTime(0)
 , d_accumulatedWallTime(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
+, d_useCycleCounterFlag(false)
+{
+    TimeUtil::initialize();
+    memset(&d_startWallTime, 0, sizeof(d_startWallTime));
+}
+
+inline
+Stopwatch::Stopwatch(WallTimer wallTimer)
+: d_startSystemTime(0)
+, d_startUserTime(0)
+// , d_startWallTime(0)  // opaque type, no default ctor from 0.
+, d_startCycleCounterTime(0)
+, d_accumulatedSystemTime(0)
+, d_accumulatedUserTime(0)
+, d_accumulatedWallTime(0)
+, d_isRunning(false)
+, d_collectCpuTimesFlag(false)
+, d_useCycleCounterFlag(e_CYCLE_COUNTER == wallTimer)
 {
     TimeUtil::initialize();
     memset(&d_startWallTime, 0, sizeof(d_startWallTime));
@@ -283,13 +346,9 @@ void Stopwatch::start(bool collectCpuTimes)
     if (!d_isRunning) {
         d_collectCpuTimesFlag = collectCpuTimes;
         if (d_collectCpuTimesFlag) {
-            accumulatedTimesRaw(&d_startSystemTime,
-                                &d_startUserTime,
-                                &d_startWallTime);
-        }
-        else {
-            TimeUtil::getTimerRaw(&d_startWallTime);
+            TimeUtil::getProcessTimers(&d_startSystemTime, &d_startUserTime);
         }
+        startWallTime();
         d_isRunning = true;
     }
 }
@@ -302,9 +361,7 @@ void Stopwatch::stop()
             updateTimes();
         }
         else {
-            TimeUtil::OpaqueNativeTime now;
-            TimeUtil::getTimerRaw(&now);
-            d_accumulatedWallTime += elapsedWallTime(now);
+            d_accumulatedWallTime += elapsedWallTime();
         }
         d_isRunning = false;
     }
@@ -347,9 +404,7 @@ inline
 double Stopwatch::accumulatedWallTime() const
 {
     if (d_isRunning) {
-        TimeUtil::OpaqueNativeTime now;
-        TimeUtil::getTimerRaw(&now);
-        return (double)(d_accumulatedWallTime + elapsedWallTime(now))
+        return (double)(d_accumulatedWallTime + elapsedWallTime())
                                                       / s_nanosecondsPerSecond;
                                                                       // RETURN
     }
@@ -368,6 +423,12 @@ bool Stopwatch::isRunning() const
     return d_isRunning;
 }
 
+inline
+Stopwatch::WallTimer Stopwatch::wallTimer() const
+{
+    return d_useCycleCounterFlag ? e_CYCLE_COUNTER : e_SYSTEM_TIMER;
+}
+
 }  // close package namespace
 
 #ifndef BDE_OPENSOURCE_PUBLICATION  // BACKWARD_COMPATIBILITY
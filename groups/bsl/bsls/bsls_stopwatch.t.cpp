@@ -33,12 +33,14 @@ using namespace BloombergLP;
 // behavior.
 //-----------------------------------------------------------------------------
 // [ 2] bsls::Stopwatch();
+// [ 7] explicit bsls::Stopwatch(WallTimer wallTimer);
 // [ 2] bsls::Stopwatch(const bsls::Stopwatch& other);
 // [ 2] ~bsls::Stopwatch();
 // [ 3] void start();
 // [ 3] void stop();
 // [ 3] void reset();
 // [ 2] bool isRunning() const;
+// [ 7] WallTimer wallTimer() const;
 // [ 4] double accumulatedSystemTime() const;
 // [ 4] double accumulatedUserTime() const;
 // [ 4] double accumulatedWallTime() const;
@@ -47,7 +49,7 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 8] USAGE Example
 // [ 6] Reproduce bug from test case
 //-----------------------------------------------------------------------------
 
@@ -319,7 +321,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -365,6 +367,86 @@ int main(int argc, char *argv[])
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING CYCLE-COUNTER WALL TIME
+        //
+        // Concerns:
+        //: 1 A default-constructed stopwatch reads wall time from the system
+        //:   timer, and one constructed with 'e_CYCLE_COUNTER' from the cycle
+        //:   counter; copies retain the timer of the original.
+        //:
+        //: 2 A stopwatch reading the cycle counter accumulates wall time, and
+        //:   (when requested) CPU times, as does one reading the system timer.
+        //
+        // Plan:
+        //: 1 Construct stopwatches with each timer, and copies of them, and
+        //:   verify the value returned by 'wallTimer'.  (C-1)
+        //:
+        //: 2 Run a stopwatch of each kind, with and without collecting CPU
+        //:   times, over the same delay, and verify that the accumulated wall
+        //:   times agree with the delay and one another, and that the
+        //:   accumulated times do not change once stopped.  (C-2)
+        //
+        // Testing:
+        //   explicit bsls::Stopwatch(WallTimer wallTimer);
+        //   WallTimer wallTimer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CYCLE-COUNTER WALL TIME"
+                            "\n===============================\n");
+
+        if (verbose) printf("\nTesting 'wallTimer'.\n");
+        {
+            const Obj X;
+            const Obj Y(Obj::e_SYSTEM_TIMER);
+            const Obj Z(Obj::e_CYCLE_COUNTER);
+            const Obj W(Z);
+
+            ASSERT(Obj::e_SYSTEM_TIMER  == X.wallTimer());
+            ASSERT(Obj::e_SYSTEM_TIMER  == Y.wallTimer());
+            ASSERT(Obj::e_CYCLE_COUNTER == Z.wallTimer());
+            ASSERT(Obj::e_CYCLE_COUNTER == W.wallTimer());
+        }
+
+        if (verbose) printf("\nTesting accumulated times.\n");
+        {
+            const double delayTime = 0.2;   // seconds
+            const double precision = 0.02;  // seconds
+
+            for (int collect = 0; collect < 2; ++collect) {
+                const bool COLLECT = collect;
+
+                Obj mS(Obj::e_SYSTEM_TIMER);   const Obj& S = mS;
+                Obj mC(Obj::e_CYCLE_COUNTER);  const Obj& C = mC;
+
+                mC.start(COLLECT);
+                mS.start(COLLECT);
+                delayWall(delayTime);
+                mS.stop();
+                mC.stop();
+
+                const double sw = S.accumulatedWallTime();
+                const double cw = C.accumulatedWallTime();
+
+                if (veryVerbose) { P_(COLLECT) P_(sw) P(cw) }
+
+                ASSERTV(COLLECT, cw, delayTime <= cw + precision);
+                ASSERTV(COLLECT, cw, cw <= delayTime + precision);
+                ASSERTV(COLLECT, sw, cw, sw <= cw + precision);
+                ASSERTV(COLLECT, sw, cw, cw <= sw + precision);
+
+                double st, ut, wt;
+                C.accumulatedTimes(&st, &ut, &wt);
+                ASSERTV(COLLECT, isEqual(cw, wt));
+                ASSERTV(COLLECT, st, COLLECT || 0 == st);
+                ASSERTV(COLLECT, ut, COLLECT || 0 == ut);
+                ASSERTV(COLLECT, ut, !COLLECT || 0 < st + ut);
+
+                ASSERTV(COLLECT, isEqual(cw, C.accumulatedWallTime()));
+            }
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // ATTEMPT TO REPRODUCE BUG PRODUCING NEGATIVE TIMES
@@ -144,6 +144,11 @@ TimeInterval SystemTime::nowMonotonicClock()
     return getNowTime(SYSTEM_CLOCK, &g_realtimeClock);
 }
 
+TimeInterval SystemTime::nowCoarseRealtimeClock()
+{
+    return nowRealtimeClock();
+}
+
 #elif defined(BSLS_PLATFORM_OS_WINDOWS)
 
                             //- - - - - - - - - - - -
@@ -204,6 +209,13 @@ TimeInterval SystemTime::nowMonotonicClock()
                         nanosec % k_NanosecondsPerSecond);
 }
 
+TimeInterval SystemTime::nowCoarseRealtimeClock()
+{
+    // 'GetSystemTimeAsFileTime' is already updated only once per system tick.
+
+    return nowRealtimeClock();
+}
+
 #else
 
                             //- - - - - - - - - - - -
@@ -235,6 +247,15 @@ TimeInterval SystemTime::nowRealtimeClock()
     return getNowTime(CLOCK_REALTIME);
 }
 
+TimeInterval SystemTime::nowCoarseRealtimeClock()
+{
+#if defined(CLOCK_REALTIME_COARSE)
+    return getNowTime(CLOCK_REALTIME_COARSE);
+#else
+    return getNowTime(CLOCK_REALTIME);
+#endif
+}
+
 #endif
 
 }  // close package namespace
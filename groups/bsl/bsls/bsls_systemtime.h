@@ -40,6 +40,23 @@ BSLS_IDENT("$Id: $")
 // meaning that 'bsls::TimeInterval' values from the monotonic clock should
 // *not* be shared between processes.
 //
+///Coarse Real-Time Clock
+///-----------------------
+// 'nowCoarseRealtimeClock' returns the real-time clock with a resolution that
+// is coarser than that of 'nowRealtimeClock' (typically the period of the
+// operating system's scheduler tick, i.e., a few milliseconds), in exchange
+// for being considerably cheaper to read.  On Linux, it reads the
+// 'CLOCK_REALTIME_COARSE' clock, which is served from user space without a
+// system call or a hardware counter read.  On platforms that provide no such
+// clock, it is equivalent to 'nowRealtimeClock'.  It is intended for callers
+// that read the time very frequently and require only millisecond precision
+// (e.g., for timestamping log records, which can be arranged by supplying it
+// to 'bdlt::CurrentTime::setCurrentTimeCallback').  Note that the values
+// returned by 'nowCoarseRealtimeClock' and 'nowRealtimeClock' are not
+// ordered with respect to one another: a call to 'nowCoarseRealtimeClock' may
+// return a value earlier than that returned by a preceding call to
+// 'nowRealtimeClock'.
+//
 ///Thread Safety
 ///-------------
 // The functions provided by 'bsls::SystemTime' are *thread-safe*.
@@ -115,6 +132,14 @@ struct SystemTime {
         // according to the real-time clock.  The returned value is the time
         // interval between the reference time point for the real-time clock
         // (see {Reference Time Point}) and the current time.
+
+    static TimeInterval nowCoarseRealtimeClock();
+        // Return the 'TimeInterval' value representing the current system time
+        // according to the real-time clock, read with a coarse resolution
+        // (see {Coarse Real-Time Clock}).  The returned value is the time
+        // interval between the reference time point for the real-time clock
+        // (see {Reference Time Point}) and the current time, truncated to the
+        // resolution of the coarse clock.
 };
 
 // ============================================================================
@@ -36,8 +36,9 @@ using namespace std;
 // [ 3] TimeInterval now(SystemClockType::Enum);
 // [ 2] TimeInterval nowMonotonicClock();
 // [ 1] TimeInterval nowRealtimeClock();
+// [ 4] TimeInterval nowCoarseRealtimeClock();
 //-----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // [-1] CONCERN: STRESS TEST FOR MONOTONICITY
 // [-2] CONCERN: MONOTONICITY UNDER SYSTEM CLOCK CHANGES
 
@@ -135,7 +136,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -189,6 +190,89 @@ int main(int argc, char *argv[])
                                      interval <= bsls::TimeInterval(1.1));
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: 'nowCoarseRealtimeClock'
+        //
+        // Concerns:
+        //: 1 'nowCoarseRealtimeClock' returns values that are intervals from
+        //:   the Unix epoch.
+        //:
+        //: 2 'nowCoarseRealtimeClock' returns a value that does not follow
+        //:   that of a subsequent call to 'nowRealtimeClock', and does not
+        //:   precede that of a prior call to 'nowRealtimeClock' by more than
+        //:   the resolution of the coarse clock.
+        //:
+        //: 3 QoI: That consecutive values do not decrease (under normal
+        //:   conditions).
+        //:
+        //: 4 QoI: The resolution of the coarse real-time clock is < 1 second.
+        //
+        // Plan:
+        //: 1 Call 'nowCoarseRealtimeClock' and verify the value returned,
+        //:   when treated as an interval from the Unix epoch, corresponds to a
+        //:   possible wall clock time.  (C-1)
+        //:
+        //: 2 Call 'nowCoarseRealtimeClock' between two calls to
+        //:   'nowRealtimeClock' and verify the three values are ordered as
+        //:   expected, allowing a generous bound for the coarse resolution.
+        //:   (C-2)
+        //:
+        //: 3 Call 'nowCoarseRealtimeClock' in a loop for a couple seconds;
+        //:   verify the results do not decrease between iterations, and that
+        //:   increments of the clock are less than 1 second.  (C-3..4)
+        //
+        // Testing:
+        //   TimeInterval nowCoarseRealtimeClock();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHODS: 'nowCoarseRealtimeClock'"
+                            "\n=======================================\n");
+
+        if (veryVerbose) printf("\tTest result is relative to Unix epoch\n");
+        {
+            const int64_t SEPT_27_2014         = 1411833584;
+            const int64_t HUNDRED_YEARS_APPROX = 60ull * 60 * 24 * 365 * 100;
+
+            TimeInterval t = Obj::nowCoarseRealtimeClock();
+
+            ASSERT(SEPT_27_2014                        <= t.seconds());
+            ASSERT(SEPT_27_2014 + HUNDRED_YEARS_APPROX >= t.seconds());
+        }
+
+        if (veryVerbose) printf("\tCompare results to 'nowRealtimeClock'\n");
+        {
+            const TimeInterval RESOLUTION(0.1);
+
+            TimeInterval before = Obj::nowRealtimeClock();
+            TimeInterval coarse = Obj::nowCoarseRealtimeClock();
+            TimeInterval after  = Obj::nowRealtimeClock();
+
+            if (veryVerbose) {
+                P_(before); P_(coarse); P(after);
+            }
+
+            ASSERTV(before, coarse, before - RESOLUTION <= coarse);
+            ASSERTV(coarse, after,  coarse              <= after);
+        }
+
+        if (veryVerbose) printf("\tVerify sequential values'\n");
+        {
+            TimeInterval ONE_SEC = TimeInterval(1, 0);
+            TimeInterval origin  = Obj::nowCoarseRealtimeClock();
+            TimeInterval prev    = origin;
+            TimeInterval now     = origin;
+
+            while (TimeInterval(1.5) > now - origin) {
+                now = Obj::nowCoarseRealtimeClock();
+
+                ASSERT(prev <= now);
+                ASSERT(prev + ONE_SEC > now);
+
+                prev = now;
+            }
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // CLASS METHODS: 'now(SystemClockType::Enum)'
@@ -23,6 +23,17 @@ BSLS_IDENT("$Id$ $CSID$")
     #error "Don't know how to get nanosecond time for this platform"
 #endif
 
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    #if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        #include <cpuid.h>      // __get_cpuid()
+        #include <x86intrin.h>  // __rdtsc()
+        #define BSLS_TIMEUTIL_X86_CYCLE_COUNTER 1
+    #elif defined(BSLS_PLATFORM_CMP_MSVC)
+        #include <intrin.h>     // __cpuid(), __rdtsc()
+        #define BSLS_TIMEUTIL_X86_CYCLE_COUNTER 1
+    #endif
+#endif
+
 #if defined(BSLS_PLATFORM_OS_SOLARIS)
     #include <sys/time.h>       // gethrtime()
 #elif defined(BSLS_PLATFORM_OS_DARWIN)
@@ -560,6 +571,200 @@ bsls::Types::Int64 MachTimerUtil::getTimerRaw()
 
 #endif
 
+                           // =======================
+                           // struct CycleCounterUtil
+                           // =======================
+
+struct CycleCounterUtil {
+    // Provides access to a calibrated, invariant processor cycle counter,
+    // scaled to nanoseconds.
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_CALIBRATION_NANOSECONDS = 10 * 1000 * 1000,  // duration of the
+                                                       // calibration
+
+        k_SCALE_SHIFT             = 28  // number of fractional bits in
+                                        // 's_nanosecondsPerCycle'
+    };
+
+    // CLASS DATA
+    static bool                s_isAvailable;   // 'true' if the cycle counter
+                                                // is usable
+
+    static bsls::Types::Uint64 s_baseCycles;    // cycle count at calibration
+
+    static bsls::Types::Int64  s_baseTimer;     // 'getTimer' value at
+                                                // calibration
+
+    static bsls::Types::Uint64 s_nanosecondsPerCycle;
+                                                // fixed-point (with
+                                                // 'k_SCALE_SHIFT' fractional
+                                                // bits) nanoseconds per cycle
+
+    // PRIVATE CLASS METHODS
+    static bool hasInvariantCycleCounter();
+        // Return 'true' if the processor advertises an invariant cycle
+        // counter, and 'false' otherwise.
+
+    static bsls::Types::Uint64 readCycleCounter();
+        // Return the current value of the processor's cycle counter.  The
+        // behavior is undefined unless the platform provides a cycle counter.
+
+    static bsls::Types::Int64 scale(bsls::Types::Uint64 cycles);
+        // Return the specified 'cycles' converted to nanoseconds.  The
+        // behavior is undefined unless the cycle counter has been calibrated
+        // and the result can be represented by 'bsls::Types::Int64'.
+
+  public:
+    // CLASS METHODS
+    static void initialize();
+        // Determine whether an invariant cycle counter is available and, if
+        // so, calibrate it against 'bsls::TimeUtil::getTimer'.  This method
+        // has no effect after its first invocation.
+
+    static bool isAvailable();
+        // Return 'true' if the cycle counter is available and calibrated, and
+        // 'false' otherwise.  The behavior is undefined unless 'initialize'
+        // has been called.
+
+    static bsls::Types::Int64 getTimer();
+        // Return the current value of the cycle counter in nanoseconds,
+        // referenced to approximately the same origin as
+        // 'bsls::TimeUtil::getTimer'.  The behavior is undefined unless
+        // 'initialize' has been called and 'isAvailable' returns 'true'.
+};
+
+bool                CycleCounterUtil::s_isAvailable         = false;
+bsls::Types::Uint64 CycleCounterUtil::s_baseCycles          = 0;
+bsls::Types::Int64  CycleCounterUtil::s_baseTimer           = 0;
+bsls::Types::Uint64 CycleCounterUtil::s_nanosecondsPerCycle = 0;
+
+inline
+bool CycleCounterUtil::hasInvariantCycleCounter()
+{
+    // The invariant-TSC feature is reported in bit 8 of EDX for the extended
+    // CPUID leaf 0x80000007, which must first be verified to be supported.
+
+    const unsigned int k_POWER_MANAGEMENT_LEAF = 0x80000007;
+    const unsigned int k_INVARIANT_TSC_BIT     = 1u << 8;
+
+#if defined(BSLS_TIMEUTIL_X86_CYCLE_COUNTER)
+  #if defined(BSLS_PLATFORM_CMP_MSVC)
+    int info[4];
+    __cpuid(info, 0x80000000);
+    if (static_cast<unsigned int>(info[0]) < k_POWER_MANAGEMENT_LEAF) {
+        return false;                                                 // RETURN
+    }
+    __cpuid(info, k_POWER_MANAGEMENT_LEAF);
+    return 0 != (static_cast<unsigned int>(info[3]) & k_INVARIANT_TSC_BIT);
+  #else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx)
+     || eax < k_POWER_MANAGEMENT_LEAF
+     || !__get_cpuid(k_POWER_MANAGEMENT_LEAF, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+    return 0 != (edx & k_INVARIANT_TSC_BIT);
+  #endif
+#else
+    (void)k_POWER_MANAGEMENT_LEAF;
+    (void)k_INVARIANT_TSC_BIT;
+    return false;
+#endif
+}
+
+inline
+bsls::Types::Uint64 CycleCounterUtil::readCycleCounter()
+{
+#if defined(BSLS_TIMEUTIL_X86_CYCLE_COUNTER)
+    return __rdtsc();
+#else
+    BSLS_ASSERT_OPT("No cycle counter on this platform" && 0);
+    return 0;
+#endif
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::scale(bsls::Types::Uint64 cycles)
+{
+    // Compute '(cycles * s_nanosecondsPerCycle) >> k_SCALE_SHIFT' without
+    // overflowing 64 bits, by splitting 'cycles' into 32-bit halves.  Note
+    // that 's_nanosecondsPerCycle' is less than 2^32 for any counter faster
+    // than 2^(k_SCALE_SHIFT - 32) GHz (i.e., 62.5 MHz).
+
+    const bsls::Types::Uint64 high = cycles >> 32;
+    const bsls::Types::Uint64 low  = cycles & 0xffffffffULL;
+
+    return static_cast<bsls::Types::Int64>(
+                     ((high * s_nanosecondsPerCycle) << (32 - k_SCALE_SHIFT))
+                   + ((low  * s_nanosecondsPerCycle) >> k_SCALE_SHIFT));
+}
+
+void CycleCounterUtil::initialize()
+{
+    static bsls::BslOnce once = BSLS_BSLONCE_INITIALIZER;
+
+    bsls::BslOnceGuard onceGuard;
+    if (!onceGuard.enter(&once) || !hasInvariantCycleCounter()) {
+        return;                                                       // RETURN
+    }
+
+    // Sample the cycle counter on either side of each reading of 'getTimer'
+    // and attribute the midpoint to that reading, so as to reduce the error
+    // introduced by the latency of 'getTimer' itself.
+
+    bsls::Types::Uint64 before      = readCycleCounter();
+    bsls::Types::Int64  startTimer  = bsls::TimeUtil::getTimer();
+    bsls::Types::Uint64 after       = readCycleCounter();
+    bsls::Types::Uint64 startCycles = before + (after - before) / 2;
+
+    bsls::Types::Int64  endTimer;
+    bsls::Types::Uint64 endCycles;
+    do {
+        before    = readCycleCounter();
+        endTimer  = bsls::TimeUtil::getTimer();
+        after     = readCycleCounter();
+        endCycles = before + (after - before) / 2;
+    } while (endTimer - startTimer < k_CALIBRATION_NANOSECONDS);
+
+    const bsls::Types::Uint64 cycles = endCycles - startCycles;
+    const bsls::Types::Uint64 nanoseconds =
+                       static_cast<bsls::Types::Uint64>(endTimer - startTimer);
+
+    if (cycles <= nanoseconds >> (32 - k_SCALE_SHIFT)) {
+        // The counter is too slow to be represented (see 'scale'), or did not
+        // advance; fall back to 'getTimer'.
+
+        return;                                                       // RETURN
+    }
+
+    s_nanosecondsPerCycle = (nanoseconds << k_SCALE_SHIFT) / cycles;
+    s_baseCycles          = endCycles;
+    s_baseTimer           = endTimer;
+    s_isAvailable         = true;
+}
+
+inline
+bool CycleCounterUtil::isAvailable()
+{
+    return s_isAvailable;
+}
+
+inline
+bsls::Types::Int64 CycleCounterUtil::getTimer()
+{
+    // The counters of different cores may differ slightly, so a reading taken
+    // on another core shortly after calibration may precede 's_baseCycles'.
+
+    const bsls::Types::Uint64 cycles = readCycleCounter();
+
+    return cycles >= s_baseCycles
+           ? s_baseTimer + scale(cycles - s_baseCycles)
+           : s_baseTimer - scale(s_baseCycles - cycles);
+}
+
 }  // close unnamed namespace
 
 namespace bsls {
@@ -762,6 +967,23 @@ void TimeUtil::getProcessTimers(Types::Int64 *systemTimer,
 #endif
 }
 
+Types::Int64 TimeUtil::getCycleCounterTimer()
+{
+    CycleCounterUtil::initialize();
+
+    if (CycleCounterUtil::isAvailable()) {
+        return CycleCounterUtil::getTimer();                          // RETURN
+    }
+    return getTimer();
+}
+
+bool TimeUtil::isCycleCounterTimerAvailable()
+{
+    CycleCounterUtil::initialize();
+
+    return CycleCounterUtil::isAvailable();
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
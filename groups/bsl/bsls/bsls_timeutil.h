@@ -90,6 +90,27 @@ BSLS_IDENT("$Id: $")
 // expressed by the 'QueryPerformanceCounter' interface.  Note that the times
 // will still be monotonically non-decreasing.
 //
+///Cycle-Counter Timer
+///-------------------
+// 'getTimer' reads the operating system's monotonic clock, which (e.g., via
+// 'clock_gettime' on Linux) costs on the order of 20 nanoseconds per call.
+// For timing very short code segments at high rates, 'getCycleCounterTimer'
+// instead reads the processor's time-stamp counter (TSC) directly and scales
+// it to nanoseconds using a fixed-point multiplication.  The cycle counter is
+// used only on x86 processors that advertise an *invariant* TSC (i.e., one
+// that ticks at a constant rate regardless of frequency scaling and power
+// states, and that is synchronized among the cores of the machine); this is
+// determined, and the counter is calibrated against 'getTimer', on the first
+// call to 'getCycleCounterTimer' or 'isCycleCounterTimerAvailable'.
+// Calibration busy-waits for approximately 10 milliseconds.  Values returned
+// by 'getCycleCounterTimer' are referenced to (approximately) the same origin
+// as those returned by 'getTimer'; however, owing to the limited accuracy of
+// the calibration, the two timers may drift apart by a few parts per million,
+// so values from the two should not be compared with one another.  On
+// platforms without a suitable cycle counter (including virtual machines
+// that do not expose the invariant-TSC feature), 'getCycleCounterTimer' is
+// equivalent to 'getTimer'.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use 'bsls::TimeUtil'
@@ -287,6 +308,21 @@ struct TimeUtil {
         // interpreting the results.  Note that this method is thread-safe only
         // if 'initialize' has been called before.
 
+                                  // Cycle Counter
+
+    static Types::Int64 getCycleCounterTimer();
+        // Return the instantaneous value of the processor's cycle counter
+        // converted to nanoseconds, referenced to approximately the same
+        // origin as 'getTimer', if 'isCycleCounterTimerAvailable()' is 'true',
+        // and the value of 'getTimer()' otherwise (see {Cycle-Counter Timer}).
+        // Note that the first call to this method (or to
+        // 'isCycleCounterTimerAvailable') calibrates the cycle counter, and
+        // may take approximately 10 milliseconds.
+
+    static bool isCycleCounterTimerAvailable();
+        // Return 'true' if 'getCycleCounterTimer' reads a calibrated,
+        // invariant processor cycle counter on this machine, and 'false' if
+        // it falls back to 'getTimer'.
 };
 
 }  // close package namespace
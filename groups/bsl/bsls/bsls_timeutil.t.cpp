@@ -46,8 +46,10 @@ using namespace BloombergLP;
 // [ 1] Int64 getTimer();
 // [ 1] Int64 getProcessUserTimer();
 // [ 8] OpaqueNativeTime getTimerRaw();
+// [10] Int64 getCycleCounterTimer();
+// [10] bool isCycleCounterTimerAvailable();
 //-----------------------------------------------------------------------------
-// [10] USAGE
+// [11] USAGE
 // [ 2] Performance Test
 // [ 3] Successive timer values do not repeat
 // [ 4] Forwarding of methods to underlying OS APIs
@@ -785,7 +787,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header must build and
@@ -827,6 +829,117 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'getCycleCounterTimer'
+        //
+        // Concerns:
+        //: 1 'isCycleCounterTimerAvailable' returns the same value on every
+        //:   call.
+        //:
+        //: 2 Successive values returned by 'getCycleCounterTimer' do not
+        //:   decrease.
+        //:
+        //: 3 'getCycleCounterTimer' is referenced to approximately the same
+        //:   origin as 'getTimer'.
+        //:
+        //: 4 Intervals measured by 'getCycleCounterTimer' agree with those
+        //:   measured by 'getTimer'.
+        //
+        // Plan:
+        //: 1 Call 'isCycleCounterTimerAvailable' repeatedly and verify that
+        //:   the result does not change.  (C-1)
+        //:
+        //: 2 Call 'getCycleCounterTimer' in a loop and verify that the values
+        //:   are non-decreasing.  (C-2)
+        //:
+        //: 3 Call 'getCycleCounterTimer' between two calls to 'getTimer', and
+        //:   verify that its value lies between them, allowing a generous
+        //:   tolerance for the drift of the calibration.  (C-3)
+        //:
+        //: 4 Sleep for a fixed period, measuring the interval with both
+        //:   timers, and verify that the measurements agree to within 1%.
+        //:   (C-4)
+        //
+        // Testing:
+        //   Int64 getCycleCounterTimer();
+        //   bool isCycleCounterTimerAvailable();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'getCycleCounterTimer'"
+                            "\n==============================\n");
+
+        const bool AVAILABLE = TU::isCycleCounterTimerAvailable();
+
+        if (verbose) { P(AVAILABLE); }
+
+        if (verbose) printf("\nAvailability does not change.\n");
+        {
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, AVAILABLE == TU::isCycleCounterTimerAvailable());
+            }
+        }
+
+        if (verbose) printf("\nSuccessive values do not decrease.\n");
+        {
+            enum { k_NUM_ITERATIONS = 1000000 };
+
+            const Int64 t0   = TU::getTimer();
+            Int64       prev = TU::getCycleCounterTimer();
+
+            int numWrong = 0;
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                const Int64 now = TU::getCycleCounterTimer();
+                if (now < prev) {
+                    ++numWrong;
+                    if (veryVerbose) { T_; P_(i); P_(prev); P(now); }
+                }
+                prev = now;
+            }
+            ASSERTV(numWrong, 0 == numWrong);
+
+            if (verbose) {
+                const double perCall = static_cast<double>(TU::getTimer() - t0)
+                                                            / k_NUM_ITERATIONS;
+                printf("\ttime per call = %g (nsec)\n", perCall);
+            }
+        }
+
+        if (verbose) printf("\nThe origin is that of 'getTimer'.\n");
+        {
+            const Int64 TOLERANCE = 10 * nsecsPerMillisecond;
+
+            const Int64 before = TU::getTimer();
+            const Int64 cycle  = TU::getCycleCounterTimer();
+            const Int64 after  = TU::getTimer();
+
+            if (veryVerbose) { T_; P_(before); P_(cycle); P(after); }
+
+            ASSERTV(before, cycle, before - TOLERANCE <= cycle);
+            ASSERTV(cycle,  after, cycle <= after + TOLERANCE);
+        }
+
+        if (verbose) printf("\nIntervals agree with 'getTimer'.\n");
+        {
+            const Int64 startTimer = TU::getTimer();
+            const Int64 startCycle = TU::getCycleCounterTimer();
+
+            osMillisleep(100);
+
+            const Int64 endCycle   = TU::getCycleCounterTimer();
+            const Int64 endTimer   = TU::getTimer();
+
+            const Int64 timerInterval = endTimer - startTimer;
+            const Int64 cycleInterval = endCycle - startCycle;
+
+            if (veryVerbose) { T_; P_(timerInterval); P(cycleInterval); }
+
+            ASSERTV(timerInterval, cycleInterval,
+                    cycleInterval <= timerInterval + timerInterval / 100);
+            ASSERTV(timerInterval, cycleInterval,
+                    timerInterval - timerInterval / 100 <= cycleInterval);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING convertRawTime() arithmetic *** Windows Only ***
@@ -2138,6 +2251,7 @@ int main(int argc, char *argv[])
         }
         TimerMethods[] = {
             { TU::getTimer,                 "getTimer",                true  },
+            { TU::getCycleCounterTimer,     "getCycleCounterTimer",    true  },
             { TU::getProcessSystemTimer,    "getProcessSystemTimer",   false },
             { TU::getProcessUserTimer,      "getProcessUserTimer",     false },
             { callGetProcessTimersRetSystem,"getProcessTimers(system)",false },
@@ -4,7 +4,326 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bslx_marshallingutil_cpp,"$Id$ $CSID$")
 
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+
+// On x86 platforms, the array functions (other than those for 8-bit values)
+// marshal 16 bytes of network representation at a time with a byte shuffle
+// ('pshufb') if the processor supports SSSE3, and, if it supports AVX2 and
+// the elements of the network and host representations have the same width,
+// 32 bytes at a time.  Support is detected at run time.  The elements that
+// remain are marshalled by the scalar functions.
+
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN                                            \
+ && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))    \
+ && (defined(BSLS_PLATFORM_CMP_CLANG) || defined(BSLS_PLATFORM_CMP_MSVC)      \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define U_USE_SHUFFLE 1
+#endif
+
+#if defined(U_USE_SHUFFLE)
+#include <immintrin.h>
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#include <intrin.h>
+#define U_TARGET(ISA)
+#else
+#define U_TARGET(ISA) __attribute__((target(ISA)))
+#endif
+#endif
+
 namespace BloombergLP {
+namespace {
+
+#if defined(U_USE_SHUFFLE)
+
+enum {
+    k_SCALAR = 0,  // no byte shuffle instructions
+    k_SSSE3  = 1,  // 16-byte shuffles
+    k_AVX2   = 2   // 16- and 32-byte shuffles
+};
+
+                          // ====================
+                          // struct ShuffleMasks
+                          // ====================
+
+struct ShuffleMasks {
+    // This 'struct' holds the 'pshufb' control masks that marshal the
+    // elements held in one 16-byte vector, for one combination of host width
+    // (in bytes) and network width.  Index 0x80 zeroes the destination byte.
+
+    // DATA
+    unsigned char d_put[16];   // host order to network order
+    unsigned char d_get[16];   // network order to host order, zero-extended
+    unsigned char d_sign[16];  // network sign byte to each extension byte
+};
+
+struct ShuffleMaskTable {
+    // This 'struct' holds the 'ShuffleMasks' for each network width from 2 to
+    // 8 bytes, for the narrowest host width that holds it.
+
+    // DATA
+    ShuffleMasks d_masks[9];  // indexed by network width
+
+    // CREATORS
+    ShuffleMaskTable()
+        // Create a table holding the masks for each network width.
+    {
+        for (int width = 2; width <= 8; ++width) {
+            const int     size  = width <= 2 ? 2 : width <= 4 ? 4 : 8;
+            ShuffleMasks& masks = d_masks[width];
+
+            for (int i = 0; i < 16; ++i) {
+                const int putElement = i / width;
+                const int putByte    = i % width;
+                masks.d_put[i] = static_cast<unsigned char>(
+                                 putElement < 16 / size
+                                 ? putElement * size + width - 1 - putByte
+                                 : 0x80);
+
+                const int getElement = i / size;
+                const int getByte    = i % size;
+                masks.d_get[i]  = static_cast<unsigned char>(
+                                 getByte < width
+                                 ? getElement * width + width - 1 - getByte
+                                 : 0x80);
+                masks.d_sign[i] = static_cast<unsigned char>(
+                                 getByte < width ? 0x80 : getElement * width);
+            }
+        }
+    }
+};
+
+int detectShuffleLevel()
+    // Return the widest byte shuffle supported by the processor and the
+    // operating system.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    if (1 > maxLeaf) {
+        return k_SCALAR;                                              // RETURN
+    }
+    __cpuid(info, 1);
+    const bool hasSsse3 = 0 != (info[2] & (1 << 9));
+    const bool hasAvx   = 0 != (info[2] & (1 << 27))    // OSXSAVE
+                       && 0 != (info[2] & (1 << 28))    // AVX
+                       && 6 == (_xgetbv(0) & 6);        // XMM and YMM state
+    bool       hasAvx2  = false;
+    if (hasAvx && 7 <= maxLeaf) {
+        __cpuidex(info, 7, 0);
+        hasAvx2 = 0 != (info[1] & (1 << 5));
+    }
+#else
+    __builtin_cpu_init();
+    const bool hasSsse3 = __builtin_cpu_supports("ssse3");
+    const bool hasAvx2  = __builtin_cpu_supports("avx2");
+#endif
+    return hasAvx2 ? k_AVX2 : hasSsse3 ? k_SSSE3 : k_SCALAR;
+}
+
+// The table is initialized before the level, so that (as both are zero until
+// initialized) the scalar functions are used by any earlier static
+// initialization.
+
+const ShuffleMaskTable s_maskTable;
+const int              s_shuffleLevel = detectShuffleLevel();
+
+U_TARGET("ssse3")
+bsl::size_t shufflePut(char                *buffer,
+                       const char          *values,
+                       bsl::size_t          numValues,
+                       int                  width,
+                       int                  size,
+                       const unsigned char *mask)
+    // Load into the specified 'buffer' the specified 'width'-byte network
+    // representation of a prefix of the specified 'numValues' elements of
+    // 'size' bytes at the specified 'values', using the specified 'mask', and
+    // return the number of elements marshalled.  16 bytes are stored for each
+    // vector of elements, so marshalling stops while fewer than 16 bytes of
+    // 'buffer' remain.
+{
+    const __m128i     control   = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(mask));
+    const bsl::size_t perVector = 16 / size;
+    const bsl::size_t step      = perVector * width;
+
+    bsl::size_t numDone = 0;
+    while ((numValues - numDone) * width >= 16) {
+        const __m128i data = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(values));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer),
+                         _mm_shuffle_epi8(data, control));
+        values  += 16;
+        buffer  += step;
+        numDone += perVector;
+    }
+    return numDone;
+}
+
+U_TARGET("ssse3")
+bsl::size_t shuffleGet(char                *variables,
+                       const char          *buffer,
+                       bsl::size_t          numVariables,
+                       int                  width,
+                       int                  size,
+                       const unsigned char *mask,
+                       const unsigned char *signMask)
+    // Load into the specified 'variables' of 'size' bytes a prefix of the
+    // specified 'numVariables' elements whose 'width'-byte network
+    // representations are at the specified 'buffer', using the specified
+    // 'mask', and sign-extending using the specified 'signMask' unless it is
+    // 0, and return the number of elements marshalled.  16 bytes are loaded
+    // for each vector of elements, so marshalling stops while fewer than 16
+    // bytes of 'buffer' remain.
+{
+    const __m128i     control   = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(mask));
+    const __m128i     sign      = signMask
+                                ? _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(signMask))
+                                : _mm_setzero_si128();
+    const __m128i     zero      = _mm_setzero_si128();
+    const bsl::size_t perVector = 16 / size;
+    const bsl::size_t step      = perVector * width;
+
+    bsl::size_t numDone = 0;
+    while ((numVariables - numDone) * width >= 16) {
+        const __m128i data   = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(buffer));
+        __m128i       result = _mm_shuffle_epi8(data, control);
+        if (signMask) {
+            // Each extension byte holds a copy of the sign byte, and each
+            // other byte holds 0; a negative byte becomes 0xff.
+
+            result = _mm_or_si128(
+                          result,
+                          _mm_cmplt_epi8(_mm_shuffle_epi8(data, sign), zero));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(variables), result);
+        buffer    += step;
+        variables += 16;
+        numDone   += perVector;
+    }
+    return numDone;
+}
+
+U_TARGET("avx2")
+bsl::size_t reverseAvx2(char                *destination,
+                        const char          *source,
+                        bsl::size_t          numElements,
+                        int                  size,
+                        const unsigned char *mask)
+    // Load into the specified 'destination' a prefix of the specified
+    // 'numElements' elements of 'size' bytes at the specified 'source' with
+    // the order of the bytes of each element reversed by the specified
+    // 'mask', 32 bytes at a time, and return the number of elements
+    // reversed.
+{
+    const __m256i     control   = _mm256_broadcastsi128_si256(
+                                    _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(mask)));
+    const bsl::size_t perVector = 32 / size;
+
+    bsl::size_t numDone = 0;
+    while (numElements - numDone >= perVector) {
+        const __m256i data = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(source));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination),
+                            _mm256_shuffle_epi8(data, control));
+        source      += 32;
+        destination += 32;
+        numDone     += perVector;
+    }
+    return numDone;
+}
+
+template <class TYPE>
+int putBulk(char *buffer, const TYPE *values, int numValues, int width)
+    // Load into the specified 'buffer' the specified 'width'-byte network
+    // representation of a prefix of the specified 'numValues' elements at the
+    // specified 'values', using byte shuffles if the processor supports them,
+    // and return the number of elements marshalled.
+{
+    if (k_SCALAR == s_shuffleLevel) {
+        return 0;                                                     // RETURN
+    }
+
+    const int            size   = static_cast<int>(sizeof(TYPE));
+    const unsigned char *mask   = s_maskTable.d_masks[width].d_put;
+    const char          *source = reinterpret_cast<const char *>(values);
+
+    bsl::size_t numDone = 0;
+    if (k_AVX2 == s_shuffleLevel && width == size) {
+        numDone = reverseAvx2(buffer, source, numValues, size, mask);
+    }
+    numDone += shufflePut(buffer + numDone * width,
+                          source + numDone * size,
+                          numValues - numDone,
+                          width,
+                          size,
+                          mask);
+    return static_cast<int>(numDone);
+}
+
+template <class TYPE>
+int getBulk(TYPE *variables, const char *buffer, int numVariables, int width)
+    // Load into the specified 'variables' a prefix of the specified
+    // 'numVariables' elements whose specified 'width'-byte network
+    // representations are at the specified 'buffer', sign-extending if 'TYPE'
+    // is signed, using byte shuffles if the processor supports them, and
+    // return the number of elements marshalled.
+{
+    if (k_SCALAR == s_shuffleLevel) {
+        return 0;                                                     // RETURN
+    }
+
+    const int            size        = static_cast<int>(sizeof(TYPE));
+    const ShuffleMasks&  masks       = s_maskTable.d_masks[width];
+    char                *destination = reinterpret_cast<char *>(variables);
+    const bool           isSigned    = static_cast<TYPE>(-1) < TYPE();
+
+    bsl::size_t numDone = 0;
+    if (k_AVX2 == s_shuffleLevel && width == size) {
+        numDone = reverseAvx2(destination,
+                              buffer,
+                              numVariables,
+                              size,
+                              masks.d_get);
+    }
+    numDone += shuffleGet(destination + numDone * size,
+                          buffer + numDone * width,
+                          numVariables - numDone,
+                          width,
+                          size,
+                          masks.d_get,
+                          isSigned && width < size ? masks.d_sign : 0);
+    return static_cast<int>(numDone);
+}
+
+#else
+
+template <class TYPE>
+inline
+int putBulk(char *, const TYPE *, int, int)
+    // Return 0; no elements are marshalled in bulk on this platform.
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+int getBulk(TYPE *, const char *, int, int)
+    // Return 0; no elements are marshalled in bulk on this platform.
+{
+    return 0;
+}
+
+#endif
+
+}  // close unnamed namespace
+
 namespace bslx {
 
                         // ----------------------
@@ -24,6 +343,11 @@ void MarshallingUtil::putArrayInt64(char                     *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Int64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT64);
+    buffer += numBulk * k_SIZEOF_INT64;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt64(buffer, *values);
         buffer += k_SIZEOF_INT64;
@@ -39,6 +363,11 @@ void MarshallingUtil::putArrayInt64(char                      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Uint64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT64);
+    buffer += numBulk * k_SIZEOF_INT64;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt64(buffer, *values);
         buffer += k_SIZEOF_INT64;
@@ -54,6 +383,11 @@ void MarshallingUtil::putArrayInt56(char                     *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Int64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT56);
+    buffer += numBulk * k_SIZEOF_INT56;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt56(buffer, *values);
         buffer += k_SIZEOF_INT56;
@@ -69,6 +403,11 @@ void MarshallingUtil::putArrayInt56(char                      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Uint64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT56);
+    buffer += numBulk * k_SIZEOF_INT56;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt56(buffer, *values);
         buffer += k_SIZEOF_INT56;
@@ -84,6 +423,11 @@ void MarshallingUtil::putArrayInt48(char                     *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Int64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT48);
+    buffer += numBulk * k_SIZEOF_INT48;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt48(buffer, *values);
         buffer += k_SIZEOF_INT48;
@@ -99,6 +443,11 @@ void MarshallingUtil::putArrayInt48(char                      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Uint64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT48);
+    buffer += numBulk * k_SIZEOF_INT48;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt48(buffer, *values);
         buffer += k_SIZEOF_INT48;
@@ -114,6 +463,11 @@ void MarshallingUtil::putArrayInt40(char                     *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Int64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT40);
+    buffer += numBulk * k_SIZEOF_INT40;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt40(buffer, *values);
         buffer += k_SIZEOF_INT40;
@@ -129,6 +483,11 @@ void MarshallingUtil::putArrayInt40(char                      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const bsls::Types::Uint64 *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT40);
+    buffer += numBulk * k_SIZEOF_INT40;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt40(buffer, *values);
         buffer += k_SIZEOF_INT40;
@@ -144,6 +503,11 @@ void MarshallingUtil::putArrayInt32(char      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const int *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT32);
+    buffer += numBulk * k_SIZEOF_INT32;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt32(buffer, *values);
         buffer += k_SIZEOF_INT32;
@@ -159,6 +523,11 @@ void MarshallingUtil::putArrayInt32(char               *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const unsigned int *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT32);
+    buffer += numBulk * k_SIZEOF_INT32;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt32(buffer, *values);
         buffer += k_SIZEOF_INT32;
@@ -174,6 +543,11 @@ void MarshallingUtil::putArrayInt24(char      *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const int *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT24);
+    buffer += numBulk * k_SIZEOF_INT24;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt24(buffer, *values);
         buffer += k_SIZEOF_INT24;
@@ -189,6 +563,11 @@ void MarshallingUtil::putArrayInt24(char               *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const unsigned int *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT24);
+    buffer += numBulk * k_SIZEOF_INT24;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt24(buffer, *values);
         buffer += k_SIZEOF_INT24;
@@ -204,6 +583,11 @@ void MarshallingUtil::putArrayInt16(char        *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const short *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT16);
+    buffer += numBulk * k_SIZEOF_INT16;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt16(buffer, *values);
         buffer += k_SIZEOF_INT16;
@@ -219,6 +603,11 @@ void MarshallingUtil::putArrayInt16(char                 *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const unsigned short *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_INT16);
+    buffer += numBulk * k_SIZEOF_INT16;
+    values += numBulk;
+
     for (; values != end; ++values) {
         putInt16(buffer, *values);
         buffer += k_SIZEOF_INT16;
@@ -236,6 +625,11 @@ void MarshallingUtil::putArrayFloat64(char         *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const double *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_FLOAT64);
+    buffer += numBulk * k_SIZEOF_FLOAT64;
+    values += numBulk;
+
     for (; values < end; ++values) {
         putFloat64(buffer, *values);
         buffer += k_SIZEOF_FLOAT64;
@@ -251,6 +645,11 @@ void MarshallingUtil::putArrayFloat32(char        *buffer,
     BSLS_ASSERT(0 <= numValues);
 
     const float *end = values + numValues;
+
+    const int numBulk = putBulk(buffer, values, numValues, k_SIZEOF_FLOAT32);
+    buffer += numBulk * k_SIZEOF_FLOAT32;
+    values += numBulk;
+
     for (; values < end; ++values) {
         putFloat32(buffer, *values);
         buffer += k_SIZEOF_FLOAT32;
@@ -268,6 +667,14 @@ void MarshallingUtil::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Int64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT64);
+    buffer    += numBulk * k_SIZEOF_INT64;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt64(variables, buffer);
         buffer += k_SIZEOF_INT64;
@@ -283,6 +690,14 @@ void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Uint64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT64);
+    buffer    += numBulk * k_SIZEOF_INT64;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint64(variables, buffer);
         buffer += k_SIZEOF_INT64;
@@ -298,6 +713,14 @@ void MarshallingUtil::getArrayInt56(bsls::Types::Int64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Int64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT56);
+    buffer    += numBulk * k_SIZEOF_INT56;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt56(variables, buffer);
         buffer += k_SIZEOF_INT56;
@@ -313,6 +736,14 @@ void MarshallingUtil::getArrayUint56(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Uint64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT56);
+    buffer    += numBulk * k_SIZEOF_INT56;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint56(variables, buffer);
         buffer += k_SIZEOF_INT56;
@@ -328,6 +759,14 @@ void MarshallingUtil::getArrayInt48(bsls::Types::Int64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Int64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT48);
+    buffer    += numBulk * k_SIZEOF_INT48;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt48(variables, buffer);
         buffer += k_SIZEOF_INT48;
@@ -343,6 +782,14 @@ void MarshallingUtil::getArrayUint48(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Uint64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT48);
+    buffer    += numBulk * k_SIZEOF_INT48;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint48(variables, buffer);
         buffer += k_SIZEOF_INT48;
@@ -358,6 +805,14 @@ void MarshallingUtil::getArrayInt40(bsls::Types::Int64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Int64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT40);
+    buffer    += numBulk * k_SIZEOF_INT40;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt40(variables, buffer);
         buffer += k_SIZEOF_INT40;
@@ -373,6 +828,14 @@ void MarshallingUtil::getArrayUint40(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const bsls::Types::Uint64 *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT40);
+    buffer    += numBulk * k_SIZEOF_INT40;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint40(variables, buffer);
         buffer += k_SIZEOF_INT40;
@@ -388,6 +851,14 @@ void MarshallingUtil::getArrayInt32(int        *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const int *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT32);
+    buffer    += numBulk * k_SIZEOF_INT32;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt32(variables, buffer);
         buffer += k_SIZEOF_INT32;
@@ -403,6 +874,14 @@ void MarshallingUtil::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const unsigned int *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT32);
+    buffer    += numBulk * k_SIZEOF_INT32;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint32(variables, buffer);
         buffer += k_SIZEOF_INT32;
@@ -418,6 +897,14 @@ void MarshallingUtil::getArrayInt24(int        *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const int *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT24);
+    buffer    += numBulk * k_SIZEOF_INT24;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt24(variables, buffer);
         buffer += k_SIZEOF_INT24;
@@ -433,6 +920,14 @@ void MarshallingUtil::getArrayUint24(unsigned int *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const unsigned int *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT24);
+    buffer    += numBulk * k_SIZEOF_INT24;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint24(variables, buffer);
         buffer += k_SIZEOF_INT24;
@@ -448,6 +943,14 @@ void MarshallingUtil::getArrayInt16(short      *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const short *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT16);
+    buffer    += numBulk * k_SIZEOF_INT16;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getInt16(variables, buffer);
         buffer += k_SIZEOF_INT16;
@@ -463,6 +966,14 @@ void MarshallingUtil::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const unsigned short *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT16);
+    buffer    += numBulk * k_SIZEOF_INT16;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getUint16(variables, buffer);
         buffer += k_SIZEOF_INT16;
@@ -480,6 +991,14 @@ void MarshallingUtil::getArrayFloat64(double     *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const double *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_FLOAT64);
+    buffer    += numBulk * k_SIZEOF_FLOAT64;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getFloat64(variables, buffer);
         buffer += k_SIZEOF_FLOAT64;
@@ -495,6 +1014,14 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
     BSLS_ASSERT(0 <= numVariables);
 
     const float *end = variables + numVariables;
+
+    const int numBulk = getBulk(variables,
+                                buffer,
+                                numVariables,
+                                k_SIZEOF_INT32);
+    buffer    += numBulk * k_SIZEOF_INT32;
+    variables += numBulk;
+
     for (; variables != end; ++variables) {
         getFloat32(variables, buffer);
         buffer += k_SIZEOF_INT32;
@@ -114,8 +114,9 @@ using namespace bslx;
 // [ 1] REVERSE FUNCTION: void reverse(T *array, int numElements)
 // [ 2] EXPLORE DOUBLE FORMAT -- make sure format is IEEE-COMPLIANT
 // [ 3] EXPLORE FLOAT FORMAT -- make sure format is IEEE-COMPLIANT
-// [24] STRESS TEST - Used to determine performance characteristics.
-// [25] USAGE EXAMPLE
+// [24] BULK ARRAY MARSHALLING
+// [25] STRESS TEST - Used to determine performance characteristics.
+// [26] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -322,6 +323,68 @@ static void printFloat(ostream& stream, float number)
     printFloatBits(stream, number) << ": " << number << endl;
 }
 
+// ============================================================================
+//                      FUNCTIONS TO TEST ARRAYS IN BULK
+// ----------------------------------------------------------------------------
+
+const int k_MAX_BULK_LENGTH = 72;  // longest array tested in bulk
+
+template <class TYPE>
+void testBulkArray(int    line,
+                   void (*putArray)(char *, const TYPE *, int),
+                   void (*getArray)(TYPE *, const char *, int),
+                   int    size)
+    // Verify that the specified 'putArray' and 'getArray' functions, that
+    // marshal elements whose network representation has the specified 'size'
+    // bytes, marshal arrays of each length up to 'k_MAX_BULK_LENGTH', written
+    // at several offsets from an aligned buffer, as they marshal each of
+    // their elements individually.  Report failures using the specified
+    // 'line'.
+{
+    TYPE                values[k_MAX_BULK_LENGTH];
+    bsls::Types::Uint64 random = 0x0123456789ABCDEFull;
+    for (int i = 0; i < k_MAX_BULK_LENGTH; ++i) {
+        // Linear congruential generator; alternate the sign of the values.
+
+        random    = random * 6364136223846793005ull + 1442695040888963407ull;
+        values[i] = static_cast<TYPE>(
+                      i % 2 ? static_cast<bsls::Types::Int64>(random >> 1)
+                            : -static_cast<bsls::Types::Int64>(random >> 1));
+    }
+
+    const int k_BUFFER_SIZE = 8 * k_MAX_BULK_LENGTH + 8;
+
+    for (int length = 0; length <= k_MAX_BULK_LENGTH; ++length) {
+        for (int offset = 0; offset < 4; ++offset) {
+            char actual[k_BUFFER_SIZE];
+            char expected[k_BUFFER_SIZE];
+            memset(actual,   '\xa5', sizeof actual);
+            memset(expected, '\xa5', sizeof expected);
+
+            putArray(actual + offset, values, length);
+            for (int i = 0; i < length; ++i) {
+                putArray(expected + offset + i * size, values + i, 1);
+            }
+            ASSERTV(line, length, offset,
+                    0 == memcmp(actual, expected, sizeof actual));
+
+            TYPE actualValues[k_MAX_BULK_LENGTH + 1];
+            TYPE expectedValues[k_MAX_BULK_LENGTH + 1];
+            memset(actualValues,   0x5a, sizeof actualValues);
+            memset(expectedValues, 0x5a, sizeof expectedValues);
+
+            getArray(actualValues, actual + offset, length);
+            for (int i = 0; i < length; ++i) {
+                getArray(expectedValues + i, actual + offset + i * size, 1);
+            }
+            ASSERTV(line, length, offset,
+                    0 == memcmp(actualValues,
+                                expectedValues,
+                                sizeof actualValues));
+        }
+    }
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -335,7 +398,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -397,7 +460,7 @@ int main(int argc, char *argv[]) {
 //..
 
       } break;
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // STRESS TEST
         //   Provide mechanism to determine performance characteristics.
@@ -492,6 +555,96 @@ int main(int argc, char *argv[]) {
         if (verbose) cerr << "END" << endl;
 
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // BULK ARRAY MARSHALLING
+        //   On some platforms, the array functions marshal several elements at
+        //   a time using vector instructions, and marshal the remaining
+        //   elements individually.
+        //
+        // Concerns:
+        //: 1 Each array function marshals an array as it marshals each of its
+        //:   elements individually, for arrays long enough to be marshalled
+        //:   (in part) several elements at a time, and for each number of
+        //:   remaining elements.
+        //:
+        //: 2 The array functions do not write outside of the destination
+        //:   array.
+        //:
+        //: 3 The 'get' functions sign-extend signed values, and zero-extend
+        //:   unsigned values, whose network representation is narrower than
+        //:   their type.
+        //:
+        //: 4 The array functions do not depend on the alignment of the buffer.
+        //
+        // Plan:
+        //: 1 For each array function, and for arrays of pseudo-random positive
+        //:   and negative values of each length up to 72, 'put' the array at
+        //:   offsets 0 to 3 from an aligned buffer, and compare the buffer to
+        //:   one to which each element was 'put' by the function as an array
+        //:   of length 1.  Then 'get' the array from the buffer and compare
+        //:   the result likewise.  Fill each buffer and array beforehand, and
+        //:   compare them in their entirety.  (C-1..4)
+        //
+        // Testing:
+        //   BULK ARRAY MARSHALLING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ARRAY MARSHALLING" << endl
+                          << "======================" << endl;
+
+        typedef bsls::Types::Int64  T64;
+        typedef bsls::Types::Uint64 U64;
+        typedef MarshallingUtil     Util;
+
+        testBulkArray<T64>(L_, &Util::putArrayInt64, &Util::getArrayInt64, 8);
+        testBulkArray<U64>(L_, &Util::putArrayInt64, &Util::getArrayUint64, 8);
+        testBulkArray<T64>(L_, &Util::putArrayInt56, &Util::getArrayInt56, 7);
+        testBulkArray<U64>(L_, &Util::putArrayInt56, &Util::getArrayUint56, 7);
+        testBulkArray<T64>(L_, &Util::putArrayInt48, &Util::getArrayInt48, 6);
+        testBulkArray<U64>(L_, &Util::putArrayInt48, &Util::getArrayUint48, 6);
+        testBulkArray<T64>(L_, &Util::putArrayInt40, &Util::getArrayInt40, 5);
+        testBulkArray<U64>(L_, &Util::putArrayInt40, &Util::getArrayUint40, 5);
+
+        testBulkArray<int>(L_, &Util::putArrayInt32, &Util::getArrayInt32, 4);
+        testBulkArray<unsigned int>(L_,
+                                    &Util::putArrayInt32,
+                                    &Util::getArrayUint32,
+                                    4);
+        testBulkArray<int>(L_, &Util::putArrayInt24, &Util::getArrayInt24, 3);
+        testBulkArray<unsigned int>(L_,
+                                    &Util::putArrayInt24,
+                                    &Util::getArrayUint24,
+                                    3);
+
+        testBulkArray<short>(L_,
+                             &Util::putArrayInt16,
+                             &Util::getArrayInt16,
+                             2);
+        testBulkArray<unsigned short>(L_,
+                                      &Util::putArrayInt16,
+                                      &Util::getArrayUint16,
+                                      2);
+
+        testBulkArray<signed char>(L_,
+                                   &Util::putArrayInt8,
+                                   &Util::getArrayInt8,
+                                   1);
+        testBulkArray<unsigned char>(L_,
+                                     &Util::putArrayInt8,
+                                     &Util::getArrayInt8,
+                                     1);
+
+        testBulkArray<double>(L_,
+                              &Util::putArrayFloat64,
+                              &Util::getArrayFloat64,
+                              8);
+        testBulkArray<float>(L_,
+                             &Util::putArrayFloat32,
+                             &Util::getArrayFloat32,
+                             4);
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // PUT/GET 32-BIT FLOAT ARRAYS
@@ -0,0 +1,59 @@
+// baltzo-mmapdatabase.m.cpp                                          -*-C++-*-
+
+// This program compiles a directory hierarchy of Zoneinfo binary files (for
+// example, '/usr/share/zoneinfo') into a single time-zone database file that
+// can be loaded by 'baltzo::MmapDataFileLoader'.
+//
+// Usage: baltzo-mmapdatabase <zoneinfo-root> <output-file>
+
+#include <baltzo_mmapdatafileloader.h>
+
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+int main(int argc, char *argv[])
+{
+    if (3 != argc) {
+        bsl::cerr << "Usage: " << argv[0] << " <zoneinfo-root> <output-file>"
+                  << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    bsl::ofstream output(argv[2], bsl::ios::binary | bsl::ios::trunc);
+    if (!output) {
+        bsl::cerr << "Failed to open '" << argv[2] << "'" << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    if (0 != baltzo::MmapDataFileLoader::writeFromDirectory(output,
+                                                            argv[1])) {
+        bsl::cerr << "Failed to compile '" << argv[1] << "'" << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    output.close();
+    if (!output) {
+        bsl::cerr << "Failed to write '" << argv[2] << "'" << bsl::endl;
+        return 1;                                                     // RETURN
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------